@@ -60,6 +60,51 @@ LOCAL_STATIC_LIBRARIES += enkiTS
 
 include $(BUILD_SHARED_LIBRARY)
 
+###########################
+#
+# GL static library (benchmarks link against it to reach internal symbols)
+#
+###########################
+
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := VKGL32_static
+
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/include
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/deps
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/deps/Anvil/include
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/deps/Anvil/deps/glslang
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/deps/Anvil/deps/glslang/include
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/include/Khronos
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/include/Khronos/GL
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/include/Khronos/KHR
+
+LOCAL_EXPORT_C_INCLUDES := $(LOCAL_C_INCLUDES)
+
+LOCAL_SRC_FILES := $(MY_SRC_LIST)
+
+LOCAL_CXXFLAGS = -g -std=c++17 -Wall
+LOCAL_CXXFLAGS += -frtti -fno-exceptions
+LOCAL_CXXFLAGS += -fdeclspec
+LOCAL_CXXFLAGS += -fms-extensions
+LOCAL_CXXFLAGS += -funwind-tables
+
+LOCAL_CXXFLAGS += -DVK_USE_PLATFORM_ANDROID_KHR
+
+LOCAL_EXPORT_LDLIBS := -ldl
+
+LOCAL_STATIC_LIBRARIES := Anvil
+
+LOCAL_STATIC_LIBRARIES += OSDependent
+LOCAL_STATIC_LIBRARIES += OGLCompiler
+LOCAL_STATIC_LIBRARIES += HLSL
+LOCAL_STATIC_LIBRARIES += glslang
+LOCAL_STATIC_LIBRARIES += SPIRV
+
+LOCAL_STATIC_LIBRARIES += enkiTS
+
+include $(BUILD_STATIC_LIBRARY)
+
 
 ###########################
 #
@@ -108,5 +153,102 @@ LOCAL_LDLIBS := -ldl -landroid
 
 include $(BUILD_SHARED_LIBRARY)
 
+###########################
+#
+# GL capture replayer
+#
+###########################
+
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := vkgl_replay
+
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/include
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/deps
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/deps/Anvil/include
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/include/Khronos
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/include/Khronos/GL
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/include/Khronos/KHR
+
+LOCAL_SRC_FILES := src/Replayer/main.cpp
+
+LOCAL_CXXFLAGS = -g -std=c++17 -Wall
+LOCAL_CXXFLAGS += -frtti -fno-exceptions
+LOCAL_CXXFLAGS += -fms-extensions
+
+LOCAL_CXXFLAGS += -DVK_USE_PLATFORM_ANDROID_KHR
+
+LOCAL_SHARED_LIBRARIES := VKGL32
+
+include $(BUILD_EXECUTABLE)
+
+###########################
+#
+# Frontend overhead benchmark
+#
+###########################
+
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := vkgl_frontend_bench
+
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/include
+
+LOCAL_SRC_FILES := src/Benchmarks/frontend_overhead.cpp
+
+LOCAL_CXXFLAGS = -g -std=c++17 -Wall
+LOCAL_CXXFLAGS += -frtti -fno-exceptions
+LOCAL_CXXFLAGS += -fms-extensions
+
+LOCAL_SHARED_LIBRARIES := VKGL32
+
+include $(BUILD_EXECUTABLE)
+
+###########################
+#
+# Frame graph streaming benchmark
+#
+###########################
+
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := vkgl_frame_graph_bench
+
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/include
+
+LOCAL_SRC_FILES := src/Benchmarks/frame_graph_streaming.cpp
+
+LOCAL_CXXFLAGS = -g -std=c++17 -Wall
+LOCAL_CXXFLAGS += -frtti -fno-exceptions
+LOCAL_CXXFLAGS += -fms-extensions
+
+LOCAL_SHARED_LIBRARIES := VKGL32
+
+include $(BUILD_EXECUTABLE)
+
+###########################
+#
+# Primitive microbenchmarks
+#
+###########################
+
+include $(CLEAR_VARS)
+
+LOCAL_MODULE := vkgl_primitives_bench
+
+LOCAL_SRC_FILES := src/Benchmarks/benchmark.cpp
+LOCAL_SRC_FILES += src/Benchmarks/enum_conversion.cpp
+LOCAL_SRC_FILES += src/Benchmarks/primitives.cpp
+
+LOCAL_CXXFLAGS = -g -O2 -std=c++17 -Wall
+LOCAL_CXXFLAGS += -frtti -fno-exceptions
+LOCAL_CXXFLAGS += -fms-extensions
+
+LOCAL_CXXFLAGS += -DVK_USE_PLATFORM_ANDROID_KHR
+
+LOCAL_STATIC_LIBRARIES := VKGL32_static
+
+include $(BUILD_EXECUTABLE)
+
 include $(LOCAL_PATH)/deps/Anvil/Android.mk \
 		$(LOCAL_PATH)/deps/enkiTS/Android.mk
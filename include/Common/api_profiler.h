@@ -0,0 +1,135 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_COMMON_API_PROFILER_H
+#define VKGL_COMMON_API_PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(_WIN32)
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+/* Per-entry-point API profiler.
+ *
+ * Always compiled in, disabled by default. Enable with VKGL_API_PROFILER=1 in the environment, or at run-time with
+ * VKGL::APIProfiler::set_enabled(). While enabled, every GL entry point records its call count and a log2 histogram of
+ * its latency (in timestamp ticks, see get_timestamp()) into counters owned by the calling thread. The counters are
+ * only ever written by their owner, so recording a call involves no locks and no atomic RMW ops.
+ *
+ * Once per frame, OpenGL::Context::present() calls on_frame_presented(), which sums up all threads' counters and appends
+ * the frame's numbers to the file named by VKGL_API_PROFILER_FILE (vkgl_api_profile.txt by default).
+ *
+ * When disabled, the cost per GL call is a relaxed load & a well-predicted branch on the way in, and a null check on
+ * the way out.
+ */
+namespace VKGL
+{
+    /* One instance per entry point, defined by VKGL_API_PROFILER_SCOPE(). Constant-initialized, so there is no static
+     * init guard on the call path.
+     */
+    typedef struct APIProfilerEntryPoint
+    {
+        const char* const     name;
+        std::atomic<uint32_t> id; //< Assigned the first time the entry point is called with the profiler enabled.
+
+        constexpr APIProfilerEntryPoint(const char* in_name)
+            :name(in_name),
+             id  (UINT32_MAX)
+        {
+            /* Stub */
+        }
+    } APIProfilerEntryPoint;
+
+    extern std::atomic<bool> g_api_profiler_enabled;
+
+    class APIProfiler
+    {
+    public:
+        /* Public functions */
+        static uint64_t get_timestamp()
+        {
+            #if defined(_WIN32) || defined(__x86_64__) || defined(__i386__)
+            {
+                return __rdtsc();
+            }
+            #elif defined(__aarch64__)
+            {
+                uint64_t result;
+
+                __asm__ volatile("mrs %0, cntvct_el0" : "=r"(result) );
+
+                return result;
+            }
+            #else
+            {
+                return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch() ).count() );
+            }
+            #endif
+        }
+
+        static bool is_enabled()
+        {
+            return g_api_profiler_enabled.load(std::memory_order_relaxed);
+        }
+
+        /* Aggregates counters recorded since the previous call and writes them out. Called once per frame from the
+         * app's rendering thread.
+         */
+        static void on_frame_presented();
+
+        static void record_call(APIProfilerEntryPoint* in_entry_point_ptr,
+                                const uint64_t&        in_n_ticks);
+
+        static void set_enabled(const bool& in_enabled);
+
+    private:
+        /* Private functions */
+        APIProfiler();
+    };
+
+    class APIProfilerScope
+    {
+    public:
+        /* Public functions */
+        APIProfilerScope(APIProfilerEntryPoint* in_entry_point_ptr)
+            :m_entry_point_ptr(nullptr),
+             m_start_timestamp(0)
+        {
+            if (APIProfiler::is_enabled() )
+            {
+                m_entry_point_ptr = in_entry_point_ptr;
+                m_start_timestamp = APIProfiler::get_timestamp();
+            }
+        }
+
+        ~APIProfilerScope()
+        {
+            if (m_entry_point_ptr != nullptr)
+            {
+                APIProfiler::record_call(m_entry_point_ptr,
+                                         APIProfiler::get_timestamp() - m_start_timestamp);
+            }
+        }
+
+    private:
+        /* Private functions */
+        APIProfilerScope           (const APIProfilerScope&);
+        APIProfilerScope& operator=(const APIProfilerScope&);
+
+        /* Private variables */
+        APIProfilerEntryPoint* m_entry_point_ptr;
+        uint64_t               m_start_timestamp;
+    };
+};
+
+#define VKGL_API_PROFILER_SCOPE()                                                                 \
+    static VKGL::APIProfilerEntryPoint vkgl_api_profiler_entry_point(__func__);                   \
+    VKGL::APIProfilerScope             vkgl_api_profiler_scope      (&vkgl_api_profiler_entry_point)
+
+#endif /* VKGL_COMMON_API_PROFILER_H */
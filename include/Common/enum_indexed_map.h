@@ -0,0 +1,90 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_COMMON_ENUM_INDEXED_MAP_H
+#define VKGL_COMMON_ENUM_INDEXED_MAP_H
+
+#include "Common/macros.h"
+#include <array>
+#include <initializer_list>
+#include <utility>
+
+namespace VKGL
+{
+    /* Map from a dense enum class to values, stored as a flat array indexed with the enum value.
+     *
+     * Meant as a drop-in for std::unordered_map in property lookup tables hit by glGet*() and friends: find() is a bounds
+     * check and an array read, with no hashing and no node chasing.
+     *
+     * EnumType values must start at zero and be contiguous, with END_ENUM (usually Unknown) as the last value. ValueType
+     * must be default-constructible.
+     */
+    template<typename EnumType, typename ValueType, EnumType END_ENUM = EnumType::Unknown>
+    class EnumIndexedMap
+    {
+    public:
+        /* Public type definitions */
+        typedef std::pair<EnumType, ValueType> Item;
+
+        /* Public functions */
+        EnumIndexedMap()
+        {
+            m_is_set.fill(false);
+        }
+
+        EnumIndexedMap(std::initializer_list<Item> in_items)
+        {
+            *this = in_items;
+        }
+
+        EnumIndexedMap& operator=(std::initializer_list<Item> in_items)
+        {
+            m_is_set.fill(false);
+
+            for (const auto& current_item : in_items)
+            {
+                /* Each key may only be listed once. */
+                vkgl_assert(find(current_item.first) == nullptr);
+
+                (*this)[current_item.first] = current_item.second;
+            }
+
+            return *this;
+        }
+
+        /* Returns nullptr if @param in_key has not been assigned a value. */
+        const ValueType* find(const EnumType& in_key) const
+        {
+            const auto index = static_cast<size_t>(in_key);
+
+            return (index < N_KEYS && m_is_set[index]) ? &m_values[index]
+                                                       : nullptr;
+        }
+
+        ValueType* find(const EnumType& in_key)
+        {
+            return const_cast<ValueType*>(static_cast<const EnumIndexedMap*>(this)->find(in_key) );
+        }
+
+        ValueType& operator[](const EnumType& in_key)
+        {
+            const auto index = static_cast<size_t>(in_key);
+
+            vkgl_assert(index < N_KEYS);
+
+            m_is_set[index] = true;
+
+            return m_values[index];
+        }
+
+    private:
+        /* Private variables */
+        static constexpr size_t N_KEYS = static_cast<size_t>(END_ENUM);
+
+        std::array<bool,      N_KEYS> m_is_set;
+        std::array<ValueType, N_KEYS> m_values;
+    };
+}
+
+#endif /* VKGL_COMMON_ENUM_INDEXED_MAP_H */
@@ -0,0 +1,67 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_COMMON_EPOCH_H
+#define VKGL_COMMON_EPOCH_H
+
+#include <cstdint>
+
+/* Epoch-based reclamation for data structures whose readers never take a lock (see read_mostly_hash_map.h).
+ *
+ * Readers bracket each access with EpochReadLock. Writers unlink an object first, then hand it over to retire() instead of
+ * deleting it. The object is released by reclaim() once every thread which could still have been looking at it has left
+ * its read-side section.
+ *
+ * There is a single epoch domain for the whole process. Read-side sections are cheap (two stores and a fence), may nest,
+ * and must not block on anything which may in turn wait for reclaim() to make progress.
+ */
+namespace VKGL
+{
+    typedef void (*EpochDeleterFunc)(void* in_object_ptr);
+
+    class Epoch
+    {
+    public:
+        /* Public functions */
+        static void enter_read();
+        static void leave_read();
+
+        /* Releases all retired objects which no reader can access any more. Safe to call from any thread, including from
+         * within a read-side section.
+         */
+        static void reclaim();
+
+        /* Schedules @param in_object_ptr for destruction with @param in_deleter_func. The object must no longer be reachable
+         * by readers which enter a read-side section after this call.
+         */
+        static void retire(void*            in_object_ptr,
+                           EpochDeleterFunc in_deleter_func);
+
+    private:
+        /* Private functions */
+        Epoch();
+    };
+
+    class EpochReadLock
+    {
+    public:
+        /* Public functions */
+        EpochReadLock()
+        {
+            Epoch::enter_read();
+        }
+
+        ~EpochReadLock()
+        {
+            Epoch::leave_read();
+        }
+
+    private:
+        /* Private functions */
+        EpochReadLock           (const EpochReadLock&);
+        EpochReadLock& operator=(const EpochReadLock&);
+    };
+};
+
+#endif /* VKGL_COMMON_EPOCH_H */
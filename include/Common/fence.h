@@ -7,6 +7,8 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <functional>
+#include <memory>
 #include <mutex>
 
 namespace VKGL
@@ -19,6 +21,7 @@ namespace VKGL
          Fence();
         ~Fence();
 
+        bool is_signaled      ();
         void signal           ();
         void wait             ();
         bool wait_with_timeout(std::chrono::milliseconds in_timeout);
@@ -6,6 +6,7 @@
 #define VKGL_LOGGER_H
 
 #include "vkgl_config.h"
+#include "Common/api_profiler.h"
 #include "Common/macros.h"
 #include <mutex>
 #include <sstream>
@@ -18,11 +19,14 @@
 #define DEBUG_DEPTH
 
 
+/* NOTE: The API profiler hooks into every GL entry point through this macro, regardless of build config. */
 #if defined(FUNC_DEBUG_GLAPI_CALL) && defined(_DEBUG)
 	#define FUN_ENTRY_GLAPI_CALL(level) \
+		VKGL_API_PROFILER_SCOPE();      \
 		printf("[VKGL][FUNC_DEBUG_GLAPI_CALL]: %s()" "\n", __func__)
 #else
-	#define FUN_ENTRY_GLAPI_CALL(level)
+	#define FUN_ENTRY_GLAPI_CALL(level) \
+		VKGL_API_PROFILER_SCOPE()
 #endif
 
 
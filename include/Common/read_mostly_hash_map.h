@@ -0,0 +1,384 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_COMMON_READ_MOSTLY_HASH_MAP_H
+#define VKGL_COMMON_READ_MOSTLY_HASH_MAP_H
+
+#include "Common/epoch.h"
+#include "Common/macros.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace VKGL
+{
+    /* Concurrent hash map for caches which are looked up far more often than they are modified.
+     *
+     * find() is wait-free: it never takes a lock and never writes to shared memory other than the calling thread's epoch
+     * record. insert() and erase() are serialized with an internal mutex.
+     *
+     * The table uses open addressing with linear probing. Each slot holds a pointer to an immutable, heap-allocated entry,
+     * so a reader either sees a complete entry or none at all. Erased slots are tombstoned. When the table fills up past
+     * half of its capacity, writers build a new table and publish it with a single store; the previous table (and any
+     * erased entries) are handed over to VKGL::Epoch, so readers still probing them stay safe.
+     *
+     * Values are copied out, so ValueType should be cheap to copy (usually a raw ptr to an object owned elsewhere).
+     */
+    template<typename KeyType, typename ValueType, typename HashType = std::hash<KeyType> >
+    class ReadMostlyHashMap
+    {
+    public:
+        /* Public functions */
+        ReadMostlyHashMap(const uint32_t& in_n_initial_slots = 64)
+            :m_n_entries   (0),
+             m_n_used_slots(0)
+        {
+            uint32_t n_slots = 4;
+
+            while (n_slots < in_n_initial_slots)
+            {
+                n_slots <<= 1;
+            }
+
+            m_table_ptr.store(new Table(n_slots),
+                              std::memory_order_release);
+        }
+
+        /* NOTE: No thread may access the map while it is being destroyed. */
+        ~ReadMostlyHashMap()
+        {
+            auto table_ptr = m_table_ptr.load(std::memory_order_acquire);
+
+            for (uint32_t n_slot = 0;
+                          n_slot < table_ptr->n_slots;
+                        ++n_slot)
+            {
+                auto entry_ptr = table_ptr->slots[n_slot].load(std::memory_order_relaxed);
+
+                if (entry_ptr != nullptr          &&
+                    entry_ptr != get_tombstone() )
+                {
+                    delete entry_ptr;
+                }
+            }
+
+            delete table_ptr;
+        }
+
+        /* Removes @param in_key from the map. Returns false if the key was not found. */
+        bool erase(const KeyType& in_key)
+        {
+            bool result = false;
+
+            {
+                std::lock_guard<std::mutex> lock     (m_writer_mutex);
+                const auto                  hash     (HashType()(in_key) );
+                auto                        table_ptr(m_table_ptr.load(std::memory_order_relaxed) );
+                Entry*                      entry_ptr(nullptr);
+                const auto                  n_slot   (find_slot(table_ptr,
+                                                                in_key,
+                                                                hash,
+                                                               &entry_ptr) );
+
+                if (n_slot != UINT32_MAX)
+                {
+                    table_ptr->slots[n_slot].store(get_tombstone(),
+                                                   std::memory_order_release);
+
+                    VKGL::Epoch::retire(entry_ptr,
+                                        delete_entry);
+
+                    m_n_entries.fetch_sub(1,
+                                          std::memory_order_relaxed);
+
+                    result = true;
+                }
+            }
+
+            if (result)
+            {
+                VKGL::Epoch::reclaim();
+            }
+
+            return result;
+        }
+
+        /* Looks up @param in_key. If found, the value is copied to @param out_opt_value_ptr (if not null) and true is returned. */
+        bool find(const KeyType& in_key,
+                  ValueType*     out_opt_value_ptr) const
+        {
+            VKGL::EpochReadLock lock;
+            Entry*              entry_ptr(nullptr);
+            bool                result   (false);
+            const auto          table_ptr(m_table_ptr.load(std::memory_order_acquire) );
+
+            if (find_slot(table_ptr,
+                          in_key,
+                          HashType()(in_key),
+                         &entry_ptr) != UINT32_MAX)
+            {
+                if (out_opt_value_ptr != nullptr)
+                {
+                    *out_opt_value_ptr = entry_ptr->value;
+                }
+
+                result = true;
+            }
+
+            return result;
+        }
+
+        /* Calls @param in_func for each (key, value) pair stored in the map. Entries inserted or erased by other threads while
+         * the function runs may or may not be reported.
+         */
+        void for_each(std::function<void(const KeyType&, const ValueType&)> in_func) const
+        {
+            VKGL::EpochReadLock lock;
+            const auto          table_ptr(m_table_ptr.load(std::memory_order_acquire) );
+
+            for (uint32_t n_slot = 0;
+                          n_slot < table_ptr->n_slots;
+                        ++n_slot)
+            {
+                const auto entry_ptr = table_ptr->slots[n_slot].load(std::memory_order_acquire);
+
+                if (entry_ptr != nullptr          &&
+                    entry_ptr != get_tombstone() )
+                {
+                    in_func(entry_ptr->key,
+                            entry_ptr->value);
+                }
+            }
+        }
+
+        uint32_t get_n_entries() const
+        {
+            return m_n_entries.load(std::memory_order_relaxed);
+        }
+
+        /* Adds a new (@param in_key, @param in_value) pair. Returns false and leaves the map intact if the key is already
+         * present.
+         */
+        bool insert(const KeyType&   in_key,
+                    const ValueType& in_value)
+        {
+            bool result = false;
+
+            {
+                std::lock_guard<std::mutex> lock     (m_writer_mutex);
+                const auto                  hash     (HashType()(in_key) );
+                auto                        table_ptr(m_table_ptr.load(std::memory_order_relaxed) );
+
+                if (find_slot(table_ptr,
+                              in_key,
+                              hash,
+                              nullptr) != UINT32_MAX) /* out_opt_entry_ptr_ptr */
+                {
+                    goto end;
+                }
+
+                if ((m_n_used_slots + 1) * 2 > table_ptr->n_slots)
+                {
+                    table_ptr = rehash(table_ptr);
+                }
+
+                {
+                    const uint32_t mask   (table_ptr->n_slots - 1);
+                    uint32_t       n_slot (static_cast<uint32_t>(hash) & mask);
+
+                    while (true)
+                    {
+                        auto slot_entry_ptr = table_ptr->slots[n_slot].load(std::memory_order_relaxed);
+
+                        if (slot_entry_ptr == nullptr)
+                        {
+                            m_n_used_slots++;
+
+                            break;
+                        }
+                        else
+                        if (slot_entry_ptr == get_tombstone() )
+                        {
+                            break;
+                        }
+
+                        n_slot = (n_slot + 1) & mask;
+                    }
+
+                    table_ptr->slots[n_slot].store(new Entry(in_key,
+                                                             in_value,
+                                                             hash),
+                                                   std::memory_order_release);
+                }
+
+                m_n_entries.fetch_add(1,
+                                      std::memory_order_relaxed);
+
+                result = true;
+            }
+
+            VKGL::Epoch::reclaim();
+        end:
+            return result;
+        }
+
+    private:
+        /* Private type definitions */
+        typedef struct Entry
+        {
+            const size_t    hash;
+            const KeyType   key;
+            const ValueType value;
+
+            Entry(const KeyType&   in_key,
+                  const ValueType& in_value,
+                  const size_t&    in_hash)
+                :hash (in_hash),
+                 key  (in_key),
+                 value(in_value)
+            {
+                /* Stub */
+            }
+        } Entry;
+
+        typedef struct Table
+        {
+            const uint32_t                         n_slots;
+            std::unique_ptr<std::atomic<Entry*>[]> slots;
+
+            Table(const uint32_t& in_n_slots)
+                :n_slots(in_n_slots),
+                 slots  (new std::atomic<Entry*>[in_n_slots])
+            {
+                for (uint32_t n_slot = 0;
+                              n_slot < in_n_slots;
+                            ++n_slot)
+                {
+                    slots[n_slot].store(nullptr,
+                                        std::memory_order_relaxed);
+                }
+            }
+        } Table;
+
+        /* Private functions */
+        static void delete_entry(void* in_entry_ptr)
+        {
+            delete reinterpret_cast<Entry*>(in_entry_ptr);
+        }
+
+        static void delete_table(void* in_table_ptr)
+        {
+            delete reinterpret_cast<Table*>(in_table_ptr);
+        }
+
+        /* Returns index of the slot holding @param in_key, or UINT32_MAX if not found. The entry is returned via
+         * @param out_opt_entry_ptr_ptr, as readers must not reload the slot (it may have been reused in the meantime).
+         */
+        static uint32_t find_slot(const Table*   in_table_ptr,
+                                  const KeyType& in_key,
+                                  const size_t&  in_hash,
+                                  Entry**        out_opt_entry_ptr_ptr)
+        {
+            const uint32_t mask  (in_table_ptr->n_slots - 1);
+            uint32_t       n_slot(static_cast<uint32_t>(in_hash) & mask);
+
+            for (uint32_t n_probe = 0;
+                          n_probe < in_table_ptr->n_slots;
+                        ++n_probe)
+            {
+                const auto entry_ptr = in_table_ptr->slots[n_slot].load(std::memory_order_acquire);
+
+                if (entry_ptr == nullptr)
+                {
+                    break;
+                }
+
+                if (entry_ptr       != get_tombstone() &&
+                    entry_ptr->hash == in_hash         &&
+                    entry_ptr->key  == in_key)
+                {
+                    if (out_opt_entry_ptr_ptr != nullptr)
+                    {
+                        *out_opt_entry_ptr_ptr = entry_ptr;
+                    }
+
+                    return n_slot;
+                }
+
+                n_slot = (n_slot + 1) & mask;
+            }
+
+            return UINT32_MAX;
+        }
+
+        /* Entries are never dereferenced through this ptr, so any unique address will do. */
+        static Entry* get_tombstone()
+        {
+            static char tombstone;
+
+            return reinterpret_cast<Entry*>(&tombstone);
+        }
+
+        /* Moves all live entries to a new table, publishes it and retires @param in_table_ptr. Must be called with the writer
+         * mutex held.
+         */
+        Table* rehash(Table* in_table_ptr)
+        {
+            uint32_t n_new_slots = 4;
+
+            while (n_new_slots < (m_n_entries.load(std::memory_order_relaxed) + 1) * 4)
+            {
+                n_new_slots <<= 1;
+            }
+
+            auto           new_table_ptr = new Table(n_new_slots);
+            const uint32_t new_mask      = n_new_slots - 1;
+
+            for (uint32_t n_slot = 0;
+                          n_slot < in_table_ptr->n_slots;
+                        ++n_slot)
+            {
+                auto entry_ptr = in_table_ptr->slots[n_slot].load(std::memory_order_relaxed);
+
+                if (entry_ptr == nullptr          ||
+                    entry_ptr == get_tombstone() )
+                {
+                    continue;
+                }
+
+                uint32_t n_new_slot = static_cast<uint32_t>(entry_ptr->hash) & new_mask;
+
+                while (new_table_ptr->slots[n_new_slot].load(std::memory_order_relaxed) != nullptr)
+                {
+                    n_new_slot = (n_new_slot + 1) & new_mask;
+                }
+
+                new_table_ptr->slots[n_new_slot].store(entry_ptr,
+                                                       std::memory_order_relaxed);
+            }
+
+            m_n_used_slots = m_n_entries.load(std::memory_order_relaxed);
+
+            m_table_ptr.store(new_table_ptr,
+                              std::memory_order_release);
+
+            VKGL::Epoch::retire(in_table_ptr,
+                                delete_table);
+
+            return new_table_ptr;
+        }
+
+        ReadMostlyHashMap           (const ReadMostlyHashMap&);
+        ReadMostlyHashMap& operator=(const ReadMostlyHashMap&);
+
+        /* Private variables */
+        std::atomic<uint32_t> m_n_entries;
+        uint32_t              m_n_used_slots; //< Live entries + tombstones in the current table. Only accessed by writers.
+        std::atomic<Table*>   m_table_ptr;
+        std::mutex            m_writer_mutex;
+    };
+};
+
+#endif /* VKGL_COMMON_READ_MOSTLY_HASH_MAP_H */
@@ -0,0 +1,116 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_COMMON_TRACE_RECORDER_H
+#define VKGL_COMMON_TRACE_RECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/* Timeline recorder producing Chrome trace_event JSON (load the output in chrome://tracing or Perfetto).
+ *
+ * Always compiled in, disabled by default. Enable with VKGL_TRACE=1 in the environment, or at run-time with
+ * VKGL::TraceRecorder::set_enabled(). While enabled:
+ *
+ * - VKGL_TRACE_SCOPE() records a CPU-side duration event on the calling thread's track. Names must be string literals
+ *   (or otherwise outlive the recorder), as only the pointer is stored.
+ * - record_gpu_event() records a duration event on a GPU track, created beforehand with create_gpu_track().
+ *
+ * Events are appended to a fixed-size ring owned by the recording thread, so recording involves no locks. If a ring
+ * fills up before it is drained, new events are dropped and the drop count is reported in the trace.
+ *
+ * Once per frame, OpenGL::Context::present() calls on_frame_presented(), which drains all rings into the file named by
+ * VKGL_TRACE_FILE (vkgl_trace.json by default). The file is streamed out as a JSON array without the closing bracket,
+ * which the trace viewers accept, so a trace of a killed process is still usable.
+ */
+namespace VKGL
+{
+    extern std::atomic<bool> g_trace_recorder_enabled;
+
+    class TraceRecorder
+    {
+    public:
+        /* Public functions */
+
+        /* Returns a new GPU track ID. Tracks are listed under a separate "GPU" process in the trace. Can be called regardless of
+         * whether the recorder is enabled.
+         */
+        static uint32_t create_gpu_track(const std::string& in_name);
+
+        /* Timestamps of all events share this time base. */
+        static uint64_t get_time_us()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch() ).count() );
+        }
+
+        static bool is_enabled()
+        {
+            return g_trace_recorder_enabled.load(std::memory_order_relaxed);
+        }
+
+        /* Drains events recorded since the previous call and writes them out. Called once per frame from the app's rendering
+         * thread.
+         */
+        static void on_frame_presented();
+
+        static void record_cpu_event(const char*     in_name,
+                                     const uint64_t& in_start_time_us,
+                                     const uint64_t& in_end_time_us);
+        static void record_gpu_event(const uint32_t& in_gpu_track_id,
+                                     const char*     in_name,
+                                     const uint64_t& in_start_time_us,
+                                     const uint64_t& in_end_time_us);
+
+        static void set_enabled(const bool& in_enabled);
+
+        /* Names the calling thread's track. Can be called regardless of whether the recorder is enabled. */
+        static void set_thread_name(const std::string& in_name);
+
+    private:
+        /* Private functions */
+        TraceRecorder();
+    };
+
+    class TraceScope
+    {
+    public:
+        /* Public functions */
+        TraceScope(const char* in_name)
+            :m_name         (nullptr),
+             m_start_time_us(0)
+        {
+            if (TraceRecorder::is_enabled() )
+            {
+                m_name          = in_name;
+                m_start_time_us = TraceRecorder::get_time_us();
+            }
+        }
+
+        ~TraceScope()
+        {
+            if (m_name != nullptr)
+            {
+                TraceRecorder::record_cpu_event(m_name,
+                                                m_start_time_us,
+                                                TraceRecorder::get_time_us() );
+            }
+        }
+
+    private:
+        /* Private functions */
+        TraceScope           (const TraceScope&);
+        TraceScope& operator=(const TraceScope&);
+
+        /* Private variables */
+        const char* m_name;
+        uint64_t    m_start_time_us;
+    };
+};
+
+#define VKGL_TRACE_SCOPE(name) \
+    VKGL::TraceScope vkgl_trace_scope(name)
+
+#endif /* VKGL_COMMON_TRACE_RECORDER_H */
@@ -0,0 +1,128 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_VK_BUFFER_MAP_COPY_NODE_H
+#define VKGL_VK_BUFFER_MAP_COPY_NODE_H
+
+#include "OpenGL/backend/vk_backend.h"
+#include "OpenGL/backend/vk_frame_graph_node.h"
+
+namespace OpenGL
+{
+    namespace VKNodes
+    {
+        enum class BufferMapCopyDirection
+        {
+            Backing_To_Buffer, //< glUnmapBuffer(): uploads data written by the app.
+            Buffer_To_Backing, //< glMapBuffer*():  reads back buffer contents for the app.
+        };
+
+        class BufferMapCopy : public OpenGL::IVKFrameGraphNode
+        {
+        public:
+            /* Public functions */
+            static VKFrameGraphNodeUniquePtr create(IBackend*                             in_backend_ptr,
+                                                    const BufferMapCopyDirection&         in_direction,
+                                                    OpenGL::VKBufferReferenceUniquePtr    in_backend_buffer_reference_ptr,
+                                                    OpenGL::VKMapBackingSharedPtr         in_backing_ptr,
+                                                    const std::vector<Anvil::BufferCopy>& in_copy_regions);
+
+            ~BufferMapCopy();
+
+        private:
+            /* IVKFrameGraphNode */
+            void do_cpu_prepass(IVKFrameGraphNodeCallback*) final
+            {
+                /* Should never be called */
+                vkgl_assert_fail();
+            }
+
+            void execute_cpu_side(IVKFrameGraphNodeCallback*) final
+            {
+                /* Should never be called */
+                vkgl_assert_fail();
+            }
+
+            void get_gl_context_state(const OpenGL::ContextState**                    out_context_state_ptr_ptr,
+                                      const OpenGL::GLContextStateBindingReferences** out_context_state_binding_references_ptr_ptr) const final
+            {
+                /* Should never be called */
+                vkgl_assert_fail();
+            }
+
+            const VKFrameGraphNodeInfo* get_info_ptr() const final
+            {
+                return m_info_ptr.get();
+            }
+
+            RenderpassSupportScope get_renderpass_support_scope() const final
+            {
+                /* Buffer->buffer copy ops are NOT supported for renderpass usage. */
+                return OpenGL::RenderpassSupportScope::Not_Supported;
+            }
+
+            void get_supported_queue_families(uint32_t*                          out_n_queue_fams_ptr,
+                                              const Anvil::QueueFamilyFlagBits** out_queue_fams_ptr_ptr) const final;
+
+            FrameGraphNodeType get_type() const final
+            {
+                return FrameGraphNodeType::Buffer_Map_Copy;
+            }
+
+            void record_commands(Anvil::CommandBufferBase*  in_cmd_buffer_ptr,
+                                 const bool&                in_inside_renderpass,
+                                 IVKFrameGraphNodeCallback* in_graph_callback_ptr) const final;
+
+            bool requires_cpu_side_execution() const final
+            {
+                /* None needed */
+                return false;
+            }
+
+            bool requires_cpu_prepass() const final
+            {
+                /* Map backings are allocated & mapped by the buffer manager, so there's nothing to prepare. */
+                return false;
+            }
+
+            bool requires_gpu_side_execution() const final
+            {
+                return true;
+            }
+
+            bool requires_manual_wait_sem_sync() const final
+            {
+                return false;
+            }
+
+            bool supports_primary_command_buffers() const final
+            {
+                return true;
+            }
+
+            bool supports_secondary_command_buffers() const final
+            {
+                return true;
+            }
+
+            /* Private functions */
+
+            BufferMapCopy(IBackend*                             in_backend_ptr,
+                          const BufferMapCopyDirection&         in_direction,
+                          OpenGL::VKBufferReferenceUniquePtr    in_backend_buffer_reference_ptr,
+                          OpenGL::VKMapBackingSharedPtr         in_backing_ptr,
+                          const std::vector<Anvil::BufferCopy>& in_copy_regions);
+
+            /* Private variables */
+            IBackend*                          m_backend_ptr;
+            OpenGL::VKBufferReferenceUniquePtr m_backend_buffer_reference_ptr;
+            OpenGL::VKMapBackingSharedPtr      m_backing_ptr;
+            std::vector<Anvil::BufferCopy>     m_copy_regions;
+            BufferMapCopyDirection             m_direction;
+            VKFrameGraphNodeInfoUniquePtr      m_info_ptr;
+        };
+    };
+};
+
+#endif /* VKGL_VK_BUFFER_MAP_COPY_NODE_H */
@@ -112,7 +112,7 @@ namespace OpenGL
             VKFrameGraphNodeInfoUniquePtr      m_info_ptr;
             OpenGL::DataUniquePtr              m_data_ptr;
             const IContextObjectManagers*      m_frontend_ptr;
-            Anvil::BufferUniquePtr             m_staging_buffer_ptr;
+            OpenGL::VKMapBackingSharedPtr      m_staging_backing_ptr;
             uint64_t							m_start_offset;
             uint64_t							m_sub_size;
         };
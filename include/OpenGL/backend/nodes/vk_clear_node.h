@@ -40,8 +40,11 @@ namespace OpenGL
             void get_gl_context_state(const OpenGL::ContextState**                    out_context_state_ptr_ptr,
                                       const OpenGL::GLContextStateBindingReferences** out_context_state_binding_references_ptr_ptr) const final
             {
-                /* Should never be called */
-                vkgl_assert_fail();
+                vkgl_assert(m_frontend_context_state_ptr != nullptr);
+
+                /* Clears do not depend on any bindings. */
+                *out_context_state_binding_references_ptr_ptr = nullptr;
+                *out_context_state_ptr_ptr                    = m_frontend_context_state_ptr;
             }
 
             const VKFrameGraphNodeInfo* get_info_ptr() const final
@@ -51,8 +54,11 @@ namespace OpenGL
 
             RenderpassSupportScope get_renderpass_support_scope() const final
             {
-                /* TODO: We do not support leaking clear ops into renderpasses YET. Yes, this is suboptimal. */
-                return RenderpassSupportScope::Not_Supported;
+                /* Default FB clears are recorded inside renderpasses, so that they can be folded into load ops or merged with
+                 * the draw calls that follow. FBO clears still go through transfer ops.
+                 */
+                return (m_uses_renderpass) ? RenderpassSupportScope::Required
+                                           : RenderpassSupportScope::Not_Supported;
             }
 
             void get_supported_queue_families(uint32_t*                          out_n_queue_fams_ptr,
@@ -104,13 +110,17 @@ namespace OpenGL
                   OpenGL::GLContextStateReferenceUniquePtr in_context_state_ptr,
                   const OpenGL::ClearBufferBits&           in_buffers_to_clear);
 
-            void init_info();
+            void init_info                        ();
+            void record_commands_inside_renderpass(Anvil::CommandBufferBase*  in_cmd_buffer_ptr,
+                                                   IVKFrameGraphNodeCallback* in_graph_callback_ptr) const;
 
             /* Private variables */
             IBackend*                                m_backend_ptr;
             OpenGL::GLContextStateReferenceUniquePtr m_context_state_ptr;
+            const OpenGL::ContextState*              m_frontend_context_state_ptr;
             const IContextObjectManagers*            m_frontend_ptr;
             OpenGL::VKFrameGraphNodeInfoUniquePtr    m_info_ptr;
+            bool                                     m_uses_renderpass;
 
             const OpenGL::ClearBufferBits& m_buffers_to_clear;
 
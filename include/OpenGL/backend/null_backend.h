@@ -0,0 +1,419 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_NULL_BACKEND_H
+#define VKGL_NULL_BACKEND_H
+
+#include "OpenGL/types.h"
+#include <unordered_map>
+#include <vector>
+
+/* Backend which implements the interfaces OpenGL::Context talks to, without ever touching Vulkan.
+ *
+ * Every callback returns immediately, after bumping a per-callback counter and (if requested at creation time) appending
+ * the callback's ID to a call log. This makes it possible to measure & inspect the frontend's own overhead on machines
+ * without a GPU.
+ *
+ * Capabilities report the GL 3.2 minimum maximums. Buffer storage is emulated with host memory so that maps & reads
+ * return valid pointers; its contents are not kept up to date by buffer_data() or buffer_sub_data(). Flushes signal the
+ * fence they are given straight away.
+ *
+ * There is no SPIR-V manager, so compiling shaders, linking programs or querying their status is not supported. This
+ * includes draw calls issued through the compatibility (FPE) entry points, which set up an FPE program on first use.
+ *
+ * Counters are not atomic. The backend is meant to be driven by a single thread.
+ */
+namespace OpenGL
+{
+    class NullBackend;
+
+    typedef std::unique_ptr<NullBackend> NullBackendUniquePtr;
+
+    enum class NullBackendCallback
+    {
+        On_Objects_Created,
+        On_Objects_Destroyed,
+        Buffer_Data,
+        Buffer_Sub_Data,
+        Copy_Buffer_Sub_Data,
+        Flush_Mapped_Buffer_Range,
+        Get_Buffer_Sub_Data,
+        Map_Buffer,
+        Unmap_Buffer,
+        Compile_Shader,
+        Link_Program,
+        Validate_Program,
+        Draw_Arrays,
+        Draw_Elements,
+        Draw_Range_Elements,
+        Multi_Draw_Arrays,
+        Multi_Draw_Elements,
+        Finish,
+        Flush,
+        Clear,
+        Get_Compressed_Tex_Image,
+        Get_Texture_Image,
+        Read_Pixels,
+        Renderbuffer_Storage,
+        Copy_Tex_Image_1D,
+        Copy_Tex_Image_2D,
+        Copy_Tex_Sub_Image_1D,
+        Copy_Tex_Sub_Image_2D,
+        Copy_Tex_Sub_Image_3D,
+        Compressed_Tex_Image_1D,
+        Compressed_Tex_Image_2D,
+        Compressed_Tex_Image_3D,
+        Compressed_Tex_Sub_Image_1D,
+        Compressed_Tex_Sub_Image_2D,
+        Compressed_Tex_Sub_Image_3D,
+        Tex_Image_1D,
+        Tex_Image_2D,
+        Tex_Image_3D,
+        Tex_Sub_Image_1D,
+        Tex_Sub_Image_2D,
+        Tex_Sub_Image_3D,
+        Generate_Mipmap,
+        Update_Uniform_Data,
+        Present,
+        Count
+    };
+
+    class NullBackend : public IBackend,
+                        public IBackendCapabilities,
+                        public IBackendGLCallbacks
+    {
+    public:
+        /* Public functions */
+
+        static NullBackendUniquePtr create(const bool& in_record_calls);
+
+        ~NullBackend();
+
+        const uint64_t& get_n_calls(const NullBackendCallback& in_callback) const
+        {
+            return m_n_calls[static_cast<uint32_t>(in_callback)];
+        }
+
+        /* Only filled if the backend was created with in_record_calls set to true. */
+        const std::vector<NullBackendCallback>& get_recorded_calls() const
+        {
+            return m_recorded_calls;
+        }
+
+        uint64_t get_total_n_calls() const;
+        void     reset_counters   ();
+
+        static const char* get_callback_name(const NullBackendCallback& in_callback);
+
+        /* IBackend functions */
+        VKBufferManager*        get_buffer_manager_ptr      () const final { return nullptr; }
+        Anvil::BaseDevice*      get_device_ptr              () const final { return nullptr; }
+        VKFormatManager*        get_format_manager_ptr      () const final { return nullptr; }
+        VKFrameGraph*           get_frame_graph_ptr         () const final { return nullptr; }
+        VKFramebufferManager*   get_framebuffer_manager_ptr () const final { return nullptr; }
+        VKGFXPipelineManager*   get_gfx_pipeline_manager_ptr() const final { return nullptr; }
+        Anvil::MemoryAllocator* get_memory_allocator_ptr    () const final { return nullptr; }
+        VKRenderpassManager*    get_renderpass_manager_ptr  () const final { return nullptr; }
+        VKSPIRVManager*         get_spirv_manager_ptr       () const final { return nullptr; }
+        VKSwapchainManager*     get_swapchain_manager_ptr   () const final { return nullptr; }
+        VKSyncObjectPool*       get_sync_object_pool_ptr    () const final { return nullptr; }
+        VKImageManager*         get_image_manager_ptr       () const final { return nullptr; }
+        ThreadPool*             get_thread_pool_ptr         () const final { return nullptr; }
+
+        /* IBackendCapabilities functions */
+
+        void get_capability(const OpenGL::BackendCapability&  in_capability,
+                            const OpenGL::GetSetArgumentType& in_arg_type,
+                            const uint32_t&                   in_n_vals,
+                            void*                             out_result_ptr) const final;
+
+        /* IBackendGLCallbacks functions */
+
+        void on_objects_created  (const OpenGL::ObjectType& in_object_type,
+                                  const uint32_t&           in_n_ids,
+                                  const GLuint*             in_ids_ptr) final;
+        void on_objects_destroyed(const OpenGL::ObjectType& in_object_type,
+                                  const uint32_t&           in_n_ids,
+                                  const GLuint*             in_ids_ptr) final;
+
+        void  buffer_data              (const GLuint&                in_id,
+                                        const GLsizeiptr&            in_size,
+                                        const void*                  in_data_ptr) final;
+        void  buffer_sub_data          (const GLuint&                in_id,
+                                        const GLsizeiptr&            in_start_offset,
+                                        const GLsizeiptr&            in_size,
+                                        const void*                  in_data_ptr) final;
+        void  copy_buffer_sub_data     (const GLuint&                in_read_buffer_id,
+                                        const GLuint&                in_write_buffer_id,
+                                        const GLintptr&              in_read_offset,
+                                        const GLintptr&              in_write_offset,
+                                        const GLsizeiptr&            in_size) final;
+        void  flush_mapped_buffer_range(const GLuint&                in_id,
+                                        const GLintptr&              in_offset,
+                                        const GLsizeiptr&            in_length) final;
+        void  get_buffer_sub_data      (const GLuint&                in_id,
+                                        const GLintptr&              in_offset,
+                                        const GLsizeiptr&            in_size,
+                                        void*                        out_data_ptr) final;
+        void* map_buffer               (const GLuint&                in_id,
+                                        const OpenGL::BufferMapBits& in_map_bits,
+                                        const GLintptr&              in_start_offset,
+                                        const GLsizeiptr&            in_length) final;
+        bool  unmap_buffer             (const GLuint&                in_id)     final;
+
+        void compile_shader  (const GLuint& in_id)         final;
+        void link_program    (const GLuint& in_program_id) final;
+        void validate_program(const GLuint& in_program_id) final;
+
+        void draw_arrays        (const OpenGL::DrawCallMode&      in_mode,
+                                 const GLint&                     in_first,
+                                 const GLsizei&                   in_count) final;
+        void draw_elements      (const OpenGL::DrawCallMode&      in_mode,
+                                 const GLsizei&                   in_count,
+                                 const OpenGL::DrawCallIndexType& in_type,
+                                 const void*                      in_indices) final;
+        void draw_range_elements(const OpenGL::DrawCallMode&      in_mode,
+                                 const GLuint&                    in_start,
+                                 const GLuint&                    in_end,
+                                 const GLsizei&                   in_count,
+                                 const OpenGL::DrawCallIndexType& in_type,
+                                 const void*                      in_indices) final;
+        void multi_draw_arrays  (const OpenGL::DrawCallMode&      in_mode,
+                                 const GLint*                     in_first_ptr,
+                                 const GLsizei*                   in_count_ptr,
+                                 const GLsizei&                   in_drawcount) final;
+        void multi_draw_elements(const OpenGL::DrawCallMode&      in_mode,
+                                 const GLsizei*                   in_count_ptr,
+                                 const OpenGL::DrawCallIndexType& in_type,
+                                 const void* const*               in_indices_ptr,
+                                 const GLsizei&                   in_drawcount) final;
+
+        void finish()                              final;
+        void flush (VKGL::Fence* in_opt_fence_ptr) final;
+
+        void clear                   (const OpenGL::ClearBufferBits& in_buffers_to_clear) final;
+        void get_compressed_tex_image(const GLuint&                  in_id,
+                                      const GLint&                   in_level,
+                                      void*                          in_img) final;
+        void get_texture_image       (const GLuint&                  in_id,
+                                      const uint32_t&                in_level,
+                                      const OpenGL::PixelFormat&     in_format,
+                                      const OpenGL::PixelType&       in_type,
+                                      void*                          out_pixels_ptr) final;
+        void read_pixels             (const int32_t&                 in_x,
+                                      const int32_t&                 in_y,
+                                      const size_t&                  in_width,
+                                      const size_t&                  in_height,
+                                      const OpenGL::PixelFormat&     in_format,
+                                      const OpenGL::PixelType&       in_type,
+                                      void*                          out_pixels_ptr) final;
+
+        void renderbuffer_storage(const GLuint&                 in_id,
+                                  const OpenGL::InternalFormat& in_internalformat,
+                                  const uint32_t&               in_width,
+                                  const uint32_t&               in_height,
+                                  const uint32_t&               in_samples) final;
+
+        void copy_tex_image_1d(const GLuint&                 in_id,
+                               const GLint                   in_level,
+                               const OpenGL::InternalFormat& in_internalformat,
+                               const GLint&                  in_x,
+                               const GLint&                  in_y,
+                               const GLsizei&                in_width,
+                               const GLint&                  in_border) final;
+        void copy_tex_image_2d(const GLuint&                 in_id,
+                               const GLint&                  in_level,
+                               const OpenGL::InternalFormat& in_internalformat,
+                               const GLint&                  in_x,
+                               const GLint&                  in_y,
+                               const GLsizei&                in_width,
+                               const GLsizei&                in_height,
+                               const GLint&                  in_border) final;
+
+        void copy_tex_sub_image_1d(const GLuint&  in_id,
+                                   const GLint&   in_level,
+                                   const GLint&   in_xoffset,
+                                   const GLint&   in_x,
+                                   const GLint&   in_y,
+                                   const GLsizei& in_width) final;
+        void copy_tex_sub_image_2d(const GLuint&  in_id,
+                                   const GLint&   in_level,
+                                   const GLint&   in_xoffset,
+                                   const GLint&   in_yoffset,
+                                   const GLint&   in_x,
+                                   const GLint&   in_y,
+                                   const GLsizei& in_width,
+                                   const GLsizei& in_height) final;
+        void copy_tex_sub_image_3d(const GLuint&  in_id,
+                                   const GLint&   in_level,
+                                   const GLint&   in_xoffset,
+                                   const GLint&   in_yoffset,
+                                   const GLint&   in_zoffset,
+                                   const GLint&   in_x,
+                                   const GLint&   in_y,
+                                   const GLsizei& in_width,
+                                   const GLsizei& in_height) final;
+
+        void compressed_tex_image_1d(const GLuint&                  in_id,
+                                     const GLint&                   in_level,
+                                     const OpenGL::InternalFormat&  in_internalformat,
+                                     const GLsizei                  in_width,
+                                     const GLint                    in_border,
+                                     const GLsizei                  in_image_size,
+                                     const void*                    in_data) final;
+        void compressed_tex_image_2d(const GLuint&                  in_id,
+                                     const GLint&                   in_level,
+                                     const OpenGL::InternalFormat&  in_internalformat,
+                                     const GLsizei&                 in_width,
+                                     const GLsizei&                 in_height,
+                                     const GLint&                   in_border,
+                                     const GLsizei&                 in_image_size,
+                                     const void*                    in_data) final;
+        void compressed_tex_image_3d(const GLuint&                  in_id,
+                                     const GLint&                   in_level,
+                                     const OpenGL::InternalFormat&  in_internalformat,
+                                     const GLsizei&                 in_width,
+                                     const GLsizei&                 in_height,
+                                     const GLsizei&                 in_depth,
+                                     const GLint&                   in_border,
+                                     const GLsizei&                 in_image_size,
+                                     const void*                    in_data) final;
+
+        void compressed_tex_sub_image_1d(const GLuint&                in_id,
+                                         const GLint&                 in_level,
+                                         const GLint&                 in_xoffset,
+                                         const GLsizei&               in_width,
+                                         const OpenGL::PixelFormat&   in_format,
+                                         const GLsizei&               in_image_size,
+                                         const void*                  in_data) final;
+        void compressed_tex_sub_image_2d(const GLuint&                in_id,
+                                         const GLint&                 in_level,
+                                         const GLint&                 in_xoffset,
+                                         const GLint&                 in_yoffset,
+                                         const GLsizei&               in_width,
+                                         const GLsizei&               in_height,
+                                         const OpenGL::PixelFormat&   in_format,
+                                         const GLsizei&               in_image_size,
+                                         const void*                  in_data) final;
+        void compressed_tex_sub_image_3d(const GLuint&                in_id,
+                                         const GLint&                 in_level,
+                                         const GLint&                 in_xoffset,
+                                         const GLint&                 in_yoffset,
+                                         const GLint&                 in_zoffset,
+                                         const GLsizei&               in_width,
+                                         const GLsizei&               in_height,
+                                         const GLsizei&               in_depth,
+                                         const OpenGL::PixelFormat&   in_format,
+                                         const GLsizei&               in_image_size,
+                                         const void*                  in_data) final;
+
+        void tex_image_1d(const GLuint&                 in_id,
+                          const int32_t&                in_level,
+                          const OpenGL::InternalFormat& in_internalformat,
+                          const int32_t&                in_width,
+                          const int32_t&                in_border,
+                          const OpenGL::PixelFormat&    in_format,
+                          const OpenGL::PixelType&      in_type,
+                          const void*                   in_pixels_ptr) final;
+        void tex_image_2d(const GLuint&                 in_id,
+                          const GLint&                  in_level,
+                          const OpenGL::InternalFormat& in_internalformat,
+                          const GLsizei&                in_width,
+                          const GLsizei&                in_height,
+                          const GLint&                  in_border,
+                          const OpenGL::PixelFormat&    in_format,
+                          const OpenGL::PixelType&      in_type,
+                          const void*                   in_pixels_ptr) final;
+        void tex_image_3d(const GLuint&                 in_id,
+                          const GLint&                  in_level,
+                          const OpenGL::InternalFormat& in_internalformat,
+                          const GLsizei&                in_width,
+                          const GLsizei&                in_height,
+                          const GLsizei&                in_depth,
+                          const GLint&                  in_border,
+                          const OpenGL::PixelFormat&    in_format,
+                          const OpenGL::PixelType&      in_type,
+                          const void*                   in_pixels_ptr) final;
+
+        void tex_sub_image_1d(const GLuint&              in_id,
+                              const GLint&               in_level,
+                              const GLint&               in_xoffset,
+                              const GLsizei&             in_width,
+                              const OpenGL::PixelFormat& in_format,
+                              const OpenGL::PixelType&   in_type,
+                              const void*                in_pixels) final;
+        void tex_sub_image_2d(const GLuint&              in_id,
+                              const GLint&               in_level,
+                              const GLint&               in_xoffset,
+                              const GLint&               in_yoffset,
+                              const GLsizei&             in_width,
+                              const GLsizei&             in_height,
+                              const OpenGL::PixelFormat& in_format,
+                              const OpenGL::PixelType&   in_type,
+                              const void*                in_pixels) final;
+        void tex_sub_image_3d(const GLuint&              in_id,
+                              const GLint&               in_level,
+                              const GLint&               in_xoffset,
+                              const GLint&               in_yoffset,
+                              const GLint&               in_zoffset,
+                              const GLsizei&             in_width,
+                              const GLsizei&             in_height,
+                              const GLsizei&             in_depth,
+                              const OpenGL::PixelFormat& in_format,
+                              const OpenGL::PixelType&   in_type,
+                              const void*                in_pixels) final;
+
+        void generate_mipmap(const GLuint& in_id) final;
+
+        void update_uniform_data(const GLuint&  in_id,
+                                 const GLint&   in_location,
+                                 const GLsizei& in_count,
+                                 const void*    in_data_ptr) final;
+
+        void present() final;
+
+    private:
+        /* Private type definitions */
+        typedef struct CapabilityData
+        {
+            union
+            {
+                float    f32[2];
+                uint32_t u32[2];
+                uint64_t u64[2];
+            } data;
+
+            OpenGL::GetSetArgumentType data_type;
+            uint32_t                   n_vals;
+        } CapabilityData;
+
+        /* Private functions */
+
+        NullBackend(const bool& in_record_calls);
+
+        NullBackend           (const NullBackend&);
+        NullBackend& operator=(const NullBackend&);
+
+        void init_capabilities();
+
+        void on_callback(const NullBackendCallback& in_callback)
+        {
+            m_n_calls[static_cast<uint32_t>(in_callback)]++;
+
+            if (m_record_calls)
+            {
+                m_recorded_calls.push_back(in_callback);
+            }
+        }
+
+        /* Private variables */
+
+        std::unordered_map<GLuint, std::vector<uint8_t> >             m_buffer_storage;
+        std::unordered_map<OpenGL::BackendCapability, CapabilityData> m_capabilities;
+        uint64_t                                                      m_n_calls[static_cast<uint32_t>(NullBackendCallback::Count)];
+        std::vector<NullBackendCallback>                              m_recorded_calls;
+        const bool                                                    m_record_calls;
+    };
+};
+#endif /* VKGL_NULL_BACKEND_H */
@@ -7,6 +7,8 @@
 
 #include "enkiTS/src/TaskScheduler_c.h"
 #include "OpenGL/types.h"
+#include <deque>
+#include <mutex>
 
 namespace OpenGL
 {
@@ -18,6 +20,16 @@ namespace OpenGL
 
         ~ThreadPool();
 
+        uint32_t get_max_n_running_tasks() const;
+
+        /* Limits the number of tasks executing at the same time (glMaxShaderCompilerThreadsKHR). Tasks submitted past
+         * the limit are queued, and handed to the workers in submission order as running tasks finish.
+         *
+         * The value is clamped to [1, number of worker threads]. Tasks may block on tasks submitted before them (eg. link
+         * tasks wait for compile tasks), so every task handed to enkiTS must be guaranteed a worker of its own.
+         */
+        void set_max_n_running_tasks(const uint32_t& in_max_n_running_tasks);
+
         void submit_task(std::function<void()> in_callback);
 
     private:
@@ -63,7 +75,8 @@ namespace OpenGL
         class Task
         {
         public:
-            Task(std::function<void()> in_callback_func,
+            Task(ThreadPool*           in_thread_pool_ptr,
+                 std::function<void()> in_callback_func,
                  EnkiTaskSetUniquePtr  in_enki_task_set_ptr);
 
             EnkiTaskSet* get_enki_task_set_ptr()
@@ -79,15 +92,23 @@ namespace OpenGL
         private:
             std::function<void()> m_callback_func;
             EnkiTaskSetUniquePtr  m_enki_task_set_ptr;
+            ThreadPool*           m_thread_pool_ptr;
         };
 
         /* Private functions */
         ThreadPool();
 
-        bool init();
+        void dispatch_pending_tasks();
+        bool init                  ();
+        void on_task_finished      ();
 
         /* Private variables */
-        enkiTaskScheduler* m_task_scheduler_ptr;
+        uint32_t                           m_max_n_running_tasks;
+        mutable std::mutex                 m_mutex;              //< Guards the pending task queue & the counters.
+        uint32_t                           m_n_running_tasks;
+        uint32_t                           m_n_worker_threads;
+        std::deque<std::function<void()> > m_pending_tasks;
+        enkiTaskScheduler*                 m_task_scheduler_ptr;
     };
 }
 #endif /* VKGL_VK_THREAD_POOL_H */
@@ -12,6 +12,7 @@
 #include "OpenGL/backend/vk_format_manager.h"
 #include "OpenGL/backend/vk_frame_graph.h"
 #include "OpenGL/backend/vk_swapchain_manager.h"
+#include "OpenGL/backend/vk_sync_object_pool.h"
 #include "OpenGL/backend/vk_image_manager.h"
 #include "OpenGL/types.h"
 
@@ -173,6 +174,13 @@ namespace OpenGL
 
             return m_swapchain_manager_ptr.get();
         }
+
+        VKSyncObjectPool* get_sync_object_pool_ptr() const final
+        {
+            vkgl_assert(m_sync_object_pool_ptr != nullptr);
+
+            return m_sync_object_pool_ptr.get();
+        }
         
         VKImageManager* get_image_manager_ptr() const final
         {
@@ -204,30 +212,30 @@ namespace OpenGL
                                   const uint32_t&           in_n_ids,
                                   const GLuint*             in_ids_ptr) final;
 
-        void  buffer_data              (const GLuint&               in_id,
-                                        const GLsizeiptr&           in_size,
-                                        const void*                 in_data_ptr) final;
-        void  buffer_sub_data          (const GLuint&               in_id,
-                                        const GLsizeiptr&           in_start_offset,
-                                        const GLsizeiptr&           in_size,
-                                        const void*                 in_data_ptr) final;
-        void  copy_buffer_sub_data     (const GLuint&               in_read_buffer_id,
-                                        const GLuint&               in_write_buffer_id,
-                                        const GLintptr&             in_read_offset,
-                                        const GLintptr&             in_write_offset,
-                                        const GLsizeiptr&           in_size) final;
-        void  flush_mapped_buffer_range(const GLuint&               in_id,
-                                        const GLintptr&             in_offset,
-                                        const GLsizeiptr&           in_length) final;
-        void  get_buffer_sub_data      (const GLuint&               in_id,
-                                        const GLintptr&             in_offset,
-                                        const GLsizeiptr&           in_size,
-                                        void*                       out_data_ptr) final;
-        void* map_buffer               (const GLuint&               in_id,
-                                        const OpenGL::BufferAccess& in_access,
-                                        const GLintptr&             in_start_offset,
-                                        const GLsizeiptr&           in_length) final;
-        bool  unmap_buffer             (const GLuint&               in_id)     final;
+        void  buffer_data              (const GLuint&                in_id,
+                                        const GLsizeiptr&            in_size,
+                                        const void*                  in_data_ptr) final;
+        void  buffer_sub_data          (const GLuint&                in_id,
+                                        const GLsizeiptr&            in_start_offset,
+                                        const GLsizeiptr&            in_size,
+                                        const void*                  in_data_ptr) final;
+        void  copy_buffer_sub_data     (const GLuint&                in_read_buffer_id,
+                                        const GLuint&                in_write_buffer_id,
+                                        const GLintptr&              in_read_offset,
+                                        const GLintptr&              in_write_offset,
+                                        const GLsizeiptr&            in_size) final;
+        void  flush_mapped_buffer_range(const GLuint&                in_id,
+                                        const GLintptr&              in_offset,
+                                        const GLsizeiptr&            in_length) final;
+        void  get_buffer_sub_data      (const GLuint&                in_id,
+                                        const GLintptr&              in_offset,
+                                        const GLsizeiptr&            in_size,
+                                        void*                        out_data_ptr) final;
+        void* map_buffer               (const GLuint&                in_id,
+                                        const OpenGL::BufferMapBits& in_map_bits,
+                                        const GLintptr&              in_start_offset,
+                                        const GLsizeiptr&            in_length) final;
+        bool  unmap_buffer             (const GLuint&                in_id)     final;
 
         void compile_shader  (const GLuint& in_id)         final;
         void link_program    (const GLuint& in_program_id) final;
@@ -447,8 +455,6 @@ namespace OpenGL
         bool init             ();
         bool init_anvil       ();
         bool init_capabilities();
-        
-        bool update_texture_reference_for_uniform_resources(const OpenGL::SPIRVBlobID& in_spirv_id);
 
         VkBool32 on_debug_callback_received(Anvil::DebugMessageSeverityFlags in_severity,
                                             const char*                      in_message_ptr) const;
@@ -469,6 +475,7 @@ namespace OpenGL
         OpenGL::VKSchedulerUniquePtr                                  m_scheduler_ptr;
         OpenGL::VKSPIRVManagerUniquePtr                               m_spirv_manager_ptr;
         OpenGL::VKSwapchainManagerUniquePtr                           m_swapchain_manager_ptr;
+        OpenGL::VKSyncObjectPoolUniquePtr                             m_sync_object_pool_ptr;
         OpenGL::VKImageManagerUniquePtr                           m_image_manager_ptr;
         OpenGL::ThreadPoolUniquePtr                                   m_thread_pool_ptr;
         const VKGL::IWSIContext*                                      m_wsi_context_ptr;
@@ -8,9 +8,58 @@
 #include "Anvil/include/misc/types.h"
 #include "OpenGL/backend/vk_reference.h"
 #include "OpenGL/types.h"
+#include <atomic>
+#include <tuple>
 
 namespace OpenGL
 {
+    /* Host-visible, persistently mapped shadow of a GL buffer's storage.
+     *
+     * Pointers returned by glMapBuffer*() point into one of these. Contents are moved between the backing and the actual
+     * VK buffer by BufferMapCopy nodes, so neither map nor unmap needs to stall the app unless a GPU->CPU readback is needed.
+     *
+     * Buffer upload nodes also use these as staging memory, so that they can be recycled the same way.
+     */
+    typedef struct VKMapBacking
+    {
+        Anvil::BufferUniquePtr buffer_ptr;
+        void*                  mapped_ptr;
+        VkDeviceSize           size;
+
+        VKMapBacking(Anvil::BufferUniquePtr in_buffer_ptr,
+                     void*                  in_mapped_ptr,
+                     const VkDeviceSize&    in_size)
+            :buffer_ptr(std::move(in_buffer_ptr) ),
+             mapped_ptr(in_mapped_ptr),
+             size      (in_size)
+        {
+            /* Stub */
+        }
+
+        ~VKMapBacking();
+    } VKMapBacking;
+    typedef std::unique_ptr<VKMapBacking> VKMapBackingUniquePtr;
+
+    typedef struct VKBufferAllocationStats
+    {
+        uint32_t n_buffers_created;         //< vkCreateBuffer() calls.
+        uint32_t n_buffers_recycled;        //< Buffer requests served from the recycling pool.
+        uint32_t n_memory_blocks_allocated; //< Memory allocations made for GL buffers, map backings & staging.
+        uint32_t n_pooled_buffers;          //< Buffers waiting for reuse in the recycling pool.
+        uint32_t n_slab_suballocations;     //< Buffer requests served by carving a region out of a slab.
+        uint32_t n_slabs;                   //< Slabs currently alive.
+
+        VKBufferAllocationStats()
+        {
+            n_buffers_created         = 0;
+            n_buffers_recycled        = 0;
+            n_memory_blocks_allocated = 0;
+            n_pooled_buffers          = 0;
+            n_slab_suballocations     = 0;
+            n_slabs                   = 0;
+        }
+    } VKBufferAllocationStats;
+
     typedef std::unique_ptr<VKBufferManager> VKBufferManagerUniquePtr;
 
     class VKBufferManager : public IVKBufferManager
@@ -34,18 +83,106 @@ namespace OpenGL
         OpenGL::TimeMarker get_tot_buffer_time_marker(const GLuint&             in_id,
                                                       const OpenGL::TimeMarker& in_frontend_object_creation_time) const;
 
+        /* Returns a host-visible backing which can hold at least @param in_size bytes. The backing returns to the pool
+         * when the last shared pointer referring to it is released.
+         */
+        OpenGL::VKMapBackingSharedPtr acquire_map_backing(const VkDeviceSize& in_size);
+
+        /* Allocation statistics.
+         *
+         * on_memory_block_allocated() should be called whenever memory is allocated for a buffer handed out by the manager.
+         * pop_frame_stats() returns counters accumulated since the previous call and resets them. Meant to be called once per frame.
+         */
+        void                            on_memory_block_allocated();
+        OpenGL::VKBufferAllocationStats pop_frame_stats          ();
+
+        /* Map state tracking. All of the functions below are meant to be called from the app's rendering thread.
+         *
+         * map_buffer() returns a pointer to the persistent map backing assigned to the buffer. If the backing's contents
+         * are stale, *out_backing_to_download_to_ptr is set to the backing and the caller must fill it with the buffer's
+         * contents (and wait for that to finish) before the pointer is handed over to the app.
+         *
+         * unmap_buffer() returns the backing, as well as the regions that need to be copied over to the VK buffer. The region
+         * vector is left empty if nothing has been written to the backing.
+         */
+        void  flush_mapped_buffer_range(const GLuint&                   in_id,
+                                        const OpenGL::TimeMarker&       in_frontend_object_creation_time,
+                                        const VkDeviceSize&             in_offset,
+                                        const VkDeviceSize&             in_length);
+        void  invalidate_map_backing   (const GLuint&                   in_id,
+                                        const OpenGL::TimeMarker&       in_frontend_object_creation_time);
+        void* map_buffer               (const GLuint&                   in_id,
+                                        const OpenGL::TimeMarker&       in_frontend_object_creation_time,
+                                        const VkDeviceSize&             in_buffer_size,
+                                        const OpenGL::BufferMapBits&    in_map_bits,
+                                        const VkDeviceSize&             in_start_offset,
+                                        const VkDeviceSize&             in_length,
+                                        OpenGL::VKMapBackingSharedPtr*  out_backing_to_download_to_ptr);
+        bool  unmap_buffer             (const GLuint&                   in_id,
+                                        const OpenGL::TimeMarker&       in_frontend_object_creation_time,
+                                        OpenGL::VKMapBackingSharedPtr*  out_backing_ptr,
+                                        std::vector<Anvil::BufferCopy>* out_copy_regions_ptr);
+
     private:
         /* Private type definitions */
+
+        /* Small GL buffers do not get a VK buffer of their own. Instead, they are sub-allocated out of large VK buffers
+         * ("slabs") which are shared by all GL buffers of the same usage class, ie. (usage flags, memory features).
+         */
+        typedef std::pair<Anvil::BufferUsageFlags, Anvil::MemoryFeatureFlags> SlabKey;
+
+        typedef struct Slab
+        {
+            Anvil::BufferUniquePtr               buffer_ptr;
+            std::map<VkDeviceSize, VkDeviceSize> free_ranges;   //< start offset -> size. Adjacent ranges are always merged.
+            SlabKey                              key;
+            uint32_t                             n_allocations;
+
+            Slab(Anvil::BufferUniquePtr in_buffer_ptr,
+                 const SlabKey&         in_key,
+                 const VkDeviceSize&    in_size)
+                :buffer_ptr   (std::move(in_buffer_ptr) ),
+                 key          (in_key),
+                 n_allocations(0)
+            {
+                free_ranges[0] = in_size;
+            }
+        } Slab;
+        typedef std::unique_ptr<Slab> SlabUniquePtr;
+
         typedef struct BufferProps
         {
-            Anvil::BufferUniquePtr                  buffer_ptr;
+            Anvil::BufferUniquePtr                  buffer_ptr;     //< Only set for buffers which own a VK buffer.
+            Slab*                                   slab_ptr;       //< Only set for sub-allocated buffers.
+            VkDeviceSize                            offset;         //< Start of the region within the VK buffer.
+            VkDeviceSize                            size;           //< Size of the region.
             std::vector<OpenGL::VKBufferReference*> reference_ptrs;
 
-            BufferProps(Anvil::BufferUniquePtr in_buffer_ptr)
-                :buffer_ptr(std::move(in_buffer_ptr) )
+            BufferProps(Anvil::BufferUniquePtr in_buffer_ptr,
+                        const VkDeviceSize&    in_size)
+                :buffer_ptr(std::move(in_buffer_ptr) ),
+                 offset    (0),
+                 size      (in_size),
+                 slab_ptr  (nullptr)
+            {
+                /* Stub */
+            }
+
+            BufferProps(Slab*               in_slab_ptr,
+                        const VkDeviceSize& in_offset,
+                        const VkDeviceSize& in_size)
+                :offset  (in_offset),
+                 size    (in_size),
+                 slab_ptr(in_slab_ptr)
             {
                 /* Stub */
             }
+
+            Anvil::Buffer* get_buffer_ptr() const
+            {
+                return (slab_ptr != nullptr) ? slab_ptr->buffer_ptr.get()
+                                             : buffer_ptr.get      ();
+            }
         } BufferProps;
         typedef std::unique_ptr<BufferProps> BufferPropsUniquePtr;
 
@@ -61,25 +198,58 @@ namespace OpenGL
             OpenGL::TimeMarker tot_buffer_time_marker;
             bool               has_been_destroyed;
 
+            /* Map state */
+            OpenGL::VKMapBackingSharedPtr  map_backing_ptr;
+            bool                           map_backing_contents_valid;
+            OpenGL::BufferMapBits          map_bits;
+            std::vector<Anvil::BufferCopy> map_flushed_regions;
+            VkDeviceSize                   map_length;
+            VkDeviceSize                   map_start_offset;
+            bool                           mapped;
+
             BufferData()
             {
-                has_been_destroyed = false;
+                has_been_destroyed         = false;
+                map_backing_contents_valid = false;
+                map_bits                   = 0;
+                map_length                 = 0;
+                map_start_offset           = 0;
+                mapped                     = false;
             }
         } BufferData;
         typedef std::unique_ptr<BufferData> BufferDataUniquePtr;
 
         typedef std::pair<GLuint, OpenGL::TimeMarker> BufferMapKey;
 
+        /* Recycled buffers are bucketed by (size class, usage flags, memory features). */
+        typedef std::tuple<VkDeviceSize, Anvil::BufferUsageFlags, Anvil::MemoryFeatureFlags> BufferPoolKey;
+
         /* Private functions */
         VKBufferManager(const OpenGL::IContextObjectManagers* in_frontend_ptr,
                         IBackend*                             in_backend_ptr);
 
+        void release_map_backing(OpenGL::VKMapBacking* in_map_backing_ptr);
+
         bool                   can_buffer_handle_frontend_reqs(const Anvil::Buffer*        in_buffer_ptr,
                                                                const uint32_t&             in_n_buffer_targets,
                                                                const OpenGL::BufferTarget* in_buffer_targets_ptr,
                                                                const size_t&               in_size) const;
+        BufferPropsUniquePtr   create_buffer_props            (const GLuint&               in_id,
+                                                               const OpenGL::BufferState*  in_frontend_buffer_state_ptr);
         Anvil::BufferUniquePtr create_vk_buffer               (const GLuint&               in_id,
-                                                               const OpenGL::BufferState*  in_frontend_buffer_state_ptr) const;
+                                                               const OpenGL::BufferState*  in_frontend_buffer_state_ptr);
+
+        static VkDeviceSize get_buffer_size_class(const VkDeviceSize& in_size);
+
+        BufferPropsUniquePtr suballocate_from_slab(const SlabKey&      in_slab_key,
+                                                   const VkDeviceSize& in_size);
+        void                 free_slab_region     (Slab*               in_slab_ptr,
+                                                   const VkDeviceSize& in_offset,
+                                                   const VkDeviceSize& in_size);
+
+        void recycle_buffer      (Anvil::BufferUniquePtr in_buffer_ptr);
+        void recycle_buffer_data (BufferData*            in_buffer_data_ptr);
+        void recycle_buffer_props(BufferProps*           in_buffer_props_ptr);
 
         uint32_t get_n_references      (const BufferData*          in_buffer_data_ptr) const;
         void     on_reference_created  (BufferData*                in_buffer_data_ptr,
@@ -91,6 +261,20 @@ namespace OpenGL
         std::map<BufferMapKey, BufferDataUniquePtr> m_buffers;
         mutable std::mutex                          m_mutex;
 
+        std::map<BufferPoolKey, std::vector<Anvil::BufferUniquePtr> > m_buffer_pool; //< NOTE: Guarded by m_mutex.
+        uint32_t                                                       m_n_pooled_buffers;
+
+        std::map<SlabKey, std::vector<SlabUniquePtr> > m_slabs; //< NOTE: Guarded by m_mutex.
+        uint32_t                                       m_n_slabs;
+
+        std::vector<OpenGL::VKMapBackingUniquePtr> m_map_backing_pool;
+        std::mutex                                 m_map_backing_pool_mutex; //< NOTE: Must not be locked before m_mutex.
+
+        std::atomic<uint32_t> m_n_buffers_created;
+        std::atomic<uint32_t> m_n_buffers_recycled;
+        std::atomic<uint32_t> m_n_memory_blocks_allocated;
+        std::atomic<uint32_t> m_n_slab_suballocations;
+
         OpenGL::IBackend* const                     m_backend_ptr;
         const OpenGL::IContextObjectManagers* const m_frontend_ptr;
     };
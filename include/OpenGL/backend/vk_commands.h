@@ -5,6 +5,7 @@
 #ifndef VKGL_VK_COMMANDS_H
 #define VKGL_VK_COMMANDS_H
 
+#include "Anvil/include/misc/types.h"
 #include "Common/macros.h"
 #include "OpenGL/types.h"
 #include "OpenGL/frontend/gl_reference.h"
@@ -34,7 +35,6 @@ namespace OpenGL
         DRAW_RANGE_ELEMENTS,
         FINISH,
         FLUSH,
-        FLUSH_MAPPED_BUFFER_RANGE,
         GET_BUFFER_SUB_DATA,
         GET_COMPRESSED_TEX_IMAGE,
         GET_TEXTURE_IMAGE,
@@ -572,6 +572,7 @@ namespace OpenGL
     {
         GLsizei                                          count;
         GLint                                            first;
+        bool                                             is_program_link_pending; //< Program's uniform resources need to be prepared by the scheduler.
         OpenGL::DrawCallMode                             mode;
         OpenGL::GLContextStateBindingReferencesUniquePtr state_binding_references_ptr;
         OpenGL::GLContextStateReferenceUniquePtr         state_reference_ptr;
@@ -580,10 +581,12 @@ namespace OpenGL
                           const GLint&                                     in_first,
                           const OpenGL::DrawCallMode&                      in_mode,
                           OpenGL::GLContextStateReferenceUniquePtr         in_state_reference_ptr,
-                          OpenGL::GLContextStateBindingReferencesUniquePtr in_state_binding_references_ptr)
+                          OpenGL::GLContextStateBindingReferencesUniquePtr in_state_binding_references_ptr,
+                          const bool&                                      in_is_program_link_pending)
             :CommandBase                 (CommandType::DRAW_ARRAYS),
              count                       (in_count),
              first                       (in_first),
+             is_program_link_pending     (in_is_program_link_pending),
              mode                        (in_mode),
              state_binding_references_ptr(std::move(in_state_binding_references_ptr) ),
              state_reference_ptr         (std::move(in_state_reference_ptr) )
@@ -596,6 +599,7 @@ namespace OpenGL
     {
         GLsizei                                          count;
         uint32_t                                         index_buffer_offset;
+        bool                                             is_program_link_pending; //< Program's uniform resources need to be prepared by the scheduler.
         OpenGL::DrawCallMode                             mode;
         OpenGL::GLContextStateBindingReferencesUniquePtr state_binding_references_ptr;
         OpenGL::GLContextStateReferenceUniquePtr         state_reference_ptr;
@@ -606,10 +610,12 @@ namespace OpenGL
                             const OpenGL::DrawCallMode&                      in_mode,
                             OpenGL::GLContextStateReferenceUniquePtr         in_state_reference_ptr,
                             OpenGL::GLContextStateBindingReferencesUniquePtr in_state_binding_references_ptr,
-                            const OpenGL::DrawCallIndexType&                 in_type)
+                            const OpenGL::DrawCallIndexType&                 in_type,
+                            const bool&                                      in_is_program_link_pending)
             :CommandBase                 (CommandType::DRAW_ELEMENTS),
              count                       (in_count),
              index_buffer_offset         (in_index_buffer_offset),
+             is_program_link_pending     (in_is_program_link_pending),
              mode                        (in_mode),
              state_binding_references_ptr(std::move(in_state_binding_references_ptr) ),
              state_reference_ptr         (std::move(in_state_reference_ptr) ),
@@ -673,25 +679,6 @@ namespace OpenGL
         }
     };
 
-    struct FlushMappedBufferRangeCommand : public CommandBase
-    {
-        OpenGL::GLBufferReferenceUniquePtr buffer_reference_ptr;
-        GLintptr                           offset;
-        GLsizeiptr                         length;
-
-        FlushMappedBufferRangeCommand(OpenGL::GLBufferReferenceUniquePtr in_buffer_reference_ptr,
-                                      const GLintptr&                    in_offset,
-                                      const GLsizeiptr&                  in_length)
-            :CommandBase         (CommandType::FLUSH_MAPPED_BUFFER_RANGE),
-             buffer_reference_ptr(std::move(in_buffer_reference_ptr) ),
-             offset              (in_offset),
-             length              (in_length)
-        {
-            /* NOTE: Backend must not be fed references pointing to ToT snapshots (since it's out-of-sync with frontend) */
-            vkgl_assert(buffer_reference_ptr->get_payload().time_marker != OpenGL::LATEST_SNAPSHOT_AVAILABLE);
-        }
-    };
-
     struct GetBufferSubDataCommand : public CommandBase
     {
         OpenGL::GLBufferReferenceUniquePtr buffer_reference_ptr;
@@ -758,26 +745,26 @@ namespace OpenGL
         }
     };
 
+    /* Issued when the app maps a buffer whose map backing does not hold up-to-date buffer contents. Backend
+     * copies the buffer over to the backing and signals the fence when the data becomes visible to the host.
+     */
     struct MapBufferCommand : public CommandBase
     {
-        OpenGL::BufferAccess               access;
+        OpenGL::VKMapBackingSharedPtr      backing_ptr;
         OpenGL::GLBufferReferenceUniquePtr buffer_reference_ptr;
-        GLsizeiptr                         length;
-        void**                             result_ptr_ptr;
-        GLintptr                           start_offset;
+        VKGL::Fence*                       fence_ptr;
 
-        MapBufferCommand(const OpenGL::BufferAccess&        in_access,
-                         OpenGL::GLBufferReferenceUniquePtr in_buffer_reference_ptr,
-                         const GLsizeiptr&                  in_length,
-                         void**                             in_result_ptr_ptr,
-                         const GLintptr&                    in_start_offset)
+        MapBufferCommand(OpenGL::GLBufferReferenceUniquePtr in_buffer_reference_ptr,
+                         OpenGL::VKMapBackingSharedPtr      in_backing_ptr,
+                         VKGL::Fence*                       in_fence_ptr)
             :CommandBase         (CommandType::MAP_BUFFER),
-             access              (in_access),
+             backing_ptr         (in_backing_ptr),
              buffer_reference_ptr(std::move(in_buffer_reference_ptr) ),
-             length              (in_length),
-             result_ptr_ptr      (in_result_ptr_ptr),
-             start_offset        (in_start_offset)
+             fence_ptr           (in_fence_ptr)
         {
+            vkgl_assert(backing_ptr != nullptr);
+            vkgl_assert(fence_ptr   != nullptr);
+
             /* NOTE: Backend must not be fed references pointing to ToT snapshots (since it's out-of-sync with frontend) */
             vkgl_assert(buffer_reference_ptr->get_payload().time_marker != OpenGL::LATEST_SNAPSHOT_AVAILABLE);
         }
@@ -1111,14 +1098,26 @@ namespace OpenGL
         }
     };
 
+    /* Issued when the app unmaps a buffer it has written to. copy_regions describe which parts of the map backing
+     * need to be copied over to the buffer (flushed ranges for FLUSH_EXPLICIT maps, the whole mapped range otherwise).
+     */
     struct UnmapBufferCommand : public CommandBase
     {
+        OpenGL::VKMapBackingSharedPtr      backing_ptr;
         OpenGL::GLBufferReferenceUniquePtr buffer_reference_ptr;
+        std::vector<Anvil::BufferCopy>     copy_regions;
 
-        UnmapBufferCommand(OpenGL::GLBufferReferenceUniquePtr in_buffer_reference_ptr)
+        UnmapBufferCommand(OpenGL::GLBufferReferenceUniquePtr in_buffer_reference_ptr,
+                           OpenGL::VKMapBackingSharedPtr      in_backing_ptr,
+                           std::vector<Anvil::BufferCopy>     in_copy_regions)
             :CommandBase         (CommandType::UNMAP_BUFFER),
-             buffer_reference_ptr(std::move(in_buffer_reference_ptr) )
+             backing_ptr         (in_backing_ptr),
+             buffer_reference_ptr(std::move(in_buffer_reference_ptr) ),
+             copy_regions        (std::move(in_copy_regions) )
         {
+            vkgl_assert(backing_ptr         != nullptr);
+            vkgl_assert(copy_regions.size() >  0);
+
             /* NOTE: Backend must not be fed references pointing to ToT snapshots (since it's out-of-sync with frontend) */
             vkgl_assert(buffer_reference_ptr->get_payload().time_marker != OpenGL::LATEST_SNAPSHOT_AVAILABLE);
         }
@@ -9,10 +9,58 @@
 #include "OpenGL/backend/vk_commands.h"
 #include "OpenGL/backend/vk_frame_graph_node.h"
 #include "OpenGL/types.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <thread>
 
 namespace OpenGL
 {
+    typedef struct VKFrameGraphStats
+    {
+        uint32_t cpu_wait_time_us;                   //< Time the app thread spent blocked in present() on the frames-in-flight limit.
+        uint32_t gpu_idle_time_us;                   //< Time without any non-blocking execution in flight, ie. the GPU was waiting for the CPU.
+        uint32_t n_attachment_stores_discarded;      //< Default FB depth/stencil stores turned into STORE_OP_DONT_CARE, since nothing reads them before present.
+        uint32_t n_barriers_dropped;                 //< Barriers which were found to be no-ops (read->read, no layout change, no ownership transfer).
+        uint32_t n_barriers_hoisted;                 //< Intra-group barrier sets which were moved to an earlier barrier command.
+        uint32_t n_barriers_merged;                  //< Barriers which were folded into other barriers covering the same resource.
+        uint32_t n_buffer_barriers;                  //< Buffer memory barriers recorded.
+        uint32_t n_clears_folded_into_load_ops;      //< Clear nodes baked into RP load ops instead of being recorded.
+        uint32_t n_command_buffers_allocated;        //< Command buffers allocated from command pools. Should drop to zero in steady state.
+        uint32_t n_command_buffers_recycled;         //< Command buffers reused after their pool has been reset.
+        uint32_t n_command_pools_created;            //< Command pools created.
+        uint32_t n_executions_in_flight;             //< Non-blocking executions which had not retired yet when the stats were popped.
+        uint32_t n_image_barriers;                   //< Image memory barriers recorded.
+        uint32_t n_pipeline_barrier_cmds;            //< vkCmdPipelineBarrier() calls recorded.
+        uint32_t n_set_event_cmds;                   //< vkCmdSetEvent() calls recorded.
+        uint32_t n_submissions;                      //< Command buffer submissions (one per group node).
+        uint32_t n_submissions_without_reordering;   //< Submissions which would have been needed, had the nodes been executed in GL submission order.
+        uint32_t n_wait_events_cmds;                 //< vkCmdWaitEvents() calls recorded.
+
+        VKFrameGraphStats()
+        {
+            cpu_wait_time_us                 = 0;
+            gpu_idle_time_us                 = 0;
+            n_attachment_stores_discarded    = 0;
+            n_barriers_dropped               = 0;
+            n_barriers_hoisted               = 0;
+            n_barriers_merged                = 0;
+            n_buffer_barriers                = 0;
+            n_clears_folded_into_load_ops    = 0;
+            n_command_buffers_allocated      = 0;
+            n_command_buffers_recycled       = 0;
+            n_command_pools_created          = 0;
+            n_executions_in_flight           = 0;
+            n_image_barriers                 = 0;
+            n_pipeline_barrier_cmds          = 0;
+            n_set_event_cmds                 = 0;
+            n_submissions                    = 0;
+            n_submissions_without_reordering = 0;
+            n_wait_events_cmds               = 0;
+        }
+    } VKFrameGraphStats;
+
     class VKFrameGraph : public IVKFrameGraphNodeCallback
     {
     public:
@@ -30,6 +78,14 @@ namespace OpenGL
         void on_image_deleted      (Anvil::Image*  in_image_ptr);
         void on_swapchain_recreated();
 
+        /* Called from the app's rendering thread whenever present() had to block, because the maximum number of frames
+         * was already in flight.
+         */
+        void on_present_cpu_wait(const std::chrono::microseconds& in_wait_time);
+
+        /* Returns counters accumulated since the previous call and resets them. Meant to be called once per frame. */
+        OpenGL::VKFrameGraphStats pop_frame_stats();
+
     private:
         /* Private type definitions */
         struct GroupNode;
@@ -42,24 +98,49 @@ namespace OpenGL
             std::vector<Anvil::BufferBarrier> buffer_barriers;
             std::vector<Anvil::ImageBarrier>  image_barriers;
 
+            uint32_t      n_latest_src_graph_node; //< intra-graph node barriers only: index of the last graph node producing data the barriers sync. UINT32_MAX otherwise.
+            Anvil::Event* wait_event_ptr;          //< if not null, barriers are recorded with vkCmdWaitEvents() rather than vkCmdPipelineBarrier().
+
             BarrierData()
-                :dst_pipeline_stages(Anvil::PipelineStageFlagBits::NONE),
-                 src_pipeline_stages(Anvil::PipelineStageFlagBits::NONE)
+                :dst_pipeline_stages    (Anvil::PipelineStageFlagBits::NONE),
+                 n_latest_src_graph_node(UINT32_MAX),
+                 src_pipeline_stages    (Anvil::PipelineStageFlagBits::NONE),
+                 wait_event_ptr         (nullptr)
             {
                 /* Stub */
             }
+
+            bool is_empty() const
+            {
+                return (buffer_barriers.size() == 0 &&
+                        image_barriers.size () == 0);
+            }
         } BarrierData;
 
-        typedef struct BufferInfo
+        /* Buffer state is tracked per byte range. Each buffer holds a set of disjoint [start, end) intervals, keyed by start offset.
+         * Bytes not covered by any interval have never been accessed by the frame graph.
+         */
+        typedef struct BufferRangeInfo
         {
-            uint32_t owning_queue_family_index;
+            VkDeviceSize end_offset;
+            uint32_t     owning_queue_family_index;
+
+            BufferRangeInfo()
+                :end_offset               (0),
+                 owning_queue_family_index(UINT32_MAX)
+            {
+                /* Stub */
+            }
 
-            BufferInfo()
-                :owning_queue_family_index(UINT32_MAX)
+            BufferRangeInfo(const VkDeviceSize& in_end_offset,
+                            const uint32_t&     in_owning_queue_family_index)
+                :end_offset               (in_end_offset),
+                 owning_queue_family_index(in_owning_queue_family_index)
             {
                 /* Stub */
             }
-        } BufferInfo;
+        } BufferRangeInfo;
+        typedef std::map<VkDeviceSize, BufferRangeInfo> BufferRangeMap;
 
         typedef struct ImageInfo
         {
@@ -74,6 +155,30 @@ namespace OpenGL
             }
         } ImageInfo;
 
+        /* Image state is tracked per (mip, layer) pair. */
+        typedef struct ImageSubresourceInfo
+        {
+            uint32_t               n_layers;
+            uint32_t               n_mips;
+            std::vector<ImageInfo> subresources; //< n_mip * n_layers + n_layer -> state
+
+            ImageSubresourceInfo()
+                :n_layers(0),
+                 n_mips  (0)
+            {
+                /* Stub */
+            }
+
+            ImageInfo& get(const uint32_t& in_n_mip,
+                           const uint32_t& in_n_layer)
+            {
+                vkgl_assert(in_n_mip   < n_mips);
+                vkgl_assert(in_n_layer < n_layers);
+
+                return subresources.at(in_n_mip * n_layers + in_n_layer);
+            }
+        } ImageSubresourceInfo;
+
         struct CommandBufferDynamicState
         {
             Anvil::PipelineID bound_gfx_pipeline_id;
@@ -109,6 +214,9 @@ namespace OpenGL
             VkViewport        bound_dynamic_viewport_state;
             bool              is_dynamic_viewport_state_bound;
 
+            std::vector<Anvil::Buffer*> bound_vertex_buffer_ptrs;    //< empty if no vertex buffers have been bound yet.
+            std::vector<VkDeviceSize>   bound_vertex_buffer_offsets;
+
             CommandBufferDynamicState();
         };
 
@@ -131,15 +239,62 @@ namespace OpenGL
             }
         } SwapchainImageInfo;
 
+        /* Command pools used to record command buffers for a single execute() call. A slot is grabbed at the beginning of execute() and
+         * travels with the ActiveSubmission. Once the submission's fence is set, all pools of the slot are reset at once and the slot,
+         * along with all command buffers allocated from its pools, is put back into the free list.
+         */
+        typedef struct CommandPoolSlot
+        {
+            typedef struct PoolData
+            {
+                /* NOTE: Command buffers must be released before the pool they were allocated from. Do not reorder. */
+                Anvil::CommandPoolUniquePtr                       command_pool_ptr;
+                std::vector<Anvil::PrimaryCommandBufferUniquePtr> cmd_buffer_ptrs;
+                uint32_t                                          n_cmd_buffers_used;
+
+                PoolData()
+                    :n_cmd_buffers_used(0)
+                {
+                    /* Stub */
+                }
+            } PoolData;
+
+            /* GPU timestamps of group nodes recorded for the execution. Only used while the trace recorder is enabled. */
+            typedef struct TimestampQuery
+            {
+                uint32_t    gpu_track_id;
+                const char* name;
+                uint32_t    start_query_index;    //< End timestamp is stored at the next index.
+                uint64_t    timestamp_valid_mask;
+
+                TimestampQuery(const uint32_t& in_gpu_track_id,
+                               const char*     in_name,
+                               const uint32_t& in_start_query_index,
+                               const uint64_t& in_timestamp_valid_mask)
+                    :gpu_track_id        (in_gpu_track_id),
+                     name                (in_name),
+                     start_query_index   (in_start_query_index),
+                     timestamp_valid_mask(in_timestamp_valid_mask)
+                {
+                    /* Stub */
+                }
+            } TimestampQuery;
+
+            std::map<std::pair<std::thread::id, uint32_t>, PoolData> pool_data_map; //< (recording thread, queue family index) -> pool data
+
+            Anvil::QueryPoolUniquePtr   timestamp_query_pool_ptr; //< Grown on demand. Queries are reset by the command buffers using them.
+            std::vector<TimestampQuery> timestamp_queries;        //< Cleared when the slot is released.
+        } CommandPoolSlot;
+        typedef std::unique_ptr<CommandPoolSlot> CommandPoolSlotUniquePtr;
+
         typedef struct CommandBufferSubmission
         {
             GroupNode* parent_group_node_ptr;
 
-            std::vector<Anvil::PrimaryCommandBuffer*>         command_buffers_ptr;
-            std::vector<Anvil::PrimaryCommandBufferUniquePtr> command_buffers_owned_ptr;
-            std::vector<Anvil::Semaphore*>                    signal_semaphore_ptrs;
-            std::vector<Anvil::PipelineStageFlags>            wait_dst_stage_masks;
-            std::vector<Anvil::Semaphore*>                    wait_semaphore_ptrs;
+            std::vector<Anvil::PrimaryCommandBuffer*> command_buffers_ptr; //< owned by a CommandPoolSlot.
+            std::vector<Anvil::Semaphore*>            signal_semaphore_ptrs;
+            std::vector<Anvil::PipelineStageFlags>    wait_dst_stage_masks;
+            std::vector<Anvil::Semaphore*>            wait_semaphore_ptrs;
 
             CommandBufferSubmission(GroupNode* in_parent_group_node_ptr)
                 :parent_group_node_ptr(in_parent_group_node_ptr)
@@ -221,6 +376,9 @@ namespace OpenGL
             Anvil::RenderPass*  renderpass_ptr;       //< only valid if uses_renderpass is true.
             bool                uses_renderpass;      //< only valid for UNIVERSAL queue families.
 
+            std::vector<VkClearValue> clear_values;                      //< indexed by RP attachment ID. Only valid if uses_renderpass is true.
+            uint32_t                  n_graph_nodes_folded_into_load_ops; //< number of leading Clear graph nodes baked into RP's load ops. Their commands are not recorded.
+
             std::vector<OpenGL::IVKFrameGraphNode*> graph_node_ptrs;
             std::vector<OpenGL::NodeIOUniquePtr>    input_ptrs;
             std::vector<OpenGL::NodeIOUniquePtr>    output_ptrs;
@@ -237,9 +395,16 @@ namespace OpenGL
             BarrierData              group_node_pre_barriers;
             std::vector<BarrierData> intra_graph_node_pre_barriers;
 
+            /* Split barriers: if an event is defined for graph node N, it is set right after the node's commands, using corresponding stage mask.
+             * Consumers wait on the event (see BarrierData::wait_event_ptr), instead of stalling the pipe right after the producer.
+             */
+            std::vector<Anvil::EventUniquePtr>     intra_graph_node_post_event_ptrs;
+            std::vector<Anvil::PipelineStageFlags> intra_graph_node_post_event_stages;
+
             GroupNode()
                 :framebuffer_n_layers               (0),
                  framebuffer_ptr                    (nullptr),
+                 n_graph_nodes_folded_into_load_ops (0),
                  needs_post_submission_cpu_execution(false),
                  parent_submission_ptr              (nullptr),
                  queue_family                       (Anvil::QueueFamilyType::UNDEFINED),
@@ -255,6 +420,7 @@ namespace OpenGL
                       const bool&                   in_uses_renderpass)
                 :framebuffer_n_layers               (0),
                  framebuffer_ptr                    (nullptr),
+                 n_graph_nodes_folded_into_load_ops (0),
                  needs_post_submission_cpu_execution(false),
                  queue_family                       (in_queue_family),
                  queue_ptr                          (nullptr),
@@ -343,33 +509,83 @@ namespace OpenGL
         typedef struct ActiveSubmission
         {
             std::vector<CommandBufferSubmissionUniquePtr> cmd_buffer_submission_ptr_vec;
+            CommandPoolSlotUniquePtr                      command_pool_slot_ptr;
             Anvil::FenceUniquePtr                         fence_ptr;
-            VKGL::Fence*                                  fence2_ptr;
             std::vector<GroupNodeUniquePtr>               group_node_ptrs_vec;
             std::vector<VKFrameGraphNodeUniquePtr>        node_ptrs_vec;
             std::vector<Anvil::SemaphoreUniquePtr>        sem_ptr_vec;
+            uint64_t                                      timeline_value;
             
             ActiveSubmission(Anvil::FenceUniquePtr                          in_fence_ptr,
                              std::vector<GroupNodeUniquePtr>&               inout_group_node_ptrs_vec,
                              std::vector<VKFrameGraphNodeUniquePtr>&        inout_node_ptrs_vec,
                              std::vector<CommandBufferSubmissionUniquePtr>& inout_cmd_buffer_submission_ptr_vec,
                              std::vector<Anvil::SemaphoreUniquePtr>&        inout_sem_ptr_vec,
-                              VKGL::Fence*                                  in_fence2_ptr)
+                             CommandPoolSlotUniquePtr                       in_command_pool_slot_ptr,
+                             const uint64_t&                                in_timeline_value)
             {
                  cmd_buffer_submission_ptr_vec = (std::move(inout_cmd_buffer_submission_ptr_vec) );
+                 command_pool_slot_ptr         = (std::move(in_command_pool_slot_ptr) );
                  fence_ptr                         = (std::move(in_fence_ptr) );
-                 fence2_ptr                        = (in_fence2_ptr);
                  group_node_ptrs_vec             = (std::move(inout_group_node_ptrs_vec) );
                  node_ptrs_vec                    = (std::move(inout_node_ptrs_vec) );
                  sem_ptr_vec                      = (std::move(inout_sem_ptr_vec) );
+                 timeline_value                   = in_timeline_value;
                 /* Stub */
             }
         } ActiveSubmission;
 
+        /* Describes a submission the retire thread needs to wait on. Entries are processed in submission order.
+         *
+         * A null fence_ptr marks a request to signal opt_fence2_ptr as soon as all preceding entries are retired.
+         */
+        typedef struct PendingRetirement
+        {
+            Anvil::Fence*    fence_ptr;                 //< Owned by the corresponding ActiveSubmission.
+            CommandPoolSlot* opt_command_pool_slot_ptr; //< Ditto. Set if the slot holds timestamp queries to resolve.
+            VKGL::Fence*     opt_fence2_ptr;
+            uint64_t         timeline_value;
+
+            PendingRetirement()
+                :fence_ptr                (nullptr),
+                 opt_command_pool_slot_ptr(nullptr),
+                 opt_fence2_ptr           (nullptr),
+                 timeline_value           (0)
+            {
+                /* Stub */
+            }
+
+            PendingRetirement(Anvil::Fence*    in_fence_ptr,
+                              CommandPoolSlot* in_opt_command_pool_slot_ptr,
+                              VKGL::Fence*     in_opt_fence2_ptr,
+                              const uint64_t&  in_timeline_value)
+                :fence_ptr                (in_fence_ptr),
+                 opt_command_pool_slot_ptr(in_opt_command_pool_slot_ptr),
+                 opt_fence2_ptr           (in_opt_fence2_ptr),
+                 timeline_value           (in_timeline_value)
+            {
+                /* Stub */
+            }
+        } PendingRetirement;
+
+        typedef struct QueueTraceInfo
+        {
+            uint32_t gpu_track_id;
+            uint64_t timestamp_valid_mask; //< 0 if timestamps cannot be written on the queue.
+
+            QueueTraceInfo()
+                :gpu_track_id        (UINT32_MAX),
+                 timestamp_valid_mask(0)
+            {
+                /* Stub */
+            }
+        } QueueTraceInfo;
+
         /* IVKFrameGraphNodeCallback functions */
         uint32_t                      get_acquired_swapchain_image_index      ()                                                   const final;
         OpenGL::VKSwapchainReference* get_acquired_swapchain_reference_raw_ptr()                                                   const final;
         Anvil::PipelineID             get_pipeline_id                         (const OpenGL::DrawCallMode&   in_draw_call_mode)          final;
+        VkRect2D                      get_render_area                         ()                                                   const final;
         Anvil::Semaphore*             get_swapchain_image_acquired_sem        ()                                                   const final;
         void                          set_acquired_swapchain_reference_raw_ptr(OpenGL::VKSwapchainReference* in_swapchain_reference_ptr) final;
         void                          set_acquired_swapchain_image_index      (const uint32_t&               in_index)                   final;
@@ -379,6 +595,13 @@ namespace OpenGL
                            Anvil::Semaphore***               out_wait_sems_ptr_ptr_ptr,
                            const Anvil::PipelineStageFlags** out_wait_sem_stage_mask_ptr_ptr) final;
 
+        bool are_vertex_buffers_bound(const uint32_t&       in_n_bindings,
+                                      Anvil::Buffer* const* in_buffer_ptrs,
+                                      const VkDeviceSize*   in_offsets) const final;
+        void set_bound_vertex_buffers(const uint32_t&       in_n_bindings,
+                                      Anvil::Buffer* const* in_buffer_ptrs,
+                                      const VkDeviceSize*   in_offsets)       final;
+
         bool get_bound_dynamic_blend_color_state               (float*             out_result_vec4_ptr) const final;
         bool get_bound_dynamic_line_width_state                (float*             out_result_ptr)      const final;
         bool get_bound_dynamic_scissor_state                   (VkRect2D*          out_result_ptr)      const final;
@@ -427,6 +650,10 @@ namespace OpenGL
                                                             const Anvil::AccessFlags&                         in_access_mask_for_ds_aspects,
                                                             Anvil::PipelineStageFlags&                        inout_src_pipeline_stages,
                                                             const bool&                                       in_parent_group_node_uses_renderpass);
+        void set_buffer_range_owner                        (BufferRangeMap&                                   inout_range_map,
+                                                            const VkDeviceSize&                               in_start_offset,
+                                                            const VkDeviceSize&                               in_end_offset,
+                                                            const uint32_t&                                   in_queue_family_index) const;
         void split_access_mask_to_color_and_ds_access_masks(const Anvil::AccessFlags&                         in_access_mask,
                                                             Anvil::AccessFlags*                               out_color_aspect_access_mask_ptr,
                                                             Anvil::AccessFlags*                               out_ds_aspects_access_mask_ptr) const;
@@ -440,18 +667,42 @@ namespace OpenGL
                                             std::unordered_map<const GroupNode*, std::vector<GroupNodeToGroupNodeSquashedConnection> >*       out_src_dst_group_node_connections_ptr);
         bool execute_cpu_prepass           (const std::vector<VKFrameGraphNodeUniquePtr>&                                                     in_node_ptrs);
         bool inject_swapchain_acquire_nodes(std::vector<VKFrameGraphNodeUniquePtr>&                                                           inout_node_ptrs);
+        bool optimize_barriers             (const std::vector<GroupNodeUniquePtr>&                                                            in_group_nodes_ptr);
+        bool reorder_nodes                 (std::vector<VKFrameGraphNodeUniquePtr>&                                                           inout_node_ptrs);
         bool record_command_buffers        (const std::vector<GroupNodeUniquePtr>&                                                            in_group_nodes_ptr,
                                             const std::unordered_map<const GroupNode*, std::vector<GroupNodeToGroupNodeSquashedConnection> >& in_src_dst_group_node_connections,
+                                            CommandPoolSlot*                                                                                  in_command_pool_slot_ptr,
                                             std::vector<CommandBufferSubmissionUniquePtr>*                                                    out_cmd_buffer_submissions_ptr,
                                             std::vector<Anvil::SemaphoreUniquePtr>&                                                           inout_sem_ptr_vec);
         bool submit_command_buffers        (const std::vector<CommandBufferSubmissionUniquePtr>&                                              in_cmd_buffer_submissions_ptr,
                                             Anvil::Fence*                                                                                     in_opt_wait_fence_ptr,
                                             std::vector<Anvil::SemaphoreUniquePtr>&                                                           inout_sem_ptr_vec);
 
+        CommandPoolSlotUniquePtr     acquire_command_pool_slot();
+        Anvil::PrimaryCommandBuffer* alloc_command_buffer     (CommandPoolSlot*         in_command_pool_slot_ptr,
+                                                               const uint32_t&          in_queue_family_index);
+        void                         release_command_pool_slot(CommandPoolSlotUniquePtr in_command_pool_slot_ptr);
+
+        uint64_t               get_execution_timeline_value       ()                                                                     const;
+        uint32_t               get_n_group_nodes_for_node_sequence(const std::vector<VKFrameGraphNodeUniquePtr>& in_node_ptrs)                   const;
+        Anvil::QueueFamilyType get_node_queue_family_type         (const OpenGL::IVKFrameGraphNode*              in_node_ptr,
+                                                                   bool*                                         out_opt_supports_dma_queues_ptr) const;
+
+        bool does_graph_node_touch_barrier_resources(const OpenGL::IVKFrameGraphNode* in_graph_node_ptr,
+                                                     const BarrierData&               in_barrier_data) const;
+        void drop_and_merge_barriers                (BarrierData*                     inout_barrier_data_ptr);
+        void update_stats_for_recorded_barriers     (const BarrierData&               in_barrier_data);
+
         bool init               ();
         bool init_queue_rings   ();
+        bool init_retire_thread ();
         bool init_swapchain_data();
 
+        void resolve_timestamp_queries(CommandPoolSlot* in_command_pool_slot_ptr,
+                                       const uint64_t&  in_fence_signaled_time_us) const;
+        void retire_thread_entrypoint ();
+        void wait_for_timeline_value  (const uint64_t&  in_timeline_value);
+
         bool do_group_nodes_encapsulate_swapchain_acquire_present_command_stream(const std::vector<GroupNodeUniquePtr>& in_group_nodes_ptr) const;
 
         /* Private variables */
@@ -466,19 +717,24 @@ namespace OpenGL
         const OpenGL::IContextObjectManagers*  m_frontend_ptr;
         std::vector<VKFrameGraphNodeUniquePtr> m_node_ptrs;
 
-        std::unordered_map<Anvil::Buffer*, BufferInfo> m_buffer_data; //< todo: Use binary tree or a more fancy structure to speed up coalesce/split ops
-                                                                      //< todo: Use buffer memory subregions instead of buffer instances.
-        std::unordered_map<Anvil::Image*, ImageInfo> m_image_data;
+        std::unordered_map<const Anvil::Buffer*, BufferRangeMap>      m_buffer_data;
+        std::unordered_map<const Anvil::Image*, ImageSubresourceInfo> m_image_data;
         std::vector<SwapchainImageInfo>                m_swapchain_image_data;
 
         std::vector<Anvil::PipelineStageFlags> m_wait_sem_stage_masks_for_current_cpu_node;
         std::vector<Anvil::Semaphore*>         m_wait_sem_vec_for_current_cpu_node;
 
         std::unordered_map<Anvil::QueueFamilyType, QueueRingUniquePtr> m_queue_ring_ptr_per_queue_fam;
+        std::unordered_map<const Anvil::Queue*, QueueTraceInfo>        m_queue_trace_info;
+
+        bool  m_is_tracing_execution; //< Set by execute() if the trace recorder was enabled when it started. NOTE: Guarded by m_execute_mutex.
+        float m_timestamp_period_ns;
 
         //< Only used at command buffer recording time.
         CommandBufferDynamicState m_current_cmd_buffer_dynamic_state;
 
+        OpenGL::VKFrameGraphStats m_frame_stats; //< NOTE: Guarded by m_execute_mutex.
+
         //< Vulkan objects must not be released until command buffer submissions that consume them
         //< finish executing GPU-side. We need to take this into account:
         //<
@@ -489,7 +745,25 @@ namespace OpenGL
         //< Each submission chain is therefore cached by storing a fence used for the last submission,
         //< along with all nodes that contributed to the submission. Once the fence is set, it is safe
         //< to release all objects.
-        std::vector<ActiveSubmission> m_active_submissions;
+        //<
+        //< Entries are ordered by their timeline value.
+        std::deque<ActiveSubmission> m_active_submissions;
+
+        //< Each non-blocking execution is assigned the next value on the frame graph's timeline. The retire thread waits
+        //< on the executions' fences in order, wakes up VKGL::Fence waiters as soon as GPU-side work finishes and advances
+        //< the completed value. Retiring active submissions then only takes a single read of the counter.
+        std::atomic<uint64_t>         m_completed_timeline_value;
+        uint64_t                      m_last_submitted_timeline_value; //< NOTE: Guarded by m_execute_mutex.
+        std::deque<PendingRetirement> m_pending_retirements;           //< NOTE: Guarded by m_retire_mutex.
+        std::condition_variable       m_retire_condition;
+        std::mutex                    m_retire_mutex;
+        std::unique_ptr<std::thread>  m_retire_thread_ptr;
+        bool                          m_retire_thread_terminating;     //< NOTE: Guarded by m_retire_mutex.
+
+        std::atomic<uint64_t> m_cpu_wait_time_us; //< Accumulated by the app thread, see on_present_cpu_wait().
+        std::atomic<uint64_t> m_gpu_idle_time_us; //< Accumulated by the retire thread.
+
+        std::vector<CommandPoolSlotUniquePtr> m_free_command_pool_slots; //< NOTE: Guarded by m_execute_mutex.
 
         std::mutex m_execute_mutex;
         std::mutex m_general_mutex;
@@ -220,10 +220,12 @@ namespace OpenGL
     {
         Acquire_Swapchain_Image,
         Buffer_Data,
+        Buffer_Map_Copy,
         Buffer_Sub_Data,
         Clear,
         Draw,
         Present_Swapchain_Image,
+        Synthetic,               //< Created by benchmarks.
 
         Unknown
     };
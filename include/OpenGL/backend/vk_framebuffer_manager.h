@@ -5,7 +5,7 @@
 #ifndef VKGL_VK_FRAMEBUFFER_MANAGER_H
 #define VKGL_VK_FRAMEBUFFER_MANAGER_H
 
-#include "Common/shared_mutex.h"
+#include "OpenGL/backend/vk_lru_cache.h"
 #include "OpenGL/types.h"
 
 namespace OpenGL
@@ -16,28 +16,68 @@ namespace OpenGL
         /* Public functions */
         static VKFramebufferManagerUniquePtr create(IBackend* in_backend_ptr);
 
+        /* @param in_timeline_value is the frame graph timeline value of the execution which is going to use the framebuffer. */
         Anvil::Framebuffer* get_framebuffer(const std::vector<Anvil::ImageView*>& in_attachments_ptr,
                                             const uint32_t&                       in_width,
                                             const uint32_t&                       in_height,
                                             const uint32_t&                       in_n_layers,
-                                            Anvil::RenderPass*                    in_rp_ptr);
+                                            Anvil::RenderPass*                    in_rp_ptr,
+                                            const uint64_t&                       in_timeline_value);
+
+        /* Returns cache counters accumulated since the previous call and resets them. */
+        OpenGL::VKCacheStats pop_frame_stats();
+
+        /* Evicts least recently used framebuffers above the cache capacity. See VKLRUCache::trim(). */
+        void trim(const uint64_t& in_completed_timeline_value);
 
         ~VKFramebufferManager();
 
     private:
         /* Private type definitions */
         typedef struct FramebufferData
+        {
+            std::vector<Anvil::ImageView*>     attachment_ptrs;
+            Anvil::FramebufferUniquePtr        framebuffer_ptr;
+            const Anvil::RenderPass*           renderpass_ptr;
+            OpenGL::VKRenderpassManager* const renderpass_manager_ptr;
+
+            FramebufferData(const Anvil::RenderPass*     in_renderpass_ptr,
+                            OpenGL::VKRenderpassManager* in_renderpass_manager_ptr);
+           ~FramebufferData();
+        } FramebufferData;
+
+        typedef std::unique_ptr<FramebufferData> FramebufferDataUniquePtr;
+
+        /* Hash collisions are resolved by comparing the attachments. Compatibility with the requested RP is guaranteed by
+         * the hash, which includes the RP compatibility hash.
+         */
+        typedef struct FramebufferKey
         {
             std::vector<Anvil::ImageView*> attachment_ptrs;
-            Anvil::FramebufferUniquePtr    framebuffer_ptr;
-            const Anvil::RenderPass*       renderpass_ptr;
+            uint64_t                       hash;
 
-            FramebufferData(const Anvil::RenderPass* in_renderpass_ptr)
-                :renderpass_ptr(in_renderpass_ptr)
+            FramebufferKey(const std::vector<Anvil::ImageView*>& in_attachment_ptrs,
+                           const uint64_t&                       in_hash)
+                :attachment_ptrs(in_attachment_ptrs),
+                 hash           (in_hash)
             {
-                vkgl_assert(renderpass_ptr != nullptr);
+                /* Stub */
             }
-        } FramebufferData;
+
+            bool operator==(const FramebufferKey& in_key) const
+            {
+                return (hash            == in_key.hash            &&
+                        attachment_ptrs == in_key.attachment_ptrs);
+            }
+        } FramebufferKey;
+
+        typedef struct FramebufferKeyHash
+        {
+            size_t operator()(const FramebufferKey& in_key) const
+            {
+                return static_cast<size_t>(in_key.hash);
+            }
+        } FramebufferKeyHash;
 
         /* Private functions */
         VKFramebufferManager(IBackend* in_backend_ptr);
@@ -51,8 +91,8 @@ namespace OpenGL
         /* Private variables */
         IBackend* const m_backend_ptr;
 
-        std::unordered_map<uint64_t, std::vector<std::unique_ptr<FramebufferData> > > m_framebuffer_ptr_map;
-        VKGL::SharedMutex                                                             m_rw_mutex;
+        std::mutex                                                                   m_create_mutex; //< Serializes FB creation & eviction. Lookups are lock-free.
+        VKLRUCache<FramebufferKey, FramebufferDataUniquePtr, FramebufferKeyHash> m_framebuffer_cache;
     };
 }
 #endif /* VKGL_VK_FRAMEBUFFER_MANAGER_H */
@@ -5,7 +5,7 @@
 #ifndef VKGL_VK_GFX_PIPELINE_MANAGER_H
 #define VKGL_VK_GFX_PIPELINE_MANAGER_H
 
-#include "Common/shared_mutex.h"
+#include "OpenGL/backend/vk_lru_cache.h"
 #include "OpenGL/backend/vk_renderpass_manager.h"
 #include "OpenGL/types.h"
 
@@ -25,7 +25,14 @@ namespace OpenGL
                                       const OpenGL::GLContextStateBindingReferences* in_context_state_binding_refs_ptr,
                                       const Anvil::PrimitiveTopology&                in_primitive_topology,
                                       const Anvil::RenderPass*                       in_rp_ptr,
-                                      const Anvil::SubPassID&                        in_subpass_id);
+                                      const Anvil::SubPassID&                        in_subpass_id,
+                                      const uint64_t&                                in_timeline_value);
+
+        /* Returns cache counters accumulated since the previous call and resets them. */
+        OpenGL::VKCacheStats pop_frame_stats();
+
+        /* Evicts least recently used pipelines above the cache capacity. See VKLRUCache::trim(). */
+        void trim(const uint64_t& in_completed_timeline_value);
 
         ~VKGFXPipelineManager();
 
@@ -159,14 +166,54 @@ namespace OpenGL
             uint32_t                                   get_tightly_packed_stride_for_vaa(const OpenGL::VertexAttributeArrayState& in_vaa) const;
 
             /* Private variables */
-            Anvil::BaseDevice* const device_ptr;
-            const GLState            gl_state;
-            Anvil::PipelineID        pipeline_id;
-            const Anvil::RenderPass* rp_ptr;
+            Anvil::BaseDevice* const           device_ptr;
+            const GLState                      gl_state;
+            Anvil::PipelineID                  pipeline_id;
+            const Anvil::RenderPass*           rp_ptr;
+            OpenGL::VKRenderpassManager* const rp_manager_ptr;
         } GFXPipelineProps;
 
         typedef std::unique_ptr<GFXPipelineProps> GFXPipelinePropsUniquePtr;
 
+        typedef struct GFXPipelineKey
+        {
+            GLStateHash              gl_state_hash;
+            Anvil::PrimitiveTopology primitive_topology;
+            OpenGL::RenderPassHash   rp_hash;
+            Anvil::SubPassID         subpass_id;
+
+            GFXPipelineKey(const GLStateHash&              in_gl_state_hash,
+                           const OpenGL::RenderPassHash&   in_rp_hash,
+                           const Anvil::SubPassID&         in_subpass_id,
+                           const Anvil::PrimitiveTopology& in_primitive_topology)
+                :gl_state_hash     (in_gl_state_hash),
+                 primitive_topology(in_primitive_topology),
+                 rp_hash           (in_rp_hash),
+                 subpass_id        (in_subpass_id)
+            {
+                /* Stub */
+            }
+
+            bool operator==(const GFXPipelineKey& in_key) const
+            {
+                return (gl_state_hash      == in_key.gl_state_hash      &&
+                        primitive_topology == in_key.primitive_topology &&
+                        rp_hash            == in_key.rp_hash            &&
+                        subpass_id         == in_key.subpass_id);
+            }
+        } GFXPipelineKey;
+
+        typedef struct GFXPipelineKeyHash
+        {
+            size_t operator()(const GFXPipelineKey& in_key) const
+            {
+                return static_cast<size_t>(in_key.gl_state_hash                                                 ^
+                                           (in_key.rp_hash                                 * 0x9E3779B97F4A7C15ull) ^
+                                           (static_cast<uint64_t>(in_key.subpass_id)         << 48)                 ^
+                                           (static_cast<uint64_t>(in_key.primitive_topology) << 56) );
+            }
+        } GFXPipelineKeyHash;
+
         /* Private functions */
         VKGFXPipelineManager(IBackend*                     in_backend_ptr,
                              const IContextObjectManagers* in_frontend_ptr);
@@ -175,8 +222,8 @@ namespace OpenGL
         IBackend*                     const m_backend_ptr;
         const IContextObjectManagers* const m_frontend_ptr;
 
-        std::unordered_map<GLStateHash, std::unordered_map<OpenGL::RenderPassHash, std::unordered_map<uint32_t /* subpass id */, std::array<GFXPipelinePropsUniquePtr, VK_PRIMITIVE_TOPOLOGY_END_RANGE + 1> > > > m_gfx_pipeline_props_map;
-        mutable VKGL::SharedMutex                                                                                                                                                                                 m_rw_mutex;
+        std::mutex                                                                      m_create_mutex; //< Serializes pipeline creation & eviction. Lookups are lock-free.
+        VKLRUCache<GFXPipelineKey, GFXPipelinePropsUniquePtr, GFXPipelineKeyHash> m_gfx_pipeline_props_cache;
     };
 }
 #endif /* VKGL_VK_GFX_PIPELINE_MANAGER_H */
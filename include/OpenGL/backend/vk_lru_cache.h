@@ -0,0 +1,247 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_VK_LRU_CACHE_H
+#define VKGL_VK_LRU_CACHE_H
+
+#include "Common/macros.h"
+#include "Common/read_mostly_hash_map.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace OpenGL
+{
+    typedef struct VKCacheStats
+    {
+        uint32_t n_entries;          //< Objects cached when the stats were popped.
+        uint32_t n_entries_max;      //< Capacity of the cache.
+        uint32_t n_evictions;        //< Objects evicted since the previous call.
+        uint32_t n_hits;             //< Lookups served from the cache since the previous call.
+        uint32_t n_misses;           //< Objects created since the previous call.
+        uint32_t n_pending_releases; //< Evicted objects which the GPU may still be using.
+        uint32_t n_releases;         //< Evicted objects destroyed since the previous call.
+
+        VKCacheStats()
+        {
+            n_entries          = 0;
+            n_entries_max      = 0;
+            n_evictions        = 0;
+            n_hits             = 0;
+            n_misses           = 0;
+            n_pending_releases = 0;
+            n_releases         = 0;
+        }
+    } VKCacheStats;
+
+    /* Bounded cache of Vulkan objects.
+     *
+     * Each lookup stamps the object with the frame graph timeline value of the execution which is going to use it. trim()
+     * evicts the least recently used objects above capacity and destroys evicted objects as soon as the execution which last
+     * used them has completed GPU-side.
+     *
+     * find() is lock-free. insert() and trim() must be serialized by the owner. Objects which are being evicted must not be
+     * looked up concurrently; in practice, both lookups and trim() happen from within VKFrameGraph::execute().
+     */
+    template<typename KeyType, typename ObjectUniquePtrType, typename HashType = std::hash<KeyType> >
+    class VKLRUCache
+    {
+    public:
+        /* Public type definitions */
+        typedef typename ObjectUniquePtrType::element_type ObjectType;
+
+        /* Returns false if the object must be kept around, even if it has not been used recently. */
+        typedef std::function<bool(const ObjectType* in_object_ptr)> IsEvictableFunc;
+
+        /* Public functions */
+        VKLRUCache(const uint32_t& in_capacity)
+            :m_capacity          (in_capacity),
+             m_n_evictions       (0),
+             m_n_hits            (0),
+             m_n_misses          (0),
+             m_n_pending_releases(0),
+             m_n_releases        (0)
+        {
+            vkgl_assert(in_capacity > 0);
+        }
+
+        ~VKLRUCache()
+        {
+            /* Stub */
+        }
+
+        ObjectType* find(const KeyType&  in_key,
+                         const uint64_t& in_timeline_value)
+        {
+            Entry*      entry_ptr  = nullptr;
+            ObjectType* result_ptr = nullptr;
+
+            if (m_entry_ptr_map.find(in_key,
+                                    &entry_ptr) )
+            {
+                uint64_t last_used_timeline_value = entry_ptr->last_used_timeline_value.load(std::memory_order_relaxed);
+
+                while (last_used_timeline_value < in_timeline_value &&
+                       !entry_ptr->last_used_timeline_value.compare_exchange_weak(last_used_timeline_value,
+                                                                                  in_timeline_value,
+                                                                                  std::memory_order_relaxed) )
+                {
+                    /* Stub */
+                }
+
+                m_n_hits.fetch_add(1,
+                                   std::memory_order_relaxed);
+
+                result_ptr = entry_ptr->object_ptr.get();
+            }
+
+            return result_ptr;
+        }
+
+        ObjectType* insert(const KeyType&      in_key,
+                           ObjectUniquePtrType in_object_ptr,
+                           const uint64_t&     in_timeline_value)
+        {
+            std::unique_ptr<Entry> entry_ptr(new Entry(in_key,
+                                                       std::move(in_object_ptr),
+                                                       in_timeline_value) );
+            ObjectType*            result_ptr(entry_ptr->object_ptr.get() );
+
+            vkgl_assert(result_ptr != nullptr);
+
+            if (!m_entry_ptr_map.insert(in_key,
+                                        entry_ptr.get() ))
+            {
+                vkgl_assert_fail();
+            }
+
+            m_entry_ptrs.push_back(std::move(entry_ptr) );
+
+            m_n_misses.fetch_add(1,
+                                 std::memory_order_relaxed);
+
+            return result_ptr;
+        }
+
+        /* Returns counters accumulated since the previous call and resets them. */
+        OpenGL::VKCacheStats pop_stats()
+        {
+            OpenGL::VKCacheStats result;
+
+            result.n_entries          = m_entry_ptr_map.get_n_entries();
+            result.n_entries_max      = m_capacity;
+            result.n_evictions        = m_n_evictions.exchange   (0);
+            result.n_hits             = m_n_hits.exchange        (0);
+            result.n_misses           = m_n_misses.exchange      (0);
+            result.n_pending_releases = m_n_pending_releases.load();
+            result.n_releases         = m_n_releases.exchange    (0);
+
+            return result;
+        }
+
+        /* Evicts least recently used objects, until no more than capacity objects are left in the cache (or no other objects
+         * can be evicted), and destroys evicted objects which have not been used by any execution that's still in flight.
+         *
+         * @param in_completed_timeline_value Last frame graph timeline value known to have completed GPU-side.
+         * @param in_opt_is_evictable_func    If not null, only objects for which the func returns true are evicted.
+         */
+        void trim(const uint64_t&        in_completed_timeline_value,
+                  const IsEvictableFunc& in_opt_is_evictable_func = nullptr)
+        {
+            /* 1. Evict */
+            if (m_entry_ptrs.size() > m_capacity)
+            {
+                uint32_t n_entries_to_evict = static_cast<uint32_t>(m_entry_ptrs.size() ) - m_capacity;
+
+                std::sort(m_entry_ptrs.begin(),
+                          m_entry_ptrs.end  (),
+                          [](const std::unique_ptr<Entry>& in_entry1_ptr,
+                             const std::unique_ptr<Entry>& in_entry2_ptr)
+                          {
+                              return in_entry1_ptr->last_used_timeline_value.load(std::memory_order_relaxed) <
+                                     in_entry2_ptr->last_used_timeline_value.load(std::memory_order_relaxed);
+                          });
+
+                for (auto entry_iterator  = m_entry_ptrs.begin();
+                          entry_iterator != m_entry_ptrs.end() && n_entries_to_evict > 0;
+                         )
+                {
+                    if (in_opt_is_evictable_func != nullptr                              &&
+                        !in_opt_is_evictable_func((*entry_iterator)->object_ptr.get() ) )
+                    {
+                        ++entry_iterator;
+
+                        continue;
+                    }
+
+                    m_entry_ptr_map.erase         ((*entry_iterator)->key);
+                    m_evicted_entry_ptrs.push_back(std::move(*entry_iterator) );
+
+                    entry_iterator = m_entry_ptrs.erase(entry_iterator);
+
+                    m_n_evictions++;
+                    n_entries_to_evict--;
+                }
+            }
+
+            /* 2. Release evicted objects the GPU is done with. */
+            if (m_evicted_entry_ptrs.size() > 0)
+            {
+                const auto n_evicted_entries_before = m_evicted_entry_ptrs.size();
+
+                m_evicted_entry_ptrs.erase(std::remove_if(m_evicted_entry_ptrs.begin(),
+                                                          m_evicted_entry_ptrs.end  (),
+                                                          [&in_completed_timeline_value](const std::unique_ptr<Entry>& in_entry_ptr)
+                                                          {
+                                                              return in_entry_ptr->last_used_timeline_value.load(std::memory_order_relaxed) <= in_completed_timeline_value;
+                                                          }),
+                                           m_evicted_entry_ptrs.end() );
+
+                m_n_releases += static_cast<uint32_t>(n_evicted_entries_before - m_evicted_entry_ptrs.size() );
+            }
+
+            m_n_pending_releases = static_cast<uint32_t>(m_evicted_entry_ptrs.size() );
+        }
+
+    private:
+        /* Private type definitions */
+        typedef struct Entry
+        {
+            const KeyType         key;
+            std::atomic<uint64_t> last_used_timeline_value;
+            ObjectUniquePtrType   object_ptr;
+
+            Entry(const KeyType&      in_key,
+                  ObjectUniquePtrType in_object_ptr,
+                  const uint64_t&     in_timeline_value)
+                :key                     (in_key),
+                 last_used_timeline_value(in_timeline_value),
+                 object_ptr              (std::move(in_object_ptr) )
+            {
+                /* Stub */
+            }
+        } Entry;
+
+        /* Private functions */
+        VKLRUCache           (const VKLRUCache&);
+        VKLRUCache& operator=(const VKLRUCache&);
+
+        /* Private variables */
+        const uint32_t m_capacity;
+
+        VKGL::ReadMostlyHashMap<KeyType, Entry*, HashType> m_entry_ptr_map;
+        std::vector<std::unique_ptr<Entry> >               m_entry_ptrs;         //< Owns cached objects.
+        std::vector<std::unique_ptr<Entry> >               m_evicted_entry_ptrs; //< Owns evicted objects until the GPU is done with them.
+
+        std::atomic<uint32_t> m_n_evictions;
+        std::atomic<uint32_t> m_n_hits;
+        std::atomic<uint32_t> m_n_misses;
+        std::atomic<uint32_t> m_n_pending_releases;
+        std::atomic<uint32_t> m_n_releases;
+    };
+};
+
+#endif /* VKGL_VK_LRU_CACHE_H */
@@ -11,28 +11,48 @@
 #include "Anvil/include/misc/types.h"
 #include "OpenGL/reference.h"
 #include <chrono>
+#include <utility>
 
 namespace OpenGL
 {
+    /* Identifies the region of a VK buffer which backs a GL buffer snapshot.
+     *
+     * Small GL buffers are sub-allocated out of shared VK buffers, so the VK buffer instance alone is not enough to tell
+     * two GL buffers apart. Regions handed out by the backend never overlap, hence the start offset is sufficient.
+     */
+    typedef std::pair<const Anvil::Buffer*, VkDeviceSize> VKBufferRegionKey;
+
     typedef struct VKBufferPayload
     {
         OpenGL::TimeMarker  backend_buffer_creation_time_marker;
+        VkDeviceSize        buffer_offset; //< Start of the region within buffer_ptr which holds the GL buffer's storage.
         Anvil::Buffer*      buffer_ptr;
+        VkDeviceSize        buffer_size;   //< Size of the region within buffer_ptr which holds the GL buffer's storage.
         OpenGL::TimeMarker  frontend_object_creation_time_marker;
         GLuint              id;
 
         VKBufferPayload(const GLuint&             in_id,
                               const OpenGL::TimeMarker& in_frontend_object_creation_time_marker,
                               Anvil::Buffer*            in_buffer_ptr,
+                              const VkDeviceSize&       in_buffer_offset,
+                              const VkDeviceSize&       in_buffer_size,
                               const OpenGL::TimeMarker& in_backend_buffer_creation_time_marker)
            :backend_buffer_creation_time_marker   (in_backend_buffer_creation_time_marker),
+            buffer_offset                         (in_buffer_offset),
             buffer_ptr                            (in_buffer_ptr),
+            buffer_size                           (in_buffer_size),
             frontend_object_creation_time_marker  (in_frontend_object_creation_time_marker),
             id                                    (in_id)
         {
             /* Stub */
         }
 
+        VKBufferRegionKey get_region_key() const
+        {
+            return VKBufferRegionKey(buffer_ptr,
+                                     buffer_offset);
+        }
+
         bool operator==(const VKBufferPayload& in_ref) const
         {
             return (id                                     == in_ref.id                                     &&
@@ -5,7 +5,7 @@
 #ifndef VKGL_VK_RENDERPASS_MANAGER_H
 #define VKGL_VK_RENDERPASS_MANAGER_H
 
-#include "Common/shared_mutex.h"
+#include "OpenGL/backend/vk_lru_cache.h"
 #include "OpenGL/types.h"
 
 namespace OpenGL
@@ -21,23 +21,56 @@ namespace OpenGL
 
         ~VKRenderpassManager();
 
-        Anvil::RenderPass* get_render_pass(Anvil::RenderPassCreateInfoUniquePtr in_rp_create_info_ptr);
+        /* Returns a cached renderpass matching the create info, creating one if needed. @param in_timeline_value is the frame
+         * graph timeline value of the execution which is going to use the renderpass.
+         */
+        Anvil::RenderPass* get_render_pass(Anvil::RenderPassCreateInfoUniquePtr in_rp_create_info_ptr,
+                                           const uint64_t&                      in_timeline_value);
+
+        /* Returns cache counters accumulated since the previous call and resets them. */
+        OpenGL::VKCacheStats pop_frame_stats();
+
+        /* Framebuffers and pipelines reference the renderpass they were created for. Referenced renderpasses are never evicted. */
+        void reference_render_pass(const Anvil::RenderPass* in_rp_ptr);
+        void release_render_pass  (const Anvil::RenderPass* in_rp_ptr);
+
+        /* Evicts least recently used renderpasses above the cache capacity. See VKLRUCache::trim(). */
+        void trim(const uint64_t& in_completed_timeline_value);
 
         static RenderPassHash get_rp_hash     (const Anvil::RenderPassCreateInfo* in_rp_create_info_ptr);
         static bool           is_rp_compatible(const Anvil::RenderPassCreateInfo* in_rp1_create_info_ptr,
                                                const Anvil::RenderPassCreateInfo* in_rp2_create_info_ptr);
 
     private:
+        /* Private type definitions */
+
+        /* (compatibility hash, attachment ops hash) */
+        typedef std::pair<RenderPassHash, RenderPassHash> RenderPassKey;
+
+        typedef struct RenderPassKeyHash
+        {
+            size_t operator()(const RenderPassKey& in_key) const
+            {
+                return static_cast<size_t>(in_key.first ^ (in_key.second * 0x9E3779B97F4A7C15ull) );
+            }
+        } RenderPassKeyHash;
+
         /* Private functions */
         VKRenderpassManager(IBackend* in_backend_ptr);
 
+        /* Hashes the attachment properties get_rp_hash() ignores (load/store ops, initial/final layouts). Compatible renderpasses
+         * which differ in any of these cannot be used interchangeably with vkCmdBeginRenderPass().
+         */
+        static RenderPassHash get_rp_attachment_ops_hash(const Anvil::RenderPassCreateInfo* in_rp_create_info_ptr);
+
         /* Private variables */
         IBackend* const m_backend_ptr;
 
-        std::unordered_map<RenderPassHash, Anvil::RenderPass*> m_renderpass_ptr_map;
-        std::vector<Anvil::RenderPassUniquePtr>                m_renderpass_ptrs;
-        VKGL::SharedMutex                                      m_rw_mutex;
+        std::mutex                                                                m_create_mutex; //< Serializes RP creation & eviction. Lookups are lock-free.
+        VKLRUCache<RenderPassKey, Anvil::RenderPassUniquePtr, RenderPassKeyHash> m_renderpass_cache;
 
+        std::unordered_map<const Anvil::RenderPass*, uint32_t> m_n_references_per_renderpass;
+        std::mutex                                             m_references_mutex;
     };
 };
 
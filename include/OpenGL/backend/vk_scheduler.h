@@ -33,6 +33,9 @@ namespace OpenGL
         void main_thread_entrypoint();
         void process_command       (OpenGL::CommandBaseUniquePtr in_command_ptr);
 
+        void prepare_program_for_deferred_draw(const OpenGL::GLProgramReference*      in_program_reference_ptr,
+                                               const OpenGL::GLContextStateReference* in_state_reference_ptr);
+
         void process_buffer_data_command                (OpenGL::CommandBaseUniquePtr            in_command_ptr);
         void process_buffer_sub_data_command            (OpenGL::CommandBaseUniquePtr            in_command_ptr);
         void process_clear_command                      (OpenGL::ClearCommand*                   in_command_ptr);
@@ -53,7 +56,6 @@ namespace OpenGL
         void process_draw_range_elements_command        (OpenGL::DrawRangeElementsCommand*       in_command_ptr);
         void process_finish_command                     (OpenGL::FinishCommand*                  in_command_ptr);
         void process_flush_command                      (OpenGL::FlushCommand*                   in_command_ptr);
-        void process_flush_mapped_buffer_range_command  (OpenGL::FlushMappedBufferRangeCommand*  in_command_ptr);
         void process_get_buffer_sub_data_command        (OpenGL::GetBufferSubDataCommand*        in_command_ptr);
         void process_get_compressed_tex_image_command   (OpenGL::GetCompressedTexImageCommand*   in_command_ptr);
         void process_get_texture_image_command          (OpenGL::GetTextureImageCommand*         in_command_ptr);
@@ -75,7 +77,9 @@ namespace OpenGL
         /* Private variables */
         IBackend*                                                m_backend_ptr;
         std::unique_ptr<VKGL::RingBuffer<CommandBaseUniquePtr> > m_command_ring_buffer_ptr;
+        uint64_t                                                 m_deferred_draw_wait_time_us; //< Scheduler thread only.
         const IContextObjectManagers*                            m_frontend_ptr;
+        uint32_t                                                 m_n_deferred_draws;           //< Scheduler thread only.
         std::unique_ptr<std::thread>                             m_scheduler_thread_ptr;
         std::atomic_bool                                         m_terminating;
     };
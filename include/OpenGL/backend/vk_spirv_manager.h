@@ -17,11 +17,28 @@
 #include "Anvil/include/misc/types.h"
 #include "Anvil/include/wrappers/descriptor_set_group.h"
 #include "Common/fence.h"
-#include "Common/shared_mutex.h"
+#include "Common/read_mostly_hash_map.h"
 #include "OpenGL/types.h"
+#include <atomic>
 
 namespace OpenGL
 {
+    typedef struct VKSPIRVManagerStats
+    {
+        uint32_t n_program_link_cache_hits;  //< Program links served from the link cache since the previous call.
+        uint32_t n_program_links;            //< glslang program links since the previous call.
+        uint32_t n_shader_module_cache_hits; //< Shader modules shared with other programs since the previous call.
+        uint32_t n_shader_modules_created;   //< vkCreateShaderModule() calls since the previous call.
+
+        VKSPIRVManagerStats()
+        {
+            n_program_link_cache_hits  = 0;
+            n_program_links            = 0;
+            n_shader_module_cache_hits = 0;
+            n_shader_modules_created   = 0;
+        }
+    } VKSPIRVManagerStats;
+
     class VKSPIRVManager
     {
     public:
@@ -32,6 +49,7 @@ namespace OpenGL
 
         ~VKSPIRVManager();
 
+        /* Block until the link (compilation) finishes. Use the completion status getters below to poll instead. */
         bool get_program_link_status                (const SPIRVBlobID&        in_spirv_blob_id,
                                                      bool*                     out_status_ptr,
                                                      const char**              out_link_log_ptr) const;
@@ -39,6 +57,12 @@ namespace OpenGL
                                                      bool*                     out_status_ptr,
                                                      const char**              out_compilation_log_ptr) const;
 
+        /* Never block (GL_COMPLETION_STATUS_KHR). */
+        bool get_program_link_completion_status     (const SPIRVBlobID&        in_spirv_blob_id,
+                                                     bool*                     out_is_complete_ptr) const;
+        bool get_shader_compilation_completion_status(const SPIRVBlobID&       in_spirv_blob_id,
+                                                      bool*                    out_is_complete_ptr) const;
+
         bool get_shader_module_ptr                  (const SPIRVBlobID&        in_spirv_blob_id,
                                                      const OpenGL::ShaderType& in_shader_type,
                                                      Anvil::ShaderModule**     out_result_ptr_ptr) const;
@@ -54,6 +78,16 @@ namespace OpenGL
         											const OpenGL::PostLinkData* in_post_link_data_ptr);
         std::vector<OpenGL::UniformResource>* get_uniform_resources(const SPIRVBlobID&        in_spirv_blob_id) const;
         Anvil::DescriptorSetGroup* 				get_descriptor_set_group(const SPIRVBlobID&        in_spirv_blob_id) const;
+        OpenGL::VKSPIRVManagerStats pop_frame_stats();
+
+        /* Builds uniform resources of the program used by a draw call & points its samplers at textures bound in
+         * in_state_reference_ptr. If in_wait_for_link is false and the program is still being linked, returns false
+         * without doing anything.
+         */
+        bool prepare_program_for_draw(const OpenGL::GLProgramReference*      in_program_reference_ptr,
+                                      const OpenGL::GLContextStateReference* in_state_reference_ptr,
+                                      const bool&                            in_wait_for_link);
+
         SPIRVBlobID register_program  (OpenGL::GLProgramReferenceUniquePtr in_program_reference_ptr);
         SPIRVBlobID register_shader   (const OpenGL::ShaderType&           in_shader_type,
                                        const char*                         in_glsl);
@@ -71,6 +105,7 @@ namespace OpenGL
             SPIRVBlobID                       id;
             const char*                       sm_entrypoint_name;
             std::vector<uint8_t>              spirv_blob;
+            uint64_t                          spirv_blob_hash; //< Only valid if the shader compiled successfully.
             OpenGL::ShaderType                type;
 
             ShaderData(const SPIRVBlobID&        in_id,
@@ -84,17 +119,92 @@ namespace OpenGL
 
         typedef std::unique_ptr<ShaderData> ShaderDataUniquePtr;
 
+        /* Outcome of a glslang program link, shared by all programs whose shaders produced the same SPIR-V and which
+         * use the same pre-link state. See link_program() for details.
+         */
+        typedef struct LinkedProgram
+        {
+            std::string                          link_log;
+            bool                                 link_status;
+            OpenGL::PostLinkData                 post_link_data;
+            VKGL::FenceUniquePtr                 ready_fence_ptr; //< Signalled once the fields above have been filled.
+            std::shared_ptr<Anvil::ShaderModule> shader_module_ptrs[static_cast<uint32_t>(OpenGL::ShaderType::Count)];
+
+            LinkedProgram();
+
+        private:
+            ANVIL_DISABLE_ASSIGNMENT_OPERATOR(LinkedProgram);
+            ANVIL_DISABLE_COPY_CONSTRUCTOR   (LinkedProgram);
+        } LinkedProgram;
+
+        /* Identifies the outcome of a program link. items holds the number of shaders, a (shader type, SPIR-V size, SPIR-V
+         * hash) triple for each shader in sorted order, followed by hashed pre-link state. The SPIR-V blobs are stored in
+         * the same order and compared on lookup, so that a hash collision cannot hand out another program's link result.
+         */
+        typedef struct LinkKey
+        {
+            std::vector<uint64_t>             items;
+            std::vector<std::vector<uint8_t>> spirv_blobs;
+
+            bool operator==(const LinkKey& in_key) const
+            {
+                return (items       == in_key.items &&
+                        spirv_blobs == in_key.spirv_blobs);
+            }
+        } LinkKey;
+
+        typedef struct LinkKeyHash
+        {
+            size_t operator()(const LinkKey& in_key) const
+            {
+                uint64_t result = 0xcbf29ce484222325ull;
+
+                for (const auto& current_item : in_key.items)
+                {
+                    result = (result ^ current_item) * 0x100000001b3ull;
+                }
+
+                return static_cast<size_t>(result);
+            }
+        } LinkKeyHash;
+
+        /* Identifies a shader module. As with LinkKey, the SPIR-V blob is stored and compared on lookup. */
+        typedef struct ShaderModuleKey
+        {
+            std::string           entrypoint_name;
+            uint64_t              hash; //< Covers all the fields below.
+            std::vector<uint32_t> spirv_blob;
+            OpenGL::ShaderType    type;
+
+            bool operator==(const ShaderModuleKey& in_key) const
+            {
+                return (hash            == in_key.hash            &&
+                        type            == in_key.type            &&
+                        entrypoint_name == in_key.entrypoint_name &&
+                        spirv_blob      == in_key.spirv_blob);
+            }
+        } ShaderModuleKey;
+
+        typedef struct ShaderModuleKeyHash
+        {
+            size_t operator()(const ShaderModuleKey& in_key) const
+            {
+                return static_cast<size_t>(in_key.hash);
+            }
+        } ShaderModuleKeyHash;
+
         typedef struct ProgramData
         {
-            SPIRVBlobID                  id;
-            std::string                  link_log;
-            bool                         link_status;
-            VKGL::FenceUniquePtr         link_task_fence_ptr;
-            GLuint                       program_id;
-            Anvil::ShaderModuleUniquePtr shader_module_ptrs[static_cast<uint32_t>(OpenGL::ShaderType::Count)];
-            std::vector<ShaderData*>     shader_ptrs;
-            std::vector<uint8_t>         spirv_blobs[static_cast<uint32_t>(OpenGL::ShaderType::Count)];
+            SPIRVBlobID                          id;
+            std::string                          link_log;
+            bool                                 link_status;
+            VKGL::FenceUniquePtr                 link_task_fence_ptr;
+            std::shared_ptr<LinkedProgram>       linked_program_ptr;
+            GLuint                               program_id;
+            std::shared_ptr<Anvil::ShaderModule> shader_module_ptrs[static_cast<uint32_t>(OpenGL::ShaderType::Count)];
+            std::vector<ShaderData*>             shader_ptrs;
             std::vector<OpenGL::UniformResource>		uniform_resources;
+            std::mutex                           uniform_resources_mutex; //< Draws of programs which were still being linked get prepared by the scheduler.
             bool 						need_rebuild_uniform_resources;
             Anvil::DescriptorSetGroupUniquePtr descriptor_set_group_ptr;
 
@@ -114,6 +224,17 @@ namespace OpenGL
 
         typedef std::unique_ptr<ProgramData> ProgramDataUniquePtr;
 
+        typedef std::pair<GLuint, OpenGL::TimeMarker> ProgramReference;
+
+        typedef struct ProgramReferenceHash
+        {
+            size_t operator()(const ProgramReference& in_reference) const
+            {
+                return std::hash<GLuint>  ()(in_reference.first) ^
+                       std::hash<uint64_t>()(static_cast<uint64_t>(in_reference.second.time_since_epoch().count() ) * 0x9E3779B97F4A7C15ull);
+            }
+        } ProgramReferenceHash;
+
         /* Private functions */
         VKSPIRVManager(IBackend*                             in_backend_ptr,
                        const OpenGL::IContextObjectManagers* in_frontend_ptr);
@@ -121,6 +242,20 @@ namespace OpenGL
         void compile_shader(ShaderData*  in_shader_data_ptr);
         void link_program  (ProgramData* in_program_data_ptr);
 
+        bool get_link_key             (const ProgramData* in_program_data_ptr,
+                                       LinkKey*           out_link_key_ptr) const;
+        void link_program_with_glslang(const ProgramData* in_program_data_ptr,
+                                       LinkedProgram*     out_linked_program_ptr);
+
+        std::shared_ptr<Anvil::ShaderModule> get_shader_module(const OpenGL::ShaderType&    in_shader_type,
+                                                               const char*                  in_entrypoint_name,
+                                                               const std::vector<uint32_t>& in_spirv_blob);
+
+        static void release_program_data(void* in_program_data_ptr);
+
+        bool update_texture_references_for_uniform_resources(const SPIRVBlobID&                     in_spirv_blob_id,
+                                                             const OpenGL::GLContextStateReference* in_state_reference_ptr);
+
         void patch_glsl_code            (const ShaderData* in_shader_data_ptr,
                                          std::string&      inout_glsl_code) const;
         void restore_glsl_symbol_names(std::string&      inout_glsl_code) const;
@@ -134,14 +269,35 @@ namespace OpenGL
         bool init                  ();
         bool init_glslang_resources();
 
-        IBackend*                                                     m_backend_ptr;
-        const OpenGL::IContextObjectManagers*                         m_frontend_ptr;
-        std::unordered_map<std::string, ShaderDataUniquePtr>          m_glsl_to_shader_data_map;
-        mutable VKGL::SharedMutex                                     m_mutex;
-        uint32_t                                                      m_n_entities_registered;
-        std::map<std::pair<GLuint, OpenGL::TimeMarker>, ProgramData*> m_program_reference_to_program_data_map;
-        std::unordered_map<SPIRVBlobID, ProgramDataUniquePtr>         m_spirv_blob_id_to_program_data_map;
-        std::unordered_map<SPIRVBlobID, ShaderData*>                  m_spirv_blob_id_to_shader_data_map;
+        IBackend*                                                                     m_backend_ptr;
+        const OpenGL::IContextObjectManagers*                                         m_frontend_ptr;
+        uint32_t                                                                      m_n_entities_registered;
+
+        /* Lookups go through the read-mostly maps below and never take a lock. ProgramData instances may be read by other
+         * threads after unregister_program() removes them from the maps, so they are released via VKGL::Epoch. Readers
+         * which dereference ShaderData or ProgramData must do so from within a VKGL::EpochReadLock scope.
+         */
+        VKGL::ReadMostlyHashMap<std::string, ShaderData*>                             m_glsl_to_shader_data_map;
+        VKGL::ReadMostlyHashMap<ProgramReference, ProgramData*, ProgramReferenceHash> m_program_reference_to_program_data_map;
+        VKGL::ReadMostlyHashMap<SPIRVBlobID, ProgramData*>                            m_spirv_blob_id_to_program_data_map;
+        VKGL::ReadMostlyHashMap<SPIRVBlobID, ShaderData*>                             m_spirv_blob_id_to_shader_data_map;
+
+        std::unordered_map<SPIRVBlobID, ProgramDataUniquePtr> m_program_data_ptrs; //< Owns registered programs. Guarded by m_writer_mutex.
+        std::vector<ShaderDataUniquePtr>                      m_shader_data_ptrs;  //< Owns registered shaders. Guarded by m_writer_mutex.
+        std::mutex                                            m_writer_mutex;
+
+        /* Link results & shader modules are owned by the programs which use them. The caches only hold weak references,
+         * and the deleters remove the entries, so that they go away together with the last program using them. Both maps
+         * are guarded by m_link_cache_mutex.
+         */
+        std::unordered_map<LinkKey,         std::weak_ptr<LinkedProgram>,       LinkKeyHash>         m_link_key_to_linked_program_map;
+        std::mutex                                                                                   m_link_cache_mutex;
+        std::unordered_map<ShaderModuleKey, std::weak_ptr<Anvil::ShaderModule>, ShaderModuleKeyHash> m_shader_module_key_to_shader_module_map;
+
+        std::atomic<uint32_t> m_n_program_link_cache_hits;
+        std::atomic<uint32_t> m_n_program_links;
+        std::atomic<uint32_t> m_n_shader_module_cache_hits;
+        std::atomic<uint32_t> m_n_shader_modules_created;
 
         std::unique_ptr<struct TBuiltInResource> m_glslang_resources_ptr;
     };
@@ -15,6 +15,15 @@ namespace OpenGL
 
     /* NOTE: Swapchains may need to be re-created at frame acquisition time (in case WGL settings such as swap interval)
      *       are changed, or if window is resized.
+     *
+     * Headless mode: if VKGL_HEADLESS=<width>x<height> is set in the environment, the window handle specified by the app
+     * is ignored and the default framebuffer is backed by Anvil's off-screen swapchain emulation instead. No surface is
+     * created and no WSI calls are made. Swapchain images are plain images acquired in a round-robin fashion, and
+     * presentation only waits on the frame's semaphores. This lets the library run with software ICDs (lavapipe,
+     * SwiftShader) and on machines without a display.
+     *
+     * If VKGL_HEADLESS_DUMP=<prefix> is also set, each presented frame is read back and stored as <prefix>_<n>.ppm.
+     * The readback stalls the pipeline, so leave it off when timing.
      */
     class VKSwapchainManager : public IStateSnapshotAccessors
     {
@@ -34,7 +43,7 @@ namespace OpenGL
                                                                        const uint32_t&           in_n_swapchain_image);
         Anvil::Queue*                 get_presentable_queue           (const OpenGL::TimeMarker& in_time_marker);
         OpenGL::TimeMarker            get_tot_time_marker             ()                                          const;
-        Anvil::SemaphoreUniquePtr     pop_frame_acquisition_semaphore (const OpenGL::TimeMarker& in_time_marker); //< deleter automatically resets & pushes the sem back to cache.
+        Anvil::SemaphoreUniquePtr     pop_frame_acquisition_semaphore ();                                         //< deleter automatically pushes the sem back to the sync object pool.
 
         /* NOTE: Schedules swapchain recreation at next swapchain acquisition time. This should be leveraged
          *       whenever swapchain becomes suboptimal or out-of-date (which can happen if, for example, parent
@@ -47,6 +56,16 @@ namespace OpenGL
             return m_n_swapchain_images;
         }
 
+        bool is_headless() const
+        {
+            return (m_headless_width != 0);
+        }
+
+        /* Called by the presentation node, right after a presentation request for the specified swapchain image has been
+         * submitted.
+         */
+        void on_swapchain_image_presented(Anvil::Swapchain* in_swapchain_ptr,
+                                          const uint32_t&   in_n_swapchain_image);
 
         void set_swap_interval(const int32_t& in_swap_interval);
 
@@ -67,7 +86,6 @@ namespace OpenGL
         {
             std::vector<Anvil::ImageUniquePtr>     ds_image_ptrs;
             std::vector<Anvil::ImageViewUniquePtr> ds_image_view_ptrs;
-            std::vector<Anvil::SemaphoreUniquePtr> frame_acquisition_semaphore_ptrs;
             uint32_t                               n_last_returned_presentable_queue;
             std::vector<Anvil::Queue*>             presentable_queue_ptrs;
             Anvil::RenderingSurfaceUniquePtr       rendering_surface_ptr;
@@ -83,7 +101,6 @@ namespace OpenGL
                                   Anvil::SwapchainUniquePtr               in_swapchain_ptr,
                                   Anvil::WindowUniquePtr                  in_window_ptr,
                                   const std::vector<Anvil::Queue*>&       in_presentable_queue_ptrs,
-                                  std::vector<Anvil::SemaphoreUniquePtr>& inout_frame_acquisition_semaphore_ptrs,
                                   std::vector<Anvil::ImageUniquePtr>&     inout_ds_image_ptrs,
                                   std::vector<Anvil::ImageViewUniquePtr>& inout_ds_image_view_ptrs)
                 :n_last_returned_presentable_queue(0),
@@ -98,9 +115,8 @@ namespace OpenGL
                 vkgl_assert(in_presentable_queue_ptrs.size() != 0);
                 vkgl_assert(inout_ds_image_ptrs.size      () == inout_ds_image_view_ptrs.size() );
 
-                ds_image_ptrs                    = std::move(inout_ds_image_ptrs);
-                ds_image_view_ptrs               = std::move(inout_ds_image_view_ptrs);
-                frame_acquisition_semaphore_ptrs = std::move(inout_frame_acquisition_semaphore_ptrs);
+                ds_image_ptrs      = std::move(inout_ds_image_ptrs);
+                ds_image_view_ptrs = std::move(inout_ds_image_view_ptrs);
             }
 
             ~InternalSwapchainData()
@@ -153,11 +169,12 @@ namespace OpenGL
                                                              std::vector<Anvil::ImageViewUniquePtr>& out_ds_image_view_ptrs) const;
         InternalSwapchainDataUniquePtr create_swapchain     (const SwapchainPropsSnapshot*           in_swapchain_props_ptr,
                                                              InternalSwapchainDataUniquePtr          in_opt_former_swapchain_data_ptr) const;
+        bool                           dump_headless_frame  (Anvil::Swapchain*                       in_swapchain_ptr,
+                                                             const uint32_t&                         in_n_swapchain_image,
+                                                             const std::string&                      in_file_name)           const;
         bool                           init                 ();
 
-        void                           on_all_swapchain_snapshots_out_of_scope    ();
-        void                           on_frame_acquisition_semaphore_out_of_scope(InternalSwapchainData* in_swapchain_data_ptr,
-                                                                                   Anvil::Semaphore*      in_sem_ptr);
+        void                           on_all_swapchain_snapshots_out_of_scope();
 
         Anvil::PresentModeKHR  get_present_mode_for_swapchain_props(const SwapchainPropsSnapshot*  in_swapchain_props_ptr,
                                                                     const Anvil::RenderingSurface* in_surface_ptr)         const;
@@ -175,6 +192,11 @@ namespace OpenGL
         const uint32_t                      m_n_swapchain_images;
         const VKGL::PixelFormatRequirements m_pixel_format_reqs;
         bool                                m_should_recreate_swapchain;
+
+        std::string m_headless_dump_file_prefix; //< Empty if presented frames should not be stored.
+        uint32_t    m_headless_height;
+        uint32_t    m_headless_width;            //< 0 if headless mode is disabled.
+        uint32_t    m_n_headless_frames_dumped;
     };
 }
 
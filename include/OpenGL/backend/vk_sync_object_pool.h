@@ -0,0 +1,92 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_VK_SYNC_OBJECT_POOL_H
+#define VKGL_VK_SYNC_OBJECT_POOL_H
+
+#include "Anvil/include/misc/types.h"
+#include "OpenGL/types.h"
+#include <mutex>
+
+namespace OpenGL
+{
+    typedef struct VKSyncObjectPoolStats
+    {
+        uint32_t n_events_created;        //< vkCreateEvent() calls.
+        uint32_t n_events_recycled;       //< Event requests served from the pool.
+        uint32_t n_events_in_use_max;     //< High-water mark of events handed out at the same time.
+        uint32_t n_fences_created;        //< vkCreateFence() calls.
+        uint32_t n_fences_recycled;       //< Fence requests served from the pool.
+        uint32_t n_fences_in_use_max;     //< High-water mark of fences handed out at the same time.
+        uint32_t n_semaphores_created;    //< vkCreateSemaphore() calls.
+        uint32_t n_semaphores_recycled;   //< Semaphore requests served from the pool.
+        uint32_t n_semaphores_in_use_max; //< High-water mark of semaphores handed out at the same time.
+
+        VKSyncObjectPoolStats()
+        {
+            n_events_created        = 0;
+            n_events_recycled       = 0;
+            n_events_in_use_max     = 0;
+            n_fences_created        = 0;
+            n_fences_recycled       = 0;
+            n_fences_in_use_max     = 0;
+            n_semaphores_created    = 0;
+            n_semaphores_recycled   = 0;
+            n_semaphores_in_use_max = 0;
+        }
+    } VKSyncObjectPoolStats;
+
+    /* Hands out events, fences and semaphores, recycling the ones which have been released instead of destroying them.
+     *
+     * Deleters of the returned objects put them back to the pool, so callers only need to make sure an object goes out of
+     * scope after the GPU is done with it (which is when ActiveSubmission entries are retired by the frame graph):
+     *
+     * - events and fences are reset when released.
+     * - semaphores are expected to have been waited on by the time they are released. This makes them unsignaled again, so
+     *   they are recycled as is.
+     *
+     * The pool grows on demand and is never trimmed. Objects acquired from the pool must not outlive it.
+     */
+    class VKSyncObjectPool
+    {
+    public:
+        /* Public functions */
+
+        static VKSyncObjectPoolUniquePtr create(IBackend* in_backend_ptr);
+
+        ~VKSyncObjectPool();
+
+        Anvil::EventUniquePtr     acquire_event    ();
+        Anvil::FenceUniquePtr     acquire_fence    ();
+        Anvil::SemaphoreUniquePtr acquire_semaphore();
+
+        /* Returns creation & recycling counters accumulated since the previous call and resets them. High-water marks are
+         * reported for the whole lifetime of the pool.
+         */
+        OpenGL::VKSyncObjectPoolStats pop_frame_stats();
+
+    private:
+        /* Private functions */
+        VKSyncObjectPool(IBackend* in_backend_ptr);
+
+        void release_event    (Anvil::Event*     in_event_ptr);
+        void release_fence    (Anvil::Fence*     in_fence_ptr);
+        void release_semaphore(Anvil::Semaphore* in_semaphore_ptr);
+
+        /* Private variables */
+        IBackend* const m_backend_ptr;
+
+        std::vector<Anvil::EventUniquePtr>     m_free_event_ptrs;
+        std::vector<Anvil::FenceUniquePtr>     m_free_fence_ptrs;
+        std::vector<Anvil::SemaphoreUniquePtr> m_free_semaphore_ptrs;
+        uint32_t                               m_n_events_in_use;
+        uint32_t                               m_n_fences_in_use;
+        uint32_t                               m_n_semaphores_in_use;
+        OpenGL::VKSyncObjectPoolStats          m_stats;
+
+        std::mutex m_mutex;
+    };
+};
+
+#endif /* VKGL_VK_SYNC_OBJECT_POOL_H */
@@ -404,10 +404,10 @@ namespace OpenGL
                                         const GLsizeiptr&           in_length);
         void* map_buffer               (const OpenGL::BufferTarget& in_target,
                                         const OpenGL::BufferAccess& in_access);
-        void* map_buffer_range         (const OpenGL::BufferTarget& in_target,
-                                        const GLintptr&             in_offset,
-                                        const GLsizeiptr&           in_length,
-                                        const OpenGL::BufferAccess& in_access);
+        void* map_buffer_range         (const OpenGL::BufferTarget&  in_target,
+                                        const GLintptr&              in_offset,
+                                        const GLsizeiptr&            in_length,
+                                        const OpenGL::BufferMapBits& in_map_bits);
         bool  unmap_buffer             (const OpenGL::BufferTarget& in_target);
 
 
@@ -760,6 +760,7 @@ namespace OpenGL
                                              const OpenGL::HintMode&                  in_mode);
         void set_line_width                 (const float&                             in_width);
         void set_logic_op                   (const OpenGL::LogicOpMode&               in_mode);
+        void set_max_shader_compiler_threads(const GLuint&                            in_count);
         void set_pixel_store_property       (const OpenGL::PixelStoreProperty&        in_property,
                                              const OpenGL::GetSetArgumentType&        in_arg_type,
                                              const void*                              in_arg_value_ptr);
@@ -907,6 +908,7 @@ namespace OpenGL
         const OpenGL::IBackend*				m_backend_ptr;
 
         OpenGL::DispatchTable        m_dispatch_table;
+        GLuint                       m_max_shader_compiler_threads; //< As last set with glMaxShaderCompilerThreadsKHR().
         std::vector<std::string>     m_supported_extensions;
         const VKGL::IWSIContext*     m_wsi_context_ptr;
 
@@ -0,0 +1,374 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_GL_CAPTURE_H
+#define VKGL_GL_CAPTURE_H
+
+#include "OpenGL/types.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+/* GL command stream capture.
+ *
+ * Always compiled in, disabled by default. Enable with VKGL_CAPTURE=1 in the environment. There is no run-time toggle:
+ * a capture which does not start with the first GL call cannot be replayed. Calls are written to the file named by
+ * VKGL_CAPTURE_FILE (vkgl_capture.bin by default), which can be fed to OpenGL::GLReplayer.
+ *
+ * Every exported GL entry point opens a VKGL_GL_CAPTURE() scope listing its arguments. The argument list is only
+ * evaluated while capturing, so size computations cost nothing otherwise. Scalars are stored by value.
+ * Pointers are stored as plain values (which is what buffer offsets are), unless the entry point wraps them with one of
+ * the GLCapture* types below, to store the client memory they refer to. Non-const pointers are outputs: only their size
+ * is stored, and the replayer hands out scratch memory in their place. Calls made by VKGL itself from within an entry
+ * point are not captured.
+ *
+ * Limitations:
+ * - Client-side vertex & index arrays are not captured. Data must come from buffer objects.
+ * - Object names and uniform locations are not remapped. The replayer relies on VKGL handing out the same names
+ *   for the same sequence of calls. Sync objects are the exception, since they are pointers.
+ * - Writes to mapped buffer ranges are captured in full when the buffer is unmapped.
+ * - Calls are buffered per thread and written out in chunks, so calls issued concurrently from several threads end
+ *   up interleaved at chunk granularity.
+ *
+ * File layout (little endian):
+ *
+ *     GLCaptureFileHeader
+ *     Chunks: GLCaptureChunkHeader, followed by the payload. Payloads are padded to 8 bytes.
+ *
+ *     Entry_Point chunk: uint32_t id, NUL-terminated entry point name. Always precedes the first call which uses the ID.
+ *     Calls chunk:       A sequence of records. Each starts with uint32_t id & uint32_t n_bytes, followed by n_bytes of
+ *                        data. For calls, id is the entry point ID and the data holds the arguments in declaration
+ *                        order. Special records use the IDs from GLCaptureRecordID.
+ *     Frame_End chunk:   Empty. Written when the app presents a frame.
+ *
+ * Pointer arguments start with a GLCapturePointerKind byte:
+ *
+ *     Value:  uint64_t value.
+ *     Blob:   uint32_t n_bytes, padding up to an 8 byte offset within the chunk payload, then the data.
+ *     Output: uint32_t n_bytes.
+ *     Array:  uint32_t n_items, followed by n_items pointer arguments.
+ */
+namespace OpenGL
+{
+    static const char     g_gl_capture_file_magic[8] = {'V', 'K', 'G', 'L', 'C', 'A', 'P', '1'};
+    static const uint32_t g_gl_capture_file_version  = 1;
+
+    enum class GLCaptureChunkType : uint32_t
+    {
+        Calls,
+        Entry_Point,
+        Frame_End,
+    };
+
+    enum class GLCapturePointerKind : uint8_t
+    {
+        Value,
+        Blob,
+        Output,
+        Array,
+    };
+
+    enum GLCaptureRecordID : uint32_t
+    {
+        /* GLenum target, Blob data. Holds the contents of the range mapped for the target, and precedes the call which
+         * unmaps it.
+         */
+        GL_CAPTURE_RECORD_ID_MAPPED_WRITE = 0xFFFFFFFE,
+
+        /* uint64_t handle. Holds the sync object returned by the preceding call. */
+        GL_CAPTURE_RECORD_ID_SYNC_CREATED = 0xFFFFFFFD,
+
+        GL_CAPTURE_RECORD_ID_FIRST_SPECIAL = GL_CAPTURE_RECORD_ID_SYNC_CREATED
+    };
+
+    typedef struct GLCaptureFileHeader
+    {
+        char     magic[8];
+        uint32_t version;
+        uint32_t reserved;
+    } GLCaptureFileHeader;
+
+    typedef struct GLCaptureChunkHeader
+    {
+        GLCaptureChunkType type;
+        uint32_t           n_bytes; //< Excludes the padding.
+    } GLCaptureChunkHeader;
+
+    static_assert(sizeof(GLCaptureFileHeader)  % 8 == 0, "Chunk payloads must start at 8 byte offsets");
+    static_assert(sizeof(GLCaptureChunkHeader) % 8 == 0, "Chunk payloads must start at 8 byte offsets");
+
+    /* Client memory to store. A null pointer, or a zero size, stores the pointer's value instead. */
+    typedef struct GLCaptureBlob
+    {
+        const void* data_ptr;
+        size_t      n_bytes;
+
+        GLCaptureBlob(const void*   in_data_ptr,
+                      const size_t& in_n_bytes)
+            :data_ptr(in_data_ptr),
+             n_bytes (in_n_bytes)
+        {
+            /* Stub */
+        }
+    } GLCaptureBlob;
+
+    /* Output pointer, for which the default scratch size is not large enough. */
+    typedef struct GLCaptureOutput
+    {
+        const void* data_ptr;
+        size_t      n_bytes;
+
+        GLCaptureOutput(const void*   in_data_ptr,
+                        const size_t& in_n_bytes)
+            :data_ptr(in_data_ptr),
+             n_bytes (in_n_bytes)
+        {
+            /* Stub */
+        }
+    } GLCaptureOutput;
+
+    /* Array of pointers. Each item is stored as a string if in_strings is true, or by value otherwise. */
+    typedef struct GLCapturePointerArray
+    {
+        const GLint*       opt_lengths_ptr; //< Only used for strings. Negative lengths or a null array mean NUL-terminated.
+        uint32_t           n_items;
+        const void* const* items_ptr;
+        bool               strings;
+
+        GLCapturePointerArray(const GLsizei&     in_n_items,
+                              const void* const* in_items_ptr,
+                              const bool&        in_strings,
+                              const GLint*       in_opt_lengths_ptr = nullptr)
+            :opt_lengths_ptr(in_opt_lengths_ptr),
+             n_items        ((in_n_items > 0) ? static_cast<uint32_t>(in_n_items) : 0),
+             items_ptr      (in_items_ptr),
+             strings        (in_strings)
+        {
+            /* Stub */
+        }
+    } GLCapturePointerArray;
+
+    /* One instance per entry point, defined by VKGL_GL_CAPTURE(). Constant-initialized. */
+    typedef struct GLCaptureEntryPoint
+    {
+        const char* const     name;
+        std::atomic<uint32_t> id; //< Assigned the first time the entry point is captured.
+
+        constexpr GLCaptureEntryPoint(const char* in_name)
+            :name(in_name),
+             id  (UINT32_MAX)
+        {
+            /* Stub */
+        }
+    } GLCaptureEntryPoint;
+
+    /* Per-thread record buffer. */
+    class GLCaptureWriter
+    {
+    public:
+        /* Public functions */
+        GLCaptureWriter();
+
+        void align(const uint32_t& in_alignment);
+        void begin_record(const uint32_t& in_id);
+        void end_record();
+
+        const std::vector<uint8_t>& get_data() const
+        {
+            return m_data;
+        }
+
+        void reset();
+
+        void write(const void*   in_data_ptr,
+                   const size_t& in_n_bytes);
+
+        template<typename T>
+        void write_value(const T& in_value)
+        {
+            write(&in_value,
+                  sizeof(T) );
+        }
+
+        void write_blob          (const void*   in_data_ptr,
+                                  const size_t& in_n_bytes);
+        void write_pointer_value (const void*   in_ptr);
+        void write_string        (const char*   in_string_ptr,
+                                  const GLint&  in_length);
+
+    private:
+        /* Private variables */
+        std::vector<uint8_t> m_data;
+        size_t               m_record_start_offset;
+    };
+
+    extern std::atomic<bool> g_gl_capture_enabled;
+
+    class GLCapture
+    {
+    public:
+        /* Public functions */
+
+        /* Returns the calling thread's writer with a record for the entry point started, or nullptr if the call is not
+         * to be captured. Every call must be paired with end_call().
+         */
+        static GLCaptureWriter* begin_call(GLCaptureEntryPoint* in_entry_point_ptr);
+        static void             end_call  (GLCaptureWriter*     in_writer_ptr);
+
+        /* Returns the size of a client-side image, as used by pixel transfer ops, taking the pixel store state
+         * recorded by on_pixel_store() into account. Returns 0 if a pixel pack/unpack buffer is bound, in which case the
+         * pointer is an offset.
+         */
+        static size_t get_image_size(const bool&    in_unpack,
+                                     const GLsizei& in_width,
+                                     const GLsizei& in_height,
+                                     const GLsizei& in_depth,
+                                     const GLenum&  in_format,
+                                     const GLenum&  in_type);
+
+        /* Returns the size of the image glGetTexImage() would write for the texture level bound to the target, or the
+         * size of the compressed image if in_compressed is true.
+         */
+        static size_t get_tex_image_size(const GLenum& in_target,
+                                         const GLint&  in_level,
+                                         const GLenum& in_format,
+                                         const GLenum& in_type,
+                                         const bool&   in_compressed);
+
+        /* Returns the number of values a *v state setter reads for the specified pname. */
+        static uint32_t get_n_pname_values(const GLenum& in_pname);
+
+        static bool is_enabled()
+        {
+            return g_gl_capture_enabled.load(std::memory_order_relaxed);
+        }
+
+        /* Hooks, called by entry points which affect how later calls are captured. All of them are no-ops if capture is
+         * disabled.
+         */
+        static void   on_buffer_bound    (const GLenum&     in_target,
+                                          const GLuint&     in_buffer);
+        static void*  on_buffer_mapped   (const GLenum&     in_target,
+                                          const GLsizeiptr& in_length,
+                                          const GLbitfield& in_access,
+                                          void*             in_mapped_ptr);
+        static void   on_buffer_unmapping(const GLenum&     in_target);
+        static void   on_frame_presented ();
+        static void   on_pixel_store     (const GLenum&     in_pname,
+                                          const GLint&      in_param);
+        static GLsync on_sync_created    (GLsync            in_sync);
+
+    private:
+        /* Private functions */
+        GLCapture();
+    };
+
+    /* Argument serialization. Overloads for GL types which need special treatment take precedence over the templates. */
+    inline void write_gl_capture_arg(GLCaptureWriter& in_writer,
+                                     GLsync           in_sync)
+    {
+        in_writer.write_pointer_value(in_sync);
+    }
+
+    inline void write_gl_capture_arg(GLCaptureWriter&     in_writer,
+                                     const GLCaptureBlob& in_blob)
+    {
+        in_writer.write_blob(in_blob.data_ptr,
+                             in_blob.n_bytes);
+    }
+
+    inline void write_gl_capture_arg(GLCaptureWriter&       in_writer,
+                                     const GLCaptureOutput& in_output)
+    {
+        in_writer.write_value(GLCapturePointerKind::Output);
+        in_writer.write_value(static_cast<uint32_t>(in_output.n_bytes) );
+    }
+
+    void write_gl_capture_arg(GLCaptureWriter&             in_writer,
+                              const GLCapturePointerArray& in_array);
+
+    template<typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type write_gl_capture_arg(GLCaptureWriter& in_writer,
+                                                                                                             const T&         in_value)
+    {
+        in_writer.write_value(in_value);
+    }
+
+    template<typename T>
+    void write_gl_capture_arg(GLCaptureWriter& in_writer,
+                              T*               in_ptr)
+    {
+        static const uint32_t default_n_output_bytes = 256; //< Enough for any glGet*v() pname.
+
+        if (std::is_const<T>::value    ||
+            std::is_function<T>::value)
+        {
+            in_writer.write_pointer_value(reinterpret_cast<const void*>(in_ptr) );
+        }
+        else
+        {
+            in_writer.write_value(GLCapturePointerKind::Output);
+            in_writer.write_value(default_n_output_bytes);
+        }
+    }
+
+    class GLCaptureScope
+    {
+    public:
+        /* Public functions */
+        explicit GLCaptureScope(GLCaptureEntryPoint* in_entry_point_ptr)
+            :m_is_active (GLCapture::is_enabled() ),
+             m_writer_ptr(nullptr)
+        {
+            if (m_is_active)
+            {
+                m_writer_ptr = GLCapture::begin_call(in_entry_point_ptr);
+            }
+        }
+
+        bool is_recording() const
+        {
+            return (m_writer_ptr != nullptr);
+        }
+
+        /* Must only be called if is_recording() returns true. */
+        template<typename... ArgTypes>
+        void write_args(const ArgTypes&... in_args)
+        {
+            /* Braced init guarantees left-to-right evaluation. */
+            const int dummy[] = {0, (write_gl_capture_arg(*m_writer_ptr, in_args), 0)...};
+
+            (void) dummy;
+
+            m_writer_ptr->end_record();
+        }
+
+        ~GLCaptureScope()
+        {
+            if (m_is_active)
+            {
+                GLCapture::end_call(m_writer_ptr);
+            }
+        }
+
+    private:
+        /* Private functions */
+        GLCaptureScope           (const GLCaptureScope&);
+        GLCaptureScope& operator=(const GLCaptureScope&);
+
+        /* Private variables */
+        bool             m_is_active;
+        GLCaptureWriter* m_writer_ptr;
+    };
+};
+
+#define VKGL_GL_CAPTURE(...)                                                                       \
+    static OpenGL::GLCaptureEntryPoint vkgl_gl_capture_entry_point(__func__);                     \
+    OpenGL::GLCaptureScope             vkgl_gl_capture_scope      (&vkgl_gl_capture_entry_point); \
+    if (vkgl_gl_capture_scope.is_recording() )                                                    \
+        vkgl_gl_capture_scope.write_args(__VA_ARGS__)
+
+#endif /* VKGL_GL_CAPTURE_H */
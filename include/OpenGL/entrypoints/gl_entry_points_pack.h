@@ -2163,6 +2163,14 @@ VKGLAPI void vkglPolygonOffsetClamp (GLfloat factor, GLfloat units, GLfloat clam
 
 
 
+// GL_KHR_parallel_shader_compile
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR          0x91B1
+
+VKGLAPI void vkglMaxShaderCompilerThreadsKHR (GLuint count);
+
+
+
 }
 
 #endif //OPENGL_GL_ENTRY_POINTS_PACK_H
\ No newline at end of file
@@ -0,0 +1,167 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_GL_REPLAYER_H
+#define VKGL_GL_REPLAYER_H
+
+#include "OpenGL/entrypoints/gl_capture.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/* Replays GL command streams stored by OpenGL::GLCapture (see gl_capture.h for the file format).
+ *
+ * The capture file is memory-mapped and decoded in place. Blobs are handed to the GL entry points as pointers into the
+ * mapping, so replaying a call does not copy client memory. Output pointers are backed by scratch memory, which is reused
+ * across calls. Chunk & record bounds are validated once when the replayer is created, so that the replay loop does not
+ * need to check them. Argument data within a record is trusted.
+ *
+ * Calls are issued through the exported gl*() entry points, so the context to replay into must be current on the
+ * calling thread. Frame_End chunks turn into OpenGL::Context::present() calls.
+ *
+ * vkgl_replay_capture() wraps the whole process (backend & context creation included) for the standalone replayer
+ * (src/Replayer). It should be run with VKGL_HEADLESS set, since there is no window to present to.
+ */
+namespace OpenGL
+{
+    class Context;
+    class GLReplayer;
+
+    typedef std::unique_ptr<GLReplayer> GLReplayerUniquePtr;
+
+    typedef struct GLReplayStats
+    {
+        uint64_t n_calls;
+        uint32_t n_frames;
+
+        double cpu_time_ms;          //< Replay thread's CPU time, present() calls included.
+        double max_frame_time_ms;
+        double min_frame_time_ms;
+        double wall_time_ms;         //< Includes the final glFinish().
+
+        GLReplayStats()
+            :n_calls          (0),
+             n_frames         (0),
+             cpu_time_ms      (0.0),
+             max_frame_time_ms(0.0),
+             min_frame_time_ms(0.0),
+             wall_time_ms     (0.0)
+        {
+            /* Stub */
+        }
+    } GLReplayStats;
+
+    class GLReplayer
+    {
+    public:
+        /* Public functions */
+
+        /* Returns nullptr if the file could not be mapped, or if it is not a valid capture. */
+        static GLReplayerUniquePtr create(const char* in_file_name);
+
+        ~GLReplayer();
+
+        const uint32_t& get_n_frames() const
+        {
+            return m_n_frames;
+        }
+
+        /* Replays the whole stream into the context, which must be current on the calling thread. Can only be called once,
+         * as the stream relies on GL objects being created from scratch.
+         */
+        bool replay(OpenGL::Context* in_context_ptr,
+                    GLReplayStats*   out_stats_ptr);
+
+    private:
+        /* Private type definitions */
+        typedef struct EntryPoint
+        {
+            const char* name;
+            void      (*replay_func_ptr)(GLReplayer* in_replayer_ptr);
+            bool        is_buffer_map; //< Returns a pointer the stream may later write to.
+        } EntryPoint;
+
+        /* Private functions */
+        GLReplayer();
+
+        GLReplayer           (const GLReplayer&);
+        GLReplayer& operator=(const GLReplayer&);
+
+        bool  init           (const char*     in_file_name);
+        void* alloc_scratch  (const uint32_t& in_n_bytes);
+        bool  validate_stream();
+
+        void  replay_mapped_write();
+        void  replay_sync_created();
+
+        template<typename T>
+        T decode_arg();
+
+        void* decode_pointer();
+
+        template<typename T>
+        T read_value()
+        {
+            T result;
+
+            memcpy(&result,
+                   m_data_ptr,
+                   sizeof(T) );
+
+            m_data_ptr += sizeof(T);
+
+            return result;
+        }
+
+        void on_call_returned(GLsync in_sync)
+        {
+            m_last_returned_sync = in_sync;
+        }
+
+        void on_call_returned(void* in_ptr)
+        {
+            m_last_returned_ptr = in_ptr;
+        }
+
+        template<typename T>
+        void on_call_returned(const T&)
+        {
+            /* Stub */
+        }
+
+        template<auto FunctionPtr, typename ReturnType, typename... ArgTypes>
+        static void decode_and_call(GLReplayer* in_replayer_ptr,
+                                    ReturnType (*)(ArgTypes...) );
+
+        template<auto FunctionPtr>
+        static void replay_call(GLReplayer* in_replayer_ptr);
+
+        static const EntryPoint* get_entry_point(const char* in_name);
+
+        /* Private variables */
+        const uint8_t*                 m_data_ptr;        //< Read position within the record being replayed.
+        std::vector<const EntryPoint*> m_entry_point_ptrs; //< Indexed by the entry point IDs used by the stream.
+        size_t                         m_file_size;
+        void*                          m_mapping_ptr;
+        uint32_t                       m_n_frames;
+        bool                           m_replayed;
+
+        std::vector<std::vector<uint8_t> > m_scratch_buffers;
+        uint32_t                           m_n_scratch_buffers_used; //< Reset for each call.
+
+        std::unordered_map<GLenum,   void*>  m_mapped_ptrs;  //< Keyed by buffer targets.
+        std::unordered_map<uint64_t, GLsync> m_sync_objects; //< Captured handle -> replayed sync object.
+
+        void*  m_last_returned_ptr;
+        GLsync m_last_returned_sync;
+    };
+};
+
+/* Replays the capture into a new context and fills out_stats_ptr. Returns 0 on success. */
+extern "C" __attribute__((visibility("default"))) int vkgl_replay_capture(const char*            in_file_name,
+                                                                          OpenGL::GLReplayStats* out_stats_ptr);
+
+#endif /* VKGL_GL_REPLAYER_H */
@@ -0,0 +1,69 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_FRAME_GRAPH_BENCHMARK_H
+#define VKGL_FRAME_GRAPH_BENCHMARK_H
+
+#include <cstdint>
+
+/* Measures how many barriers OpenGL::VKFrameGraph emits for streaming workloads. Runs against VKBackend in headless
+ * mode, so it needs a Vulkan ICD (a software one such as lavapipe will do), but no display.
+ *
+ * The graph is fed synthetic nodes rather than GL calls, since texture uploads are not routed through the frame graph
+ * yet. Each frame consists of:
+ *
+ * - in_n_uploads_per_frame pairs of a transfer write to a buffer range, followed by a vertex attribute read of the same
+ *   range. All pairs use disjoint ranges of a single buffer, so none of them depends on another.
+ * - one transfer write per mip of a single mipmapped image, followed by a fragment shader read of the whole mip chain.
+ *
+ * With whole-resource tracking, each pair (and each mip upload) would be serialized against all the previous ones.
+ * Per-range & per-subresource tracking should only sync writers with their own readers, so barrier counts are expected
+ * to stay close to the number of pairs. Totals are summed over all frames, the first (warm-up) one excluded.
+ */
+namespace OpenGL
+{
+    typedef struct FrameGraphBenchmarkResult
+    {
+        uint64_t n_barriers_dropped;
+        uint64_t n_barriers_hoisted;
+        uint64_t n_barriers_merged;
+        uint64_t n_buffer_barriers;
+        uint64_t n_image_barriers;
+        uint64_t n_pipeline_barrier_cmds;
+        uint64_t n_set_event_cmds;
+        uint64_t n_submissions;
+        uint64_t n_submissions_without_reordering;
+        uint64_t n_wait_events_cmds;
+
+        uint32_t n_frames;
+        double   wall_time_ms; //< Node submission & blocking graph execution, summed over all frames.
+
+        FrameGraphBenchmarkResult()
+            :n_barriers_dropped              (0),
+             n_barriers_hoisted              (0),
+             n_barriers_merged               (0),
+             n_buffer_barriers               (0),
+             n_image_barriers                (0),
+             n_pipeline_barrier_cmds         (0),
+             n_set_event_cmds                (0),
+             n_submissions                   (0),
+             n_submissions_without_reordering(0),
+             n_wait_events_cmds              (0),
+             n_frames                        (0),
+             wall_time_ms                    (0.0)
+        {
+            /* Stub */
+        }
+    } FrameGraphBenchmarkResult;
+};
+
+/* Runs the streaming workload for the requested number of frames and fills out_result_ptr. Returns 0 on success.
+ *
+ * Expects VKGL_HEADLESS to be set.
+ */
+extern "C" __attribute__((visibility("default"))) int vkgl_run_frame_graph_benchmark(uint32_t                           in_n_frames,
+                                                                                     uint32_t                           in_n_uploads_per_frame,
+                                                                                     OpenGL::FrameGraphBenchmarkResult* out_result_ptr);
+
+#endif /* VKGL_FRAME_GRAPH_BENCHMARK_H */
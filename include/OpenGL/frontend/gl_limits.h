@@ -320,6 +320,14 @@ namespace OpenGL
             uint32_t                   n_components;
             OpenGL::GetSetArgumentType type;
 
+            PropertyData()
+                :data_ptr    (nullptr),
+                 n_components(0),
+                 type        (OpenGL::GetSetArgumentType::Unknown)
+            {
+                /* Stub */
+            }
+
             PropertyData(const OpenGL::GetSetArgumentType& in_type,
                          const uint32_t&                   in_n_components,
                          void*                             in_data_ptr)
@@ -331,7 +339,7 @@ namespace OpenGL
             }
         } PropertyData;
 
-        typedef std::unordered_map<OpenGL::ContextProperty, PropertyData> PropertyToArgumentTypeMap;
+        typedef VKGL::EnumIndexedMap<OpenGL::ContextProperty, PropertyData> PropertyToArgumentTypeMap;
 
         /* Private functions */
 
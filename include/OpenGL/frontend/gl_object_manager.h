@@ -9,6 +9,7 @@
 #include "OpenGL/frontend/gl_reference.h"
 #include "OpenGL/frontend/snapshot_manager.h"
 #include "OpenGL/namespace.h"
+#include <atomic>
 #include <map>
 
 
@@ -47,46 +48,44 @@ namespace OpenGL
             m_id_manager_ptr->release(in_n_ids,
                                       in_ids_ptr);
 
+            for (uint32_t n_id = 0;
+                          n_id < in_n_ids;
+                        ++n_id)
             {
-                auto lock = std::unique_lock<std::mutex>(m_mutex);
+                const auto& current_id = in_ids_ptr[n_id];
+                auto        object_ptr = (current_id  != 0 ||
+                                          m_releasing == true) ? find_object_props_ptr(current_id)
+                                                               : nullptr;
 
-                for (uint32_t n_id = 0;
-                              n_id < in_n_ids;
-                            ++n_id)
+                if (object_ptr == nullptr)
                 {
-                    const auto& current_id = in_ids_ptr[n_id];
+                    continue;
+                }
 
-                    if (current_id  == 0      &&
-                        m_releasing == false)
-                    {
-                        continue;
-                    }
+                /* Flag the object as deleted first, then check for remaining references. If the last reference goes away
+                 * in between, either on_all_snapshot_references_deleted() or the check below destroys the object -
+                 * whichever manages to claim it first.
+                 */
+                {
+                    const auto prev_status = object_ptr->status.exchange(Status::Deleted_References_Pending);
 
-                    if (!is_id_valid(current_id) )
+                    if (prev_status != Status::Alive             &&
+                        prev_status != Status::Created_Not_Bound)
                     {
-                        continue;
-                    }
+                        vkgl_assert(prev_status == Status::Alive             ||
+                                    prev_status == Status::Created_Not_Bound);
 
-                    /* Only destroy the object *IF* there are no remaining active references. Otherwise, assign
-                     * a corresponding status to the object and leave it alone.
-                     */
-                    if (m_object_ptrs.at(current_id)->snapshot_manager_ptr->get_n_references(true /* include_tot_snapshot_references */) == 0)
-                    {
-                        delete_object(current_id);
+                        continue;
                     }
-                    else
-                    {
-                        #if defined(_DEBUG)
-                        {
-                            const auto object_status = get_object_status(current_id);
+                }
 
-                            vkgl_assert(object_status == Status::Alive              ||
-                                        object_status == Status::Created_Not_Bound)
-                        }
-                        #endif
+                {
+                    const auto snapshot_manager_ptr = object_ptr->snapshot_manager_ptr.load();
 
-                        set_object_status(current_id,
-                                          Status::Deleted_References_Pending);
+                    if (snapshot_manager_ptr                                                                  == nullptr ||
+                        snapshot_manager_ptr->get_n_references(true /* include_tot_snapshot_references */) == 0)
+                    {
+                        destroy_deleted_object(object_ptr);
                     }
                 }
             }
@@ -124,44 +123,24 @@ namespace OpenGL
 
         bool is_alive_id(const GLuint& in_id) const
         {
-            bool result = false;
-
-            {
-                std::unique_lock<std::mutex> lock    (m_mutex);
-                const bool                   is_valid(is_id_valid(in_id) );
-
-                if (is_valid                                  &&
-                    get_object_status(in_id) == Status::Alive)
-                {
-                    result = true;
-                }
-            }
+            const auto object_ptr = find_object_props_ptr(in_id);
 
-            return result;
+            return (object_ptr         != nullptr       &&
+                    object_ptr->status == Status::Alive);
         }
 
         bool mark_id_as_alive(const GLuint& in_id)
         {
-            bool result = false;
+            auto object_ptr = find_object_props_ptr(in_id);
+            bool result     = false;
 
+            if (object_ptr != nullptr)
             {
-                std::unique_lock<std::mutex> lock(m_mutex);
-                const auto                   object_status(get_object_status(in_id) );
+                auto object_status = Status::Created_Not_Bound;
 
-                if (object_status == Status::Created_Not_Bound)
-                {
-                    set_object_status(in_id,
-                                      Status::Alive);
-                	result = true;
-                }
-                else if (object_status == Status::Alive)
-                {
-                	result = true;
-                }
-                else
-                {
-                	result = false;
-                }
+                result = object_ptr->status.compare_exchange_strong(object_status,
+                                                                    Status::Alive) ||
+                         object_status == Status::Alive;
             }
 
             return result;
@@ -201,7 +180,7 @@ namespace OpenGL
             if (object_ptr != nullptr)
             {
                 result_ptr = acquire_reference(in_id,
-                                               object_ptr->snapshot_manager_ptr->get_last_modified_time() );
+                                               get_snapshot_manager_ptr(object_ptr)->get_last_modified_time() );
             }
             else
             {
@@ -225,6 +204,25 @@ namespace OpenGL
             {
                 vkgl_assert(m_default_object_reference_ptr == nullptr);
             }
+
+            for (auto& current_page : m_page_ptrs)
+            {
+                auto page_ptr = current_page.load();
+
+                if (page_ptr == nullptr)
+                {
+                    continue;
+                }
+
+                for (uint32_t n_object = 0;
+                              n_object < N_OBJECTS_PER_PAGE;
+                            ++n_object)
+                {
+                    delete page_ptr[n_object].snapshot_manager_ptr.load();
+                }
+
+                delete [] page_ptr;
+            }
         }
 
     protected:
@@ -235,31 +233,37 @@ namespace OpenGL
             Created_Not_Bound,
             Alive,
             Deleted_References_Pending,
+            Being_Destroyed,
 
             Unknown
         };
 
+        typedef OpenGL::SnapshotManager<ObjectReferenceType, ObjectReferenceUniquePtrType, OpenGL::GLPayload> ObjectSnapshotManager;
+
+        /* Instances live in the manager's pages and are recycled when a GL name is deleted & later re-generated.
+         * Status is Unknown while the name is unused.
+         *
+         * The generation counter is bumped whenever the name is re-generated, so that callbacks bound to an earlier
+         * incarnation of the object cannot affect the new one.
+         *
+         * The snapshot manager is created on first use (see get_snapshot_manager_ptr()), so that glGen*() calls for
+         * names which are never bound do not pay for the base & scratch snapshots.
+         */
         typedef struct GeneralObjectProps
         {
-            OpenGL::TimeMarker                                                                                              creation_time;
-            GLuint                                                                                                          id;
-            std::unique_ptr<OpenGL::SnapshotManager<ObjectReferenceType, ObjectReferenceUniquePtrType, OpenGL::GLPayload> > snapshot_manager_ptr;
-            Status                                                                                                          status;
-
-            GeneralObjectProps(IStateSnapshotAccessors* in_state_snapshot_accessors_ptr,
-                               const GLuint&            in_id,
-                               std::function<void()>    in_on_all_references_deleted_func)
+            OpenGL::TimeMarker                          creation_time;
+            std::atomic<uint32_t>                       generation;
+            GLuint                                      id;
+            mutable std::atomic<ObjectSnapshotManager*> snapshot_manager_ptr;
+            std::atomic<Status>                         status;
+
+            GeneralObjectProps()
+                :generation          (0),
+                 id                  (0),
+                 snapshot_manager_ptr(nullptr),
+                 status              (Status::Unknown)
             {
-                creation_time = std::chrono::high_resolution_clock::now();
-                id            = in_id;
-                status        = Status::Created_Not_Bound;
-
-                snapshot_manager_ptr.reset(
-                    new SnapshotManager<ObjectReferenceType, ObjectReferenceUniquePtrType, GLPayload>(id,
-                                                                                                      in_state_snapshot_accessors_ptr,
-                                                                                                      std::chrono::high_resolution_clock::now(),
-                                                                                                      in_on_all_references_deleted_func)
-                );
+                /* Stub */
             }
         } GeneralObjectProps;
 
@@ -271,7 +275,10 @@ namespace OpenGL
              m_first_valid_nondefault_id(in_first_valid_nondefault_id),
              m_releasing                (false)
         {
-            /*  Stub */
+            for (auto& current_page : m_page_ptrs)
+            {
+                current_page.store(nullptr);
+            }
         }
 
         ObjectReferenceUniquePtrType acquire_reference(const GLuint&             in_id,
@@ -281,34 +288,27 @@ namespace OpenGL
                                                     std::default_delete<ObjectReferenceType>() );
 
             {
-                std::unique_lock<std::mutex> lock      (m_mutex);
-                GeneralObjectProps*                 object_ptr(nullptr);
-                auto                         object_iterator(m_object_ptrs.find(in_id) );
-                
-                if (object_iterator != m_object_ptrs.end() )
-                {
-                	object_ptr = object_iterator->second.get();
-                }
+                auto object_ptr = find_object_props_ptr(in_id);
 
                 vkgl_assert(object_ptr != nullptr);
                 if (object_ptr != nullptr)
                 {
                     #if defined(_DEBUG)
                     {
-                        const auto& object_status = object_ptr->status;
-    
+                        const Status object_status = object_ptr->status;
+
                         vkgl_assert(object_status != Status::Deleted_References_Pending &&
+                                    object_status != Status::Being_Destroyed            &&
                                     object_status != Status::Unknown);
                     }
                     #endif
 
-                    result_ptr = object_ptr->snapshot_manager_ptr->acquire_reference(
+                    result_ptr = get_snapshot_manager_ptr(object_ptr)->acquire_reference(
                         OpenGL::GLPayload(in_id,
                                           in_time_marker,
                                           object_ptr->creation_time) );
-    
                 }
-                
+
                 if (result_ptr == nullptr)
                 {
                     vkgl_assert(result_ptr != nullptr);
@@ -323,24 +323,9 @@ namespace OpenGL
 
         const GeneralObjectProps* get_general_object_props_ptr (const GLuint& in_id) const
         {
-            GeneralObjectProps* result_ptr     = nullptr;
-            const auto          object_iterator = m_object_ptrs.find(in_id);
-vkgl_printf("line = %d file = %s", __LINE__, __FILE__);
-vkgl_printf("in_id = %d", in_id);
-vkgl_printf("m_object_ptrs.size() = %d", m_object_ptrs.size() );
-vkgl_printf("&m_object_ptrs = %p", &m_object_ptrs);
-vkgl_printf("this = %p", this);
-{
-	for (auto& current_object : m_object_ptrs)
-	{
-		vkgl_printf("current_object.first = %d", current_object.first);
-	}
-}
-            vkgl_assert(object_iterator != m_object_ptrs.end() );
-            if (object_iterator != m_object_ptrs.end() )
-            {
-                result_ptr = object_iterator->second.get();
-            }
+            const auto result_ptr = find_object_props_ptr(in_id);
+
+            vkgl_assert(result_ptr != nullptr);
 
             return result_ptr;
         }
@@ -353,12 +338,13 @@ vkgl_printf("this = %p", this);
 
             if (props_ptr != nullptr)
             {
-                const OpenGL::TimeMarker time_marker = (in_opt_time_marker_ptr == nullptr)                                                                 ? props_ptr->snapshot_manager_ptr->get_last_modified_time()
-                                                     : (in_opt_time_marker_ptr != nullptr && *in_opt_time_marker_ptr == OpenGL::LATEST_SNAPSHOT_AVAILABLE) ? props_ptr->snapshot_manager_ptr->get_last_modified_time()
-                                                     : *in_opt_time_marker_ptr;
+                const auto               snapshot_manager_ptr = get_snapshot_manager_ptr(props_ptr);
+                const OpenGL::TimeMarker time_marker          = (in_opt_time_marker_ptr == nullptr)                                                                 ? snapshot_manager_ptr->get_last_modified_time()
+                                                              : (in_opt_time_marker_ptr != nullptr && *in_opt_time_marker_ptr == OpenGL::LATEST_SNAPSHOT_AVAILABLE) ? snapshot_manager_ptr->get_last_modified_time()
+                                                              : *in_opt_time_marker_ptr;
 
-                result_ptr = props_ptr->snapshot_manager_ptr->get_readonly_snapshot(time_marker,
-                                                                                    false /* in_proxy_references_permitted */);
+                result_ptr = snapshot_manager_ptr->get_readonly_snapshot(time_marker,
+                                                                         false /* in_proxy_references_permitted */);
             }
 
             return result_ptr;
@@ -372,16 +358,17 @@ vkgl_printf("this = %p", this);
 
             if (props_ptr != nullptr)
             {
-                const OpenGL::TimeMarker time_marker = (in_opt_time_marker_ptr == nullptr)                                                                 ? props_ptr->snapshot_manager_ptr->get_last_modified_time()
-                                                     : (in_opt_time_marker_ptr != nullptr && *in_opt_time_marker_ptr == OpenGL::LATEST_SNAPSHOT_AVAILABLE) ? props_ptr->snapshot_manager_ptr->get_last_modified_time()
-                                                     : *in_opt_time_marker_ptr;
+                const auto               snapshot_manager_ptr = get_snapshot_manager_ptr(props_ptr);
+                const OpenGL::TimeMarker time_marker          = (in_opt_time_marker_ptr == nullptr)                                                                 ? snapshot_manager_ptr->get_last_modified_time()
+                                                              : (in_opt_time_marker_ptr != nullptr && *in_opt_time_marker_ptr == OpenGL::LATEST_SNAPSHOT_AVAILABLE) ? snapshot_manager_ptr->get_last_modified_time()
+                                                              : *in_opt_time_marker_ptr;
 
                 /* NOTE: This function must ONLY be called for potential update purposes. State updates can only be performed
                  *       against ToT state snapshots.
                  */
-                vkgl_assert(time_marker == props_ptr->snapshot_manager_ptr->get_last_modified_time() );
+                vkgl_assert(time_marker == snapshot_manager_ptr->get_last_modified_time() );
 
-                result_ptr = props_ptr->snapshot_manager_ptr->get_rw_tot_snapshot();
+                result_ptr = snapshot_manager_ptr->get_rw_tot_snapshot();
             }
 
             return result_ptr;
@@ -402,8 +389,6 @@ vkgl_printf("this = %p", this);
                 goto end;
             }
 
-            m_object_ptrs.clear();
-            
             if (m_expose_default_object)
             {
                 vkgl_assert(m_first_valid_nondefault_id != 0);
@@ -436,7 +421,7 @@ vkgl_printf("this = %p", this);
 
             if (object_ptr != nullptr)
             {
-                object_ptr->snapshot_manager_ptr->update_last_modified_time();
+                get_snapshot_manager_ptr(object_ptr)->update_last_modified_time();
 
                 result = true;
             }
@@ -454,31 +439,78 @@ vkgl_printf("this = %p", this);
         bool                         m_releasing;
 
     private:
+        /* Private type definitions */
+
+        /* Objects are stored in a paged array, indexed directly by GL name. Namespace hands out dense names, so the
+         * array stays compact, and a page doubles as a pool of pre-constructed GeneralObjectProps instances for
+         * glGen*() calls generating many names at once. Pages are never moved or released before the manager goes out
+         * of scope, so lookups are lock-free; the object's status acts as the publication flag. Only page allocation
+         * takes a lock.
+         */
+        static const uint32_t N_OBJECTS_PER_PAGE_LOG2 = 10;
+        static const uint32_t N_OBJECTS_PER_PAGE      = (1u << N_OBJECTS_PER_PAGE_LOG2);
+        static const uint32_t N_MAX_PAGES             = 4096; /* ~4M names per manager */
 
         /* Private functions */
 
-        bool delete_object(const GLuint& in_id)
+        /* Releases the object's storage, if the object is still flagged as deleted. Returns false if another thread
+         * has already claimed it.
+         */
+        bool destroy_deleted_object(GeneralObjectProps* in_object_ptr)
         {
-            bool       result          = false;
-            const auto object_iterator = m_object_ptrs.find(in_id);
+            auto                   object_status        = Status::Deleted_References_Pending;
+            bool                   result               = false;
+            ObjectSnapshotManager* snapshot_manager_ptr = nullptr;
+
+            if (!in_object_ptr->status.compare_exchange_strong(object_status,
+                                                               Status::Being_Destroyed) )
+            {
+                goto end;
+            }
+
+            snapshot_manager_ptr = in_object_ptr->snapshot_manager_ptr.exchange(nullptr);
 
-            vkgl_assert(object_iterator != m_object_ptrs.end() );
-            if (object_iterator != m_object_ptrs.end() )
+            if (snapshot_manager_ptr != nullptr)
             {
-                const auto n_nontot_references = object_iterator->second->snapshot_manager_ptr->get_n_references(false /* in_include_tot_snapshots_references */);
-                const auto n_snapshots         = object_iterator->second->snapshot_manager_ptr->get_n_snapshots ();
+                const auto n_nontot_references = snapshot_manager_ptr->get_n_references(false /* in_include_tot_snapshots_references */);
+                const auto n_snapshots         = snapshot_manager_ptr->get_n_snapshots ();
 
                 vkgl_assert((n_snapshots == 0)                             ||
                             (n_snapshots == 1 && n_nontot_references == 0) );
 
-                m_object_ptrs.erase(object_iterator);
-
-                result = true;
+                delete snapshot_manager_ptr;
             }
 
+            in_object_ptr->status.store(Status::Unknown);
+
+            result = true;
+        end:
             return result;
         }
 
+        GeneralObjectProps* find_object_props_ptr(const GLuint& in_id) const
+        {
+            auto result_ptr = get_object_storage_ptr(in_id);
+
+            if (result_ptr         != nullptr         &&
+                result_ptr->status == Status::Unknown)
+            {
+                result_ptr = nullptr;
+            }
+
+            return result_ptr;
+        }
+
+        GeneralObjectProps* get_object_storage_ptr(const GLuint& in_id) const
+        {
+            const uint32_t      n_page   = (in_id >> N_OBJECTS_PER_PAGE_LOG2);
+            GeneralObjectProps* page_ptr = (n_page < N_MAX_PAGES) ? m_page_ptrs[n_page].load()
+                                                                  : nullptr;
+
+            return (page_ptr != nullptr) ? page_ptr + (in_id & (N_OBJECTS_PER_PAGE - 1) )
+                                         : nullptr;
+        }
+
         Status get_object_status(const GLuint& in_id) const
         {
             const auto object_ptr = get_general_object_props_ptr(in_id);
@@ -486,64 +518,136 @@ vkgl_printf("this = %p", this);
 
             if (object_ptr != nullptr)
             {
-                result = object_ptr->status;
+                result = object_ptr->status.load();
             }
 
             return result;
         }
 
+        /* Creates the object's snapshot manager, if this has not been done yet. May be called from any thread. */
+        ObjectSnapshotManager* get_snapshot_manager_ptr(const GeneralObjectProps* in_object_ptr) const
+        {
+            ObjectSnapshotManager* result_ptr = in_object_ptr->snapshot_manager_ptr.load();
+
+            if (result_ptr == nullptr)
+            {
+                /* The manager is logically unchanged, hence the const_cast. */
+                auto                   this_ptr             = const_cast<GLObjectManager<ObjectReferenceType, ObjectReferenceUniquePtrType>*>(this);
+                ObjectSnapshotManager* expected_manager_ptr = nullptr;
+                ObjectSnapshotManager* new_manager_ptr      = new ObjectSnapshotManager(in_object_ptr->id,
+                                                                                        dynamic_cast<IStateSnapshotAccessors*>(this_ptr),
+                                                                                        std::chrono::high_resolution_clock::now(),
+                                                                                        std::bind(&OpenGL::GLObjectManager<ObjectReferenceType, ObjectReferenceUniquePtrType>::on_all_snapshot_references_deleted,
+                                                                                                  this_ptr,
+                                                                                                  in_object_ptr->id,
+                                                                                                  in_object_ptr->generation.load() ) );
+
+                vkgl_assert(new_manager_ptr != nullptr);
+
+                if (in_object_ptr->snapshot_manager_ptr.compare_exchange_strong(expected_manager_ptr,
+                                                                                new_manager_ptr) )
+                {
+                    result_ptr = new_manager_ptr;
+                }
+                else
+                {
+                    /* Another thread got there first. */
+                    delete new_manager_ptr;
+
+                    result_ptr = expected_manager_ptr;
+                }
+            }
+
+            return result_ptr;
+        }
+
         bool insert_object(const GLuint& in_id)
         {
-            bool       result          = false;
-            const auto object_iterator = m_object_ptrs.find(in_id);
-
-            /* TODO: This assertion check will trigger when:
-             *
-             * 1. Frontend creates an object.
-             * 2. Frontend schedules ops operating on the object for execution in the backend.
-             * 3. Frontend immediately destroys an object.
-             *
-             * Need to move about-to-be-destroyed object descriptors with pending references to a separate map.
-             */
-            vkgl_assert(object_iterator == m_object_ptrs.end() );
-            if (object_iterator == m_object_ptrs.end() )
+            bool result     = false;
+            auto object_ptr = get_object_storage_ptr(in_id);
+
+            if (object_ptr == nullptr)
             {
-                std::unique_ptr<GeneralObjectProps> new_object_ptr;
+                object_ptr = allocate_object_storage_ptr(in_id);
 
-                new_object_ptr.reset(
-                    new GeneralObjectProps(dynamic_cast<IStateSnapshotAccessors*>(this),
-                                           in_id,
-                                           std::bind(&OpenGL::GLObjectManager<ObjectReferenceType, ObjectReferenceUniquePtrType>::on_all_snapshot_references_deleted,
-                                                     this,
-                                                     in_id))
-                );
+                if (object_ptr == nullptr)
+                {
+                    vkgl_assert(object_ptr != nullptr);
 
-                vkgl_assert(new_object_ptr != nullptr);
+                    goto end;
+                }
+            }
+
+            if (object_ptr->status != Status::Unknown)
+            {
+                /* TODO: This assertion check will trigger when:
+                 *
+                 * 1. Frontend creates an object.
+                 * 2. Frontend schedules ops operating on the object for execution in the backend.
+                 * 3. Frontend immediately destroys an object.
+                 *
+                 * Need to move about-to-be-destroyed object descriptors with pending references to a separate map.
+                 */
+                vkgl_assert(object_ptr->status == Status::Unknown);
 
-                m_object_ptrs[in_id] = std::move(new_object_ptr);
-                result               = true;
+                goto end;
             }
 
+            vkgl_assert(object_ptr->snapshot_manager_ptr == nullptr);
+
+            object_ptr->creation_time = std::chrono::high_resolution_clock::now();
+            object_ptr->id            = in_id;
+
+            object_ptr->generation.fetch_add(1);
+
+            /* Publish the object. */
+            object_ptr->status.store(Status::Created_Not_Bound);
+
+            result = true;
+        end:
             return result;
         }
 
-        bool is_id_valid(const GLuint& in_id) const
+        GeneralObjectProps* allocate_object_storage_ptr(const GLuint& in_id)
         {
-            const auto object_iterator = m_object_ptrs.find(in_id);
+            const uint32_t      n_page   = (in_id >> N_OBJECTS_PER_PAGE_LOG2);
+            GeneralObjectProps* page_ptr = nullptr;
+
+            if (n_page >= N_MAX_PAGES)
+            {
+                goto end;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(m_page_mutex);
+
+                page_ptr = m_page_ptrs[n_page].load();
+
+                if (page_ptr == nullptr)
+                {
+                    page_ptr = new GeneralObjectProps[N_OBJECTS_PER_PAGE];
+
+                    m_page_ptrs[n_page].store(page_ptr);
+                }
+            }
 
-            return (object_iterator != m_object_ptrs.end() );
+        end:
+            return (page_ptr != nullptr) ? page_ptr + (in_id & (N_OBJECTS_PER_PAGE - 1) )
+                                         : nullptr;
         }
 
-        void on_all_snapshot_references_deleted(GLuint in_id)
+        void on_all_snapshot_references_deleted(GLuint   in_id,
+                                                uint32_t in_generation)
         {
             /* If the object has been destroyed AND there are no more dangling refernces, destroy
              * the container. Otherwise, retain it.
              */
-            const auto status = get_object_status(in_id);
+            const auto object_ptr = get_object_storage_ptr(in_id);
 
-            if (status == Status::Deleted_References_Pending)
+            if (object_ptr                    != nullptr       &&
+                object_ptr->generation.load() == in_generation)
             {
-                delete_object(in_id);
+                destroy_deleted_object(object_ptr);
             }
         }
 
@@ -565,30 +669,16 @@ vkgl_printf("this = %p", this);
 
         GeneralObjectProps* get_general_object_props_ptr(const GLuint& in_id)
         {
-            GeneralObjectProps* result_ptr     = nullptr;
-            const auto          object_iterator = m_object_ptrs.find(in_id);
-vkgl_printf("line = %d file = %s", __LINE__, __FILE__);
-vkgl_printf("in_id = %d", in_id);
-vkgl_printf("m_object_ptrs.size() = %d", m_object_ptrs.size() );
-vkgl_printf("&m_object_ptrs = %p", &m_object_ptrs);
-vkgl_printf("this = %p", this);
-{
-	for (auto& current_object : m_object_ptrs)
-	{
-		vkgl_printf("current_object.first = %d", current_object.first);
-	}
-}
-            vkgl_assert(object_iterator != m_object_ptrs.end() );
-            if (object_iterator != m_object_ptrs.end() )
-            {
-                result_ptr = object_iterator->second.get();
-            }
+            const auto result_ptr = find_object_props_ptr(in_id);
+
+            vkgl_assert(result_ptr != nullptr);
 
             return result_ptr;
         }
 
         /* Private variables */
-        std::unordered_map<GLuint, std::unique_ptr<GeneralObjectProps> > m_object_ptrs;
+        std::mutex                       m_page_mutex;
+        std::atomic<GeneralObjectProps*> m_page_ptrs[N_MAX_PAGES];
 
         friend ObjectReferenceType;
     };
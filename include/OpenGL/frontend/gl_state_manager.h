@@ -157,9 +157,9 @@ namespace OpenGL
         std::unique_ptr<OpenGL::SnapshotManager<GLContextStateReference, GLContextStateReferenceUniquePtr, OpenGL::GLContextStatePayload> > m_snapshot_manager_ptr;
         const VKGL::IWSIContext*                                                                                                            m_wsi_context_ptr;
 
-        std::unordered_map<OpenGL::ContextProperty,    PropertyData> m_context_prop_map;
-        std::unordered_map<OpenGL::PixelStoreProperty, PropertyData> m_pixel_store_prop_map;
-        std::unordered_map<OpenGL::PointProperty,      PropertyData> m_point_prop_map;
+        VKGL::EnumIndexedMap<OpenGL::ContextProperty,    PropertyData> m_context_prop_map;
+        VKGL::EnumIndexedMap<OpenGL::PixelStoreProperty, PropertyData> m_pixel_store_prop_map;
+        VKGL::EnumIndexedMap<OpenGL::PointProperty,      PropertyData> m_point_prop_map;
     };
 
     typedef std::unique_ptr<GLStateManager> GLStateManagerUniquePtr;
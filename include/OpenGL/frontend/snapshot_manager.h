@@ -146,6 +146,17 @@ namespace OpenGL
             return result_ptr;
         }
 
+        /* Returns the top-of-tree state without taking the snapshot mutex.
+         *
+         * The scratch snapshot is only ever modified by the thread which owns the object (the rendering context's thread)
+         * and always mirrors the latest snapshot after update_last_modified_time() returns, so that thread can read it
+         * directly. The result may hold proxy references. Any other thread must use get_readonly_snapshot().
+         */
+        const void* get_readonly_tot_snapshot() const
+        {
+            return m_scratch_snapshot_ptr.get();
+        }
+
         void* get_rw_tot_snapshot()
         {
             return m_scratch_snapshot_ptr.get();
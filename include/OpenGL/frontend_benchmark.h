@@ -0,0 +1,58 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_FRONTEND_BENCHMARK_H
+#define VKGL_FRONTEND_BENCHMARK_H
+
+#include <cstdint>
+#include <vector>
+
+/* Measures frontend overhead by driving typical GL call mixes into a context backed by OpenGL::NullBackend.
+ *
+ * Supported mixes:
+ *
+ * "state"  - state-change-heavy: enable/disable, blend/depth/cull state, viewport & scissor, texture & buffer bindings.
+ * "draw"   - draw-heavy: VAO & index buffer bindings, glDrawArrays(), glDrawElements(), glDrawRangeElements().
+ * "upload" - upload-heavy: buffer orphaning, glBufferSubData(), map/write/unmap, glTexSubImage2D().
+ *
+ * Draw calls are issued through the core entry points, since the compatibility ones compile an FPE program on first use,
+ * which the null backend cannot do.
+ *
+ * Each mix is run twice. The first run is untimed, and its wall time divided by the number of calls gives the overall
+ * cost per call. The second run times each call separately (minus the calibrated cost of reading the clock) to break that
+ * cost down per entry point.
+ */
+namespace OpenGL
+{
+    typedef struct FrontendBenchmarkEntryPointResult
+    {
+        const char* name;
+        uint64_t    n_calls;
+        double      ns_per_call;
+    } FrontendBenchmarkEntryPointResult;
+
+    typedef struct FrontendBenchmarkResult
+    {
+        uint64_t n_backend_callbacks;
+        uint64_t n_calls;
+        double   ns_per_call;
+
+        std::vector<FrontendBenchmarkEntryPointResult> entry_points;
+
+        FrontendBenchmarkResult()
+            :n_backend_callbacks(0),
+             n_calls            (0),
+             ns_per_call        (0.0)
+        {
+            /* Stub */
+        }
+    } FrontendBenchmarkResult;
+};
+
+/* Runs the mix for the requested number of iterations and fills out_result_ptr. Returns 0 on success. */
+extern "C" __attribute__((visibility("default"))) int vkgl_run_frontend_benchmark(const char*                      in_mix_name,
+                                                                                  uint32_t                         in_n_iterations,
+                                                                                  OpenGL::FrontendBenchmarkResult* out_result_ptr);
+
+#endif /* VKGL_FRONTEND_BENCHMARK_H */
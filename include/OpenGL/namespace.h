@@ -6,6 +6,7 @@
 #define VKGL_NAMESPACE_H
 
 #include "OpenGL/types.h"
+#include <map>
 
 
 namespace OpenGL
@@ -28,8 +29,17 @@ namespace OpenGL
                          const GLuint*   in_ids_ptr);
 
     private:
+        /* Private functions */
+        void add_free_range(GLuint in_range_start,
+                            GLuint in_range_end);
+
         /* Private variables */
-        std::vector<GLuint> m_available_ids;
+
+        /* Released IDs, stored as [first, last) ranges keyed by the first ID. Adjacent ranges are always merged,
+         * and IDs released at the end of the allocated range shrink m_n_allocated_ids instead, so the
+         * map only holds the holes.
+         */
+        std::map<GLuint, GLuint> m_free_ranges;
 
         GLuint       m_n_allocated_ids;
         const GLuint m_start_id;
@@ -17,6 +17,7 @@
 
 #define VKGL_APIENTRY KHRONOS_APIENTRY
 
+#include "Common/enum_indexed_map.h"
 #include "Common/types.h"
 #include "OpenGL/types_enums.h"
 #include "OpenGL/backend/vk_reference.h"
@@ -47,9 +48,11 @@ namespace OpenGL
     class  VKGFXPipelineManager;
     class  VKRenderpassManager;
     class  VKImageManager;
+    struct VKMapBacking;
     class  VKScheduler;
     class  VKSPIRVManager;
     class  VKSwapchainManager;
+    class  VKSyncObjectPool;
 
     typedef std::unique_ptr<GLBufferReference,       std::function<void(GLBufferReference*)> >       GLBufferReferenceUniquePtr;
     typedef std::unique_ptr<GLContextStateReference, std::function<void(GLContextStateReference*)> > GLContextStateReferenceUniquePtr;
@@ -67,9 +70,11 @@ namespace OpenGL
     typedef std::unique_ptr<VKRenderpassManager>                                                     VKRenderpassManagerUniquePtr;
     typedef std::unique_ptr<VKImageManager>                                                     VKImageManagerUniquePtr;
     typedef std::unique_ptr<VKImageReference,       std::function<void(VKImageReference*)> >       VKImageReferenceUniquePtr;
+    typedef std::shared_ptr<VKMapBacking>                                                            VKMapBackingSharedPtr;
     typedef std::unique_ptr<VKScheduler>                                                             VKSchedulerUniquePtr;
     typedef std::unique_ptr<VKSPIRVManager>                                                          VKSPIRVManagerUniquePtr;
     typedef std::unique_ptr<VKSwapchainReference,    std::function<void(VKSwapchainReference*)> >    VKSwapchainReferenceUniquePtr;
+    typedef std::unique_ptr<VKSyncObjectPool>                                                        VKSyncObjectPoolUniquePtr;
 
     typedef uint32_t SPIRVBlobID;
 
@@ -83,6 +88,14 @@ namespace OpenGL
         uint32_t                   n_components;
         OpenGL::GetSetArgumentType type;
 
+        PropertyData()
+            :data_ptr    (nullptr),
+             n_components(0),
+             type        (OpenGL::GetSetArgumentType::Unknown)
+        {
+            /* Stub */
+        }
+
         PropertyData(const OpenGL::GetSetArgumentType& in_type,
                      const uint32_t&                   in_n_components,
                      const void*                       in_data_ptr)
@@ -118,8 +131,8 @@ namespace OpenGL
         }
     } IndexedPropertyData;
 
-    typedef std::unordered_map<OpenGL::ContextProperty, IndexedPropertyData> IndexedPropertyToArgumentTypeMap;
-    typedef std::unordered_map<OpenGL::ContextProperty, PropertyData>        PropertyToArgumentTypeMap;
+    typedef VKGL::EnumIndexedMap<OpenGL::ContextProperty, IndexedPropertyData> IndexedPropertyToArgumentTypeMap;
+    typedef VKGL::EnumIndexedMap<OpenGL::ContextProperty, PropertyData>        PropertyToArgumentTypeMap;
 }
 
 #include "OpenGL/types_typedefs.h"
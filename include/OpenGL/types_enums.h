@@ -137,6 +137,16 @@ namespace OpenGL
         Unknown
     };
 
+    enum BufferMapBit
+    {
+        BUFFER_MAP_BIT_READ              = 1 << 0,
+        BUFFER_MAP_BIT_WRITE             = 1 << 1,
+        BUFFER_MAP_BIT_INVALIDATE_RANGE  = 1 << 2,
+        BUFFER_MAP_BIT_INVALIDATE_BUFFER = 1 << 3,
+        BUFFER_MAP_BIT_FLUSH_EXPLICIT    = 1 << 4,
+        BUFFER_MAP_BIT_UNSYNCHRONIZED    = 1 << 5
+    };
+
     enum class BufferPointerProperty
     {
         Buffer_Map_Pointer,
@@ -321,6 +331,7 @@ namespace OpenGL
         Max_Sample_Mask_Words,
         Max_Samples,
         Max_Server_Wait_Timeout,
+        Max_Shader_Compiler_Threads,
         Max_Texture_Buffer_Size,
         Max_Texture_Coords,
         Max_Texture_Image_Units,
@@ -990,6 +1001,7 @@ namespace OpenGL
         Active_Uniform_Max_Length,
         Active_Uniforms,
         Attached_Shaders,
+        Completion_Status,
         Delete_Status,
         Geometry_Input_Type,
         Geometry_Output_Type,
@@ -1098,6 +1110,7 @@ namespace OpenGL
     enum class ShaderProperty
     {
         Compile_Status,
+        Completion_Status,
         Delete_Status,
         Info_Log_Length,
         Shader_Source_Length,
@@ -25,6 +25,7 @@ namespace OpenGL
         virtual VKRenderpassManager*    get_renderpass_manager_ptr  () const = 0;
         virtual VKSPIRVManager*         get_spirv_manager_ptr       () const = 0;
         virtual VKSwapchainManager*     get_swapchain_manager_ptr   () const = 0;
+        virtual VKSyncObjectPool*       get_sync_object_pool_ptr    () const = 0;
         virtual VKImageManager*     get_image_manager_ptr   () const = 0;
         virtual ThreadPool*             get_thread_pool_ptr         () const = 0;
     };
@@ -60,30 +61,30 @@ namespace OpenGL
                                           const uint32_t&           in_n_ids,
                                           const GLuint*             in_ids_ptr)    = 0;
 
-        virtual void  buffer_data              (const GLuint&               in_id,
-                                                const GLsizeiptr&           in_size,
-                                                const void*                 in_data_ptr) = 0;
-        virtual void  buffer_sub_data          (const GLuint&               in_id,
-                                                const GLsizeiptr&           in_start_offset,
-                                                const GLsizeiptr&           in_size,
-                                                const void*                 in_data_ptr) = 0;
-        virtual void  copy_buffer_sub_data     (const GLuint&               in_read_buffer_id,
-                                                const GLuint&               in_write_buffer_id,
-                                                const GLintptr&             in_read_offset,
-                                                const GLintptr&             in_write_offset,
-                                                const GLsizeiptr&           in_size) = 0;
-        virtual void  flush_mapped_buffer_range(const GLuint&               in_id,
-                                                const GLintptr&             in_offset,
-                                                const GLsizeiptr&           in_length) = 0;
-        virtual void  get_buffer_sub_data      (const GLuint&               in_id,
-                                                const GLintptr&             in_offset,
-                                                const GLsizeiptr&           in_size,
-                                                void*                       out_data_ptr) = 0;
-        virtual void* map_buffer               (const GLuint&               in_id,
-                                                const OpenGL::BufferAccess& in_access,
-                                                const GLintptr&             in_start_offset,
-                                                const GLsizeiptr&           in_length) = 0;
-        virtual bool  unmap_buffer             (const GLuint&               in_id) = 0;
+        virtual void  buffer_data              (const GLuint&                in_id,
+                                                const GLsizeiptr&            in_size,
+                                                const void*                  in_data_ptr) = 0;
+        virtual void  buffer_sub_data          (const GLuint&                in_id,
+                                                const GLsizeiptr&            in_start_offset,
+                                                const GLsizeiptr&            in_size,
+                                                const void*                  in_data_ptr) = 0;
+        virtual void  copy_buffer_sub_data     (const GLuint&                in_read_buffer_id,
+                                                const GLuint&                in_write_buffer_id,
+                                                const GLintptr&              in_read_offset,
+                                                const GLintptr&              in_write_offset,
+                                                const GLsizeiptr&            in_size) = 0;
+        virtual void  flush_mapped_buffer_range(const GLuint&                in_id,
+                                                const GLintptr&              in_offset,
+                                                const GLsizeiptr&            in_length) = 0;
+        virtual void  get_buffer_sub_data      (const GLuint&                in_id,
+                                                const GLintptr&              in_offset,
+                                                const GLsizeiptr&            in_size,
+                                                void*                        out_data_ptr) = 0;
+        virtual void* map_buffer               (const GLuint&                in_id,
+                                                const OpenGL::BufferMapBits& in_map_bits,
+                                                const GLintptr&              in_start_offset,
+                                                const GLsizeiptr&            in_length) = 0;
+        virtual bool  unmap_buffer             (const GLuint&                in_id) = 0;
 
         virtual void compile_shader  (const GLuint& in_id)         = 0;
         virtual void link_program    (const GLuint& in_program_id) = 0;
@@ -499,6 +500,11 @@ namespace OpenGL
         /* Only callable from within Node::record_commands(), if @param inside_renderpass is true. */
         virtual Anvil::PipelineID get_pipeline_id(const OpenGL::DrawCallMode& in_draw_call_mode) = 0;
 
+        /* Only callable from within Node::record_commands(), if @param inside_renderpass is true. Returns render area the active
+         * renderpass instance has been started with.
+         */
+        virtual VkRect2D get_render_area() const = 0;
+
         //< Provides a list of wait semaphores the node must wait on before proceeding with work.
         //<
         //< Can only be called by nodes reporting true via IVKFrameGraphNode::requires_manual_wait_sem_sync().
@@ -512,6 +518,16 @@ namespace OpenGL
         virtual void set_swapchain_image_acquired_sem        (Anvil::Semaphore*             in_sem_ptr)                 = 0;
 
         //> All functions below describe state associated with the cmd buffer the commands are to be recorded for.
+
+        //< Vertex buffer bindings are tracked as (buffer, offset) pairs. Small GL buffers share VK buffers, so consecutive draws
+        //< often end up using exactly the same bindings. Re-binding can be skipped in such case.
+        virtual bool are_vertex_buffers_bound(const uint32_t&       in_n_bindings,
+                                              Anvil::Buffer* const* in_buffer_ptrs,
+                                              const VkDeviceSize*   in_offsets) const = 0;
+        virtual void set_bound_vertex_buffers(const uint32_t&       in_n_bindings,
+                                              Anvil::Buffer* const* in_buffer_ptrs,
+                                              const VkDeviceSize*   in_offsets)       = 0;
+
         virtual bool get_bound_pipeline_id                             (Anvil::PipelineID* out_result_ptr)      const = 0;
         virtual bool get_bound_dynamic_blend_color_state               (float*             out_result_vec4_ptr) const = 0;
         virtual bool get_bound_dynamic_line_width_state                (float*             out_result_ptr)      const = 0;
@@ -9,6 +9,7 @@ namespace OpenGL
 {
     /* Bitfield type definitions */
     typedef uint32_t BlitMaskBits;
+    typedef uint32_t BufferMapBits;
     typedef uint32_t ClearBufferBits;
     typedef uint32_t WaitSyncBits;
 
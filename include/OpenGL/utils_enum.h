@@ -29,6 +29,10 @@ namespace OpenGL
         OpenGL::BufferAccess get_buffer_access_for_gl_enum(const GLenum&               in_enum);
         GLenum               get_gl_enum_for_buffer_access(const OpenGL::BufferAccess& in_access);
 
+        OpenGL::BufferMapBits get_buffer_map_bits_for_buffer_access(const OpenGL::BufferAccess&  in_access);
+        OpenGL::BufferMapBits get_buffer_map_bits_for_gl_enum      (const GLbitfield&            in_enum);
+        GLbitfield            get_gl_enum_for_buffer_map_bits      (const OpenGL::BufferMapBits& in_bits);
+
         OpenGL::BufferPointerProperty get_buffer_pointer_property_for_gl_enum(const GLenum&                        in_enum);
         GLenum                        get_gl_enum_for_buffer_pointer_property(const OpenGL::BufferPointerProperty& in_property);
 
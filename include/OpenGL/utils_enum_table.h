@@ -0,0 +1,325 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_UTILS_ENUM_TABLE_H
+#define VKGL_UTILS_ENUM_TABLE_H
+
+#include "Common/macros.h"
+#include "OpenGL/types.h"
+
+namespace OpenGL
+{
+    namespace Utils
+    {
+        template<typename InternalEnumType>
+        struct GLEnumMapping
+        {
+            GLenum           gl_enum;
+            InternalEnumType internal_enum;
+        };
+
+        /* Never defined. Calling it from a constexpr context aborts compilation, which is how GLEnumTable reports a bad
+         * mapping list.
+         */
+        void gl_enum_table_is_invalid();
+
+        /* Bidirectional GLenum <-> internal enum lookup table, baked at compile time from a single list of mappings.
+         *
+         * GLenum -> internal enum lookups use a hash-and-displace perfect hash: the GLenum selects a bucket, the bucket's
+         * seed selects a slot, and the slot's key is compared against the GLenum to reject values which are not in the
+         * table. No branching on the GLenum value is involved, however sparse the GLenums are.
+         *
+         * Internal enum -> GLenum lookups index a dense array. Internal enums must be dense, with UNKNOWN as the last value.
+         * If multiple GLenums map to the same internal enum, the first mapping on the list is returned.
+         */
+        template<auto UNKNOWN, size_t N_MAPPINGS>
+        class GLEnumTable
+        {
+        public:
+            /* Public type definitions */
+            typedef decltype(UNKNOWN) InternalEnumType;
+
+            /* Public functions */
+            constexpr GLEnumTable(const GLEnumMapping<InternalEnumType> (&in_mappings)[N_MAPPINGS])
+            {
+                uint32_t bucket_mapping_indices[N_MAPPINGS]    = {}; //< Mapping indices, grouped by bucket.
+                uint32_t bucket_start_indices  [N_BUCKETS + 1] = {};
+                bool     is_bucket_placed      [N_BUCKETS]     = {};
+                bool     is_slot_used          [N_SLOTS]       = {};
+                uint32_t slots                 [N_MAPPINGS]    = {}; //< Slots assigned to the bucket being placed.
+
+                for (uint32_t n_slot = 0;
+                              n_slot < N_SLOTS;
+                            ++n_slot)
+                {
+                    m_slot_gl_enums      [n_slot] = INVALID_GL_ENUM;
+                    m_slot_internal_enums[n_slot] = UNKNOWN;
+                }
+
+                for (uint32_t n_internal_enum = 0;
+                              n_internal_enum < N_INTERNAL_ENUMS + 1;
+                            ++n_internal_enum)
+                {
+                    m_gl_enums[n_internal_enum] = INVALID_GL_ENUM;
+                }
+
+                /* 1. Fill the internal enum -> GLenum array and count GLenums per bucket. */
+                for (uint32_t n_mapping = 0;
+                              n_mapping < N_MAPPINGS;
+                            ++n_mapping)
+                {
+                    const auto internal_enum_index = static_cast<uint32_t>(in_mappings[n_mapping].internal_enum);
+
+                    if (in_mappings[n_mapping].gl_enum == INVALID_GL_ENUM ||
+                        internal_enum_index            >= N_INTERNAL_ENUMS)
+                    {
+                        gl_enum_table_is_invalid();
+                    }
+
+                    if (m_gl_enums[internal_enum_index] == INVALID_GL_ENUM)
+                    {
+                        m_gl_enums[internal_enum_index] = in_mappings[n_mapping].gl_enum;
+                    }
+
+                    bucket_start_indices[get_bucket_index(in_mappings[n_mapping].gl_enum) + 1]++;
+                }
+
+                /* 2. Group mappings by bucket. */
+                for (uint32_t n_bucket = 0;
+                              n_bucket < N_BUCKETS;
+                            ++n_bucket)
+                {
+                    bucket_start_indices[n_bucket + 1] += bucket_start_indices[n_bucket];
+                }
+
+                {
+                    uint32_t n_bucket_mappings_stored[N_BUCKETS] = {};
+
+                    for (uint32_t n_mapping = 0;
+                                  n_mapping < N_MAPPINGS;
+                                ++n_mapping)
+                    {
+                        const uint32_t bucket_index = get_bucket_index(in_mappings[n_mapping].gl_enum);
+
+                        /* Each GLenum may only be listed once. Duplicates always land in the same bucket. */
+                        for (uint32_t n_bucket_mapping = 0;
+                                      n_bucket_mapping < n_bucket_mappings_stored[bucket_index];
+                                    ++n_bucket_mapping)
+                        {
+                            if (in_mappings[bucket_mapping_indices[bucket_start_indices[bucket_index] + n_bucket_mapping] ].gl_enum == in_mappings[n_mapping].gl_enum)
+                            {
+                                gl_enum_table_is_invalid();
+                            }
+                        }
+
+                        bucket_mapping_indices[bucket_start_indices[bucket_index] + n_bucket_mappings_stored[bucket_index]++] = n_mapping;
+                    }
+                }
+
+                /* 3. Find a seed for each bucket which moves all of its GLenums to unused slots. Largest buckets go first,
+                 *    as they are the hardest to place.
+                 */
+                for (uint32_t n_placed_bucket = 0;
+                              n_placed_bucket < N_BUCKETS;
+                            ++n_placed_bucket)
+                {
+                    uint32_t bucket_index      = UINT32_MAX;
+                    uint32_t n_bucket_mappings = 0;
+
+                    for (uint32_t n_bucket = 0;
+                                  n_bucket < N_BUCKETS;
+                                ++n_bucket)
+                    {
+                        const uint32_t n_current_bucket_mappings = bucket_start_indices[n_bucket + 1] - bucket_start_indices[n_bucket];
+
+                        if (!is_bucket_placed[n_bucket]                      &&
+                            (bucket_index              == UINT32_MAX         ||
+                             n_current_bucket_mappings  > n_bucket_mappings) )
+                        {
+                            bucket_index      = n_bucket;
+                            n_bucket_mappings = n_current_bucket_mappings;
+                        }
+                    }
+
+                    is_bucket_placed[bucket_index] = true;
+
+                    if (n_bucket_mappings == 0)
+                    {
+                        break;
+                    }
+
+                    for (uint32_t seed = 1;
+                                  ;
+                                ++seed)
+                    {
+                        const uint32_t* mapping_indices = bucket_mapping_indices + bucket_start_indices[bucket_index];
+                        bool            is_seed_valid   = true;
+
+                        if (seed > MAX_SEED)
+                        {
+                            gl_enum_table_is_invalid();
+                        }
+
+                        for (uint32_t n_bucket_mapping = 0;
+                                      n_bucket_mapping < n_bucket_mappings && is_seed_valid;
+                                    ++n_bucket_mapping)
+                        {
+                            slots[n_bucket_mapping] = get_slot_index(in_mappings[mapping_indices[n_bucket_mapping] ].gl_enum,
+                                                                     get_seed_key(seed) );
+
+                            if (is_slot_used[slots[n_bucket_mapping] ])
+                            {
+                                is_seed_valid = false;
+                            }
+
+                            for (uint32_t n_prev_bucket_mapping = 0;
+                                          n_prev_bucket_mapping < n_bucket_mapping;
+                                        ++n_prev_bucket_mapping)
+                            {
+                                if (slots[n_prev_bucket_mapping] == slots[n_bucket_mapping])
+                                {
+                                    is_seed_valid = false;
+                                }
+                            }
+                        }
+
+                        if (!is_seed_valid)
+                        {
+                            continue;
+                        }
+
+                        for (uint32_t n_bucket_mapping = 0;
+                                      n_bucket_mapping < n_bucket_mappings;
+                                    ++n_bucket_mapping)
+                        {
+                            const auto& mapping = in_mappings[mapping_indices[n_bucket_mapping] ];
+
+                            is_slot_used         [slots[n_bucket_mapping] ] = true;
+                            m_slot_gl_enums      [slots[n_bucket_mapping] ] = mapping.gl_enum;
+                            m_slot_internal_enums[slots[n_bucket_mapping] ] = mapping.internal_enum;
+                        }
+
+                        m_bucket_seeds[bucket_index] = get_seed_key(seed);
+
+                        break;
+                    }
+                }
+            }
+
+            /* Returns UNKNOWN (and asserts) if @param in_gl_enum is not in the table. */
+            InternalEnumType get_internal_enum(const GLenum& in_gl_enum) const
+            {
+                const uint32_t   slot   = get_slot_index(in_gl_enum,
+                                                         m_bucket_seeds[get_bucket_index(in_gl_enum)]);
+                InternalEnumType result = (m_slot_gl_enums[slot] == in_gl_enum) ? m_slot_internal_enums[slot]
+                                                                                 : UNKNOWN;
+
+                vkgl_assert(result != UNKNOWN);
+                return result;
+            }
+
+            /* Returns 0 (and asserts) if @param in_internal_enum has no GLenum assigned. */
+            GLenum get_gl_enum(const InternalEnumType& in_internal_enum) const
+            {
+                const auto internal_enum_index = static_cast<uint32_t>(in_internal_enum);
+                GLenum     result              = 0;
+
+                vkgl_assert(internal_enum_index <= N_INTERNAL_ENUMS);
+
+                result = m_gl_enums[internal_enum_index];
+
+                if (result == INVALID_GL_ENUM)
+                {
+                    vkgl_assert_fail();
+
+                    result = 0;
+                }
+
+                return result;
+            }
+
+            /* Tells whether @param in_gl_enum is in the table. Does not assert. */
+            bool is_gl_enum_supported(const GLenum& in_gl_enum) const
+            {
+                const uint32_t slot = get_slot_index(in_gl_enum,
+                                                     m_bucket_seeds[get_bucket_index(in_gl_enum)]);
+
+                return (m_slot_gl_enums[slot] == in_gl_enum);
+            }
+
+        private:
+            /* Private functions */
+            static constexpr uint32_t get_bucket_index(const GLenum& in_gl_enum)
+            {
+                return reduce(hash(in_gl_enum,
+                                   0), /* in_seed_key */
+                              N_BUCKETS);
+            }
+
+            static constexpr uint32_t get_next_pot(const uint32_t& in_value)
+            {
+                uint32_t result = 1;
+
+                while (result < in_value)
+                {
+                    result <<= 1;
+                }
+
+                return result;
+            }
+
+            /* Seeds are stored pre-scrambled, so that lookups only need to XOR them in. */
+            static constexpr uint32_t get_seed_key(const uint32_t& in_seed)
+            {
+                return in_seed * 0x9E3779B1u;
+            }
+
+            static constexpr uint32_t get_slot_index(const GLenum&   in_gl_enum,
+                                                     const uint32_t& in_seed_key)
+            {
+                return reduce(hash(in_gl_enum,
+                                   in_seed_key),
+                              N_SLOTS);
+            }
+
+            /* Single multiplicative hash. Only its top bits are well mixed, which is what reduce() uses. */
+            static constexpr uint32_t hash(const GLenum&   in_gl_enum,
+                                           const uint32_t& in_seed_key)
+            {
+                return (static_cast<uint32_t>(in_gl_enum) ^ in_seed_key) * 0x85EBCA77u;
+            }
+
+            /* Maps @param in_hash to [0, @param in_range) using its top bits. */
+            static constexpr uint32_t reduce(const uint32_t& in_hash,
+                                             const uint32_t& in_range)
+            {
+                return static_cast<uint32_t>((static_cast<uint64_t>(in_hash) * in_range) >> 32);
+            }
+
+            /* Private variables */
+            static constexpr GLenum   INVALID_GL_ENUM  = UINT32_MAX;
+            static constexpr uint32_t MAX_SEED         = 1 << 16;
+            static constexpr uint32_t N_BUCKETS        = (get_next_pot(N_MAPPINGS) / 4 > 0) ? get_next_pot(N_MAPPINGS) / 4 : 1;
+            static constexpr uint32_t N_INTERNAL_ENUMS = static_cast<uint32_t>(UNKNOWN);
+            static constexpr uint32_t N_SLOTS          = get_next_pot(N_MAPPINGS) * 2;
+
+            uint32_t         m_bucket_seeds       [N_BUCKETS]            = {}; //< Pre-scrambled, see get_seed_key().
+            GLenum           m_gl_enums           [N_INTERNAL_ENUMS + 1] = {}; //< Indexed with internal enums. Last item stands for UNKNOWN.
+            GLenum           m_slot_gl_enums      [N_SLOTS]              = {};
+            InternalEnumType m_slot_internal_enums[N_SLOTS]              = {};
+        };
+
+        /* Use as:
+         *
+         *     static constexpr auto g_table = create_gl_enum_table<OpenGL::BlendEquation::Unknown>( { {GL_FUNC_ADD, OpenGL::BlendEquation::Function_Add}, .. } );
+         */
+        template<auto UNKNOWN, size_t N_MAPPINGS>
+        constexpr GLEnumTable<UNKNOWN, N_MAPPINGS> create_gl_enum_table(const GLEnumMapping<decltype(UNKNOWN)> (&in_mappings)[N_MAPPINGS])
+        {
+            return GLEnumTable<UNKNOWN, N_MAPPINGS>(in_mappings);
+        }
+    }
+}
+
+#endif /* VKGL_UTILS_ENUM_TABLE_H */
@@ -0,0 +1,420 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "benchmark.h"
+#include "vkgl_config.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+
+namespace
+{
+    typedef struct RunResult
+    {
+        double      cpu_time_ns;        //< Per iteration, averaged over threads.
+        double      items_per_second;
+        uint64_t    n_iterations;       //< Per thread.
+        uint32_t    n_threads;
+        std::string name;
+        double      real_time_ns;       //< Per iteration.
+    } RunResult;
+
+    typedef struct ThreadTimes
+    {
+        double   cpu_time_s;
+        uint64_t n_items_processed;
+        double   real_time_s;
+    } ThreadTimes;
+
+    /* A deque, since register_benchmark() hands out references which must survive later registrations. */
+    std::deque<VKGLBenchmark::Registration>& get_registrations()
+    {
+        static std::deque<VKGLBenchmark::Registration> registrations;
+
+        return registrations;
+    }
+
+    double get_thread_cpu_time_s()
+    {
+        timespec time;
+
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID,
+                     &time);
+
+        return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) * 1e-9;
+    }
+
+    void run_once(VKGLBenchmark::Fixture* in_fixture_ptr,
+                  const int64_t&          in_arg,
+                  const uint32_t&         in_n_threads,
+                  const uint64_t&         in_n_iterations,
+                  RunResult*              out_result_ptr)
+    {
+        std::atomic<uint32_t>    n_threads_ready(0);
+        std::vector<std::thread> threads;
+        std::vector<ThreadTimes> thread_times   (in_n_threads);
+
+        const auto thread_func = [&](const uint32_t& in_thread_index)
+        {
+            VKGLBenchmark::State state(in_n_iterations,
+                                       in_arg,
+                                       in_thread_index,
+                                       in_n_threads);
+
+            /* Start all threads at once, so that contended cases are actually contended. */
+            n_threads_ready.fetch_add(1);
+
+            while (n_threads_ready.load() != in_n_threads)
+            {
+                std::this_thread::yield();
+            }
+
+            const auto   start_time     = std::chrono::steady_clock::now();
+            const double start_cpu_time = get_thread_cpu_time_s();
+            {
+                in_fixture_ptr->run(state);
+            }
+            const double end_cpu_time = get_thread_cpu_time_s();
+            const auto   end_time     = std::chrono::steady_clock::now();
+
+            thread_times[in_thread_index].cpu_time_s        = end_cpu_time - start_cpu_time;
+            thread_times[in_thread_index].n_items_processed = state.get_n_items_processed();
+            thread_times[in_thread_index].real_time_s       = std::chrono::duration<double>(end_time - start_time).count();
+        };
+
+        for (uint32_t n_thread = 1;
+                      n_thread < in_n_threads;
+                    ++n_thread)
+        {
+            threads.push_back(
+                std::thread(thread_func,
+                            n_thread)
+            );
+        }
+
+        thread_func(0);
+
+        for (auto& current_thread : threads)
+        {
+            current_thread.join();
+        }
+
+        {
+            double   cpu_time_s        = 0.0;
+            uint64_t n_items_processed = 0;
+            double   real_time_s       = 0.0;
+
+            for (const auto& current_thread_times : thread_times)
+            {
+                cpu_time_s        += current_thread_times.cpu_time_s;
+                n_items_processed += current_thread_times.n_items_processed;
+                real_time_s        = std::max(real_time_s,
+                                              current_thread_times.real_time_s);
+            }
+
+            out_result_ptr->cpu_time_ns      = cpu_time_s  * 1e9 / static_cast<double>(in_n_threads * in_n_iterations);
+            out_result_ptr->items_per_second = (real_time_s > 0.0) ? static_cast<double>(n_items_processed) / real_time_s
+                                                                   : 0.0;
+            out_result_ptr->n_iterations     = in_n_iterations;
+            out_result_ptr->n_threads        = in_n_threads;
+            out_result_ptr->real_time_ns     = real_time_s * 1e9 / static_cast<double>(in_n_iterations);
+        }
+    }
+
+    /* out_result_ptr->name is expected to be set by the caller. */
+    void run_benchmark(const VKGLBenchmark::Registration& in_registration,
+                       const int64_t&                     in_arg,
+                       const uint32_t&                    in_n_threads,
+                       const double&                      in_min_time_s,
+                       RunResult*                         out_result_ptr)
+    {
+        const uint64_t             max_n_iterations = 1000000000ull;
+        auto                       fixture_ptr      = in_registration.get_create_func()();
+        uint64_t                   n_iterations     = 1;
+        const VKGLBenchmark::State setup_state        (0, /* in_n_iterations */
+                                                       in_arg,
+                                                       0, /* in_thread_index */
+                                                       in_n_threads);
+
+        fixture_ptr->set_up(setup_state);
+
+        /* Same growth policy as Google Benchmark: aim for 1.4x the min time, grow at most 10x per attempt. */
+        while (true)
+        {
+            run_once(fixture_ptr.get(),
+                     in_arg,
+                     in_n_threads,
+                     n_iterations,
+                     out_result_ptr);
+
+            const double run_time_s = out_result_ptr->real_time_ns * static_cast<double>(n_iterations) * 1e-9;
+
+            if (run_time_s   >= in_min_time_s ||
+                n_iterations >= max_n_iterations)
+            {
+                break;
+            }
+
+            {
+                const double multiplier = (run_time_s > 0.0) ? std::min(10.0, std::max(1.4 * in_min_time_s / run_time_s, 2.0) )
+                                                             : 10.0;
+
+                n_iterations = std::min(static_cast<uint64_t>(static_cast<double>(n_iterations) * multiplier),
+                                        max_n_iterations);
+            }
+        }
+
+        fixture_ptr->tear_down(setup_state);
+    }
+
+    void write_json(FILE*                         in_file_ptr,
+                    const std::vector<RunResult>& in_results)
+    {
+        char   date_string[64];
+        time_t now = time(nullptr);
+
+        strftime(date_string,
+                 sizeof(date_string),
+                 "%Y-%m-%dT%H:%M:%S",
+                 localtime(&now) );
+
+        fprintf(in_file_ptr,
+                "{\n"
+                "  \"context\": {\n"
+                "    \"date\": \"%s\",\n"
+                "    \"num_cpus\": %ld,\n"
+                "    \"library_build_type\": \"%s\"\n"
+                "  },\n"
+                "  \"benchmarks\": [\n",
+                date_string,
+                sysconf(_SC_NPROCESSORS_ONLN),
+#if defined(_DEBUG)
+                "debug");
+#else
+                "release");
+#endif
+
+        for (size_t n_result = 0;
+                    n_result < in_results.size();
+                  ++n_result)
+        {
+            const auto& current_result = in_results.at(n_result);
+
+            fprintf(in_file_ptr,
+                    "    {\n"
+                    "      \"name\": \"%s\",\n"
+                    "      \"run_name\": \"%s\",\n"
+                    "      \"run_type\": \"iteration\",\n"
+                    "      \"threads\": %u,\n"
+                    "      \"iterations\": %llu,\n"
+                    "      \"real_time\": %.4f,\n"
+                    "      \"cpu_time\": %.4f,\n"
+                    "      \"time_unit\": \"ns\"",
+                    current_result.name.c_str(),
+                    current_result.name.c_str(),
+                    current_result.n_threads,
+                    static_cast<unsigned long long>(current_result.n_iterations),
+                    current_result.real_time_ns,
+                    current_result.cpu_time_ns);
+
+            if (current_result.items_per_second > 0.0)
+            {
+                fprintf(in_file_ptr,
+                        ",\n"
+                        "      \"items_per_second\": %.4f",
+                        current_result.items_per_second);
+            }
+
+            fprintf(in_file_ptr,
+                    "\n"
+                    "    }%s\n",
+                    (n_result + 1 < in_results.size() ) ? "," : "");
+        }
+
+        fprintf(in_file_ptr,
+                "  ]\n"
+                "}\n");
+    }
+
+    void print_console_header()
+    {
+        printf("%-56s %14s %14s %14s %16s\n"
+               "%s\n",
+               "Benchmark",
+               "Time",
+               "CPU",
+               "Iterations",
+               "Items/s",
+               std::string(118, '-').c_str() );
+    }
+
+    void print_console_result(const RunResult& in_result)
+    {
+        printf("%-56s %11.1f ns %11.1f ns %14llu",
+               in_result.name.c_str(),
+               in_result.real_time_ns,
+               in_result.cpu_time_ns,
+               static_cast<unsigned long long>(in_result.n_iterations) );
+
+        if (in_result.items_per_second > 0.0)
+        {
+            printf(" %14.3fM/s",
+                   in_result.items_per_second / 1e6);
+        }
+
+        printf("\n");
+        fflush(stdout);
+    }
+};
+
+VKGLBenchmark::Registration& VKGLBenchmark::register_benchmark(const char*       in_name,
+                                                               FixtureCreateFunc in_create_func)
+{
+    auto& registrations = get_registrations();
+
+    registrations.push_back(
+        Registration(in_name,
+                     in_create_func)
+    );
+
+    return registrations.back();
+}
+
+int main(int argc, char** argv)
+{
+    std::string            filter;
+    bool                   json_to_stdout = false;
+    double                 min_time_s     = 0.5;
+    const char*            out_file_name  = nullptr;
+    int                    result         = EXIT_FAILURE;
+    std::vector<RunResult> results;
+
+    for (int n_arg = 1;
+             n_arg < argc;
+           ++n_arg)
+    {
+        const char* current_arg = argv[n_arg];
+
+        if (strncmp(current_arg, "--benchmark_filter=", strlen("--benchmark_filter=") ) == 0)
+        {
+            filter = current_arg + strlen("--benchmark_filter=");
+        }
+        else
+        if (strcmp(current_arg, "--benchmark_format=json") == 0)
+        {
+            json_to_stdout = true;
+        }
+        else
+        if (strcmp(current_arg, "--benchmark_format=console") == 0)
+        {
+            json_to_stdout = false;
+        }
+        else
+        if (strncmp(current_arg, "--benchmark_min_time=", strlen("--benchmark_min_time=") ) == 0)
+        {
+            min_time_s = atof(current_arg + strlen("--benchmark_min_time=") );
+        }
+        else
+        if (strncmp(current_arg, "--benchmark_out=", strlen("--benchmark_out=") ) == 0)
+        {
+            out_file_name = current_arg + strlen("--benchmark_out=");
+        }
+        else
+        {
+            fprintf(stderr,
+                    "Usage: %s [--benchmark_filter=<substring>] [--benchmark_format=<console|json>]\n"
+                    "          [--benchmark_min_time=<seconds>] [--benchmark_out=<file>]\n",
+                    argv[0]);
+
+            goto end;
+        }
+    }
+
+    if (!json_to_stdout)
+    {
+        print_console_header();
+    }
+
+    for (const auto& current_registration : get_registrations() )
+    {
+        const bool                  has_args  = (current_registration.get_args().size() > 0);
+        const std::vector<int64_t>  args      = (has_args)                                         ? current_registration.get_args()
+                                                                                                   : std::vector<int64_t>(1, 0);
+        const std::vector<uint32_t> n_threads = (current_registration.get_n_threads().size() > 0) ? current_registration.get_n_threads()
+                                                                                                   : std::vector<uint32_t>(1, 1);
+
+        for (const auto& current_arg : args)
+        {
+            for (const auto& current_n_threads : n_threads)
+            {
+                RunResult run_result;
+
+                run_result.name = current_registration.get_name();
+
+                if (has_args)
+                {
+                    run_result.name += "/" + std::to_string(current_arg);
+                }
+
+                run_result.name += "/threads:" + std::to_string(current_n_threads);
+
+                if (filter.size() > 0                           &&
+                    run_result.name.find(filter) == std::string::npos)
+                {
+                    continue;
+                }
+
+                run_benchmark(current_registration,
+                              current_arg,
+                              current_n_threads,
+                              min_time_s,
+                             &run_result);
+
+                if (!json_to_stdout)
+                {
+                    print_console_result(run_result);
+                }
+
+                results.push_back(run_result);
+            }
+        }
+    }
+
+    if (json_to_stdout)
+    {
+        write_json(stdout,
+                   results);
+    }
+
+    if (out_file_name != nullptr)
+    {
+        FILE* file_ptr = fopen(out_file_name,
+                               "w");
+
+        if (file_ptr == nullptr)
+        {
+            fprintf(stderr,
+                    "Could not open [%s] for writing\n",
+                    out_file_name);
+
+            goto end;
+        }
+
+        write_json(file_ptr,
+                   results);
+
+        fclose(file_ptr);
+    }
+
+    result = EXIT_SUCCESS;
+end:
+    return result;
+}
@@ -0,0 +1,203 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#ifndef VKGL_BENCHMARK_H
+#define VKGL_BENCHMARK_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Minimal Google Benchmark-style harness. Benchmarks are fixtures registered with VKGL_BENCHMARK():
+ *
+ *     class RingBufferStashGrab : public VKGLBenchmark::Fixture
+ *     {
+ *         void run(VKGLBenchmark::State& in_state) final
+ *         {
+ *             while (in_state.keep_running() )
+ *             {
+ *                 ...
+ *             }
+ *         }
+ *     };
+ *     VKGL_BENCHMARK(RingBufferStashGrab).threads({1, 2});
+ *
+ * For each argument & thread count combination, the runner creates one fixture, calls set_up(), then calls run() from
+ * every thread at once, growing the iteration count until the run takes at least --benchmark_min_time seconds.
+ * tear_down() is called once measurements are done. run() may therefore be called several times on the same fixture, and
+ * must leave the fixture in a state it can be run from again.
+ *
+ * Times are reported per iteration of a single thread. CPU time is averaged over all threads.
+ *
+ * Supported flags: --benchmark_filter=<substring>, --benchmark_format=<console|json>, --benchmark_out=<file> (JSON) and
+ * --benchmark_min_time=<seconds>. The JSON output follows Google Benchmark's schema, so existing tooling can compare runs.
+ */
+namespace VKGLBenchmark
+{
+    class State
+    {
+    public:
+        /* Public functions */
+        State(const uint64_t& in_n_iterations,
+              const int64_t&  in_arg,
+              const uint32_t& in_thread_index,
+              const uint32_t& in_n_threads)
+            :m_arg                (in_arg),
+             m_n_items_processed  (0),
+             m_n_iterations       (in_n_iterations),
+             m_n_iterations_left  (in_n_iterations),
+             m_n_threads          (in_n_threads),
+             m_thread_index       (in_thread_index)
+        {
+            /* Stub */
+        }
+
+        bool keep_running()
+        {
+            if (m_n_iterations_left == 0)
+            {
+                return false;
+            }
+
+            m_n_iterations_left--;
+
+            return true;
+        }
+
+        const int64_t& get_arg() const
+        {
+            return m_arg;
+        }
+
+        const uint64_t& get_n_items_processed() const
+        {
+            return m_n_items_processed;
+        }
+
+        const uint64_t& get_n_iterations() const
+        {
+            return m_n_iterations;
+        }
+
+        const uint32_t& get_n_threads() const
+        {
+            return m_n_threads;
+        }
+
+        const uint32_t& get_thread_index() const
+        {
+            return m_thread_index;
+        }
+
+        /* Used to report items/s. Defaults to zero, in which case no throughput is reported. */
+        void set_n_items_processed(const uint64_t& in_n_items)
+        {
+            m_n_items_processed = in_n_items;
+        }
+
+    private:
+        /* Private variables */
+        const int64_t  m_arg;
+        uint64_t       m_n_items_processed;
+        const uint64_t m_n_iterations;
+        uint64_t       m_n_iterations_left;
+        const uint32_t m_n_threads;
+        const uint32_t m_thread_index;
+    };
+
+    class Fixture
+    {
+    public:
+        virtual ~Fixture()
+        {
+            /* Stub */
+        }
+
+        /* Called from the main thread. in_state carries the argument & thread count, but no iterations. */
+        virtual void set_up   (const State& in_state)
+        {
+            /* Stub */
+        }
+
+        virtual void tear_down(const State& in_state)
+        {
+            /* Stub */
+        }
+
+        virtual void run(State& in_state) = 0;
+    };
+
+    typedef std::unique_ptr<Fixture>         FixtureUniquePtr;
+    typedef std::function<FixtureUniquePtr()> FixtureCreateFunc;
+
+    class Registration
+    {
+    public:
+        /* Public functions */
+        Registration(const char*       in_name,
+                     FixtureCreateFunc in_create_func)
+            :m_create_func(in_create_func),
+             m_name       (in_name)
+        {
+            /* Stub */
+        }
+
+        /* Runs the benchmark once for each argument. Benchmarks without arguments are reported without the "/<arg>" suffix. */
+        Registration& args(const std::vector<int64_t>& in_args)
+        {
+            m_args = in_args;
+
+            return *this;
+        }
+
+        Registration& threads(const std::vector<uint32_t>& in_n_threads)
+        {
+            m_n_threads = in_n_threads;
+
+            return *this;
+        }
+
+        const std::vector<int64_t>& get_args() const
+        {
+            return m_args;
+        }
+
+        const FixtureCreateFunc& get_create_func() const
+        {
+            return m_create_func;
+        }
+
+        const std::string& get_name() const
+        {
+            return m_name;
+        }
+
+        const std::vector<uint32_t>& get_n_threads() const
+        {
+            return m_n_threads;
+        }
+
+    private:
+        /* Private variables */
+        std::vector<int64_t>  m_args;
+        FixtureCreateFunc     m_create_func;
+        std::string           m_name;
+        std::vector<uint32_t> m_n_threads;
+    };
+
+    Registration& register_benchmark(const char*       in_name,
+                                     FixtureCreateFunc in_create_func);
+};
+
+#define VKGL_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define VKGL_BENCHMARK_CONCAT(a, b)      VKGL_BENCHMARK_CONCAT_IMPL(a, b)
+
+#define VKGL_BENCHMARK(FixtureType)                                                                                     \
+    static VKGLBenchmark::Registration& VKGL_BENCHMARK_CONCAT(g_benchmark_registration_, __LINE__) __attribute__((unused)) = \
+        VKGLBenchmark::register_benchmark(#FixtureType,                                                                 \
+                                          []() { return VKGLBenchmark::FixtureUniquePtr(new FixtureType() ); })
+
+#endif /* VKGL_BENCHMARK_H */
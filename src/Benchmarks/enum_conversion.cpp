@@ -0,0 +1,591 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "benchmark.h"
+#include "Common/macros.h"
+#include "OpenGL/utils_enum.h"
+#include <atomic>
+
+/* GLenum conversion microbenchmarks. EnumConversionTable times OpenGL::Utils' lookup tables, EnumConversionSwitch times
+ * the switch statements they replaced, which are kept below as a baseline.
+ *
+ * Each iteration converts the enums a typical state-heavy draw goes through: buffer binds, a texture bind & upload,
+ * blend & depth state, the draw mode, and the reverse conversions glGet*() queries need.
+ */
+namespace
+{
+    /* Switch-based conversions, as they were before the lookup tables were introduced. The table-based ones live in another
+     * translation unit, so these are kept out-of-line for a fair comparison.
+     */
+    namespace Baseline
+    {
+        __attribute__((noinline)) OpenGL::BlendFunction get_blend_function_for_gl_enum(const GLenum& in_enum)
+        {
+            OpenGL::BlendFunction result = OpenGL::BlendFunction::Unknown;
+
+            switch (in_enum)
+            {
+                case GL_CONSTANT_ALPHA:           result = OpenGL::BlendFunction::Constant_Alpha;           break;
+                case GL_CONSTANT_COLOR:           result = OpenGL::BlendFunction::Constant_Color;           break;
+                case GL_DST_ALPHA:                result = OpenGL::BlendFunction::Dst_Alpha;                break;
+                case GL_DST_COLOR:                result = OpenGL::BlendFunction::Dst_Color;                break;
+                case GL_ONE:                      result = OpenGL::BlendFunction::One;                      break;
+                case GL_ONE_MINUS_CONSTANT_ALPHA: result = OpenGL::BlendFunction::One_Minus_Constant_Alpha; break;
+                case GL_ONE_MINUS_CONSTANT_COLOR: result = OpenGL::BlendFunction::One_Minus_Constant_Color; break;
+                case GL_ONE_MINUS_DST_ALPHA:      result = OpenGL::BlendFunction::One_Minus_Dst_Alpha;      break;
+                case GL_ONE_MINUS_DST_COLOR:      result = OpenGL::BlendFunction::One_Minus_Dst_Color;      break;
+                case GL_ONE_MINUS_SRC_ALPHA:      result = OpenGL::BlendFunction::One_Minus_Src_Alpha;      break;
+                case GL_ONE_MINUS_SRC_COLOR:      result = OpenGL::BlendFunction::One_Minus_Src_Color;      break;
+                case GL_SRC_ALPHA:                result = OpenGL::BlendFunction::Src_Alpha;                break;
+                case GL_SRC_ALPHA_SATURATE:       result = OpenGL::BlendFunction::Src_Alpha_Saturate;       break;
+                case GL_SRC_COLOR:                result = OpenGL::BlendFunction::Src_Color;                break;
+                case GL_ZERO:                     result = OpenGL::BlendFunction::Zero;                     break;
+
+                default:
+                {
+                    vkgl_assert_fail();
+                }
+            }
+
+            return result;
+        }
+
+        __attribute__((noinline)) OpenGL::BufferTarget get_buffer_target_for_gl_enum(const GLenum& in_enum)
+        {
+            OpenGL::BufferTarget result = OpenGL::BufferTarget::Unknown;
+
+            switch (in_enum)
+            {
+                case GL_ARRAY_BUFFER:              result = OpenGL::BufferTarget::Array_Buffer;              break;
+                case GL_COPY_READ_BUFFER:          result = OpenGL::BufferTarget::Copy_Read_Buffer;          break;
+                case GL_COPY_WRITE_BUFFER:         result = OpenGL::BufferTarget::Copy_Write_Buffer;         break;
+                case GL_ELEMENT_ARRAY_BUFFER:      result = OpenGL::BufferTarget::Element_Array_Buffer;      break;
+                case GL_PIXEL_PACK_BUFFER:         result = OpenGL::BufferTarget::Pixel_Pack_Buffer;         break;
+                case GL_PIXEL_UNPACK_BUFFER:       result = OpenGL::BufferTarget::Pixel_Unpack_Buffer;       break;
+                case GL_TEXTURE_BUFFER:            result = OpenGL::BufferTarget::Texture_Buffer;            break;
+                case GL_TRANSFORM_FEEDBACK_BUFFER: result = OpenGL::BufferTarget::Transform_Feedback_Buffer; break;
+                case GL_UNIFORM_BUFFER:            result = OpenGL::BufferTarget::Uniform_Buffer;            break;
+
+                default:
+                {
+                    vkgl_assert_fail();
+                }
+            }
+
+            return result;
+        }
+
+        __attribute__((noinline)) OpenGL::DepthFunction get_depth_function_for_gl_enum(const GLenum& in_enum)
+        {
+            OpenGL::DepthFunction result = OpenGL::DepthFunction::Unknown;
+
+            switch (in_enum)
+            {
+                case GL_ALWAYS:   result = OpenGL::DepthFunction::Always;   break;
+                case GL_EQUAL:    result = OpenGL::DepthFunction::Equal;    break;
+                case GL_GEQUAL:   result = OpenGL::DepthFunction::GEqual;   break;
+                case GL_GREATER:  result = OpenGL::DepthFunction::Greater;  break;
+                case GL_LEQUAL:   result = OpenGL::DepthFunction::LEqual;   break;
+                case GL_LESS:     result = OpenGL::DepthFunction::Less;     break;
+                case GL_NEVER:    result = OpenGL::DepthFunction::Never;    break;
+                case GL_NOTEQUAL: result = OpenGL::DepthFunction::NotEqual; break;
+
+                default:
+                {
+                    vkgl_assert_fail();
+                }
+            }
+
+            return result;
+        }
+
+        __attribute__((noinline)) OpenGL::DrawCallMode get_draw_call_mode_for_gl_enum(const GLenum& in_enum)
+        {
+            OpenGL::DrawCallMode result = OpenGL::DrawCallMode::Unknown;
+
+            switch (in_enum)
+            {
+                default:
+                {
+                    case GL_LINES:                    result = OpenGL::DrawCallMode::Lines;                    break;
+                    case GL_LINES_ADJACENCY:          result = OpenGL::DrawCallMode::Lines_Adjacency;          break;
+                    case GL_LINE_LOOP:                result = OpenGL::DrawCallMode::Line_Loop;                break;
+                    case GL_LINE_STRIP:               result = OpenGL::DrawCallMode::Line_Strip;               break;
+                    case GL_LINE_STRIP_ADJACENCY:     result = OpenGL::DrawCallMode::Line_Strip_Adjacency;     break;
+                    case GL_PATCHES:                  result = OpenGL::DrawCallMode::Patches;                  break;
+                    case GL_POINTS:                   result = OpenGL::DrawCallMode::Points;                   break;
+                    case GL_TRIANGLE_FAN:             result = OpenGL::DrawCallMode::Triangle_Fan;             break;
+                    case GL_TRIANGLE_STRIP:           result = OpenGL::DrawCallMode::Triangle_Strip;           break;
+                    case GL_TRIANGLE_STRIP_ADJACENCY: result = OpenGL::DrawCallMode::Triangle_Strip_Adjacency; break;
+                    case GL_TRIANGLES:                result = OpenGL::DrawCallMode::Triangles;                break;
+                    case GL_TRIANGLES_ADJACENCY:      result = OpenGL::DrawCallMode::Triangles_Adjacency;      break;
+
+                    vkgl_assert_fail();
+                }
+            }
+
+            return result;
+        }
+
+        __attribute__((noinline)) GLenum get_gl_enum_for_buffer_target(const OpenGL::BufferTarget& in_target)
+        {
+            GLenum result = 0;
+
+            switch (in_target)
+            {
+                case OpenGL::BufferTarget::Array_Buffer:              result = GL_ARRAY_BUFFER;              break;
+                case OpenGL::BufferTarget::Copy_Read_Buffer:          result = GL_COPY_READ_BUFFER;          break;
+                case OpenGL::BufferTarget::Copy_Write_Buffer:         result = GL_COPY_WRITE_BUFFER;         break;
+                case OpenGL::BufferTarget::Element_Array_Buffer:      result = GL_ELEMENT_ARRAY_BUFFER;      break;
+                case OpenGL::BufferTarget::Pixel_Pack_Buffer:         result = GL_PIXEL_PACK_BUFFER;         break;
+                case OpenGL::BufferTarget::Pixel_Unpack_Buffer:       result = GL_PIXEL_UNPACK_BUFFER;       break;
+                case OpenGL::BufferTarget::Texture_Buffer:            result = GL_TEXTURE_BUFFER;            break;
+                case OpenGL::BufferTarget::Transform_Feedback_Buffer: result = GL_TRANSFORM_FEEDBACK_BUFFER; break;
+                case OpenGL::BufferTarget::Uniform_Buffer:            result = GL_UNIFORM_BUFFER;            break;
+
+                default:
+                {
+                    vkgl_assert_fail();
+                }
+            }
+
+            return result;
+        }
+
+        __attribute__((noinline)) GLenum get_gl_enum_for_internal_format(const OpenGL::InternalFormat& in_internal_format)
+        {
+            GLenum result = 0;
+
+            switch (in_internal_format)
+            {
+                /* Base internal formats */
+                case OpenGL::InternalFormat::Depth_Component: result = GL_DEPTH_COMPONENT; break;
+                case OpenGL::InternalFormat::Depth_Stencil:   result = GL_DEPTH_STENCIL;   break;
+                case OpenGL::InternalFormat::Red:             result = GL_RED;             break;
+                case OpenGL::InternalFormat::RG:              result = GL_RG;              break;
+                case OpenGL::InternalFormat::RGB:             result = GL_RGB;             break;
+                case OpenGL::InternalFormat::RGBA:            result = GL_RGBA;            break;
+
+                /* Sized internal formats */
+                case OpenGL::InternalFormat::R11F_G11F_B10F: result = GL_R11F_G11F_B10F; break;
+                case OpenGL::InternalFormat::R16:            result = GL_R16;            break;
+                case OpenGL::InternalFormat::R16_SNorm:      result = GL_R16_SNORM;      break;
+                case OpenGL::InternalFormat::R16F:           result = GL_R16F;           break;
+                case OpenGL::InternalFormat::R16I:           result = GL_R16I;           break;
+                case OpenGL::InternalFormat::R16UI:          result = GL_R16UI;          break;
+                case OpenGL::InternalFormat::R3_G3_B2:       result = GL_R3_G3_B2;       break;
+                case OpenGL::InternalFormat::R32F:           result = GL_R32F;           break;
+                case OpenGL::InternalFormat::R32I:           result = GL_R32I;           break;
+                case OpenGL::InternalFormat::R32UI:          result = GL_R32UI;          break;
+                case OpenGL::InternalFormat::R8:             result = GL_R8;             break;
+                case OpenGL::InternalFormat::R8_SNorm:       result = GL_R8_SNORM;       break;
+                case OpenGL::InternalFormat::R8I:            result = GL_R8I;            break;
+                case OpenGL::InternalFormat::R8UI:           result = GL_R8UI;           break;
+                case OpenGL::InternalFormat::RG16:           result = GL_RG16;           break;
+                case OpenGL::InternalFormat::RG16_SNorm:     result = GL_RG16_SNORM;     break;
+                case OpenGL::InternalFormat::RG16F:          result = GL_RG16F;          break;
+                case OpenGL::InternalFormat::RG16I:          result = GL_RG16I;          break;
+                case OpenGL::InternalFormat::RG16UI:         result = GL_RG16UI;         break;
+                case OpenGL::InternalFormat::RG32F:          result = GL_RG32F;          break;
+                case OpenGL::InternalFormat::RG32I:          result = GL_RG32I;          break;
+                case OpenGL::InternalFormat::RG32UI:         result = GL_RG32UI;         break;
+                case OpenGL::InternalFormat::RG8:            result = GL_RG8;            break;
+                case OpenGL::InternalFormat::RG8_SNorm:      result = GL_RG8_SNORM;      break;
+                case OpenGL::InternalFormat::RG8I:           result = GL_RG8I;           break;
+                case OpenGL::InternalFormat::RG8UI:          result = GL_RG8UI;          break;
+                case OpenGL::InternalFormat::RGB10:          result = GL_RGB10;          break;
+                case OpenGL::InternalFormat::RGB10_A2:       result = GL_RGB10_A2;       break;
+                case OpenGL::InternalFormat::RGB10_A2UI:     result = GL_RGB10_A2UI;     break;
+                case OpenGL::InternalFormat::RGB12:          result = GL_RGB12;          break;
+                case OpenGL::InternalFormat::RGB16_SNorm:    result = GL_RGB16_SNORM;    break;
+                case OpenGL::InternalFormat::RGB16F:         result = GL_RGB16F;         break;
+                case OpenGL::InternalFormat::RGB16I:         result = GL_RGB16I;         break;
+                case OpenGL::InternalFormat::RGB16UI:        result = GL_RGB16UI;        break;
+                case OpenGL::InternalFormat::RGB32F:         result = GL_RGB32F;         break;
+                case OpenGL::InternalFormat::RGB32I:         result = GL_RGB32I;         break;
+                case OpenGL::InternalFormat::RGB32UI:        result = GL_RGB32UI;        break;
+                case OpenGL::InternalFormat::RGB4:           result = GL_RGB4;           break;
+                case OpenGL::InternalFormat::RGB5:           result = GL_RGB5;           break;
+                case OpenGL::InternalFormat::RGB5_A1:        result = GL_RGB5_A1;        break;
+                case OpenGL::InternalFormat::RGB8:           result = GL_RGB8;           break;
+                case OpenGL::InternalFormat::RGB8_SNorm:     result = GL_RGB8_SNORM;     break;
+                case OpenGL::InternalFormat::RGB8I:          result = GL_RGB8I;          break;
+                case OpenGL::InternalFormat::RGB8UI:         result = GL_RGB8UI;         break;
+                case OpenGL::InternalFormat::RGB9_E5:        result = GL_RGB9_E5;        break;
+                case OpenGL::InternalFormat::RGBA12:         result = GL_RGBA12;         break;
+                case OpenGL::InternalFormat::RGBA16:         result = GL_RGBA16;         break;
+                case OpenGL::InternalFormat::RGBA16F:        result = GL_RGBA16F;        break;
+                case OpenGL::InternalFormat::RGBA16I:        result = GL_RGBA16I;        break;
+                case OpenGL::InternalFormat::RGBA16UI:       result = GL_RGBA16UI;       break;
+                case OpenGL::InternalFormat::RGBA2:          result = GL_RGBA2;          break;
+                case OpenGL::InternalFormat::RGBA32F:        result = GL_RGBA32F;        break;
+                case OpenGL::InternalFormat::RGBA32I:        result = GL_RGBA32I;        break;
+                case OpenGL::InternalFormat::RGBA32UI:       result = GL_RGBA32UI;       break;
+                case OpenGL::InternalFormat::RGBA4:          result = GL_RGBA4;          break;
+                case OpenGL::InternalFormat::RGBA8:          result = GL_RGBA8;          break;
+                case OpenGL::InternalFormat::RGBA8_SNorm:    result = GL_RGBA8_SNORM;    break;
+                case OpenGL::InternalFormat::RGBA8I:         result = GL_RGBA8I;         break;
+                case OpenGL::InternalFormat::RGBA8UI:        result = GL_RGBA8UI;        break;
+                case OpenGL::InternalFormat::SRGB8:          result = GL_SRGB8;          break;
+                case OpenGL::InternalFormat::SRGB8_Alpha8:   result = GL_SRGB8_ALPHA8;   break;
+
+                /* Compressed internal formats */
+                case OpenGL::InternalFormat::Compressed_Red:                     result = GL_COMPRESSED_RED;                     break;
+                case OpenGL::InternalFormat::Compressed_Red_RGTC1:               result = GL_COMPRESSED_RED_RGTC1;               break;
+                case OpenGL::InternalFormat::Compressed_RG:                      result = GL_COMPRESSED_RG;                      break;
+                case OpenGL::InternalFormat::Compressed_RG_RGTC2:                result = GL_COMPRESSED_RG_RGTC2;                break;
+                case OpenGL::InternalFormat::Compressed_RGB:                     result = GL_COMPRESSED_RGB;                     break;
+                case OpenGL::InternalFormat::Compressed_RGB_BPTC_Signed_Float:   result = GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT;   break;
+                case OpenGL::InternalFormat::Compressed_RGB_BPTC_Unsigned_Float: result = GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT; break;
+                case OpenGL::InternalFormat::Compressed_RGBA:                    result = GL_COMPRESSED_RGBA;                    break;
+                case OpenGL::InternalFormat::Compressed_RGBA_BPTC_UNorm:         result = GL_COMPRESSED_RGBA_BPTC_UNORM;         break;
+                case OpenGL::InternalFormat::Compressed_Signed_Red_RGTC1:        result = GL_COMPRESSED_SIGNED_RED_RGTC1;        break;
+                case OpenGL::InternalFormat::Compressed_Signed_RG_RGTC2:         result = GL_COMPRESSED_SIGNED_RG_RGTC2;         break;
+                case OpenGL::InternalFormat::Compressed_SRGB:                    result = GL_COMPRESSED_SRGB;                    break;
+                case OpenGL::InternalFormat::Compressed_SRGB_Alpha:              result = GL_COMPRESSED_SRGB_ALPHA;              break;
+                case OpenGL::InternalFormat::Compressed_SRGB_Alpha_BPTC_UNorm:   result = GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;   break;
+
+                default:
+                {
+                    vkgl_assert_fail();
+                }
+            }
+
+            return result;
+        }
+
+        __attribute__((noinline)) GLenum get_gl_enum_for_texture_target(const OpenGL::TextureTarget& in_texture_target)
+        {
+            GLenum result = 0;
+
+            switch (in_texture_target)
+            {
+                case OpenGL::TextureTarget::_1D:                                result = GL_TEXTURE_1D;                         break;
+                case OpenGL::TextureTarget::_1D_Array:                          result = GL_TEXTURE_1D_ARRAY;                   break;
+                case OpenGL::TextureTarget::_2D:                                result = GL_TEXTURE_2D;                         break;
+                case OpenGL::TextureTarget::_2D_Array:                          result = GL_TEXTURE_2D_ARRAY;                   break;
+                case OpenGL::TextureTarget::_2D_Multisample:                    result = GL_TEXTURE_2D_MULTISAMPLE;             break;
+                case OpenGL::TextureTarget::_2D_Multisample_Array:              result = GL_TEXTURE_2D_MULTISAMPLE_ARRAY;       break;
+                case OpenGL::TextureTarget::_3D:                                result = GL_TEXTURE_3D;                         break;
+                case OpenGL::TextureTarget::Cube_Map_Negative_X:                result = GL_TEXTURE_CUBE_MAP_NEGATIVE_X;        break;
+                case OpenGL::TextureTarget::Cube_Map_Negative_Y:                result = GL_TEXTURE_CUBE_MAP_NEGATIVE_Y;        break;
+                case OpenGL::TextureTarget::Cube_Map_Negative_Z:                result = GL_TEXTURE_CUBE_MAP_NEGATIVE_Z;        break;
+                case OpenGL::TextureTarget::Cube_Map_Positive_X:                result = GL_TEXTURE_CUBE_MAP_POSITIVE_X;        break;
+                case OpenGL::TextureTarget::Cube_Map_Positive_Y:                result = GL_TEXTURE_CUBE_MAP_POSITIVE_Y;        break;
+                case OpenGL::TextureTarget::Cube_Map_Positive_Z:                result = GL_TEXTURE_CUBE_MAP_POSITIVE_Z;        break;
+                case OpenGL::TextureTarget::Proxy_Texture_1D:                   result = GL_PROXY_TEXTURE_1D;                   break;
+                case OpenGL::TextureTarget::Proxy_Texture_1D_Array:             result = GL_PROXY_TEXTURE_1D_ARRAY;             break;
+                case OpenGL::TextureTarget::Proxy_Texture_2D:                   result = GL_PROXY_TEXTURE_2D;                   break;
+                case OpenGL::TextureTarget::Proxy_Texture_2D_Array:             result = GL_PROXY_TEXTURE_2D_ARRAY;             break;
+                case OpenGL::TextureTarget::Proxy_Texture_2D_Multisample:       result = GL_PROXY_TEXTURE_2D_MULTISAMPLE;       break;
+                case OpenGL::TextureTarget::Proxy_Texture_2D_Multisample_Array: result = GL_PROXY_TEXTURE_2D_MULTISAMPLE_ARRAY; break;
+                case OpenGL::TextureTarget::Proxy_Texture_3D:                   result = GL_PROXY_TEXTURE_3D;                   break;
+                case OpenGL::TextureTarget::Proxy_Texture_Cube_Map:             result = GL_PROXY_TEXTURE_CUBE_MAP;             break;
+                case OpenGL::TextureTarget::Proxy_Texture_Rectangle:            result = GL_PROXY_TEXTURE_RECTANGLE;            break;
+                case OpenGL::TextureTarget::Rectangle:                          result = GL_TEXTURE_RECTANGLE;                  break;
+                case OpenGL::TextureTarget::Texture_Buffer:                     result = GL_TEXTURE_BUFFER;                     break;
+
+                default:
+                {
+                    vkgl_assert_fail();
+                }
+            }
+
+            return result;
+        }
+
+        __attribute__((noinline)) OpenGL::InternalFormat get_internal_format_for_gl_enum(const GLenum& in_enum)
+        {
+            OpenGL::InternalFormat result = OpenGL::InternalFormat::Unknown;
+
+            switch (in_enum)
+            {
+                /* Base internal formats */
+                case GL_DEPTH_COMPONENT: result = OpenGL::InternalFormat::Depth_Component; break;
+                case GL_DEPTH_STENCIL:   result = OpenGL::InternalFormat::Depth_Stencil;   break;
+                case GL_RED:             result = OpenGL::InternalFormat::Red;             break;
+                case GL_RG:              result = OpenGL::InternalFormat::RG;              break;
+                case GL_RGB:             result = OpenGL::InternalFormat::RGB;             break;
+                case GL_RGBA:            result = OpenGL::InternalFormat::RGBA;            break;
+
+                /* Sized internal formats */
+                case GL_DEPTH_COMPONENT32F: result = OpenGL::InternalFormat::Depth_Component32_Float; break;
+                case GL_DEPTH_COMPONENT24: result = OpenGL::InternalFormat::Depth_Component24; break;
+                case GL_DEPTH_COMPONENT16: result = OpenGL::InternalFormat::Depth_Component16; break;
+                case GL_DEPTH32F_STENCIL8: result = OpenGL::InternalFormat::Depth32_Float_Stencil8; break;
+                case GL_DEPTH24_STENCIL8: result = OpenGL::InternalFormat::Depth24_Stencil8; break;
+                case GL_R11F_G11F_B10F: result = OpenGL::InternalFormat::R11F_G11F_B10F; break;
+                case GL_R16:            result = OpenGL::InternalFormat::R16;            break;
+                case GL_R16_SNORM:      result = OpenGL::InternalFormat::R16_SNorm;      break;
+                case GL_R16F:           result = OpenGL::InternalFormat::R16F;           break;
+                case GL_R16I:           result = OpenGL::InternalFormat::R16I;           break;
+                case GL_R16UI:          result = OpenGL::InternalFormat::R16UI;          break;
+                case GL_R3_G3_B2:       result = OpenGL::InternalFormat::R3_G3_B2;       break;
+                case GL_R32F:           result = OpenGL::InternalFormat::R32F;           break;
+                case GL_R32I:           result = OpenGL::InternalFormat::R32I;           break;
+                case GL_R32UI:          result = OpenGL::InternalFormat::R32UI;          break;
+                case GL_R8:             result = OpenGL::InternalFormat::R8;             break;
+                case GL_R8_SNORM:       result = OpenGL::InternalFormat::R8_SNorm;       break;
+                case GL_R8I:            result = OpenGL::InternalFormat::R8I;            break;
+                case GL_R8UI:           result = OpenGL::InternalFormat::R8UI;           break;
+                case GL_RG16:           result = OpenGL::InternalFormat::RG16;           break;
+                case GL_RG16_SNORM:     result = OpenGL::InternalFormat::RG16_SNorm;     break;
+                case GL_RG16F:          result = OpenGL::InternalFormat::RG16F;          break;
+                case GL_RG16I:          result = OpenGL::InternalFormat::RG16I;          break;
+                case GL_RG16UI:         result = OpenGL::InternalFormat::RG16UI;         break;
+                case GL_RG32F:          result = OpenGL::InternalFormat::RG32F;          break;
+                case GL_RG32I:          result = OpenGL::InternalFormat::RG32I;          break;
+                case GL_RG32UI:         result = OpenGL::InternalFormat::RG32UI;         break;
+                case GL_RG8:            result = OpenGL::InternalFormat::RG8;            break;
+                case GL_RG8_SNORM:      result = OpenGL::InternalFormat::RG8_SNorm;      break;
+                case GL_RG8I:           result = OpenGL::InternalFormat::RG8I;           break;
+                case GL_RG8UI:          result = OpenGL::InternalFormat::RG8UI;          break;
+                case GL_RGB10:          result = OpenGL::InternalFormat::RGB10;          break;
+                case GL_RGB10_A2:       result = OpenGL::InternalFormat::RGB10_A2;       break;
+                case GL_RGB10_A2UI:     result = OpenGL::InternalFormat::RGB10_A2UI;     break;
+                case GL_RGB12:          result = OpenGL::InternalFormat::RGB12;          break;
+                case GL_RGB16_SNORM:    result = OpenGL::InternalFormat::RGB16_SNorm;    break;
+                case GL_RGB16F:         result = OpenGL::InternalFormat::RGB16F;         break;
+                case GL_RGB16I:         result = OpenGL::InternalFormat::RGB16I;         break;
+                case GL_RGB16UI:        result = OpenGL::InternalFormat::RGB16UI;        break;
+                case GL_RGB32F:         result = OpenGL::InternalFormat::RGB32F;         break;
+                case GL_RGB32I:         result = OpenGL::InternalFormat::RGB32I;         break;
+                case GL_RGB32UI:        result = OpenGL::InternalFormat::RGB32UI;        break;
+                case GL_RGB4:           result = OpenGL::InternalFormat::RGB4;           break;
+                case GL_RGB5:           result = OpenGL::InternalFormat::RGB5;           break;
+                case GL_RGB5_A1:        result = OpenGL::InternalFormat::RGB5_A1;        break;
+                case GL_RGB8:           result = OpenGL::InternalFormat::RGB8;           break;
+                case GL_RGB8_SNORM:     result = OpenGL::InternalFormat::RGB8_SNorm;     break;
+                case GL_RGB8I:          result = OpenGL::InternalFormat::RGB8I;          break;
+                case GL_RGB8UI:         result = OpenGL::InternalFormat::RGB8UI;         break;
+                case GL_RGB9_E5:        result = OpenGL::InternalFormat::RGB9_E5;        break;
+                case GL_RGBA12:         result = OpenGL::InternalFormat::RGBA12;         break;
+                case GL_RGBA16:         result = OpenGL::InternalFormat::RGBA16;         break;
+                case GL_RGBA16F:        result = OpenGL::InternalFormat::RGBA16F;        break;
+                case GL_RGBA16I:        result = OpenGL::InternalFormat::RGBA16I;        break;
+                case GL_RGBA16UI:       result = OpenGL::InternalFormat::RGBA16UI;       break;
+                case GL_RGBA2:          result = OpenGL::InternalFormat::RGBA2;          break;
+                case GL_RGBA32F:        result = OpenGL::InternalFormat::RGBA32F;        break;
+                case GL_RGBA32I:        result = OpenGL::InternalFormat::RGBA32I;        break;
+                case GL_RGBA32UI:       result = OpenGL::InternalFormat::RGBA32UI;       break;
+                case GL_RGBA4:          result = OpenGL::InternalFormat::RGBA4;          break;
+                case GL_RGBA8:          result = OpenGL::InternalFormat::RGBA8;          break;
+                case GL_RGBA8_SNORM:    result = OpenGL::InternalFormat::RGBA8_SNorm;    break;
+                case GL_RGBA8I:         result = OpenGL::InternalFormat::RGBA8I;         break;
+                case GL_RGBA8UI:        result = OpenGL::InternalFormat::RGBA8UI;        break;
+                case GL_SRGB8:          result = OpenGL::InternalFormat::SRGB8;          break;
+                case GL_SRGB8_ALPHA8:   result = OpenGL::InternalFormat::SRGB8_Alpha8;   break;
+
+                /* Compressed internal formats */
+                case GL_COMPRESSED_RED:                     result = OpenGL::InternalFormat::Compressed_Red;                     break;
+                case GL_COMPRESSED_RED_RGTC1:               result = OpenGL::InternalFormat::Compressed_Red_RGTC1;               break;
+                case GL_COMPRESSED_RG:                      result = OpenGL::InternalFormat::Compressed_RG;                      break;
+                case GL_COMPRESSED_RG_RGTC2:                result = OpenGL::InternalFormat::Compressed_RG_RGTC2;                break;
+                case GL_COMPRESSED_RGB:                     result = OpenGL::InternalFormat::Compressed_RGB;                     break;
+                case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:   result = OpenGL::InternalFormat::Compressed_RGB_BPTC_Signed_Float;   break;
+                case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT: result = OpenGL::InternalFormat::Compressed_RGB_BPTC_Unsigned_Float; break;
+                case GL_COMPRESSED_RGBA:                    result = OpenGL::InternalFormat::Compressed_RGBA;                    break;
+                case GL_COMPRESSED_RGBA_BPTC_UNORM:         result = OpenGL::InternalFormat::Compressed_RGBA_BPTC_UNorm;         break;
+                case GL_COMPRESSED_SIGNED_RED_RGTC1:        result = OpenGL::InternalFormat::Compressed_Signed_Red_RGTC1;        break;
+                case GL_COMPRESSED_SIGNED_RG_RGTC2:         result = OpenGL::InternalFormat::Compressed_Signed_RG_RGTC2;         break;
+                case GL_COMPRESSED_SRGB:                    result = OpenGL::InternalFormat::Compressed_SRGB;                    break;
+                case GL_COMPRESSED_SRGB_ALPHA:              result = OpenGL::InternalFormat::Compressed_SRGB_Alpha;              break;
+                case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:   result = OpenGL::InternalFormat::Compressed_SRGB_Alpha_BPTC_UNorm;   break;
+
+                default:
+                {
+                    vkgl_assert_fail();
+                }
+            }
+
+            return result;
+        }
+
+        __attribute__((noinline)) OpenGL::TextureTarget get_texture_target_for_gl_enum(const GLenum& in_enum)
+        {
+            OpenGL::TextureTarget result = OpenGL::TextureTarget::Unknown;
+
+            switch (in_enum)
+            {
+                case GL_TEXTURE_1D:                         result = OpenGL::TextureTarget::_1D;                                break;
+                case GL_TEXTURE_1D_ARRAY:                   result = OpenGL::TextureTarget::_1D_Array;                          break;
+                case GL_TEXTURE_2D:                         result = OpenGL::TextureTarget::_2D;                                break;
+                case GL_TEXTURE_2D_ARRAY:                   result = OpenGL::TextureTarget::_2D_Array;                          break;
+                case GL_TEXTURE_2D_MULTISAMPLE:             result = OpenGL::TextureTarget::_2D_Multisample;                    break;
+                case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:       result = OpenGL::TextureTarget::_2D_Multisample_Array;              break;
+                case GL_TEXTURE_3D:                         result = OpenGL::TextureTarget::_3D;                                break;
+                case GL_TEXTURE_CUBE_MAP:                   result = OpenGL::TextureTarget::Cube_Map;                           break;
+                case GL_TEXTURE_CUBE_MAP_NEGATIVE_X:        result = OpenGL::TextureTarget::Cube_Map_Negative_X;                break;
+                case GL_TEXTURE_CUBE_MAP_NEGATIVE_Y:        result = OpenGL::TextureTarget::Cube_Map_Negative_Y;                break;
+                case GL_TEXTURE_CUBE_MAP_NEGATIVE_Z:        result = OpenGL::TextureTarget::Cube_Map_Negative_Z;                break;
+                case GL_TEXTURE_CUBE_MAP_POSITIVE_X:        result = OpenGL::TextureTarget::Cube_Map_Positive_X;                break;
+                case GL_TEXTURE_CUBE_MAP_POSITIVE_Y:        result = OpenGL::TextureTarget::Cube_Map_Positive_Y;                break;
+                case GL_TEXTURE_CUBE_MAP_POSITIVE_Z:        result = OpenGL::TextureTarget::Cube_Map_Positive_Z;                break;
+                case GL_PROXY_TEXTURE_1D:                   result = OpenGL::TextureTarget::Proxy_Texture_1D;                   break;
+                case GL_PROXY_TEXTURE_1D_ARRAY:             result = OpenGL::TextureTarget::Proxy_Texture_1D_Array;             break;
+                case GL_PROXY_TEXTURE_2D:                   result = OpenGL::TextureTarget::Proxy_Texture_2D;                   break;
+                case GL_PROXY_TEXTURE_2D_ARRAY:             result = OpenGL::TextureTarget::Proxy_Texture_2D_Array;             break;
+                case GL_PROXY_TEXTURE_2D_MULTISAMPLE:       result = OpenGL::TextureTarget::Proxy_Texture_2D_Multisample;       break;
+                case GL_PROXY_TEXTURE_2D_MULTISAMPLE_ARRAY: result = OpenGL::TextureTarget::Proxy_Texture_2D_Multisample_Array; break;
+                case GL_PROXY_TEXTURE_3D:                   result = OpenGL::TextureTarget::Proxy_Texture_3D;                   break;
+                case GL_PROXY_TEXTURE_CUBE_MAP:             result = OpenGL::TextureTarget::Proxy_Texture_Cube_Map;             break;
+                case GL_PROXY_TEXTURE_RECTANGLE:            result = OpenGL::TextureTarget::Proxy_Texture_Rectangle;            break;
+                case GL_TEXTURE_RECTANGLE:                  result = OpenGL::TextureTarget::Rectangle;                          break;
+                case GL_TEXTURE_BUFFER:                     result = OpenGL::TextureTarget::Texture_Buffer;                     break;
+
+                default:
+                {
+                    vkgl_assert_fail();
+                }
+            }
+
+            return result;
+        }
+    }
+
+    const GLenum g_blend_functions[] =
+    {
+        GL_ONE,
+        GL_ONE_MINUS_SRC_ALPHA,
+        GL_SRC_ALPHA,
+        GL_ZERO,
+    };
+
+    const GLenum g_buffer_targets[] =
+    {
+        GL_ARRAY_BUFFER,
+        GL_ELEMENT_ARRAY_BUFFER,
+        GL_PIXEL_UNPACK_BUFFER,
+        GL_UNIFORM_BUFFER,
+    };
+
+    const GLenum g_depth_functions[] =
+    {
+        GL_ALWAYS,
+        GL_EQUAL,
+        GL_LEQUAL,
+        GL_LESS,
+    };
+
+    const GLenum g_draw_call_modes[] =
+    {
+        GL_LINES,
+        GL_POINTS,
+        GL_TRIANGLE_STRIP,
+        GL_TRIANGLES,
+    };
+
+    const GLenum g_internal_formats[] =
+    {
+        GL_DEPTH24_STENCIL8,
+        GL_DEPTH_COMPONENT32F,
+        GL_R8,
+        GL_RG16F,
+        GL_RGB10_A2,
+        GL_RGBA16F,
+        GL_RGBA8,
+        GL_SRGB8_ALPHA8,
+    };
+
+    const GLenum g_texture_targets[] =
+    {
+        GL_TEXTURE_2D,
+        GL_TEXTURE_2D_ARRAY,
+        GL_TEXTURE_3D,
+        GL_TEXTURE_CUBE_MAP,
+    };
+
+    const uint32_t g_n_conversions_per_iteration = 17; //< Forward & reverse conversions made by each run() iteration.
+
+    template<typename ConversionsType>
+    class EnumConversionFixture : public VKGLBenchmark::Fixture
+    {
+    public:
+        void set_up(const VKGLBenchmark::State& in_state) final
+        {
+            m_result_sum = 0;
+        }
+
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            uint32_t n_iteration = 0;
+            uint32_t result_sum  = 0;
+
+            while (in_state.keep_running() )
+            {
+                const GLenum internal_format = g_internal_formats[n_iteration % (sizeof(g_internal_formats) / sizeof(g_internal_formats[0]) )];
+                const GLenum texture_target  = g_texture_targets [n_iteration % (sizeof(g_texture_targets)  / sizeof(g_texture_targets [0]) )];
+
+                for (uint32_t n_buffer_target = 0;
+                              n_buffer_target < sizeof(g_buffer_targets) / sizeof(g_buffer_targets[0]);
+                            ++n_buffer_target)
+                {
+                    result_sum += static_cast<uint32_t>(ConversionsType::get_buffer_target_for_gl_enum(g_buffer_targets[n_buffer_target]) );
+                }
+
+                result_sum += static_cast<uint32_t>(ConversionsType::get_texture_target_for_gl_enum (texture_target) );
+                result_sum += static_cast<uint32_t>(ConversionsType::get_texture_target_for_gl_enum (texture_target) );
+                result_sum += static_cast<uint32_t>(ConversionsType::get_internal_format_for_gl_enum(internal_format) );
+
+                result_sum += static_cast<uint32_t>(ConversionsType::get_blend_function_for_gl_enum(g_blend_functions[ n_iteration      % (sizeof(g_blend_functions) / sizeof(g_blend_functions[0]) )]) );
+                result_sum += static_cast<uint32_t>(ConversionsType::get_blend_function_for_gl_enum(g_blend_functions[(n_iteration + 1) % (sizeof(g_blend_functions) / sizeof(g_blend_functions[0]) )]) );
+                result_sum += static_cast<uint32_t>(ConversionsType::get_depth_function_for_gl_enum(g_depth_functions[ n_iteration      % (sizeof(g_depth_functions) / sizeof(g_depth_functions[0]) )]) );
+                result_sum += static_cast<uint32_t>(ConversionsType::get_draw_call_mode_for_gl_enum(g_draw_call_modes[ n_iteration      % (sizeof(g_draw_call_modes) / sizeof(g_draw_call_modes[0]) )]) );
+
+                result_sum += ConversionsType::get_gl_enum_for_buffer_target  (ConversionsType::get_buffer_target_for_gl_enum  (g_buffer_targets[n_iteration % (sizeof(g_buffer_targets) / sizeof(g_buffer_targets[0]) )]) );
+                result_sum += ConversionsType::get_gl_enum_for_internal_format(ConversionsType::get_internal_format_for_gl_enum(internal_format) );
+                result_sum += ConversionsType::get_gl_enum_for_texture_target (ConversionsType::get_texture_target_for_gl_enum (texture_target) );
+
+                ++n_iteration;
+            }
+
+            /* Keeps the conversions from being optimized away. */
+            m_result_sum.fetch_add(result_sum,
+                                   std::memory_order_relaxed);
+
+            in_state.set_n_items_processed(in_state.get_n_iterations() * g_n_conversions_per_iteration);
+        }
+
+    private:
+        std::atomic<uint32_t> m_result_sum;
+    };
+
+    struct SwitchConversions
+    {
+        static OpenGL::BlendFunction  get_blend_function_for_gl_enum (const GLenum& in_enum)                            { return Baseline::get_blend_function_for_gl_enum (in_enum);            }
+        static OpenGL::BufferTarget   get_buffer_target_for_gl_enum  (const GLenum& in_enum)                            { return Baseline::get_buffer_target_for_gl_enum  (in_enum);            }
+        static OpenGL::DepthFunction  get_depth_function_for_gl_enum (const GLenum& in_enum)                            { return Baseline::get_depth_function_for_gl_enum (in_enum);            }
+        static OpenGL::DrawCallMode   get_draw_call_mode_for_gl_enum (const GLenum& in_enum)                            { return Baseline::get_draw_call_mode_for_gl_enum (in_enum);            }
+        static GLenum                 get_gl_enum_for_buffer_target  (const OpenGL::BufferTarget&   in_target)          { return Baseline::get_gl_enum_for_buffer_target  (in_target);          }
+        static GLenum                 get_gl_enum_for_internal_format(const OpenGL::InternalFormat& in_internal_format) { return Baseline::get_gl_enum_for_internal_format(in_internal_format); }
+        static GLenum                 get_gl_enum_for_texture_target (const OpenGL::TextureTarget&  in_texture_target)  { return Baseline::get_gl_enum_for_texture_target (in_texture_target);  }
+        static OpenGL::InternalFormat get_internal_format_for_gl_enum(const GLenum& in_enum)                            { return Baseline::get_internal_format_for_gl_enum(in_enum);            }
+        static OpenGL::TextureTarget  get_texture_target_for_gl_enum (const GLenum& in_enum)                            { return Baseline::get_texture_target_for_gl_enum (in_enum);            }
+    };
+
+    struct TableConversions
+    {
+        static OpenGL::BlendFunction  get_blend_function_for_gl_enum (const GLenum& in_enum)                            { return OpenGL::Utils::get_blend_function_for_gl_enum (in_enum);            }
+        static OpenGL::BufferTarget   get_buffer_target_for_gl_enum  (const GLenum& in_enum)                            { return OpenGL::Utils::get_buffer_target_for_gl_enum  (in_enum);            }
+        static OpenGL::DepthFunction  get_depth_function_for_gl_enum (const GLenum& in_enum)                            { return OpenGL::Utils::get_depth_function_for_gl_enum (in_enum);            }
+        static OpenGL::DrawCallMode   get_draw_call_mode_for_gl_enum (const GLenum& in_enum)                            { return OpenGL::Utils::get_draw_call_mode_for_gl_enum (in_enum);            }
+        static GLenum                 get_gl_enum_for_buffer_target  (const OpenGL::BufferTarget&   in_target)          { return OpenGL::Utils::get_gl_enum_for_buffer_target  (in_target);          }
+        static GLenum                 get_gl_enum_for_internal_format(const OpenGL::InternalFormat& in_internal_format) { return OpenGL::Utils::get_gl_enum_for_internal_format(in_internal_format); }
+        static GLenum                 get_gl_enum_for_texture_target (const OpenGL::TextureTarget&  in_texture_target)  { return OpenGL::Utils::get_gl_enum_for_texture_target (in_texture_target);  }
+        static OpenGL::InternalFormat get_internal_format_for_gl_enum(const GLenum& in_enum)                            { return OpenGL::Utils::get_internal_format_for_gl_enum(in_enum);            }
+        static OpenGL::TextureTarget  get_texture_target_for_gl_enum (const GLenum& in_enum)                            { return OpenGL::Utils::get_texture_target_for_gl_enum (in_enum);            }
+    };
+
+    class EnumConversionSwitch : public EnumConversionFixture<SwitchConversions>
+    {
+        /* Stub */
+    };
+    VKGL_BENCHMARK(EnumConversionSwitch);
+
+    class EnumConversionTable : public EnumConversionFixture<TableConversions>
+    {
+        /* Stub */
+    };
+    VKGL_BENCHMARK(EnumConversionTable);
+}
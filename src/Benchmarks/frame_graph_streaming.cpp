@@ -0,0 +1,100 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "OpenGL/frame_graph_benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Frame graph streaming benchmark. Reports how many barriers & sync commands the frame graph emits per frame for
+ * interleaved buffer uploads and reads, and for per-mip image uploads. Runs headless, so it needs a Vulkan ICD but no
+ * display.
+ *
+ * Usage: vkgl_frame_graph_bench [frames] [uploads per frame]
+ *
+ * Defaults to 100 frames, 64 buffer uploads each.
+ */
+int main(int argc, char** argv)
+{
+    uint32_t                          n_frames            = 100;
+    uint32_t                          n_uploads_per_frame = 64;
+    int                               result              = EXIT_FAILURE;
+    OpenGL::FrameGraphBenchmarkResult run_result;
+
+    if (argc > 3)
+    {
+        fprintf(stderr,
+                "Usage: %s [frames] [uploads per frame]\n",
+                argv[0]);
+
+        goto end;
+    }
+
+    if (argc >= 2)
+    {
+        n_frames = static_cast<uint32_t>(strtoul(argv[1], nullptr, 10) );
+
+        if (n_frames == 0)
+        {
+            fprintf(stderr,
+                    "Invalid frame count [%s]\n",
+                    argv[1]);
+
+            goto end;
+        }
+    }
+
+    if (argc == 3)
+    {
+        n_uploads_per_frame = static_cast<uint32_t>(strtoul(argv[2], nullptr, 10) );
+
+        if (n_uploads_per_frame == 0)
+        {
+            fprintf(stderr,
+                    "Invalid upload count [%s]\n",
+                    argv[2]);
+
+            goto end;
+        }
+    }
+
+    /* Do not override a surface size set by the user. */
+    setenv("VKGL_HEADLESS",
+           "1280x720",
+           0); /* overwrite */
+
+    if (vkgl_run_frame_graph_benchmark(n_frames,
+                                       n_uploads_per_frame,
+                                      &run_result) != 0 ||
+        run_result.n_frames                      == 0)
+    {
+        fprintf(stderr,
+                "Could not run the benchmark\n");
+
+        goto end;
+    }
+
+    {
+        const double n_frames_fp = static_cast<double>(run_result.n_frames);
+
+        printf("%u frames, %u buffer uploads + 1 mipmapped image upload per frame, %.3f ms/frame\n",
+               run_result.n_frames,
+               n_uploads_per_frame,
+               run_result.wall_time_ms / n_frames_fp);
+
+        printf("  %-34s %10.2f\n", "vkCmdPipelineBarrier()/frame",     static_cast<double>(run_result.n_pipeline_barrier_cmds)          / n_frames_fp);
+        printf("  %-34s %10.2f\n", "vkCmdSetEvent()/frame",            static_cast<double>(run_result.n_set_event_cmds)                 / n_frames_fp);
+        printf("  %-34s %10.2f\n", "vkCmdWaitEvents()/frame",          static_cast<double>(run_result.n_wait_events_cmds)               / n_frames_fp);
+        printf("  %-34s %10.2f\n", "Buffer barriers/frame",            static_cast<double>(run_result.n_buffer_barriers)                / n_frames_fp);
+        printf("  %-34s %10.2f\n", "Image barriers/frame",             static_cast<double>(run_result.n_image_barriers)                 / n_frames_fp);
+        printf("  %-34s %10.2f\n", "Barriers dropped/frame",           static_cast<double>(run_result.n_barriers_dropped)               / n_frames_fp);
+        printf("  %-34s %10.2f\n", "Barriers merged/frame",            static_cast<double>(run_result.n_barriers_merged)                / n_frames_fp);
+        printf("  %-34s %10.2f\n", "Barriers hoisted/frame",           static_cast<double>(run_result.n_barriers_hoisted)               / n_frames_fp);
+        printf("  %-34s %10.2f\n", "Submissions/frame",                static_cast<double>(run_result.n_submissions)                    / n_frames_fp);
+        printf("  %-34s %10.2f\n", "Submissions w/o reordering/frame", static_cast<double>(run_result.n_submissions_without_reordering) / n_frames_fp);
+    }
+
+    result = EXIT_SUCCESS;
+end:
+    return result;
+}
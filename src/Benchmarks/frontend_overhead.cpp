@@ -0,0 +1,98 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "OpenGL/frontend_benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Frontend overhead benchmark. Runs against the null backend, so it does not need a GPU.
+ *
+ * Usage: vkgl_frontend_bench [state|draw|upload|all] [iterations]
+ *
+ * Defaults to all mixes, 100000 iterations each.
+ */
+int main(int argc, char** argv)
+{
+    const char* const all_mix_names[] = {"state", "draw", "upload"};
+    uint32_t          n_iterations    = 100000;
+    const char*       mix_name        = "all";
+    int               result          = EXIT_FAILURE;
+
+    if (argc > 3)
+    {
+        fprintf(stderr,
+                "Usage: %s [state|draw|upload|all] [iterations]\n",
+                argv[0]);
+
+        goto end;
+    }
+
+    if (argc >= 2)
+    {
+        mix_name = argv[1];
+    }
+
+    if (argc == 3)
+    {
+        n_iterations = static_cast<uint32_t>(strtoul(argv[2], nullptr, 10) );
+
+        if (n_iterations == 0)
+        {
+            fprintf(stderr,
+                    "Invalid iteration count [%s]\n",
+                    argv[2]);
+
+            goto end;
+        }
+    }
+
+    for (const auto& current_mix_name : all_mix_names)
+    {
+        OpenGL::FrontendBenchmarkResult mix_result;
+
+        if (strcmp(mix_name, "all")            != 0 &&
+            strcmp(mix_name, current_mix_name) != 0)
+        {
+            continue;
+        }
+
+        if (vkgl_run_frontend_benchmark(current_mix_name,
+                                        n_iterations,
+                                       &mix_result) != 0)
+        {
+            fprintf(stderr,
+                    "Could not run the [%s] mix\n",
+                    current_mix_name);
+
+            goto end;
+        }
+
+        printf("Mix [%s]: %llu calls, %.1f ns/call, %.2f backend callbacks/call\n",
+               current_mix_name,
+               static_cast<unsigned long long>(mix_result.n_calls),
+               mix_result.ns_per_call,
+               static_cast<double>(mix_result.n_backend_callbacks) / static_cast<double>(mix_result.n_calls) );
+
+        for (const auto& current_entry_point : mix_result.entry_points)
+        {
+            printf("  %-24s %12llu calls %10.1f ns/call\n",
+                   current_entry_point.name,
+                   static_cast<unsigned long long>(current_entry_point.n_calls),
+                   current_entry_point.ns_per_call);
+        }
+
+        result = EXIT_SUCCESS;
+    }
+
+    if (result != EXIT_SUCCESS)
+    {
+        fprintf(stderr,
+                "Unrecognized mix [%s]\n",
+                mix_name);
+    }
+
+end:
+    return result;
+}
@@ -0,0 +1,608 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "benchmark.h"
+#include "Common/fence.h"
+#include "Common/read_mostly_hash_map.h"
+#include "Common/ring_buffer.h"
+#include "Common/semaphore.h"
+#include "Common/shared_mutex.h"
+#include "OpenGL/frontend/gl_buffer_manager.h"
+#include "OpenGL/namespace.h"
+#include <unordered_map>
+
+/* Microbenchmarks for the synchronization & bookkeeping primitives which sit on the app thread's hot paths.
+ *
+ * Object manager & snapshot manager cases run against GLBufferManager, which is the simplest concrete GLObjectManager.
+ * Sizes are picked to match heavy titles: 10k live objects, and up to 1M outstanding references spread across them.
+ */
+namespace
+{
+    const uint32_t g_n_objects              = 10000;
+    const uint32_t g_n_read_mostly_keys_min = 16;
+    const uint32_t g_n_read_mostly_keys_mid = 256;
+    const uint32_t g_n_read_mostly_keys_max = 4096;
+
+    typedef std::unique_ptr<uint32_t> RingBufferItemUniquePtr;
+
+    /* Scatters lookups over all keys, so that they do not always hit the same cache lines. */
+    uint32_t get_read_key(const uint32_t& in_n_iteration,
+                          const uint32_t& in_n_keys)
+    {
+        return (in_n_iteration * 2654435761u) % in_n_keys;
+    }
+
+    void fill_ring_buffer(VKGL::RingBuffer<RingBufferItemUniquePtr>* in_ring_buffer_ptr,
+                          const uint32_t&                            in_n_items)
+    {
+        for (uint32_t n_item = 0;
+                      n_item < in_n_items;
+                    ++n_item)
+        {
+            in_ring_buffer_ptr->stash(RingBufferItemUniquePtr(new uint32_t(n_item) ) );
+        }
+    }
+
+    void drain_ring_buffer(VKGL::RingBuffer<RingBufferItemUniquePtr>* in_ring_buffer_ptr,
+                           const uint32_t&                            in_n_items)
+    {
+        for (uint32_t n_item = 0;
+                      n_item < in_n_items;
+                    ++n_item)
+        {
+            in_ring_buffer_ptr->grab();
+        }
+    }
+
+    /* RingBuffer */
+
+    class RingBufferStashGrab : public VKGLBenchmark::Fixture
+    {
+    public:
+        RingBufferStashGrab()
+            :m_ring_buffer(10) /* in_n_max_items_log_2 */
+        {
+            /* Stub */
+        }
+
+        void set_up(const VKGLBenchmark::State&) final
+        {
+            fill_ring_buffer(&m_ring_buffer,
+                             512);
+        }
+
+        void tear_down(const VKGLBenchmark::State&) final
+        {
+            drain_ring_buffer(&m_ring_buffer,
+                              512);
+        }
+
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            while (in_state.keep_running() )
+            {
+                m_ring_buffer.stash(m_ring_buffer.grab() );
+            }
+
+            in_state.set_n_items_processed(in_state.get_n_iterations() );
+        }
+
+    private:
+        VKGL::RingBuffer<RingBufferItemUniquePtr> m_ring_buffer;
+    };
+    VKGL_BENCHMARK(RingBufferStashGrab);
+
+    /* Thread 0 produces, thread 1 consumes. Items travel back to the producer through a second ring buffer, so that the
+     * measurement does not include heap allocations.
+     */
+    class RingBufferProducerConsumer : public VKGLBenchmark::Fixture
+    {
+    public:
+        RingBufferProducerConsumer()
+            :m_free_items  (10), /* in_n_max_items_log_2 */
+             m_queued_items(10)  /* in_n_max_items_log_2 */
+        {
+            /* Stub */
+        }
+
+        void set_up(const VKGLBenchmark::State&) final
+        {
+            fill_ring_buffer(&m_free_items,
+                             256);
+        }
+
+        void tear_down(const VKGLBenchmark::State&) final
+        {
+            drain_ring_buffer(&m_free_items,
+                              256);
+        }
+
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            auto& src_ring_buffer = (in_state.get_thread_index() == 0) ? m_free_items   : m_queued_items;
+            auto& dst_ring_buffer = (in_state.get_thread_index() == 0) ? m_queued_items : m_free_items;
+
+            while (in_state.keep_running() )
+            {
+                dst_ring_buffer.stash(src_ring_buffer.grab() );
+            }
+
+            in_state.set_n_items_processed(in_state.get_n_iterations() );
+        }
+
+    private:
+        VKGL::RingBuffer<RingBufferItemUniquePtr> m_free_items;
+        VKGL::RingBuffer<RingBufferItemUniquePtr> m_queued_items;
+    };
+    VKGL_BENCHMARK(RingBufferProducerConsumer).threads({2});
+
+    /* SharedMutex */
+
+    class SharedMutexReadLock : public VKGLBenchmark::Fixture
+    {
+    public:
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            while (in_state.keep_running() )
+            {
+                m_mutex.lock_shared  ();
+                m_mutex.unlock_shared();
+            }
+        }
+
+    private:
+        VKGL::SharedMutex m_mutex;
+    };
+    VKGL_BENCHMARK(SharedMutexReadLock).threads({1, 2, 4, 8});
+
+    class SharedMutexWriteLock : public VKGLBenchmark::Fixture
+    {
+    public:
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            while (in_state.keep_running() )
+            {
+                m_mutex.lock_unique  ();
+                m_mutex.unlock_unique();
+            }
+        }
+
+    private:
+        VKGL::SharedMutex m_mutex;
+    };
+    VKGL_BENCHMARK(SharedMutexWriteLock).threads({1, 2, 4});
+
+    /* Cache lookups, one insert+erase for every 64 lookups. Arg: number of keys in the cache.
+     *
+     * SharedMutexReadMostly guards a std::unordered_map with VKGL::SharedMutex, like the renderpass, framebuffer & SPIR-V
+     * caches used to. ReadMostlyHashMapLookup runs the same access pattern against VKGL::ReadMostlyHashMap.
+     */
+    class SharedMutexReadMostly : public VKGLBenchmark::Fixture
+    {
+    public:
+        void set_up(const VKGLBenchmark::State& in_state) final
+        {
+            m_n_hits = 0;
+            m_n_keys = static_cast<uint32_t>(in_state.get_arg() );
+
+            for (uint32_t n_key = 0;
+                          n_key < m_n_keys;
+                        ++n_key)
+            {
+                m_map[n_key] = n_key;
+            }
+        }
+
+        void tear_down(const VKGLBenchmark::State& in_state) final
+        {
+            m_map.clear();
+        }
+
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            /* Each thread inserts & erases its own key, so the map size stays constant. */
+            const uint32_t written_key = m_n_keys + in_state.get_thread_index();
+            uint32_t       n_hits      = 0;
+            uint32_t       n_iteration = 0;
+
+            while (in_state.keep_running() )
+            {
+                if ((n_iteration++ % 64) == 0)
+                {
+                    m_mutex.lock_unique  ();
+                    {
+                        m_map[written_key] = written_key;
+                        m_map.erase(written_key);
+                    }
+                    m_mutex.unlock_unique();
+                }
+                else
+                {
+                    m_mutex.lock_shared  ();
+                    {
+                        n_hits += (m_map.find(get_read_key(n_iteration, m_n_keys) ) != m_map.end() ) ? 1 : 0;
+                    }
+                    m_mutex.unlock_shared();
+                }
+            }
+
+            /* Keeps the lookups from being optimized away. */
+            m_n_hits.fetch_add(n_hits,
+                               std::memory_order_relaxed);
+        }
+
+    private:
+        std::unordered_map<uint32_t, uint32_t> m_map;
+        VKGL::SharedMutex                      m_mutex;
+        std::atomic<uint32_t>                  m_n_hits;
+        uint32_t                               m_n_keys;
+    };
+    VKGL_BENCHMARK(SharedMutexReadMostly).args({g_n_read_mostly_keys_min, g_n_read_mostly_keys_mid, g_n_read_mostly_keys_max}).threads({2, 4, 8});
+
+    class ReadMostlyHashMapLookup : public VKGLBenchmark::Fixture
+    {
+    public:
+        void set_up(const VKGLBenchmark::State& in_state) final
+        {
+            m_map_ptr.reset(new VKGL::ReadMostlyHashMap<uint32_t, uint32_t>() );
+            m_n_hits = 0;
+            m_n_keys = static_cast<uint32_t>(in_state.get_arg() );
+
+            for (uint32_t n_key = 0;
+                          n_key < m_n_keys;
+                        ++n_key)
+            {
+                m_map_ptr->insert(n_key,
+                                  n_key);
+            }
+        }
+
+        void tear_down(const VKGLBenchmark::State& in_state) final
+        {
+            m_map_ptr.reset();
+        }
+
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            /* Each thread inserts & erases its own key, so the map size stays constant. */
+            const uint32_t written_key = m_n_keys + in_state.get_thread_index();
+            uint32_t       n_hits      = 0;
+            uint32_t       n_iteration = 0;
+
+            while (in_state.keep_running() )
+            {
+                if ((n_iteration++ % 64) == 0)
+                {
+                    m_map_ptr->insert(written_key,
+                                      written_key);
+                    m_map_ptr->erase (written_key);
+                }
+                else
+                {
+                    n_hits += (m_map_ptr->find(get_read_key(n_iteration, m_n_keys),
+                                               nullptr) ) ? 1 : 0; /* out_opt_value_ptr */
+                }
+            }
+
+            /* Keeps the lookups from being optimized away. */
+            m_n_hits.fetch_add(n_hits,
+                               std::memory_order_relaxed);
+        }
+
+    private:
+        std::unique_ptr<VKGL::ReadMostlyHashMap<uint32_t, uint32_t> > m_map_ptr;
+        std::atomic<uint32_t>                                         m_n_hits;
+        uint32_t                                                      m_n_keys;
+    };
+    VKGL_BENCHMARK(ReadMostlyHashMapLookup).args({g_n_read_mostly_keys_min, g_n_read_mostly_keys_mid, g_n_read_mostly_keys_max}).threads({2, 4, 8});
+
+    /* Semaphore & Fence */
+
+    class SemaphoreSignalWait : public VKGLBenchmark::Fixture
+    {
+    public:
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            while (in_state.keep_running() )
+            {
+                m_semaphore.signal();
+                m_semaphore.wait  ();
+            }
+        }
+
+    private:
+        VKGL::Semaphore m_semaphore;
+    };
+    VKGL_BENCHMARK(SemaphoreSignalWait);
+
+    /* Round trip between two threads, as seen by the app thread handing work over to the backend & waiting for it. */
+    class SemaphorePingPong : public VKGLBenchmark::Fixture
+    {
+    public:
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            const bool is_pinger = (in_state.get_thread_index() == 0);
+
+            while (in_state.keep_running() )
+            {
+                if (is_pinger)
+                {
+                    m_ping_semaphore.signal();
+                    m_pong_semaphore.wait  ();
+                }
+                else
+                {
+                    m_ping_semaphore.wait  ();
+                    m_pong_semaphore.signal();
+                }
+            }
+        }
+
+    private:
+        VKGL::Semaphore m_ping_semaphore;
+        VKGL::Semaphore m_pong_semaphore;
+    };
+    VKGL_BENCHMARK(SemaphorePingPong).threads({2});
+
+    class FenceSignalWait : public VKGLBenchmark::Fixture
+    {
+    public:
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            while (in_state.keep_running() )
+            {
+                VKGL::Fence fence;
+
+                fence.signal();
+                fence.wait  ();
+            }
+        }
+    };
+    VKGL_BENCHMARK(FenceSignalWait);
+
+    /* Waits on an already signalled fence, which is what most waits for completed frames boil down to. */
+    class FenceWaitSignalled : public VKGLBenchmark::Fixture
+    {
+    public:
+        void set_up(const VKGLBenchmark::State&) final
+        {
+            m_fence.signal();
+        }
+
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            while (in_state.keep_running() )
+            {
+                m_fence.wait();
+            }
+        }
+
+    private:
+        VKGL::Fence m_fence;
+    };
+    VKGL_BENCHMARK(FenceWaitSignalled).threads({1, 4});
+
+    /* Namespace. Arg: number of IDs allocated & released per iteration. */
+
+    class NamespaceAllocateRelease : public VKGLBenchmark::Fixture
+    {
+    public:
+        NamespaceAllocateRelease()
+            :m_namespace(1) /* in_start_id */
+        {
+            /* Stub */
+        }
+
+        void set_up(const VKGLBenchmark::State& in_state) final
+        {
+            m_ids.resize(static_cast<size_t>(in_state.get_arg() ) );
+        }
+
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            const uint32_t n_ids = static_cast<uint32_t>(m_ids.size() );
+
+            while (in_state.keep_running() )
+            {
+                m_namespace.allocate(n_ids,
+                                     m_ids.data() );
+                m_namespace.release (n_ids,
+                                     m_ids.data() );
+            }
+
+            in_state.set_n_items_processed(in_state.get_n_iterations() * n_ids);
+        }
+
+    private:
+        std::vector<GLuint> m_ids;
+        OpenGL::Namespace   m_namespace;
+    };
+    VKGL_BENCHMARK(NamespaceAllocateRelease).args({1, 64, g_n_objects});
+
+    /* GLObjectManager */
+
+    class ObjectManagerFixture : public VKGLBenchmark::Fixture
+    {
+    public:
+        void set_up(const VKGLBenchmark::State&) override
+        {
+            m_manager_ptr = OpenGL::GLBufferManager::create();
+            vkgl_assert(m_manager_ptr != nullptr);
+
+            m_ids.resize(g_n_objects);
+
+            m_manager_ptr->generate_ids(g_n_objects,
+                                        m_ids.data() );
+
+            for (const auto& current_id : m_ids)
+            {
+                m_manager_ptr->mark_id_as_alive(current_id);
+            }
+        }
+
+        void tear_down(const VKGLBenchmark::State&) override
+        {
+            m_manager_ptr->delete_ids(g_n_objects,
+                                      m_ids.data() );
+
+            m_manager_ptr.reset();
+        }
+
+    protected:
+        std::vector<GLuint>              m_ids;
+        OpenGL::GLBufferManagerUniquePtr m_manager_ptr;
+    };
+
+    /* Arg: number of IDs generated & deleted per iteration, on top of the 10k live objects. */
+    class ObjectManagerGenDelete : public ObjectManagerFixture
+    {
+    public:
+        void set_up(const VKGLBenchmark::State& in_state) final
+        {
+            ObjectManagerFixture::set_up(in_state);
+
+            m_batch_ids.resize(static_cast<size_t>(in_state.get_arg() ) );
+        }
+
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            const uint32_t n_ids = static_cast<uint32_t>(m_batch_ids.size() );
+
+            while (in_state.keep_running() )
+            {
+                m_manager_ptr->generate_ids(n_ids,
+                                            m_batch_ids.data() );
+                m_manager_ptr->delete_ids  (n_ids,
+                                            m_batch_ids.data() );
+            }
+
+            in_state.set_n_items_processed(in_state.get_n_iterations() * n_ids);
+        }
+
+    private:
+        std::vector<GLuint> m_batch_ids;
+    };
+    VKGL_BENCHMARK(ObjectManagerGenDelete).args({1, 64, g_n_objects});
+
+    /* Every thread walks the live objects with a different stride, so that lookups do not hit the same entries in lockstep. */
+    class ObjectManagerIsAlive : public ObjectManagerFixture
+    {
+    public:
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            const uint32_t stride = 7919 * (in_state.get_thread_index() + 1);
+            uint32_t       n_id   = 0;
+
+            while (in_state.keep_running() )
+            {
+                const bool is_alive = m_manager_ptr->is_alive_id(m_ids[n_id]);
+
+                vkgl_assert(is_alive);
+                (void) is_alive;
+
+                n_id = (n_id + stride) % g_n_objects;
+            }
+        }
+    };
+    VKGL_BENCHMARK(ObjectManagerIsAlive).threads({1, 4});
+
+    /* Snapshot manager. Arg: number of references held on each of the 10k objects while measuring (100 -> 1M total). */
+
+    class SnapshotManagerFixture : public ObjectManagerFixture
+    {
+    public:
+        void set_up(const VKGLBenchmark::State& in_state) override
+        {
+            ObjectManagerFixture::set_up(in_state);
+
+            m_held_reference_ptrs.reserve(static_cast<size_t>(in_state.get_arg() ) * g_n_objects);
+
+            for (int64_t n_reference = 0;
+                         n_reference < in_state.get_arg();
+                       ++n_reference)
+            {
+                for (const auto& current_id : m_ids)
+                {
+                    m_held_reference_ptrs.push_back(
+                        m_manager_ptr->acquire_always_latest_snapshot_reference(current_id)
+                    );
+                }
+            }
+        }
+
+        void tear_down(const VKGLBenchmark::State& in_state) override
+        {
+            /* Release references newest-first, so that each release finds its reference at the back of the list. */
+            while (m_held_reference_ptrs.size() > 0)
+            {
+                m_held_reference_ptrs.pop_back();
+            }
+
+            ObjectManagerFixture::tear_down(in_state);
+        }
+
+    protected:
+        std::vector<OpenGL::GLBufferReferenceUniquePtr> m_held_reference_ptrs;
+    };
+
+    class SnapshotManagerAcquireReleaseToT : public SnapshotManagerFixture
+    {
+    public:
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            /* Threads work on disjoint objects. */
+            const uint32_t n_objects_per_thread = g_n_objects / in_state.get_n_threads();
+            const uint32_t first_object         = n_objects_per_thread * in_state.get_thread_index();
+            uint32_t       n_object             = 0;
+
+            while (in_state.keep_running() )
+            {
+                auto reference_ptr = m_manager_ptr->acquire_always_latest_snapshot_reference(m_ids[first_object + n_object]);
+
+                reference_ptr.reset();
+
+                n_object = (n_object + 1) % n_objects_per_thread;
+            }
+        }
+    };
+    VKGL_BENCHMARK(SnapshotManagerAcquireReleaseToT).args({0, 100}).threads({1, 4});
+
+    class SnapshotManagerAcquireReleaseCurrent : public SnapshotManagerFixture
+    {
+    public:
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            uint32_t n_object = 0;
+
+            while (in_state.keep_running() )
+            {
+                auto reference_ptr = m_manager_ptr->acquire_current_latest_snapshot_reference(m_ids[n_object]);
+
+                reference_ptr.reset();
+
+                n_object = (n_object + 1) % g_n_objects;
+            }
+        }
+    };
+    VKGL_BENCHMARK(SnapshotManagerAcquireReleaseCurrent).args({0, 100});
+
+    /* Each iteration modifies an object, which publishes a new snapshot. */
+    class SnapshotManagerUpdate : public SnapshotManagerFixture
+    {
+    public:
+        void run(VKGLBenchmark::State& in_state) final
+        {
+            uint32_t n_iteration = 0;
+
+            while (in_state.keep_running() )
+            {
+                m_manager_ptr->set_buffer_store_size(m_ids[n_iteration % g_n_objects],
+                                                     1024 + ((n_iteration / g_n_objects) & 1) );
+
+                n_iteration++;
+            }
+        }
+    };
+    VKGL_BENCHMARK(SnapshotManagerUpdate).args({0, 100});
+};
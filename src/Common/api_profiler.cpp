@@ -0,0 +1,406 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "Common/api_profiler.h"
+#include "Common/macros.h"
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#define DEFAULT_PROFILE_FILE_NAME "vkgl_api_profile.txt"
+
+static const uint32_t g_n_histogram_buckets = 32;   //< Bucket N counts calls which took [2^N, 2^(N+1) ) ticks. The last one is open-ended.
+static const uint32_t g_n_max_entry_points  = 2048; //< Comfortably above the number of GL entry points VKGL exposes.
+
+static bool is_enabled_in_environment()
+{
+    const char* env_value_ptr = getenv("VKGL_API_PROFILER");
+
+    return (env_value_ptr != nullptr         &&
+            strcmp(env_value_ptr, "0") != 0);
+}
+
+std::atomic<bool> VKGL::g_api_profiler_enabled(is_enabled_in_environment() );
+
+namespace
+{
+    /* Single writer (the owning thread), so updates are plain relaxed load + store pairs. */
+    typedef struct EntryPointCounters
+    {
+        std::atomic<uint64_t> histogram[g_n_histogram_buckets];
+        std::atomic<uint64_t> n_calls;
+        std::atomic<uint64_t> n_ticks;
+
+        EntryPointCounters()
+            :n_calls(0),
+             n_ticks(0)
+        {
+            for (auto& current_bucket : histogram)
+            {
+                current_bucket.store(0,
+                                     std::memory_order_relaxed);
+            }
+        }
+    } EntryPointCounters;
+
+    typedef struct ThreadRecord
+    {
+        std::atomic<EntryPointCounters*> counters_ptrs[g_n_max_entry_points]; //< Indexed with entry point IDs. Allocated on first use.
+        std::atomic<bool>                in_use;
+
+        ThreadRecord()
+            :in_use(true)
+        {
+            for (auto& current_counters_ptr : counters_ptrs)
+            {
+                current_counters_ptr.store(nullptr,
+                                           std::memory_order_relaxed);
+            }
+        }
+    } ThreadRecord;
+
+    typedef struct EntryPointTotals
+    {
+        uint64_t histogram[g_n_histogram_buckets];
+        uint64_t n_calls;
+        uint64_t n_ticks;
+    } EntryPointTotals;
+
+    typedef struct Profiler
+    {
+        const char*                entry_point_names[g_n_max_entry_points];
+        std::atomic<uint32_t>      n_entry_points;
+        std::mutex                 mutex;
+        std::vector<ThreadRecord*> thread_record_ptrs;
+
+        /* Only accessed by on_frame_presented(). */
+        FILE*                         file_ptr;
+        bool                          is_file_open_failed;
+        uint64_t                      n_frame;
+        std::vector<EntryPointTotals> prev_totals;
+        bool                          was_enabled;
+
+        Profiler()
+            :n_entry_points     (0),
+             file_ptr           (nullptr),
+             is_file_open_failed(false),
+             n_frame            (0),
+             prev_totals        (g_n_max_entry_points),
+             was_enabled        (false)
+        {
+            memset(entry_point_names,
+                   0,
+                   sizeof(entry_point_names) );
+            memset(prev_totals.data(),
+                   0,
+                   sizeof(EntryPointTotals) * prev_totals.size() );
+        }
+    } Profiler;
+
+    /* NOTE: Intentionally leaked. Thread records are released from TLS destructors, which may run after static destructors
+     *       at process exit.
+     */
+    Profiler* get_profiler()
+    {
+        static Profiler* profiler_ptr = new Profiler();
+
+        return profiler_ptr;
+    }
+
+    class ThreadRecordHolder
+    {
+    public:
+        ThreadRecordHolder()
+            :m_record_ptr(nullptr)
+        {
+            auto                        profiler_ptr = get_profiler();
+            std::lock_guard<std::mutex> lock        (profiler_ptr->mutex);
+
+            /* Counters of a released record are taken over as they are. They only ever grow, so per-frame deltas stay
+             * correct.
+             */
+            for (auto current_record_ptr : profiler_ptr->thread_record_ptrs)
+            {
+                bool expected_in_use = false;
+
+                if (current_record_ptr->in_use.compare_exchange_strong(expected_in_use,
+                                                                       true) )
+                {
+                    m_record_ptr = current_record_ptr;
+
+                    break;
+                }
+            }
+
+            if (m_record_ptr == nullptr)
+            {
+                m_record_ptr = new ThreadRecord();
+
+                profiler_ptr->thread_record_ptrs.push_back(m_record_ptr);
+            }
+        }
+
+        ~ThreadRecordHolder()
+        {
+            m_record_ptr->in_use.store(false,
+                                       std::memory_order_release);
+        }
+
+        ThreadRecord* get()
+        {
+            return m_record_ptr;
+        }
+
+    private:
+        ThreadRecord* m_record_ptr;
+    };
+
+    ThreadRecord* get_thread_record()
+    {
+        static thread_local ThreadRecordHolder holder;
+
+        return holder.get();
+    }
+
+    uint32_t get_entry_point_id(VKGL::APIProfilerEntryPoint* in_entry_point_ptr)
+    {
+        uint32_t result = in_entry_point_ptr->id.load(std::memory_order_acquire);
+
+        if (result == UINT32_MAX)
+        {
+            auto                        profiler_ptr = get_profiler();
+            std::lock_guard<std::mutex> lock        (profiler_ptr->mutex);
+
+            result = in_entry_point_ptr->id.load(std::memory_order_relaxed);
+
+            if (result                                                       == UINT32_MAX &&
+                profiler_ptr->n_entry_points.load(std::memory_order_relaxed) <  g_n_max_entry_points)
+            {
+                result = profiler_ptr->n_entry_points.load(std::memory_order_relaxed);
+
+                profiler_ptr->entry_point_names[result] = in_entry_point_ptr->name;
+
+                profiler_ptr->n_entry_points.store(result + 1,
+                                                   std::memory_order_release);
+                in_entry_point_ptr->id.store      (result,
+                                                   std::memory_order_release);
+            }
+        }
+
+        return result;
+    }
+
+    uint32_t get_histogram_bucket(const uint64_t& in_n_ticks)
+    {
+        uint32_t result = 0;
+
+        #if defined(__GNUC__) || defined(__clang__)
+        {
+            result = (in_n_ticks != 0) ? 63 - __builtin_clzll(in_n_ticks)
+                                       : 0;
+        }
+        #else
+        {
+            for (uint64_t n_ticks = in_n_ticks >> 1;
+                          n_ticks != 0;
+                          n_ticks >>= 1)
+            {
+                ++result;
+            }
+        }
+        #endif
+
+        if (result >= g_n_histogram_buckets)
+        {
+            result = g_n_histogram_buckets - 1;
+        }
+
+        return result;
+    }
+
+    void increment(std::atomic<uint64_t>& inout_counter,
+                   const uint64_t&        in_value)
+    {
+        inout_counter.store(inout_counter.load(std::memory_order_relaxed) + in_value,
+                            std::memory_order_relaxed);
+    }
+
+    bool open_file(Profiler* in_profiler_ptr)
+    {
+        const char* file_name_ptr = getenv("VKGL_API_PROFILER_FILE");
+
+        if (in_profiler_ptr->file_ptr            != nullptr ||
+            in_profiler_ptr->is_file_open_failed)
+        {
+            goto end;
+        }
+
+        if (file_name_ptr == nullptr)
+        {
+            file_name_ptr = DEFAULT_PROFILE_FILE_NAME;
+        }
+
+        in_profiler_ptr->file_ptr = fopen(file_name_ptr,
+                                          "w");
+
+        if (in_profiler_ptr->file_ptr == nullptr)
+        {
+            vkgl_printf("Could not open API profiler output file [%s]",
+                        file_name_ptr);
+
+            in_profiler_ptr->is_file_open_failed = true;
+
+            goto end;
+        }
+
+        fprintf(in_profiler_ptr->file_ptr,
+                "# frame entry_point n_calls n_ticks [bucket:n_calls ...]\n"
+                "# Calls in bucket N took [2^N, 2^(N+1)) ticks. Ticks are %s.\n",
+                #if defined(_WIN32) || defined(__x86_64__) || defined(__i386__)
+                    "TSC cycles"
+                #elif defined(__aarch64__)
+                    "generic timer (CNTVCT_EL0) counts"
+                #else
+                    "nanoseconds"
+                #endif
+               );
+
+    end:
+        return (in_profiler_ptr->file_ptr != nullptr);
+    }
+}
+
+
+void VKGL::APIProfiler::on_frame_presented()
+{
+    auto       profiler_ptr   = get_profiler();
+    const bool is_enabled_now = is_enabled();
+    uint32_t   n_entry_points = 0;
+
+    /* One more pass after the profiler has been disabled, so that calls made before it was turned off get flushed. */
+    if (!is_enabled_now && !profiler_ptr->was_enabled)
+    {
+        goto end;
+    }
+
+    if (!open_file(profiler_ptr) )
+    {
+        goto end;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(profiler_ptr->mutex);
+
+        n_entry_points = profiler_ptr->n_entry_points.load(std::memory_order_acquire);
+
+        for (uint32_t n_entry_point = 0;
+                      n_entry_point < n_entry_points;
+                    ++n_entry_point)
+        {
+            EntryPointTotals  totals        = {};
+            EntryPointTotals& prev_totals   = profiler_ptr->prev_totals.at(n_entry_point);
+            uint64_t          n_frame_calls = 0;
+
+            for (const auto current_record_ptr : profiler_ptr->thread_record_ptrs)
+            {
+                const auto counters_ptr = current_record_ptr->counters_ptrs[n_entry_point].load(std::memory_order_acquire);
+
+                if (counters_ptr == nullptr)
+                {
+                    continue;
+                }
+
+                for (uint32_t n_bucket = 0;
+                              n_bucket < g_n_histogram_buckets;
+                            ++n_bucket)
+                {
+                    totals.histogram[n_bucket] += counters_ptr->histogram[n_bucket].load(std::memory_order_relaxed);
+                }
+
+                totals.n_calls += counters_ptr->n_calls.load(std::memory_order_relaxed);
+                totals.n_ticks += counters_ptr->n_ticks.load(std::memory_order_relaxed);
+            }
+
+            n_frame_calls = totals.n_calls - prev_totals.n_calls;
+
+            if (n_frame_calls == 0)
+            {
+                continue;
+            }
+
+            fprintf(profiler_ptr->file_ptr,
+                    "%llu %s %llu %llu",
+                    static_cast<unsigned long long>(profiler_ptr->n_frame),
+                    profiler_ptr->entry_point_names[n_entry_point],
+                    static_cast<unsigned long long>(n_frame_calls),
+                    static_cast<unsigned long long>(totals.n_ticks - prev_totals.n_ticks) );
+
+            for (uint32_t n_bucket = 0;
+                          n_bucket < g_n_histogram_buckets;
+                        ++n_bucket)
+            {
+                const uint64_t n_bucket_calls = totals.histogram[n_bucket] - prev_totals.histogram[n_bucket];
+
+                if (n_bucket_calls != 0)
+                {
+                    fprintf(profiler_ptr->file_ptr,
+                            " %u:%llu",
+                            n_bucket,
+                            static_cast<unsigned long long>(n_bucket_calls) );
+                }
+            }
+
+            fprintf(profiler_ptr->file_ptr,
+                    "\n");
+
+            prev_totals = totals;
+        }
+    }
+
+    profiler_ptr->n_frame++;
+
+end:
+    profiler_ptr->was_enabled = is_enabled_now;
+}
+
+void VKGL::APIProfiler::record_call(APIProfilerEntryPoint* in_entry_point_ptr,
+                                    const uint64_t&        in_n_ticks)
+{
+    const uint32_t      entry_point_id = get_entry_point_id(in_entry_point_ptr);
+    auto                record_ptr     = get_thread_record();
+    EntryPointCounters* counters_ptr   = nullptr;
+
+    if (entry_point_id == UINT32_MAX)
+    {
+        /* Out of entry point slots. */
+        vkgl_assert_fail();
+
+        goto end;
+    }
+
+    counters_ptr = record_ptr->counters_ptrs[entry_point_id].load(std::memory_order_relaxed);
+
+    if (counters_ptr == nullptr)
+    {
+        counters_ptr = new EntryPointCounters();
+
+        record_ptr->counters_ptrs[entry_point_id].store(counters_ptr,
+                                                        std::memory_order_release);
+    }
+
+    increment(counters_ptr->histogram[get_histogram_bucket(in_n_ticks)], 1);
+    increment(counters_ptr->n_calls,                                      1);
+    increment(counters_ptr->n_ticks,                                      in_n_ticks);
+
+end:
+    ;
+}
+
+void VKGL::APIProfiler::set_enabled(const bool& in_enabled)
+{
+    g_api_profiler_enabled.store(in_enabled,
+                                 std::memory_order_relaxed);
+}
@@ -0,0 +1,211 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "Common/epoch.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    typedef struct ThreadRecord
+    {
+        std::atomic<uint64_t> epoch;   //< Epoch the owning thread entered its read-side section at, or 0 if it is not reading.
+        std::atomic<bool>     in_use;  //< False if the owning thread has exited and the record can be handed out again.
+        uint32_t              n_nested_reads;
+
+        ThreadRecord()
+            :epoch         (0),
+             in_use        (true),
+             n_nested_reads(0)
+        {
+            /* Stub */
+        }
+    } ThreadRecord;
+
+    typedef struct RetiredObject
+    {
+        VKGL::EpochDeleterFunc deleter_func;
+        void*                  object_ptr;
+        uint64_t               retire_epoch;
+
+        RetiredObject(void*                  in_object_ptr,
+                      VKGL::EpochDeleterFunc in_deleter_func,
+                      const uint64_t&        in_retire_epoch)
+            :deleter_func(in_deleter_func),
+             object_ptr  (in_object_ptr),
+             retire_epoch(in_retire_epoch)
+        {
+            /* Stub */
+        }
+    } RetiredObject;
+
+    typedef struct EpochDomain
+    {
+        std::atomic<uint64_t>      current_epoch;
+        std::mutex                 mutex;
+        std::vector<RetiredObject> retired_objects;
+        std::vector<ThreadRecord*> thread_record_ptrs;
+
+        EpochDomain()
+            :current_epoch(1)
+        {
+            /* Stub */
+        }
+    } EpochDomain;
+
+    /* NOTE: The domain is intentionally leaked. Thread records are released from TLS destructors, which may run after
+     *       static destructors at process exit.
+     */
+    EpochDomain* get_domain()
+    {
+        static EpochDomain* domain_ptr = new EpochDomain();
+
+        return domain_ptr;
+    }
+
+    class ThreadRecordHolder
+    {
+    public:
+        ThreadRecordHolder()
+            :m_record_ptr(nullptr)
+        {
+            auto                        domain_ptr = get_domain();
+            std::lock_guard<std::mutex> lock      (domain_ptr->mutex);
+
+            for (auto current_record_ptr : domain_ptr->thread_record_ptrs)
+            {
+                bool expected_in_use = false;
+
+                if (current_record_ptr->in_use.compare_exchange_strong(expected_in_use,
+                                                                       true) )
+                {
+                    m_record_ptr = current_record_ptr;
+
+                    break;
+                }
+            }
+
+            if (m_record_ptr == nullptr)
+            {
+                m_record_ptr = new ThreadRecord();
+
+                domain_ptr->thread_record_ptrs.push_back(m_record_ptr);
+            }
+        }
+
+        ~ThreadRecordHolder()
+        {
+            m_record_ptr->n_nested_reads = 0;
+
+            m_record_ptr->epoch.store (0,
+                                       std::memory_order_release);
+            m_record_ptr->in_use.store(false,
+                                       std::memory_order_release);
+        }
+
+        ThreadRecord* get()
+        {
+            return m_record_ptr;
+        }
+
+    private:
+        ThreadRecord* m_record_ptr;
+    };
+
+    ThreadRecord* get_thread_record()
+    {
+        static thread_local ThreadRecordHolder holder;
+
+        return holder.get();
+    }
+}
+
+void VKGL::Epoch::enter_read()
+{
+    auto record_ptr = get_thread_record();
+
+    if (record_ptr->n_nested_reads++ == 0)
+    {
+        record_ptr->epoch.store(get_domain()->current_epoch.load(std::memory_order_acquire),
+                                std::memory_order_relaxed);
+
+        /* Publish the epoch before any shared pointer is loaded. Pairs with the seq_cst loads in reclaim(). */
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+void VKGL::Epoch::leave_read()
+{
+    auto record_ptr = get_thread_record();
+
+    if (--record_ptr->n_nested_reads == 0)
+    {
+        record_ptr->epoch.store(0,
+                                std::memory_order_release);
+    }
+}
+
+void VKGL::Epoch::reclaim()
+{
+    auto                       domain_ptr = get_domain();
+    std::vector<RetiredObject> objects_to_release;
+
+    {
+        std::lock_guard<std::mutex> lock            (domain_ptr->mutex);
+        uint64_t                    min_active_epoch(UINT64_MAX);
+
+        if (domain_ptr->retired_objects.size() == 0)
+        {
+            return;
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        for (const auto current_record_ptr : domain_ptr->thread_record_ptrs)
+        {
+            const auto record_epoch = current_record_ptr->epoch.load(std::memory_order_seq_cst);
+
+            if (record_epoch != 0)
+            {
+                min_active_epoch = std::min(min_active_epoch,
+                                            record_epoch);
+            }
+        }
+
+        /* An object retired at epoch N may still be seen by readers which entered at epoch <= N. */
+        auto release_iterator = std::partition(domain_ptr->retired_objects.begin(),
+                                               domain_ptr->retired_objects.end  (),
+                                               [min_active_epoch](const RetiredObject& in_object)
+                                               {
+                                                   return in_object.retire_epoch >= min_active_epoch;
+                                               });
+
+        objects_to_release.assign(release_iterator,
+                                  domain_ptr->retired_objects.end() );
+
+        domain_ptr->retired_objects.erase(release_iterator,
+                                          domain_ptr->retired_objects.end() );
+    }
+
+    for (auto& current_object : objects_to_release)
+    {
+        current_object.deleter_func(current_object.object_ptr);
+    }
+}
+
+void VKGL::Epoch::retire(void*            in_object_ptr,
+                         EpochDeleterFunc in_deleter_func)
+{
+    auto                        domain_ptr = get_domain();
+    std::lock_guard<std::mutex> lock      (domain_ptr->mutex);
+
+    domain_ptr->retired_objects.push_back(
+        RetiredObject(in_object_ptr,
+                      in_deleter_func,
+                      domain_ptr->current_epoch.fetch_add(1,
+                                                          std::memory_order_seq_cst) )
+    );
+}
@@ -16,13 +16,21 @@ VKGL::Fence::~Fence()
     /* Stub */
 }
 
+bool VKGL::Fence::is_signaled()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_flag;
+}
+
 void VKGL::Fence::signal()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
     m_flag = true;
 
-    m_condition.notify_one();
+    /* Waits do not reset the flag, so every waiter needs to be released. */
+    m_condition.notify_all();
 }
 
 void VKGL::Fence::wait()
@@ -3,6 +3,7 @@
  * This code is licensed under MIT license (see LICENSE.txt for details)
  */
 #include "Common/shared_mutex.h"
+#include <climits>
 
 static const unsigned g_write_entered = 1U << (sizeof(unsigned) * CHAR_BIT - 1);
 static const unsigned g_n_readers     = ~g_write_entered;
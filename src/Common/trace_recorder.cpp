@@ -0,0 +1,437 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "Common/trace_recorder.h"
+#include "Common/logger.h"
+#include "Common/macros.h"
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#define DEFAULT_TRACE_FILE_NAME "vkgl_trace.json"
+
+static const uint32_t g_n_ring_events = 16384; //< Per thread. Must be a power of two.
+static const uint32_t g_cpu_pid       = 1;
+static const uint32_t g_gpu_pid       = 2;
+
+static bool is_enabled_in_environment()
+{
+    const char* env_value_ptr = getenv("VKGL_TRACE");
+
+    return (env_value_ptr != nullptr         &&
+            strcmp(env_value_ptr, "0") != 0);
+}
+
+std::atomic<bool> VKGL::g_trace_recorder_enabled(is_enabled_in_environment() );
+
+namespace
+{
+    typedef struct Event
+    {
+        uint64_t    end_time_us;
+        uint32_t    gpu_track_id;  //< UINT32_MAX for CPU events, which go to the recording thread's track.
+        const char* name;
+        uint64_t    start_time_us;
+    } Event;
+
+    /* Single-producer (the owning thread), single-consumer (on_frame_presented(), under the recorder's mutex) ring. */
+    typedef struct ThreadRecord
+    {
+        std::atomic<Event*>   events_ptr;       //< Allocated by the owning thread on first use.
+        std::atomic<bool>     in_use;
+        std::atomic<uint64_t> n_events_dropped;
+        std::atomic<uint64_t> n_events_read;
+        std::atomic<uint64_t> n_events_written;
+        const uint32_t        tid;
+
+        /* NOTE: Guarded by the recorder's mutex. */
+        bool        is_name_dirty;
+        std::string name;
+        uint64_t    n_events_dropped_reported;
+
+        ThreadRecord(const uint32_t& in_tid)
+            :events_ptr               (nullptr),
+             in_use                   (true),
+             n_events_dropped         (0),
+             n_events_read            (0),
+             n_events_written         (0),
+             tid                      (in_tid),
+             is_name_dirty            (true),
+             n_events_dropped_reported(0)
+        {
+            /* Stub */
+        }
+    } ThreadRecord;
+
+    typedef struct Recorder
+    {
+        std::vector<std::string>   gpu_track_names;
+        std::mutex                 mutex;
+        std::vector<ThreadRecord*> thread_record_ptrs;
+
+        /* Only accessed by on_frame_presented(). */
+        FILE*    file_ptr;
+        bool     is_file_open_failed;
+        uint32_t n_gpu_track_names_written;
+        bool     was_enabled;
+
+        Recorder()
+            :file_ptr                 (nullptr),
+             is_file_open_failed      (false),
+             n_gpu_track_names_written(0),
+             was_enabled              (false)
+        {
+            /* Stub */
+        }
+    } Recorder;
+
+    /* NOTE: Intentionally leaked. Thread records are released from TLS destructors, which may run after static destructors
+     *       at process exit.
+     */
+    Recorder* get_recorder()
+    {
+        static Recorder* recorder_ptr = new Recorder();
+
+        return recorder_ptr;
+    }
+
+    class ThreadRecordHolder
+    {
+    public:
+        ThreadRecordHolder()
+            :m_record_ptr(nullptr)
+        {
+            auto                        recorder_ptr = get_recorder();
+            std::lock_guard<std::mutex> lock        (recorder_ptr->mutex);
+
+            /* Events left behind in a released record are drained as usual. Only the track name is reset. */
+            for (auto current_record_ptr : recorder_ptr->thread_record_ptrs)
+            {
+                bool expected_in_use = false;
+
+                if (current_record_ptr->in_use.compare_exchange_strong(expected_in_use,
+                                                                       true) )
+                {
+                    m_record_ptr = current_record_ptr;
+
+                    m_record_ptr->is_name_dirty = true;
+                    m_record_ptr->name.clear();
+
+                    break;
+                }
+            }
+
+            if (m_record_ptr == nullptr)
+            {
+                m_record_ptr = new ThreadRecord(static_cast<uint32_t>(recorder_ptr->thread_record_ptrs.size() + 1) );
+
+                recorder_ptr->thread_record_ptrs.push_back(m_record_ptr);
+            }
+        }
+
+        ~ThreadRecordHolder()
+        {
+            m_record_ptr->in_use.store(false,
+                                       std::memory_order_release);
+        }
+
+        ThreadRecord* get()
+        {
+            return m_record_ptr;
+        }
+
+    private:
+        ThreadRecord* m_record_ptr;
+    };
+
+    ThreadRecord* get_thread_record()
+    {
+        static thread_local ThreadRecordHolder holder;
+
+        return holder.get();
+    }
+
+    void append_event(const char*     in_name,
+                      const uint64_t& in_start_time_us,
+                      const uint64_t& in_end_time_us,
+                      const uint32_t& in_gpu_track_id)
+    {
+        auto           record_ptr       = get_thread_record();
+        Event*         events_ptr       = record_ptr->events_ptr.load(std::memory_order_relaxed);
+        const uint64_t n_events_written = record_ptr->n_events_written.load(std::memory_order_relaxed);
+        Event*         event_ptr        = nullptr;
+
+        if (events_ptr == nullptr)
+        {
+            events_ptr = new Event[g_n_ring_events];
+
+            record_ptr->events_ptr.store(events_ptr,
+                                         std::memory_order_release);
+        }
+
+        if (n_events_written - record_ptr->n_events_read.load(std::memory_order_acquire) >= g_n_ring_events)
+        {
+            record_ptr->n_events_dropped.store(record_ptr->n_events_dropped.load(std::memory_order_relaxed) + 1,
+                                               std::memory_order_relaxed);
+
+            goto end;
+        }
+
+        event_ptr = events_ptr + (n_events_written & (g_n_ring_events - 1) );
+
+        event_ptr->end_time_us   = in_end_time_us;
+        event_ptr->gpu_track_id  = in_gpu_track_id;
+        event_ptr->name          = in_name;
+        event_ptr->start_time_us = in_start_time_us;
+
+        record_ptr->n_events_written.store(n_events_written + 1,
+                                           std::memory_order_release);
+
+    end:
+        ;
+    }
+
+    /* Names are expected to be plain ASCII. Anything which would break the JSON is replaced. */
+    void write_json_string(FILE*       in_file_ptr,
+                           const char* in_string_ptr)
+    {
+        fputc('"',
+              in_file_ptr);
+
+        for (const char* current_char_ptr = in_string_ptr;
+                        *current_char_ptr != 0;
+                       ++current_char_ptr)
+        {
+            const char current_char = *current_char_ptr;
+
+            fputc((current_char == '"' || current_char == '\\' || static_cast<unsigned char>(current_char) < 0x20) ? '_'
+                                                                                                                  : current_char,
+                  in_file_ptr);
+        }
+
+        fputc('"',
+              in_file_ptr);
+    }
+
+    void write_metadata_event(FILE*           in_file_ptr,
+                              const char*     in_metadata_name_ptr,
+                              const uint32_t& in_pid,
+                              const uint32_t& in_tid,
+                              const char*     in_value_ptr)
+    {
+        fprintf(in_file_ptr,
+                "{\"name\":\"%s\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":",
+                in_metadata_name_ptr,
+                in_pid,
+                in_tid);
+
+        write_json_string(in_file_ptr,
+                          in_value_ptr);
+
+        fprintf(in_file_ptr,
+                "}},\n");
+    }
+
+    bool open_file(Recorder* in_recorder_ptr)
+    {
+        const char* file_name_ptr = getenv("VKGL_TRACE_FILE");
+
+        if (in_recorder_ptr->file_ptr            != nullptr ||
+            in_recorder_ptr->is_file_open_failed)
+        {
+            goto end;
+        }
+
+        if (file_name_ptr == nullptr)
+        {
+            file_name_ptr = DEFAULT_TRACE_FILE_NAME;
+        }
+
+        in_recorder_ptr->file_ptr = fopen(file_name_ptr,
+                                          "w");
+
+        if (in_recorder_ptr->file_ptr == nullptr)
+        {
+            vkgl_printf("Could not open trace output file [%s]",
+                        file_name_ptr);
+
+            in_recorder_ptr->is_file_open_failed = true;
+
+            goto end;
+        }
+
+        fprintf(in_recorder_ptr->file_ptr,
+                "[\n");
+
+        write_metadata_event(in_recorder_ptr->file_ptr,
+                             "process_name",
+                             g_cpu_pid,
+                             0, /* in_tid */
+                             "VKGL");
+        write_metadata_event(in_recorder_ptr->file_ptr,
+                             "process_name",
+                             g_gpu_pid,
+                             0, /* in_tid */
+                             "GPU");
+
+    end:
+        return (in_recorder_ptr->file_ptr != nullptr);
+    }
+}
+
+
+uint32_t VKGL::TraceRecorder::create_gpu_track(const std::string& in_name)
+{
+    auto                        recorder_ptr = get_recorder();
+    std::lock_guard<std::mutex> lock        (recorder_ptr->mutex);
+
+    recorder_ptr->gpu_track_names.push_back(in_name);
+
+    return static_cast<uint32_t>(recorder_ptr->gpu_track_names.size() - 1);
+}
+
+void VKGL::TraceRecorder::on_frame_presented()
+{
+    auto       recorder_ptr   = get_recorder();
+    const bool is_enabled_now = is_enabled();
+    FILE*      file_ptr       = nullptr;
+
+    /* One more pass after the recorder has been disabled, so that events recorded before it was turned off get flushed. */
+    if (!is_enabled_now && !recorder_ptr->was_enabled)
+    {
+        goto end;
+    }
+
+    if (open_file(recorder_ptr) )
+    {
+        file_ptr = recorder_ptr->file_ptr;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(recorder_ptr->mutex);
+
+        if (file_ptr != nullptr)
+        {
+            for (;
+                 recorder_ptr->n_gpu_track_names_written < static_cast<uint32_t>(recorder_ptr->gpu_track_names.size() );
+               ++recorder_ptr->n_gpu_track_names_written)
+            {
+                write_metadata_event(file_ptr,
+                                     "thread_name",
+                                     g_gpu_pid,
+                                     recorder_ptr->n_gpu_track_names_written + 1, /* in_tid */
+                                     recorder_ptr->gpu_track_names.at(recorder_ptr->n_gpu_track_names_written).c_str() );
+            }
+        }
+
+        for (auto current_record_ptr : recorder_ptr->thread_record_ptrs)
+        {
+            const auto     events_ptr       = current_record_ptr->events_ptr.load      (std::memory_order_acquire);
+            const uint64_t n_events_dropped = current_record_ptr->n_events_dropped.load(std::memory_order_relaxed);
+            const uint64_t n_events_written = current_record_ptr->n_events_written.load(std::memory_order_acquire);
+            uint64_t       n_event          = current_record_ptr->n_events_read.load   (std::memory_order_relaxed);
+
+            if (file_ptr                          != nullptr &&
+                current_record_ptr->is_name_dirty)
+            {
+                const std::string default_name = "Thread " + std::to_string(current_record_ptr->tid);
+
+                write_metadata_event(file_ptr,
+                                     "thread_name",
+                                     g_cpu_pid,
+                                     current_record_ptr->tid,
+                                     (current_record_ptr->name.size() > 0) ? current_record_ptr->name.c_str()
+                                                                            : default_name.c_str() );
+
+                current_record_ptr->is_name_dirty = false;
+            }
+
+            for (;
+                 n_event < n_events_written && file_ptr != nullptr;
+               ++n_event)
+            {
+                const Event& current_event = events_ptr[n_event & (g_n_ring_events - 1)];
+
+                fprintf(file_ptr,
+                        "{\"name\":");
+
+                write_json_string(file_ptr,
+                                  current_event.name);
+
+                fprintf(file_ptr,
+                        ",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,\"ts\":%llu,\"dur\":%llu},\n",
+                        (current_event.gpu_track_id == UINT32_MAX) ? g_cpu_pid                        : g_gpu_pid,
+                        (current_event.gpu_track_id == UINT32_MAX) ? current_record_ptr->tid          : current_event.gpu_track_id + 1,
+                        static_cast<unsigned long long>(current_event.start_time_us),
+                        static_cast<unsigned long long>((current_event.end_time_us > current_event.start_time_us) ? current_event.end_time_us - current_event.start_time_us
+                                                                                                                   : 0) );
+            }
+
+            current_record_ptr->n_events_read.store(n_events_written,
+                                                    std::memory_order_release);
+
+            if (file_ptr         != nullptr                                       &&
+                n_events_dropped != current_record_ptr->n_events_dropped_reported)
+            {
+                fprintf(file_ptr,
+                        "{\"name\":\"Dropped events\",\"ph\":\"C\",\"pid\":%u,\"tid\":%u,\"ts\":%llu,\"args\":{\"n_events\":%llu}},\n",
+                        g_cpu_pid,
+                        current_record_ptr->tid,
+                        static_cast<unsigned long long>(get_time_us() ),
+                        static_cast<unsigned long long>(n_events_dropped) );
+
+                current_record_ptr->n_events_dropped_reported = n_events_dropped;
+            }
+        }
+    }
+
+    if (file_ptr != nullptr)
+    {
+        fflush(file_ptr);
+    }
+
+end:
+    recorder_ptr->was_enabled = is_enabled_now;
+}
+
+void VKGL::TraceRecorder::record_cpu_event(const char*     in_name,
+                                           const uint64_t& in_start_time_us,
+                                           const uint64_t& in_end_time_us)
+{
+    append_event(in_name,
+                 in_start_time_us,
+                 in_end_time_us,
+                 UINT32_MAX); /* in_gpu_track_id */
+}
+
+void VKGL::TraceRecorder::record_gpu_event(const uint32_t& in_gpu_track_id,
+                                           const char*     in_name,
+                                           const uint64_t& in_start_time_us,
+                                           const uint64_t& in_end_time_us)
+{
+    vkgl_assert(in_gpu_track_id != UINT32_MAX);
+
+    append_event(in_name,
+                 in_start_time_us,
+                 in_end_time_us,
+                 in_gpu_track_id);
+}
+
+void VKGL::TraceRecorder::set_enabled(const bool& in_enabled)
+{
+    g_trace_recorder_enabled.store(in_enabled,
+                                   std::memory_order_relaxed);
+}
+
+void VKGL::TraceRecorder::set_thread_name(const std::string& in_name)
+{
+    auto                        record_ptr   = get_thread_record();
+    auto                        recorder_ptr = get_recorder();
+    std::lock_guard<std::mutex> lock        (recorder_ptr->mutex);
+
+    record_ptr->is_name_dirty = true;
+    record_ptr->name          = in_name;
+}
@@ -69,7 +69,7 @@ void OpenGL::VKNodes::AcquireSwapchainImage::do_cpu_prepass(IVKFrameGraphNodeCal
     vkgl_assert(swapchain_ptr != nullptr);
 
     /* Perform the requested operation */
-    frame_acquire_sem_ptr = swapchain_manager_ptr->pop_frame_acquisition_semaphore(m_swapchain_reference_ptr->get_payload().time_marker);
+    frame_acquire_sem_ptr = swapchain_manager_ptr->pop_frame_acquisition_semaphore();
     vkgl_assert(frame_acquire_sem_ptr != nullptr);
 
     frame_acquire_result = swapchain_ptr->acquire_image(frame_acquire_sem_ptr.get(),
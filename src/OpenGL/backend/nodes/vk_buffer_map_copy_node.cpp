@@ -0,0 +1,199 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "Anvil/include/wrappers/buffer.h"
+#include "Anvil/include/wrappers/command_buffer.h"
+#include "Common/macros.h"
+#include "OpenGL/backend/nodes/vk_buffer_map_copy_node.h"
+#include "OpenGL/backend/vk_buffer_manager.h"
+#include <algorithm>
+
+OpenGL::VKNodes::BufferMapCopy::BufferMapCopy(IBackend*                             in_backend_ptr,
+                                              const BufferMapCopyDirection&         in_direction,
+                                              OpenGL::VKBufferReferenceUniquePtr    in_backend_buffer_reference_ptr,
+                                              OpenGL::VKMapBackingSharedPtr         in_backing_ptr,
+                                              const std::vector<Anvil::BufferCopy>& in_copy_regions)
+    :m_backend_ptr                 (in_backend_ptr),
+     m_backend_buffer_reference_ptr(std::move(in_backend_buffer_reference_ptr) ),
+     m_backing_ptr                 (in_backing_ptr),
+     m_copy_regions                (in_copy_regions),
+     m_direction                   (in_direction)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    VkDeviceSize region_end_offset   = 0;
+    VkDeviceSize region_start_offset = UINT64_MAX;
+
+    vkgl_assert(m_backend_ptr                  != nullptr);
+    vkgl_assert(m_backend_buffer_reference_ptr != nullptr);
+    vkgl_assert(m_backing_ptr                  != nullptr);
+    vkgl_assert(m_copy_regions.size()          >  0);
+
+    m_info_ptr = decltype(m_info_ptr)(nullptr,
+                                      std::default_delete<OpenGL::VKFrameGraphNodeInfo>() );
+
+    m_info_ptr.reset(new OpenGL::VKFrameGraphNodeInfo() );
+    vkgl_assert(m_info_ptr != nullptr);
+
+    /* Expose a single IO covering all copy regions. Regions are sorted & disjoint so this is usually a tight fit. */
+    for (const auto& current_region : m_copy_regions)
+    {
+        region_end_offset   = std::max(region_end_offset,
+                                       current_region.dst_offset + current_region.size);
+        region_start_offset = std::min(region_start_offset,
+                                       current_region.dst_offset);
+    }
+
+    if (m_direction == BufferMapCopyDirection::Backing_To_Buffer)
+    {
+        m_info_ptr->inputs.push_back(
+            OpenGL::NodeIO(m_backend_buffer_reference_ptr.get(),
+                           region_start_offset,
+                           region_end_offset - region_start_offset,
+                           Anvil::PipelineStageFlagBits::TRANSFER_BIT,
+                           Anvil::AccessFlagBits::TRANSFER_WRITE_BIT)
+        );
+        m_info_ptr->outputs.push_back(
+            OpenGL::NodeIO(m_backend_buffer_reference_ptr.get(),
+                           region_start_offset,
+                           region_end_offset - region_start_offset,
+                           Anvil::PipelineStageFlagBits::TRANSFER_BIT,
+                           Anvil::AccessFlagBits::TRANSFER_WRITE_BIT)
+        );
+    }
+    else
+    {
+        m_info_ptr->inputs.push_back(
+            OpenGL::NodeIO(m_backend_buffer_reference_ptr.get(),
+                           region_start_offset,
+                           region_end_offset - region_start_offset,
+                           Anvil::PipelineStageFlagBits::TRANSFER_BIT,
+                           Anvil::AccessFlagBits::TRANSFER_READ_BIT)
+        );
+    }
+
+    /* Regions are expressed relative to the start of the GL buffer's storage, which need not be located at the start
+     * of the VK buffer. Offsets on the backing's side are left intact.
+     */
+    {
+        const auto buffer_offset = m_backend_buffer_reference_ptr->get_payload().buffer_offset;
+
+        for (auto& current_region : m_copy_regions)
+        {
+            if (m_direction == BufferMapCopyDirection::Backing_To_Buffer)
+            {
+                current_region.dst_offset += buffer_offset;
+            }
+            else
+            {
+                current_region.src_offset += buffer_offset;
+            }
+        }
+    }
+}
+
+OpenGL::VKNodes::BufferMapCopy::~BufferMapCopy()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    m_backend_buffer_reference_ptr.reset();
+    m_backing_ptr.reset                 ();
+    m_info_ptr.reset                    ();
+}
+
+OpenGL::VKFrameGraphNodeUniquePtr OpenGL::VKNodes::BufferMapCopy::create(IBackend*                             in_backend_ptr,
+                                                                         const BufferMapCopyDirection&         in_direction,
+                                                                         OpenGL::VKBufferReferenceUniquePtr    in_backend_buffer_reference_ptr,
+                                                                         OpenGL::VKMapBackingSharedPtr         in_backing_ptr,
+                                                                         const std::vector<Anvil::BufferCopy>& in_copy_regions)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    OpenGL::VKFrameGraphNodeUniquePtr result_ptr(nullptr,
+                                                 std::default_delete<OpenGL::IVKFrameGraphNode>() );
+
+    result_ptr.reset(
+        new OpenGL::VKNodes::BufferMapCopy(in_backend_ptr,
+                                           in_direction,
+                                           std::move(in_backend_buffer_reference_ptr),
+                                           in_backing_ptr,
+                                           in_copy_regions)
+    );
+
+    vkgl_assert(result_ptr != nullptr);
+    return result_ptr;
+}
+
+void OpenGL::VKNodes::BufferMapCopy::get_supported_queue_families(uint32_t*                          out_n_queue_fams_ptr,
+                                                                  const Anvil::QueueFamilyFlagBits** out_queue_fams_ptr_ptr) const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    static const Anvil::QueueFamilyFlagBits compatible_queue_fams[] =
+    {
+        Anvil::QueueFamilyFlagBits::DMA_BIT,
+        Anvil::QueueFamilyFlagBits::COMPUTE_BIT,
+        Anvil::QueueFamilyFlagBits::GRAPHICS_BIT,
+    };
+
+    *out_n_queue_fams_ptr   = sizeof(compatible_queue_fams) / sizeof(compatible_queue_fams[0]);
+    *out_queue_fams_ptr_ptr = compatible_queue_fams;
+}
+
+void OpenGL::VKNodes::BufferMapCopy::record_commands(Anvil::CommandBufferBase*  in_cmd_buffer_ptr,
+                                                     const bool&                in_inside_renderpass,
+                                                     IVKFrameGraphNodeCallback* in_graph_callback_ptr) const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    auto backend_buffer_ptr = m_backend_buffer_reference_ptr->get_payload().buffer_ptr;
+    auto backing_buffer_ptr = m_backing_ptr->buffer_ptr.get();
+
+    vkgl_assert(!in_inside_renderpass);
+
+    if (m_direction == BufferMapCopyDirection::Backing_To_Buffer)
+    {
+        /* Make sure host writes to the (coherent) backing are visible to the copy op. */
+        auto cpu_write_to_copy_op_barrier = Anvil::MemoryBarrier(Anvil::AccessFlagBits::TRANSFER_READ_BIT, /* in_dst_access_mask */
+                                                                 Anvil::AccessFlagBits::HOST_WRITE_BIT);   /* in_src_access_mask */
+
+        in_cmd_buffer_ptr->record_pipeline_barrier(Anvil::PipelineStageFlagBits::HOST_BIT,
+                                                   Anvil::PipelineStageFlagBits::TRANSFER_BIT, /* in_dst_stage_mask */
+                                                   Anvil::DependencyFlagBits::NONE,
+                                                   1, /* in_memory_barrier_count */
+                                                  &cpu_write_to_copy_op_barrier,
+                                                   0,                             /* in_buffer_memory_barrier_count */
+                                                   nullptr,                       /* in_buffer_memory_barriers_ptr */
+                                                   0,                             /* in_image_memory_barrier_count */
+                                                   nullptr);                      /* in_image_memory_barriers_ptr */
+
+        in_cmd_buffer_ptr->record_copy_buffer(backing_buffer_ptr,
+                                              backend_buffer_ptr,
+                                              static_cast<uint32_t>(m_copy_regions.size() ),
+                                              m_copy_regions.data() );
+    }
+    else
+    {
+        in_cmd_buffer_ptr->record_copy_buffer(backend_buffer_ptr,
+                                              backing_buffer_ptr,
+                                              static_cast<uint32_t>(m_copy_regions.size() ),
+                                              m_copy_regions.data() );
+
+        /* ..and make the copied data visible to the host once the fence signals. */
+        {
+            auto copy_op_to_cpu_read_barrier = Anvil::MemoryBarrier(Anvil::AccessFlagBits::HOST_READ_BIT,       /* in_dst_access_mask */
+                                                                    Anvil::AccessFlagBits::TRANSFER_WRITE_BIT); /* in_src_access_mask */
+
+            in_cmd_buffer_ptr->record_pipeline_barrier(Anvil::PipelineStageFlagBits::TRANSFER_BIT,
+                                                       Anvil::PipelineStageFlagBits::HOST_BIT, /* in_dst_stage_mask */
+                                                       Anvil::DependencyFlagBits::NONE,
+                                                       1, /* in_memory_barrier_count */
+                                                      &copy_op_to_cpu_read_barrier,
+                                                       0,                             /* in_buffer_memory_barrier_count */
+                                                       nullptr,                       /* in_buffer_memory_barriers_ptr */
+                                                       0,                             /* in_image_memory_barrier_count */
+                                                       nullptr);                      /* in_image_memory_barriers_ptr */
+        }
+    }
+}
@@ -83,7 +83,7 @@ OpenGL::VKNodes::BufferSubData::~BufferSubData()
     m_data_ptr.reset                     ();
     m_frontend_buffer_reference_ptr.reset();
     m_info_ptr.reset                     ();
-    m_staging_buffer_ptr.reset           ();
+    m_staging_backing_ptr.reset          ();
 }
 
 bool OpenGL::VKNodes::BufferSubData::can_memory_block_handle_frontend_reqs(const Anvil::MemoryBlock*   in_mem_block_ptr,
@@ -162,7 +162,6 @@ void OpenGL::VKNodes::BufferSubData::do_cpu_prepass(IVKFrameGraphNodeCallback*)
     const auto&                 frontend_buffer_snapshot_time           = m_frontend_buffer_reference_ptr->get_payload().time_marker;
     OpenGL::BufferUsage         frontend_buffer_usage                   = OpenGL::BufferUsage::Unknown;
     const OpenGL::BufferTarget* frontend_buffer_used_buffer_targets_ptr = nullptr;
-    auto                        mem_allocator_ptr                       = m_backend_ptr->get_memory_allocator_ptr();
 
     vkgl_assert(*m_info_ptr->inputs.at(0).buffer_reference_ptr == *m_info_ptr->outputs.at(0).buffer_reference_ptr);
 
@@ -186,70 +185,19 @@ void OpenGL::VKNodes::BufferSubData::do_cpu_prepass(IVKFrameGraphNodeCallback*)
         vkgl_assert(backend_mem_block_ptr != nullptr);
     }
 
-    /* 3. Create a staging buffer, bind memory to it, move the user-specified data there.
+    /* 3. Grab a staging backing and move the user-specified data there.
      *
-     * TODO: Backend should host a pool of staging buffers to reuse. We should not be re-creating these buffers here
-     *       all the time.
+     *    Backings are recycled by the buffer manager. This one returns to the pool when the node is released, which only
+     *    happens after the frame has finished executing GPU-side.
      */
     if (m_data_ptr != nullptr)
     {
-        {
-            auto create_info_ptr = Anvil::BufferCreateInfo::create_no_alloc(m_backend_ptr->get_device_ptr(),
-                                                                            m_info_ptr->outputs.at(0).buffer_props.size,
-                                                                            Anvil::QueueFamilyFlagBits::COMPUTE_BIT | Anvil::QueueFamilyFlagBits::DMA_BIT | Anvil::QueueFamilyFlagBits::GRAPHICS_BIT,
-                                                                            Anvil::SharingMode::EXCLUSIVE,
-                                                                            Anvil::BufferCreateFlagBits::NONE,
-                                                                            Anvil::BufferUsageFlagBits::TRANSFER_SRC_BIT);
-
-            vkgl_assert(create_info_ptr != nullptr);
-
-            m_staging_buffer_ptr = Anvil::Buffer::create(std::move(create_info_ptr) );
-            vkgl_assert(m_staging_buffer_ptr != nullptr);
-
-            #ifdef _DEBUG
-            {
-                m_staging_buffer_ptr->set_name_formatted("Staging buffer for a staging->%p copy op (GL buffer ID: %d)",
-                                                         backend_buffer_ptr->get_buffer(),
-                                                         frontend_buffer_id);
-            }
-            #endif
-        }
-
-        if (!mem_allocator_ptr->add_buffer(m_staging_buffer_ptr.get(),
-                                           Anvil::MemoryFeatureFlagBits::HOST_COHERENT_BIT | Anvil::MemoryFeatureFlagBits::MAPPABLE_BIT) )
-        {
-            vkgl_assert_fail();
-        }
-    }
+        m_staging_backing_ptr = m_backend_ptr->get_buffer_manager_ptr()->acquire_map_backing(m_info_ptr->outputs.at(0).buffer_props.size);
+        vkgl_assert(m_staging_backing_ptr != nullptr);
 
-    /* NOTE: Invocation below automagically binds the mem alloc to added objects. */
-    if (!mem_allocator_ptr->bake() )
-    {
-        vkgl_assert_fail();
-    }
-
-    if (m_data_ptr != nullptr)
-    {
-        auto  staging_buffer_mem_block_ptr = m_staging_buffer_ptr->get_memory_block(0);
-        void* staging_buffer_raw_ptr       = nullptr;
-
-        vkgl_assert(staging_buffer_mem_block_ptr != nullptr);
-
-        if (!staging_buffer_mem_block_ptr->map(0, /* in_start_offset */
-                                               m_info_ptr->outputs.at(0).buffer_props.size,
-                                              &staging_buffer_raw_ptr) )
-        {
-            vkgl_assert_fail();
-        }
-
-        memcpy(staging_buffer_raw_ptr,
+        memcpy(m_staging_backing_ptr->mapped_ptr,
                m_data_ptr.get(),
-               static_cast<size_t>(m_staging_buffer_ptr->get_create_info_ptr()->get_size()) );
-
-        if (!staging_buffer_mem_block_ptr->unmap() )
-        {
-            vkgl_assert_fail();
-        }
+               static_cast<size_t>(m_info_ptr->outputs.at(0).buffer_props.size) );
     }
 }
 
@@ -275,9 +223,10 @@ void OpenGL::VKNodes::BufferSubData::record_commands(Anvil::CommandBufferBase*
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    if (m_staging_buffer_ptr != nullptr)
+    if (m_staging_backing_ptr != nullptr)
     {
-        auto              backend_buffer_ptr = m_info_ptr->inputs.at(0).buffer_reference_ptr->get_payload().buffer_ptr;
+        const auto&       backend_payload    = m_info_ptr->inputs.at(0).buffer_reference_ptr->get_payload();
+        auto              backend_buffer_ptr = backend_payload.buffer_ptr;
         Anvil::BufferCopy copy_region;
 
         {
@@ -295,11 +244,11 @@ void OpenGL::VKNodes::BufferSubData::record_commands(Anvil::CommandBufferBase*
                                                        nullptr);                      /* in_image_memory_barriers_ptr */
         }
 
-        copy_region.dst_offset = m_start_offset;
-        copy_region.size       = m_staging_buffer_ptr->get_create_info_ptr()->get_size();
+        copy_region.dst_offset = backend_payload.buffer_offset + m_start_offset;
+        copy_region.size       = m_info_ptr->outputs.at(0).buffer_props.size;
         copy_region.src_offset = 0;
 
-        in_cmd_buffer_ptr->record_copy_buffer(m_staging_buffer_ptr.get(),
+        in_cmd_buffer_ptr->record_copy_buffer(m_staging_backing_ptr->buffer_ptr.get(),
                                               backend_buffer_ptr,
                                               1, /* in_region_count */
                                              &copy_region);
@@ -18,10 +18,12 @@ OpenGL::VKNodes::Clear::Clear(const IContextObjectManagers*            in_fronte
                               IBackend*                                in_backend_ptr,
                               OpenGL::GLContextStateReferenceUniquePtr in_context_state_ptr,
                               const OpenGL::ClearBufferBits&           in_buffers_to_clear)
-    :m_backend_ptr      (in_backend_ptr),
-     m_buffers_to_clear (in_buffers_to_clear),
-     m_context_state_ptr(std::move(in_context_state_ptr) ),
-     m_frontend_ptr     (in_frontend_ptr)
+    :m_backend_ptr               (in_backend_ptr),
+     m_buffers_to_clear          (in_buffers_to_clear),
+     m_context_state_ptr         (std::move(in_context_state_ptr) ),
+     m_frontend_context_state_ptr(nullptr),
+     m_frontend_ptr              (in_frontend_ptr),
+     m_uses_renderpass           (false)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -76,20 +78,23 @@ void OpenGL::VKNodes::Clear::init_info()
     vkgl_assert(context_state_ptr != nullptr);
     vkgl_assert(fb_state_ptr      != nullptr);
 
+    m_frontend_context_state_ptr = context_state_ptr;
+
     /* Set up the info struct */
     m_info_ptr.reset(
         new OpenGL::VKFrameGraphNodeInfo()
     );
     vkgl_assert(m_info_ptr != nullptr);
 
-    /* NOTE: Enabled scissor test means the clear op needs to be:
-     *
-     * 1) Either handled via a clear load op with viewport set appropriately at RP level,
-     * 2) or via a scaled blit.
+    /* NOTE: Default FB is cleared from within a renderpass, in which case the scissor box is taken into account. FBO attachments
+     *       are still cleared with transfer ops, which ignore the scissor test.
      *
-     * TODO: We don't support either at the moment.
+     * TODO: Move FBO clears to renderpasses, once FBO attachments are supported by bake_renderpasses().
      */
-    if (context_state_ptr->is_scissor_test_enabled)
+    m_uses_renderpass = (draw_framebuffer_id == 0);
+
+    if (!m_uses_renderpass                      &&
+        context_state_ptr->is_scissor_test_enabled)
     {
         /* If this blows up, expect corruption */
         vkgl_not_implemented();
@@ -119,6 +124,16 @@ void OpenGL::VKNodes::Clear::init_info()
 
     if (draw_framebuffer_id == 0)
     {
+        /* Default FB is exposed as a single swapchain image IO, the same way draw nodes do it. This lets the frame graph put
+         * the clear in the same renderpass as subsequent draw calls.
+         */
+        Anvil::AccessFlags        access_mask               = Anvil::AccessFlagBits::NONE;
+        Anvil::ImageAspectFlags   aspects_cleared           = Anvil::ImageAspectFlagBits::NONE;
+        Anvil::ImageLayout        color_layout              = Anvil::ImageLayout::UNKNOWN;
+        Anvil::ImageLayout        ds_layout                 = Anvil::ImageLayout::UNKNOWN;
+        Anvil::PipelineStageFlags pipeline_stages           = Anvil::PipelineStageFlagBits::NONE;
+        uint32_t                  swapchain_output_location = UINT32_MAX;
+
         if (m_buffers_to_clear & OpenGL::ClearBufferBit::CLEAR_BUFFER_BIT_COLOR)
         {
             for (uint32_t n_draw_buffer = 0;
@@ -126,89 +141,78 @@ void OpenGL::VKNodes::Clear::init_info()
                         ++n_draw_buffer)
             {
                 const auto& current_draw_buffer = fb_state_ptr->draw_buffer_per_color_output.at(n_draw_buffer);
-    
+
                 switch (current_draw_buffer)
                 {
                     case OpenGL::DrawBuffer::Back:
                     {
-                        auto new_node_io = OpenGL::NodeIO(nullptr, /* in_alwaysnull_vk_swapchain_reference_ptr */
-                                                          Anvil::ImageAspectFlagBits::COLOR_BIT,
-                                                          Anvil::ImageLayout::TRANSFER_DST_OPTIMAL,
-                                                          Anvil::ImageLayout::UNKNOWN,
-                                                          Anvil::PipelineStageFlagBits::TRANSFER_BIT,
-                                                          Anvil::AccessFlagBits::TRANSFER_WRITE_BIT,
-                                                          UINT32_MAX); //< in_fs_output_location - irrelevant
-    
-                        m_info_ptr->inputs.push_back(new_node_io);
-    
-                        break;
-                    }
-    
-                    case OpenGL::DrawBuffer::Color_Attachment0:
-                    case OpenGL::DrawBuffer::Color_Attachment1:
-                    case OpenGL::DrawBuffer::Color_Attachment2:
-                    case OpenGL::DrawBuffer::Color_Attachment3:
-                    case OpenGL::DrawBuffer::Color_Attachment4:
-                    case OpenGL::DrawBuffer::Color_Attachment5:
-                    case OpenGL::DrawBuffer::Color_Attachment6:
-                    case OpenGL::DrawBuffer::Color_Attachment7:
-                    {
-                        vkgl_not_implemented();
-                        
-                        auto new_node_io = OpenGL::NodeIO(nullptr, /* in_alwaysnull_vk_swapchain_reference_ptr */
-                                                          Anvil::ImageAspectFlagBits::COLOR_BIT,
-                                                          Anvil::ImageLayout::TRANSFER_DST_OPTIMAL,
-                                                          Anvil::ImageLayout::UNKNOWN,
-                                                          Anvil::PipelineStageFlagBits::TRANSFER_BIT,
-                                                          Anvil::AccessFlagBits::TRANSFER_WRITE_BIT,
-                                                          UINT32_MAX); //< in_fs_output_location - irrelevant
-    
-                        m_info_ptr->inputs.push_back(new_node_io);
-    
+                        swapchain_output_location = n_draw_buffer;
+
                         break;
                     }
-    
+
                     case OpenGL::DrawBuffer::None:
                     {
                         continue;
                     }
-    
+
                     default:
                     {
+                        /* Color attachments are not available for default FB. */
                         vkgl_assert_fail();
-                        
+
                         continue;
                     }
                 }
-                
+
                 break;
             }
+
+            if (swapchain_output_location != UINT32_MAX)
+            {
+                access_mask     |= Anvil::AccessFlagBits::COLOR_ATTACHMENT_WRITE_BIT;
+                aspects_cleared |= Anvil::ImageAspectFlagBits::COLOR_BIT;
+                color_layout     = Anvil::ImageLayout::COLOR_ATTACHMENT_OPTIMAL;
+                pipeline_stages |= Anvil::PipelineStageFlagBits::COLOR_ATTACHMENT_OUTPUT_BIT;
+            }
         }
-        
+
         if (m_buffers_to_clear & OpenGL::ClearBufferBit::CLEAR_BUFFER_BIT_DEPTH)
         {
-            auto new_node_io = OpenGL::NodeIO(nullptr, /* in_alwaysnull_vk_swapchain_reference_ptr */
-                                              Anvil::ImageAspectFlagBits::DEPTH_BIT,
-                                              Anvil::ImageLayout::UNKNOWN,
-                                              Anvil::ImageLayout::TRANSFER_DST_OPTIMAL,
-                                              Anvil::PipelineStageFlagBits::TRANSFER_BIT,
-                                              Anvil::AccessFlagBits::TRANSFER_WRITE_BIT,
-                                              UINT32_MAX); //< in_fs_output_location - irrelevant
-        	
-        	m_info_ptr->inputs.push_back(new_node_io);
+            aspects_cleared |= Anvil::ImageAspectFlagBits::DEPTH_BIT;
         }
-    
+
         if (m_buffers_to_clear & OpenGL::ClearBufferBit::CLEAR_BUFFER_BIT_STENCIL)
+        {
+            aspects_cleared |= Anvil::ImageAspectFlagBits::STENCIL_BIT;
+        }
+
+        {
+            const bool clears_depth   = (aspects_cleared & Anvil::ImageAspectFlagBits::DEPTH_BIT)   != 0;
+            const bool clears_stencil = (aspects_cleared & Anvil::ImageAspectFlagBits::STENCIL_BIT) != 0;
+
+            if (clears_depth || clears_stencil)
+            {
+                ds_layout        = ( clears_depth &&  clears_stencil) ? Anvil::ImageLayout::DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+                                 : ( clears_depth && !clears_stencil) ? Anvil::ImageLayout::DEPTH_ATTACHMENT_STENCIL_READ_ONLY_OPTIMAL
+                                                                      : Anvil::ImageLayout::DEPTH_READ_ONLY_STENCIL_ATTACHMENT_OPTIMAL;
+                access_mask     |= Anvil::AccessFlagBits::DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+                pipeline_stages |= Anvil::PipelineStageFlagBits::EARLY_FRAGMENT_TESTS_BIT |
+                                   Anvil::PipelineStageFlagBits::LATE_FRAGMENT_TESTS_BIT;
+            }
+        }
+
+        if (aspects_cleared != Anvil::ImageAspectFlagBits::NONE)
         {
             auto new_node_io = OpenGL::NodeIO(nullptr, /* in_alwaysnull_vk_swapchain_reference_ptr */
-                                              Anvil::ImageAspectFlagBits::STENCIL_BIT,
-                                              Anvil::ImageLayout::UNKNOWN,
-                                              Anvil::ImageLayout::TRANSFER_DST_OPTIMAL,
-                                              Anvil::PipelineStageFlagBits::TRANSFER_BIT,
-                                              Anvil::AccessFlagBits::TRANSFER_WRITE_BIT,
-                                              UINT32_MAX); //< in_fs_output_location - irrelevant
-        	
-        	m_info_ptr->inputs.push_back(new_node_io);
+                                              aspects_cleared,
+                                              color_layout,
+                                              ds_layout,
+                                              pipeline_stages,
+                                              access_mask,
+                                              swapchain_output_location);
+
+            m_info_ptr->inputs.push_back(new_node_io);
         }
     }
     else
@@ -455,9 +459,21 @@ void OpenGL::VKNodes::Clear::get_supported_queue_families(uint32_t*
         Anvil::QueueFamilyFlagBits::COMPUTE_BIT,
         Anvil::QueueFamilyFlagBits::GRAPHICS_BIT,
     };
+    static const Anvil::QueueFamilyFlagBits supported_queue_fams_rp[] =
+    {
+        Anvil::QueueFamilyFlagBits::GRAPHICS_BIT,
+    };
 
-    *out_n_queue_fams_ptr   = sizeof(supported_queue_fams) / sizeof(supported_queue_fams[0]);
-    *out_queue_fams_ptr_ptr = supported_queue_fams;
+    if (m_uses_renderpass)
+    {
+        *out_n_queue_fams_ptr   = sizeof(supported_queue_fams_rp) / sizeof(supported_queue_fams_rp[0]);
+        *out_queue_fams_ptr_ptr = supported_queue_fams_rp;
+    }
+    else
+    {
+        *out_n_queue_fams_ptr   = sizeof(supported_queue_fams) / sizeof(supported_queue_fams[0]);
+        *out_queue_fams_ptr_ptr = supported_queue_fams;
+    }
 }
 
 void OpenGL::VKNodes::Clear::record_commands(Anvil::CommandBufferBase*  in_cmd_buffer_ptr,
@@ -466,15 +482,16 @@ void OpenGL::VKNodes::Clear::record_commands(Anvil::CommandBufferBase*  in_cmd_b
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    // TODO: GL clear commands are affected by scissor + draw buffer settings!
-    auto       state_manager_ptr = m_frontend_ptr->get_state_manager_ptr();
-    const auto state_ptr         = state_manager_ptr->get_state         (m_context_state_ptr->get_payload().time_marker);
+    if (in_inside_renderpass)
+    {
+        record_commands_inside_renderpass(in_cmd_buffer_ptr,
+                                          in_graph_callback_ptr);
 
-    /* TODO */
-    vkgl_assert(!in_inside_renderpass);
+        return;
+    }
 
-    auto swapchain_reference_ptr = in_graph_callback_ptr->get_acquired_swapchain_reference_raw_ptr();
-    vkgl_assert(swapchain_reference_ptr != nullptr);
+    /* NOTE: Only FBO clears end up here. See init_info(). */
+    const auto state_ptr = m_frontend_context_state_ptr;
 
     for (auto& current_output : m_info_ptr->outputs)
     {
@@ -482,70 +499,12 @@ void OpenGL::VKNodes::Clear::record_commands(Anvil::CommandBufferBase*  in_cmd_b
         {
             case OpenGL::NodeIOType::Swapchain_Image:
             {
-                Anvil::ImageSubresourceRange subresource_range;
-                const auto                   swapchain_image_index = in_graph_callback_ptr->get_acquired_swapchain_image_index();
-                const auto                   color_image_ptr             = swapchain_reference_ptr->get_payload().swapchain_ptr->get_image(swapchain_image_index);
-                const auto                   ds_image_ptr                  = m_backend_ptr->get_swapchain_manager_ptr()->get_ds_image(swapchain_reference_ptr->get_payload().time_marker,
-                                                                                                               swapchain_image_index);
-
-                vkgl_assert(color_image_ptr != nullptr);
-                vkgl_assert(ds_image_ptr != nullptr);
-
-                /* Prepare subresource range struct.
-                 *
-                 * Default FB is a simple single-mip 2D image, so not much rocket science here
-                 */
-                subresource_range.aspect_mask      = current_output.swapchain_image_props.aspects_touched;
-                subresource_range.base_array_layer = 0;
-                subresource_range.base_mip_level   = 0;
-                subresource_range.layer_count      = 1;
-                subresource_range.level_count      = 1;
-
-                if ((current_output.swapchain_image_props.aspects_touched & Anvil::ImageAspectFlagBits::COLOR_BIT) != 0)
-                {
-                    VkClearColorValue clear_color_value;
-
-                    /* Prepare clear color struct.. */
-                    static_assert(sizeof(clear_color_value.float32) == sizeof(state_ptr->color_clear_value), "Clear color sizes must match");
-
-                    memcpy(clear_color_value.float32,
-                           state_ptr->color_clear_value,
-                           sizeof(clear_color_value.float32));
-
-                    in_cmd_buffer_ptr->record_clear_color_image(color_image_ptr,
-                                                                Anvil::ImageLayout::TRANSFER_DST_OPTIMAL,
-                                                               &clear_color_value,
-                                                                1, /* in_range_count */
-                                                               &subresource_range);
-                }
-
-                if ((current_output.swapchain_image_props.aspects_touched & Anvil::ImageAspectFlagBits::DEPTH_BIT)   != 0 ||
-                    (current_output.swapchain_image_props.aspects_touched & Anvil::ImageAspectFlagBits::STENCIL_BIT) != 0)
-                {
-                    VkClearDepthStencilValue clear_ds_value;
-
-                    if ((current_output.swapchain_image_props.aspects_touched & Anvil::ImageAspectFlagBits::DEPTH_BIT) != 0)
-                    {
-                        clear_ds_value.depth = static_cast<float>(std::clamp(state_ptr->depth_clear_value,
-                        													0.0,
-                        													1.0) );
-                    }
-
-                    if ((current_output.swapchain_image_props.aspects_touched & Anvil::ImageAspectFlagBits::STENCIL_BIT) != 0)
-                    {
-                        clear_ds_value.stencil = state_ptr->stencil_clear_value;
-                    }
-
-                    in_cmd_buffer_ptr->record_clear_depth_stencil_image(ds_image_ptr,
-                                                                        Anvil::ImageLayout::TRANSFER_DST_OPTIMAL,
-                                                                       &clear_ds_value,
-                                                                        1, /* in_range_count */
-                                                                       &subresource_range);
-                }
+                /* Default FB clears are always recorded inside a renderpass. */
+                vkgl_assert_fail();
 
                 break;
             }
-            
+
             case OpenGL::NodeIOType::Image:
             {
                 Anvil::ImageSubresourceRange& subresource_range = current_output.image_props.subresource_range;
@@ -605,4 +564,95 @@ void OpenGL::VKNodes::Clear::record_commands(Anvil::CommandBufferBase*  in_cmd_b
             }
         }
     }
-}
\ No newline at end of file
+}
+
+void OpenGL::VKNodes::Clear::record_commands_inside_renderpass(Anvil::CommandBufferBase*  in_cmd_buffer_ptr,
+                                                               IVKFrameGraphNodeCallback* in_graph_callback_ptr) const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: A clear which starts a renderpass is usually baked into the RP's load ops by the frame graph, in which case
+     *       this function is not called at all. Anything else needs to go through vkCmdClearAttachments(), which also
+     *       lets us respect the scissor box.
+     */
+    std::vector<Anvil::ClearAttachment> clear_attachments;
+    VkClearRect                         clear_rect;
+    const auto                          render_area = in_graph_callback_ptr->get_render_area();
+    const auto                          state_ptr   = m_frontend_context_state_ptr;
+
+    clear_rect.baseArrayLayer = 0;
+    clear_rect.layerCount     = 1;
+    clear_rect.rect           = render_area;
+
+    if (state_ptr->is_scissor_test_enabled)
+    {
+        const int32_t x1 = std::max(state_ptr->scissor_box[0],
+                                    render_area.offset.x);
+        const int32_t y1 = std::max(state_ptr->scissor_box[1],
+                                    render_area.offset.y);
+        const int32_t x2 = std::min(state_ptr->scissor_box[0] + state_ptr->scissor_box[2],
+                                    render_area.offset.x      + static_cast<int32_t>(render_area.extent.width) );
+        const int32_t y2 = std::min(state_ptr->scissor_box[1] + state_ptr->scissor_box[3],
+                                    render_area.offset.y      + static_cast<int32_t>(render_area.extent.height) );
+
+        if (x2 <= x1 ||
+            y2 <= y1)
+        {
+            /* Scissor box does not intersect with the render area - nothing to clear. */
+            return;
+        }
+
+        clear_rect.rect.extent.height = static_cast<uint32_t>(y2 - y1);
+        clear_rect.rect.extent.width  = static_cast<uint32_t>(x2 - x1);
+        clear_rect.rect.offset.x      = x1;
+        clear_rect.rect.offset.y      = y1;
+    }
+
+    for (const auto& current_output : m_info_ptr->outputs)
+    {
+        vkgl_assert(current_output.type == OpenGL::NodeIOType::Swapchain_Image);
+
+        const auto& aspects_touched = current_output.swapchain_image_props.aspects_touched;
+
+        if ((aspects_touched & Anvil::ImageAspectFlagBits::COLOR_BIT) != 0)
+        {
+            Anvil::ClearAttachment clear_attachment;
+
+            static_assert(sizeof(clear_attachment.clear_value.color.float32) == sizeof(state_ptr->color_clear_value), "Clear color sizes must match");
+
+            vkgl_assert(current_output.swapchain_image_props.fs_output_location != UINT32_MAX);
+
+            clear_attachment.aspect_mask      = Anvil::ImageAspectFlagBits::COLOR_BIT;
+            clear_attachment.color_attachment = current_output.swapchain_image_props.fs_output_location;
+
+            memcpy(clear_attachment.clear_value.color.float32,
+                   state_ptr->color_clear_value,
+                   sizeof(clear_attachment.clear_value.color.float32) );
+
+            clear_attachments.push_back(clear_attachment);
+        }
+
+        if ((aspects_touched & Anvil::ImageAspectFlagBits::DEPTH_BIT)   != 0 ||
+            (aspects_touched & Anvil::ImageAspectFlagBits::STENCIL_BIT) != 0)
+        {
+            Anvil::ClearAttachment clear_attachment;
+
+            clear_attachment.aspect_mask                      = aspects_touched & (Anvil::ImageAspectFlagBits::DEPTH_BIT | Anvil::ImageAspectFlagBits::STENCIL_BIT);
+            clear_attachment.clear_value.depthStencil.depth   = static_cast<float>(std::clamp(state_ptr->depth_clear_value,
+                                                                                              0.0,
+                                                                                              1.0) );
+            clear_attachment.clear_value.depthStencil.stencil = state_ptr->stencil_clear_value;
+            clear_attachment.color_attachment                 = 0; /* ignored for DS aspects */
+
+            clear_attachments.push_back(clear_attachment);
+        }
+    }
+
+    if (clear_attachments.size() > 0)
+    {
+        in_cmd_buffer_ptr->record_clear_attachments(static_cast<uint32_t>(clear_attachments.size() ),
+                                                    clear_attachments.data(),
+                                                    1, /* in_n_rects */
+                                                   &clear_rect);
+    }
+}
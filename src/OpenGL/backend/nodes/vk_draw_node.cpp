@@ -138,10 +138,13 @@ void OpenGL::VKNodes::Draw::init_info()
                                                                                       frontend_buffer_reference_ptr->get_payload().time_marker);
             vkgl_assert(backend_buffer_reference_ptr != nullptr);
 
+            /* NOTE: The range of vertices fetched is not known until the index data is inspected, so assume the attribute array
+             *       spans till the end of the buffer.
+             */
             m_info_ptr->inputs.push_back(
                 OpenGL::NodeIO(backend_buffer_reference_ptr.get(),
                                reinterpret_cast<VkDeviceSize>(current_vaa.pointer), /* in_start_offset */
-                               OpenGL::Utils::get_n_bytes_for_vertex_attribute_array_type(current_vaa.type) * current_vaa.stride,
+                               VK_WHOLE_SIZE,
                                Anvil::PipelineStageFlagBits::VERTEX_INPUT_BIT,
                                Anvil::AccessFlagBits::VERTEX_ATTRIBUTE_READ_BIT)
             );
@@ -1024,24 +1027,40 @@ void OpenGL::VKNodes::Draw::record_commands(Anvil::CommandBufferBase*  in_cmd_bu
             vkgl_assert(backend_buffer_reference_ptr != nullptr);
 
             buffer_ptrs   [current_active_attribute_location] = backend_buffer_reference_ptr->get_payload().buffer_ptr;
-            buffer_offsets[current_active_attribute_location] = reinterpret_cast<VkDeviceSize>(vaa_props.pointer);
+            buffer_offsets[current_active_attribute_location] = backend_buffer_reference_ptr->get_payload().buffer_offset + reinterpret_cast<VkDeviceSize>(vaa_props.pointer);
         }
 vkgl_printf("line = %d file = %s", __LINE__, __FILE__);
         /* TODO: Use a non-zero start binding index whenever possible */
-        in_cmd_buffer_ptr->record_bind_vertex_buffers(0, /* in_start_binding */
-                                                      program_post_link_data_ptr->max_active_attribute_location + 1, /* in_binding_count */
-                                                      buffer_ptrs,
-                                                      buffer_offsets);vkgl_printf("line = %d file = %s", __LINE__, __FILE__);
+        {
+            const uint32_t n_bindings = program_post_link_data_ptr->max_active_attribute_location + 1;
+
+            /* Small GL buffers live in shared VK buffers, so the (buffer, offset) bindings are frequently identical to
+             * what the previous draw call has already bound.
+             */
+            if (!in_graph_callback_ptr->are_vertex_buffers_bound(n_bindings,
+                                                                 buffer_ptrs,
+                                                                 buffer_offsets) )
+            {
+                in_cmd_buffer_ptr->record_bind_vertex_buffers(0, /* in_start_binding */
+                                                              n_bindings,
+                                                              buffer_ptrs,
+                                                              buffer_offsets);vkgl_printf("line = %d file = %s", __LINE__, __FILE__);
+
+                in_graph_callback_ptr->set_bound_vertex_buffers(n_bindings,
+                                                                buffer_ptrs,
+                                                                buffer_offsets);
+            }
+        }
 
         if (m_args.index_data_type != OpenGL::DrawCallIndexType::Unknown)
         {
-            auto index_buffer_ptr = m_index_buffer_reference_ptr->get_payload().buffer_ptr;
+            const auto& index_buffer_payload = m_index_buffer_reference_ptr->get_payload();
 
             vkgl_assert(m_args.index_data_type == OpenGL::DrawCallIndexType::Unsigned_Int    ||
                         m_args.index_data_type == OpenGL::DrawCallIndexType::Unsigned_Short);
 
-            in_cmd_buffer_ptr->record_bind_index_buffer(index_buffer_ptr,
-                                                        m_args.index_buffer_offset,
+            in_cmd_buffer_ptr->record_bind_index_buffer(index_buffer_payload.buffer_ptr,
+                                                        index_buffer_payload.buffer_offset + m_args.index_buffer_offset,
                                                         (m_args.index_data_type == OpenGL::DrawCallIndexType::Unsigned_Int) ? Anvil::IndexType::UINT32
                                                                                                                             : Anvil::IndexType::UINT16);vkgl_printf("line = %d file = %s", __LINE__, __FILE__);
         }
@@ -95,6 +95,11 @@ void OpenGL::VKNodes::PresentSwapchainImage::execute_cpu_side(IVKFrameGraphNodeC
 
         swapchain_manager_ptr->recreate_swapchain(true /* in_defer_till_acquisition */);
     }
+    else
+    {
+        swapchain_manager_ptr->on_swapchain_image_presented(swapchain_reference_ptr->get_payload().swapchain_ptr,
+                                                            in_callback_ptr->get_acquired_swapchain_image_index() );
+    }
 
     /* Mark the swapchain image as presented */
     in_callback_ptr->set_acquired_swapchain_image_index      (UINT32_MAX);
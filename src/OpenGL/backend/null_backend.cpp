@@ -0,0 +1,689 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "OpenGL/backend/null_backend.h"
+#include "Common/fence.h"
+#include "Common/macros.h"
+#include "OpenGL/converters.h"
+#include <string.h>
+
+OpenGL::NullBackend::NullBackend(const bool& in_record_calls)
+    :m_record_calls(in_record_calls)
+{
+    reset_counters();
+}
+
+OpenGL::NullBackend::~NullBackend()
+{
+    /* Stub */
+}
+
+OpenGL::NullBackendUniquePtr OpenGL::NullBackend::create(const bool& in_record_calls)
+{
+    OpenGL::NullBackendUniquePtr result_ptr;
+
+    result_ptr.reset(
+        new NullBackend(in_record_calls)
+    );
+
+    if (result_ptr != nullptr)
+    {
+        result_ptr->init_capabilities();
+    }
+
+    return result_ptr;
+}
+
+void OpenGL::NullBackend::buffer_data(const GLuint&     in_id,
+                                      const GLsizeiptr& in_size,
+                                      const void*       in_data_ptr)
+{
+    on_callback(NullBackendCallback::Buffer_Data);
+
+    /* Contents are never read back by the frontend, so there is no need to copy in_data_ptr over. */
+    m_buffer_storage[in_id].resize(static_cast<size_t>(in_size) );
+}
+
+void OpenGL::NullBackend::buffer_sub_data(const GLuint&     in_id,
+                                          const GLsizeiptr& in_start_offset,
+                                          const GLsizeiptr& in_size,
+                                          const void*       in_data_ptr)
+{
+    on_callback(NullBackendCallback::Buffer_Sub_Data);
+}
+
+void OpenGL::NullBackend::clear(const OpenGL::ClearBufferBits& in_buffers_to_clear)
+{
+    on_callback(NullBackendCallback::Clear);
+}
+
+void OpenGL::NullBackend::compile_shader(const GLuint& in_id)
+{
+    on_callback(NullBackendCallback::Compile_Shader);
+}
+
+void OpenGL::NullBackend::compressed_tex_image_1d(const GLuint&                 in_id,
+                                                  const GLint&                  in_level,
+                                                  const OpenGL::InternalFormat& in_internalformat,
+                                                  const GLsizei                 in_width,
+                                                  const GLint                   in_border,
+                                                  const GLsizei                 in_image_size,
+                                                  const void*                   in_data)
+{
+    on_callback(NullBackendCallback::Compressed_Tex_Image_1D);
+}
+
+void OpenGL::NullBackend::compressed_tex_image_2d(const GLuint&                 in_id,
+                                                  const GLint&                  in_level,
+                                                  const OpenGL::InternalFormat& in_internalformat,
+                                                  const GLsizei&                in_width,
+                                                  const GLsizei&                in_height,
+                                                  const GLint&                  in_border,
+                                                  const GLsizei&                in_image_size,
+                                                  const void*                   in_data)
+{
+    on_callback(NullBackendCallback::Compressed_Tex_Image_2D);
+}
+
+void OpenGL::NullBackend::compressed_tex_image_3d(const GLuint&                 in_id,
+                                                  const GLint&                  in_level,
+                                                  const OpenGL::InternalFormat& in_internalformat,
+                                                  const GLsizei&                in_width,
+                                                  const GLsizei&                in_height,
+                                                  const GLsizei&                in_depth,
+                                                  const GLint&                  in_border,
+                                                  const GLsizei&                in_image_size,
+                                                  const void*                   in_data)
+{
+    on_callback(NullBackendCallback::Compressed_Tex_Image_3D);
+}
+
+void OpenGL::NullBackend::compressed_tex_sub_image_1d(const GLuint&              in_id,
+                                                      const GLint&               in_level,
+                                                      const GLint&               in_xoffset,
+                                                      const GLsizei&             in_width,
+                                                      const OpenGL::PixelFormat& in_format,
+                                                      const GLsizei&             in_image_size,
+                                                      const void*                in_data)
+{
+    on_callback(NullBackendCallback::Compressed_Tex_Sub_Image_1D);
+}
+
+void OpenGL::NullBackend::compressed_tex_sub_image_2d(const GLuint&              in_id,
+                                                      const GLint&               in_level,
+                                                      const GLint&               in_xoffset,
+                                                      const GLint&               in_yoffset,
+                                                      const GLsizei&             in_width,
+                                                      const GLsizei&             in_height,
+                                                      const OpenGL::PixelFormat& in_format,
+                                                      const GLsizei&             in_image_size,
+                                                      const void*                in_data)
+{
+    on_callback(NullBackendCallback::Compressed_Tex_Sub_Image_2D);
+}
+
+void OpenGL::NullBackend::compressed_tex_sub_image_3d(const GLuint&              in_id,
+                                                      const GLint&               in_level,
+                                                      const GLint&               in_xoffset,
+                                                      const GLint&               in_yoffset,
+                                                      const GLint&               in_zoffset,
+                                                      const GLsizei&             in_width,
+                                                      const GLsizei&             in_height,
+                                                      const GLsizei&             in_depth,
+                                                      const OpenGL::PixelFormat& in_format,
+                                                      const GLsizei&             in_image_size,
+                                                      const void*                in_data)
+{
+    on_callback(NullBackendCallback::Compressed_Tex_Sub_Image_3D);
+}
+
+void OpenGL::NullBackend::copy_buffer_sub_data(const GLuint&     in_read_buffer_id,
+                                               const GLuint&     in_write_buffer_id,
+                                               const GLintptr&   in_read_offset,
+                                               const GLintptr&   in_write_offset,
+                                               const GLsizeiptr& in_size)
+{
+    on_callback(NullBackendCallback::Copy_Buffer_Sub_Data);
+}
+
+void OpenGL::NullBackend::copy_tex_image_1d(const GLuint&                 in_id,
+                                            const GLint                   in_level,
+                                            const OpenGL::InternalFormat& in_internalformat,
+                                            const GLint&                  in_x,
+                                            const GLint&                  in_y,
+                                            const GLsizei&                in_width,
+                                            const GLint&                  in_border)
+{
+    on_callback(NullBackendCallback::Copy_Tex_Image_1D);
+}
+
+void OpenGL::NullBackend::copy_tex_image_2d(const GLuint&                 in_id,
+                                            const GLint&                  in_level,
+                                            const OpenGL::InternalFormat& in_internalformat,
+                                            const GLint&                  in_x,
+                                            const GLint&                  in_y,
+                                            const GLsizei&                in_width,
+                                            const GLsizei&                in_height,
+                                            const GLint&                  in_border)
+{
+    on_callback(NullBackendCallback::Copy_Tex_Image_2D);
+}
+
+void OpenGL::NullBackend::copy_tex_sub_image_1d(const GLuint&  in_id,
+                                                const GLint&   in_level,
+                                                const GLint&   in_xoffset,
+                                                const GLint&   in_x,
+                                                const GLint&   in_y,
+                                                const GLsizei& in_width)
+{
+    on_callback(NullBackendCallback::Copy_Tex_Sub_Image_1D);
+}
+
+void OpenGL::NullBackend::copy_tex_sub_image_2d(const GLuint&  in_id,
+                                                const GLint&   in_level,
+                                                const GLint&   in_xoffset,
+                                                const GLint&   in_yoffset,
+                                                const GLint&   in_x,
+                                                const GLint&   in_y,
+                                                const GLsizei& in_width,
+                                                const GLsizei& in_height)
+{
+    on_callback(NullBackendCallback::Copy_Tex_Sub_Image_2D);
+}
+
+void OpenGL::NullBackend::copy_tex_sub_image_3d(const GLuint&  in_id,
+                                                const GLint&   in_level,
+                                                const GLint&   in_xoffset,
+                                                const GLint&   in_yoffset,
+                                                const GLint&   in_zoffset,
+                                                const GLint&   in_x,
+                                                const GLint&   in_y,
+                                                const GLsizei& in_width,
+                                                const GLsizei& in_height)
+{
+    on_callback(NullBackendCallback::Copy_Tex_Sub_Image_3D);
+}
+
+void OpenGL::NullBackend::draw_arrays(const OpenGL::DrawCallMode& in_mode,
+                                      const GLint&                in_first,
+                                      const GLsizei&              in_count)
+{
+    on_callback(NullBackendCallback::Draw_Arrays);
+}
+
+void OpenGL::NullBackend::draw_elements(const OpenGL::DrawCallMode&      in_mode,
+                                        const GLsizei&                   in_count,
+                                        const OpenGL::DrawCallIndexType& in_type,
+                                        const void*                      in_indices)
+{
+    on_callback(NullBackendCallback::Draw_Elements);
+}
+
+void OpenGL::NullBackend::draw_range_elements(const OpenGL::DrawCallMode&      in_mode,
+                                              const GLuint&                    in_start,
+                                              const GLuint&                    in_end,
+                                              const GLsizei&                   in_count,
+                                              const OpenGL::DrawCallIndexType& in_type,
+                                              const void*                      in_indices)
+{
+    on_callback(NullBackendCallback::Draw_Range_Elements);
+}
+
+void OpenGL::NullBackend::finish()
+{
+    on_callback(NullBackendCallback::Finish);
+}
+
+void OpenGL::NullBackend::flush(VKGL::Fence* in_opt_fence_ptr)
+{
+    on_callback(NullBackendCallback::Flush);
+
+    if (in_opt_fence_ptr != nullptr)
+    {
+        in_opt_fence_ptr->signal();
+    }
+}
+
+void OpenGL::NullBackend::flush_mapped_buffer_range(const GLuint&     in_id,
+                                                    const GLintptr&   in_offset,
+                                                    const GLsizeiptr& in_length)
+{
+    on_callback(NullBackendCallback::Flush_Mapped_Buffer_Range);
+}
+
+void OpenGL::NullBackend::generate_mipmap(const GLuint& in_id)
+{
+    on_callback(NullBackendCallback::Generate_Mipmap);
+}
+
+void OpenGL::NullBackend::get_buffer_sub_data(const GLuint&     in_id,
+                                              const GLintptr&   in_offset,
+                                              const GLsizeiptr& in_size,
+                                              void*             out_data_ptr)
+{
+    on_callback(NullBackendCallback::Get_Buffer_Sub_Data);
+
+    memset(out_data_ptr,
+           0,
+           static_cast<size_t>(in_size) );
+}
+
+const char* OpenGL::NullBackend::get_callback_name(const NullBackendCallback& in_callback)
+{
+    const char* result_ptr = "?";
+
+    switch (in_callback)
+    {
+        case OpenGL::NullBackendCallback::On_Objects_Created:           result_ptr = "on_objects_created";           break;
+        case OpenGL::NullBackendCallback::On_Objects_Destroyed:         result_ptr = "on_objects_destroyed";         break;
+        case OpenGL::NullBackendCallback::Buffer_Data:                  result_ptr = "buffer_data";                  break;
+        case OpenGL::NullBackendCallback::Buffer_Sub_Data:              result_ptr = "buffer_sub_data";              break;
+        case OpenGL::NullBackendCallback::Copy_Buffer_Sub_Data:         result_ptr = "copy_buffer_sub_data";         break;
+        case OpenGL::NullBackendCallback::Flush_Mapped_Buffer_Range:    result_ptr = "flush_mapped_buffer_range";    break;
+        case OpenGL::NullBackendCallback::Get_Buffer_Sub_Data:          result_ptr = "get_buffer_sub_data";          break;
+        case OpenGL::NullBackendCallback::Map_Buffer:                   result_ptr = "map_buffer";                   break;
+        case OpenGL::NullBackendCallback::Unmap_Buffer:                 result_ptr = "unmap_buffer";                 break;
+        case OpenGL::NullBackendCallback::Compile_Shader:               result_ptr = "compile_shader";               break;
+        case OpenGL::NullBackendCallback::Link_Program:                 result_ptr = "link_program";                 break;
+        case OpenGL::NullBackendCallback::Validate_Program:             result_ptr = "validate_program";             break;
+        case OpenGL::NullBackendCallback::Draw_Arrays:                  result_ptr = "draw_arrays";                  break;
+        case OpenGL::NullBackendCallback::Draw_Elements:                result_ptr = "draw_elements";                break;
+        case OpenGL::NullBackendCallback::Draw_Range_Elements:          result_ptr = "draw_range_elements";          break;
+        case OpenGL::NullBackendCallback::Multi_Draw_Arrays:            result_ptr = "multi_draw_arrays";            break;
+        case OpenGL::NullBackendCallback::Multi_Draw_Elements:          result_ptr = "multi_draw_elements";          break;
+        case OpenGL::NullBackendCallback::Finish:                       result_ptr = "finish";                       break;
+        case OpenGL::NullBackendCallback::Flush:                        result_ptr = "flush";                        break;
+        case OpenGL::NullBackendCallback::Clear:                        result_ptr = "clear";                        break;
+        case OpenGL::NullBackendCallback::Get_Compressed_Tex_Image:     result_ptr = "get_compressed_tex_image";     break;
+        case OpenGL::NullBackendCallback::Get_Texture_Image:            result_ptr = "get_texture_image";            break;
+        case OpenGL::NullBackendCallback::Read_Pixels:                  result_ptr = "read_pixels";                  break;
+        case OpenGL::NullBackendCallback::Renderbuffer_Storage:         result_ptr = "renderbuffer_storage";         break;
+        case OpenGL::NullBackendCallback::Copy_Tex_Image_1D:            result_ptr = "copy_tex_image_1d";            break;
+        case OpenGL::NullBackendCallback::Copy_Tex_Image_2D:            result_ptr = "copy_tex_image_2d";            break;
+        case OpenGL::NullBackendCallback::Copy_Tex_Sub_Image_1D:        result_ptr = "copy_tex_sub_image_1d";        break;
+        case OpenGL::NullBackendCallback::Copy_Tex_Sub_Image_2D:        result_ptr = "copy_tex_sub_image_2d";        break;
+        case OpenGL::NullBackendCallback::Copy_Tex_Sub_Image_3D:        result_ptr = "copy_tex_sub_image_3d";        break;
+        case OpenGL::NullBackendCallback::Compressed_Tex_Image_1D:      result_ptr = "compressed_tex_image_1d";      break;
+        case OpenGL::NullBackendCallback::Compressed_Tex_Image_2D:      result_ptr = "compressed_tex_image_2d";      break;
+        case OpenGL::NullBackendCallback::Compressed_Tex_Image_3D:      result_ptr = "compressed_tex_image_3d";      break;
+        case OpenGL::NullBackendCallback::Compressed_Tex_Sub_Image_1D:  result_ptr = "compressed_tex_sub_image_1d";  break;
+        case OpenGL::NullBackendCallback::Compressed_Tex_Sub_Image_2D:  result_ptr = "compressed_tex_sub_image_2d";  break;
+        case OpenGL::NullBackendCallback::Compressed_Tex_Sub_Image_3D:  result_ptr = "compressed_tex_sub_image_3d";  break;
+        case OpenGL::NullBackendCallback::Tex_Image_1D:                 result_ptr = "tex_image_1d";                 break;
+        case OpenGL::NullBackendCallback::Tex_Image_2D:                 result_ptr = "tex_image_2d";                 break;
+        case OpenGL::NullBackendCallback::Tex_Image_3D:                 result_ptr = "tex_image_3d";                 break;
+        case OpenGL::NullBackendCallback::Tex_Sub_Image_1D:             result_ptr = "tex_sub_image_1d";             break;
+        case OpenGL::NullBackendCallback::Tex_Sub_Image_2D:             result_ptr = "tex_sub_image_2d";             break;
+        case OpenGL::NullBackendCallback::Tex_Sub_Image_3D:             result_ptr = "tex_sub_image_3d";             break;
+        case OpenGL::NullBackendCallback::Generate_Mipmap:              result_ptr = "generate_mipmap";              break;
+        case OpenGL::NullBackendCallback::Update_Uniform_Data:          result_ptr = "update_uniform_data";          break;
+        case OpenGL::NullBackendCallback::Present:                      result_ptr = "present";                      break;
+
+        default:
+        {
+            vkgl_assert_fail();
+        }
+    }
+
+    return result_ptr;
+}
+
+void OpenGL::NullBackend::get_capability(const OpenGL::BackendCapability&  in_capability,
+                                         const OpenGL::GetSetArgumentType& in_arg_type,
+                                         const uint32_t&                   in_n_vals,
+                                         void*                             out_result_ptr) const
+{
+    const auto cap_iterator = m_capabilities.find(in_capability);
+
+    if (cap_iterator == m_capabilities.end() )
+    {
+        vkgl_assert(cap_iterator != m_capabilities.end() );
+
+        goto end;
+    }
+
+    if (cap_iterator->second.n_vals < in_n_vals)
+    {
+        vkgl_assert(cap_iterator->second.n_vals >= in_n_vals);
+
+        goto end;
+    }
+
+    OpenGL::Converters::convert(cap_iterator->second.data_type,
+                                cap_iterator->second.data.u32,
+                                cap_iterator->second.n_vals,
+                                in_arg_type,
+                                out_result_ptr);
+
+end:
+    ;
+}
+
+void OpenGL::NullBackend::get_compressed_tex_image(const GLuint& in_id,
+                                                   const GLint&  in_level,
+                                                   void*         in_img)
+{
+    on_callback(NullBackendCallback::Get_Compressed_Tex_Image);
+}
+
+void OpenGL::NullBackend::get_texture_image(const GLuint&              in_id,
+                                            const uint32_t&            in_level,
+                                            const OpenGL::PixelFormat& in_format,
+                                            const OpenGL::PixelType&   in_type,
+                                            void*                      out_pixels_ptr)
+{
+    on_callback(NullBackendCallback::Get_Texture_Image);
+}
+
+uint64_t OpenGL::NullBackend::get_total_n_calls() const
+{
+    uint64_t result = 0;
+
+    for (uint32_t n_callback = 0;
+                  n_callback < static_cast<uint32_t>(NullBackendCallback::Count);
+                ++n_callback)
+    {
+        result += m_n_calls[n_callback];
+    }
+
+    return result;
+}
+
+void OpenGL::NullBackend::init_capabilities()
+{
+    /* NOTE: Min maxes taken from GL 3.2 spec. Combined uniform components and the UBO offset alignment are not specified
+     *       there, so these use values common on desktop implementations. */
+    const auto add_f32_capability = [this](const OpenGL::BackendCapability& in_capability,
+                                           const float&                     in_value0,
+                                           const float&                     in_value1,
+                                           const uint32_t&                  in_n_vals = 2)
+    {
+        auto& cap_data = m_capabilities[in_capability];
+
+        cap_data.data.f32[0] = in_value0;
+        cap_data.data.f32[1] = in_value1;
+        cap_data.data_type   = OpenGL::GetSetArgumentType::Float;
+        cap_data.n_vals      = in_n_vals;
+    };
+    const auto add_u32_capability = [this](const OpenGL::BackendCapability& in_capability,
+                                           const uint32_t&                  in_value)
+    {
+        auto& cap_data = m_capabilities[in_capability];
+
+        cap_data.data.u32[0] = in_value;
+        cap_data.data.u32[1] = 0;
+        cap_data.data_type   = OpenGL::GetSetArgumentType::Unsigned_Int;
+        cap_data.n_vals      = 1;
+    };
+    const auto add_u64_capability = [this](const OpenGL::BackendCapability& in_capability,
+                                           const uint64_t&                  in_value)
+    {
+        auto& cap_data = m_capabilities[in_capability];
+
+        cap_data.data.u64[0] = in_value;
+        cap_data.data.u64[1] = 0;
+        cap_data.data_type   = OpenGL::GetSetArgumentType::Unsigned_Int64;
+        cap_data.n_vals      = 1;
+    };
+
+    add_f32_capability(OpenGL::BackendCapability::Aliased_Line_Width_Range,                      1.0f, 1.0f);
+    add_u32_capability(OpenGL::BackendCapability::Max_3D_Texture_Size,                           256);
+    add_u32_capability(OpenGL::BackendCapability::Max_Array_Texture_Layers,                      256);
+    add_u32_capability(OpenGL::BackendCapability::Max_Clip_Distances,                            8);
+    add_u32_capability(OpenGL::BackendCapability::Max_Color_Attachments,                         8);
+    add_u32_capability(OpenGL::BackendCapability::Max_Color_Texture_Samples,                     1);
+    add_u32_capability(OpenGL::BackendCapability::Max_Combined_Fragment_Uniform_Components,      1024);
+    add_u32_capability(OpenGL::BackendCapability::Max_Combined_Geometry_Uniform_Components,      1024);
+    add_u32_capability(OpenGL::BackendCapability::Max_Combined_Texture_Image_Units,              48);
+    add_u32_capability(OpenGL::BackendCapability::Max_Combined_Uniform_Blocks,                   36);
+    add_u32_capability(OpenGL::BackendCapability::Max_Combined_Vertex_Uniform_Components,        1024);
+    add_u32_capability(OpenGL::BackendCapability::Max_Cube_Map_Texture_Size,                     1024);
+    add_u32_capability(OpenGL::BackendCapability::Max_Depth_Texture_Samples,                     1);
+    add_u32_capability(OpenGL::BackendCapability::Max_Draw_Buffers,                              8);
+    add_u32_capability(OpenGL::BackendCapability::Max_Elements_Indices,                          UINT32_MAX);
+    add_u32_capability(OpenGL::BackendCapability::Max_Elements_Vertices,                         UINT32_MAX);
+    add_u32_capability(OpenGL::BackendCapability::Max_Fragment_Input_Components,                 128);
+    add_u32_capability(OpenGL::BackendCapability::Max_Fragment_Uniform_Blocks,                   12);
+    add_u32_capability(OpenGL::BackendCapability::Max_Fragment_Uniform_Components,               1024);
+    add_u32_capability(OpenGL::BackendCapability::Max_Geometry_Input_Components,                 64);
+    add_u32_capability(OpenGL::BackendCapability::Max_Geometry_Output_Components,                128);
+    add_u32_capability(OpenGL::BackendCapability::Max_Geometry_Output_Vertices,                  256);
+    add_u32_capability(OpenGL::BackendCapability::Max_Geometry_Texture_Image_Units,              16);
+    add_u32_capability(OpenGL::BackendCapability::Max_Geometry_Total_Output_Components,          1024);
+    add_u32_capability(OpenGL::BackendCapability::Max_Geometry_Uniform_Blocks,                   12);
+    add_u32_capability(OpenGL::BackendCapability::Max_Geometry_Uniform_Components,               1024);
+    add_u32_capability(OpenGL::BackendCapability::Max_Integer_Samples,                           1);
+    add_u32_capability(OpenGL::BackendCapability::Max_Program_Texel_Offset,                      7);
+    add_u32_capability(OpenGL::BackendCapability::Max_Rectangle_Texture_Size,                    1024);
+    add_u32_capability(OpenGL::BackendCapability::Max_Renderbuffer_Size,                         1024);
+    add_u32_capability(OpenGL::BackendCapability::Max_Sample_Mask_Words,                         1);
+    add_u32_capability(OpenGL::BackendCapability::Max_Samples,                                   1);
+    add_u64_capability(OpenGL::BackendCapability::Max_Server_Wait_Timeout,                       UINT64_MAX);
+    add_u32_capability(OpenGL::BackendCapability::Max_Texture_Buffer_Size,                       65536);
+    add_u32_capability(OpenGL::BackendCapability::Max_Texture_Image_Units,                       16);
+    add_f32_capability(OpenGL::BackendCapability::Max_Texture_LOD_Bias,                          2.0f, 0.0f, 1);
+    add_u32_capability(OpenGL::BackendCapability::Max_Texture_Size,                              1024);
+    add_u32_capability(OpenGL::BackendCapability::Max_Transform_Feedback_Buffers,                4);
+    add_u32_capability(OpenGL::BackendCapability::Max_Transform_Feedback_Interleaved_Components, 64);
+    add_u32_capability(OpenGL::BackendCapability::Max_Transform_Feedback_Separate_Attribs,       4);
+    add_u32_capability(OpenGL::BackendCapability::Max_Transform_Feedback_Separate_Components,    4);
+    add_u32_capability(OpenGL::BackendCapability::Max_Uniform_Block_Size,                        16384);
+    add_u32_capability(OpenGL::BackendCapability::Max_Uniform_Buffer_Bindings,                   36);
+    add_u32_capability(OpenGL::BackendCapability::Max_Varying_Components,                        60);
+    add_u32_capability(OpenGL::BackendCapability::Max_Vertex_Attribs,                            16);
+    add_u32_capability(OpenGL::BackendCapability::Max_Vertex_Output_Components,                  64);
+    add_u32_capability(OpenGL::BackendCapability::Max_Vertex_Texture_Image_Units,                16);
+    add_u32_capability(OpenGL::BackendCapability::Max_Vertex_Uniform_Blocks,                     12);
+    add_u32_capability(OpenGL::BackendCapability::Max_Vertex_Uniform_Components,                 1024);
+    add_f32_capability(OpenGL::BackendCapability::Min_Program_Texel_Offset,                      -8.0f, 0.0f, 1);
+    add_f32_capability(OpenGL::BackendCapability::Point_Size_Granularity,                        1.0f, 0.0f, 1);
+    add_f32_capability(OpenGL::BackendCapability::Point_Size_Range,                              1.0f, 64.0f);
+    add_u32_capability(OpenGL::BackendCapability::Query_Counter_Bits,                            64);
+    add_f32_capability(OpenGL::BackendCapability::Smooth_Line_Width_Granularity,                 1.0f, 0.0f, 1);
+    add_f32_capability(OpenGL::BackendCapability::Smooth_Line_Width_Range,                       1.0f, 1.0f);
+    add_u32_capability(OpenGL::BackendCapability::Subpixel_Bits,                                 4);
+    add_u32_capability(OpenGL::BackendCapability::Uniform_Buffer_Offset_Alignment,               256);
+}
+
+void OpenGL::NullBackend::link_program(const GLuint& in_program_id)
+{
+    on_callback(NullBackendCallback::Link_Program);
+}
+
+void* OpenGL::NullBackend::map_buffer(const GLuint&                in_id,
+                                      const OpenGL::BufferMapBits& in_map_bits,
+                                      const GLintptr&              in_start_offset,
+                                      const GLsizeiptr&            in_length)
+{
+    auto  storage_iterator = m_buffer_storage.find(in_id);
+    void* result_ptr       = nullptr;
+
+    on_callback(NullBackendCallback::Map_Buffer);
+
+    if (storage_iterator == m_buffer_storage.end() )
+    {
+        vkgl_assert(storage_iterator != m_buffer_storage.end() );
+
+        goto end;
+    }
+
+    vkgl_assert(static_cast<size_t>(in_start_offset + in_length) <= storage_iterator->second.size() );
+
+    result_ptr = storage_iterator->second.data() + in_start_offset;
+end:
+    return result_ptr;
+}
+
+void OpenGL::NullBackend::multi_draw_arrays(const OpenGL::DrawCallMode& in_mode,
+                                            const GLint*                in_first_ptr,
+                                            const GLsizei*              in_count_ptr,
+                                            const GLsizei&              in_drawcount)
+{
+    on_callback(NullBackendCallback::Multi_Draw_Arrays);
+}
+
+void OpenGL::NullBackend::multi_draw_elements(const OpenGL::DrawCallMode&      in_mode,
+                                              const GLsizei*                   in_count_ptr,
+                                              const OpenGL::DrawCallIndexType& in_type,
+                                              const void* const*               in_indices_ptr,
+                                              const GLsizei&                   in_drawcount)
+{
+    on_callback(NullBackendCallback::Multi_Draw_Elements);
+}
+
+void OpenGL::NullBackend::on_objects_created(const OpenGL::ObjectType& in_object_type,
+                                             const uint32_t&           in_n_ids,
+                                             const GLuint*             in_ids_ptr)
+{
+    on_callback(NullBackendCallback::On_Objects_Created);
+}
+
+void OpenGL::NullBackend::on_objects_destroyed(const OpenGL::ObjectType& in_object_type,
+                                               const uint32_t&           in_n_ids,
+                                               const GLuint*             in_ids_ptr)
+{
+    on_callback(NullBackendCallback::On_Objects_Destroyed);
+
+    if (in_object_type == OpenGL::ObjectType::Buffer)
+    {
+        for (uint32_t n_id = 0;
+                      n_id < in_n_ids;
+                    ++n_id)
+        {
+            m_buffer_storage.erase(in_ids_ptr[n_id]);
+        }
+    }
+}
+
+void OpenGL::NullBackend::present()
+{
+    on_callback(NullBackendCallback::Present);
+}
+
+void OpenGL::NullBackend::read_pixels(const int32_t&             in_x,
+                                      const int32_t&             in_y,
+                                      const size_t&              in_width,
+                                      const size_t&              in_height,
+                                      const OpenGL::PixelFormat& in_format,
+                                      const OpenGL::PixelType&   in_type,
+                                      void*                      out_pixels_ptr)
+{
+    on_callback(NullBackendCallback::Read_Pixels);
+}
+
+void OpenGL::NullBackend::renderbuffer_storage(const GLuint&                 in_id,
+                                               const OpenGL::InternalFormat& in_internalformat,
+                                               const uint32_t&               in_width,
+                                               const uint32_t&               in_height,
+                                               const uint32_t&               in_samples)
+{
+    on_callback(NullBackendCallback::Renderbuffer_Storage);
+}
+
+void OpenGL::NullBackend::reset_counters()
+{
+    memset(m_n_calls,
+           0,
+           sizeof(m_n_calls) );
+
+    m_recorded_calls.clear();
+}
+
+void OpenGL::NullBackend::tex_image_1d(const GLuint&                 in_id,
+                                       const int32_t&                in_level,
+                                       const OpenGL::InternalFormat& in_internalformat,
+                                       const int32_t&                in_width,
+                                       const int32_t&                in_border,
+                                       const OpenGL::PixelFormat&    in_format,
+                                       const OpenGL::PixelType&      in_type,
+                                       const void*                   in_pixels_ptr)
+{
+    on_callback(NullBackendCallback::Tex_Image_1D);
+}
+
+void OpenGL::NullBackend::tex_image_2d(const GLuint&                 in_id,
+                                       const GLint&                  in_level,
+                                       const OpenGL::InternalFormat& in_internalformat,
+                                       const GLsizei&                in_width,
+                                       const GLsizei&                in_height,
+                                       const GLint&                  in_border,
+                                       const OpenGL::PixelFormat&    in_format,
+                                       const OpenGL::PixelType&      in_type,
+                                       const void*                   in_pixels_ptr)
+{
+    on_callback(NullBackendCallback::Tex_Image_2D);
+}
+
+void OpenGL::NullBackend::tex_image_3d(const GLuint&                 in_id,
+                                       const GLint&                  in_level,
+                                       const OpenGL::InternalFormat& in_internalformat,
+                                       const GLsizei&                in_width,
+                                       const GLsizei&                in_height,
+                                       const GLsizei&                in_depth,
+                                       const GLint&                  in_border,
+                                       const OpenGL::PixelFormat&    in_format,
+                                       const OpenGL::PixelType&      in_type,
+                                       const void*                   in_pixels_ptr)
+{
+    on_callback(NullBackendCallback::Tex_Image_3D);
+}
+
+void OpenGL::NullBackend::tex_sub_image_1d(const GLuint&              in_id,
+                                           const GLint&               in_level,
+                                           const GLint&               in_xoffset,
+                                           const GLsizei&             in_width,
+                                           const OpenGL::PixelFormat& in_format,
+                                           const OpenGL::PixelType&   in_type,
+                                           const void*                in_pixels)
+{
+    on_callback(NullBackendCallback::Tex_Sub_Image_1D);
+}
+
+void OpenGL::NullBackend::tex_sub_image_2d(const GLuint&              in_id,
+                                           const GLint&               in_level,
+                                           const GLint&               in_xoffset,
+                                           const GLint&               in_yoffset,
+                                           const GLsizei&             in_width,
+                                           const GLsizei&             in_height,
+                                           const OpenGL::PixelFormat& in_format,
+                                           const OpenGL::PixelType&   in_type,
+                                           const void*                in_pixels)
+{
+    on_callback(NullBackendCallback::Tex_Sub_Image_2D);
+}
+
+void OpenGL::NullBackend::tex_sub_image_3d(const GLuint&              in_id,
+                                           const GLint&               in_level,
+                                           const GLint&               in_xoffset,
+                                           const GLint&               in_yoffset,
+                                           const GLint&               in_zoffset,
+                                           const GLsizei&             in_width,
+                                           const GLsizei&             in_height,
+                                           const GLsizei&             in_depth,
+                                           const OpenGL::PixelFormat& in_format,
+                                           const OpenGL::PixelType&   in_type,
+                                           const void*                in_pixels)
+{
+    on_callback(NullBackendCallback::Tex_Sub_Image_3D);
+}
+
+bool OpenGL::NullBackend::unmap_buffer(const GLuint& in_id)
+{
+    on_callback(NullBackendCallback::Unmap_Buffer);
+
+    return true;
+}
+
+void OpenGL::NullBackend::update_uniform_data(const GLuint&  in_id,
+                                              const GLint&   in_location,
+                                              const GLsizei& in_count,
+                                              const void*    in_data_ptr)
+{
+    on_callback(NullBackendCallback::Update_Uniform_Data);
+}
+
+void OpenGL::NullBackend::validate_program(const GLuint& in_program_id)
+{
+    on_callback(NullBackendCallback::Validate_Program);
+}
@@ -2,12 +2,17 @@
  *
  * This code is licensed under MIT license (see LICENSE.txt for details)
  */
+#include "Common/trace_recorder.h"
 #include "OpenGL/backend/thread_pool.h"
+#include <algorithm>
+#include <thread>
 
-OpenGL::ThreadPool::Task::Task(std::function<void()> in_callback_func,
+OpenGL::ThreadPool::Task::Task(ThreadPool*           in_thread_pool_ptr,
+                               std::function<void()> in_callback_func,
                                EnkiTaskSetUniquePtr  in_enki_task_set_ptr)
     :m_callback_func              (in_callback_func),
-     m_enki_task_set_ptr(std::move(in_enki_task_set_ptr) )
+     m_enki_task_set_ptr(std::move(in_enki_task_set_ptr) ),
+     m_thread_pool_ptr            (in_thread_pool_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -24,19 +29,40 @@ void OpenGL::ThreadPool::Task::handle_callback(uint32_t in_start,
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    Task* task_ptr = reinterpret_cast<Task*>(in_args_ptr);
+    static thread_local bool is_thread_named = false;
+    Task*                    task_ptr        = reinterpret_cast<Task*>(in_args_ptr);
 
     vkgl_assert(in_start    == 0);
     vkgl_assert(in_end      == 1);
     vkgl_assert(in_args_ptr != nullptr);
 
-    task_ptr->m_callback_func();
+    /* Worker threads are owned by enkiTS, so name their trace tracks the first time they pick up a task. */
+    if (!is_thread_named)
+    {
+        VKGL::TraceRecorder::set_thread_name("VKGL worker thread " + std::to_string(in_n_thread) );
+
+        is_thread_named = true;
+    }
+
+    {
+        VKGL_TRACE_SCOPE("Worker task");
+
+        task_ptr->m_callback_func();
+    }
+
+    /* NOTE: Queued tasks are handed to enkiTS before this one completes, so that enkiWaitForAll() does not
+     *       return early.
+     */
+    task_ptr->m_thread_pool_ptr->on_task_finished();
 
     delete task_ptr;
 }
 
 OpenGL::ThreadPool::ThreadPool()
-    :m_task_scheduler_ptr(nullptr)
+    :m_max_n_running_tasks(0),
+     m_n_running_tasks    (0),
+     m_n_worker_threads   (0),
+     m_task_scheduler_ptr (nullptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -73,6 +99,44 @@ OpenGL::ThreadPoolUniquePtr OpenGL::ThreadPool::create()
     return result_ptr;
 }
 
+void OpenGL::ThreadPool::dispatch_pending_tasks()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    /* NOTE: m_mutex must be held by the caller. */
+    while (m_pending_tasks.size() > 0                   &&
+           m_n_running_tasks      < m_max_n_running_tasks)
+    {
+        EnkiTaskSetUniquePtr enki_task_set_ptr;
+        Task*                task_ptr          = nullptr;
+
+        enki_task_set_ptr.reset(
+            new EnkiTaskSet(m_task_scheduler_ptr,
+                            OpenGL::ThreadPool::Task::handle_callback)
+        );
+        vkgl_assert(enki_task_set_ptr != nullptr);
+
+        m_n_running_tasks++;
+
+        /* NOTE: Task instance deletes itself upon completion */
+        task_ptr = new Task(this,
+                            std::move(m_pending_tasks.front() ),
+                            std::move(enki_task_set_ptr) );
+        vkgl_assert(task_ptr != nullptr);
+
+        m_pending_tasks.pop_front();
+    }
+}
+
+uint32_t OpenGL::ThreadPool::get_max_n_running_tasks() const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_max_n_running_tasks;
+}
+
 bool OpenGL::ThreadPool::init()
 {
     FUN_ENTRY(DEBUG_DEPTH);
@@ -82,27 +146,56 @@ bool OpenGL::ThreadPool::init()
     m_task_scheduler_ptr = enkiNewTaskScheduler();
     vkgl_assert(m_task_scheduler_ptr != nullptr);
 
-    enkiInitTaskScheduler(m_task_scheduler_ptr);
+    /* enkiTS counts the calling thread in, but only runs tasks on it while it waits for them. VKGL never does that on
+     * app's thread, so make sure there is at least one worker.
+     */
+    enkiInitTaskSchedulerNumThreads(m_task_scheduler_ptr,
+                                    std::max(std::thread::hardware_concurrency(),
+                                             2u) );
+
+    m_n_worker_threads    = enkiGetNumTaskThreads(m_task_scheduler_ptr) - 1;
+    m_max_n_running_tasks = m_n_worker_threads;
+
+    vkgl_assert(m_n_worker_threads > 0);
 
     result = true;
     return result;
 }
 
+void OpenGL::ThreadPool::on_task_finished()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    vkgl_assert(m_n_running_tasks > 0);
+
+    m_n_running_tasks--;
+
+    dispatch_pending_tasks();
+}
+
+void OpenGL::ThreadPool::set_max_n_running_tasks(const uint32_t& in_max_n_running_tasks)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_max_n_running_tasks = std::min(std::max(in_max_n_running_tasks,
+                                              1u),
+                                     m_n_worker_threads);
+
+    /* Tasks which are already running are not affected by a lower limit. A higher one may let queued tasks in. */
+    dispatch_pending_tasks();
+}
+
 void OpenGL::ThreadPool::submit_task(std::function<void()> in_callback)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    EnkiTaskSetUniquePtr enki_task_set_ptr;
-    Task*                task_ptr          = nullptr;
-
-    enki_task_set_ptr.reset(
-        new EnkiTaskSet(m_task_scheduler_ptr,
-                        OpenGL::ThreadPool::Task::handle_callback)
-    );
-    vkgl_assert(enki_task_set_ptr != nullptr);
-
-    /* NOTE: Task instance deletes itself upon completion */
-    task_ptr = new Task(in_callback,
-                        std::move(enki_task_set_ptr) );
-    vkgl_assert(task_ptr != nullptr);
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_pending_tasks.push_back(std::move(in_callback) );
+
+    dispatch_pending_tasks();
 }
@@ -12,6 +12,7 @@
 #include "Anvil/include/wrappers/image.h"
 #include "Common/logger.h"
 #include "Common/macros.h"
+#include "Common/trace_recorder.h"
 #include "OpenGL/types.h"
 #include "OpenGL/converters.h"
 #include "OpenGL/backend/thread_pool.h"
@@ -45,6 +46,13 @@
     #undef min
 #endif
 
+/* Max number of frames the app's rendering thread may run ahead of the GPU. Once reached, present() blocks until the oldest
+ * frame finishes executing. Lower values reduce input latency, higher ones let the CPU absorb frame time spikes.
+ */
+#ifndef VKGL_MAX_FRAMES_IN_FLIGHT
+    #define VKGL_MAX_FRAMES_IN_FLIGHT (2)
+#endif
+
 OpenGL::VKBackend::VKBackend(const VKGL::IWSIContext* in_wsi_context_ptr)
     :m_frontend_ptr   (nullptr),
      m_wsi_context_ptr(in_wsi_context_ptr)
@@ -78,6 +86,11 @@ OpenGL::VKBackend::~VKBackend()
     m_renderpass_manager_ptr.reset  ();
     m_swapchain_manager_ptr.reset   ();
 
+    /* Sync objects are returned to the pool when their owners (incl. the swapchain manager) go out of scope, so the pool must
+     * go last.
+     */
+    m_sync_object_pool_ptr.reset();
+
     m_device_ptr.reset  ();
     m_instance_ptr.reset();
 }
@@ -106,7 +119,11 @@ void OpenGL::VKBackend::buffer_data(const GLuint&     in_id,
 
     vkgl_assert(buffer_reference_ptr != nullptr);
 
-    /* 3. Spawn the command container .. */
+    /* 3. Any map backing the buffer may have been assigned no longer reflects buffer contents. */
+    m_buffer_manager_ptr->invalidate_map_backing(in_id,
+                                                 buffer_reference_ptr->get_payload().object_creation_time);
+
+    /* 4. Spawn the command container .. */
     OpenGL::CommandBaseUniquePtr cmd_ptr(new OpenGL::BufferDataCommand(std::move(buffer_reference_ptr),
                                                                        std::move(data_ptr),
                                                                        in_size),
@@ -142,7 +159,11 @@ void OpenGL::VKBackend::buffer_sub_data(const GLuint&     in_id,
 
     vkgl_assert(buffer_reference_ptr != nullptr);
 
-    /* 3. Spawn the command container .. */
+    /* 3. Any map backing the buffer may have been assigned no longer reflects buffer contents. */
+    m_buffer_manager_ptr->invalidate_map_backing(in_id,
+                                                 buffer_reference_ptr->get_payload().object_creation_time);
+
+    /* 4. Spawn the command container .. */
     OpenGL::CommandBaseUniquePtr cmd_ptr(new OpenGL::BufferSubDataCommand(std::move(buffer_reference_ptr),
                                                                           std::move(data_ptr),
                                                                           in_size,
@@ -460,29 +481,27 @@ void OpenGL::VKBackend::draw_arrays(const OpenGL::DrawCallMode& in_mode,
 
     vkgl_assert(state_binding_references_ptr != nullptr);
 
-    {
-        const auto&                 		program_payload              		= state_binding_references_ptr->program_reference_ptr->get_payload();
-        SPIRVBlobID 						spirv_id 							= UINT_MAX;
-        vkgl_assert(m_spirv_manager_ptr != nullptr);
-        m_spirv_manager_ptr->get_spirv_blob_id_for_program_reference(program_payload.id,
-        																		program_payload.time_marker,
-        																		&spirv_id);
-        vkgl_assert(spirv_id != UINT_MAX);
-        
-        update_texture_reference_for_uniform_resources(spirv_id);
-    }
-    
-    /* 2. Spawn the command container .. */
+    /* 2. Prepare the program's uniform resources. If the program is still being linked, leave it to the scheduler
+     *    so that the app's thread does not wait for the link to finish.
+     */
+    vkgl_assert(m_spirv_manager_ptr != nullptr);
+
+    const bool is_program_link_pending = !m_spirv_manager_ptr->prepare_program_for_draw(state_binding_references_ptr->program_reference_ptr.get(),
+                                                                                        state_reference_ptr.get(),
+                                                                                        false); /* in_wait_for_link */
+
+    /* 3. Spawn the command container .. */
     OpenGL::CommandBaseUniquePtr cmd_ptr(new OpenGL::DrawArraysCommand(in_count,
                                                                        in_first,
                                                                        in_mode,
                                                                        std::move(state_reference_ptr),
-                                                                       std::move(state_binding_references_ptr) ),
+                                                                       std::move(state_binding_references_ptr),
+                                                                       is_program_link_pending),
                                          std::default_delete<OpenGL::CommandBase>() );
 
     vkgl_assert(cmd_ptr != nullptr);
 
-    /* 2. Submit the command */
+    /* 4. Submit the command */
     m_scheduler_ptr->submit(std::move(cmd_ptr) );
 }
 
@@ -508,19 +527,16 @@ void OpenGL::VKBackend::draw_elements(const OpenGL::DrawCallMode&      in_mode,
 
     vkgl_assert(state_binding_references_ptr != nullptr);
 
-	{
-        const auto&                 		program_payload              		= state_binding_references_ptr->program_reference_ptr->get_payload();
-        SPIRVBlobID 						spirv_id 							= UINT_MAX;
-        vkgl_assert(m_spirv_manager_ptr != nullptr);
-        m_spirv_manager_ptr->get_spirv_blob_id_for_program_reference(program_payload.id,
-        																		program_payload.time_marker,
-        																		&spirv_id);
-        vkgl_assert(spirv_id != UINT_MAX);
-        
-        update_texture_reference_for_uniform_resources(spirv_id);
-    }
+    /* 2. Prepare the program's uniform resources. If the program is still being linked, leave it to the scheduler
+     *    so that the app's thread does not wait for the link to finish.
+     */
+    vkgl_assert(m_spirv_manager_ptr != nullptr);
 
-    /* 2. Spawn the command container ..
+    const bool is_program_link_pending = !m_spirv_manager_ptr->prepare_program_for_draw(state_binding_references_ptr->program_reference_ptr.get(),
+                                                                                        state_reference_ptr.get(),
+                                                                                        false); /* in_wait_for_link */
+
+    /* 3. Spawn the command container ..
      *
      * NOTE: in_indices is ALWAYS an offset in GL 3.2: See chapter 2.9.7. Array Indices in Buffer Objects
      */
@@ -529,12 +545,13 @@ void OpenGL::VKBackend::draw_elements(const OpenGL::DrawCallMode&      in_mode,
                                                                          in_mode,
                                                                          std::move(state_reference_ptr),
                                                                          std::move(state_binding_references_ptr),
-                                                                         in_type),
+                                                                         in_type,
+                                                                         is_program_link_pending),
                                          std::default_delete<OpenGL::CommandBase>() );
 
     vkgl_assert(cmd_ptr != nullptr);
 
-    /* 2. Submit the command */
+    /* 4. Submit the command */
     m_scheduler_ptr->submit(std::move(cmd_ptr) );
 }
 
@@ -570,7 +587,11 @@ void OpenGL::VKBackend::finish()
     m_scheduler_ptr->submit(std::move(cmd_ptr) );
 
     /* Block until the scheduler finishes GPU-side execution. */
-    fence_ptr->wait();
+    {
+        VKGL_TRACE_SCOPE("Finish: wait for GPU");
+
+        fence_ptr->wait();
+    }
 }
 
 void OpenGL::VKBackend::flush(VKGL::Fence* in_opt_fence_ptr)
@@ -592,7 +613,17 @@ void OpenGL::VKBackend::flush_mapped_buffer_range(const GLuint&     in_id,
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    vkgl_not_implemented();
+    /* Map backings are host-coherent, so all we need to do is remember which regions need to be copied
+     * over to the buffer at unmap time. No need to bother the scheduler thread.
+     */
+    auto buffer_reference_ptr = m_frontend_ptr->get_buffer_manager_ptr()->acquire_current_latest_snapshot_reference(in_id);
+
+    vkgl_assert(buffer_reference_ptr != nullptr);
+
+    m_buffer_manager_ptr->flush_mapped_buffer_range(in_id,
+                                                    buffer_reference_ptr->get_payload().object_creation_time,
+                                                    in_offset,
+                                                    in_length);
 }
 
 void OpenGL::VKBackend::get_buffer_sub_data(const GLuint&     in_id,
@@ -697,6 +728,15 @@ bool OpenGL::VKBackend::init()
         goto end;
     }
 
+    m_sync_object_pool_ptr = OpenGL::VKSyncObjectPool::create(this);
+
+    if (m_sync_object_pool_ptr == nullptr)
+    {
+        vkgl_assert(m_sync_object_pool_ptr != nullptr);
+
+        goto end;
+    }
+
     m_swapchain_manager_ptr = OpenGL::VKSwapchainManager::create(this,
                                                                  2, /* in_n_swapchain_images - by GL's design */
                                                                  m_wsi_context_ptr->get_pixel_format_requirements() );
@@ -1112,16 +1152,59 @@ void OpenGL::VKBackend::link_program(const GLuint& in_program_id)
     }
 }
 
-void* OpenGL::VKBackend::map_buffer(const GLuint&               in_id,
-                                    const OpenGL::BufferAccess& in_access,
-                                    const GLintptr&             in_start_offset,
-                                    const GLsizeiptr&           in_length)
+void* OpenGL::VKBackend::map_buffer(const GLuint&                in_id,
+                                    const OpenGL::BufferMapBits& in_map_bits,
+                                    const GLintptr&              in_start_offset,
+                                    const GLsizeiptr&            in_length)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    vkgl_not_implemented();
+    OpenGL::VKMapBackingSharedPtr backing_to_download_to_ptr;
+    auto                          frontend_buffer_manager_ptr = m_frontend_ptr->get_buffer_manager_ptr();
+    void*                         result_ptr                  = nullptr;
+
+    /* 1. Grab the buffer reference. */
+    auto buffer_reference_ptr = frontend_buffer_manager_ptr->acquire_current_latest_snapshot_reference(in_id);
+
+    vkgl_assert(buffer_reference_ptr != nullptr);
+
+    const auto buffer_size = frontend_buffer_manager_ptr->get_buffer_size(in_id,
+                                                                         &buffer_reference_ptr->get_payload().time_marker);
+
+    /* 2. Let the buffer manager pick the backing to hand out. In the common case (write-only maps, invalidating maps,
+     *    or maps of buffers whose contents are already shadowed by the backing) this does not involve the scheduler
+     *    thread at all.
+     */
+    result_ptr = m_buffer_manager_ptr->map_buffer(in_id,
+                                                  buffer_reference_ptr->get_payload().object_creation_time,
+                                                  buffer_size,
+                                                  in_map_bits,
+                                                  in_start_offset,
+                                                  in_length,
+                                                 &backing_to_download_to_ptr);
+
+    /* 3. Otherwise, read buffer contents back to the backing and block until that finishes. */
+    if (backing_to_download_to_ptr != nullptr)
+    {
+        OpenGL::CommandBaseUniquePtr cmd_ptr  (nullptr,
+                                               std::default_delete<OpenGL::CommandBase>() );
+        VKGL::FenceUniquePtr         fence_ptr(nullptr,
+                                               std::default_delete<VKGL::Fence>() );
+
+        fence_ptr.reset(new VKGL::Fence() );
+        vkgl_assert(fence_ptr != nullptr);
+
+        cmd_ptr.reset(new OpenGL::MapBufferCommand(std::move(buffer_reference_ptr),
+                                                   backing_to_download_to_ptr,
+                                                   fence_ptr.get() ));
+        vkgl_assert(cmd_ptr != nullptr);
 
-    return nullptr;
+        m_scheduler_ptr->submit(std::move(cmd_ptr) );
+
+        fence_ptr->wait();
+    }
+
+    return result_ptr;
 }
 
 void OpenGL::VKBackend::multi_draw_arrays(const OpenGL::DrawCallMode& in_mode,
@@ -1413,22 +1496,31 @@ void OpenGL::VKBackend::present()
     /* ALSO, make sure to flush the command stream, to ensure the frame is actually presented to the end user!
      *
      * NOTE: Since backend lives in a separate thread, we need to manually ensure app's rendering thread never gets
-     *       to issue more present requests than there are swapchain images available. Doing so prevents the backend
-     *       from getting too much behind the frontend.
+     *       to issue more present requests than the frames-in-flight limit permits. Doing so prevents the backend
+     *       from getting too much behind the frontend, which would otherwise increase input latency, as well as the
+     *       amount of memory needed to hold on to resources used by pending frames.
      */
-    VKGL::FenceUniquePtr new_fence_ptr      = VKGL::FenceUniquePtr(nullptr,
-                                                                   std::default_delete<VKGL::Fence>() );
-    VKGL::Fence*         new_fence_raw_ptr  = nullptr;
-    const auto           n_swapchain_images = m_swapchain_manager_ptr->get_n_swapchain_images();
+    VKGL::FenceUniquePtr new_fence_ptr     = VKGL::FenceUniquePtr(nullptr,
+                                                                  std::default_delete<VKGL::Fence>() );
+    VKGL::Fence*         new_fence_raw_ptr = nullptr;
 
     new_fence_ptr.reset(new VKGL::Fence() );
     vkgl_assert(new_fence_ptr != nullptr);
 
-    while (m_enqueued_present_fence_ptrs.size() >= n_swapchain_images)
+    if (m_enqueued_present_fence_ptrs.size() >= VKGL_MAX_FRAMES_IN_FLIGHT)
     {
-        (*m_enqueued_present_fence_ptrs.begin() )->wait();
+        const auto wait_start_time = std::chrono::steady_clock::now();
+
+        VKGL_TRACE_SCOPE("Present: wait for frame in flight");
 
-        m_enqueued_present_fence_ptrs.erase(m_enqueued_present_fence_ptrs.begin() );
+        while (m_enqueued_present_fence_ptrs.size() >= VKGL_MAX_FRAMES_IN_FLIGHT)
+        {
+            (*m_enqueued_present_fence_ptrs.begin() )->wait();
+
+            m_enqueued_present_fence_ptrs.erase(m_enqueued_present_fence_ptrs.begin() );
+        }
+
+        m_frame_graph_ptr->on_present_cpu_wait(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - wait_start_time) );
     }
 
     new_fence_raw_ptr = new_fence_ptr.get();
@@ -1842,9 +1934,37 @@ bool OpenGL::VKBackend::unmap_buffer(const GLuint& in_id)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    vkgl_not_implemented();
+    OpenGL::VKMapBackingSharedPtr  backing_ptr;
+    std::vector<Anvil::BufferCopy> copy_regions;
+    bool                           result               = false;
+    auto                           buffer_reference_ptr = m_frontend_ptr->get_buffer_manager_ptr()->acquire_current_latest_snapshot_reference(in_id);
 
-    return false;
+    vkgl_assert(buffer_reference_ptr != nullptr);
+
+    if (!m_buffer_manager_ptr->unmap_buffer(in_id,
+                                            buffer_reference_ptr->get_payload().object_creation_time,
+                                           &backing_ptr,
+                                           &copy_regions) )
+    {
+        goto end;
+    }
+
+    /* Read-only maps, as well as FLUSH_EXPLICIT maps with no flushed ranges, do not need any GPU work. */
+    if (copy_regions.size() > 0)
+    {
+        OpenGL::CommandBaseUniquePtr cmd_ptr(new OpenGL::UnmapBufferCommand(std::move(buffer_reference_ptr),
+                                                                            backing_ptr,
+                                                                            std::move(copy_regions) ),
+                                             std::default_delete<OpenGL::CommandBase>() );
+
+        vkgl_assert(cmd_ptr != nullptr);
+
+        m_scheduler_ptr->submit(std::move(cmd_ptr) );
+    }
+
+    result = true;
+end:
+    return result;
 }
 
 void OpenGL::VKBackend::validate_program(const GLuint& in_program_id)
@@ -1854,69 +1974,3 @@ void OpenGL::VKBackend::validate_program(const GLuint& in_program_id)
     vkgl_not_implemented();
 }
 
-bool OpenGL::VKBackend::update_texture_reference_for_uniform_resources(const OpenGL::SPIRVBlobID& in_spirv_id)
-{
-    FUN_ENTRY(DEBUG_DEPTH);
-    
-    bool result = false;
-    
-    auto uniform_resources_ptr = m_spirv_manager_ptr->get_uniform_resources(in_spirv_id);
-    if (uniform_resources_ptr->size() > 0)
-    {
-        auto state_manager_ptr   = m_frontend_ptr->get_state_manager_ptr();
-        auto state_reference_ptr = state_manager_ptr->acquire_current_latest_snapshot_reference();
-        vkgl_assert(state_reference_ptr != nullptr);
-        
-        auto frontend_context_state_ptr = state_manager_ptr->get_state(state_reference_ptr->get_payload().time_marker);
-        vkgl_assert(frontend_context_state_ptr != nullptr);
-        
-    	for (uint32_t n_uniform_resource = 0;
-    				n_uniform_resource < uniform_resources_ptr->size();
-    				++n_uniform_resource)
-    	{
-    		auto& current_uniform_resource = uniform_resources_ptr->at(n_uniform_resource);
-    		
-    		auto& is_sampler 	= current_uniform_resource.is_sampler;
-    		auto& n_binding 	= current_uniform_resource.binding;
-    		
-    		if (n_binding == UINT_MAX)
-    		{
-        		continue;
-    		}
-    		
-    		if (is_sampler)
-    		{
-    			for (int i = 0;
-    					i < current_uniform_resource.samplers.size();
-    					i++)
-    			{
-    				auto& current_sampler = current_uniform_resource.samplers.at(i);
-    				
-        			auto texture_unit = 	current_sampler.texture_unit;
-        			//auto image_view_ptr 	= current_sampler.image_view_ptr;
-        			//auto sampler_ptr 		= current_sampler.sampler_ptr;
-        			
-        			auto texture_unit_state_ptr = frontend_context_state_ptr->texture_unit_to_state_ptr_map.at(texture_unit).get();
-        			vkgl_assert(texture_unit_state_ptr != nullptr);
-        			
-        			auto texture_id = texture_unit_state_ptr->binding_2d;
-        			vkgl_assert(texture_id != 0);
-        			
-        			auto& gl_texture_reference_ptr = current_sampler.gl_texture_reference_ptr;
-        			gl_texture_reference_ptr.reset();
-        			
-        			gl_texture_reference_ptr = m_frontend_ptr->get_texture_manager_ptr()->acquire_current_latest_snapshot_reference(texture_id);
-        			vkgl_assert(current_sampler.gl_texture_reference_ptr != nullptr);
-    			}
-    		}
-    		else
-    		{
-    			continue;
-    		}
-    	}
-    }
-    
-    result = true;
-    return result;
-}
-
@@ -9,11 +9,48 @@
 #include "OpenGL/frontend/gl_buffer_manager.h"
 #include "Anvil/include/misc/buffer_create_info.h"
 #include "Anvil/include/wrappers/buffer.h"
+#include "Anvil/include/misc/memory_block_create_info.h"
+#include "Anvil/include/wrappers/memory_block.h"
+#include <algorithm>
+
+/* Max number of buffers kept around for reuse, per size class. */
+#define N_MAX_POOLED_BUFFERS_PER_BUCKET (8)
+
+/* Buffers smaller than this all share the same size class. */
+#define MIN_BUFFER_SIZE_CLASS (256)
+
+/* GL buffers up to this size are sub-allocated out of slabs, instead of being given a VK buffer of their own. */
+#define N_MAX_SUBALLOCATED_BUFFER_SIZE (64 * 1024)
+
+/* Size of a single slab. */
+#define SLAB_SIZE (4 * 1024 * 1024)
+
+/* Alignment of regions carved out of slabs. Spec guarantees min{Uniform,Storage}BufferOffsetAlignment never exceeds this
+ * value, so any region can be bound as a UBO/SSBO as is.
+ */
+#define SLAB_REGION_ALIGNMENT (256)
+
+OpenGL::VKMapBacking::~VKMapBacking()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    if (buffer_ptr != nullptr)
+    {
+        /* Backings are kept mapped for their whole lifetime. The mapping must be released before the mem block goes away. */
+        buffer_ptr->get_memory_block(0)->unmap();
+    }
+}
 
 OpenGL::VKBufferManager::VKBufferManager(const OpenGL::IContextObjectManagers* in_frontend_ptr,
                                          IBackend*                             in_backend_ptr)
-    :m_backend_ptr (in_backend_ptr),
-     m_frontend_ptr(in_frontend_ptr)
+    :m_backend_ptr              (in_backend_ptr),
+     m_frontend_ptr             (in_frontend_ptr),
+     m_n_buffers_created        (0),
+     m_n_buffers_recycled       (0),
+     m_n_memory_blocks_allocated(0),
+     m_n_pooled_buffers         (0),
+     m_n_slab_suballocations    (0),
+     m_n_slabs                  (0)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -25,7 +62,96 @@ OpenGL::VKBufferManager::~VKBufferManager()
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    /*  Stub */
+    /* NOTE: Releasing buffer data returns map backings to the pool, so the pool must be released last. */
+    m_buffers.clear();
+
+    m_buffer_pool.clear     ();
+    m_slabs.clear           ();
+    m_map_backing_pool.clear();
+}
+
+OpenGL::VKMapBackingSharedPtr OpenGL::VKBufferManager::acquire_map_backing(const VkDeviceSize& in_size)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    OpenGL::VKMapBackingUniquePtr backing_ptr;
+
+    /* 1. Try to reuse the smallest pooled backing which is large enough to hold the requested number of bytes. */
+    {
+        std::lock_guard<std::mutex> pool_lock    (m_map_backing_pool_mutex);
+        auto                        best_iterator(m_map_backing_pool.end() );
+
+        for (auto current_iterator  = m_map_backing_pool.begin();
+                  current_iterator != m_map_backing_pool.end();
+                ++current_iterator)
+        {
+            if ((*current_iterator)->size >= in_size)
+            {
+                if (best_iterator          == m_map_backing_pool.end() ||
+                    (*best_iterator)->size >  (*current_iterator)->size)
+                {
+                    best_iterator = current_iterator;
+                }
+            }
+        }
+
+        if (best_iterator != m_map_backing_pool.end() )
+        {
+            backing_ptr = std::move(*best_iterator);
+
+            m_map_backing_pool.erase(best_iterator);
+        }
+    }
+
+    /* 2. If that did not work out, spawn a new one. */
+    if (backing_ptr == nullptr)
+    {
+        Anvil::BufferUniquePtr buffer_ptr;
+        void*                  mapped_ptr = nullptr;
+
+        auto create_info_ptr = Anvil::BufferCreateInfo::create_alloc(m_backend_ptr->get_device_ptr(),
+                                                                     in_size,
+                                                                     Anvil::QueueFamilyFlagBits::COMPUTE_BIT | Anvil::QueueFamilyFlagBits::DMA_BIT | Anvil::QueueFamilyFlagBits::GRAPHICS_BIT,
+                                                                     Anvil::SharingMode::EXCLUSIVE,
+                                                                     Anvil::BufferCreateFlagBits::NONE,
+                                                                     Anvil::BufferUsageFlagBits::TRANSFER_SRC_BIT | Anvil::BufferUsageFlagBits::TRANSFER_DST_BIT,
+                                                                     Anvil::MemoryFeatureFlagBits::HOST_COHERENT_BIT | Anvil::MemoryFeatureFlagBits::MAPPABLE_BIT);
+        vkgl_assert(create_info_ptr != nullptr);
+
+        buffer_ptr = Anvil::Buffer::create(std::move(create_info_ptr) );
+        vkgl_assert(buffer_ptr != nullptr);
+
+        ++m_n_buffers_created;
+        ++m_n_memory_blocks_allocated;
+
+        #if defined(_DEBUG)
+        {
+            buffer_ptr->set_name("Map backing");
+        }
+        #endif
+
+        if (!buffer_ptr->get_memory_block(0)->map(0, /* in_start_offset */
+                                                  in_size,
+                                                 &mapped_ptr) )
+        {
+            vkgl_assert_fail();
+        }
+
+        backing_ptr.reset(
+            new OpenGL::VKMapBacking(std::move(buffer_ptr),
+                                     mapped_ptr,
+                                     in_size)
+        );
+        vkgl_assert(backing_ptr != nullptr);
+    }
+
+    /* Backings are handed out as shared pointers, so that nodes which copy data from/to them can keep them alive until
+     * GPU-side execution finishes. Once the last holder lets go, the backing is returned to the pool.
+     */
+    return OpenGL::VKMapBackingSharedPtr(backing_ptr.release(),
+                                         std::bind(&OpenGL::VKBufferManager::release_map_backing,
+                                                   this,
+                                                   std::placeholders::_1) );
 }
 
 OpenGL::VKBufferReferenceUniquePtr OpenGL::VKBufferManager::acquire_object(const GLuint&      in_id,
@@ -40,7 +166,7 @@ OpenGL::VKBufferReferenceUniquePtr OpenGL::VKBufferManager::acquire_object(const
     auto                               buffer_props_iterator(m_buffers.find(buffer_map_key) );
     OpenGL::VKBufferReferenceUniquePtr new_reference_ptr    (nullptr,
                                                              [](OpenGL::VKBufferReference* in_ref_ptr){ delete in_ref_ptr; });
-    Anvil::Buffer*                     ref_buffer_ptr       (nullptr);
+    const BufferProps*                 ref_buffer_props_ptr (nullptr);
 
     vkgl_assert(buffer_props_iterator != m_buffers.end() );
     vkgl_assert(in_buffer_time_marker != OpenGL::LATEST_SNAPSHOT_AVAILABLE); /* This special value is only allowed for frontend managers ! */
@@ -52,8 +178,8 @@ OpenGL::VKBufferReferenceUniquePtr OpenGL::VKBufferManager::acquire_object(const
 
         if (buffer_iterator != buffer_data_ptr->buffer_map.end() )
         {
-            ref_buffer_ptr = buffer_iterator->second->buffer_ptr.get();
-            vkgl_assert(ref_buffer_ptr != nullptr);
+            ref_buffer_props_ptr = buffer_iterator->second.get();
+            vkgl_assert(ref_buffer_props_ptr->get_buffer_ptr() != nullptr);
         }
         else
         {
@@ -65,16 +191,13 @@ OpenGL::VKBufferReferenceUniquePtr OpenGL::VKBufferManager::acquire_object(const
                                                              &frontend_buffer_state_ptr);
             vkgl_assert(frontend_buffer_state_ptr != nullptr);
 
-            auto new_buffer_ptr = create_vk_buffer(in_id,
-                                                   frontend_buffer_state_ptr);
-            vkgl_assert(new_buffer_ptr != nullptr);
+            auto new_buffer_props_ptr = create_buffer_props(in_id,
+                                                            frontend_buffer_state_ptr);
+            vkgl_assert(new_buffer_props_ptr != nullptr);
 
-            ref_buffer_ptr = new_buffer_ptr.get();
+            ref_buffer_props_ptr = new_buffer_props_ptr.get();
 
-            buffer_data_ptr->buffer_map[in_buffer_time_marker].reset(
-                new BufferProps(std::move(new_buffer_ptr) )
-            );
-            vkgl_assert(buffer_data_ptr->buffer_map[in_buffer_time_marker] != nullptr);
+            buffer_data_ptr->buffer_map[in_buffer_time_marker] = std::move(new_buffer_props_ptr);
 
             buffer_data_ptr->tot_buffer_time_marker = in_buffer_time_marker;
         }
@@ -83,7 +206,9 @@ OpenGL::VKBufferReferenceUniquePtr OpenGL::VKBufferManager::acquire_object(const
     new_reference_ptr.reset(
         new OpenGL::VKBufferReference(OpenGL::VKBufferPayload(in_id,
                                                               in_frontend_object_creation_time,
-                                                              ref_buffer_ptr,
+                                                              ref_buffer_props_ptr->get_buffer_ptr(),
+                                                              ref_buffer_props_ptr->offset,
+                                                              ref_buffer_props_ptr->size,
                                                               in_buffer_time_marker),
                                       std::bind(&OpenGL::VKBufferManager::on_reference_created,
                                                 this,
@@ -183,22 +308,90 @@ end:
     return result;
 }
 
+OpenGL::VKBufferManager::BufferPropsUniquePtr OpenGL::VKBufferManager::create_buffer_props(const GLuint&              in_id,
+                                                                                          const OpenGL::BufferState* in_frontend_buffer_state_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes m_mutex is locked! */
+    BufferPropsUniquePtr result_ptr;
+
+    if (in_frontend_buffer_state_ptr->size <= N_MAX_SUBALLOCATED_BUFFER_SIZE)
+    {
+        const uint32_t                n_buffer_targets_used = static_cast<uint32_t>(in_frontend_buffer_state_ptr->buffer_targets_used.size() );
+        const Anvil::BufferUsageFlags usage_flags           = OpenGL::VKUtils::get_buffer_usage_flags_for_gl_buffer(n_buffer_targets_used,
+                                                                                                                    (n_buffer_targets_used > 0) ? &in_frontend_buffer_state_ptr->buffer_targets_used.at(0) : nullptr);
+        const auto                    memory_features       = OpenGL::VKUtils::get_memory_feature_flags_for_gl_buffer(in_frontend_buffer_state_ptr->usage);
+
+        result_ptr = suballocate_from_slab(SlabKey(usage_flags,
+                                                   memory_features),
+                                           in_frontend_buffer_state_ptr->size);
+    }
+    else
+    {
+        auto buffer_ptr = create_vk_buffer(in_id,
+                                           in_frontend_buffer_state_ptr);
+
+        if (buffer_ptr != nullptr)
+        {
+            const auto buffer_size = buffer_ptr->get_create_info_ptr()->get_size();
+
+            result_ptr.reset(
+                new BufferProps(std::move(buffer_ptr),
+                                buffer_size)
+            );
+        }
+    }
+
+    vkgl_assert(result_ptr != nullptr);
+    return result_ptr;
+}
+
 Anvil::BufferUniquePtr OpenGL::VKBufferManager::create_vk_buffer(const GLuint&              in_id,
-                                                                 const OpenGL::BufferState* in_frontend_buffer_state_ptr) const
+                                                                 const OpenGL::BufferState* in_frontend_buffer_state_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
+    /* NOTE: This function assumes m_mutex is locked! */
     Anvil::BufferCreateInfoUniquePtr create_info_ptr;
     auto                             device_ptr            = m_backend_ptr->get_device_ptr();
+    const auto                       memory_features       = OpenGL::VKUtils::get_memory_feature_flags_for_gl_buffer(in_frontend_buffer_state_ptr->usage);
     const uint32_t                   n_buffer_targets_used = static_cast<uint32_t>(in_frontend_buffer_state_ptr->buffer_targets_used.size() );
     Anvil::BufferUniquePtr           result_ptr;
+    const VkDeviceSize               size_class            = get_buffer_size_class(in_frontend_buffer_state_ptr->size);
     const Anvil::BufferUsageFlags    usage_flags           = OpenGL::VKUtils::get_buffer_usage_flags_for_gl_buffer(n_buffer_targets_used,
                                                                                                              (n_buffer_targets_used > 0) ? &in_frontend_buffer_state_ptr->buffer_targets_used.at(0) : nullptr);
 
     vkgl_assert(in_frontend_buffer_state_ptr->buffer_targets_used.size() > 0);
 
+    /* 1. Orphaned buffers of the same size class, usage & memory type can be reused as is, along with the memory
+     *    that's already bound to them. This makes the "orphan & refill" pattern allocation-free in steady state.
+     */
+    {
+        auto pool_iterator = m_buffer_pool.find(BufferPoolKey(size_class,
+                                                              usage_flags,
+                                                              memory_features) );
+
+        if (pool_iterator                 != m_buffer_pool.end() &&
+            pool_iterator->second.size()  >  0)
+        {
+            result_ptr = std::move(pool_iterator->second.back() );
+
+            pool_iterator->second.pop_back();
+
+            --m_n_pooled_buffers;
+            ++m_n_buffers_recycled;
+
+            goto end;
+        }
+    }
+
+    /* 2. Nothing to recycle - spawn a new buffer. Memory is going to be bound by the node which first fills it.
+     *
+     *    NOTE: Buffer is sized to fit the whole size class, so that it can be recycled for any request of that class.
+     */
     create_info_ptr = Anvil::BufferCreateInfo::create_no_alloc(device_ptr,
-                                                               in_frontend_buffer_state_ptr->size,
+                                                               size_class,
                                                                Anvil::QueueFamilyFlagBits::COMPUTE_BIT | Anvil::QueueFamilyFlagBits::DMA_BIT | Anvil::QueueFamilyFlagBits::GRAPHICS_BIT,
                                                                Anvil::SharingMode::EXCLUSIVE,
                                                                Anvil::BufferCreateFlagBits::NONE,
@@ -208,6 +401,9 @@ Anvil::BufferUniquePtr OpenGL::VKBufferManager::create_vk_buffer(const GLuint&
     result_ptr = Anvil::Buffer::create(std::move(create_info_ptr) );
     vkgl_assert(result_ptr != nullptr);
 
+    ++m_n_buffers_created;
+
+end:
     #if defined(_DEBUG)
     {
         result_ptr->set_name_formatted("GL buffer %d",
@@ -241,6 +437,8 @@ bool OpenGL::VKBufferManager::destroy_object(const GLuint&             in_id,
         /* Check if no further references for the instance exist. If none do, go ahead and free the descriptor. */
         if (get_n_references(buffer_data_ptr) == 0)
         {
+            recycle_buffer_data(buffer_data_ptr);
+
             m_buffers.erase(buffer_iterator);
 
             /* NOTE: buffer_data_ptr at this point is dead. */
@@ -256,6 +454,151 @@ bool OpenGL::VKBufferManager::destroy_object(const GLuint&             in_id,
     return result;
 }
 
+void OpenGL::VKBufferManager::flush_mapped_buffer_range(const GLuint&             in_id,
+                                                        const OpenGL::TimeMarker& in_frontend_object_creation_time,
+                                                        const VkDeviceSize&       in_offset,
+                                                        const VkDeviceSize&       in_length)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::lock_guard<std::mutex> lock           (m_mutex);
+    const auto                  buffer_map_key (BufferMapKey(in_id, in_frontend_object_creation_time) );
+    auto                        buffer_iterator(m_buffers.find(buffer_map_key) );
+    BufferData*                 buffer_data_ptr(nullptr);
+    Anvil::BufferCopy           region;
+
+    vkgl_assert(buffer_iterator != m_buffers.end() );
+
+    buffer_data_ptr = buffer_iterator->second.get();
+
+    vkgl_assert(buffer_data_ptr->mapped);
+    vkgl_assert((buffer_data_ptr->map_bits & OpenGL::BUFFER_MAP_BIT_FLUSH_EXPLICIT) != 0);
+    vkgl_assert(in_offset + in_length <= buffer_data_ptr->map_length);
+
+    /* Nothing is copied at this point. Flushed regions are accumulated and turned into a minimal set of copy ops
+     * at unmap time.
+     *
+     * NOTE: Offsets passed by the app are relative to the start of the mapped range.
+     */
+    region.dst_offset = buffer_data_ptr->map_start_offset + in_offset;
+    region.size       = in_length;
+    region.src_offset = region.dst_offset;
+
+    if (region.size > 0)
+    {
+        buffer_data_ptr->map_flushed_regions.push_back(region);
+    }
+}
+
+void OpenGL::VKBufferManager::free_slab_region(Slab*               in_slab_ptr,
+                                               const VkDeviceSize& in_offset,
+                                               const VkDeviceSize& in_size)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes m_mutex is locked! in_slab_ptr may be released by the time the function leaves. */
+    auto& free_ranges   = in_slab_ptr->free_ranges;
+    auto  next_iterator = free_ranges.upper_bound(in_offset);
+    auto  new_offset    = in_offset;
+    auto  new_size      = in_size;
+
+    vkgl_assert(in_slab_ptr->n_allocations > 0);
+
+    /* Merge with the preceding free range, if the two touch .. */
+    if (next_iterator != free_ranges.begin() )
+    {
+        auto prev_iterator = std::prev(next_iterator);
+
+        vkgl_assert(prev_iterator->first + prev_iterator->second <= in_offset);
+
+        if (prev_iterator->first + prev_iterator->second == in_offset)
+        {
+            new_offset  = prev_iterator->first;
+            new_size   += prev_iterator->second;
+
+            free_ranges.erase(prev_iterator);
+        }
+    }
+
+    /* .. and with the following one. */
+    if (next_iterator != free_ranges.end() )
+    {
+        vkgl_assert(in_offset + in_size <= next_iterator->first);
+
+        if (in_offset + in_size == next_iterator->first)
+        {
+            new_size += next_iterator->second;
+
+            free_ranges.erase(next_iterator);
+        }
+    }
+
+    free_ranges[new_offset] = new_size;
+
+    --in_slab_ptr->n_allocations;
+
+    /* Release the slab once it becomes empty, unless it is the only one of its usage class with space left. This keeps
+     * at most one empty slab per usage class around, so that apps which keep creating & deleting small buffers do not
+     * make us re-create the same slab over and over.
+     */
+    if (in_slab_ptr->n_allocations == 0)
+    {
+        auto&      slabs                    = m_slabs.at(in_slab_ptr->key);
+        const bool has_free_space_elsewhere = std::any_of(slabs.begin(),
+                                                          slabs.end  (),
+                                                          [in_slab_ptr](const SlabUniquePtr& in_current_slab_ptr)
+                                                          {
+                                                              return in_current_slab_ptr.get()               != in_slab_ptr &&
+                                                                     in_current_slab_ptr->free_ranges.size() >  0;
+                                                          });
+
+        if (has_free_space_elsewhere)
+        {
+            auto slab_iterator = std::find_if(slabs.begin(),
+                                              slabs.end  (),
+                                              [in_slab_ptr](const SlabUniquePtr& in_current_slab_ptr)
+                                              {
+                                                  return in_current_slab_ptr.get() == in_slab_ptr;
+                                              });
+
+            vkgl_assert(slab_iterator != slabs.end() );
+
+            slabs.erase(slab_iterator);
+
+            --m_n_slabs;
+        }
+    }
+}
+
+VkDeviceSize OpenGL::VKBufferManager::get_buffer_size_class(const VkDeviceSize& in_size)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* Size classes are spaced at quarter-power-of-two steps: 256, 320, 384, 448, 512, 640, ..
+     *
+     * This caps the amount of memory wasted per buffer at 25%, while keeping the number of buckets low.
+     */
+    VkDeviceSize result = MIN_BUFFER_SIZE_CLASS;
+
+    if (in_size > MIN_BUFFER_SIZE_CLASS)
+    {
+        VkDeviceSize msb = MIN_BUFFER_SIZE_CLASS;
+
+        while ((msb << 1) <= in_size)
+        {
+            msb <<= 1;
+        }
+
+        {
+            const VkDeviceSize step = msb / 4;
+
+            result = ((in_size + step - 1) / step) * step;
+        }
+    }
+
+    return result;
+}
+
 uint32_t OpenGL::VKBufferManager::get_n_references(const BufferData* in_buffer_data_ptr) const
 {
     FUN_ENTRY(DEBUG_DEPTH);
@@ -285,6 +628,148 @@ OpenGL::TimeMarker OpenGL::VKBufferManager::get_tot_buffer_time_marker(const GLu
     return buffer_props_iterator->second->tot_buffer_time_marker;
 }
 
+void OpenGL::VKBufferManager::invalidate_map_backing(const GLuint&             in_id,
+                                                     const OpenGL::TimeMarker& in_frontend_object_creation_time)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::lock_guard<std::mutex> lock           (m_mutex);
+    const auto                  buffer_map_key (BufferMapKey(in_id, in_frontend_object_creation_time) );
+    auto                        buffer_iterator(m_buffers.find(buffer_map_key) );
+
+    vkgl_assert(buffer_iterator != m_buffers.end() );
+
+    if (buffer_iterator != m_buffers.end() )
+    {
+        auto buffer_data_ptr = buffer_iterator->second.get();
+
+        /* Buffer contents are about to be modified GPU-side, so whatever the backing holds is now stale.
+         *
+         * NOTE: Respecifying buffer storage implicitly unmaps the buffer.
+         */
+        buffer_data_ptr->map_backing_contents_valid = false;
+        buffer_data_ptr->mapped                     = false;
+
+        buffer_data_ptr->map_flushed_regions.clear();
+    }
+}
+
+void* OpenGL::VKBufferManager::map_buffer(const GLuint&                  in_id,
+                                          const OpenGL::TimeMarker&      in_frontend_object_creation_time,
+                                          const VkDeviceSize&            in_buffer_size,
+                                          const OpenGL::BufferMapBits&   in_map_bits,
+                                          const VkDeviceSize&            in_start_offset,
+                                          const VkDeviceSize&            in_length,
+                                          OpenGL::VKMapBackingSharedPtr* out_backing_to_download_to_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::lock_guard<std::mutex> lock                   (m_mutex);
+    const auto                  buffer_map_key         (BufferMapKey(in_id, in_frontend_object_creation_time) );
+    auto                        buffer_iterator        (m_buffers.find(buffer_map_key) );
+    BufferData*                 buffer_data_ptr        (nullptr);
+    const bool                  invalidates_all_content( (in_map_bits & OpenGL::BUFFER_MAP_BIT_INVALIDATE_BUFFER) != 0                                                   ||
+                                                        ((in_map_bits & OpenGL::BUFFER_MAP_BIT_INVALIDATE_RANGE)  != 0 && in_start_offset == 0 && in_length == in_buffer_size) );
+    void*                       result_ptr             (nullptr);
+
+    vkgl_assert(buffer_iterator                     != m_buffers.end() );
+    vkgl_assert(in_start_offset + in_length         <= in_buffer_size);
+    vkgl_assert(out_backing_to_download_to_ptr      != nullptr);
+
+    buffer_data_ptr = buffer_iterator->second.get();
+
+    vkgl_assert(!buffer_data_ptr->mapped);
+
+    *out_backing_to_download_to_ptr = nullptr;
+
+    /* 1. Drop the backing if it can no longer hold buffer contents (ie. storage has been respecified in the meantime). */
+    if (buffer_data_ptr->map_backing_ptr       != nullptr &&
+        buffer_data_ptr->map_backing_ptr->size <  in_buffer_size)
+    {
+        buffer_data_ptr->map_backing_ptr.reset();
+    }
+
+    /* 2. Make sure we have a backing the app can safely write to. */
+    if (buffer_data_ptr->map_backing_ptr == nullptr)
+    {
+        buffer_data_ptr->map_backing_contents_valid = false;
+        buffer_data_ptr->map_backing_ptr            = acquire_map_backing(in_buffer_size);
+    }
+    else
+    if ((in_map_bits & OpenGL::BUFFER_MAP_BIT_UNSYNCHRONIZED) == 0 &&
+         buffer_data_ptr->map_backing_ptr.use_count()         >  1)
+    {
+        /* The backing is still referenced by a node which has either not been executed yet, or is still executing GPU-side.
+         * Rather than wait for it to retire, rename: give the app a fresh backing and carry over whatever the app expects
+         * to see in the non-invalidated part of the buffer.
+         */
+        auto old_backing_ptr = std::move(buffer_data_ptr->map_backing_ptr);
+
+        buffer_data_ptr->map_backing_ptr = acquire_map_backing(in_buffer_size);
+
+        if ( buffer_data_ptr->map_backing_contents_valid &&
+            !invalidates_all_content)
+        {
+            auto dst_ptr = reinterpret_cast<uint8_t*>      (buffer_data_ptr->map_backing_ptr->mapped_ptr);
+            auto src_ptr = reinterpret_cast<const uint8_t*>(old_backing_ptr->mapped_ptr);
+
+            if ((in_map_bits & OpenGL::BUFFER_MAP_BIT_INVALIDATE_RANGE) != 0)
+            {
+                memcpy(dst_ptr,
+                       src_ptr,
+                       static_cast<size_t>(in_start_offset) );
+                memcpy(dst_ptr + in_start_offset + in_length,
+                       src_ptr + in_start_offset + in_length,
+                       static_cast<size_t>(in_buffer_size - in_start_offset - in_length) );
+            }
+            else
+            {
+                memcpy(dst_ptr,
+                       src_ptr,
+                       static_cast<size_t>(in_buffer_size) );
+            }
+        }
+    }
+    else
+    {
+        /* UNSYNCHRONIZED or idle backing - hand out the existing one. It is the app's responsibility to avoid
+         * stomping on regions which are still in use.
+         */
+    }
+
+    /* 3. If the app cares about existing contents and the backing does not hold them, they need to be read back. */
+    if (invalidates_all_content)
+    {
+        buffer_data_ptr->map_backing_contents_valid = true;
+    }
+    else
+    if (!buffer_data_ptr->map_backing_contents_valid)
+    {
+        *out_backing_to_download_to_ptr = buffer_data_ptr->map_backing_ptr;
+
+        /* NOTE: Caller is going to block until the readback finishes, so it's safe to mark the contents as valid. */
+        buffer_data_ptr->map_backing_contents_valid = true;
+    }
+
+    buffer_data_ptr->map_bits         = in_map_bits;
+    buffer_data_ptr->map_length       = in_length;
+    buffer_data_ptr->map_start_offset = in_start_offset;
+    buffer_data_ptr->mapped           = true;
+
+    buffer_data_ptr->map_flushed_regions.clear();
+
+    result_ptr = reinterpret_cast<uint8_t*>(buffer_data_ptr->map_backing_ptr->mapped_ptr) + in_start_offset;
+
+    return result_ptr;
+}
+
+void OpenGL::VKBufferManager::on_memory_block_allocated()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    ++m_n_memory_blocks_allocated;
+}
+
 void OpenGL::VKBufferManager::on_reference_created(BufferData*                in_buffer_data_ptr,
                                                    OpenGL::VKBufferReference* in_reference_ptr)
 {
@@ -299,6 +784,263 @@ void OpenGL::VKBufferManager::on_reference_created(BufferData*                in
     }
 }
 
+OpenGL::VKBufferAllocationStats OpenGL::VKBufferManager::pop_frame_stats()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    OpenGL::VKBufferAllocationStats result;
+
+    result.n_buffers_created         = m_n_buffers_created.exchange        (0);
+    result.n_buffers_recycled        = m_n_buffers_recycled.exchange       (0);
+    result.n_memory_blocks_allocated = m_n_memory_blocks_allocated.exchange(0);
+    result.n_slab_suballocations     = m_n_slab_suballocations.exchange    (0);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        result.n_pooled_buffers = m_n_pooled_buffers;
+        result.n_slabs          = m_n_slabs;
+    }
+
+    return result;
+}
+
+void OpenGL::VKBufferManager::recycle_buffer(Anvil::BufferUniquePtr in_buffer_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes m_mutex is locked! */
+    const auto create_info_ptr = in_buffer_ptr->get_create_info_ptr();
+    auto       mem_block_ptr   = in_buffer_ptr->get_memory_block(0);
+
+    /* Buffers which never had memory bound are not worth keeping around. Same goes for buckets which are already full.
+     * In both cases, the buffer is released when the function leaves.
+     */
+    if (mem_block_ptr != nullptr)
+    {
+        auto& bucket = m_buffer_pool[BufferPoolKey(create_info_ptr->get_size(),
+                                                   create_info_ptr->get_usage_flags(),
+                                                   mem_block_ptr->get_create_info_ptr()->get_memory_features() )];
+
+        if (bucket.size() < N_MAX_POOLED_BUFFERS_PER_BUCKET)
+        {
+            bucket.push_back(std::move(in_buffer_ptr) );
+
+            ++m_n_pooled_buffers;
+        }
+    }
+}
+
+void OpenGL::VKBufferManager::recycle_buffer_data(BufferData* in_buffer_data_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes m_mutex is locked! */
+    for (auto& current_buffer_props : in_buffer_data_ptr->buffer_map)
+    {
+        recycle_buffer_props(current_buffer_props.second.get() );
+    }
+}
+
+void OpenGL::VKBufferManager::recycle_buffer_props(BufferProps* in_buffer_props_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes m_mutex is locked! */
+    if (in_buffer_props_ptr->slab_ptr != nullptr)
+    {
+        free_slab_region(in_buffer_props_ptr->slab_ptr,
+                         in_buffer_props_ptr->offset,
+                         in_buffer_props_ptr->size);
+
+        in_buffer_props_ptr->slab_ptr = nullptr;
+    }
+    else
+    if (in_buffer_props_ptr->buffer_ptr != nullptr)
+    {
+        recycle_buffer(std::move(in_buffer_props_ptr->buffer_ptr) );
+    }
+}
+
+void OpenGL::VKBufferManager::release_map_backing(OpenGL::VKMapBacking* in_map_backing_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::lock_guard<std::mutex> pool_lock(m_map_backing_pool_mutex);
+
+    m_map_backing_pool.push_back(
+        OpenGL::VKMapBackingUniquePtr(in_map_backing_ptr)
+    );
+}
+
+OpenGL::VKBufferManager::BufferPropsUniquePtr OpenGL::VKBufferManager::suballocate_from_slab(const SlabKey&      in_slab_key,
+                                                                                            const VkDeviceSize& in_size)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes m_mutex is locked! */
+    const VkDeviceSize   aligned_size = ((std::max(in_size, static_cast<VkDeviceSize>(1) ) + SLAB_REGION_ALIGNMENT - 1) / SLAB_REGION_ALIGNMENT) * SLAB_REGION_ALIGNMENT;
+    BufferPropsUniquePtr result_ptr;
+    auto&                slabs        = m_slabs[in_slab_key];
+
+    vkgl_assert(aligned_size <= SLAB_SIZE);
+
+    /* 1. First-fit search over existing slabs of the usage class. */
+    for (auto& current_slab_ptr : slabs)
+    {
+        for (auto free_range_iterator  = current_slab_ptr->free_ranges.begin();
+                  free_range_iterator != current_slab_ptr->free_ranges.end();
+                ++free_range_iterator)
+        {
+            if (free_range_iterator->second >= aligned_size)
+            {
+                const VkDeviceSize region_offset = free_range_iterator->first;
+                const VkDeviceSize n_bytes_left  = free_range_iterator->second - aligned_size;
+
+                current_slab_ptr->free_ranges.erase(free_range_iterator);
+
+                if (n_bytes_left > 0)
+                {
+                    current_slab_ptr->free_ranges[region_offset + aligned_size] = n_bytes_left;
+                }
+
+                ++current_slab_ptr->n_allocations;
+                ++m_n_slab_suballocations;
+
+                result_ptr.reset(
+                    new BufferProps(current_slab_ptr.get(),
+                                    region_offset,
+                                    aligned_size)
+                );
+
+                goto end;
+            }
+        }
+    }
+
+    /* 2. No space left - spawn a new slab. Its memory is allocated upfront, since it is going to be shared by many GL buffers. */
+    {
+        Anvil::BufferUniquePtr slab_buffer_ptr;
+        SlabUniquePtr          slab_ptr;
+
+        auto create_info_ptr = Anvil::BufferCreateInfo::create_alloc(m_backend_ptr->get_device_ptr(),
+                                                                     SLAB_SIZE,
+                                                                     Anvil::QueueFamilyFlagBits::COMPUTE_BIT | Anvil::QueueFamilyFlagBits::DMA_BIT | Anvil::QueueFamilyFlagBits::GRAPHICS_BIT,
+                                                                     Anvil::SharingMode::EXCLUSIVE,
+                                                                     Anvil::BufferCreateFlagBits::NONE,
+                                                                     in_slab_key.first,
+                                                                     in_slab_key.second);
+        vkgl_assert(create_info_ptr != nullptr);
+
+        slab_buffer_ptr = Anvil::Buffer::create(std::move(create_info_ptr) );
+        vkgl_assert(slab_buffer_ptr != nullptr);
+
+        ++m_n_buffers_created;
+        ++m_n_memory_blocks_allocated;
+        ++m_n_slabs;
+
+        #if defined(_DEBUG)
+        {
+            slab_buffer_ptr->set_name_formatted("Buffer slab %u",
+                                                m_n_slabs);
+        }
+        #endif
+
+        slab_ptr.reset(
+            new Slab(std::move(slab_buffer_ptr),
+                     in_slab_key,
+                     SLAB_SIZE)
+        );
+        vkgl_assert(slab_ptr != nullptr);
+
+        slabs.push_back(std::move(slab_ptr) );
+    }
+
+    /* 3. Retry. This time around, the search is guaranteed to succeed. */
+    result_ptr = suballocate_from_slab(in_slab_key,
+                                       in_size);
+
+end:
+    vkgl_assert(result_ptr != nullptr);
+    return result_ptr;
+}
+
+bool OpenGL::VKBufferManager::unmap_buffer(const GLuint&                   in_id,
+                                           const OpenGL::TimeMarker&       in_frontend_object_creation_time,
+                                           OpenGL::VKMapBackingSharedPtr*  out_backing_ptr,
+                                           std::vector<Anvil::BufferCopy>* out_copy_regions_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::lock_guard<std::mutex> lock           (m_mutex);
+    const auto                  buffer_map_key (BufferMapKey(in_id, in_frontend_object_creation_time) );
+    auto                        buffer_iterator(m_buffers.find(buffer_map_key) );
+    BufferData*                 buffer_data_ptr(nullptr);
+    bool                        result         (false);
+
+    vkgl_assert(buffer_iterator != m_buffers.end() );
+
+    buffer_data_ptr = buffer_iterator->second.get();
+
+    out_copy_regions_ptr->clear();
+
+    if (!buffer_data_ptr->mapped)
+    {
+        goto end;
+    }
+
+    if ((buffer_data_ptr->map_bits & OpenGL::BUFFER_MAP_BIT_FLUSH_EXPLICIT) != 0)
+    {
+        /* Coalesce overlapping & adjacent flushed regions, so that the copy op touches each byte at most once. */
+        auto& regions = buffer_data_ptr->map_flushed_regions;
+
+        std::sort(regions.begin(),
+                  regions.end  (),
+                  [](const Anvil::BufferCopy& in_region1,
+                     const Anvil::BufferCopy& in_region2)
+                  {
+                      return in_region1.dst_offset < in_region2.dst_offset;
+                  });
+
+        for (const auto& current_region : regions)
+        {
+            if (out_copy_regions_ptr->size() > 0                                                                   &&
+                out_copy_regions_ptr->back().dst_offset + out_copy_regions_ptr->back().size >= current_region.dst_offset)
+            {
+                auto& last_region = out_copy_regions_ptr->back();
+
+                last_region.size = std::max(last_region.dst_offset + last_region.size,
+                                            current_region.dst_offset + current_region.size) - last_region.dst_offset;
+            }
+            else
+            {
+                out_copy_regions_ptr->push_back(current_region);
+            }
+        }
+    }
+    else
+    if ((buffer_data_ptr->map_bits & OpenGL::BUFFER_MAP_BIT_WRITE) != 0 &&
+         buffer_data_ptr->map_length                               >  0)
+    {
+        Anvil::BufferCopy region;
+
+        region.dst_offset = buffer_data_ptr->map_start_offset;
+        region.size       = buffer_data_ptr->map_length;
+        region.src_offset = region.dst_offset;
+
+        out_copy_regions_ptr->push_back(region);
+    }
+
+    *out_backing_ptr = buffer_data_ptr->map_backing_ptr;
+
+    buffer_data_ptr->map_flushed_regions.clear();
+
+    buffer_data_ptr->mapped = false;
+    result                  = true;
+end:
+    return result;
+}
+
 void OpenGL::VKBufferManager::on_reference_destroyed(BufferData*                in_buffer_data_ptr,
                                                      OpenGL::VKBufferReference* in_reference_ptr)
 {
@@ -319,19 +1061,28 @@ void OpenGL::VKBufferManager::on_reference_destroyed(BufferData*
         }
     }
 
-	{
-    	auto current_buffer_iterator = in_buffer_data_ptr->buffer_map.begin();
-    	
-    	while (current_buffer_iterator->first != in_buffer_data_ptr->buffer_map.rbegin()->first)
-    	{
-    		if (current_buffer_iterator->second->reference_ptrs.size() == 0)
-    		{
-    			in_buffer_data_ptr->buffer_map.erase(current_buffer_iterator);
-    		}
-    		
-        	current_buffer_iterator = in_buffer_data_ptr->buffer_map.begin();
-    	}
-	}
+    /* Snapshots older than the most recent one which are no longer referenced have been orphaned. Since references are only
+     * released once the frame using them has finished executing GPU-side, their buffers can be safely recycled.
+     */
+    if (in_buffer_data_ptr->buffer_map.size() > 0)
+    {
+        const auto most_recent_time_marker = in_buffer_data_ptr->buffer_map.rbegin()->first;
+        auto       current_buffer_iterator = in_buffer_data_ptr->buffer_map.begin();
+
+        while (current_buffer_iterator->first != most_recent_time_marker)
+        {
+            if (current_buffer_iterator->second->reference_ptrs.size() == 0)
+            {
+                recycle_buffer_props(current_buffer_iterator->second.get() );
+
+                current_buffer_iterator = in_buffer_data_ptr->buffer_map.erase(current_buffer_iterator);
+            }
+            else
+            {
+                ++current_buffer_iterator;
+            }
+        }
+    }
 
     if (get_n_references(in_buffer_data_ptr)   == 0 &&
         in_buffer_data_ptr->has_been_destroyed)
@@ -344,6 +1095,8 @@ void OpenGL::VKBufferManager::on_reference_destroyed(BufferData*
         vkgl_assert(object_iterator != m_buffers.end() );
         if (object_iterator != m_buffers.end() )
         {
+            recycle_buffer_data(in_buffer_data_ptr);
+
             m_buffers.erase(object_iterator);
         }
 
@@ -2,26 +2,32 @@
  *
  * This code is licensed under MIT license (see LICENSE.txt for details)
  */
-#include "Anvil/include/misc/fence_create_info.h"
 #include "Anvil/include/misc/framebuffer_create_info.h"
 #include "Anvil/include/misc/image_create_info.h"
 #include "Anvil/include/misc/render_pass_create_info.h"
-#include "Anvil/include/misc/semaphore_create_info.h"
 #include "Anvil/include/misc/swapchain_create_info.h"
 #include "Anvil/include/wrappers/command_buffer.h"
 #include "Anvil/include/wrappers/command_pool.h"
 #include "Anvil/include/wrappers/device.h"
+#include "Anvil/include/wrappers/event.h"
 #include "Anvil/include/wrappers/fence.h"
+#include "Anvil/include/wrappers/query_pool.h"
 #include "Anvil/include/wrappers/queue.h"
 #include "Anvil/include/wrappers/semaphore.h"
 #include "Anvil/include/wrappers/swapchain.h"
 #include "Common/fence.h"
+#include "Common/logger.h"
+#include "Common/trace_recorder.h"
 #include "OpenGL/backend/nodes/vk_acquire_swapchain_image_node.h"
 #include "OpenGL/backend/vk_framebuffer_manager.h"
 #include "OpenGL/backend/vk_gfx_pipeline_manager.h"
 #include "OpenGL/backend/vk_renderpass_manager.h"
 #include "OpenGL/backend/vk_swapchain_manager.h"
+#include "OpenGL/backend/vk_sync_object_pool.h"
 #include "OpenGL/backend/vk_utils.h"
+#include <algorithm>
+#include <set>
+#include <tuple>
 
 #ifdef max
     #undef max
@@ -31,6 +37,45 @@
     #undef min
 #endif
 
+/* Used as trace event names, so must return string literals. */
+static const char* get_node_type_name(const OpenGL::FrameGraphNodeType& in_node_type)
+{
+    const char* result = "Unknown";
+
+    switch (in_node_type)
+    {
+        case OpenGL::FrameGraphNodeType::Acquire_Swapchain_Image: result = "Acquire swapchain image"; break;
+        case OpenGL::FrameGraphNodeType::Buffer_Data:             result = "Buffer data";             break;
+        case OpenGL::FrameGraphNodeType::Buffer_Map_Copy:         result = "Buffer map copy";         break;
+        case OpenGL::FrameGraphNodeType::Buffer_Sub_Data:         result = "Buffer sub data";         break;
+        case OpenGL::FrameGraphNodeType::Clear:                   result = "Clear";                   break;
+        case OpenGL::FrameGraphNodeType::Draw:                    result = "Draw";                    break;
+        case OpenGL::FrameGraphNodeType::Present_Swapchain_Image: result = "Present swapchain image"; break;
+        case OpenGL::FrameGraphNodeType::Synthetic:               result = "Synthetic";               break;
+
+        default:
+        {
+            vkgl_assert_fail();
+        }
+    }
+
+    return result;
+}
+
+static bool is_write_access(const Anvil::AccessFlags& in_access_mask)
+{
+    const Anvil::AccessFlags write_access_mask = Anvil::AccessFlagBits::COLOR_ATTACHMENT_WRITE_BIT               |
+                                                 Anvil::AccessFlagBits::DEPTH_STENCIL_ATTACHMENT_WRITE_BIT       |
+                                                 Anvil::AccessFlagBits::HOST_WRITE_BIT                           |
+                                                 Anvil::AccessFlagBits::MEMORY_WRITE_BIT                         |
+                                                 Anvil::AccessFlagBits::SHADER_WRITE_BIT                         |
+                                                 Anvil::AccessFlagBits::TRANSFER_WRITE_BIT                       |
+                                                 Anvil::AccessFlagBits::TRANSFORM_FEEDBACK_COUNTER_WRITE_BIT_EXT |
+                                                 Anvil::AccessFlagBits::TRANSFORM_FEEDBACK_WRITE_BIT_EXT;
+
+    return ((in_access_mask & write_access_mask) != 0);
+}
+
 OpenGL::VKFrameGraph::CommandBufferDynamicState::CommandBufferDynamicState()
 {
     FUN_ENTRY(DEBUG_DEPTH);
@@ -79,14 +124,16 @@ void OpenGL::VKFrameGraph::GroupNode::add_io(const OpenGL::NodeIO& in_io,
         {
             case OpenGL::NodeIOType::Buffer:
             {
-                if (current_group_node_io_ptr->buffer_reference_ptr->get_payload().buffer_ptr == in_io.buffer_reference_ptr->get_payload().buffer_ptr)
+                if (current_group_node_io_ptr->buffer_reference_ptr->get_payload().get_region_key() == in_io.buffer_reference_ptr->get_payload().get_region_key() )
                 {
                     /* For transfer ownership purposes, we need to ensure start-end region touched by the group node corresponds
                      * to the whole region accessed by subnodes. */
+                    const auto end_offset = std::max(current_group_node_io_ptr->buffer_props.start_offset + current_group_node_io_ptr->buffer_props.size,
+                                                     in_io.buffer_props.start_offset                      + in_io.buffer_props.size);
+
                     current_group_node_io_ptr->buffer_props.start_offset = std::min(current_group_node_io_ptr->buffer_props.start_offset,
                                                                                     in_io.buffer_props.start_offset);
-                    current_group_node_io_ptr->buffer_props.size         = std::max(current_group_node_io_ptr->buffer_props.size,
-                                                                                    in_io.buffer_props.size);
+                    current_group_node_io_ptr->buffer_props.size         = end_offset - current_group_node_io_ptr->buffer_props.start_offset;
                 	
                 	need_new_io = false;
                 }
@@ -115,8 +162,33 @@ void OpenGL::VKFrameGraph::GroupNode::add_io(const OpenGL::NodeIO& in_io,
 
             case OpenGL::NodeIOType::Swapchain_Image:
             {
-                /* Last graph node accessing the image has the ultimate take on swapchain image properties that subsequent group node should use.l */
-                current_group_node_io_ptr->swapchain_image_props = in_io.swapchain_image_props;
+                /* Group node-level IO must cover all aspects, stages & accesses of the graph nodes it encapsulates. As for the layouts:
+                 *
+                 * - inputs:  first graph node to touch an aspect defines the layout the group node expects the image to be in.
+                 * - outputs: last graph node accessing the image has the ultimate take on the layout subsequent group nodes are going to see.
+                 */
+                auto& group_node_props = current_group_node_io_ptr->swapchain_image_props;
+
+                if (group_node_props.color_image_layout == Anvil::ImageLayout::UNKNOWN ||
+                    (!in_is_input && in_io.swapchain_image_props.color_image_layout != Anvil::ImageLayout::UNKNOWN) )
+                {
+                    group_node_props.color_image_layout = in_io.swapchain_image_props.color_image_layout;
+                }
+
+                if (group_node_props.ds_image_layout == Anvil::ImageLayout::UNKNOWN ||
+                    (!in_is_input && in_io.swapchain_image_props.ds_image_layout != Anvil::ImageLayout::UNKNOWN) )
+                {
+                    group_node_props.ds_image_layout = in_io.swapchain_image_props.ds_image_layout;
+                }
+
+                if (group_node_props.fs_output_location == UINT32_MAX)
+                {
+                    group_node_props.fs_output_location = in_io.swapchain_image_props.fs_output_location;
+                }
+
+                group_node_props.access          |= in_io.swapchain_image_props.access;
+                group_node_props.aspects_touched |= in_io.swapchain_image_props.aspects_touched;
+                group_node_props.pipeline_stages |= in_io.swapchain_image_props.pipeline_stages;
 
                 need_new_io = false;
 
@@ -153,8 +225,15 @@ OpenGL::VKFrameGraph::VKFrameGraph(const OpenGL::IContextObjectManagers* in_fron
      m_acquired_swapchain_image_index  (UINT32_MAX),
      m_acquired_swapchain_reference_ptr(nullptr),
      m_backend_ptr                     (in_backend_ptr),
+     m_completed_timeline_value        (0),
+     m_cpu_wait_time_us                (0),
      m_frontend_ptr                    (in_frontend_ptr),
-     m_swapchain_acquire_sem_ptr       (nullptr)
+     m_gpu_idle_time_us                (0),
+     m_is_tracing_execution            (false),
+     m_last_submitted_timeline_value   (0),
+     m_retire_thread_terminating       (false),
+     m_swapchain_acquire_sem_ptr       (nullptr),
+     m_timestamp_period_ns             (0.0f)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -165,7 +244,42 @@ OpenGL::VKFrameGraph::~VKFrameGraph()
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    /* Stub */
+    /* Set a terminate flag and wait for the retire thread to quit. The thread retires all pending submissions first, so active
+     * submissions can be safely released afterward.
+     */
+    if (m_retire_thread_ptr != nullptr)
+    {
+        {
+            std::lock_guard<std::mutex> retire_lock(m_retire_mutex);
+
+            m_retire_thread_terminating = true;
+        }
+
+        m_retire_condition.notify_all();
+        m_retire_thread_ptr->join    ();
+    }
+}
+
+OpenGL::VKFrameGraph::CommandPoolSlotUniquePtr OpenGL::VKFrameGraph::acquire_command_pool_slot()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes m_execute_mutex is locked! */
+    CommandPoolSlotUniquePtr result_ptr;
+
+    if (m_free_command_pool_slots.size() > 0)
+    {
+        result_ptr = std::move(m_free_command_pool_slots.back() );
+
+        m_free_command_pool_slots.pop_back();
+    }
+    else
+    {
+        result_ptr.reset(new CommandPoolSlot() );
+        vkgl_assert(result_ptr != nullptr);
+    }
+
+    return result_ptr;
 }
 
 void OpenGL::VKFrameGraph::add_node(OpenGL::VKFrameGraphNodeUniquePtr in_node_ptr)
@@ -179,9 +293,97 @@ void OpenGL::VKFrameGraph::add_node(OpenGL::VKFrameGraphNodeUniquePtr in_node_pt
     );
 }
 
+Anvil::PrimaryCommandBuffer* OpenGL::VKFrameGraph::alloc_command_buffer(CommandPoolSlot* in_command_pool_slot_ptr,
+                                                                        const uint32_t&  in_queue_family_index)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes m_execute_mutex is locked! */
+    auto&                        pool_data  = in_command_pool_slot_ptr->pool_data_map[std::make_pair(std::this_thread::get_id(),
+                                                                                                     in_queue_family_index)];
+    Anvil::PrimaryCommandBuffer* result_ptr = nullptr;
+
+    if (pool_data.command_pool_ptr == nullptr)
+    {
+        /* NOTE: Command buffers are never reset individually - the whole pool is reset once the GPU is done with the slot. */
+        pool_data.command_pool_ptr = Anvil::CommandPool::create(m_backend_ptr->get_device_ptr(),
+                                                                Anvil::CommandPoolCreateFlagBits::NONE,
+                                                                in_queue_family_index);
+
+        if (pool_data.command_pool_ptr == nullptr)
+        {
+            vkgl_assert(pool_data.command_pool_ptr != nullptr);
+
+            goto end;
+        }
+
+        m_frame_stats.n_command_pools_created++;
+    }
+
+    if (pool_data.n_cmd_buffers_used < static_cast<uint32_t>(pool_data.cmd_buffer_ptrs.size() ))
+    {
+        result_ptr = pool_data.cmd_buffer_ptrs.at(pool_data.n_cmd_buffers_used).get();
+
+        m_frame_stats.n_command_buffers_recycled++;
+    }
+    else
+    {
+        auto new_cmd_buffer_ptr = pool_data.command_pool_ptr->alloc_primary_level_command_buffer();
+
+        if (new_cmd_buffer_ptr == nullptr)
+        {
+            vkgl_assert(new_cmd_buffer_ptr != nullptr);
+
+            goto end;
+        }
+
+        result_ptr = new_cmd_buffer_ptr.get();
+
+        pool_data.cmd_buffer_ptrs.push_back(std::move(new_cmd_buffer_ptr) );
+
+        m_frame_stats.n_command_buffers_allocated++;
+    }
+
+    pool_data.n_cmd_buffers_used++;
+
+end:
+    return result_ptr;
+}
+
+bool OpenGL::VKFrameGraph::are_vertex_buffers_bound(const uint32_t&       in_n_bindings,
+                                                   Anvil::Buffer* const* in_buffer_ptrs,
+                                                   const VkDeviceSize*   in_offsets) const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    const auto& state  = m_current_cmd_buffer_dynamic_state;
+    bool        result = false;
+
+    if (state.bound_vertex_buffer_ptrs.size() != in_n_bindings)
+    {
+        goto end;
+    }
+
+    for (uint32_t n_binding = 0;
+                  n_binding < in_n_bindings;
+                ++n_binding)
+    {
+        if (state.bound_vertex_buffer_ptrs   [n_binding] != in_buffer_ptrs[n_binding] ||
+            state.bound_vertex_buffer_offsets[n_binding] != in_offsets    [n_binding])
+        {
+            goto end;
+        }
+    }
+
+    result = true;
+end:
+    return result;
+}
+
 bool OpenGL::VKFrameGraph::bake_barriers(const std::vector<GroupNodeUniquePtr>& in_group_nodes_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE("Frame graph: bake barriers");
     
     auto const device_ptr            = m_backend_ptr->get_device_ptr();
     bool       result                = false;
@@ -271,8 +473,6 @@ bool OpenGL::VKFrameGraph::bake_barriers(const std::vector<GroupNodeUniquePtr>&
                     * 1) If there are incoming connections: ORing all access flags defined for connections where outputs of group nodes touching the buffer
                     *    are connected to the processed input.
                     * 2) If no incoming connections are defined: Assuming no access flags are required.
-                    *
-                    * TODO: Define barriers for buffer memory ranges, instead of buffer instances.
                     */
                     std::vector<std::vector<Anvil::BufferBarrier>* > post_buffer_barrier_vec_ptrs_vec;
                     Anvil::AccessFlags                               src_access_mask                  = Anvil::AccessFlagBits::NONE;
@@ -421,6 +621,12 @@ bool OpenGL::VKFrameGraph::bake_barriers(const std::vector<GroupNodeUniquePtr>&
             /* NOTE: Ignore events/fences/sems requested for node IOs. These should've been handled in previous step. */
             vkgl_assert(src_io.type == dst_io.type);
 
+            if (dst_graph_node_pre_barriers.n_latest_src_graph_node == UINT32_MAX                ||
+                dst_graph_node_pre_barriers.n_latest_src_graph_node <  current_connection.n_src_graph_node)
+            {
+                dst_graph_node_pre_barriers.n_latest_src_graph_node = current_connection.n_src_graph_node;
+            }
+
             switch (dst_io.type)
             {
                 case OpenGL::NodeIOType::Buffer:
@@ -468,6 +674,14 @@ bool OpenGL::VKFrameGraph::bake_barriers(const std::vector<GroupNodeUniquePtr>&
                     Anvil::AccessFlags dst_access_mask_color = Anvil::AccessFlagBits::NONE;
                     Anvil::AccessFlags dst_access_mask_ds    = Anvil::AccessFlagBits::NONE;
 
+                    if (current_group_node_ptr->uses_renderpass)
+                    {
+                        /* Default FB is a RP attachment in this case. Layout transitions between subpasses are handled by subpass attachment
+                         * layouts and subpass dependencies baked by bake_renderpasses(). A barrier is not allowed here anyway.
+                         */
+                        break;
+                    }
+
                     split_access_mask_to_color_and_ds_access_masks(dst_access_mask,
                                                                   &dst_access_mask_color,
                                                                   &dst_access_mask_ds);
@@ -497,6 +711,33 @@ bool OpenGL::VKFrameGraph::bake_barriers(const std::vector<GroupNodeUniquePtr>&
             }
         }
 
+        /* Renderpasses transition attachments to their final layouts on their own. Make sure we know which layouts default FB images
+         * are going to be left in by the time the next group node starts executing.
+         */
+        if (current_group_node_ptr->uses_renderpass)
+        {
+            for (const auto& current_output_ptr : current_group_node_ptr->output_ptrs)
+            {
+                if (current_output_ptr->type != OpenGL::NodeIOType::Swapchain_Image)
+                {
+                    continue;
+                }
+
+                auto& current_swapchain_image_props = m_swapchain_image_data.at(m_acquired_swapchain_image_index);
+
+                if ((current_output_ptr->swapchain_image_props.aspects_touched & Anvil::ImageAspectFlagBits::COLOR_BIT) != 0)
+                {
+                    current_swapchain_image_props.color_aspect_layout = current_output_ptr->swapchain_image_props.color_image_layout;
+                }
+
+                if ((current_output_ptr->swapchain_image_props.aspects_touched & Anvil::ImageAspectFlagBits::DEPTH_BIT)   != 0 ||
+                    (current_output_ptr->swapchain_image_props.aspects_touched & Anvil::ImageAspectFlagBits::STENCIL_BIT) != 0)
+                {
+                    current_swapchain_image_props.ds_aspect_layout = current_output_ptr->swapchain_image_props.ds_image_layout;
+                }
+            }
+        }
+
         /* Now that all barriers have been stored for the group node, check if a queue fam has actually been assigned to this group node.
          * If not, make sure to force one - otherwise we wouldn't be able to actually execute the barriers!
          */
@@ -516,6 +757,7 @@ end:
 bool OpenGL::VKFrameGraph::bake_framebuffers(const std::vector<GroupNodeUniquePtr>& in_group_nodes_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE("Frame graph: bake framebuffers");
     
     auto                           backend_fb_manager_ptr        = m_backend_ptr->get_framebuffer_manager_ptr();
     auto                           backend_image_manager_ptr 	= m_backend_ptr->get_image_manager_ptr  	();
@@ -599,7 +841,8 @@ bool OpenGL::VKFrameGraph::bake_framebuffers(const std::vector<GroupNodeUniquePt
                                                          current_group_node_ptr->framebuffer_size[0], /* in_width  */
                                                          current_group_node_ptr->framebuffer_size[1], /* in_height */
                                                          current_group_node_ptr->framebuffer_n_layers,
-                                                         current_group_node_ptr->renderpass_ptr);
+                                                         current_group_node_ptr->renderpass_ptr,
+                                                         get_execution_timeline_value() );
         vkgl_assert(fb_ptr != nullptr);
 
         current_group_node_ptr->framebuffer_ptr = fb_ptr;
@@ -614,6 +857,7 @@ bool OpenGL::VKFrameGraph::bake_renderpasses(const std::vector<GroupNodeUniquePt
                                              const std::unordered_map<const GroupNode*, std::vector<GroupNodeToGroupNodeSquashedConnection> >* in_src_dst_group_node_connections_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE("Frame graph: bake renderpasses");
     
     bool result                = false;
     auto rp_manager_ptr        = m_backend_ptr->get_renderpass_manager_ptr();
@@ -752,6 +996,142 @@ bool OpenGL::VKFrameGraph::bake_renderpasses(const std::vector<GroupNodeUniquePt
             }
         }
 
+        /* 1a) Clear nodes the group node starts with can be folded into LOAD_OP_CLEAR load ops, as long as they affect the whole
+         *     render area. Any other clear is recorded by the node itself, with vkCmdClearAttachments().
+         *
+         * If the same aspect is cleared more than once, the last clear wins.
+         */
+        VkClearValue swapchain_color_clear_value;
+        VkClearValue swapchain_ds_clear_value;
+        bool         is_swapchain_color_aspect_cleared   = false;
+        bool         is_swapchain_depth_aspect_cleared   = false;
+        bool         is_swapchain_stencil_aspect_cleared = false;
+        uint32_t     n_graph_nodes_folded                = 0;
+
+        memset(&swapchain_color_clear_value,
+               0,
+               sizeof(swapchain_color_clear_value) );
+        memset(&swapchain_ds_clear_value,
+               0,
+               sizeof(swapchain_ds_clear_value) );
+
+        for (const auto& current_graph_node_ptr : current_group_node_ptr->graph_node_ptrs)
+        {
+            const OpenGL::GLContextStateBindingReferences* context_state_binding_refs_ptr = nullptr;
+            const OpenGL::ContextState*                    context_state_ptr              = nullptr;
+            bool                                           is_foldable                    = true;
+
+            if (current_graph_node_ptr->get_type() != OpenGL::FrameGraphNodeType::Clear)
+            {
+                break;
+            }
+
+            current_graph_node_ptr->get_gl_context_state(&context_state_ptr,
+                                                         &context_state_binding_refs_ptr);
+            vkgl_assert(context_state_ptr != nullptr);
+
+            if (context_state_ptr->is_scissor_test_enabled)
+            {
+                break;
+            }
+
+            for (const auto& current_output : current_graph_node_ptr->get_info_ptr()->outputs)
+            {
+                if (current_output.type != OpenGL::NodeIOType::Swapchain_Image)
+                {
+                    /* TODO: FBO attachments are not rendered to with renderpasses yet. */
+                    is_foldable = false;
+
+                    break;
+                }
+            }
+
+            if (!is_foldable)
+            {
+                break;
+            }
+
+            for (const auto& current_output : current_graph_node_ptr->get_info_ptr()->outputs)
+            {
+                const auto& aspects_touched = current_output.swapchain_image_props.aspects_touched;
+
+                if ((aspects_touched & Anvil::ImageAspectFlagBits::COLOR_BIT) != 0)
+                {
+                    static_assert(sizeof(swapchain_color_clear_value.color.float32) == sizeof(context_state_ptr->color_clear_value), "Clear color sizes must match");
+
+                    memcpy(swapchain_color_clear_value.color.float32,
+                           context_state_ptr->color_clear_value,
+                           sizeof(swapchain_color_clear_value.color.float32) );
+
+                    is_swapchain_color_aspect_cleared = true;
+                }
+
+                if ((aspects_touched & Anvil::ImageAspectFlagBits::DEPTH_BIT) != 0)
+                {
+                    swapchain_ds_clear_value.depthStencil.depth = static_cast<float>(std::clamp(context_state_ptr->depth_clear_value,
+                                                                                                0.0,
+                                                                                                1.0) );
+                    is_swapchain_depth_aspect_cleared           = true;
+                }
+
+                if ((aspects_touched & Anvil::ImageAspectFlagBits::STENCIL_BIT) != 0)
+                {
+                    swapchain_ds_clear_value.depthStencil.stencil = context_state_ptr->stencil_clear_value;
+                    is_swapchain_stencil_aspect_cleared           = true;
+                }
+            }
+
+            ++n_graph_nodes_folded;
+        }
+
+        /* 1b) Default FB's depth/stencil contents are undefined after present. Unless a subsequent group node accesses them before
+         *     the swapchain image is presented, there's no need to write them back to memory.
+         */
+        bool is_swapchain_ds_store_discardable = false;
+
+        for (uint32_t n_subsequent_group_node = n_current_group_node + 1;
+                      n_subsequent_group_node < static_cast<uint32_t>(in_group_nodes_ptr.size() );
+                    ++n_subsequent_group_node)
+        {
+            const auto& subsequent_group_node_ptr = in_group_nodes_ptr.at(n_subsequent_group_node);
+            bool        is_ds_accessed            = false;
+            bool        is_present_node_found     = false;
+
+            for (const auto& current_input_ptr : subsequent_group_node_ptr->input_ptrs)
+            {
+                if (current_input_ptr->type == OpenGL::NodeIOType::Swapchain_Image                                                     &&
+                    ((current_input_ptr->swapchain_image_props.aspects_touched & Anvil::ImageAspectFlagBits::DEPTH_BIT)   != 0 ||
+                     (current_input_ptr->swapchain_image_props.aspects_touched & Anvil::ImageAspectFlagBits::STENCIL_BIT) != 0) )
+                {
+                    is_ds_accessed = true;
+
+                    break;
+                }
+            }
+
+            if (is_ds_accessed)
+            {
+                break;
+            }
+
+            for (const auto& current_graph_node_ptr : subsequent_group_node_ptr->graph_node_ptrs)
+            {
+                if (current_graph_node_ptr->get_type() == OpenGL::FrameGraphNodeType::Present_Swapchain_Image)
+                {
+                    is_present_node_found = true;
+
+                    break;
+                }
+            }
+
+            if (is_present_node_found)
+            {
+                is_swapchain_ds_store_discardable = true;
+
+                break;
+            }
+        }
+
         for (const auto& current_output_ptr : current_group_node_ptr->output_ptrs)
         {
             switch (current_output_ptr->type)
@@ -829,7 +1209,8 @@ bool OpenGL::VKFrameGraph::bake_renderpasses(const std::vector<GroupNodeUniquePt
 
                     rp_create_info_ptr->add_color_attachment(color_image_create_info_ptr->get_format      (),
                                                              color_image_create_info_ptr->get_sample_count(),
-                                                             (is_swapchain_color_aspect_input_defined)  ? Anvil::AttachmentLoadOp::LOAD
+                                                             (is_swapchain_color_aspect_cleared)        ? Anvil::AttachmentLoadOp::CLEAR
+                                                           : (is_swapchain_color_aspect_input_defined)  ? Anvil::AttachmentLoadOp::LOAD
                                                                                                         : Anvil::AttachmentLoadOp::DONT_CARE,
                                                              (is_swapchain_color_aspect_output_defined) ? Anvil::AttachmentStoreOp::STORE
                                                                                                         : Anvil::AttachmentStoreOp::DONT_CARE,
@@ -843,15 +1224,20 @@ bool OpenGL::VKFrameGraph::bake_renderpasses(const std::vector<GroupNodeUniquePt
                         is_swapchain_stencil_aspect_input_defined  ||
                         is_swapchain_stencil_aspect_output_defined)
                     {
+                        const bool store_depth   = is_swapchain_depth_aspect_output_defined   && !is_swapchain_ds_store_discardable;
+                        const bool store_stencil = is_swapchain_stencil_aspect_output_defined && !is_swapchain_ds_store_discardable;
+
                         rp_create_info_ptr->add_depth_stencil_attachment(ds_image_create_info_ptr->get_format      (),
                                                                          ds_image_create_info_ptr->get_sample_count(),
-                                                                         (is_swapchain_depth_aspect_input_defined)    ? Anvil::AttachmentLoadOp::LOAD
+                                                                         (is_swapchain_depth_aspect_cleared)          ? Anvil::AttachmentLoadOp::CLEAR
+                                                                       : (is_swapchain_depth_aspect_input_defined)    ? Anvil::AttachmentLoadOp::LOAD
                                                                                                                       : Anvil::AttachmentLoadOp::DONT_CARE,
-                                                                         (is_swapchain_depth_aspect_output_defined)   ? Anvil::AttachmentStoreOp::STORE
+                                                                         (store_depth)                                ? Anvil::AttachmentStoreOp::STORE
                                                                                                                       : Anvil::AttachmentStoreOp::DONT_CARE,
-                                                                         (is_swapchain_stencil_aspect_input_defined)  ? Anvil::AttachmentLoadOp::LOAD
+                                                                         (is_swapchain_stencil_aspect_cleared)        ? Anvil::AttachmentLoadOp::CLEAR
+                                                                       : (is_swapchain_stencil_aspect_input_defined)  ? Anvil::AttachmentLoadOp::LOAD
                                                                                                                       : Anvil::AttachmentLoadOp::DONT_CARE,
-                                                                         (is_swapchain_stencil_aspect_output_defined) ? Anvil::AttachmentStoreOp::STORE
+                                                                         (store_stencil)                              ? Anvil::AttachmentStoreOp::STORE
                                                                                                                       : Anvil::AttachmentStoreOp::DONT_CARE,
                                                                          initial_swapchain_ds_layout,
                                                                          current_output_ptr->swapchain_image_props.ds_image_layout,
@@ -1198,8 +1584,40 @@ bool OpenGL::VKFrameGraph::bake_renderpasses(const std::vector<GroupNodeUniquePt
 
         /* 7) irrelevant as GL 3.2 does not support by-region dependencies */
 
+        /* Stash clear values for the load ops baked in 1a). */
+        current_group_node_ptr->clear_values.clear();
+
+        if (is_swapchain_color_aspect_cleared)
+        {
+            vkgl_assert(rp_swapchain_color_attachment_id != UINT32_MAX);
+
+            current_group_node_ptr->clear_values.resize(std::max(static_cast<uint32_t>(current_group_node_ptr->clear_values.size() ),
+                                                                 rp_swapchain_color_attachment_id + 1) );
+            current_group_node_ptr->clear_values.at    (rp_swapchain_color_attachment_id) = swapchain_color_clear_value;
+        }
+
+        if (is_swapchain_depth_aspect_cleared   ||
+            is_swapchain_stencil_aspect_cleared)
+        {
+            vkgl_assert(rp_swapchain_ds_attachment_id != UINT32_MAX);
+
+            current_group_node_ptr->clear_values.resize(std::max(static_cast<uint32_t>(current_group_node_ptr->clear_values.size() ),
+                                                                 rp_swapchain_ds_attachment_id + 1) );
+            current_group_node_ptr->clear_values.at    (rp_swapchain_ds_attachment_id) = swapchain_ds_clear_value;
+        }
+
+        if (is_swapchain_ds_store_discardable     &&
+            rp_swapchain_ds_attachment_id != UINT32_MAX)
+        {
+            m_frame_stats.n_attachment_stores_discarded++;
+        }
+
+        current_group_node_ptr->n_graph_nodes_folded_into_load_ops  = n_graph_nodes_folded;
+        m_frame_stats.n_clears_folded_into_load_ops                += n_graph_nodes_folded;
+
         /* Create the renderpass and associate it with the group node. */
-        current_group_node_ptr->renderpass_ptr = rp_manager_ptr->get_render_pass(std::move(rp_create_info_ptr));
+        current_group_node_ptr->renderpass_ptr = rp_manager_ptr->get_render_pass(std::move(rp_create_info_ptr),
+                                                                                 get_execution_timeline_value() );
         vkgl_assert(current_group_node_ptr->renderpass_ptr != nullptr);
     }
     result = true;
@@ -1212,15 +1630,12 @@ bool OpenGL::VKFrameGraph::coalesce_to_group_nodes(const std::vector<VKFrameGrap
                                                    std::unordered_map<const GroupNode*, std::vector<GroupNodeToGroupNodeSquashedConnection > >* out_src_dst_group_node_connections_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE("Frame graph: coalesce");
     
     auto current_group_node_ptr = GroupNodeUniquePtr(nullptr,
                                                      std::default_delete<GroupNode>() );
     bool result                 = false;
 
-    auto       device_ptr                     = m_backend_ptr->get_device_ptr();
-    const auto device_supports_compute_queues = device_ptr->get_n_compute_queues () > 0;
-    const auto device_supports_dma_queues     = device_ptr->get_n_transfer_queues() > 0;
-
     for (const auto& current_node_ptr : in_node_ptrs)
     {
         const auto                        current_node_info_ptr                       = current_node_ptr->get_info_ptr                 ();
@@ -1233,38 +1648,11 @@ bool OpenGL::VKFrameGraph::coalesce_to_group_nodes(const std::vector<VKFrameGrap
                                                                                                                                    : false;
         const bool                        current_node_supports_2nd_level_cmd_buffers = (current_node_requires_gpu_side_execution) ? current_node_ptr->supports_secondary_command_buffers()
                                                                                                                                    : false;
-        const Anvil::QueueFamilyFlagBits* current_node_accepted_queue_fams_ptr        = nullptr;
-        uint32_t                          current_node_n_accepted_queue_fams          = 0;
-        bool                              current_node_supports_compute_queues        = false;
-        bool                              current_node_supports_dma_queues            = false;
-        bool                              current_node_supports_universal_queues      = false;
 
         if (current_node_requires_gpu_side_execution)
         {
-            current_node_ptr->get_supported_queue_families(&current_node_n_accepted_queue_fams,
-                                                           &current_node_accepted_queue_fams_ptr);
-
             /* Sanity checks */
             vkgl_assert(current_node_supports_1st_level_cmd_buffers || current_node_supports_2nd_level_cmd_buffers);
-            vkgl_assert(current_node_n_accepted_queue_fams          != 0);
-            vkgl_assert(current_node_accepted_queue_fams_ptr        != nullptr);
-        }
-
-        for (uint32_t n_queue_fam = 0;
-                      n_queue_fam < current_node_n_accepted_queue_fams;
-                    ++n_queue_fam)
-        {
-            switch (current_node_accepted_queue_fams_ptr[n_queue_fam])
-            {
-                case Anvil::QueueFamilyFlagBits::COMPUTE_BIT:  current_node_supports_compute_queues   = true; break;
-                case Anvil::QueueFamilyFlagBits::DMA_BIT:      current_node_supports_dma_queues       = true; break;
-                case Anvil::QueueFamilyFlagBits::GRAPHICS_BIT: current_node_supports_universal_queues = true; break;
-
-                default:
-                {
-                    vkgl_assert_fail();
-                }
-            }
         }
 
         if (current_node_requires_manual_wait_sem_sync)
@@ -1333,28 +1721,38 @@ bool OpenGL::VKFrameGraph::coalesce_to_group_nodes(const std::vector<VKFrameGrap
         }
 
         /* Next, we need to decide when it is actually sensible to coalesce input nodes into as single group node.
-         * For now, follow the following heuristics:
+         * See get_node_queue_family_type() for the heuristics used to pick a queue family.
          *
-         * 1. If a node AND HW supports DMA queue, make sure to offload the operations there.
-         * 2. If a node AND HW supports compute queue, make sure to use it.
-         * 3. Otherwise, use universal queue.
-         *
-         * In specific, ignore the preferred order reported by nodes. At least for now.
-         *
-         * TODO: Once node reshuffling is introduced, this should actually become performant. For now, I'm expecting
-         *       this logic to create a flurry of command buffers. Oh well.
+         * NOTE: Nodes have already been reordered by reorder_nodes() at this point, so that uploads are clustered and draws
+         *       touching the same render target are contiguous. This keeps the number of group nodes low.
          */
-        const Anvil::QueueFamilyType required_queue_family_type = (current_node_supports_dma_queues       && device_supports_dma_queues)     ? Anvil::QueueFamilyType::TRANSFER
-                                                                : (current_node_supports_compute_queues   && device_supports_compute_queues) ? Anvil::QueueFamilyType::COMPUTE
-                                                                : (current_node_supports_universal_queues)                                   ? Anvil::QueueFamilyType::UNIVERSAL
-                                                                                                                                             : Anvil::QueueFamilyType::UNDEFINED;
+        const Anvil::QueueFamilyType required_queue_family_type = get_node_queue_family_type(current_node_ptr.get(),
+                                                                                             nullptr); /* out_opt_supports_dma_queues_ptr */
 
         vkgl_assert(( current_node_requires_gpu_side_execution && required_queue_family_type != Anvil::QueueFamilyType::UNDEFINED) ||
                     (!current_node_requires_gpu_side_execution && required_queue_family_type == Anvil::QueueFamilyType::UNDEFINED) );
 
         if (current_group_node_ptr->queue_family == Anvil::QueueFamilyType::UNDEFINED)
         {
-            current_group_node_ptr->queue_family = required_queue_family_type;
+            /* Host-side only nodes cannot be put in a subpass. If any have already been added to the group node, a RP-only node
+             * needs to go to a new group node.
+             */
+            if (current_node_rp_support_scope                   == RenderpassSupportScope::Required &&
+                current_group_node_ptr->graph_node_ptrs.size() >  0)
+            {
+                out_group_nodes_ptr->push_back(std::move(current_group_node_ptr) );
+
+                current_group_node_ptr = GroupNodeUniquePtr(new GroupNode(required_queue_family_type,
+                                                                          true /* in_uses_renderpass */),
+                                                            std::default_delete<GroupNode>());
+
+                vkgl_assert(current_group_node_ptr != nullptr);
+            }
+            else
+            {
+                current_group_node_ptr->queue_family    = required_queue_family_type;
+                current_group_node_ptr->uses_renderpass = (current_node_rp_support_scope == RenderpassSupportScope::Required);
+            }
         }
         else
         {
@@ -1430,8 +1828,9 @@ bool OpenGL::VKFrameGraph::coalesce_to_group_nodes(const std::vector<VKFrameGrap
             }
         };
 
-        OutputData                                  last_swapchain_output_data;
-        std::unordered_map<const void*, OutputData> object_ptr_to_last_output_data_map;
+        OutputData                                       last_swapchain_output_data;
+        std::map<OpenGL::VKBufferRegionKey, OutputData>  buffer_region_to_last_output_data_map;
+        std::unordered_map<const void*, OutputData>      object_ptr_to_last_output_data_map;
 
         for (uint32_t n_current_group_node = 0;
                       n_current_group_node < static_cast<uint32_t>(out_group_nodes_ptr->size() );
@@ -1440,8 +1839,9 @@ bool OpenGL::VKFrameGraph::coalesce_to_group_nodes(const std::vector<VKFrameGrap
             auto& current_group_node_ptr = out_group_nodes_ptr->at(n_current_group_node);
 
             /* Only parse inputs if at least one output has already been processed */
-            if (last_swapchain_output_data.group_node_ptr != nullptr ||
-                object_ptr_to_last_output_data_map.size() != 0)
+            if (last_swapchain_output_data.group_node_ptr    != nullptr ||
+                buffer_region_to_last_output_data_map.size() != 0       ||
+                object_ptr_to_last_output_data_map.size()    != 0)
             {
                 uint32_t n_dst_group_node_input = 0;
 
@@ -1451,9 +1851,9 @@ bool OpenGL::VKFrameGraph::coalesce_to_group_nodes(const std::vector<VKFrameGrap
                     {
                         case OpenGL::NodeIOType::Buffer:
                         {
-                            auto object_ptr_map_iterator = object_ptr_to_last_output_data_map.find(current_group_node_input_ptr->buffer_reference_ptr->get_payload().buffer_ptr);
+                            auto object_ptr_map_iterator = buffer_region_to_last_output_data_map.find(current_group_node_input_ptr->buffer_reference_ptr->get_payload().get_region_key() );
 
-                            if (object_ptr_map_iterator                        != object_ptr_to_last_output_data_map.end() &&
+                            if (object_ptr_map_iterator                        != buffer_region_to_last_output_data_map.end() &&
                                 object_ptr_map_iterator->second.group_node_ptr != current_group_node_ptr.get            () )
                             {
                                 /* Object reuse - add a connection */
@@ -1628,9 +2028,9 @@ bool OpenGL::VKFrameGraph::coalesce_to_group_nodes(const std::vector<VKFrameGrap
                         /* Update the map */
                         #ifdef _DEBUG
                         {
-                            auto map_iterator = object_ptr_to_last_output_data_map.find(current_group_node_output_ptr->buffer_reference_ptr->get_payload().buffer_ptr);
+                            auto map_iterator = buffer_region_to_last_output_data_map.find(current_group_node_output_ptr->buffer_reference_ptr->get_payload().get_region_key() );
 
-                            if (map_iterator != object_ptr_to_last_output_data_map.end() )
+                            if (map_iterator != buffer_region_to_last_output_data_map.end() )
                             {
                                 /* Sanity check: Only one output pointing to a specific buffer instance should be assigned per node */
                                 vkgl_assert(map_iterator->second.group_node_ptr != current_group_node_ptr.get() );
@@ -1638,8 +2038,8 @@ bool OpenGL::VKFrameGraph::coalesce_to_group_nodes(const std::vector<VKFrameGrap
                         }
                         #endif
 
-                        object_ptr_to_last_output_data_map[current_group_node_output_ptr->buffer_reference_ptr->get_payload().buffer_ptr] = OutputData(current_group_node_ptr.get       (),
-                                                                                                                                                       current_group_node_output_ptr.get() );
+                        buffer_region_to_last_output_data_map[current_group_node_output_ptr->buffer_reference_ptr->get_payload().get_region_key()] = OutputData(current_group_node_ptr.get       (),
+                                                                                                                                                                current_group_node_output_ptr.get() );
 
                         break;
                     }
@@ -1720,9 +2120,9 @@ bool OpenGL::VKFrameGraph::coalesce_to_group_nodes(const std::vector<VKFrameGrap
             }
         } OutputData;
 
-        std::unordered_map<void*, OutputData> last_buffer_output_data_map;
-        std::unordered_map<void*, OutputData> last_image_output_data_map;
-        OutputData                            last_swapchain_image_output_data = {UINT32_MAX, UINT32_MAX};
+        std::map<OpenGL::VKBufferRegionKey, OutputData> last_buffer_output_data_map;
+        std::unordered_map<void*, OutputData>           last_image_output_data_map;
+        OutputData                                      last_swapchain_image_output_data = {UINT32_MAX, UINT32_MAX};
 
         for (uint32_t n_current_graph_node = 0;
                       n_current_graph_node < n_graph_nodes;
@@ -1743,7 +2143,7 @@ bool OpenGL::VKFrameGraph::coalesce_to_group_nodes(const std::vector<VKFrameGrap
                 {
                     case OpenGL::NodeIOType::Buffer:
                     {
-                        auto last_buffer_output_iterator = last_buffer_output_data_map.find(current_input.buffer_reference_ptr->get_payload().buffer_ptr);
+                        auto last_buffer_output_iterator = last_buffer_output_data_map.find(current_input.buffer_reference_ptr->get_payload().get_region_key() );
 
                         if (last_buffer_output_iterator == last_buffer_output_data_map.end() )
                         {
@@ -1819,8 +2219,8 @@ bool OpenGL::VKFrameGraph::coalesce_to_group_nodes(const std::vector<VKFrameGrap
                 {
                     case OpenGL::NodeIOType::Buffer:
                     {
-                        last_buffer_output_data_map[current_output.buffer_reference_ptr->get_payload().buffer_ptr] = OutputData(n_current_graph_node,
-                                                                                                                                n_output);
+                        last_buffer_output_data_map[current_output.buffer_reference_ptr->get_payload().get_region_key()] = OutputData(n_current_graph_node,
+                                                                                                                                      n_output);
 
                         continue;
                     }
@@ -1987,47 +2387,305 @@ bool OpenGL::VKFrameGraph::do_group_nodes_encapsulate_swapchain_acquire_present_
             (n_acquire_nodes == n_present_nodes) );
 }
 
-void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
-                                   VKGL::Fence* in_opt_fence_ptr)
+bool OpenGL::VKFrameGraph::does_graph_node_touch_barrier_resources(const OpenGL::IVKFrameGraphNode* in_graph_node_ptr,
+                                                                   const BarrierData&               in_barrier_data) const
 {
     FUN_ENTRY(DEBUG_DEPTH);
-    
-    /* NOTE: This function must NEVER be called from app's rendering thread. */
-    std::lock_guard<std::mutex> execute_lock(m_execute_mutex);
 
-    std::vector<CommandBufferSubmissionUniquePtr>                                              command_buffer_submissions;
-    auto                                                                                       device_ptr                 = m_backend_ptr->get_device_ptr();
-    std::unordered_map<const GroupNode*, std::vector<GroupNodeToGroupNodeSquashedConnection> > group_node_connections;
-    std::vector<GroupNodeUniquePtr>                                                            group_node_ptrs;
-    decltype(m_node_ptrs)                                                                      node_ptrs;
-    std::vector<Anvil::SemaphoreUniquePtr>                                                     sem_ptrs;
-    Anvil::FenceUniquePtr                                                                      wait_fence_ptr;
+    const auto node_info_ptr = in_graph_node_ptr->get_info_ptr();
+    bool       result        = false;
 
-    /* Go through active submissions and check if any of the already scheduled ones have already finished executing GPU-side.
-     *
-     * If so, go ahead and release all related nodes (along with the fence).
-     */
+    for (uint32_t n_iteration = 0;
+                  n_iteration < 2 && !result;
+                ++n_iteration)
     {
-        for (uint32_t n_submission = 0;
-                      n_submission < static_cast<uint32_t>(m_active_submissions.size() );
-                    )
-        {
-            auto& current_submission = m_active_submissions.at(n_submission);
+        const auto& io_vec = (n_iteration == 0) ? node_info_ptr->inputs
+                                                : node_info_ptr->outputs;
 
-            if (current_submission.fence_ptr->is_set() )
+        for (const auto& current_io : io_vec)
+        {
+            switch (current_io.type)
             {
-                if (current_submission.fence2_ptr != nullptr)
+                case OpenGL::NodeIOType::Buffer:
                 {
-                    current_submission.fence2_ptr->signal();
-                }
+                    const auto buffer_ptr = current_io.buffer_reference_ptr->get_payload().buffer_ptr;
 
-                m_active_submissions.erase(m_active_submissions.begin() + n_submission);
+                    for (const auto& current_barrier : in_barrier_data.buffer_barriers)
+                    {
+                        result |= (current_barrier.buffer_ptr == buffer_ptr);
+                    }
+
+                    break;
+                }
+
+                case OpenGL::NodeIOType::Image:
+                {
+                    const auto image_ptr = current_io.image_reference_ptr->get_payload().image_ptr;
+
+                    for (const auto& current_barrier : in_barrier_data.image_barriers)
+                    {
+                        result |= (current_barrier.image_ptr == image_ptr);
+                    }
+
+                    break;
+                }
+
+                case OpenGL::NodeIOType::Swapchain_Image:
+                {
+                    /* Be conservative - swapchain images are not exposed via image references. */
+                    result |= (in_barrier_data.image_barriers.size() > 0);
+
+                    break;
+                }
+
+                default:
+                {
+                    vkgl_assert_fail();
+
+                    result = true;
+                }
+            }
+
+            if (result)
+            {
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+void OpenGL::VKFrameGraph::drop_and_merge_barriers(BarrierData* inout_barrier_data_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes m_execute_mutex is locked! */
+    std::vector<Anvil::BufferBarrier>          buffer_barriers;
+    std::vector<const Anvil::ImageBarrier*>    image_barrier_ptrs;
+    std::vector<Anvil::ImageSubresourceRange>  image_barrier_ranges;
+    std::vector<Anvil::ImageBarrier>           image_barriers;
+    const uint32_t                             n_barriers_before  = static_cast<uint32_t>(inout_barrier_data_ptr->buffer_barriers.size() + inout_barrier_data_ptr->image_barriers.size() );
+    uint32_t                                   n_barriers_dropped = 0;
+
+    if (n_barriers_before == 0)
+    {
+        goto end;
+    }
+
+    /* 1. Buffer barriers. A read->read barrier which does not transfer ownership is a no-op.
+     *
+     *    Barriers touching adjacent or overlapping regions of the same buffer, using the same access masks and queue families, are merged into one.
+     */
+    buffer_barriers.reserve(inout_barrier_data_ptr->buffer_barriers.size() );
+
+    for (const auto& current_barrier : inout_barrier_data_ptr->buffer_barriers)
+    {
+        bool has_been_merged = false;
+
+        if (!is_write_access(current_barrier.src_access_mask)                            &&
+            !is_write_access(current_barrier.dst_access_mask)                            &&
+             current_barrier.src_queue_family_index == current_barrier.dst_queue_family_index)
+        {
+            ++n_barriers_dropped;
+
+            continue;
+        }
+
+        for (auto& merged_barrier : buffer_barriers)
+        {
+            if (merged_barrier.buffer_ptr             != current_barrier.buffer_ptr             ||
+                merged_barrier.dst_access_mask        != current_barrier.dst_access_mask        ||
+                merged_barrier.dst_queue_family_index != current_barrier.dst_queue_family_index ||
+                merged_barrier.src_access_mask        != current_barrier.src_access_mask        ||
+                merged_barrier.src_queue_family_index != current_barrier.src_queue_family_index ||
+                merged_barrier.size                   == VK_WHOLE_SIZE                          ||
+                current_barrier.size                  == VK_WHOLE_SIZE)
+            {
+                continue;
+            }
+
+            if (merged_barrier.offset  <= current_barrier.offset + current_barrier.size &&
+                current_barrier.offset <= merged_barrier.offset  + merged_barrier.size)
+            {
+                const VkDeviceSize end_offset = std::max(merged_barrier.offset  + merged_barrier.size,
+                                                         current_barrier.offset + current_barrier.size);
+
+                merged_barrier.offset = std::min(merged_barrier.offset,
+                                                 current_barrier.offset);
+                merged_barrier.size   = end_offset - merged_barrier.offset;
+
+                has_been_merged = true;
+                break;
+            }
+        }
+
+        if (!has_been_merged)
+        {
+            buffer_barriers.push_back(current_barrier);
+        }
+    }
+
+    /* 2. Image barriers. Same as above, except a barrier which changes the layout is never a no-op.
+     *
+     *    Barriers are merged if their subresource ranges are identical, or if they span the same mips and adjacent layers (or vice versa).
+     *    Anvil barriers cache the Vulkan descriptor at construction time and cannot be assigned to, so merged ranges are tracked separately
+     *    and the barriers are re-created at the end.
+     */
+    image_barrier_ptrs.reserve  (inout_barrier_data_ptr->image_barriers.size() );
+    image_barrier_ranges.reserve(inout_barrier_data_ptr->image_barriers.size() );
+
+    for (const auto& current_barrier : inout_barrier_data_ptr->image_barriers)
+    {
+        const auto& current_range   = current_barrier.subresource_range;
+        bool        has_been_merged = false;
+
+        if (!is_write_access(current_barrier.src_access_mask)                            &&
+            !is_write_access(current_barrier.dst_access_mask)                            &&
+             current_barrier.old_layout             == current_barrier.new_layout        &&
+             current_barrier.src_queue_family_index == current_barrier.dst_queue_family_index)
+        {
+            ++n_barriers_dropped;
+
+            continue;
+        }
+
+        for (uint32_t n_merged_barrier = 0;
+                      n_merged_barrier < static_cast<uint32_t>(image_barrier_ptrs.size() );
+                    ++n_merged_barrier)
+        {
+            const auto merged_barrier_ptr = image_barrier_ptrs.at  (n_merged_barrier);
+            auto&      merged_range       = image_barrier_ranges.at(n_merged_barrier);
+
+            if (merged_barrier_ptr->image_ptr              != current_barrier.image_ptr              ||
+                merged_barrier_ptr->dst_access_mask        != current_barrier.dst_access_mask        ||
+                merged_barrier_ptr->dst_queue_family_index != current_barrier.dst_queue_family_index ||
+                merged_barrier_ptr->new_layout             != current_barrier.new_layout             ||
+                merged_barrier_ptr->old_layout             != current_barrier.old_layout             ||
+                merged_barrier_ptr->src_access_mask        != current_barrier.src_access_mask        ||
+                merged_barrier_ptr->src_queue_family_index != current_barrier.src_queue_family_index ||
+                merged_range.aspect_mask                   != current_range.aspect_mask              ||
+                merged_range.layer_count                   == VK_REMAINING_ARRAY_LAYERS              ||
+                merged_range.level_count                   == VK_REMAINING_MIP_LEVELS                ||
+                current_range.layer_count                  == VK_REMAINING_ARRAY_LAYERS              ||
+                current_range.level_count                  == VK_REMAINING_MIP_LEVELS)
+            {
+                continue;
+            }
+
+            if (merged_range.base_mip_level == current_range.base_mip_level &&
+                merged_range.level_count    == current_range.level_count)
+            {
+                if (merged_range.base_array_layer == current_range.base_array_layer &&
+                    merged_range.layer_count      == current_range.layer_count)
+                {
+                    /* Duplicate */
+                    has_been_merged = true;
+                }
+                else
+                if (merged_range.base_array_layer  + merged_range.layer_count  == current_range.base_array_layer ||
+                    current_range.base_array_layer + current_range.layer_count == merged_range.base_array_layer)
+                {
+                    merged_range.base_array_layer = std::min(merged_range.base_array_layer,
+                                                             current_range.base_array_layer);
+                    merged_range.layer_count     += current_range.layer_count;
+
+                    has_been_merged = true;
+                }
             }
             else
+            if (merged_range.base_array_layer == current_range.base_array_layer &&
+                merged_range.layer_count      == current_range.layer_count)
+            {
+                if (merged_range.base_mip_level  + merged_range.level_count  == current_range.base_mip_level ||
+                    current_range.base_mip_level + current_range.level_count == merged_range.base_mip_level)
+                {
+                    merged_range.base_mip_level = std::min(merged_range.base_mip_level,
+                                                           current_range.base_mip_level);
+                    merged_range.level_count   += current_range.level_count;
+
+                    has_been_merged = true;
+                }
+            }
+
+            if (has_been_merged)
             {
-                ++n_submission;
+                break;
             }
         }
+
+        if (!has_been_merged)
+        {
+            image_barrier_ptrs.push_back  (&current_barrier);
+            image_barrier_ranges.push_back(current_range);
+        }
+    }
+
+    for (uint32_t n_image_barrier = 0;
+                  n_image_barrier < static_cast<uint32_t>(image_barrier_ptrs.size() );
+                ++n_image_barrier)
+    {
+        const auto image_barrier_ptr = image_barrier_ptrs.at(n_image_barrier);
+
+        image_barriers.push_back(
+            Anvil::ImageBarrier(image_barrier_ptr->src_access_mask,
+                                image_barrier_ptr->dst_access_mask,
+                                image_barrier_ptr->old_layout,
+                                image_barrier_ptr->new_layout,
+                                image_barrier_ptr->src_queue_family_index,
+                                image_barrier_ptr->dst_queue_family_index,
+                                image_barrier_ptr->image_ptr,
+                                image_barrier_ranges.at(n_image_barrier) )
+        );
+    }
+
+    m_frame_stats.n_barriers_dropped += n_barriers_dropped;
+    m_frame_stats.n_barriers_merged  += n_barriers_before - n_barriers_dropped - static_cast<uint32_t>(buffer_barriers.size() + image_barriers.size() );
+
+    inout_barrier_data_ptr->buffer_barriers = std::move(buffer_barriers);
+    inout_barrier_data_ptr->image_barriers  = std::move(image_barriers);
+
+end:
+    ;
+}
+
+void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
+                                   VKGL::Fence* in_opt_fence_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE("Frame graph: execute");
+    
+    /* NOTE: This function must NEVER be called from app's rendering thread. */
+    std::lock_guard<std::mutex> execute_lock(m_execute_mutex);
+
+    std::vector<CommandBufferSubmissionUniquePtr>                                              command_buffer_submissions;
+    CommandPoolSlotUniquePtr                                                                   command_pool_slot_ptr;
+    auto                                                                                       device_ptr                 = m_backend_ptr->get_device_ptr();
+    std::unordered_map<const GroupNode*, std::vector<GroupNodeToGroupNodeSquashedConnection> > group_node_connections;
+    std::vector<GroupNodeUniquePtr>                                                            group_node_ptrs;
+    uint32_t                                                                                   n_group_nodes_before_reordering = 0;
+    bool                                                                                       is_graph_empty             = false;
+    decltype(m_node_ptrs)                                                                      node_ptrs;
+    std::vector<Anvil::SemaphoreUniquePtr>                                                     sem_ptrs;
+    Anvil::FenceUniquePtr                                                                      wait_fence_ptr;
+
+    /* Sampled once, so that an execution either has all of its group nodes timestamped, or none. */
+    m_is_tracing_execution = VKGL::TraceRecorder::is_enabled();
+
+    /* Release all nodes (along with the fence) of active submissions, which the retire thread has found to have finished
+     * executing GPU-side. Submissions retire in order, so this comes down to a single read of the timeline counter.
+     */
+    {
+        const uint64_t completed_timeline_value = m_completed_timeline_value.load();
+
+        while (m_active_submissions.size()                  > 0 &&
+               m_active_submissions.front().timeline_value <= completed_timeline_value)
+        {
+            /* Command buffers the submission used can now be recycled. */
+            release_command_pool_slot(std::move(m_active_submissions.front().command_pool_slot_ptr) );
+
+            m_active_submissions.pop_front();
+        }
     }
 
     /* Cache node data, so that apps can continue rendering subsequent frames while we do the GL->VK conversion */
@@ -2036,6 +2694,8 @@ void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
 
         if (m_node_ptrs.size() == 0)
         {
+            is_graph_empty = true;
+
             goto end;
         }
 
@@ -2051,8 +2711,6 @@ void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
      *       - Command buffer reuse.
      *       - Multi-threading                              (CPU prepasses should be executed as thread pool jobs, layout/pipeline objects
      *                                                       should be created using multiple threads, etc.)
-     *       - Node reshuffling+clustering                  (as an example, transfer operations touching the same image should be clustered
-     *                                                       and submitted to a sDMA queue if only feasible).
      *       - Switch from STL to something more performant
      *
      *       For now, the goal is to get to a point where simple example apps work. This will give us a starting point,
@@ -2087,12 +2745,22 @@ void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
         goto end;
     }
 
-    /* 2. Determine which nodes can be squashed into a single command buffer.
+    /* 2. Reorder the nodes, so that fewer group nodes are needed to execute them. */
+    n_group_nodes_before_reordering = get_n_group_nodes_for_node_sequence(node_ptrs);
+
+    if (!reorder_nodes(node_ptrs) )
+    {
+        vkgl_assert_fail();
+
+        goto end;
+    }
+
+    /* 3. Determine which nodes can be squashed into a single command buffer.
      *
      *    First input occurence for each unique buffer range / image subresource should be exposed as an input of the group node.
      *    Last output occurence for each unique buffer range / image subresource should be exposed as an output of the group node.
      *
-     *    Then, convert the "sequential" input call representation into a DAG where each node is a group node obtained in step 2.
+     *    Then, convert the "sequential" input call representation into a DAG where each node is a group node obtained in step 3.
      **/
     if (!coalesce_to_group_nodes(node_ptrs,
                                 &group_node_ptrs,
@@ -2103,7 +2771,7 @@ void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
         goto end;
     }
 
-    /* 3. Determine what barriers should be injected & when. */
+    /* 4. Determine what barriers should be injected & when. */
     if (!bake_barriers(group_node_ptrs) )
     {
         vkgl_assert_fail();
@@ -2111,7 +2779,15 @@ void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
         goto end;
     }
 
-    /* 4. Bake renderpasses for any group nodes that need them. */
+    /* 5. Get rid of redundant barriers, and reshuffle the remaining ones so that the pipe stalls as rarely as possible. */
+    if (!optimize_barriers(group_node_ptrs) )
+    {
+        vkgl_assert_fail();
+
+        goto end;
+    }
+
+    /* 6. Bake renderpasses for any group nodes that need them. */
     if (!bake_renderpasses(group_node_ptrs,
                           &group_node_connections) )
     {
@@ -2120,7 +2796,7 @@ void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
         goto end;
     }
 
-    /* 5. Ditto for framebuffers. */
+    /* 7. Ditto for framebuffers. */
     if (!bake_framebuffers(group_node_ptrs) )
     {
         vkgl_assert_fail();
@@ -2128,9 +2804,13 @@ void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
         goto end;
     }
 
-    /* 6. Record command buffers for group nodes. */
+    /* 8. Record command buffers for group nodes. Command buffers are taken from a pool slot, which stays tied to this execution
+     *    until its fence is found signalled. */
+    command_pool_slot_ptr = acquire_command_pool_slot();
+
     if (!record_command_buffers(group_node_ptrs,
                                 group_node_connections,
+                                command_pool_slot_ptr.get(),
                                &command_buffer_submissions,
                                 sem_ptrs) )
     {
@@ -2139,14 +2819,9 @@ void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
         goto end;
     }
 
-    /* 7. Schedule command buffer submissions. */
-    {
-        auto fence_create_info_ptr = Anvil::FenceCreateInfo::create(device_ptr,
-                                                                    false); /* in_create_signalled */
-
-        wait_fence_ptr = Anvil::Fence::create(std::move(fence_create_info_ptr) );
-        vkgl_assert(wait_fence_ptr != nullptr);
-    }
+    /* 9. Schedule command buffer submissions. */
+    wait_fence_ptr = m_backend_ptr->get_sync_object_pool_ptr()->acquire_fence();
+    vkgl_assert(wait_fence_ptr != nullptr);
 
     if (!submit_command_buffers(command_buffer_submissions,
                                 wait_fence_ptr.get(),
@@ -2157,7 +2832,10 @@ void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
         goto end;
     }
 
-    /* 8. If this was requested, wait for the GPU-side operations to finish before leaving. */
+    m_frame_stats.n_submissions                    += static_cast<uint32_t>(command_buffer_submissions.size() );
+    m_frame_stats.n_submissions_without_reordering += n_group_nodes_before_reordering;
+
+    /* 10. If this was requested, wait for the GPU-side operations to finish before leaving. */
     if (in_block_until_finished)
     {
         VkResult result_vk = Anvil::Vulkan::vkWaitForFences(device_ptr->get_device_vk(),
@@ -2168,37 +2846,114 @@ void OpenGL::VKFrameGraph::execute(const bool&  in_block_until_finished,
 
         vkgl_assert(result_vk == VK_SUCCESS);
 
-        in_opt_fence_ptr->signal();
+        if (in_opt_fence_ptr != nullptr)
+        {
+            in_opt_fence_ptr->signal();
+        }
+
+        resolve_timestamp_queries(command_pool_slot_ptr.get(),
+                                  VKGL::TraceRecorder::get_time_us() );
+
+        release_command_pool_slot(std::move(command_pool_slot_ptr) );
     }
     else
     {
-        /* Cache group nodes along with the fence(s), so that - next execution happens - we can check if the nodes,
+        /* Cache group nodes along with the fence, so that - next execution happens - we can check if the nodes,
          * along with all relevant VK objects and references, can be safely released.
+         *
+         * The retire thread is going to signal the VKGL fence as soon as the submission finishes executing.
          */
+        const uint64_t timeline_value            = ++m_last_submitted_timeline_value;
+        auto           command_pool_slot_raw_ptr = (command_pool_slot_ptr->timestamp_queries.size() > 0) ? command_pool_slot_ptr.get()
+                                                                                                         : nullptr;
+        auto           wait_fence_raw_ptr        = wait_fence_ptr.get();
+
         m_active_submissions.push_back(
             ActiveSubmission(std::move(wait_fence_ptr),
                              group_node_ptrs,
                              node_ptrs,
                              command_buffer_submissions,
                              sem_ptrs,
-                             in_opt_fence_ptr)
+                             std::move(command_pool_slot_ptr),
+                             timeline_value)
         );
+
+        {
+            std::lock_guard<std::mutex> retire_lock(m_retire_mutex);
+
+            m_pending_retirements.push_back(
+                PendingRetirement(wait_fence_raw_ptr,
+                                  command_pool_slot_raw_ptr,
+                                  in_opt_fence_ptr,
+                                  timeline_value)
+            );
+        }
+
+        m_retire_condition.notify_all();
     }
 
 end:
+    /* Nothing was scheduled, but the VKGL fence must still not be signaled before previously submitted work finishes executing. */
+    if (is_graph_empty)
+    {
+        if (in_block_until_finished)
+        {
+            wait_for_timeline_value(m_last_submitted_timeline_value);
+
+            if (in_opt_fence_ptr != nullptr)
+            {
+                in_opt_fence_ptr->signal();
+            }
+        }
+        else if (in_opt_fence_ptr != nullptr)
+        {
+            {
+                std::lock_guard<std::mutex> retire_lock(m_retire_mutex);
+
+                m_pending_retirements.push_back(
+                    PendingRetirement(nullptr, /* in_fence_ptr                 */
+                                      nullptr, /* in_opt_command_pool_slot_ptr */
+                                      in_opt_fence_ptr,
+                                      m_last_submitted_timeline_value)
+                );
+            }
+
+            m_retire_condition.notify_all();
+        }
+    }
+
+    if (command_pool_slot_ptr != nullptr)
+    {
+        release_command_pool_slot(std::move(command_pool_slot_ptr) );
+    }
+
     group_node_ptrs.clear       ();
     group_node_connections.clear();
     node_ptrs.clear             ();
+
+    /* Evict backend objects which have not been used recently. Pipelines and framebuffers pin the renderpasses they were
+     * created for, so these need to go first.
+     */
+    {
+        const uint64_t completed_timeline_value = m_completed_timeline_value.load();
+
+        m_backend_ptr->get_gfx_pipeline_manager_ptr()->trim(completed_timeline_value);
+        m_backend_ptr->get_framebuffer_manager_ptr ()->trim(completed_timeline_value);
+        m_backend_ptr->get_renderpass_manager_ptr  ()->trim(completed_timeline_value);
+    }
 }
 
 bool OpenGL::VKFrameGraph::execute_cpu_prepass(const std::vector<VKFrameGraphNodeUniquePtr>& in_node_ptrs)
 {
     FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE("Frame graph: CPU prepass");
     
     for (auto& current_node_ptr : in_node_ptrs)
     {
         if (current_node_ptr->requires_cpu_prepass() )
         {
+            VKGL_TRACE_SCOPE(get_node_type_name(current_node_ptr->get_type() ));
+
             current_node_ptr->do_cpu_prepass(this);
         }
     }
@@ -2358,74 +3113,243 @@ bool OpenGL::VKFrameGraph::get_bound_pipeline_id(Anvil::PipelineID* out_result_p
     return m_current_cmd_buffer_dynamic_state.is_gfx_pipeline_id_bound;
 }
 
-Anvil::PipelineID OpenGL::VKFrameGraph::get_pipeline_id(const OpenGL::DrawCallMode& in_draw_call_mode)
+/* Returns the timeline value the execution currently being baked is going to be assigned, if it does not block. Blocking
+ * executions do not advance the timeline, so objects they use are kept around for (at least) one more execution, which
+ * is conservative but safe.
+ *
+ * NOTE: Must be called with m_execute_mutex held.
+ */
+uint64_t OpenGL::VKFrameGraph::get_execution_timeline_value() const
 {
     FUN_ENTRY(DEBUG_DEPTH);
-    
-    auto                                           backend_gfx_pipeline_manager_ptr    = m_backend_ptr->get_gfx_pipeline_manager_ptr();
-    const OpenGL::GLContextStateBindingReferences* node_context_state_binding_refs_ptr = nullptr;
-    const OpenGL::ContextState*                    node_context_state_ptr              = nullptr;
-    Anvil::PipelineID                              result_id                           = UINT32_MAX;
-
-    vkgl_assert(m_active_graph_node_ptr != nullptr);
-
-    m_active_graph_node_ptr->get_gl_context_state(&node_context_state_ptr,
-                                                  &node_context_state_binding_refs_ptr);
-
-    vkgl_assert(node_context_state_binding_refs_ptr != nullptr);
-    vkgl_assert(node_context_state_ptr              != nullptr);
-
-    result_id = backend_gfx_pipeline_manager_ptr->get_pipeline_id(node_context_state_ptr,
-                                                                  node_context_state_binding_refs_ptr,
-                                                                  OpenGL::VKUtils::get_anvil_primitive_topology_for_draw_call_mode(in_draw_call_mode),
-                                                                  m_active_group_node_ptr->renderpass_ptr,
-                                                                  m_active_subpass_id);
 
-end:
-    vkgl_assert(result_id != UINT32_MAX);
-    return result_id;
+    return m_last_submitted_timeline_value + 1;
 }
 
-Anvil::Semaphore* OpenGL::VKFrameGraph::get_swapchain_image_acquired_sem() const
+uint32_t OpenGL::VKFrameGraph::get_n_group_nodes_for_node_sequence(const std::vector<VKFrameGraphNodeUniquePtr>& in_node_ptrs) const
 {
     FUN_ENTRY(DEBUG_DEPTH);
-    
-    vkgl_assert(m_swapchain_acquire_sem_ptr != nullptr);
 
-    return m_swapchain_acquire_sem_ptr;
-}
+    /* NOTE: This follows the rules coalesce_to_group_nodes() uses to decide when a new group node needs to be spawned. */
+    bool                   group_node_is_empty     = true;
+    Anvil::QueueFamilyType group_node_queue_family = Anvil::QueueFamilyType::UNDEFINED;
+    bool                   group_node_uses_rp      = false;
+    bool                   is_group_node_in_flight = false;
+    uint32_t               result                  = 0;
 
-bool OpenGL::VKFrameGraph::get_wait_sems(uint32_t*                         out_n_wait_sems_ptr,
-                                         Anvil::Semaphore***               out_wait_sems_ptr_ptr_ptr,
-                                         const Anvil::PipelineStageFlags** out_wait_sem_stage_masks_ptr)
-{
-    FUN_ENTRY(DEBUG_DEPTH);
-    
-    const uint32_t n_wait_sems = static_cast<uint32_t>(m_wait_sem_vec_for_current_cpu_node.size() );
+    for (const auto& current_node_ptr : in_node_ptrs)
+    {
+        const auto rp_support_scope = (current_node_ptr->requires_gpu_side_execution() ) ? current_node_ptr->get_renderpass_support_scope()
+                                                                                         : OpenGL::RenderpassSupportScope::Not_Supported;
 
-    *out_n_wait_sems_ptr          = n_wait_sems;
-    *out_wait_sems_ptr_ptr_ptr    = (n_wait_sems > 0) ? &m_wait_sem_vec_for_current_cpu_node.at        (0) : nullptr;
-    *out_wait_sem_stage_masks_ptr = (n_wait_sems > 0) ? &m_wait_sem_stage_masks_for_current_cpu_node.at(0) : nullptr;
+        if (current_node_ptr->requires_manual_wait_sem_sync() )
+        {
+            is_group_node_in_flight = false;
 
-    return true;
-}
+            ++result;
+            continue;
+        }
 
-bool OpenGL::VKFrameGraph::init()
-{
-    FUN_ENTRY(DEBUG_DEPTH);
-    
-    bool result = false;
+        if (!is_group_node_in_flight)
+        {
+            group_node_is_empty     = true;
+            group_node_queue_family = Anvil::QueueFamilyType::UNDEFINED;
+            group_node_uses_rp      = false;
+            is_group_node_in_flight = true;
 
-    if (!init_swapchain_data() )
-    {
-        vkgl_assert_fail();
+            ++result;
+        }
 
-        goto end;
-    }
+        {
+            const auto required_queue_family = get_node_queue_family_type(current_node_ptr.get(),
+                                                                          nullptr); /* out_opt_supports_dma_queues_ptr */
 
-    if (!init_queue_rings() )
-    {
-        vkgl_assert_fail();
+            if (group_node_queue_family == Anvil::QueueFamilyType::UNDEFINED)
+            {
+                if (rp_support_scope == OpenGL::RenderpassSupportScope::Required &&
+                    !group_node_is_empty)
+                {
+                    ++result;
+                }
+
+                group_node_queue_family = required_queue_family;
+                group_node_uses_rp      = (rp_support_scope == OpenGL::RenderpassSupportScope::Required);
+            }
+            else
+            {
+                const bool rp_support_mismatch = (( group_node_uses_rp && rp_support_scope == OpenGL::RenderpassSupportScope::Not_Supported) ||
+                                                  (!group_node_uses_rp && rp_support_scope != OpenGL::RenderpassSupportScope::Not_Supported) );
+
+                if (group_node_queue_family != required_queue_family ||
+                    rp_support_mismatch)
+                {
+                    group_node_queue_family = required_queue_family;
+                    group_node_uses_rp      = (rp_support_scope == OpenGL::RenderpassSupportScope::Required);
+
+                    ++result;
+                }
+            }
+        }
+
+        group_node_is_empty = false;
+    }
+
+    return result;
+}
+
+Anvil::QueueFamilyType OpenGL::VKFrameGraph::get_node_queue_family_type(const OpenGL::IVKFrameGraphNode* in_node_ptr,
+                                                                        bool*                            out_opt_supports_dma_queues_ptr) const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    auto                              device_ptr                     = m_backend_ptr->get_device_ptr();
+    const auto                        device_supports_compute_queues = device_ptr->get_n_compute_queues () > 0;
+    const auto                        device_supports_dma_queues     = device_ptr->get_n_transfer_queues() > 0;
+    const Anvil::QueueFamilyFlagBits* node_accepted_queue_fams_ptr   = nullptr;
+    uint32_t                          node_n_accepted_queue_fams     = 0;
+    bool                              node_supports_compute_queues   = false;
+    bool                              node_supports_dma_queues       = false;
+    bool                              node_supports_universal_queues = false;
+
+    if (in_node_ptr->requires_gpu_side_execution() )
+    {
+        in_node_ptr->get_supported_queue_families(&node_n_accepted_queue_fams,
+                                                  &node_accepted_queue_fams_ptr);
+
+        vkgl_assert(node_n_accepted_queue_fams   != 0);
+        vkgl_assert(node_accepted_queue_fams_ptr != nullptr);
+    }
+
+    for (uint32_t n_queue_fam = 0;
+                  n_queue_fam < node_n_accepted_queue_fams;
+                ++n_queue_fam)
+    {
+        switch (node_accepted_queue_fams_ptr[n_queue_fam])
+        {
+            case Anvil::QueueFamilyFlagBits::COMPUTE_BIT:  node_supports_compute_queues   = true; break;
+            case Anvil::QueueFamilyFlagBits::DMA_BIT:      node_supports_dma_queues       = true; break;
+            case Anvil::QueueFamilyFlagBits::GRAPHICS_BIT: node_supports_universal_queues = true; break;
+
+            default:
+            {
+                vkgl_assert_fail();
+            }
+        }
+    }
+
+    if (out_opt_supports_dma_queues_ptr != nullptr)
+    {
+        *out_opt_supports_dma_queues_ptr = node_supports_dma_queues;
+    }
+
+    /* For now, follow the following heuristics:
+     *
+     * 1. If a node AND HW supports DMA queue, make sure to offload the operations there.
+     * 2. If a node AND HW supports compute queue, make sure to use it.
+     * 3. Otherwise, use universal queue.
+     *
+     * In specific, ignore the preferred order reported by nodes. At least for now.
+     */
+    return (node_supports_dma_queues       && device_supports_dma_queues)     ? Anvil::QueueFamilyType::TRANSFER
+         : (node_supports_compute_queues   && device_supports_compute_queues) ? Anvil::QueueFamilyType::COMPUTE
+         : (node_supports_universal_queues)                                   ? Anvil::QueueFamilyType::UNIVERSAL
+                                                                              : Anvil::QueueFamilyType::UNDEFINED;
+}
+
+Anvil::PipelineID OpenGL::VKFrameGraph::get_pipeline_id(const OpenGL::DrawCallMode& in_draw_call_mode)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    auto                                           backend_gfx_pipeline_manager_ptr    = m_backend_ptr->get_gfx_pipeline_manager_ptr();
+    const OpenGL::GLContextStateBindingReferences* node_context_state_binding_refs_ptr = nullptr;
+    const OpenGL::ContextState*                    node_context_state_ptr              = nullptr;
+    Anvil::PipelineID                              result_id                           = UINT32_MAX;
+
+    vkgl_assert(m_active_graph_node_ptr != nullptr);
+
+    m_active_graph_node_ptr->get_gl_context_state(&node_context_state_ptr,
+                                                  &node_context_state_binding_refs_ptr);
+
+    vkgl_assert(node_context_state_binding_refs_ptr != nullptr);
+    vkgl_assert(node_context_state_ptr              != nullptr);
+
+    result_id = backend_gfx_pipeline_manager_ptr->get_pipeline_id(node_context_state_ptr,
+                                                                  node_context_state_binding_refs_ptr,
+                                                                  OpenGL::VKUtils::get_anvil_primitive_topology_for_draw_call_mode(in_draw_call_mode),
+                                                                  m_active_group_node_ptr->renderpass_ptr,
+                                                                  m_active_subpass_id,
+                                                                  get_execution_timeline_value() );
+
+end:
+    vkgl_assert(result_id != UINT32_MAX);
+    return result_id;
+}
+
+VkRect2D OpenGL::VKFrameGraph::get_render_area() const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    VkRect2D result;
+
+    vkgl_assert(m_active_group_node_ptr                  != nullptr);
+    vkgl_assert(m_active_group_node_ptr->uses_renderpass);
+
+    /* NOTE: Needs to be kept in sync with record_command_buffers() */
+    result.extent.height = m_active_group_node_ptr->framebuffer_size[1];
+    result.extent.width  = m_active_group_node_ptr->framebuffer_size[0];
+    result.offset.x      = 0;
+    result.offset.y      = 0;
+
+    return result;
+}
+
+Anvil::Semaphore* OpenGL::VKFrameGraph::get_swapchain_image_acquired_sem() const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    vkgl_assert(m_swapchain_acquire_sem_ptr != nullptr);
+
+    return m_swapchain_acquire_sem_ptr;
+}
+
+bool OpenGL::VKFrameGraph::get_wait_sems(uint32_t*                         out_n_wait_sems_ptr,
+                                         Anvil::Semaphore***               out_wait_sems_ptr_ptr_ptr,
+                                         const Anvil::PipelineStageFlags** out_wait_sem_stage_masks_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    const uint32_t n_wait_sems = static_cast<uint32_t>(m_wait_sem_vec_for_current_cpu_node.size() );
+
+    *out_n_wait_sems_ptr          = n_wait_sems;
+    *out_wait_sems_ptr_ptr_ptr    = (n_wait_sems > 0) ? &m_wait_sem_vec_for_current_cpu_node.at        (0) : nullptr;
+    *out_wait_sem_stage_masks_ptr = (n_wait_sems > 0) ? &m_wait_sem_stage_masks_for_current_cpu_node.at(0) : nullptr;
+
+    return true;
+}
+
+bool OpenGL::VKFrameGraph::init()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    bool result = false;
+
+    if (!init_swapchain_data() )
+    {
+        vkgl_assert_fail();
+
+        goto end;
+    }
+
+    if (!init_queue_rings() )
+    {
+        vkgl_assert_fail();
+
+        goto end;
+    }
+
+    if (!init_retire_thread() )
+    {
+        vkgl_assert_fail();
 
         goto end;
     }
@@ -2442,6 +3366,8 @@ bool OpenGL::VKFrameGraph::init_queue_rings()
     auto device_ptr = m_backend_ptr->get_device_ptr();
     bool result     = false;
 
+    m_timestamp_period_ns = device_ptr->get_physical_device_properties().core_vk1_0_properties_ptr->limits.timestamp_period;
+
     for (auto current_queue_family_type = Anvil::QueueFamilyType::FIRST;
               current_queue_family_type < Anvil::QueueFamilyType::COUNT;
               current_queue_family_type = static_cast<Anvil::QueueFamilyType>(static_cast<uint32_t>(current_queue_family_type) + 1))
@@ -2465,6 +3391,38 @@ bool OpenGL::VKFrameGraph::init_queue_rings()
             vkgl_assert(queue_raw_ptr != nullptr);
 
             queue_vec.at(n_current_queue_fam_queue) = queue_raw_ptr;
+
+            /* Each queue gets its own GPU track in traces. Timestamp queries need to be reset prior to being written, which
+             * transfer-only queues cannot do.
+             */
+            {
+                const auto      n_timestamp_bits = device_ptr->get_queue_family_info(queue_raw_ptr->get_queue_family_index() )->n_timestamp_bits;
+                QueueTraceInfo  queue_trace_info;
+                std::string     queue_name;
+
+                switch (current_queue_family_type)
+                {
+                    case Anvil::QueueFamilyType::COMPUTE:   queue_name = "Compute queue ";   break;
+                    case Anvil::QueueFamilyType::TRANSFER:  queue_name = "Transfer queue ";  break;
+                    case Anvil::QueueFamilyType::UNIVERSAL: queue_name = "Universal queue "; break;
+
+                    default:
+                    {
+                        vkgl_assert_fail();
+                    }
+                }
+
+                queue_trace_info.gpu_track_id = VKGL::TraceRecorder::create_gpu_track(queue_name + std::to_string(n_current_queue_fam_queue) );
+
+                if (current_queue_family_type != Anvil::QueueFamilyType::TRANSFER &&
+                    n_timestamp_bits          >  0)
+                {
+                    queue_trace_info.timestamp_valid_mask = (n_timestamp_bits >= 64) ? UINT64_MAX
+                                                                                     : ((1ull << n_timestamp_bits) - 1);
+                }
+
+                m_queue_trace_info[queue_raw_ptr] = queue_trace_info;
+            }
         }
 
         queue_ring_ptr.reset(new QueueRing(n_current_queue_fam_queues,
@@ -2485,6 +3443,31 @@ end:
     return result;
 }
 
+bool OpenGL::VKFrameGraph::init_retire_thread()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    bool result = false;
+
+    m_retire_thread_ptr.reset(
+        new std::thread(
+            std::bind(&OpenGL::VKFrameGraph::retire_thread_entrypoint,
+                      this)
+        )
+    );
+
+    if (m_retire_thread_ptr == nullptr)
+    {
+        vkgl_assert(m_retire_thread_ptr != nullptr);
+
+        goto end;
+    }
+
+    result = true;
+end:
+    return result;
+}
+
 bool OpenGL::VKFrameGraph::init_swapchain_data()
 {
     FUN_ENTRY(DEBUG_DEPTH);
@@ -2507,6 +3490,7 @@ end:
 bool OpenGL::VKFrameGraph::inject_swapchain_acquire_nodes(std::vector<VKFrameGraphNodeUniquePtr>& inout_node_ptrs)
 {
     FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE("Frame graph: inject acquire nodes");
     
     bool     is_swapchain_image_acquired = (m_acquired_swapchain_image_index != UINT32_MAX);
     uint32_t n_nodes                     = static_cast<uint32_t>(inout_node_ptrs.size() );
@@ -2597,6 +3581,13 @@ void OpenGL::VKFrameGraph::on_image_deleted(Anvil::Image* in_image_ptr)
     vkgl_not_implemented();
 }
 
+void OpenGL::VKFrameGraph::on_present_cpu_wait(const std::chrono::microseconds& in_wait_time)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    m_cpu_wait_time_us += in_wait_time.count();
+}
+
 void OpenGL::VKFrameGraph::on_swapchain_recreated()
 {
     FUN_ENTRY(DEBUG_DEPTH);
@@ -2607,6 +3598,176 @@ void OpenGL::VKFrameGraph::on_swapchain_recreated()
     }
 }
 
+bool OpenGL::VKFrameGraph::optimize_barriers(const std::vector<GroupNodeUniquePtr>& in_group_nodes_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE("Frame graph: optimize barriers");
+
+    bool result = false;
+
+    for (const auto& current_group_node_ptr : in_group_nodes_ptr)
+    {
+        auto&          intra_barriers = current_group_node_ptr->intra_graph_node_pre_barriers;
+        const uint32_t n_graph_nodes  = static_cast<uint32_t>(current_group_node_ptr->graph_node_ptrs.size() );
+
+        vkgl_assert(intra_barriers.size() == n_graph_nodes);
+
+        /* 1. Drop no-op barriers and merge the remaining ones wherever possible. */
+        drop_and_merge_barriers(&current_group_node_ptr->group_node_post_barriers);
+        drop_and_merge_barriers(&current_group_node_ptr->group_node_pre_barriers);
+
+        for (auto& current_barrier_data : intra_barriers)
+        {
+            drop_and_merge_barriers(&current_barrier_data);
+        }
+
+        /* 2. vkCmdSetEvent() and vkCmdWaitEvents() cannot be used within renderpasses, nor can they be recorded for transfer-only queues.
+         *    Intra-graph node barriers of such group nodes are left where they are.
+         */
+        if (current_group_node_ptr->uses_renderpass                                    ||
+            current_group_node_ptr->queue_ptr    == nullptr                            ||
+           (current_group_node_ptr->queue_family != Anvil::QueueFamilyType::UNIVERSAL &&
+            current_group_node_ptr->queue_family != Anvil::QueueFamilyType::COMPUTE) )
+        {
+            continue;
+        }
+
+        /* 3. A barrier for graph node N, whose producers finished executing by graph node M < (N - 1), does not need to be recorded right before N:
+         *
+         *    a) If a barrier is already recorded for one of the nodes in (M, N), and its stage masks are a superset of what N needs, the barriers
+         *       can be hoisted there. This does not introduce any extra stalls, and saves one vkCmdPipelineBarrier() call. Layout transitions
+         *       happen earlier as a side effect.
+         *    b) Otherwise, the dependency is turned into a split barrier: an event is set right after M, and N waits on it. Nodes in-between
+         *       are free to overlap with M.
+         *
+         *    Hoisting is only safe if none of the nodes in-between touches resources the barriers refer to.
+         */
+        for (uint32_t n_graph_node = 2;
+                      n_graph_node < n_graph_nodes;
+                    ++n_graph_node)
+        {
+            auto&          current_barrier_data    = intra_barriers.at(n_graph_node);
+            const uint32_t n_latest_src_graph_node = current_barrier_data.n_latest_src_graph_node;
+            bool           has_been_hoisted        = false;
+
+            if (current_barrier_data.is_empty()                    ||
+                n_latest_src_graph_node     == UINT32_MAX          ||
+                n_latest_src_graph_node + 1 >= n_graph_node)
+            {
+                continue;
+            }
+
+            for (uint32_t n_candidate_graph_node = n_graph_node - 1;
+                          n_candidate_graph_node > n_latest_src_graph_node;
+                        --n_candidate_graph_node)
+            {
+                auto&      candidate_barrier_data = intra_barriers.at(n_candidate_graph_node);
+                const bool covers_dst_stages      = ((candidate_barrier_data.dst_pipeline_stages & current_barrier_data.dst_pipeline_stages) == current_barrier_data.dst_pipeline_stages);
+                const bool covers_src_stages      = ((candidate_barrier_data.src_pipeline_stages & current_barrier_data.src_pipeline_stages) == current_barrier_data.src_pipeline_stages);
+
+                if (does_graph_node_touch_barrier_resources(current_group_node_ptr->graph_node_ptrs.at(n_candidate_graph_node),
+                                                            current_barrier_data) )
+                {
+                    break;
+                }
+
+                if (candidate_barrier_data.is_empty()                 ||
+                    candidate_barrier_data.wait_event_ptr != nullptr  ||
+                   !covers_dst_stages                                 ||
+                   !covers_src_stages)
+                {
+                    continue;
+                }
+
+                for (const auto& current_buffer_barrier : current_barrier_data.buffer_barriers)
+                {
+                    candidate_barrier_data.buffer_barriers.push_back(current_buffer_barrier);
+                }
+
+                for (const auto& current_image_barrier : current_barrier_data.image_barriers)
+                {
+                    candidate_barrier_data.image_barriers.push_back(current_image_barrier);
+                }
+
+                current_barrier_data = BarrierData();
+
+                drop_and_merge_barriers(&candidate_barrier_data);
+
+                m_frame_stats.n_barriers_hoisted++;
+
+                has_been_hoisted = true;
+                break;
+            }
+
+            if (has_been_hoisted)
+            {
+                continue;
+            }
+
+            /* b) */
+            if (current_group_node_ptr->intra_graph_node_post_event_ptrs.size() == 0)
+            {
+                current_group_node_ptr->intra_graph_node_post_event_ptrs.resize  (n_graph_nodes);
+                current_group_node_ptr->intra_graph_node_post_event_stages.resize(n_graph_nodes,
+                                                                                  Anvil::PipelineStageFlagBits::NONE);
+            }
+
+            {
+                auto& event_ptr = current_group_node_ptr->intra_graph_node_post_event_ptrs.at(n_latest_src_graph_node);
+
+                if (event_ptr == nullptr)
+                {
+                    event_ptr = m_backend_ptr->get_sync_object_pool_ptr()->acquire_event();
+
+                    if (event_ptr == nullptr)
+                    {
+                        vkgl_assert(event_ptr != nullptr);
+
+                        goto end;
+                    }
+                }
+
+                current_group_node_ptr->intra_graph_node_post_event_stages.at(n_latest_src_graph_node) |= current_barrier_data.src_pipeline_stages;
+                current_barrier_data.wait_event_ptr                                                     = event_ptr.get();
+            }
+        }
+
+        /* 4. vkCmdWaitEvents() requires the src stage mask to match the mask the event was set with. An event may be shared by a number of
+         *    consumers, so this can only be determined once all split barriers have been formed.
+         */
+        if (current_group_node_ptr->intra_graph_node_post_event_ptrs.size() > 0)
+        {
+            for (auto& current_barrier_data : intra_barriers)
+            {
+                if (current_barrier_data.wait_event_ptr != nullptr)
+                {
+                    current_barrier_data.src_pipeline_stages = current_group_node_ptr->intra_graph_node_post_event_stages.at(current_barrier_data.n_latest_src_graph_node);
+                }
+            }
+        }
+    }
+
+    result = true;
+end:
+    return result;
+}
+
+OpenGL::VKFrameGraphStats OpenGL::VKFrameGraph::pop_frame_stats()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::lock_guard<std::mutex> execute_lock(m_execute_mutex);
+    OpenGL::VKFrameGraphStats   result      (m_frame_stats);
+
+    m_frame_stats = OpenGL::VKFrameGraphStats();
+
+    result.cpu_wait_time_us       = static_cast<uint32_t>(m_cpu_wait_time_us.exchange(0) );
+    result.gpu_idle_time_us       = static_cast<uint32_t>(m_gpu_idle_time_us.exchange(0) );
+    result.n_executions_in_flight = static_cast<uint32_t>(m_last_submitted_timeline_value - m_completed_timeline_value.load() );
+
+    return result;
+}
+
 void OpenGL::VKFrameGraph::process_buffer_node_input(std::vector<Anvil::BufferBarrier>&                inout_pre_buffer_barriers,
                                                      std::vector<std::vector<Anvil::BufferBarrier>* >& inout_post_buffer_barrier_ptrs,
                                                      const NodeIO*                                     in_input_ptr,
@@ -2616,59 +3777,141 @@ void OpenGL::VKFrameGraph::process_buffer_node_input(std::vector<Anvil::BufferBa
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    auto buffer_ptr = in_input_ptr->buffer_reference_ptr->get_payload().buffer_ptr;
-
-    if (m_buffer_data.find(buffer_ptr) == m_buffer_data.end() )
+    typedef struct OwnershipRun
+    {
+        VkDeviceSize start_offset;
+        VkDeviceSize end_offset;
+        uint32_t     src_queue_family_index;
+    } OwnershipRun;
+
+    const auto&               buffer_payload         = in_input_ptr->buffer_reference_ptr->get_payload();
+    auto&                     range_map              = m_buffer_data[buffer_payload.buffer_ptr];
+    const auto                dst_queue_family_index = in_opt_queue_ptr->get_queue_family_index();
+    auto                      src_access_mask        = in_access_mask;
+    const auto                dst_access_mask        = in_input_ptr->buffer_props.access;
+    VkDeviceSize              range_end_offset       = 0;
+    VkDeviceSize              range_start_offset     = 0;
+    std::vector<OwnershipRun> runs;
+
+    /* 1. IO ranges are relative to the GL buffer's storage. Move them to VK buffer space, clamping to the region which holds the storage.
+     *    IOs which do not specify a meaningful range are assumed to touch the whole region.
+     */
     {
-        m_buffer_data[buffer_ptr] = BufferInfo();
+        const auto&        buffer_props      = in_input_ptr->buffer_props;
+        const VkDeviceSize region_end_offset = buffer_payload.buffer_offset + buffer_payload.buffer_size;
+
+        range_start_offset = buffer_payload.buffer_offset + std::min(buffer_props.start_offset,
+                                                                     buffer_payload.buffer_size);
+        range_end_offset   = (buffer_props.size == VK_WHOLE_SIZE                         ||
+                              buffer_props.size >  region_end_offset - range_start_offset) ? region_end_offset
+                                                                                           : range_start_offset + buffer_props.size;
+
+        if (range_end_offset <= range_start_offset)
+        {
+            range_start_offset = buffer_payload.buffer_offset;
+            range_end_offset   = region_end_offset;
+        }
     }
 
-    auto& current_buffer_props = m_buffer_data.at(buffer_ptr);
+    if (src_access_mask == Anvil::AccessFlagBits::NONE)
+    {
+        src_access_mask            = dst_access_mask;
+        inout_src_pipeline_stages |= in_input_ptr->buffer_props.pipeline_stages;
+    }
 
+    /* 2. Walk over tracked intervals overlapping the range. Consecutive bytes last owned by the same queue family form a single run,
+     *    and each run gets a single barrier. In the common case, this boils down to one barrier covering exactly the touched range.
+     */
     {
-        const auto dst_queue_family_index = in_opt_queue_ptr->get_queue_family_index();
-        const auto src_queue_family_index = (current_buffer_props.owning_queue_family_index == UINT32_MAX) ? dst_queue_family_index
-                                                                                                           : current_buffer_props.owning_queue_family_index;
-        auto       src_access_mask        = in_access_mask;
-        const auto dst_access_mask        = in_input_ptr->buffer_props.access;
+        VkDeviceSize current_offset = range_start_offset;
+        auto         range_iterator = range_map.upper_bound(range_start_offset);
 
-        if (src_access_mask == Anvil::AccessFlagBits::NONE)
+        if (range_iterator != range_map.begin() )
         {
-            src_access_mask            = dst_access_mask;
-            inout_src_pipeline_stages |= in_input_ptr->buffer_props.pipeline_stages;
+            auto prev_range_iterator = std::prev(range_iterator);
+
+            if (prev_range_iterator->second.end_offset > range_start_offset)
+            {
+                range_iterator = prev_range_iterator;
+            }
         }
 
-        /* Cache the buffer memory barrier. Also cache release barriers in cases where src queue family index != dst queue family index */
+        while (current_offset < range_end_offset)
         {
-            auto buffer_barrier = Anvil::BufferBarrier(src_access_mask,
-                                                       dst_access_mask,
-                                                       src_queue_family_index,
-                                                       dst_queue_family_index,
-                                                       buffer_ptr,
-                                                       0, /* in_offset */
-                                                       VK_WHOLE_SIZE);
-
-            inout_pre_buffer_barriers.push_back(buffer_barrier);
+            VkDeviceSize run_end_offset         = range_end_offset;
+            uint32_t     src_queue_family_index = dst_queue_family_index;
 
-            if (src_queue_family_index != dst_queue_family_index)
+            if (range_iterator        != range_map.end() &&
+                range_iterator->first <  range_end_offset)
             {
-                /* For release barriers, access masks should be zeroed out */
-                buffer_barrier.dst_access_mask = Anvil::AccessFlagBits::NONE;
-                buffer_barrier.src_access_mask = Anvil::AccessFlagBits::NONE;
-
-                for (auto& current_post_barrier_vec_ptr : inout_post_buffer_barrier_ptrs)
+                if (range_iterator->first > current_offset)
+                {
+                    /* Bytes in-between have never been accessed. */
+                    run_end_offset = range_iterator->first;
+                }
+                else
                 {
-                    current_post_barrier_vec_ptr->push_back(buffer_barrier);
+                    run_end_offset = std::min(range_iterator->second.end_offset,
+                                              range_end_offset);
+
+                    if (range_iterator->second.owning_queue_family_index != UINT32_MAX)
+                    {
+                        src_queue_family_index = range_iterator->second.owning_queue_family_index;
+                    }
+
+                    ++range_iterator;
                 }
             }
+
+            if (runs.size()                        >  0              &&
+                runs.back().end_offset             == current_offset &&
+                runs.back().src_queue_family_index == src_queue_family_index)
+            {
+                runs.back().end_offset = run_end_offset;
+            }
+            else
+            {
+                runs.push_back({current_offset, run_end_offset, src_queue_family_index});
+            }
+
+            current_offset = run_end_offset;
         }
+    }
+
+    /* 3. Cache the buffer memory barriers. Also cache release barriers in cases where src queue family index != dst queue family index */
+    for (const auto& current_run : runs)
+    {
+        auto buffer_barrier = Anvil::BufferBarrier(src_access_mask,
+                                                   dst_access_mask,
+                                                   current_run.src_queue_family_index,
+                                                   dst_queue_family_index,
+                                                   buffer_payload.buffer_ptr,
+                                                   current_run.start_offset,
+                                                   current_run.end_offset - current_run.start_offset);
+
+        inout_pre_buffer_barriers.push_back(buffer_barrier);
 
-        /* Update local swapchain image state */
-        if (in_opt_queue_ptr != nullptr)
+        if (current_run.src_queue_family_index != dst_queue_family_index)
         {
-            current_buffer_props.owning_queue_family_index = in_opt_queue_ptr->get_queue_family_index();
+            /* For release barriers, access masks should be zeroed out */
+            buffer_barrier.dst_access_mask = Anvil::AccessFlagBits::NONE;
+            buffer_barrier.src_access_mask = Anvil::AccessFlagBits::NONE;
+
+            for (auto& current_post_barrier_vec_ptr : inout_post_buffer_barrier_ptrs)
+            {
+                current_post_barrier_vec_ptr->push_back(buffer_barrier);
+            }
         }
     }
+
+    /* 4. Update local buffer state */
+    if (in_opt_queue_ptr != nullptr)
+    {
+        set_buffer_range_owner(range_map,
+                               range_start_offset,
+                               range_end_offset,
+                               dst_queue_family_index);
+    }
 }
 
 void OpenGL::VKFrameGraph::process_image_node_input(std::vector<Anvil::ImageBarrier>& inout_image_barriers,
@@ -2683,93 +3926,183 @@ void OpenGL::VKFrameGraph::process_image_node_input(std::vector<Anvil::ImageBarr
     /* TODO: In case of renderpass group nodes, layout transitions incurred by barriers generated by this function should actually be moved over
      *       to renderpasses.
      */
-    auto image_ptr = in_input_ptr->image_reference_ptr->get_payload().image_ptr;
-
-    if (m_image_data.find(image_ptr) == m_image_data.end() )
+    typedef struct TransitionRun
+    {
+        uint32_t           base_mip;
+        uint32_t           n_mips;
+        uint32_t           base_layer;
+        uint32_t           n_layers;
+        Anvil::ImageLayout old_layout;
+        uint32_t           src_queue_family_index;
+        uint32_t           dst_queue_family_index;
+    } TransitionRun;
+
+    auto                       image_ptr         = in_input_ptr->image_reference_ptr->get_payload().image_ptr;
+    auto&                      image_state       = m_image_data[image_ptr];
+    const auto&                subresource_range = in_input_ptr->image_props.subresource_range;
+    const Anvil::ImageLayout   dst_image_layout  = in_input_ptr->image_props.image_layout;
+    std::vector<TransitionRun> runs;
+
+    if ((((in_input_ptr->image_props.aspects_touched & Anvil::ImageAspectFlagBits::COLOR_BIT)   == 0)  &&
+         ((in_input_ptr->image_props.aspects_touched & Anvil::ImageAspectFlagBits::DEPTH_BIT)   == 0)  &&
+         ((in_input_ptr->image_props.aspects_touched & Anvil::ImageAspectFlagBits::STENCIL_BIT) == 0)) ||
+         (image_ptr == nullptr) )
     {
-        m_image_data[image_ptr] = ImageInfo();
+        vkgl_assert(image_ptr != nullptr);
+        vkgl_assert_fail();
+
+        goto end;
     }
 
-    auto& current_image_props = m_image_data.at(image_ptr);
+    vkgl_assert(subresource_range.aspect_mask == in_input_ptr->image_props.aspects_touched);
+    vkgl_assert(((subresource_range.aspect_mask & Anvil::ImageAspectFlagBits::COLOR_BIT) != 0) == image_ptr->has_aspects(Anvil::ImageAspectFlagBits::COLOR_BIT) );
+    vkgl_assert(((subresource_range.aspect_mask & Anvil::ImageAspectFlagBits::DEPTH_BIT) != 0) == image_ptr->has_aspects(Anvil::ImageAspectFlagBits::DEPTH_BIT) 	||
+                ((subresource_range.aspect_mask & Anvil::ImageAspectFlagBits::STENCIL_BIT) != 0) == image_ptr->has_aspects(Anvil::ImageAspectFlagBits::STENCIL_BIT) );
 
-    Anvil::ImageLayout src_image_layout = current_image_props.aspect_layout;
-    Anvil::ImageLayout dst_image_layout = in_input_ptr->image_props.image_layout;
+    /* 1. State is tracked per (mip, layer). Lazily set up storage the first time the image is seen. */
+    if (image_state.n_mips == 0)
+    {
+        image_state.n_layers = image_ptr->get_create_info_ptr()->get_n_layers();
+        image_state.n_mips   = image_ptr->get_n_mipmaps                     ();
 
-    bool       image_layouts_match     = dst_image_layout == src_image_layout;
-    const bool queue_fams_match              = (in_opt_queue_ptr != nullptr) ? (in_opt_queue_ptr->get_queue_family_index() == current_image_props.owning_queue_family_index)
-                                                                             : true; //< presentation engine does not require ownership transfer prior to presenting.
+        image_state.subresources.resize(image_state.n_layers * image_state.n_mips);
+    }
 
-    if (!image_layouts_match ||
-        !queue_fams_match)
+    /* 2. Find subresources which need a layout transition and/or an ownership transfer. Subresources of the same mip, which are
+     *    adjacent and share the same state, are grouped into runs.
+     */
     {
-        /* NOTE: current_image_props.owning_queue_family_index may be UINT32_MAX if the swapchain image has never been used. In this case, we acquire ownership
-         *       of the image by specifying the same dst & src queue fam in the image barrier.
-         */
-        const auto dst_queue_family_index = (queue_fams_match) ? VK_QUEUE_FAMILY_IGNORED
-                                                               : in_opt_queue_ptr->get_queue_family_index();
-        const auto src_queue_family_index = (queue_fams_match) ? VK_QUEUE_FAMILY_IGNORED
-                                                               : (current_image_props.owning_queue_family_index == UINT32_MAX) ? dst_queue_family_index
-                                                                                                                                         : current_image_props.owning_queue_family_index;
-
-        if ((((in_input_ptr->image_props.aspects_touched & Anvil::ImageAspectFlagBits::COLOR_BIT)   != 0)  ||
-             ((in_input_ptr->image_props.aspects_touched & Anvil::ImageAspectFlagBits::DEPTH_BIT)   != 0)  ||
-             ((in_input_ptr->image_props.aspects_touched & Anvil::ImageAspectFlagBits::STENCIL_BIT) != 0)) )
+        const uint32_t first_layer = std::min(subresource_range.base_array_layer, image_state.n_layers);
+        const uint32_t first_mip   = std::min(subresource_range.base_mip_level,   image_state.n_mips);
+        const uint32_t last_layer  = (subresource_range.layer_count == VK_REMAINING_ARRAY_LAYERS) ? image_state.n_layers
+                                                                                                  : std::min(first_layer + subresource_range.layer_count, image_state.n_layers);
+        const uint32_t last_mip    = (subresource_range.level_count == VK_REMAINING_MIP_LEVELS)   ? image_state.n_mips
+                                                                                                  : std::min(first_mip + subresource_range.level_count, image_state.n_mips);
+
+        for (uint32_t n_mip = first_mip;
+                      n_mip < last_mip;
+                    ++n_mip)
         {
-            const bool layouts_match      = image_layouts_match;
-
-            if ((image_ptr != nullptr) &&
-                (!layouts_match        ||
-                 !queue_fams_match) )
+            for (uint32_t n_layer = first_layer;
+                          n_layer < last_layer;
+                        ++n_layer)
             {
-                const auto old_layout          = src_image_layout;
-                const auto new_layout          = dst_image_layout;
-                auto       src_access_mask     = in_access_masks;
-                const auto dst_access_mask     = in_input_ptr->image_props.access;
-                auto       subresource_range   = in_input_ptr->image_props.subresource_range;
-
-                vkgl_assert(subresource_range.aspect_mask == in_input_ptr->image_props.aspects_touched);
-                vkgl_assert(((subresource_range.aspect_mask & Anvil::ImageAspectFlagBits::COLOR_BIT) != 0) == image_ptr->has_aspects(Anvil::ImageAspectFlagBits::COLOR_BIT) );
-                vkgl_assert(((subresource_range.aspect_mask & Anvil::ImageAspectFlagBits::DEPTH_BIT) != 0) == image_ptr->has_aspects(Anvil::ImageAspectFlagBits::DEPTH_BIT) 	||
-                			((subresource_range.aspect_mask & Anvil::ImageAspectFlagBits::STENCIL_BIT) != 0) == image_ptr->has_aspects(Anvil::ImageAspectFlagBits::STENCIL_BIT) );
-
-                if (src_access_mask == Anvil::AccessFlagBits::NONE)
+                auto&      current_subresource_state = image_state.get(n_mip,
+                                                                       n_layer);
+                const bool image_layouts_match       = (dst_image_layout == current_subresource_state.aspect_layout);
+                const bool queue_fams_match          = (in_opt_queue_ptr != nullptr) ? (in_opt_queue_ptr->get_queue_family_index() == current_subresource_state.owning_queue_family_index)
+                                                                                     : true; //< presentation engine does not require ownership transfer prior to presenting.
+
+                if (image_layouts_match &&
+                    queue_fams_match)
                 {
-                    src_access_mask            = dst_access_mask;
-                    inout_src_pipeline_stages |= in_input_ptr->image_props.pipeline_stages;
+                    continue;
                 }
 
-                /* Cache the image memory barrier */
+                /* NOTE: owning_queue_family_index may be UINT32_MAX if the subresource has never been used. In this case, we acquire ownership
+                 *       of the subresource by specifying the same dst & src queue fam in the image barrier.
+                 */
                 {
-                    auto image_barrier = Anvil::ImageBarrier(src_access_mask,
-                                                             dst_access_mask,
-                                                             old_layout,
-                                                             new_layout,
-                                                             src_queue_family_index,
-                                                             dst_queue_family_index,
-                                                             image_ptr,
-                                                             subresource_range);
-
-                    inout_image_barriers.push_back(std::move(image_barrier) );
+                    const auto dst_queue_family_index = (queue_fams_match) ? VK_QUEUE_FAMILY_IGNORED
+                                                                           : in_opt_queue_ptr->get_queue_family_index();
+                    const auto src_queue_family_index = (queue_fams_match) ? VK_QUEUE_FAMILY_IGNORED
+                                                                           : (current_subresource_state.owning_queue_family_index == UINT32_MAX) ? dst_queue_family_index
+                                                                                                                                                 : current_subresource_state.owning_queue_family_index;
+
+                    if (runs.size()                        >  0                                        &&
+                        runs.back().base_mip               == n_mip                                    &&
+                        runs.back().base_layer             +  runs.back().n_layers == n_layer          &&
+                        runs.back().old_layout             == current_subresource_state.aspect_layout &&
+                        runs.back().src_queue_family_index == src_queue_family_index                   &&
+                        runs.back().dst_queue_family_index == dst_queue_family_index)
+                    {
+                        ++runs.back().n_layers;
+                    }
+                    else
+                    {
+                        runs.push_back({n_mip, 1, n_layer, 1, current_subresource_state.aspect_layout, src_queue_family_index, dst_queue_family_index});
+                    }
                 }
 
-                vkgl_assert(src_queue_family_index == dst_queue_family_index); //< todo: missing release barrier support.
-
-                /* Update local swapchain image state */
+                /* Update local image state */
                 if (in_opt_queue_ptr != nullptr)
                 {
-                    current_image_props.owning_queue_family_index = in_opt_queue_ptr->get_queue_family_index();
+                    current_subresource_state.owning_queue_family_index = in_opt_queue_ptr->get_queue_family_index();
                 }
 
-                {
-                    current_image_props.aspect_layout = new_layout;
-                }
+                current_subresource_state.aspect_layout = dst_image_layout;
             }
         }
-        else
+    }
+
+    /* 3. Runs covering the same layers of consecutive mips can share a barrier. */
+    if (runs.size() > 1)
+    {
+        uint32_t n_merged_runs = 0;
+
+        for (uint32_t n_run = 1;
+                      n_run < static_cast<uint32_t>(runs.size() );
+                    ++n_run)
         {
-        	vkgl_assert_fail();
+            auto&       merged_run  = runs.at(n_merged_runs);
+            const auto& current_run = runs.at(n_run);
+
+            if (merged_run.base_mip   + merged_run.n_mips == current_run.base_mip               &&
+                merged_run.base_layer                     == current_run.base_layer             &&
+                merged_run.n_layers                       == current_run.n_layers               &&
+                merged_run.old_layout                     == current_run.old_layout             &&
+                merged_run.src_queue_family_index         == current_run.src_queue_family_index &&
+                merged_run.dst_queue_family_index         == current_run.dst_queue_family_index)
+            {
+                ++merged_run.n_mips;
+            }
+            else
+            {
+                runs.at(++n_merged_runs) = current_run;
+            }
         }
+
+        runs.resize(n_merged_runs + 1);
     }
+
+    /* 4. Cache the image memory barriers */
+    if (runs.size() > 0)
+    {
+        auto       src_access_mask = in_access_masks;
+        const auto dst_access_mask = in_input_ptr->image_props.access;
+
+        if (src_access_mask == Anvil::AccessFlagBits::NONE)
+        {
+            src_access_mask            = dst_access_mask;
+            inout_src_pipeline_stages |= in_input_ptr->image_props.pipeline_stages;
+        }
+
+        for (const auto& current_run : runs)
+        {
+            auto run_subresource_range = subresource_range;
+
+            vkgl_assert(current_run.src_queue_family_index == current_run.dst_queue_family_index); //< todo: missing release barrier support.
+
+            run_subresource_range.base_array_layer = current_run.base_layer;
+            run_subresource_range.base_mip_level   = current_run.base_mip;
+            run_subresource_range.layer_count      = current_run.n_layers;
+            run_subresource_range.level_count      = current_run.n_mips;
+
+            inout_image_barriers.push_back(
+                Anvil::ImageBarrier(src_access_mask,
+                                    dst_access_mask,
+                                    current_run.old_layout,
+                                    dst_image_layout,
+                                    current_run.src_queue_family_index,
+                                    current_run.dst_queue_family_index,
+                                    image_ptr,
+                                    run_subresource_range)
+            );
+        }
+    }
+
+end:
+    ;
 }
 
 void OpenGL::VKFrameGraph::process_swapchain_image_node_input(std::vector<Anvil::ImageBarrier>& inout_image_barriers,
@@ -2892,30 +4225,57 @@ void OpenGL::VKFrameGraph::process_swapchain_image_node_input(std::vector<Anvil:
 
 bool OpenGL::VKFrameGraph::record_command_buffers(const std::vector<GroupNodeUniquePtr>&                                                            in_group_nodes_ptr,
                                                   const std::unordered_map<const GroupNode*, std::vector<GroupNodeToGroupNodeSquashedConnection> >& in_src_dst_group_node_connections,
+                                                  CommandPoolSlot*                                                                                  in_command_pool_slot_ptr,
                                                   std::vector<CommandBufferSubmissionUniquePtr>*                                                    out_cmd_buffer_submissions_ptr,
                                                   std::vector<Anvil::SemaphoreUniquePtr>&                                                           inout_sem_ptr_vec)
 {
     FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE("Frame graph: record");
     
-    auto const device_ptr = m_backend_ptr->get_device_ptr();
-    bool       result     = false;
+    bool              result                   = false;
+    Anvil::QueryPool* timestamp_query_pool_ptr = nullptr;
 
+    vkgl_assert(in_command_pool_slot_ptr               != nullptr);
     vkgl_assert(out_cmd_buffer_submissions_ptr         != nullptr);
     vkgl_assert(out_cmd_buffer_submissions_ptr->size() == 0);
 
+    /* Each group node gets a pair of timestamp queries when tracing. The slot is not in use by the GPU, so its query pool can
+     * be safely replaced if it turns out to be too small.
+     */
+    if (m_is_tracing_execution)
+    {
+        const uint32_t n_queries_needed = static_cast<uint32_t>(in_group_nodes_ptr.size() ) * 2;
+
+        vkgl_assert(in_command_pool_slot_ptr->timestamp_queries.size() == 0);
+
+        if (in_command_pool_slot_ptr->timestamp_query_pool_ptr                 == nullptr          ||
+            in_command_pool_slot_ptr->timestamp_query_pool_ptr->get_capacity() <  n_queries_needed)
+        {
+            in_command_pool_slot_ptr->timestamp_query_pool_ptr = Anvil::QueryPool::create_non_ps_query_pool(m_backend_ptr->get_device_ptr(),
+                                                                                                            VK_QUERY_TYPE_TIMESTAMP,
+                                                                                                            std::max(n_queries_needed,
+                                                                                                                     64u) );
+
+            vkgl_assert(in_command_pool_slot_ptr->timestamp_query_pool_ptr != nullptr);
+        }
+
+        timestamp_query_pool_ptr = in_command_pool_slot_ptr->timestamp_query_pool_ptr.get();
+    }
+
     for (uint32_t n_current_group_node = 0;
                   n_current_group_node < in_group_nodes_ptr.size();
                 ++n_current_group_node)
     {
-        /* TODO: Command buffer reuse. This means both caching cmd buffers in VKGL-level cmd buffer pool, as well as attempting to record
-         *       command buffers in a way which would allow for their reuse across frames.
+        /* TODO: Attempt to record command buffers in a way which would allow for their reuse across frames. Right now, we only
+         *       recycle the memory backing them (see alloc_command_buffer() ).
          **/
 
         /* TODO: Leverage secondary command buffer wherever feasible (ie. where chances of cross-frame reuse are substantial). */
-        Anvil::PrimaryCommandBufferUniquePtr cmd_buffer_ptr;
-        const auto&                          current_group_node_ptr = in_group_nodes_ptr.at(n_current_group_node);
-        CommandBufferSubmissionUniquePtr     current_submission_ptr = CommandBufferSubmissionUniquePtr(nullptr,
-                                                                                                       std::default_delete<CommandBufferSubmission>() );
+        Anvil::PrimaryCommandBuffer*     cmd_buffer_ptr         = nullptr;
+        const auto&                      current_group_node_ptr = in_group_nodes_ptr.at(n_current_group_node);
+        CommandBufferSubmissionUniquePtr current_submission_ptr = CommandBufferSubmissionUniquePtr(nullptr,
+                                                                                                   std::default_delete<CommandBufferSubmission>() );
+        uint32_t                         timestamp_query_index  = UINT32_MAX;
 
         m_active_group_node_ptr            = current_group_node_ptr.get();
         m_current_cmd_buffer_dynamic_state = CommandBufferDynamicState();
@@ -2934,10 +4294,15 @@ bool OpenGL::VKFrameGraph::record_command_buffers(const std::vector<GroupNodeUni
          */
         if (current_group_node_ptr->queue_family != Anvil::QueueFamilyType::UNDEFINED)
         {
-            auto cmd_pool_ptr = device_ptr->get_command_pool_for_queue_family_index(current_submission_ptr->parent_group_node_ptr->queue_ptr->get_queue_family_index() );
+            cmd_buffer_ptr = alloc_command_buffer(in_command_pool_slot_ptr,
+                                                  current_submission_ptr->parent_group_node_ptr->queue_ptr->get_queue_family_index() );
 
-            cmd_buffer_ptr = cmd_pool_ptr->alloc_primary_level_command_buffer();
-            vkgl_assert(cmd_buffer_ptr != nullptr);
+            if (cmd_buffer_ptr == nullptr)
+            {
+                vkgl_assert(cmd_buffer_ptr != nullptr);
+
+                goto end;
+            }
 
             if (!cmd_buffer_ptr->start_recording(true,    /* in_one_time_submit          */
                                                  false) ) /* in_simultaneous_use_allowed */
@@ -2946,6 +4311,31 @@ bool OpenGL::VKFrameGraph::record_command_buffers(const std::vector<GroupNodeUni
 
                 goto end;
             }
+
+            if (timestamp_query_pool_ptr != nullptr)
+            {
+                const auto& queue_trace_info = m_queue_trace_info.at(current_group_node_ptr->queue_ptr);
+
+                if (queue_trace_info.timestamp_valid_mask != 0)
+                {
+                    timestamp_query_index = static_cast<uint32_t>(in_command_pool_slot_ptr->timestamp_queries.size() ) * 2;
+
+                    in_command_pool_slot_ptr->timestamp_queries.push_back(
+                        CommandPoolSlot::TimestampQuery(queue_trace_info.gpu_track_id,
+                                                        (current_group_node_ptr->uses_renderpass) ? "Renderpass"
+                                                                                                  : get_node_type_name(current_group_node_ptr->graph_node_ptrs.at(0)->get_type() ),
+                                                        timestamp_query_index,
+                                                        queue_trace_info.timestamp_valid_mask)
+                    );
+
+                    cmd_buffer_ptr->record_reset_query_pool(timestamp_query_pool_ptr,
+                                                            timestamp_query_index,
+                                                            2); /* in_query_count */
+                    cmd_buffer_ptr->record_write_timestamp (Anvil::PipelineStageFlagBits::TOP_OF_PIPE_BIT,
+                                                            timestamp_query_pool_ptr,
+                                                            timestamp_query_index);
+                }
+            }
         }
 
         /* 3. Determine what wait dst stage mask should be used for submissions. */
@@ -3039,6 +4429,8 @@ bool OpenGL::VKFrameGraph::record_command_buffers(const std::vector<GroupNodeUni
                                                     static_cast<uint32_t>(current_group_node_ptr->group_node_pre_barriers.image_barriers.size() ),
                                                     (current_group_node_ptr->group_node_pre_barriers.image_barriers.size() > 0) ? &current_group_node_ptr->group_node_pre_barriers.image_barriers.at(0)
                                                                                                                                 : nullptr);
+
+            update_stats_for_recorded_barriers(current_group_node_ptr->group_node_pre_barriers);
         }
 
         /* 4b. Kick off a renderpass if one is used by sub-nodes */
@@ -3052,142 +4444,635 @@ bool OpenGL::VKFrameGraph::record_command_buffers(const std::vector<GroupNodeUni
             render_area.offset.x      = 0;
             render_area.offset.y      = 0;
 
-            cmd_buffer_ptr->record_begin_render_pass(0,       /* TODO - in_n_clear_values   */
-                                                     nullptr, /* TODO - in_clear_value_ptrs */
-                                                     current_group_node_ptr->framebuffer_ptr,
-                                                     render_area,
-                                                     current_group_node_ptr->renderpass_ptr,
-                                                     Anvil::SubpassContents::INLINE);
+            /* NOTE: Clear values are only consumed for attachments using LOAD_OP_CLEAR. See bake_renderpasses(). */
+            cmd_buffer_ptr->record_begin_render_pass(static_cast<uint32_t>(current_group_node_ptr->clear_values.size() ),
+                                                     (current_group_node_ptr->clear_values.size() > 0) ? current_group_node_ptr->clear_values.data()
+                                                                                                       : nullptr,
+                                                     current_group_node_ptr->framebuffer_ptr,
+                                                     render_area,
+                                                     current_group_node_ptr->renderpass_ptr,
+                                                     Anvil::SubpassContents::INLINE);
+        }
+
+        /* 4c. Record node-specific commands */
+        {
+            for (uint32_t n_current_node = 0;
+                          n_current_node < static_cast<uint32_t>(current_group_node_ptr->graph_node_ptrs.size() );
+                        ++n_current_node)
+            {
+                const auto& current_node_pre_barriers = current_group_node_ptr->intra_graph_node_pre_barriers.at(n_current_node);
+                const auto& current_node_ptr          = current_group_node_ptr->graph_node_ptrs.at              (n_current_node);
+
+                m_active_graph_node_ptr = current_node_ptr;
+                m_active_subpass_id     = static_cast<Anvil::SubPassID>(n_current_node);
+
+                if (current_node_pre_barriers.wait_event_ptr != nullptr)
+                {
+                    /* Second half of a split barrier. See optimize_barriers() */
+                    vkgl_assert(!current_node_pre_barriers.is_empty() );
+
+                    cmd_buffer_ptr->record_wait_events(1, /* in_event_count */
+                                                      &current_node_pre_barriers.wait_event_ptr,
+                                                       current_node_pre_barriers.src_pipeline_stages,
+                                                       current_node_pre_barriers.dst_pipeline_stages,
+                                                       0,       /* in_memory_barrier_count */
+                                                       nullptr, /* in_memory_barriers_ptr  */
+                                                       static_cast<uint32_t>(current_node_pre_barriers.buffer_barriers.size() ),
+                                                       (current_node_pre_barriers.buffer_barriers.size() > 0) ? &current_node_pre_barriers.buffer_barriers.at(0) : nullptr,
+                                                       static_cast<uint32_t>(current_node_pre_barriers.image_barriers.size() ),
+                                                       (current_node_pre_barriers.image_barriers.size() > 0)  ? &current_node_pre_barriers.image_barriers.at(0) : nullptr);
+
+                    update_stats_for_recorded_barriers(current_node_pre_barriers);
+                }
+                else
+                if (current_node_pre_barriers.buffer_barriers.size() > 0 ||
+                    current_node_pre_barriers.image_barriers.size () > 0)
+                {
+                    cmd_buffer_ptr->record_pipeline_barrier(current_node_pre_barriers.src_pipeline_stages,
+                                                            current_node_pre_barriers.dst_pipeline_stages,
+                                                            Anvil::DependencyFlagBits::NONE,
+                                                            0,       /* in_memory_barrier_count        - TODO */
+                                                            nullptr, /* in_memory_barriers_ptr         - TODO */
+                                                            static_cast<uint32_t>(current_node_pre_barriers.buffer_barriers.size() ),
+                                                            (current_node_pre_barriers.buffer_barriers.size() > 0) ? &current_node_pre_barriers.buffer_barriers.at(0) : nullptr,
+                                                            static_cast<uint32_t>(current_node_pre_barriers.image_barriers.size() ),
+                                                            (current_node_pre_barriers.image_barriers.size() > 0)  ? &current_node_pre_barriers.image_barriers.at(0) : nullptr);
+
+                    update_stats_for_recorded_barriers(current_node_pre_barriers);
+                }
+
+                /* NOTE/TODO: 01 or 10 is fine, but 00 or 11 means bad stuff (dummy submission - wtf? not sure if cpu+gpu execution is handled correctly - need to verify?) */
+                vkgl_assert(current_node_ptr->requires_gpu_side_execution() != current_node_ptr->requires_cpu_side_execution() ||
+                            current_node_ptr->requires_cpu_prepass       () );
+
+                if (n_current_node < current_group_node_ptr->n_graph_nodes_folded_into_load_ops)
+                {
+                    /* The clear has been baked into RP's load ops. Nothing to record, but the subpass still needs to be stepped over. */
+                    vkgl_assert(current_group_node_ptr->uses_renderpass);
+                }
+                else
+                if (current_node_ptr->requires_gpu_side_execution() )
+                {
+                    VKGL_TRACE_SCOPE(get_node_type_name(current_node_ptr->get_type() ));
+
+                    current_node_ptr->record_commands(cmd_buffer_ptr,
+                                                      current_group_node_ptr->uses_renderpass,
+                                                      this   /* in_graph_callback_ptr */);
+                }
+                else
+                if (current_node_ptr->requires_cpu_side_execution() )
+                {
+                    vkgl_assert(current_group_node_ptr->graph_node_ptrs.size   () == 1);
+                    vkgl_assert(current_node_ptr->requires_manual_wait_sem_sync() );      /* TODO: Fence-based CPU/GPU synchro */
+
+                    /* NOTE: Actual execution is done at submission time */
+                    current_group_node_ptr->needs_post_submission_cpu_execution = true;
+                }
+
+                /* First half of a split barrier, if one has been requested for this node. */
+                if (current_group_node_ptr->intra_graph_node_post_event_ptrs.size()            >  0 &&
+                    current_group_node_ptr->intra_graph_node_post_event_ptrs.at(n_current_node) != nullptr)
+                {
+                    vkgl_assert(!current_group_node_ptr->uses_renderpass);
+
+                    cmd_buffer_ptr->record_set_event(current_group_node_ptr->intra_graph_node_post_event_ptrs.at  (n_current_node).get(),
+                                                     current_group_node_ptr->intra_graph_node_post_event_stages.at(n_current_node) );
+
+                    m_frame_stats.n_set_event_cmds++;
+                }
+
+                /* If there's an active renderpass, move to the next subpass, unless this is the last graph node. */
+                if (current_group_node_ptr->uses_renderpass                                                                         &&
+                    n_current_node + 1                      != static_cast<uint32_t>(current_group_node_ptr->graph_node_ptrs.size() ))
+                {
+                    cmd_buffer_ptr->record_next_subpass(Anvil::SubpassContents::INLINE);
+                }
+
+                m_active_graph_node_ptr = nullptr;
+            }
+        }
+
+        /* 4d. Close the renderpass at the end of the group node */
+        if (current_group_node_ptr->uses_renderpass)
+        {
+            cmd_buffer_ptr->record_end_render_pass();
+        }
+
+        /* 4e. Inject post-barriers as necessary. */
+        if ((current_group_node_ptr->group_node_post_barriers.src_pipeline_stages    != Anvil::PipelineStageFlagBits::NONE  ||
+             current_group_node_ptr->group_node_post_barriers.dst_pipeline_stages    != Anvil::PipelineStageFlagBits::NONE) &&
+            (current_group_node_ptr->group_node_post_barriers.buffer_barriers.size() >  0                                   ||
+             current_group_node_ptr->group_node_post_barriers.image_barriers.size () >  0) )
+        {
+            cmd_buffer_ptr->record_pipeline_barrier(current_group_node_ptr->group_node_post_barriers.src_pipeline_stages,
+                                                    current_group_node_ptr->group_node_post_barriers.dst_pipeline_stages,
+                                                    Anvil::DependencyFlagBits::NONE,
+                                                    0,       /* in_memory_barrier_count        - TODO */
+                                                    nullptr, /* in_memory_barriers_ptr         - TODO */
+                                                    static_cast<uint32_t>(current_group_node_ptr->group_node_post_barriers.buffer_barriers.size() ),
+                                                    (current_group_node_ptr->group_node_post_barriers.buffer_barriers.size() > 0) ? &current_group_node_ptr->group_node_post_barriers.buffer_barriers.at(0)
+                                                                                                                                   : nullptr,
+                                                    static_cast<uint32_t>(current_group_node_ptr->group_node_post_barriers.image_barriers.size() ),
+                                                    (current_group_node_ptr->group_node_post_barriers.image_barriers.size() > 0) ? &current_group_node_ptr->group_node_post_barriers.image_barriers.at(0)
+                                                                                                                                  : nullptr);
+
+            update_stats_for_recorded_barriers(current_group_node_ptr->group_node_post_barriers);
+        }
+
+        /* 5. Stash the submission and move on. */
+        if (current_group_node_ptr->queue_family != Anvil::QueueFamilyType::UNDEFINED)
+        {
+            if (timestamp_query_index != UINT32_MAX)
+            {
+                cmd_buffer_ptr->record_write_timestamp(Anvil::PipelineStageFlagBits::BOTTOM_OF_PIPE_BIT,
+                                                       timestamp_query_pool_ptr,
+                                                       timestamp_query_index + 1);
+            }
+
+            if (!cmd_buffer_ptr->stop_recording() )
+            {
+                vkgl_assert_fail();
+
+                goto end;
+            }
+        }
+
+        current_submission_ptr->command_buffers_ptr.push_back(cmd_buffer_ptr);
+
+        out_cmd_buffer_submissions_ptr->push_back(
+            std::move(current_submission_ptr)
+        );
+
+        m_active_group_node_ptr = nullptr;
+    }
+
+    /* 6. Determine wait and signal semaphores that need to be used for the submission */
+    {
+        /* NOTE: Each command buffer submission owns exactly one group node. */
+        for (auto& current_connection : in_src_dst_group_node_connections)
+        {
+            auto        src_group_node_ptr         = current_connection.first;
+            const auto& dst_group_node_connections = current_connection.second;
+
+            for (auto& current_connection_data : dst_group_node_connections)
+            {
+                Anvil::SemaphoreUniquePtr sem_ptr = m_backend_ptr->get_sync_object_pool_ptr()->acquire_semaphore();
+
+                current_connection_data.dst_node_ptr->parent_submission_ptr->wait_dst_stage_masks.push_back(current_connection_data.dst_pipeline_stages);
+                current_connection_data.dst_node_ptr->parent_submission_ptr->wait_semaphore_ptrs.push_back (sem_ptr.get() );
+                src_group_node_ptr->parent_submission_ptr->signal_semaphore_ptrs.push_back                 (sem_ptr.get() );
+
+                inout_sem_ptr_vec.push_back(std::move(sem_ptr) );
+            }
+        }
+    }
+
+    result = true;
+end:
+    return result;
+}
+
+void OpenGL::VKFrameGraph::release_command_pool_slot(CommandPoolSlotUniquePtr in_command_pool_slot_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes m_execute_mutex is locked, and that the GPU is no longer using any of the slot's command buffers. */
+    for (auto& current_pool_data : in_command_pool_slot_ptr->pool_data_map)
+    {
+        if (current_pool_data.second.n_cmd_buffers_used == 0)
+        {
+            continue;
+        }
+
+        if (!current_pool_data.second.command_pool_ptr->reset(false) ) /* in_release_resources */
+        {
+            vkgl_assert_fail();
+        }
+
+        current_pool_data.second.n_cmd_buffers_used = 0;
+    }
+
+    in_command_pool_slot_ptr->timestamp_queries.clear();
+
+    m_free_command_pool_slots.push_back(std::move(in_command_pool_slot_ptr) );
+}
+
+bool OpenGL::VKFrameGraph::reorder_nodes(std::vector<VKFrameGraphNodeUniquePtr>& inout_node_ptrs)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE("Frame graph: reorder nodes");
+
+    /* Nodes come in GL submission order. Every time the required queue family (or renderpass support) flips between consecutive nodes,
+     * coalesce_to_group_nodes() needs to spawn a new group node, which costs a command buffer, a submission and semaphores. An app
+     * interleaving buffer updates with draw calls will shatter the frame into a flurry of submissions.
+     *
+     * This pass reorders nodes, so that:
+     *
+     * 1. Uploads which do not depend on preceding draw calls are hoisted ahead of them, and clustered.
+     * 2. Draw calls touching the same render target are kept contiguous.
+     *
+     * Only hazards reported by node IOs (RAW, WAR, WAW at GL buffer storage / image granularity) constrain the new order. Nodes which
+     * are not executed GPU-side (swapchain acquisition, presentation, etc.) act as full barriers - nothing is moved across them.
+     */
+    typedef std::tuple<Anvil::QueueFamilyType, OpenGL::RenderpassSupportScope, const void*> NodeClass;
+
+    typedef struct ResourceState
+    {
+        uint32_t              n_last_writer_node;
+        std::vector<uint32_t> reader_nodes;       //< nodes which have read the resource since it was last written to.
+
+        ResourceState()
+            :n_last_writer_node(UINT32_MAX)
+        {
+            /* Stub */
+        }
+    } ResourceState;
+
+    const uint32_t                                     n_nodes                  = static_cast<uint32_t>(inout_node_ptrs.size() );
+    std::map<OpenGL::VKBufferRegionKey, ResourceState> buffer_state_map;
+    std::unordered_map<const void*, ResourceState>     image_state_map;
+    std::vector<NodeClass>                             node_classes             (n_nodes);
+    std::vector<bool>                                  node_is_transfer_vec     (n_nodes, false);
+    std::vector<uint32_t>                              n_node_predecessors_vec  (n_nodes, 0);
+    std::vector<std::vector<uint32_t> >                node_successors_vec      (n_nodes);
+    std::vector<uint32_t>                              nodes_since_last_barrier;
+    uint32_t                                           n_last_barrier_node      = UINT32_MAX;
+    std::vector<uint32_t>                              new_order;
+    std::set<uint32_t>                                 ready_nodes;
+    ResourceState                                      swapchain_image_state;
+    bool                                               result                   = false;
+
+    auto add_dependency = [&](const uint32_t& in_n_src_node,
+                              const uint32_t& in_n_dst_node)
+    {
+        if (in_n_src_node != UINT32_MAX &&
+            in_n_src_node != in_n_dst_node)
+        {
+            node_successors_vec.at    (in_n_src_node).push_back(in_n_dst_node);
+            n_node_predecessors_vec.at(in_n_dst_node)++;
+        }
+    };
+
+    if (n_nodes < 3)
+    {
+        result = true;
+
+        goto end;
+    }
+
+    /* 1. Build the dependency DAG. */
+    for (uint32_t n_node = 0;
+                  n_node < n_nodes;
+                ++n_node)
+    {
+        const auto& current_node_ptr      = inout_node_ptrs.at(n_node);
+        const auto  current_node_info_ptr = current_node_ptr->get_info_ptr();
+
+        if (!current_node_ptr->requires_gpu_side_execution  () ||
+             current_node_ptr->requires_manual_wait_sem_sync() )
+        {
+            for (const auto& n_preceding_node : nodes_since_last_barrier)
+            {
+                add_dependency(n_preceding_node,
+                               n_node);
+            }
+
+            add_dependency(n_last_barrier_node,
+                           n_node);
+
+            n_last_barrier_node = n_node;
+
+            nodes_since_last_barrier.clear();
+
+            continue;
+        }
+
+        add_dependency(n_last_barrier_node,
+                       n_node);
+
+        nodes_since_last_barrier.push_back(n_node);
+
+        /* Determine which class the node belongs to. Uploads share a single class. Other nodes are classified by the queue family they
+         * are going to be executed on, renderpass requirements and the first image they render to (if any).
+         */
+        {
+            const void* render_target_ptr = nullptr;
+            bool        supports_dma      = false;
+            const auto  queue_family      = get_node_queue_family_type(current_node_ptr.get(),
+                                                                      &supports_dma);
+            const auto  rp_support_scope  = current_node_ptr->get_renderpass_support_scope();
+
+            node_is_transfer_vec.at(n_node) = (supports_dma && rp_support_scope == OpenGL::RenderpassSupportScope::Not_Supported);
+
+            if (!node_is_transfer_vec.at(n_node) )
+            {
+                for (const auto& current_output : current_node_info_ptr->outputs)
+                {
+                    if (current_output.type == OpenGL::NodeIOType::Image)
+                    {
+                        render_target_ptr = current_output.image_reference_ptr->get_payload().image_ptr;
+
+                        break;
+                    }
+                    else
+                    if (current_output.type == OpenGL::NodeIOType::Swapchain_Image)
+                    {
+                        /* Any unique address will do. */
+                        render_target_ptr = &swapchain_image_state;
+
+                        break;
+                    }
+                }
+            }
+
+            node_classes.at(n_node) = (node_is_transfer_vec.at(n_node) ) ? NodeClass(Anvil::QueueFamilyType::UNDEFINED, OpenGL::RenderpassSupportScope::Not_Supported, nullptr)
+                                                                         : NodeClass(queue_family,                       rp_support_scope,                               render_target_ptr);
+        }
+
+        /* RAW: depend on last writer. Also record the read, so that future writers can be ordered after this node (WAR). */
+        for (const auto& current_input : current_node_info_ptr->inputs)
+        {
+            ResourceState* state_ptr = nullptr;
+
+            switch (current_input.type)
+            {
+                case OpenGL::NodeIOType::Buffer:          state_ptr = &buffer_state_map[current_input.buffer_reference_ptr->get_payload().get_region_key()]; break;
+                case OpenGL::NodeIOType::Image:           state_ptr = &image_state_map [current_input.image_reference_ptr->get_payload().image_ptr];        break;
+                case OpenGL::NodeIOType::Swapchain_Image: state_ptr = &swapchain_image_state;                                                               break;
+
+                default:
+                {
+                    vkgl_assert_fail();
+
+                    goto end;
+                }
+            }
+
+            add_dependency(state_ptr->n_last_writer_node,
+                           n_node);
+
+            state_ptr->reader_nodes.push_back(n_node);
         }
 
-        /* 4c. Record node-specific commands */
+        /* WAW, WAR: depend on last writer, and on all nodes which have read the resource since. */
+        for (const auto& current_output : current_node_info_ptr->outputs)
         {
-            for (uint32_t n_current_node = 0;
-                          n_current_node < static_cast<uint32_t>(current_group_node_ptr->graph_node_ptrs.size() );
-                        ++n_current_node)
-            {
-                const auto& current_node_pre_barriers = current_group_node_ptr->intra_graph_node_pre_barriers.at(n_current_node);
-                const auto& current_node_ptr          = current_group_node_ptr->graph_node_ptrs.at              (n_current_node);
+            ResourceState* state_ptr = nullptr;
 
-                m_active_graph_node_ptr = current_node_ptr;
-                m_active_subpass_id     = static_cast<Anvil::SubPassID>(n_current_node);
+            switch (current_output.type)
+            {
+                case OpenGL::NodeIOType::Buffer:          state_ptr = &buffer_state_map[current_output.buffer_reference_ptr->get_payload().get_region_key()]; break;
+                case OpenGL::NodeIOType::Image:           state_ptr = &image_state_map [current_output.image_reference_ptr->get_payload().image_ptr];        break;
+                case OpenGL::NodeIOType::Swapchain_Image: state_ptr = &swapchain_image_state;                                                                break;
 
-                if (current_node_pre_barriers.buffer_barriers.size() > 0 ||
-                    current_node_pre_barriers.image_barriers.size () > 0)
+                default:
                 {
-                    cmd_buffer_ptr->record_pipeline_barrier(current_node_pre_barriers.src_pipeline_stages,
-                                                            current_node_pre_barriers.dst_pipeline_stages,
-                                                            Anvil::DependencyFlagBits::NONE,
-                                                            0,       /* in_memory_barrier_count        - TODO */
-                                                            nullptr, /* in_memory_barriers_ptr         - TODO */
-                                                            static_cast<uint32_t>(current_node_pre_barriers.buffer_barriers.size() ),
-                                                            (current_node_pre_barriers.buffer_barriers.size() > 0) ? &current_node_pre_barriers.buffer_barriers.at(0) : nullptr,
-                                                            static_cast<uint32_t>(current_node_pre_barriers.image_barriers.size() ),
-                                                            (current_node_pre_barriers.image_barriers.size() > 0)  ? &current_node_pre_barriers.image_barriers.at(0) : nullptr);
+                    vkgl_assert_fail();
+
+                    goto end;
                 }
+            }
 
-                /* NOTE/TODO: 01 or 10 is fine, but 00 or 11 means bad stuff (dummy submission - wtf? not sure if cpu+gpu execution is handled correctly - need to verify?) */
-                vkgl_assert(current_node_ptr->requires_gpu_side_execution() != current_node_ptr->requires_cpu_side_execution() ||
-                            current_node_ptr->requires_cpu_prepass       () );
+            add_dependency(state_ptr->n_last_writer_node,
+                           n_node);
 
-                if (current_node_ptr->requires_gpu_side_execution() )
-                {
-                    current_node_ptr->record_commands(cmd_buffer_ptr.get(),
-                                                      current_group_node_ptr->uses_renderpass,
-                                                      this   /* in_graph_callback_ptr */);
-                }
-                else
-                if (current_node_ptr->requires_cpu_side_execution() )
-                {
-                    vkgl_assert(current_group_node_ptr->graph_node_ptrs.size   () == 1);
-                    vkgl_assert(current_node_ptr->requires_manual_wait_sem_sync() );      /* TODO: Fence-based CPU/GPU synchro */
+            for (const auto& n_reader_node : state_ptr->reader_nodes)
+            {
+                add_dependency(n_reader_node,
+                               n_node);
+            }
 
-                    /* NOTE: Actual execution is done at submission time */
-                    current_group_node_ptr->needs_post_submission_cpu_execution = true;
-                }
+            state_ptr->n_last_writer_node = n_node;
+            state_ptr->reader_nodes.clear();
+        }
+    }
 
-                /* If there's an active renderpass, move to the next subpass, unless this is the last graph node. */
-                if (current_group_node_ptr->uses_renderpass                                                                         &&
-                    n_current_node + 1                      != static_cast<uint32_t>(current_group_node_ptr->graph_node_ptrs.size() ))
-                {
-                    cmd_buffer_ptr->record_next_subpass(Anvil::SubpassContents::INLINE);
-                }
+    /* 2. Schedule the nodes. Out of all nodes whose dependencies have been met, pick (in order of preference):
+     *
+     * a) the earliest node of the same class as the previously scheduled node, so that the group node in flight can be extended.
+     * b) the earliest upload.
+     * c) the earliest node.
+     */
+    for (uint32_t n_node = 0;
+                  n_node < n_nodes;
+                ++n_node)
+    {
+        if (n_node_predecessors_vec.at(n_node) == 0)
+        {
+            ready_nodes.insert(n_node);
+        }
+    }
 
-                m_active_graph_node_ptr = nullptr;
-            }
+    new_order.reserve(n_nodes);
+
+    while (ready_nodes.size() > 0)
+    {
+        auto selected_node_iterator = ready_nodes.end();
+
+        if (new_order.size() > 0)
+        {
+            const auto& last_node_class = node_classes.at(new_order.back() );
+
+            selected_node_iterator = std::find_if(ready_nodes.begin(),
+                                                  ready_nodes.end  (),
+                                                  [&](const uint32_t& in_n_node)
+                                                  {
+                                                      return node_classes.at(in_n_node) == last_node_class;
+                                                  });
         }
 
-        /* 4d. Close the renderpass at the end of the group node */
-        if (current_group_node_ptr->uses_renderpass)
+        if (selected_node_iterator == ready_nodes.end() )
         {
-            cmd_buffer_ptr->record_end_render_pass();
+            selected_node_iterator = std::find_if(ready_nodes.begin(),
+                                                  ready_nodes.end  (),
+                                                  [&](const uint32_t& in_n_node)
+                                                  {
+                                                      return node_is_transfer_vec.at(in_n_node);
+                                                  });
         }
 
-        /* 4e. Inject post-barriers as necessary. */
-        if ((current_group_node_ptr->group_node_post_barriers.src_pipeline_stages    != Anvil::PipelineStageFlagBits::NONE  ||
-             current_group_node_ptr->group_node_post_barriers.dst_pipeline_stages    != Anvil::PipelineStageFlagBits::NONE) &&
-            (current_group_node_ptr->group_node_post_barriers.buffer_barriers.size() >  0                                   ||
-             current_group_node_ptr->group_node_post_barriers.image_barriers.size () >  0) )
+        if (selected_node_iterator == ready_nodes.end() )
         {
-            cmd_buffer_ptr->record_pipeline_barrier(current_group_node_ptr->group_node_post_barriers.src_pipeline_stages,
-                                                    current_group_node_ptr->group_node_post_barriers.dst_pipeline_stages,
-                                                    Anvil::DependencyFlagBits::NONE,
-                                                    0,       /* in_memory_barrier_count        - TODO */
-                                                    nullptr, /* in_memory_barriers_ptr         - TODO */
-                                                    static_cast<uint32_t>(current_group_node_ptr->group_node_post_barriers.buffer_barriers.size() ),
-                                                    (current_group_node_ptr->group_node_post_barriers.buffer_barriers.size() > 0) ? &current_group_node_ptr->group_node_post_barriers.buffer_barriers.at(0)
-                                                                                                                                   : nullptr,
-                                                    static_cast<uint32_t>(current_group_node_ptr->group_node_post_barriers.image_barriers.size() ),
-                                                    (current_group_node_ptr->group_node_post_barriers.image_barriers.size() > 0) ? &current_group_node_ptr->group_node_post_barriers.image_barriers.at(0)
-                                                                                                                                  : nullptr);
+            selected_node_iterator = ready_nodes.begin();
         }
 
-        /* 5. Stash the submission and move on. */
-        if (current_group_node_ptr->queue_family != Anvil::QueueFamilyType::UNDEFINED)
         {
-            if (!cmd_buffer_ptr->stop_recording() )
-            {
-                vkgl_assert_fail();
+            const uint32_t n_selected_node = *selected_node_iterator;
 
-                goto end;
+            ready_nodes.erase  (selected_node_iterator);
+            new_order.push_back(n_selected_node);
+
+            for (const auto& n_successor_node : node_successors_vec.at(n_selected_node) )
+            {
+                if (--n_node_predecessors_vec.at(n_successor_node) == 0)
+                {
+                    ready_nodes.insert(n_successor_node);
+                }
             }
         }
+    }
 
-        current_submission_ptr->command_buffers_ptr.push_back      (cmd_buffer_ptr.get() );
-        current_submission_ptr->command_buffers_owned_ptr.push_back(std::move(cmd_buffer_ptr) );
+    vkgl_assert(new_order.size() == n_nodes);
 
-        out_cmd_buffer_submissions_ptr->push_back(
-            std::move(current_submission_ptr)
-        );
+    /* 3. Apply the new order. */
+    {
+        std::vector<VKFrameGraphNodeUniquePtr> reordered_node_ptrs;
 
-        m_active_group_node_ptr = nullptr;
+        reordered_node_ptrs.reserve(n_nodes);
+
+        for (const auto& n_node : new_order)
+        {
+            reordered_node_ptrs.push_back(std::move(inout_node_ptrs.at(n_node) ));
+        }
+
+        inout_node_ptrs = std::move(reordered_node_ptrs);
     }
 
-    /* 6. Determine wait and signal semaphores that need to be used for the submission */
+    result = true;
+end:
+    return result;
+}
+
+void OpenGL::VKFrameGraph::resolve_timestamp_queries(CommandPoolSlot* in_command_pool_slot_ptr,
+                                                     const uint64_t&  in_fence_signaled_time_us) const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes the execution which used the slot has finished GPU-side. */
+    const auto&           timestamp_queries     = in_command_pool_slot_ptr->timestamp_queries;
+    bool                  all_results_retrieved = false;
+    uint64_t              latest_timestamp      = 0;
+    const uint32_t        n_queries             = static_cast<uint32_t>(timestamp_queries.size() ) * 2;
+    std::vector<uint64_t> results               (n_queries);
+
+    if (n_queries == 0)
     {
-        /* NOTE: Each command buffer submission owns exactly one group node. */
-        for (auto& current_connection : in_src_dst_group_node_connections)
+        goto end;
+    }
+
+    if (!in_command_pool_slot_ptr->timestamp_query_pool_ptr->get_query_pool_results(0, /* in_first_query_index */
+                                                                                    n_queries,
+                                                                                    Anvil::QueryResultFlagBits::_64_BIT,
+                                                                                    results.data(),
+                                                                                   &all_results_retrieved) ||
+        !all_results_retrieved)
+    {
+        vkgl_assert_fail();
+
+        goto end;
+    }
+
+    /* Vulkan offers no way to correlate GPU timestamps with the CPU clock without VK_EXT_calibrated_timestamps. Instead, the
+     * last timestamp of the execution is anchored at the time the CPU found its fence signaled. This shifts the execution
+     * by the retire thread's wake-up latency, but keeps all intervals within the execution exact.
+     */
+    for (const auto& current_query : timestamp_queries)
+    {
+        const uint64_t end_timestamp = results.at(current_query.start_query_index + 1) & current_query.timestamp_valid_mask;
+
+        latest_timestamp = std::max(latest_timestamp,
+                                    end_timestamp);
+    }
+
+    for (const auto& current_query : timestamp_queries)
+    {
+        const uint64_t start_timestamp = results.at(current_query.start_query_index)     & current_query.timestamp_valid_mask;
+        const uint64_t end_timestamp   = results.at(current_query.start_query_index + 1) & current_query.timestamp_valid_mask;
+        const uint64_t end_delta_us    = static_cast<uint64_t>(static_cast<double>((latest_timestamp - end_timestamp)   & current_query.timestamp_valid_mask) * m_timestamp_period_ns / 1000.0);
+        const uint64_t duration_us     = static_cast<uint64_t>(static_cast<double>((end_timestamp    - start_timestamp) & current_query.timestamp_valid_mask) * m_timestamp_period_ns / 1000.0);
+        const uint64_t end_time_us     = (in_fence_signaled_time_us > end_delta_us) ? in_fence_signaled_time_us - end_delta_us
+                                                                                     : 0;
+
+        VKGL::TraceRecorder::record_gpu_event(current_query.gpu_track_id,
+                                              current_query.name,
+                                              (end_time_us > duration_us) ? end_time_us - duration_us : 0,
+                                              end_time_us);
+    }
+
+end:
+    ;
+}
+
+void OpenGL::VKFrameGraph::retire_thread_entrypoint()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This entrypoint lives in its own dedicated thread */
+    const auto device_vk = m_backend_ptr->get_device_ptr()->get_device_vk();
+
+    VKGL::TraceRecorder::set_thread_name("VKGL frame graph retire thread");
+
+    VKGL::g_logger_ptr->log(VKGL::LogLevel::Info,
+                            "VK frame graph retire thread started.");
+
+    do
+    {
+        PendingRetirement current_retirement;
+
         {
-            auto        src_group_node_ptr         = current_connection.first;
-            const auto& dst_group_node_connections = current_connection.second;
+            std::unique_lock<std::mutex> retire_lock(m_retire_mutex);
 
-            for (auto& current_connection_data : dst_group_node_connections)
+            if (m_pending_retirements.size() == 0 &&
+               !m_retire_thread_terminating)
             {
-                auto                      sem_create_info_ptr = Anvil::SemaphoreCreateInfo::create(device_ptr);
-                Anvil::SemaphoreUniquePtr sem_ptr             = Anvil::Semaphore::create          (std::move(sem_create_info_ptr) );
+                /* Nothing is in flight, so the GPU is left waiting for the CPU to submit more work. Track for how long. */
+                const auto idle_start_time = std::chrono::steady_clock::now();
 
-                current_connection_data.dst_node_ptr->parent_submission_ptr->wait_dst_stage_masks.push_back(current_connection_data.dst_pipeline_stages);
-                current_connection_data.dst_node_ptr->parent_submission_ptr->wait_semaphore_ptrs.push_back (sem_ptr.get() );
-                src_group_node_ptr->parent_submission_ptr->signal_semaphore_ptrs.push_back                 (sem_ptr.get() );
+                while (m_pending_retirements.size() == 0 &&
+                      !m_retire_thread_terminating)
+                {
+                    m_retire_condition.wait(retire_lock);
+                }
 
-                inout_sem_ptr_vec.push_back(std::move(sem_ptr) );
+                m_gpu_idle_time_us += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - idle_start_time).count();
+            }
+
+            /* Pending submissions are drained before quitting, so that no VKGL fence is left unsignaled. */
+            if (m_pending_retirements.size() == 0)
+            {
+                break;
             }
+
+            current_retirement = m_pending_retirements.front();
+        }
+
+        if (current_retirement.fence_ptr != nullptr)
+        {
+            VkResult result_vk = Anvil::Vulkan::vkWaitForFences(device_vk,
+                                                                1, /* fenceCount */
+                                                                current_retirement.fence_ptr->get_fence_ptr(),
+                                                                VK_TRUE,
+                                                                UINT64_MAX);
+
+            vkgl_assert(result_vk == VK_SUCCESS);
+        }
+
+        if (current_retirement.opt_fence2_ptr != nullptr)
+        {
+            current_retirement.opt_fence2_ptr->signal();
+        }
+
+        if (current_retirement.opt_command_pool_slot_ptr != nullptr)
+        {
+            resolve_timestamp_queries(current_retirement.opt_command_pool_slot_ptr,
+                                      VKGL::TraceRecorder::get_time_us() );
+        }
+
+        /* NOTE: The Anvil fence must not be accessed after the counter is advanced, as execute() is then free to release it. */
+        {
+            std::lock_guard<std::mutex> retire_lock(m_retire_mutex);
+
+            m_pending_retirements.pop_front();
+
+            m_completed_timeline_value.store(current_retirement.timeline_value);
         }
+
+        m_retire_condition.notify_all();
     }
+    while (true);
 
-    result = true;
-end:
-    return result;
+    VKGL::g_logger_ptr->log(VKGL::LogLevel::Info,
+                            "VK frame graph retire thread quitting now.");
 }
 
 void OpenGL::VKFrameGraph::set_acquired_swapchain_reference_raw_ptr(OpenGL::VKSwapchainReference* in_swapchain_reference_ptr)
@@ -3316,6 +5201,110 @@ void OpenGL::VKFrameGraph::set_bound_pipeline_id(const Anvil::PipelineID& in_pip
     m_current_cmd_buffer_dynamic_state.is_gfx_pipeline_id_bound = true;
 }
 
+void OpenGL::VKFrameGraph::set_bound_vertex_buffers(const uint32_t&       in_n_bindings,
+                                                   Anvil::Buffer* const* in_buffer_ptrs,
+                                                   const VkDeviceSize*   in_offsets)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    m_current_cmd_buffer_dynamic_state.bound_vertex_buffer_ptrs.assign   (in_buffer_ptrs,
+                                                                          in_buffer_ptrs + in_n_bindings);
+    m_current_cmd_buffer_dynamic_state.bound_vertex_buffer_offsets.assign(in_offsets,
+                                                                          in_offsets     + in_n_bindings);
+}
+
+void OpenGL::VKFrameGraph::set_buffer_range_owner(BufferRangeMap&     inout_range_map,
+                                                  const VkDeviceSize& in_start_offset,
+                                                  const VkDeviceSize& in_end_offset,
+                                                  const uint32_t&     in_queue_family_index) const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    vkgl_assert(in_start_offset < in_end_offset);
+
+    /* 1. Trim the interval which straddles the start offset, if any. If it also extends past the end offset, the part lying past
+     *    the new range survives as a separate interval.
+     */
+    {
+        auto range_iterator = inout_range_map.upper_bound(in_start_offset);
+
+        if (range_iterator != inout_range_map.begin() )
+        {
+            auto prev_range_iterator = std::prev(range_iterator);
+
+            if (prev_range_iterator->second.end_offset > in_start_offset)
+            {
+                if (prev_range_iterator->second.end_offset > in_end_offset)
+                {
+                    inout_range_map[in_end_offset] = BufferRangeInfo(prev_range_iterator->second.end_offset,
+                                                                     prev_range_iterator->second.owning_queue_family_index);
+                }
+
+                if (prev_range_iterator->first < in_start_offset)
+                {
+                    prev_range_iterator->second.end_offset = in_start_offset;
+                }
+                else
+                {
+                    inout_range_map.erase(prev_range_iterator);
+                }
+            }
+        }
+    }
+
+    /* 2. Drop all intervals which start within the range. The last one may need to be trimmed instead. */
+    {
+        auto range_iterator = inout_range_map.lower_bound(in_start_offset);
+
+        while (range_iterator        != inout_range_map.end() &&
+               range_iterator->first <  in_end_offset)
+        {
+            if (range_iterator->second.end_offset > in_end_offset)
+            {
+                const auto tail_range = range_iterator->second;
+
+                inout_range_map.erase(range_iterator);
+
+                inout_range_map[in_end_offset] = tail_range;
+
+                break;
+            }
+
+            range_iterator = inout_range_map.erase(range_iterator);
+        }
+    }
+
+    /* 3. Insert the new interval, merging it with neighbours of the same owner. */
+    {
+        auto new_range_iterator = inout_range_map.emplace(in_start_offset,
+                                                          BufferRangeInfo(in_end_offset,
+                                                                          in_queue_family_index) ).first;
+        auto next_range_iterator = std::next(new_range_iterator);
+
+        if (next_range_iterator                                      != inout_range_map.end() &&
+            next_range_iterator->first                               == in_end_offset         &&
+            next_range_iterator->second.owning_queue_family_index    == in_queue_family_index)
+        {
+            new_range_iterator->second.end_offset = next_range_iterator->second.end_offset;
+
+            inout_range_map.erase(next_range_iterator);
+        }
+
+        if (new_range_iterator != inout_range_map.begin() )
+        {
+            auto prev_range_iterator = std::prev(new_range_iterator);
+
+            if (prev_range_iterator->second.end_offset                == in_start_offset &&
+                prev_range_iterator->second.owning_queue_family_index == in_queue_family_index)
+            {
+                prev_range_iterator->second.end_offset = new_range_iterator->second.end_offset;
+
+                inout_range_map.erase(new_range_iterator);
+            }
+        }
+    }
+}
+
 void OpenGL::VKFrameGraph::set_swapchain_image_acquired_sem(Anvil::Semaphore* in_sem_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
@@ -3370,6 +5359,7 @@ bool OpenGL::VKFrameGraph::submit_command_buffers(const std::vector<CommandBuffe
                                                   std::vector<Anvil::SemaphoreUniquePtr>&              inout_sem_ptr_vec)
 {
     FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE("Frame graph: submit");
     
     const uint32_t n_submissions = static_cast<uint32_t>(in_cmd_buffer_submissions_ptr.size() );
     bool           result        = false;
@@ -3396,10 +5386,9 @@ bool OpenGL::VKFrameGraph::submit_command_buffers(const std::vector<CommandBuffe
                 /* This node will also be doing a CPU-based operation that needs to wait on a sem! Spawn a temporary sem which
                  * will also be signaled once this submission finishes GPU-side, and use it as a wait sem for the node's purposes.
                  */
-                auto create_info_ptr = Anvil::SemaphoreCreateInfo::create(m_backend_ptr->get_device_ptr() );
                 auto signal_sem_ptrs = current_submission_ptr->signal_semaphore_ptrs;
 
-                cpu_submission_sem_ptr = Anvil::Semaphore::create(std::move(create_info_ptr) );
+                cpu_submission_sem_ptr = m_backend_ptr->get_sync_object_pool_ptr()->acquire_semaphore();
                 vkgl_assert(cpu_submission_sem_ptr != nullptr);
 
                 signal_sem_ptrs.push_back(cpu_submission_sem_ptr.get() );
@@ -3503,3 +5492,34 @@ bool OpenGL::VKFrameGraph::submit_command_buffers(const std::vector<CommandBuffe
 end:
     return result;
 }
+
+void OpenGL::VKFrameGraph::update_stats_for_recorded_barriers(const BarrierData& in_barrier_data)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* NOTE: This function assumes m_execute_mutex is locked! */
+    m_frame_stats.n_buffer_barriers += static_cast<uint32_t>(in_barrier_data.buffer_barriers.size() );
+    m_frame_stats.n_image_barriers  += static_cast<uint32_t>(in_barrier_data.image_barriers.size () );
+
+    if (in_barrier_data.wait_event_ptr != nullptr)
+    {
+        m_frame_stats.n_wait_events_cmds++;
+    }
+    else
+    {
+        m_frame_stats.n_pipeline_barrier_cmds++;
+    }
+}
+
+void OpenGL::VKFrameGraph::wait_for_timeline_value(const uint64_t& in_timeline_value)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::unique_lock<std::mutex> retire_lock(m_retire_mutex);
+
+    /* Handle spurious wake-ups. */
+    while (m_completed_timeline_value.load() < in_timeline_value)
+    {
+        m_retire_condition.wait(retire_lock);
+    }
+}
@@ -9,8 +9,38 @@
 #include "OpenGL/backend/vk_framebuffer_manager.h"
 #include "OpenGL/backend/vk_renderpass_manager.h"
 
+/* Framebuffers are keyed by image views, so apps which keep re-creating render targets (e.g. on resize) would otherwise
+ * grow the cache without bounds.
+ */
+static const uint32_t g_n_max_cached_framebuffers = 256;
+
+
+OpenGL::VKFramebufferManager::FramebufferData::FramebufferData(const Anvil::RenderPass*     in_renderpass_ptr,
+                                                               OpenGL::VKRenderpassManager* in_renderpass_manager_ptr)
+    :renderpass_ptr        (in_renderpass_ptr),
+     renderpass_manager_ptr(in_renderpass_manager_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    vkgl_assert(renderpass_ptr         != nullptr);
+    vkgl_assert(renderpass_manager_ptr != nullptr);
+
+    renderpass_manager_ptr->reference_render_pass(renderpass_ptr);
+}
+
+OpenGL::VKFramebufferManager::FramebufferData::~FramebufferData()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* Release the Vulkan FB before the RP it was baked for can go away. */
+    framebuffer_ptr.reset();
+
+    renderpass_manager_ptr->release_render_pass(renderpass_ptr);
+}
+
 OpenGL::VKFramebufferManager::VKFramebufferManager(IBackend* in_backend_ptr)
-    :m_backend_ptr(in_backend_ptr)
+    :m_backend_ptr      (in_backend_ptr),
+     m_framebuffer_cache(g_n_max_cached_framebuffers)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -40,94 +70,72 @@ Anvil::Framebuffer* OpenGL::VKFramebufferManager::get_framebuffer(const std::vec
                                                                   const uint32_t&                       in_width,
                                                                   const uint32_t&                       in_height,
                                                                   const uint32_t&                       in_n_layers,
-                                                                  Anvil::RenderPass*                    in_rp_ptr)
+                                                                  Anvil::RenderPass*                    in_rp_ptr,
+                                                                  const uint64_t&                       in_timeline_value)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    const auto          fb_hash    = get_framebuffer_hash(in_attachments_ptr,
+    const FramebufferKey fb_key     (in_attachments_ptr,
+                                     get_framebuffer_hash(in_attachments_ptr,
                                                           in_width,
                                                           in_height,
                                                           in_n_layers,
-                                                          in_rp_ptr);
-    Anvil::Framebuffer* result_ptr = nullptr;
+                                                          in_rp_ptr) );
+    FramebufferData*     fb_data_ptr(nullptr);
+    Anvil::Framebuffer*  result_ptr (nullptr);
 
-    for (uint32_t n_iteration = 0;
-                  n_iteration < 2 && (result_ptr == nullptr); /* shared access / unique access */
-                ++n_iteration)
-    {
-        if (n_iteration == 0)
-        {
-            m_rw_mutex.lock_shared();
-        }
-        else
-        {
-            m_rw_mutex.lock_unique();
-        }
-        {
-            const auto map_iterator = m_framebuffer_ptr_map.find(fb_hash);
+    fb_data_ptr = m_framebuffer_cache.find(fb_key,
+                                           in_timeline_value);
 
-            if (map_iterator != m_framebuffer_ptr_map.end() )
-            {
-                const auto& fb_data_ptr_vec = map_iterator->second;
+    if (fb_data_ptr == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(m_create_mutex);
 
-                for (const auto& current_fb_data_ptr : fb_data_ptr_vec)
-                {
-                    vkgl_assert(OpenGL::VKRenderpassManager::is_rp_compatible(current_fb_data_ptr->renderpass_ptr->get_render_pass_create_info(),
-                                                                              in_rp_ptr->get_render_pass_create_info                          () ) );
+        /* Another thread may have created the FB while we were waiting for the lock. */
+        fb_data_ptr = m_framebuffer_cache.find(fb_key,
+                                               in_timeline_value);
 
-                    if (current_fb_data_ptr->attachment_ptrs == in_attachments_ptr)
-                    {
-                        result_ptr = current_fb_data_ptr->framebuffer_ptr.get();
+        if (fb_data_ptr == nullptr)
+        {
+            auto                        fb_create_info_ptr = Anvil::FramebufferCreateInfo::create(m_backend_ptr->get_device_ptr(),
+                                                                                                  in_width,
+                                                                                                  in_height,
+                                                                                                  in_n_layers);
+            FramebufferDataUniquePtr    result_fb_data_ptr;
+            Anvil::FramebufferUniquePtr result_fb_ptr;
 
-                        break;
-                    }
-                }
-            }
+            vkgl_assert(fb_create_info_ptr != nullptr);
 
-            if (result_ptr  == nullptr &&
-                n_iteration == 1)
+            for (auto& current_attachment_ptr : in_attachments_ptr)
             {
-                auto                             fb_create_info_ptr = Anvil::FramebufferCreateInfo::create(m_backend_ptr->get_device_ptr(),
-                                                                                                           in_width,
-                                                                                                           in_height,
-                                                                                                           in_n_layers);
-                std::unique_ptr<FramebufferData> result_fb_data_ptr;
-                Anvil::FramebufferUniquePtr      result_fb_ptr;
-
-                vkgl_assert(fb_create_info_ptr != nullptr);
-
-                for (auto& current_attachment_ptr : in_attachments_ptr)
-                {
-                    fb_create_info_ptr->add_attachment(current_attachment_ptr,
-                                                       nullptr); /* out_opt_attachment_id_ptr */
-                }
+                fb_create_info_ptr->add_attachment(current_attachment_ptr,
+                                                   nullptr); /* out_opt_attachment_id_ptr */
+            }
 
-                result_fb_ptr = Anvil::Framebuffer::create(std::move(fb_create_info_ptr) );
-                result_ptr    = result_fb_ptr.get();
-                vkgl_assert(result_fb_ptr != nullptr);
+            result_fb_ptr = Anvil::Framebuffer::create(std::move(fb_create_info_ptr) );
+            vkgl_assert(result_fb_ptr != nullptr);
 
-                /* Make sure to bake an actual Vulkan framebuffer for the RP which has been specified */
-                result_fb_ptr->get_framebuffer(in_rp_ptr);
+            /* Make sure to bake an actual Vulkan framebuffer for the RP which has been specified */
+            result_fb_ptr->get_framebuffer(in_rp_ptr);
 
-                result_fb_data_ptr.reset(new FramebufferData(in_rp_ptr) );
-                vkgl_assert(result_fb_data_ptr != nullptr);
+            result_fb_data_ptr.reset(new FramebufferData(in_rp_ptr,
+                                                         m_backend_ptr->get_renderpass_manager_ptr() ) );
+            vkgl_assert(result_fb_data_ptr != nullptr);
 
-                result_fb_data_ptr->attachment_ptrs = in_attachments_ptr;
-                result_fb_data_ptr->framebuffer_ptr = std::move(result_fb_ptr);
+            result_fb_data_ptr->attachment_ptrs = in_attachments_ptr;
+            result_fb_data_ptr->framebuffer_ptr = std::move(result_fb_ptr);
 
-                m_framebuffer_ptr_map[fb_hash].push_back(std::move(result_fb_data_ptr) );
-            }
-        }
-        if (n_iteration == 0)
-        {
-            m_rw_mutex.unlock_shared();
-        }
-        else
-        {
-            m_rw_mutex.unlock_unique();
+            fb_data_ptr = m_framebuffer_cache.insert(fb_key,
+                                                     std::move(result_fb_data_ptr),
+                                                     in_timeline_value);
         }
     }
 
+    vkgl_assert(OpenGL::VKRenderpassManager::is_rp_compatible(fb_data_ptr->renderpass_ptr->get_render_pass_create_info(),
+                                                              in_rp_ptr->get_render_pass_create_info                  () ) );
+
+    result_ptr = fb_data_ptr->framebuffer_ptr.get();
+
     vkgl_assert(result_ptr != nullptr);
     return result_ptr;
 }
@@ -156,3 +164,19 @@ uint64_t OpenGL::VKFramebufferManager::get_framebuffer_hash(const std::vector<An
 
     return hash;
 }
+
+OpenGL::VKCacheStats OpenGL::VKFramebufferManager::pop_frame_stats()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    return m_framebuffer_cache.pop_stats();
+}
+
+void OpenGL::VKFramebufferManager::trim(const uint64_t& in_completed_timeline_value)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::lock_guard<std::mutex> lock(m_create_mutex);
+
+    m_framebuffer_cache.trim(in_completed_timeline_value);
+}
@@ -12,6 +12,11 @@
 #include "OpenGL/backend/vk_spirv_manager.h"
 #include "OpenGL/frontend/gl_vao_manager.h"
 
+/* Pipelines are keyed by GL state hashes, which change with every program re-link or vertex format change, so the
+ * cache needs an upper bound.
+ */
+static const uint32_t g_n_max_cached_gfx_pipelines = 1024;
+
 
 OpenGL::VKGFXPipelineManager::GLState::GLState()
     :is_blend_enabled                    (false),
@@ -654,13 +659,17 @@ OpenGL::VKGFXPipelineManager::GFXPipelineProps::GFXPipelineProps(IBackend*
                                                                  const Anvil::PrimitiveTopology&                in_primitive_topology,
                                                                  const Anvil::RenderPass*                       in_rp_ptr,
                                                                  const Anvil::SubPassID&                        in_subpass_id)
-    :device_ptr(in_backend_ptr->get_device_ptr() ),
-     gl_state  (in_context_state_ptr,
-                in_context_state_binding_refs_ptr),
-     rp_ptr    (in_rp_ptr)
+    :device_ptr    (in_backend_ptr->get_device_ptr() ),
+     gl_state      (in_context_state_ptr,
+                    in_context_state_binding_refs_ptr),
+     rp_ptr        (in_rp_ptr),
+     rp_manager_ptr(in_backend_ptr->get_renderpass_manager_ptr() )
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
+    /* The pipeline is baked lazily and keeps referring to the RP until then, so pin it. */
+    rp_manager_ptr->reference_render_pass(rp_ptr);
+
     auto gfx_pipeline_create_info_ptr = create_create_info_ptr(in_frontend_ptr->get_vao_manager_ptr (),
                                                                in_backend_ptr->get_spirv_manager_ptr(),
                                                                in_primitive_topology,
@@ -685,12 +694,15 @@ OpenGL::VKGFXPipelineManager::GFXPipelineProps::~GFXPipelineProps()
     {
         vkgl_assert_fail();
     }
+
+    rp_manager_ptr->release_render_pass(rp_ptr);
 }
 
 OpenGL::VKGFXPipelineManager::VKGFXPipelineManager(IBackend*                     in_backend_ptr,
                                                    const IContextObjectManagers* in_frontend_ptr)
-    :m_backend_ptr (in_backend_ptr),
-     m_frontend_ptr(in_frontend_ptr)
+    :m_backend_ptr             (in_backend_ptr),
+     m_frontend_ptr            (in_frontend_ptr),
+     m_gfx_pipeline_props_cache(g_n_max_cached_gfx_pipelines)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -723,87 +735,73 @@ OpenGL::GFXPipelineID OpenGL::VKGFXPipelineManager::get_pipeline_id(const OpenGL
                                                                     const OpenGL::GLContextStateBindingReferences* in_context_state_binding_refs_ptr,
                                                                     const Anvil::PrimitiveTopology&                in_primitive_topology,
                                                                     const Anvil::RenderPass*                       in_rp_ptr,
-                                                                    const Anvil::SubPassID&                        in_subpass_id)
+                                                                    const Anvil::SubPassID&                        in_subpass_id,
+                                                                    const uint64_t&                                in_timeline_value)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    const auto            gl_state      = GLState          (in_context_state_ptr,
-                                                            in_context_state_binding_refs_ptr);
-    const auto            gl_state_hash = gl_state.get_hash();
-    OpenGL::GFXPipelineID result        = UINT32_MAX;
-    const auto            rp_hash       = OpenGL::VKRenderpassManager::get_rp_hash(in_rp_ptr->get_render_pass_create_info() );
-
-    for (uint32_t n_iteration = 0;
-                  n_iteration < 2; /* ro access, rw access */
-                ++n_iteration)
+    const auto            gl_state          (GLState(in_context_state_ptr,
+                                                     in_context_state_binding_refs_ptr) );
+    const GFXPipelineKey  pipeline_key      (gl_state.get_hash(),
+                                               OpenGL::VKRenderpassManager::get_rp_hash(in_rp_ptr->get_render_pass_create_info() ),
+                                               in_subpass_id,
+                                               in_primitive_topology);
+    GFXPipelineProps*     pipeline_props_ptr(nullptr);
+    OpenGL::GFXPipelineID result            (UINT32_MAX);
+
+    pipeline_props_ptr = m_gfx_pipeline_props_cache.find(pipeline_key,
+                                                         in_timeline_value);
+
+    if (pipeline_props_ptr == nullptr)
     {
-        if (n_iteration == 0)
-        {
-            m_rw_mutex.lock_shared();
-        }
-        else
+        std::lock_guard<std::mutex> lock(m_create_mutex);
+
+        /* Another thread may have created the pipeline while we were waiting for the lock. */
+        pipeline_props_ptr = m_gfx_pipeline_props_cache.find(pipeline_key,
+                                                             in_timeline_value);
+
+        if (pipeline_props_ptr == nullptr)
         {
-            m_rw_mutex.lock_unique();
+            GFXPipelinePropsUniquePtr new_pipeline_props_ptr;
+
+            new_pipeline_props_ptr.reset(
+                new GFXPipelineProps(m_backend_ptr,
+                                     m_frontend_ptr,
+                                     in_context_state_ptr,
+                                     in_context_state_binding_refs_ptr,
+                                     in_primitive_topology,
+                                     in_rp_ptr,
+                                     in_subpass_id)
+            );
+            vkgl_assert(new_pipeline_props_ptr != nullptr);
+
+            pipeline_props_ptr = m_gfx_pipeline_props_cache.insert(pipeline_key,
+                                                                   std::move(new_pipeline_props_ptr),
+                                                                   in_timeline_value);
         }
-        {
-            auto gl_state_hash_iterator = m_gfx_pipeline_props_map.find(gl_state_hash);
+    }
 
-            if (gl_state_hash_iterator != m_gfx_pipeline_props_map.end() )
-            {
-                auto rp_hash_iterator = gl_state_hash_iterator->second.find(rp_hash);
+    vkgl_assert(VKRenderpassManager::is_rp_compatible(pipeline_props_ptr->get_rp_ptr()->get_render_pass_create_info(),
+                                                      in_rp_ptr->get_render_pass_create_info                      () ));
 
-                if (rp_hash_iterator                             != gl_state_hash_iterator->second.end() &&
-                    rp_hash_iterator->second.find(in_subpass_id) != rp_hash_iterator->second.end      () )
-                {
-                    auto subpass_iterator = rp_hash_iterator->second.find(in_subpass_id);
+    result = pipeline_props_ptr->get_pipeline_id();
 
-                    if (subpass_iterator->second.at(static_cast<uint32_t>(in_primitive_topology) ) != nullptr)
-                    {
-                        const auto& pipeline_props = *subpass_iterator->second.at(static_cast<uint32_t>(in_primitive_topology) );
+    vkgl_assert(result != UINT32_MAX);
+    return result;
+}
 
-                        vkgl_assert(VKRenderpassManager::is_rp_compatible(pipeline_props.get_rp_ptr()->get_render_pass_create_info(),
-                                                                          in_rp_ptr->get_render_pass_create_info                  () ));
+OpenGL::VKCacheStats OpenGL::VKGFXPipelineManager::pop_frame_stats()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
 
-                        result = subpass_iterator->second.at(static_cast<uint32_t>(in_primitive_topology) )->get_pipeline_id();
-                        vkgl_assert(result != UINT32_MAX);
+    return m_gfx_pipeline_props_cache.pop_stats();
+}
 
-                        break;
-                    }
-                }
-            }
+void OpenGL::VKGFXPipelineManager::trim(const uint64_t& in_completed_timeline_value)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
 
-            if (result      == UINT32_MAX &&
-                n_iteration == 1)
-            {
-                GFXPipelinePropsUniquePtr new_pipeline_props_ptr;
-
-                new_pipeline_props_ptr.reset(
-                    new GFXPipelineProps(m_backend_ptr,
-                                         m_frontend_ptr,
-                                         in_context_state_ptr,
-                                         in_context_state_binding_refs_ptr,
-                                         in_primitive_topology,
-                                         in_rp_ptr,
-                                         in_subpass_id)
-                );
-                vkgl_assert(new_pipeline_props_ptr != nullptr);
-
-                result = new_pipeline_props_ptr->get_pipeline_id();
-                vkgl_assert(result != UINT32_MAX);
-
-                m_gfx_pipeline_props_map[gl_state_hash][rp_hash][in_subpass_id][static_cast<uint32_t>(in_primitive_topology)] = std::move(new_pipeline_props_ptr);
-            }
-        }
-        if (n_iteration == 0)
-        {
-            m_rw_mutex.unlock_shared();
-        }
-        else
-        {
-            m_rw_mutex.unlock_unique();
-        }
-    }
+    std::lock_guard<std::mutex> lock(m_create_mutex);
 
-    vkgl_assert(result != UINT32_MAX);
-    return result;
+    m_gfx_pipeline_props_cache.trim(in_completed_timeline_value);
 }
@@ -6,8 +6,15 @@
 #include "Anvil/include/misc/render_pass_create_info.h"
 #include "Anvil/include/wrappers/render_pass.h"
 
+/* Renderpasses are cheap, but there's no reason to keep ones created for a resolution or attachment setup the app no
+ * longer uses.
+ */
+static const uint32_t g_n_max_cached_renderpasses = 128;
+
+
 OpenGL::VKRenderpassManager::VKRenderpassManager(IBackend* in_backend_ptr)
-    :m_backend_ptr(in_backend_ptr)
+    :m_backend_ptr     (in_backend_ptr),
+     m_renderpass_cache(g_n_max_cached_renderpasses)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -33,56 +40,131 @@ OpenGL::VKRenderpassManagerUniquePtr OpenGL::VKRenderpassManager::create(IBacken
     return result_ptr;
 }
 
-Anvil::RenderPass* OpenGL::VKRenderpassManager::get_render_pass(Anvil::RenderPassCreateInfoUniquePtr in_rp_create_info_ptr)
+Anvil::RenderPass* OpenGL::VKRenderpassManager::get_render_pass(Anvil::RenderPassCreateInfoUniquePtr in_rp_create_info_ptr,
+                                                                const uint64_t&                      in_timeline_value)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
     auto               in_rp_create_info_raw_ptr = in_rp_create_info_ptr.get();
     Anvil::RenderPass* result_ptr                = nullptr;
-    const auto         rp_hash                   = get_rp_hash(in_rp_create_info_raw_ptr);
+    const auto         rp_hash                   = get_rp_hash               (in_rp_create_info_raw_ptr);
+    const auto         rp_ops_hash               = get_rp_attachment_ops_hash(in_rp_create_info_raw_ptr);
 
-    m_rw_mutex.lock_shared();
+    const RenderPassKey rp_key(rp_hash,
+                               rp_ops_hash);
+
+    result_ptr = m_renderpass_cache.find(rp_key,
+                                         in_timeline_value);
+
+    if (result_ptr == nullptr)
     {
-        auto iterator = m_renderpass_ptr_map.find(rp_hash);
+        std::lock_guard<std::mutex> lock(m_create_mutex);
 
-        if (iterator != m_renderpass_ptr_map.end() )
+        /* Another thread may have created the RP while we were waiting for the lock. */
+        result_ptr = m_renderpass_cache.find(rp_key,
+                                             in_timeline_value);
+
+        if (result_ptr == nullptr)
         {
-            result_ptr = iterator->second;
+            auto rp_ptr = Anvil::RenderPass::create(std::move(in_rp_create_info_ptr),
+                                                    nullptr); /* in_opt_swapchain_ptr */
+
+            vkgl_assert(rp_ptr != nullptr);
+
+            result_ptr = m_renderpass_cache.insert(rp_key,
+                                                   std::move(rp_ptr),
+                                                   in_timeline_value);
         }
     }
-    m_rw_mutex.unlock_shared();
 
-    if (result_ptr == nullptr)
+    vkgl_assert(result_ptr                                                  != nullptr);
+    vkgl_assert(is_rp_compatible(result_ptr->get_render_pass_create_info(),
+                                 in_rp_create_info_raw_ptr) );
+
+    return result_ptr;
+}
+
+OpenGL::RenderPassHash OpenGL::VKRenderpassManager::get_rp_attachment_ops_hash(const Anvil::RenderPassCreateInfo* in_rp_create_info_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    const uint32_t n_rp_attachments = in_rp_create_info_ptr->get_n_attachments();
+    uint64_t       result_hash      = 0;
+
+    for (uint32_t n_rp_attachment = 0;
+                  n_rp_attachment < n_rp_attachments;
+                ++n_rp_attachment)
     {
-        m_rw_mutex.lock_unique();
+        Anvil::AttachmentType    rp_attachment_type = Anvil::AttachmentType::UNKNOWN;
+        Anvil::ImageLayout       final_layout       = Anvil::ImageLayout::UNKNOWN;
+        Anvil::ImageLayout       initial_layout     = Anvil::ImageLayout::UNKNOWN;
+        Anvil::AttachmentLoadOp  load_op            = Anvil::AttachmentLoadOp::DONT_CARE;
+        Anvil::AttachmentLoadOp  stencil_load_op    = Anvil::AttachmentLoadOp::DONT_CARE;
+        Anvil::AttachmentStoreOp stencil_store_op   = Anvil::AttachmentStoreOp::DONT_CARE;
+        Anvil::AttachmentStoreOp store_op           = Anvil::AttachmentStoreOp::DONT_CARE;
+
+        if (!in_rp_create_info_ptr->get_attachment_type(n_rp_attachment,
+                                                       &rp_attachment_type) )
         {
-            auto iterator = m_renderpass_ptr_map.find(rp_hash);
+            vkgl_assert_fail();
+        }
 
-            if (iterator != m_renderpass_ptr_map.end() )
+        switch (rp_attachment_type)
+        {
+            case Anvil::AttachmentType::COLOR:
             {
-                result_ptr = iterator->second;
+                in_rp_create_info_ptr->get_color_attachment_properties(n_rp_attachment,
+                                                                       nullptr, /* out_opt_format_ptr       */
+                                                                       nullptr, /* out_opt_sample_count_ptr */
+                                                                      &load_op,
+                                                                      &store_op,
+                                                                      &initial_layout,
+                                                                      &final_layout,
+                                                                       nullptr); /* out_opt_may_alias_ptr   */
+
+                break;
             }
-            else
-            {
-                auto rp_ptr = Anvil::RenderPass::create(std::move(in_rp_create_info_ptr),
-                                                        nullptr); /* in_opt_swapchain_ptr */
 
-                vkgl_assert(rp_ptr != nullptr);
+            case Anvil::AttachmentType::DEPTH_STENCIL:
+            {
+                in_rp_create_info_ptr->get_depth_stencil_attachment_properties(n_rp_attachment,
+                                                                               nullptr, /* out_opt_format_ptr       */
+                                                                               nullptr, /* out_opt_sample_count_ptr */
+                                                                              &load_op,
+                                                                              &store_op,
+                                                                              &stencil_load_op,
+                                                                              &stencil_store_op,
+                                                                              &initial_layout,
+                                                                              &final_layout,
+                                                                               nullptr); /* out_opt_may_alias_ptr   */
 
-                result_ptr                    = rp_ptr.get();
-                m_renderpass_ptr_map[rp_hash] = rp_ptr.get();
+                break;
+            }
 
-                m_renderpass_ptrs.push_back(std::move(rp_ptr) );
+            default:
+            {
+                vkgl_assert_fail();
             }
         }
-        m_rw_mutex.unlock_unique();
-    }
 
-    vkgl_assert(result_ptr                                                  != nullptr);
-    vkgl_assert(is_rp_compatible(result_ptr->get_render_pass_create_info(),
-                                 in_rp_create_info_raw_ptr) );
+        /* NOTE: Layouts introduced by extensions use large enum values, so the properties are combined rather than packed. */
+        const uint64_t attachment_props[] =
+        {
+            static_cast<uint64_t>(load_op),
+            static_cast<uint64_t>(store_op),
+            static_cast<uint64_t>(stencil_load_op),
+            static_cast<uint64_t>(stencil_store_op),
+            static_cast<uint64_t>(initial_layout),
+            static_cast<uint64_t>(final_layout)
+        };
 
-    return result_ptr;
+        for (const auto& current_prop : attachment_props)
+        {
+            result_hash = result_hash * 0x100000001b3ull ^ current_prop;
+        }
+    }
+
+    return result_hash;
 }
 
 OpenGL::RenderPassHash OpenGL::VKRenderpassManager::get_rp_hash(const Anvil::RenderPassCreateInfo* in_rp_create_info_ptr)
@@ -512,4 +594,51 @@ bool OpenGL::VKRenderpassManager::is_rp_compatible(const Anvil::RenderPassCreate
     result = true;
 end:
     return result;
-}
\ No newline at end of file
+}
+
+OpenGL::VKCacheStats OpenGL::VKRenderpassManager::pop_frame_stats()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    return m_renderpass_cache.pop_stats();
+}
+
+void OpenGL::VKRenderpassManager::reference_render_pass(const Anvil::RenderPass* in_rp_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::lock_guard<std::mutex> lock(m_references_mutex);
+
+    m_n_references_per_renderpass[in_rp_ptr]++;
+}
+
+void OpenGL::VKRenderpassManager::release_render_pass(const Anvil::RenderPass* in_rp_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::lock_guard<std::mutex> lock              (m_references_mutex);
+    auto                        reference_iterator(m_n_references_per_renderpass.find(in_rp_ptr) );
+
+    vkgl_assert(reference_iterator         != m_n_references_per_renderpass.end() );
+    vkgl_assert(reference_iterator->second >  0);
+
+    if (--reference_iterator->second == 0)
+    {
+        m_n_references_per_renderpass.erase(reference_iterator);
+    }
+}
+
+void OpenGL::VKRenderpassManager::trim(const uint64_t& in_completed_timeline_value)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::lock_guard<std::mutex> lock(m_create_mutex);
+
+    m_renderpass_cache.trim(in_completed_timeline_value,
+                            [this](const Anvil::RenderPass* in_rp_ptr)
+                            {
+                                std::lock_guard<std::mutex> references_lock(m_references_mutex);
+
+                                return (m_n_references_per_renderpass.find(in_rp_ptr) == m_n_references_per_renderpass.end() );
+                            });
+}
@@ -3,9 +3,16 @@
  * This code is licensed under MIT license (see LICENSE.txt for details)
  */
 #include "OpenGL/backend/vk_backend.h"
+#include "OpenGL/backend/vk_buffer_manager.h"
 #include "OpenGL/backend/vk_frame_graph.h"
+#include "OpenGL/backend/vk_framebuffer_manager.h"
+#include "OpenGL/backend/vk_gfx_pipeline_manager.h"
+#include "OpenGL/backend/vk_renderpass_manager.h"
 #include "OpenGL/backend/vk_scheduler.h"
+#include "OpenGL/backend/vk_spirv_manager.h"
+#include "OpenGL/backend/vk_sync_object_pool.h"
 #include "OpenGL/backend/nodes/vk_buffer_data_node.h"
+#include "OpenGL/backend/nodes/vk_buffer_map_copy_node.h"
 #include "OpenGL/backend/nodes/vk_buffer_sub_data_node.h"
 #include "OpenGL/backend/nodes/vk_clear_node.h"
 #include "OpenGL/backend/nodes/vk_draw_node.h"
@@ -13,15 +20,64 @@
 #include "OpenGL/frontend/gl_buffer_manager.h"
 #include "Common/fence.h"
 #include "Common/logger.h"
+#include "Common/trace_recorder.h"
 
 #define N_MAX_SCHEDULED_COMMANDS_LOG_2 (16)
 #define WAIT_PERIOD_MS                 (1000)
 
+/* Trace event names. Indexed with OpenGL::CommandType. */
+static const char* g_command_type_names[] =
+{
+    "Acquire swapchain image",
+    "Buffer data",
+    "Buffer sub data",
+    "Clear",
+    "Compressed tex image 1D",
+    "Compressed tex image 2D",
+    "Compressed tex image 3D",
+    "Compressed tex sub image 1D",
+    "Compressed tex sub image 2D",
+    "Compressed tex sub image 3D",
+    "Copy buffer sub data",
+    "Copy tex image 1D",
+    "Copy tex image 2D",
+    "Copy tex sub image 1D",
+    "Copy tex sub image 2D",
+    "Copy tex sub image 3D",
+    "Draw arrays",
+    "Draw elements",
+    "Draw range elements",
+    "Finish",
+    "Flush",
+    "Get buffer sub data",
+    "Get compressed tex image",
+    "Get texture image",
+    "Map buffer",
+    "Multi draw arrays",
+    "Multi draw elements",
+    "Present",
+    "Read pixels",
+    "Tex image 1D",
+    "Tex image 2D",
+    "Tex image 3D",
+    "Tex sub image 1D",
+    "Tex sub image 2D",
+    "Tex sub image 3D",
+    "Generate mipmap",
+    "Unmap buffer",
+    "Validate program",
+};
+
+static_assert(sizeof(g_command_type_names) / sizeof(g_command_type_names[0]) == static_cast<size_t>(OpenGL::CommandType::UNKNOWN),
+              "g_command_type_names[] is out of sync with OpenGL::CommandType");
+
 OpenGL::VKScheduler::VKScheduler(const IContextObjectManagers* in_frontend_ptr,
                                  IBackend*                     in_backend_ptr)
-    :m_backend_ptr (in_backend_ptr),
-     m_frontend_ptr(in_frontend_ptr),
-     m_terminating (false)
+    :m_backend_ptr                 (in_backend_ptr),
+     m_deferred_draw_wait_time_us  (0),
+     m_frontend_ptr                (in_frontend_ptr),
+     m_n_deferred_draws            (0),
+     m_terminating                 (false)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -115,6 +171,8 @@ void OpenGL::VKScheduler::main_thread_entrypoint()
     VKGL::g_logger_ptr->log(VKGL::LogLevel::Info,
                             "VK scheduler thread started.");
 
+    VKGL::TraceRecorder::set_thread_name("VKGL scheduler thread");
+
     do
     {
         OpenGL::CommandBaseUniquePtr command_ptr;
@@ -143,6 +201,23 @@ void OpenGL::VKScheduler::main_thread_entrypoint()
                             "VK scheduler thread quitting now.");
 }
 
+void OpenGL::VKScheduler::prepare_program_for_deferred_draw(const OpenGL::GLProgramReference*      in_program_reference_ptr,
+                                                             const OpenGL::GLContextStateReference* in_state_reference_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    const auto start_time = std::chrono::steady_clock::now();
+    bool       result     = false;
+
+    result = m_backend_ptr->get_spirv_manager_ptr()->prepare_program_for_draw(in_program_reference_ptr,
+                                                                              in_state_reference_ptr,
+                                                                              true); /* in_wait_for_link */
+    vkgl_assert(result);
+
+    m_deferred_draw_wait_time_us += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count() );
+    m_n_deferred_draws           ++;
+}
+
 void OpenGL::VKScheduler::process_buffer_data_command(OpenGL::CommandBaseUniquePtr in_command_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
@@ -248,6 +323,7 @@ void OpenGL::VKScheduler::process_clear_command(OpenGL::ClearCommand* in_command
 void OpenGL::VKScheduler::process_command(OpenGL::CommandBaseUniquePtr in_command_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
+    VKGL_TRACE_SCOPE(g_command_type_names[static_cast<uint32_t>(in_command_ptr->type)]);
     
     switch (in_command_ptr->type)
     {
@@ -271,7 +347,6 @@ void OpenGL::VKScheduler::process_command(OpenGL::CommandBaseUniquePtr in_comman
         case OpenGL::CommandType::DRAW_RANGE_ELEMENTS:         process_draw_range_elements_command        (dynamic_cast<OpenGL::DrawRangeElementsCommand*>      (in_command_ptr.get() )); break;
         case OpenGL::CommandType::FINISH:                      process_finish_command                     (dynamic_cast<OpenGL::FinishCommand*>                 (in_command_ptr.get() )); break;
         case OpenGL::CommandType::FLUSH:                       process_flush_command                      (dynamic_cast<OpenGL::FlushCommand*>                  (in_command_ptr.get() )); break;
-        case OpenGL::CommandType::FLUSH_MAPPED_BUFFER_RANGE:   process_flush_mapped_buffer_range_command  (dynamic_cast<OpenGL::FlushMappedBufferRangeCommand*> (in_command_ptr.get() )); break;
         case OpenGL::CommandType::GET_BUFFER_SUB_DATA:         process_get_buffer_sub_data_command        (dynamic_cast<OpenGL::GetBufferSubDataCommand*>       (in_command_ptr.get() )); break;
         case OpenGL::CommandType::GET_COMPRESSED_TEX_IMAGE:    process_get_compressed_tex_image_command   (dynamic_cast<OpenGL::GetCompressedTexImageCommand*>  (in_command_ptr.get() )); break;
         case OpenGL::CommandType::GET_TEXTURE_IMAGE:           process_get_texture_image_command          (dynamic_cast<OpenGL::GetTextureImageCommand*>        (in_command_ptr.get() )); break;
@@ -396,7 +471,14 @@ void OpenGL::VKScheduler::process_draw_arrays_command(OpenGL::CommandBaseUniqueP
 
     vkgl_assert(command_ptr != nullptr);
 
-    /* 1. Spawn the node */
+    /* 1. Prepare the program if app's thread could not, because it was still being linked at the time. */
+    if (command_ptr->is_program_link_pending)
+    {
+        prepare_program_for_deferred_draw(command_ptr->state_binding_references_ptr->program_reference_ptr.get(),
+                                          command_ptr->state_reference_ptr.get() );
+    }
+
+    /* 2. Spawn the node */
     {
         node_ptr = OpenGL::VKNodes::Draw::create(OpenGL::VKNodes::DrawType::Regular,
                                                  m_frontend_ptr,
@@ -410,7 +492,7 @@ void OpenGL::VKScheduler::process_draw_arrays_command(OpenGL::CommandBaseUniqueP
                                                  UINT32_MAX); /* in_opt_index_buffer_offset */
     }
 
-    /* 2. Submit the node to frame graph manager. */
+    /* 3. Submit the node to frame graph manager. */
     backend_frame_graph_ptr->add_node(std::move(node_ptr) );
 }
 
@@ -423,7 +505,14 @@ void OpenGL::VKScheduler::process_draw_elements_command(OpenGL::DrawElementsComm
 
     vkgl_assert(in_command_ptr != nullptr);
 
-    /* 1. Spawn the node */
+    /* 1. Prepare the program if app's thread could not, because it was still being linked at the time. */
+    if (in_command_ptr->is_program_link_pending)
+    {
+        prepare_program_for_deferred_draw(in_command_ptr->state_binding_references_ptr->program_reference_ptr.get(),
+                                          in_command_ptr->state_reference_ptr.get() );
+    }
+
+    /* 2. Spawn the node */
     {
         node_ptr = OpenGL::VKNodes::Draw::create(OpenGL::VKNodes::DrawType::Indexed,
                                                  m_frontend_ptr,
@@ -437,7 +526,7 @@ void OpenGL::VKScheduler::process_draw_elements_command(OpenGL::DrawElementsComm
                                                  in_command_ptr->index_buffer_offset);
     }
 
-    /* 2. Submit the node to frame graph manager. */
+    /* 3. Submit the node to frame graph manager. */
     backend_frame_graph_ptr->add_node(std::move(node_ptr) );
 }
 
@@ -466,13 +555,6 @@ void OpenGL::VKScheduler::process_flush_command(OpenGL::FlushCommand* in_command
                                                   in_command_ptr->fence_ptr);
 }
 
-void OpenGL::VKScheduler::process_flush_mapped_buffer_range_command(OpenGL::FlushMappedBufferRangeCommand* in_command_ptr)
-{
-    FUN_ENTRY(DEBUG_DEPTH);
-    
-    vkgl_not_implemented();
-}
-
 void OpenGL::VKScheduler::process_get_buffer_sub_data_command(OpenGL::GetBufferSubDataCommand* in_command_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
@@ -498,7 +580,54 @@ void OpenGL::VKScheduler::process_map_buffer_command(OpenGL::MapBufferCommand* i
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    vkgl_not_implemented();
+    auto                               backend_buffer_manager_ptr   = m_backend_ptr->get_buffer_manager_ptr();
+    OpenGL::VKBufferReferenceUniquePtr backend_buffer_reference_ptr;
+    auto                               backend_frame_graph_ptr      = m_backend_ptr->get_frame_graph_ptr   ();
+    std::vector<Anvil::BufferCopy>     copy_regions;
+    OpenGL::VKFrameGraphNodeUniquePtr  node_ptr;
+
+    vkgl_assert(in_command_ptr                       != nullptr);
+    vkgl_assert(in_command_ptr->buffer_reference_ptr != nullptr);
+
+    const auto& frontend_buffer_creation_time = in_command_ptr->buffer_reference_ptr->get_payload().object_creation_time;
+    const auto& frontend_buffer_id            = in_command_ptr->buffer_reference_ptr->get_payload().id;
+    const auto& frontend_buffer_snapshot_time = in_command_ptr->buffer_reference_ptr->get_payload().time_marker;
+    const auto  frontend_buffer_size          = m_frontend_ptr->get_buffer_manager_ptr()->get_buffer_size(frontend_buffer_id,
+                                                                                                         &frontend_buffer_snapshot_time);
+
+    /* 1. Retrieve backend buffer reference */
+    {
+        backend_buffer_reference_ptr = backend_buffer_manager_ptr->acquire_object(frontend_buffer_id,
+                                                                                  frontend_buffer_creation_time,
+                                                                                  frontend_buffer_snapshot_time);
+
+        vkgl_assert(backend_buffer_reference_ptr != nullptr);
+    }
+
+    /* 2. Spawn a node which reads back the whole buffer. Subsequent maps are going to be served from the backing,
+     *    so there's no point in restricting the copy to the range the app has asked for.
+     */
+    {
+        Anvil::BufferCopy region;
+
+        region.dst_offset = 0;
+        region.size       = frontend_buffer_size;
+        region.src_offset = 0;
+
+        copy_regions.push_back(region);
+
+        node_ptr = OpenGL::VKNodes::BufferMapCopy::create(m_backend_ptr,
+                                                          OpenGL::VKNodes::BufferMapCopyDirection::Buffer_To_Backing,
+                                                          std::move(backend_buffer_reference_ptr),
+                                                          in_command_ptr->backing_ptr,
+                                                          copy_regions);
+    }
+
+    /* 3. Submit the node to frame graph manager and flush. The app thread is blocked until the fence is signaled. */
+    backend_frame_graph_ptr->add_node(std::move(node_ptr) );
+
+    backend_frame_graph_ptr->execute(true, /* in_block_until_finished */
+                                     in_command_ptr->fence_ptr);
 }
 
 void OpenGL::VKScheduler::process_multi_draw_arrays_command(OpenGL::MultiDrawArraysCommand* in_command_ptr)
@@ -531,6 +660,142 @@ void OpenGL::VKScheduler::process_present_command(OpenGL::PresentCommand* in_com
 
     /* 2. Submit the node to frame graph manager. */
     backend_frame_graph_ptr->add_node(std::move(node_ptr) );
+
+    /* 3. Report buffer allocation activity for the frame. In steady state, all requests should be served from the pool. */
+    {
+        const auto stats = m_backend_ptr->get_buffer_manager_ptr()->pop_frame_stats();
+
+        if (stats.n_buffers_created         != 0 ||
+            stats.n_memory_blocks_allocated != 0)
+        {
+            vkgl_printf("Frame buffer allocations: vkCreateBuffer: %u, memory blocks: %u, recycled: %u, pooled: %u, slab sub-allocations: %u, slabs: %u",
+                        stats.n_buffers_created,
+                        stats.n_memory_blocks_allocated,
+                        stats.n_buffers_recycled,
+                        stats.n_pooled_buffers,
+                        stats.n_slab_suballocations,
+                        stats.n_slabs);
+        }
+    }
+
+    /* 4. Ditto for synchronization and submissions. */
+    {
+        const auto stats = backend_frame_graph_ptr->pop_frame_stats();
+
+        vkgl_printf("Frame barriers: vkCmdPipelineBarrier: %u, vkCmdSetEvent: %u, vkCmdWaitEvents: %u, buffer barriers: %u, image barriers: %u "
+                    "(dropped: %u, merged: %u, hoisted barrier sets: %u)",
+                    stats.n_pipeline_barrier_cmds,
+                    stats.n_set_event_cmds,
+                    stats.n_wait_events_cmds,
+                    stats.n_buffer_barriers,
+                    stats.n_image_barriers,
+                    stats.n_barriers_dropped,
+                    stats.n_barriers_merged,
+                    stats.n_barriers_hoisted);
+        vkgl_printf("Frame submissions: %u (%u without node reordering)",
+                    stats.n_submissions,
+                    stats.n_submissions_without_reordering);
+        vkgl_printf("Frame render passes: clears folded into load ops: %u, depth/stencil stores discarded: %u",
+                    stats.n_clears_folded_into_load_ops,
+                    stats.n_attachment_stores_discarded);
+        vkgl_printf("Frame command buffers: allocated: %u, recycled: %u (command pools created: %u)",
+                    stats.n_command_buffers_allocated,
+                    stats.n_command_buffers_recycled,
+                    stats.n_command_pools_created);
+        vkgl_printf("Frame pacing: executions in flight: %u, CPU wait: %.2f ms, GPU wait: %.2f ms",
+                    stats.n_executions_in_flight,
+                    static_cast<float>(stats.cpu_wait_time_us) / 1000.0f,
+                    static_cast<float>(stats.gpu_idle_time_us) / 1000.0f);
+    }
+
+    /* 5. Report sync object creation. High-water marks can only grow when the pool runs dry, so stay quiet otherwise. */
+    {
+        const auto stats = m_backend_ptr->get_sync_object_pool_ptr()->pop_frame_stats();
+
+        if (stats.n_events_created     != 0 ||
+            stats.n_fences_created     != 0 ||
+            stats.n_semaphores_created != 0)
+        {
+            vkgl_printf("Frame sync objects: vkCreateEvent: %u, vkCreateFence: %u, vkCreateSemaphore: %u, recycled: %u/%u/%u, "
+                        "in use max: %u/%u/%u (events/fences/semaphores)",
+                        stats.n_events_created,
+                        stats.n_fences_created,
+                        stats.n_semaphores_created,
+                        stats.n_events_recycled,
+                        stats.n_fences_recycled,
+                        stats.n_semaphores_recycled,
+                        stats.n_events_in_use_max,
+                        stats.n_fences_in_use_max,
+                        stats.n_semaphores_in_use_max);
+        }
+    }
+
+    /* 6. Report cache churn. Hits alone are not worth a line. */
+    {
+        const OpenGL::VKCacheStats stats[] =
+        {
+            m_backend_ptr->get_renderpass_manager_ptr  ()->pop_frame_stats(),
+            m_backend_ptr->get_framebuffer_manager_ptr ()->pop_frame_stats(),
+            m_backend_ptr->get_gfx_pipeline_manager_ptr()->pop_frame_stats()
+        };
+        const char* const cache_names[] =
+        {
+            "render passes",
+            "framebuffers",
+            "pipelines"
+        };
+
+        for (uint32_t n_cache = 0;
+                      n_cache < sizeof(stats) / sizeof(stats[0]);
+                    ++n_cache)
+        {
+            const auto& current_stats = stats[n_cache];
+
+            if (current_stats.n_evictions != 0 ||
+                current_stats.n_misses    != 0 ||
+                current_stats.n_releases  != 0)
+            {
+                vkgl_printf("Frame cache (%s): entries: %u/%u, hits: %u, misses: %u, evictions: %u, released: %u, pending release: %u",
+                            cache_names[n_cache],
+                            current_stats.n_entries,
+                            current_stats.n_entries_max,
+                            current_stats.n_hits,
+                            current_stats.n_misses,
+                            current_stats.n_evictions,
+                            current_stats.n_releases,
+                            current_stats.n_pending_releases);
+            }
+        }
+    }
+
+    /* 7. Report program links. Links & modules served from the cache are the interesting part when apps create many
+     *    programs out of the same shaders.
+     */
+    {
+        const auto stats = m_backend_ptr->get_spirv_manager_ptr()->pop_frame_stats();
+
+        if (stats.n_program_links + stats.n_program_link_cache_hits != 0)
+        {
+            vkgl_printf("Frame program links: glslang: %u, reused: %u, shader modules created: %u, shader modules reused: %u",
+                        stats.n_program_links,
+                        stats.n_program_link_cache_hits,
+                        stats.n_shader_modules_created,
+                        stats.n_shader_module_cache_hits);
+        }
+    }
+
+    /* 8. Report draws which had to wait for their program's link to finish. Non-zero wait times mean the app started
+     *    drawing with a program before GL_COMPLETION_STATUS_KHR reported it as complete.
+     */
+    if (m_n_deferred_draws != 0)
+    {
+        vkgl_printf("Frame draws deferred until link completion: %u, link wait: %.2f ms",
+                    m_n_deferred_draws,
+                    static_cast<float>(m_deferred_draw_wait_time_us) / 1000.0f);
+
+        m_deferred_draw_wait_time_us = 0;
+        m_n_deferred_draws           = 0;
+    }
 }
 
 void OpenGL::VKScheduler::process_read_pixels_command(OpenGL::ReadPixelsCommand* in_command_ptr)
@@ -593,7 +858,38 @@ void OpenGL::VKScheduler::process_unmap_buffer_command(OpenGL::UnmapBufferComman
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    vkgl_not_implemented();
+    auto                               backend_buffer_manager_ptr   = m_backend_ptr->get_buffer_manager_ptr();
+    OpenGL::VKBufferReferenceUniquePtr backend_buffer_reference_ptr;
+    auto                               backend_frame_graph_ptr      = m_backend_ptr->get_frame_graph_ptr   ();
+    OpenGL::VKFrameGraphNodeUniquePtr  node_ptr;
+
+    vkgl_assert(in_command_ptr                       != nullptr);
+    vkgl_assert(in_command_ptr->buffer_reference_ptr != nullptr);
+
+    const auto& frontend_buffer_creation_time = in_command_ptr->buffer_reference_ptr->get_payload().object_creation_time;
+    const auto& frontend_buffer_id            = in_command_ptr->buffer_reference_ptr->get_payload().id;
+    const auto& frontend_buffer_snapshot_time = in_command_ptr->buffer_reference_ptr->get_payload().time_marker;
+
+    /* 1. Retrieve backend buffer reference */
+    {
+        backend_buffer_reference_ptr = backend_buffer_manager_ptr->acquire_object(frontend_buffer_id,
+                                                                                  frontend_buffer_creation_time,
+                                                                                  frontend_buffer_snapshot_time);
+
+        vkgl_assert(backend_buffer_reference_ptr != nullptr);
+    }
+
+    /* 2. Spawn the node */
+    {
+        node_ptr = OpenGL::VKNodes::BufferMapCopy::create(m_backend_ptr,
+                                                          OpenGL::VKNodes::BufferMapCopyDirection::Backing_To_Buffer,
+                                                          std::move(backend_buffer_reference_ptr),
+                                                          in_command_ptr->backing_ptr,
+                                                          in_command_ptr->copy_regions);
+    }
+
+    /* 3. Submit the node to frame graph manager. */
+    backend_frame_graph_ptr->add_node(std::move(node_ptr) );
 }
 
 void OpenGL::VKScheduler::process_validate_program_command(OpenGL::ValidateProgramCommand* in_command_ptr)
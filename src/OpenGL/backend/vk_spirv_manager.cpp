@@ -16,10 +16,13 @@
 #include "OpenGL/frontend/gl_program_manager.h"
 #include "OpenGL/frontend/gl_shader_manager.h"
 #include "OpenGL/frontend/gl_state_manager.h"
+#include "OpenGL/frontend/gl_texture_manager.h"
 #include "OpenGL/frontend/gl_buffer_manager.h"
 #include "OpenGL/utils_enum.h"
 #include "vkgl_limits.h"
 
+#include <algorithm>
+#include <cstring>
 #include <regex>
 
 #ifdef max
@@ -33,6 +36,58 @@
 
 #define VKGL_DEFAULT_UNIFORM_BLOCK_NAME "gl_DefaultUniformBlock"
 
+namespace
+{
+    uint64_t get_fnv1a_hash(const void*   in_data_ptr,
+                            const size_t& in_n_bytes,
+                            uint64_t      in_hash = 0xcbf29ce484222325ull)
+    {
+        const uint8_t* data_u8_ptr = reinterpret_cast<const uint8_t*>(in_data_ptr);
+
+        for (size_t n_byte = 0;
+                    n_byte < in_n_bytes;
+                  ++n_byte)
+        {
+            in_hash = (in_hash ^ data_u8_ptr[n_byte]) * 0x100000001b3ull;
+        }
+
+        return in_hash;
+    }
+
+    /* Appends the number of entries, followed by per-entry hashes in sorted order, so that the result does not depend
+     * on the map's iteration order.
+     */
+    void append_name_to_location_map_hashes(const std::unordered_map<std::string, uint32_t>& in_map,
+                                            std::vector<uint64_t>*                           out_hashes_ptr)
+    {
+        std::vector<uint64_t> entry_hashes;
+
+        for (const auto& current_entry : in_map)
+        {
+            entry_hashes.push_back(get_fnv1a_hash(current_entry.first.c_str(),
+                                                  current_entry.first.size() ) ^ (static_cast<uint64_t>(current_entry.second) * 0x9E3779B97F4A7C15ull) );
+        }
+
+        std::sort(entry_hashes.begin(),
+                  entry_hashes.end  () );
+
+        out_hashes_ptr->push_back(entry_hashes.size() );
+        out_hashes_ptr->insert   (out_hashes_ptr->end(),
+                                  entry_hashes.begin(),
+                                  entry_hashes.end  () );
+    }
+};
+
+OpenGL::VKSPIRVManager::LinkedProgram::LinkedProgram()
+    :link_status    (false),
+     ready_fence_ptr(new VKGL::Fence(),
+                     std::default_delete<VKGL::Fence>() )
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    vkgl_assert(ready_fence_ptr != nullptr);
+}
+
 
 OpenGL::VKSPIRVManager::ProgramData::ProgramData(const SPIRVBlobID&                  in_id,
                                                  const std::vector<ShaderData*>&     in_shader_ptrs,
@@ -62,6 +117,7 @@ OpenGL::VKSPIRVManager::ShaderData::ShaderData(const SPIRVBlobID&        in_id,
      glsl                  (in_glsl),
      id                    (in_id),
      sm_entrypoint_name    (nullptr),
+     spirv_blob_hash       (0),
      type                  (in_shader_type)
 {
     FUN_ENTRY(DEBUG_DEPTH);
@@ -76,9 +132,13 @@ OpenGL::VKSPIRVManager::ShaderData::ShaderData(const SPIRVBlobID&        in_id,
 
 OpenGL::VKSPIRVManager::VKSPIRVManager(IBackend*                             in_backend_ptr,
                                        const OpenGL::IContextObjectManagers* in_frontend_ptr)
-    :m_backend_ptr          (in_backend_ptr),
-     m_frontend_ptr         (in_frontend_ptr),
-     m_n_entities_registered(0)
+    :m_backend_ptr               (in_backend_ptr),
+     m_frontend_ptr              (in_frontend_ptr),
+     m_n_entities_registered     (0),
+     m_n_program_link_cache_hits (0),
+     m_n_program_links           (0),
+     m_n_shader_module_cache_hits(0),
+     m_n_shader_modules_created  (0)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -91,6 +151,14 @@ OpenGL::VKSPIRVManager::~VKSPIRVManager()
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
+    /* Release unregistered programs which have not been reclaimed yet, while the device is still around. */
+    VKGL::Epoch::reclaim();
+
+    /* Registered programs own link results & shader modules, whose deleters access the caches. Release them while
+     * the caches are still around.
+     */
+    m_program_data_ptrs.clear();
+
     glslang::FinalizeProcess();
 }
 
@@ -177,6 +245,9 @@ vkgl_printf(">>>>COMPILATION_LOG>>>>\n%s\n>>>>>>>>", in_shader_data_ptr->compila
             memcpy(&in_shader_data_ptr->spirv_blob.at(0),
                    &result_spirv_blob.at(0),
                     in_shader_data_ptr->spirv_blob.size() );
+
+            in_shader_data_ptr->spirv_blob_hash = get_fnv1a_hash(&in_shader_data_ptr->spirv_blob.at(0),
+                                                                  in_shader_data_ptr->spirv_blob.size() );
         }
     }
 
@@ -475,24 +546,42 @@ bool OpenGL::VKSPIRVManager::get_program_link_status(const SPIRVBlobID& in_spirv
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    bool result = false;
+    VKGL::EpochReadLock lock;
+    ProgramData*        program_data_ptr = nullptr;
+    bool                result           = false;
 
-    m_mutex.lock_shared();
+    if (m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id,
+                                                &program_data_ptr) )
     {
-        auto iterator = m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id);
+        vkgl_assert(program_data_ptr->link_task_fence_ptr != nullptr);
 
-        if (iterator != m_spirv_blob_id_to_program_data_map.end() )
-        {
-            vkgl_assert(iterator->second->link_task_fence_ptr != nullptr);
+        program_data_ptr->link_task_fence_ptr->wait();
 
-            iterator->second->link_task_fence_ptr->wait();
+        result            = true;
+        if (out_status_ptr) { *out_status_ptr   = program_data_ptr->link_status; }
+        if (out_link_log_ptr) { *out_link_log_ptr = program_data_ptr->link_log.c_str(); }
+    }
 
-            result            = true;
-            if (out_status_ptr) { *out_status_ptr   = iterator->second->link_status; }
-            if (out_link_log_ptr) { *out_link_log_ptr = iterator->second->link_log.c_str(); }
-        }
+    return result;
+}
+
+bool OpenGL::VKSPIRVManager::get_program_link_completion_status(const SPIRVBlobID& in_spirv_blob_id,
+                                                                bool*              out_is_complete_ptr) const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    VKGL::EpochReadLock lock;
+    ProgramData*        program_data_ptr = nullptr;
+    bool                result           = false;
+
+    if (m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id,
+                                                &program_data_ptr) )
+    {
+        vkgl_assert(program_data_ptr->link_task_fence_ptr != nullptr);
+
+        *out_is_complete_ptr = program_data_ptr->link_task_fence_ptr->is_signaled();
+        result               = true;
     }
-    m_mutex.unlock_shared();
 
     return result;
 }
@@ -502,19 +591,16 @@ bool OpenGL::VKSPIRVManager::get_spirv_blob_id_for_glsl(const char*          in_
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    bool result = false;
+    VKGL::EpochReadLock lock;
+    ShaderData*         shader_data_ptr = nullptr;
+    bool                result          = false;
 
-    m_mutex.lock_shared();
+    if (m_glsl_to_shader_data_map.find(std::string(in_glsl_ptr),
+                                      &shader_data_ptr) )
     {
-        auto iterator = m_glsl_to_shader_data_map.find(std::string(in_glsl_ptr) );
-
-        if (iterator != m_glsl_to_shader_data_map.end() )
-        {
-            if (out_result_ptr) { *out_result_ptr = iterator->second->id; }
-            result          = true;
-        }
+        if (out_result_ptr) { *out_result_ptr = shader_data_ptr->id; }
+        result          = true;
     }
-    m_mutex.unlock_shared();
 
     return result;
 }
@@ -525,19 +611,16 @@ bool OpenGL::VKSPIRVManager::get_spirv_blob_id_for_program_reference(const GLuin
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    bool result = false;
+    VKGL::EpochReadLock lock;
+    ProgramData*        program_data_ptr = nullptr;
+    bool                result           = false;
 
-    m_mutex.lock_shared();
+    if (m_program_reference_to_program_data_map.find(ProgramReference(in_program_id, in_time_marker),
+                                                    &program_data_ptr) )
     {
-        auto iterator = m_program_reference_to_program_data_map.find(std::pair<GLuint, OpenGL::TimeMarker>(in_program_id, in_time_marker) );
-
-        if (iterator != m_program_reference_to_program_data_map.end() )
-        {
-            if (out_result_ptr) { *out_result_ptr = iterator->second->id; }
-            result          = true;
-        }
+        if (out_result_ptr) { *out_result_ptr = program_data_ptr->id; }
+        result          = true;
     }
-    m_mutex.unlock_shared();
 
     return result;
 }
@@ -548,24 +631,42 @@ bool OpenGL::VKSPIRVManager::get_shader_compilation_status(const SPIRVBlobID& in
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    bool result = false;
+    VKGL::EpochReadLock lock;
+    ShaderData*         shader_data_ptr = nullptr;
+    bool                result          = false;
 
-    m_mutex.lock_shared();
+    if (m_spirv_blob_id_to_shader_data_map.find(in_spirv_blob_id,
+                                               &shader_data_ptr) )
     {
-        auto iterator = m_spirv_blob_id_to_shader_data_map.find(in_spirv_blob_id);
+        vkgl_assert(shader_data_ptr->compile_task_fence_ptr != nullptr);
 
-        if (iterator != m_spirv_blob_id_to_shader_data_map.end() )
-        {
-            vkgl_assert(iterator->second->compile_task_fence_ptr != nullptr);
+        shader_data_ptr->compile_task_fence_ptr->wait();
+
+        result                   = true;
+        if (out_status_ptr) 		{ *out_status_ptr          = shader_data_ptr->compilation_status; }
+        if (out_compilation_log_ptr) { *out_compilation_log_ptr = shader_data_ptr->compilation_log.c_str(); }
+    }
 
-            iterator->second->compile_task_fence_ptr->wait();
+    return result;
+}
 
-            result                   = true;
-            if (out_status_ptr) 		{ *out_status_ptr          = iterator->second->compilation_status; }
-            if (out_compilation_log_ptr) { *out_compilation_log_ptr = iterator->second->compilation_log.c_str(); }
-        }
+bool OpenGL::VKSPIRVManager::get_shader_compilation_completion_status(const SPIRVBlobID& in_spirv_blob_id,
+                                                                      bool*              out_is_complete_ptr) const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    VKGL::EpochReadLock lock;
+    ShaderData*         shader_data_ptr = nullptr;
+    bool                result          = false;
+
+    if (m_spirv_blob_id_to_shader_data_map.find(in_spirv_blob_id,
+                                               &shader_data_ptr) )
+    {
+        vkgl_assert(shader_data_ptr->compile_task_fence_ptr != nullptr);
+
+        *out_is_complete_ptr = shader_data_ptr->compile_task_fence_ptr->is_signaled();
+        result               = true;
     }
-    m_mutex.unlock_shared();
 
     return result;
 }
@@ -576,23 +677,20 @@ bool OpenGL::VKSPIRVManager::get_shader_module_ptr(const SPIRVBlobID&        in_
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    bool result = false;
+    VKGL::EpochReadLock lock;
+    ProgramData*        program_data_ptr = nullptr;
+    bool                result           = false;
 
-    m_mutex.lock_shared();
+    if (m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id,
+                                                &program_data_ptr) )
     {
-        auto iterator = m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id);
-
-        if (iterator != m_spirv_blob_id_to_program_data_map.end() )
-        {
-            vkgl_assert(iterator->second->link_task_fence_ptr != nullptr);
+        vkgl_assert(program_data_ptr->link_task_fence_ptr != nullptr);
 
-            iterator->second->link_task_fence_ptr->wait();
+        program_data_ptr->link_task_fence_ptr->wait();
 
-            result              = true;
-            if (out_result_ptr_ptr) { *out_result_ptr_ptr = iterator->second->shader_module_ptrs[static_cast<uint32_t>(in_shader_type)].get(); }
-        }
+        result              = true;
+        if (out_result_ptr_ptr) { *out_result_ptr_ptr = program_data_ptr->shader_module_ptrs[static_cast<uint32_t>(in_shader_type)].get(); }
     }
-    m_mutex.unlock_shared();
 
     return result;
 }
@@ -603,28 +701,25 @@ bool OpenGL::VKSPIRVManager::get_spirv_blob(const SPIRVBlobID& in_spirv_blob_id,
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    bool result = false;
+    VKGL::EpochReadLock lock;
+    ShaderData*         shader_data_ptr = nullptr;
+    bool                result          = false;
 
-    m_mutex.lock_shared();
+    if (m_spirv_blob_id_to_shader_data_map.find(in_spirv_blob_id,
+                                               &shader_data_ptr) )
     {
-        auto iterator = m_spirv_blob_id_to_shader_data_map.find(in_spirv_blob_id);
+        vkgl_assert(shader_data_ptr->compile_task_fence_ptr != nullptr);
 
-        if (iterator != m_spirv_blob_id_to_shader_data_map.end() )
-        {
-            vkgl_assert(iterator->second->compile_task_fence_ptr != nullptr);
-
-            iterator->second->compile_task_fence_ptr->wait();
+        shader_data_ptr->compile_task_fence_ptr->wait();
 
-            vkgl_assert(iterator->second->spirv_blob.size() > 0);
-            if (iterator->second->spirv_blob.size() > 0)
-            {
-                result                         = true;
-                if (out_spirv_blob_ptr) 			{ *out_spirv_blob_ptr            = &iterator->second->spirv_blob.at(0); }
-                if (out_spirv_blob_size_bytes_ptr) { *out_spirv_blob_size_bytes_ptr = static_cast<uint32_t>(iterator->second->spirv_blob.size() ); }
-            }
+        vkgl_assert(shader_data_ptr->spirv_blob.size() > 0);
+        if (shader_data_ptr->spirv_blob.size() > 0)
+        {
+            result                         = true;
+            if (out_spirv_blob_ptr) 			{ *out_spirv_blob_ptr            = &shader_data_ptr->spirv_blob.at(0); }
+            if (out_spirv_blob_size_bytes_ptr) { *out_spirv_blob_size_bytes_ptr = static_cast<uint32_t>(shader_data_ptr->spirv_blob.size() ); }
         }
     }
-    m_mutex.unlock_shared();
 
     return result;
 }
@@ -927,6 +1022,122 @@ void OpenGL::VKSPIRVManager::link_program(ProgramData* in_program_data_ptr)
     FUN_ENTRY(DEBUG_DEPTH);
     
     /* NOTE: This function is called back from one of the backend thread pool's threads */
+    auto                           frontend_program_manager_ptr = m_frontend_ptr->get_program_manager_ptr();
+    LinkKey                        link_key;
+    std::shared_ptr<LinkedProgram> linked_program_ptr;
+    bool                           needs_linking                = true;
+    const auto                     program_id                   = in_program_data_ptr->program_reference_ptr->get_payload().id;
+    const auto                     program_time_marker          = in_program_data_ptr->program_reference_ptr->get_payload().time_marker;
+
+    /* Shaders are compiled by tasks submitted before this one. The thread pool hands tasks to workers in submission
+     * order, so these have already started and the wait cannot deadlock.
+     */
+    for (auto& current_shader_data_ptr : in_program_data_ptr->shader_ptrs)
+    {
+        current_shader_data_ptr->compile_task_fence_ptr->wait();
+    }
+
+    /* Engines often create many programs out of the same shaders (eg. one per material instance). Programs whose shaders
+     * produced the same SPIR-V and which use the same pre-link state link to the same result, so only the first one
+     * runs glslang; the others reuse its link log, post-link data & shader modules. If the first link is still in flight,
+     * they wait for it rather than doing the same work concurrently.
+     */
+    if (get_link_key(in_program_data_ptr,
+                    &link_key) )
+    {
+        std::lock_guard<std::mutex> lock        (m_link_cache_mutex);
+        auto                        map_iterator(m_link_key_to_linked_program_map.find(link_key) );
+
+        if (map_iterator != m_link_key_to_linked_program_map.end() )
+        {
+            linked_program_ptr = map_iterator->second.lock();
+        }
+
+        if (linked_program_ptr != nullptr)
+        {
+            needs_linking = false;
+        }
+        else
+        {
+            linked_program_ptr.reset(new LinkedProgram(),
+                                     [this, link_key](LinkedProgram* in_linked_program_ptr)
+                                     {
+                                         {
+                                             std::lock_guard<std::mutex> lock        (m_link_cache_mutex);
+                                             auto                        map_iterator(m_link_key_to_linked_program_map.find(link_key) );
+
+                                             /* The entry may have been taken over by a new link in the meantime. */
+                                             if (map_iterator                 != m_link_key_to_linked_program_map.end() &&
+                                                 map_iterator->second.expired() )
+                                             {
+                                                 m_link_key_to_linked_program_map.erase(map_iterator);
+                                             }
+                                         }
+
+                                         delete in_linked_program_ptr;
+                                     });
+
+            m_link_key_to_linked_program_map[link_key] = linked_program_ptr;
+        }
+    }
+    else
+    {
+        /* At least one of the shaders failed to compile. Do not share the outcome. */
+        linked_program_ptr.reset(new LinkedProgram() );
+    }
+
+    vkgl_assert(linked_program_ptr != nullptr);
+
+    if (needs_linking)
+    {
+        link_program_with_glslang(in_program_data_ptr,
+                                  linked_program_ptr.get() );
+
+        m_n_program_links.fetch_add(1);
+
+        linked_program_ptr->ready_fence_ptr->signal();
+    }
+    else
+    {
+        linked_program_ptr->ready_fence_ptr->wait();
+
+        m_n_program_link_cache_hits.fetch_add(1);
+    }
+
+    in_program_data_ptr->link_status        = linked_program_ptr->link_status;
+    in_program_data_ptr->link_log           = linked_program_ptr->link_log;
+    in_program_data_ptr->linked_program_ptr = linked_program_ptr;
+
+    for (uint32_t n_shader_type = 0;
+                  n_shader_type < static_cast<uint32_t>(OpenGL::ShaderType::Count);
+                ++n_shader_type)
+    {
+        in_program_data_ptr->shader_module_ptrs[n_shader_type] = linked_program_ptr->shader_module_ptrs[n_shader_type];
+    }
+
+    /* Associate a copy of the post-link data struct with the GL program */
+    {
+        auto post_link_data_ptr = OpenGL::PostLinkDataUniquePtr(new OpenGL::PostLinkData(linked_program_ptr->post_link_data) );
+        vkgl_assert(post_link_data_ptr != nullptr);
+
+        frontend_program_manager_ptr->set_program_post_link_data_ptr(program_id,
+                                                                    &program_time_marker,
+                                                                     std::move(post_link_data_ptr) );
+    }
+
+    in_program_data_ptr->need_rebuild_uniform_resources = true;
+
+    /* All done, signal the fence we're done */
+    in_program_data_ptr->link_task_fence_ptr->signal();
+
+    in_program_data_ptr->program_reference_ptr.reset();
+}
+
+void OpenGL::VKSPIRVManager::link_program_with_glslang(const ProgramData* in_program_data_ptr,
+                                                       LinkedProgram*     out_linked_program_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
     auto                               frontend_program_manager_ptr = m_frontend_ptr->get_program_manager_ptr();
     std::unique_ptr<glslang::TProgram> glslang_program_ptr;
     const auto                         program_id                   = in_program_data_ptr->program_reference_ptr->get_payload().id;
@@ -960,14 +1171,14 @@ void OpenGL::VKSPIRVManager::link_program(ProgramData* in_program_data_ptr)
         vkgl_assert(ub_index_to_binding_mappings_ptr->size() == 0); /* TODO */
     }
 
-    /* Link the program and cache result SPIR-V blobs.. */
-    in_program_data_ptr->link_status = glslang_program_ptr->link      (static_cast<EShMessages>(EShMsgDefault/* | EShMsgSpvRules*//* | EShMsgVulkanRules*/) );
-    in_program_data_ptr->link_log    = glslang_program_ptr->getInfoLog();
+    /* Link the program and create shader modules for the result SPIR-V blobs.. */
+    out_linked_program_ptr->link_status = glslang_program_ptr->link      (static_cast<EShMessages>(EShMsgDefault/* | EShMsgSpvRules*//* | EShMsgVulkanRules*/) );
+    out_linked_program_ptr->link_log    = glslang_program_ptr->getInfoLog();
 
 	{
-		restore_glsl_symbol_names(in_program_data_ptr->link_log);
+		restore_glsl_symbol_names(out_linked_program_ptr->link_log);
 	}
-vkgl_printf(">>>>LINK_LOG>>>>\n%s\n>>>>>>>>", in_program_data_ptr->link_log.c_str() );
+vkgl_printf(">>>>LINK_LOG>>>>\n%s\n>>>>>>>>", out_linked_program_ptr->link_log.c_str() );
     if (!glslang_program_ptr->mapIO(nullptr, 
     									nullptr) ) //< TODO: Need to use app-specified data here
     {
@@ -979,14 +1190,13 @@ vkgl_printf(">>>>LINK_LOG>>>>\n%s\n>>>>>>>>", in_program_data_ptr->link_log.c_st
         vkgl_assert_fail();
     }
 
-    if (in_program_data_ptr->link_status)
+    if (out_linked_program_ptr->link_status)
     {
         for (const auto& current_shader_data_ptr : in_program_data_ptr->shader_ptrs)
         {
             const auto            shader_type           = current_shader_data_ptr->type;
             const auto            intermediate_ptr      = glslang_program_ptr->getIntermediate(OpenGL::Utils::get_sh_language_for_opengl_shader_type(shader_type) );
             glslang::SpvOptions spv_options;
-            std::vector<uint8_t>& result_spirv_blob_u8  = in_program_data_ptr->spirv_blobs[static_cast<uint32_t>(shader_type)];
             std::vector<uint32_t> result_spirv_blob_u32;
 
             glslang::GlslangToSpv(*intermediate_ptr,
@@ -997,64 +1207,230 @@ vkgl_printf(">>>>LINK_LOG>>>>\n%s\n>>>>>>>>", in_program_data_ptr->link_log.c_st
             if (result_spirv_blob_u32.size() == 0)
             {
                 vkgl_assert_fail();
-            }
-            else
-            {
-                result_spirv_blob_u8.resize(result_spirv_blob_u32.size() * sizeof(uint32_t) );
 
-                #if defined(_DEBUG)
-                {
-                    std::stringbuf spirv_out_str;
-                    std::ostream spirv_out(&spirv_out_str);
-                    
-                    spv::Disassemble(spirv_out,
-                    				result_spirv_blob_u32);
-                    
-                    vkgl_printf("spirv_out_str:\n%s\n", spirv_out_str.str().c_str() );
-                }
-                #endif
+                continue;
+            }
 
-                memcpy(&result_spirv_blob_u8.at(0),
-                       &result_spirv_blob_u32.at(0),
-                        result_spirv_blob_u8.size() );
+            #if defined(_DEBUG)
+            {
+                std::stringbuf spirv_out_str;
+                std::ostream spirv_out(&spirv_out_str);
+                
+                spv::Disassemble(spirv_out,
+                				result_spirv_blob_u32);
+                
+                vkgl_printf("spirv_out_str:\n%s\n", spirv_out_str.str().c_str() );
             }
+            #endif
 
             vkgl_assert(shader_type == ShaderType::Fragment ||
                         shader_type == ShaderType::Geometry ||
                         shader_type == ShaderType::Vertex);
 
-            in_program_data_ptr->shader_module_ptrs[static_cast<uint32_t>(current_shader_data_ptr->type)] = Anvil::ShaderModule::create_from_spirv_blob(m_backend_ptr->get_device_ptr(),
-                                                                                                                                                       &result_spirv_blob_u32.at(0),
-                                                                                                                                                        static_cast<uint32_t>(result_spirv_blob_u32.size() ),
-                                                                                                                                                        "",  /* in_opt_cs_entrypoint_name */
-                                                                                                                                                        (shader_type == ShaderType::Fragment) ? current_shader_data_ptr->sm_entrypoint_name : "",
-                                                                                                                                                        (shader_type == ShaderType::Geometry) ? current_shader_data_ptr->sm_entrypoint_name : "",
-                                                                                                                                                        "",  /* in_opt_tc_entrypoint_name */
-                                                                                                                                                        "",  /* in_opt_te_entrypoint_name */
-                                                                                                                                                        (shader_type == ShaderType::Vertex) ? current_shader_data_ptr->sm_entrypoint_name : "");
-            vkgl_assert(in_program_data_ptr->shader_module_ptrs[static_cast<uint32_t>(current_shader_data_ptr->type)] != nullptr);
+            out_linked_program_ptr->shader_module_ptrs[static_cast<uint32_t>(shader_type)] = get_shader_module(shader_type,
+                                                                                                                current_shader_data_ptr->sm_entrypoint_name,
+                                                                                                                result_spirv_blob_u32);
+            vkgl_assert(out_linked_program_ptr->shader_module_ptrs[static_cast<uint32_t>(shader_type)] != nullptr);
         }
     }
 
-    /* Create, fill and associate post-link data struct with the GL program */
+    /* Create & fill the post-link data struct. Programs get copies of it. */
     {
         auto post_link_data_ptr = create_post_link_data(glslang_program_ptr.get() );
         vkgl_assert(post_link_data_ptr != nullptr);
 
-        frontend_program_manager_ptr->set_program_post_link_data_ptr(program_id,
-                                                                    &program_time_marker,
-                                                                     std::move(post_link_data_ptr) );
+        out_linked_program_ptr->post_link_data = *post_link_data_ptr;
     }
 
     glslang_program_ptr->dumpReflection();
 
-    in_program_data_ptr->need_rebuild_uniform_resources = true;
+    /* NOTE: We do NOT cache the TProgram instance. It's not going to be needed afterwards */
+}
 
-    /* All done, signal the fence we're done */
-    in_program_data_ptr->link_task_fence_ptr->signal();
+bool OpenGL::VKSPIRVManager::get_link_key(const ProgramData* in_program_data_ptr,
+                                          LinkKey*           out_link_key_ptr) const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    auto                                          frontend_program_manager_ptr     = m_frontend_ptr->get_program_manager_ptr();
+    const OpenGL::AttributeLocationBindingMap*    attribute_location_bindings_ptr  = nullptr;
+    const OpenGL::FragDataLocationMap*            frag_data_location_mappings_ptr  = nullptr;
+    const auto                                    program_id                       = in_program_data_ptr->program_reference_ptr->get_payload().id;
+    const auto                                    program_time_marker              = in_program_data_ptr->program_reference_ptr->get_payload().time_marker;
+    bool                                          result                           = false;
+    std::vector<const ShaderData*>                sorted_shader_ptrs;
+    const std::unordered_map<uint32_t, uint32_t>* ub_index_to_binding_mappings_ptr = nullptr;
+
+    out_link_key_ptr->items.clear      ();
+    out_link_key_ptr->spirv_blobs.clear();
+
+    /* 1. Shaders, identified by their type and the SPIR-V they compiled to. Attachment order does not matter. */
+    for (const auto& current_shader_data_ptr : in_program_data_ptr->shader_ptrs)
+    {
+        if (!current_shader_data_ptr->compilation_status)
+        {
+            goto end;
+        }
 
-    /* NOTE: We do NOT cache the TProgram instance. It's not going to be needed afterwards */
-    in_program_data_ptr->program_reference_ptr.reset();
+        sorted_shader_ptrs.push_back(current_shader_data_ptr);
+    }
+
+    std::sort(sorted_shader_ptrs.begin(),
+              sorted_shader_ptrs.end  (),
+              [](const ShaderData* in_shader1_ptr,
+                 const ShaderData* in_shader2_ptr)
+              {
+                  if (in_shader1_ptr->type != in_shader2_ptr->type)
+                  {
+                      return (in_shader1_ptr->type < in_shader2_ptr->type);
+                  }
+
+                  if (in_shader1_ptr->spirv_blob_hash != in_shader2_ptr->spirv_blob_hash)
+                  {
+                      return (in_shader1_ptr->spirv_blob_hash < in_shader2_ptr->spirv_blob_hash);
+                  }
+
+                  return (in_shader1_ptr->spirv_blob < in_shader2_ptr->spirv_blob);
+              });
+
+    out_link_key_ptr->items.push_back(sorted_shader_ptrs.size() );
+
+    for (const auto& current_shader_data_ptr : sorted_shader_ptrs)
+    {
+        out_link_key_ptr->items.push_back      (static_cast<uint64_t>(current_shader_data_ptr->type) );
+        out_link_key_ptr->items.push_back      (current_shader_data_ptr->spirv_blob.size() );
+        out_link_key_ptr->items.push_back      (current_shader_data_ptr->spirv_blob_hash);
+        out_link_key_ptr->spirv_blobs.push_back(current_shader_data_ptr->spirv_blob);
+    }
+
+    /* 2. Pre-link state. */
+    if (!frontend_program_manager_ptr->get_program_link_time_properties(program_id,
+                                                                       &program_time_marker,
+                                                                       &attribute_location_bindings_ptr,
+                                                                       &frag_data_location_mappings_ptr,
+                                                                       &ub_index_to_binding_mappings_ptr) )
+    {
+        vkgl_assert_fail();
+
+        goto end;
+    }
+
+    append_name_to_location_map_hashes(*attribute_location_bindings_ptr,
+                                       &out_link_key_ptr->items);
+    append_name_to_location_map_hashes(*frag_data_location_mappings_ptr,
+                                       &out_link_key_ptr->items);
+
+    {
+        std::vector<uint64_t> ub_binding_items;
+
+        for (const auto& current_ub_binding : *ub_index_to_binding_mappings_ptr)
+        {
+            ub_binding_items.push_back( (static_cast<uint64_t>(current_ub_binding.first) << 32) | current_ub_binding.second);
+        }
+
+        std::sort(ub_binding_items.begin(),
+                  ub_binding_items.end  () );
+
+        out_link_key_ptr->items.push_back(ub_binding_items.size() );
+        out_link_key_ptr->items.insert   (out_link_key_ptr->items.end(),
+                                          ub_binding_items.begin     (),
+                                          ub_binding_items.end       () );
+    }
+
+    result = true;
+end:
+    return result;
+}
+
+std::shared_ptr<Anvil::ShaderModule> OpenGL::VKSPIRVManager::get_shader_module(const OpenGL::ShaderType&    in_shader_type,
+                                                                               const char*                  in_entrypoint_name,
+                                                                               const std::vector<uint32_t>& in_spirv_blob)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    ShaderModuleKey                      key;
+    std::shared_ptr<Anvil::ShaderModule> result_ptr;
+
+    key.entrypoint_name = in_entrypoint_name;
+    key.spirv_blob      = in_spirv_blob;
+    key.type            = in_shader_type;
+    key.hash            = get_fnv1a_hash(&in_spirv_blob.at(0),
+                                          in_spirv_blob.size() * sizeof(uint32_t) );
+    key.hash            = get_fnv1a_hash(key.entrypoint_name.c_str(),
+                                         key.entrypoint_name.size  (),
+                                         key.hash ^ static_cast<uint64_t>(in_shader_type) );
+
+    {
+        std::lock_guard<std::mutex> lock        (m_link_cache_mutex);
+        auto                        map_iterator(m_shader_module_key_to_shader_module_map.find(key) );
+
+        if (map_iterator != m_shader_module_key_to_shader_module_map.end() )
+        {
+            result_ptr = map_iterator->second.lock();
+        }
+
+        if (result_ptr != nullptr)
+        {
+            m_n_shader_module_cache_hits.fetch_add(1);
+
+            goto end;
+        }
+    }
+
+    /* Not cached. Create the module outside the lock. Should another thread create the same one in the meantime,
+     * the one which gets published later wins the cache entry.
+     */
+    {
+        auto module_ptr = Anvil::ShaderModule::create_from_spirv_blob(m_backend_ptr->get_device_ptr(),
+                                                                     &in_spirv_blob.at(0),
+                                                                      static_cast<uint32_t>(in_spirv_blob.size() ),
+                                                                      "",  /* in_opt_cs_entrypoint_name */
+                                                                      (in_shader_type == ShaderType::Fragment) ? in_entrypoint_name : "",
+                                                                      (in_shader_type == ShaderType::Geometry) ? in_entrypoint_name : "",
+                                                                      "",  /* in_opt_tc_entrypoint_name */
+                                                                      "",  /* in_opt_te_entrypoint_name */
+                                                                      (in_shader_type == ShaderType::Vertex)   ? in_entrypoint_name : "");
+
+        if (module_ptr == nullptr)
+        {
+            vkgl_assert(module_ptr != nullptr);
+
+            goto end;
+        }
+
+        m_n_shader_modules_created.fetch_add(1);
+
+        {
+            auto module_deleter = module_ptr.get_deleter();
+
+            result_ptr.reset(module_ptr.release(),
+                             [this, key, module_deleter](Anvil::ShaderModule* in_module_ptr)
+                             {
+                                 {
+                                     std::lock_guard<std::mutex> lock        (m_link_cache_mutex);
+                                     auto                        map_iterator(m_shader_module_key_to_shader_module_map.find(key) );
+
+                                     /* The entry may have been taken over by another module in the meantime. */
+                                     if (map_iterator                 != m_shader_module_key_to_shader_module_map.end() &&
+                                         map_iterator->second.expired() )
+                                     {
+                                         m_shader_module_key_to_shader_module_map.erase(map_iterator);
+                                     }
+                                 }
+
+                                 module_deleter(in_module_ptr);
+                             });
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_link_cache_mutex);
+
+            m_shader_module_key_to_shader_module_map[key] = result_ptr;
+        }
+    }
+
+end:
+    return result_ptr;
 }
 
 void OpenGL::VKSPIRVManager::remove_unused_symbols(glslang::TIntermediate& in_intermediate) const
@@ -1698,8 +2074,9 @@ bool OpenGL::VKSPIRVManager::build_uniform_resources(const SPIRVBlobID&        i
     
 	bool result = false;
 	
-	m_mutex.lock_shared();
 	{
+        VKGL::EpochReadLock lock;
+
         auto 		frontend_state_manager_ptr = m_frontend_ptr->get_state_manager_ptr();
         auto 		frontend_buffer_manager_ptr = m_frontend_ptr->get_buffer_manager_ptr();
     	vkgl_assert(frontend_state_manager_ptr != nullptr);
@@ -1709,17 +2086,17 @@ bool OpenGL::VKSPIRVManager::build_uniform_resources(const SPIRVBlobID&        i
     	std::vector<OpenGL::UniformResource>* uniform_resources_ptr = nullptr;
     	bool need_rebuild_uniform_resources 							= false;
     	
-    	auto program_data_iterator = m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id);
-    	if (program_data_iterator == m_spirv_blob_id_to_program_data_map.end() )
+    	if (!m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id,
+    	                                             &program_data_ptr) )
     	{
-        	vkgl_assert(program_data_iterator != m_spirv_blob_id_to_program_data_map.end() );
+        	vkgl_assert_fail();
         	goto end;
         }
-        
-    	program_data_ptr 				= program_data_iterator->second.get();
     	
     	program_data_ptr->link_task_fence_ptr->wait();
     	
+    	std::lock_guard<std::mutex> uniform_resources_lock(program_data_ptr->uniform_resources_mutex);
+    	
     	uniform_resources_ptr 			= &program_data_ptr->uniform_resources;
     	need_rebuild_uniform_resources = program_data_ptr->need_rebuild_uniform_resources;
     	
@@ -1981,8 +2358,8 @@ bool OpenGL::VKSPIRVManager::build_uniform_resources(const SPIRVBlobID&        i
                                 
                                 buffer_ptr 				= backend_buffer_reference_ptr->get_payload().buffer_ptr;
                 		    	vkgl_assert(buffer_ptr != nullptr);
-                		    	buffer_size 			= buffer_ptr->get_create_info_ptr()->get_size();
-                		    	buffer_offset 			= buffer_size * i;
+                		    	buffer_size 			= backend_buffer_reference_ptr->get_payload().buffer_size;
+                		    	buffer_offset 			= backend_buffer_reference_ptr->get_payload().buffer_offset + buffer_size * i;
                 		    	
                 		    	buffer_binding_items.push_back(Anvil::DescriptorSet::UniformBufferBindingElement(buffer_ptr,
                                                                                                                      buffer_offset,
@@ -2007,7 +2384,6 @@ bool OpenGL::VKSPIRVManager::build_uniform_resources(const SPIRVBlobID&        i
         	program_data_ptr->need_rebuild_uniform_resources = false;
     	}
 	}
-	m_mutex.unlock_shared();
 	
 	result = true;
 end:
@@ -2020,19 +2396,22 @@ std::vector<OpenGL::UniformResource>* OpenGL::VKSPIRVManager::get_uniform_resour
     
 	std::vector<OpenGL::UniformResource>* result = nullptr;
 	
-	m_mutex.lock_shared();
 	{
-    	auto program_data_iterator = m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id);
-    	
-    	vkgl_assert(program_data_iterator != m_spirv_blob_id_to_program_data_map.end() );
-    	if (program_data_iterator != m_spirv_blob_id_to_program_data_map.end() )
+    	VKGL::EpochReadLock lock;
+    	ProgramData*        program_data_ptr = nullptr;
+
+    	if (m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id,
+    	                                            &program_data_ptr) )
     	{
-    		program_data_iterator->second->link_task_fence_ptr->wait();
+    		program_data_ptr->link_task_fence_ptr->wait();
     		
-    		result = &program_data_iterator->second->uniform_resources;
+    		result = &program_data_ptr->uniform_resources;
+    	}
+    	else
+    	{
+    		vkgl_assert_fail();
     	}
 	}
-	m_mutex.unlock_shared();
 	
 	return result;
 }
@@ -2043,23 +2422,92 @@ Anvil::DescriptorSetGroup* OpenGL::VKSPIRVManager::get_descriptor_set_group(cons
     
 	Anvil::DescriptorSetGroup* result = nullptr;
 	
-	m_mutex.lock_shared();
 	{
-    	auto program_data_iterator = m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id);
-    	
-    	vkgl_assert(program_data_iterator != m_spirv_blob_id_to_program_data_map.end() );
-    	if (program_data_iterator != m_spirv_blob_id_to_program_data_map.end() )
+    	VKGL::EpochReadLock lock;
+    	ProgramData*        program_data_ptr = nullptr;
+
+    	if (m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id,
+    	                                            &program_data_ptr) )
     	{
-    		program_data_iterator->second->link_task_fence_ptr->wait();
+    		program_data_ptr->link_task_fence_ptr->wait();
     		
-    		result = program_data_iterator->second->descriptor_set_group_ptr.get();
+    		result = program_data_ptr->descriptor_set_group_ptr.get();
+    	}
+    	else
+    	{
+    		vkgl_assert_fail();
     	}
 	}
-	m_mutex.unlock_shared();
 	
 	return result;
 }
 
+bool OpenGL::VKSPIRVManager::prepare_program_for_draw(const OpenGL::GLProgramReference*      in_program_reference_ptr,
+                                                      const OpenGL::GLContextStateReference* in_state_reference_ptr,
+                                                      const bool&                            in_wait_for_link)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    const auto&                 program_payload    = in_program_reference_ptr->get_payload();
+    const OpenGL::PostLinkData* post_link_data_ptr = nullptr;
+    bool                        result             = false;
+    SPIRVBlobID                 spirv_id           = UINT32_MAX;
+
+    if (!get_spirv_blob_id_for_program_reference(program_payload.id,
+                                                 program_payload.time_marker,
+                                                &spirv_id) )
+    {
+        vkgl_assert_fail();
+
+        goto end;
+    }
+
+    if (!in_wait_for_link)
+    {
+        bool is_link_complete = false;
+
+        if (!get_program_link_completion_status(spirv_id,
+                                               &is_link_complete) ||
+            !is_link_complete)
+        {
+            goto end;
+        }
+    }
+
+    /* NOTE: Blocks until the link finishes, if it has not already. */
+    m_frontend_ptr->get_program_manager_ptr()->get_program_post_link_data_ptr(program_payload.id,
+                                                                             &program_payload.time_marker,
+                                                                             &post_link_data_ptr);
+    vkgl_assert(post_link_data_ptr != nullptr);
+
+    if (!build_uniform_resources(spirv_id,
+                                 post_link_data_ptr) )
+    {
+        vkgl_assert_fail();
+
+        goto end;
+    }
+
+    result = update_texture_references_for_uniform_resources(spirv_id,
+                                                             in_state_reference_ptr);
+end:
+    return result;
+}
+
+OpenGL::VKSPIRVManagerStats OpenGL::VKSPIRVManager::pop_frame_stats()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    OpenGL::VKSPIRVManagerStats result;
+
+    result.n_program_link_cache_hits  = m_n_program_link_cache_hits.exchange (0);
+    result.n_program_links            = m_n_program_links.exchange           (0);
+    result.n_shader_module_cache_hits = m_n_shader_module_cache_hits.exchange(0);
+    result.n_shader_modules_created   = m_n_shader_modules_created.exchange  (0);
+
+    return result;
+}
+
 OpenGL::SPIRVBlobID OpenGL::VKSPIRVManager::register_program(OpenGL::GLProgramReferenceUniquePtr in_program_reference_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
@@ -2072,8 +2520,9 @@ OpenGL::SPIRVBlobID OpenGL::VKSPIRVManager::register_program(OpenGL::GLProgramRe
     const auto          program_id                   = in_program_reference_ptr->get_payload().id;
     const auto          program_timestamp            = in_program_reference_ptr->get_payload().time_marker;
 
-    m_mutex.lock_unique();
     {
+        std::lock_guard<std::mutex> lock(m_writer_mutex);
+
         ProgramDataUniquePtr     program_data_ptr     = ProgramDataUniquePtr(nullptr,
                                                                              std::default_delete<ProgramData>() );
         ProgramData*             program_data_raw_ptr = nullptr;
@@ -2093,7 +2542,7 @@ OpenGL::SPIRVBlobID OpenGL::VKSPIRVManager::register_program(OpenGL::GLProgramRe
                 const auto  shader_id        = current_shader_reference_ptr->get_payload().id;
                 const auto  shader_timestamp = current_shader_reference_ptr->get_payload().time_marker;
 
-                decltype(m_glsl_to_shader_data_map)::const_iterator shader_data_iterator;
+                ShaderData* shader_data_ptr  = nullptr;
 
                 if (!shader_frontend_manager_ptr->get_shader_glsl(shader_id,
                                                                  &shader_timestamp,
@@ -2106,10 +2555,13 @@ OpenGL::SPIRVBlobID OpenGL::VKSPIRVManager::register_program(OpenGL::GLProgramRe
                     vkgl_assert(shader_glsl != nullptr);
                 }
 
-                shader_data_iterator = m_glsl_to_shader_data_map.find(std::string(shader_glsl) );
-                vkgl_assert(shader_data_iterator != m_glsl_to_shader_data_map.end() );
+                if (!m_glsl_to_shader_data_map.find(std::string(shader_glsl),
+                                                   &shader_data_ptr) )
+                {
+                    vkgl_assert_fail();
+                }
 
-                shader_data_vec.push_back(shader_data_iterator->second.get() );
+                shader_data_vec.push_back(shader_data_ptr);
             }
         }
 
@@ -2117,7 +2569,8 @@ OpenGL::SPIRVBlobID OpenGL::VKSPIRVManager::register_program(OpenGL::GLProgramRe
         {
             SPIRVBlobID new_blob_id = static_cast<SPIRVBlobID>(++m_n_entities_registered);
 
-            vkgl_assert(m_spirv_blob_id_to_program_data_map.find(new_blob_id) == m_spirv_blob_id_to_program_data_map.end() );
+            vkgl_assert(!m_spirv_blob_id_to_program_data_map.find(new_blob_id,
+                                                                  nullptr) ); /* out_opt_value_ptr */
 
             program_data_ptr.reset(new ProgramData(new_blob_id,
                                                    shader_data_vec,
@@ -2125,32 +2578,31 @@ OpenGL::SPIRVBlobID OpenGL::VKSPIRVManager::register_program(OpenGL::GLProgramRe
             );
             vkgl_assert(program_data_ptr != nullptr);
 
-            program_data_raw_ptr                                                                                          = program_data_ptr.get();
-            m_program_reference_to_program_data_map[std::pair<GLuint, OpenGL::TimeMarker>(program_id, program_timestamp)] = program_data_raw_ptr;
-            m_spirv_blob_id_to_program_data_map    [new_blob_id]                                                          = std::move(program_data_ptr);
+            program_data_raw_ptr             = program_data_ptr.get();
+            m_program_data_ptrs[new_blob_id] = std::move(program_data_ptr);
+
+            /* NOTE: The newest ProgramData takes over the reference if the program has already been registered before. */
+            m_program_reference_to_program_data_map.erase (ProgramReference(program_id, program_timestamp) );
+            m_program_reference_to_program_data_map.insert(ProgramReference(program_id, program_timestamp),
+                                                            program_data_raw_ptr);
+            m_spirv_blob_id_to_program_data_map.insert    (new_blob_id,
+                                                            program_data_raw_ptr);
 
             program_frontend_manager_ptr->set_program_backend_spirv_blob_id(program_id,
                                                                            &program_timestamp,
                                                                             new_blob_id);
         }
 
-        /* 3. Wait until all shaders are compiled before submitting a link task to the thread pool.
+        /* 3. Submit a new task to the thread pool, which we're going to use to actually perform the linking. The task
+         *    waits for shader compilation to finish, so that app's thread does not have to.
          *
-         * NOTE: This works because this function is always called from app's thread.
          * TODO: Do we need to implicitly submit compile shader tasks for shaders, for which glCompileShader() has not been invoked?
          */
-        for (auto& current_shader_data_ptr : shader_data_vec)
-        {
-            current_shader_data_ptr->compile_task_fence_ptr->wait();
-        }
-
-        /* 4. Submit a new task to the thread pool, which we're going to use to actually perform the linking. */
         thread_pool_ptr->submit_task(std::bind(&OpenGL::VKSPIRVManager::link_program,
                                                this,
                                                program_data_raw_ptr)
         );
     }
-    m_mutex.unlock_unique();
 
     return result;
 }
@@ -2163,18 +2615,20 @@ OpenGL::SPIRVBlobID OpenGL::VKSPIRVManager::register_shader(const OpenGL::Shader
     OpenGL::SPIRVBlobID result          = UINT32_MAX;
     auto                thread_pool_ptr = m_backend_ptr->get_thread_pool_ptr();
 
-    m_mutex.lock_unique();
     {
-        ShaderData* shader_data_raw_ptr = nullptr;
+        std::lock_guard<std::mutex> lock               (m_writer_mutex);
+        ShaderData*                 shader_data_raw_ptr(nullptr);
 
-        vkgl_assert(m_glsl_to_shader_data_map.find(in_glsl) == m_glsl_to_shader_data_map.end() );
+        vkgl_assert(!m_glsl_to_shader_data_map.find(in_glsl,
+                                                   nullptr) ); /* out_opt_value_ptr */
 
         /* 1. Spawn a new entity to hold shader data */
         {
             SPIRVBlobID         new_blob_id    = static_cast<SPIRVBlobID>(++m_n_entities_registered);
             ShaderDataUniquePtr shader_data_ptr;
 
-            vkgl_assert(m_spirv_blob_id_to_shader_data_map.find(new_blob_id) == m_spirv_blob_id_to_shader_data_map.end() );
+            vkgl_assert(!m_spirv_blob_id_to_shader_data_map.find(new_blob_id,
+                                                                 nullptr) ); /* out_opt_value_ptr */
 
             shader_data_ptr.reset(new ShaderData(new_blob_id,
                                                  in_shader_type,
@@ -2182,9 +2636,13 @@ OpenGL::SPIRVBlobID OpenGL::VKSPIRVManager::register_shader(const OpenGL::Shader
             );
             vkgl_assert(shader_data_ptr != nullptr);
 
-            shader_data_raw_ptr                             = shader_data_ptr.get();
-            m_spirv_blob_id_to_shader_data_map[new_blob_id] = shader_data_raw_ptr;
-            m_glsl_to_shader_data_map         [in_glsl]     = std::move(shader_data_ptr);
+            shader_data_raw_ptr = shader_data_ptr.get();
+
+            m_spirv_blob_id_to_shader_data_map.insert(new_blob_id,
+                                                      shader_data_raw_ptr);
+            m_glsl_to_shader_data_map.insert         (in_glsl,
+                                                      shader_data_raw_ptr);
+            m_shader_data_ptrs.push_back             (std::move(shader_data_ptr) );
 
             result = new_blob_id;
         }
@@ -2195,56 +2653,121 @@ OpenGL::SPIRVBlobID OpenGL::VKSPIRVManager::register_shader(const OpenGL::Shader
                                                shader_data_raw_ptr)
         );
     }
-    m_mutex.unlock_unique();
 
     return result;
 }
 
+void OpenGL::VKSPIRVManager::release_program_data(void* in_program_data_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    delete reinterpret_cast<ProgramData*>(in_program_data_ptr);
+}
+
 void OpenGL::VKSPIRVManager::unregister_program(const GLuint& in_id)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    m_mutex.lock_unique();
     {
-        std::vector<std::pair<GLuint, OpenGL::TimeMarker> > relevant_program_reference_map_keys;
-        std::vector<SPIRVBlobID>                            relevant_spirv_blob_ids;
+        std::lock_guard<std::mutex>   lock(m_writer_mutex);
+        std::vector<ProgramReference> relevant_program_references;
+        std::vector<SPIRVBlobID>      relevant_spirv_blob_ids;
 
-        for (const auto& current_program_reference_map_item : m_program_reference_to_program_data_map)
-        {
-            if (current_program_reference_map_item.first.first == in_id)
+        m_program_reference_to_program_data_map.for_each(
+            [&](const ProgramReference& in_program_reference,
+                ProgramData* const&     in_program_data_ptr)
             {
-                relevant_program_reference_map_keys.push_back(current_program_reference_map_item.first);
-            }
-        }
+                if (in_program_reference.first == in_id)
+                {
+                    relevant_program_references.push_back(in_program_reference);
+                }
+            });
 
-        for (const auto& current_spirv_blob_map_item : m_spirv_blob_id_to_program_data_map)
+        for (const auto& current_program_data_item : m_program_data_ptrs)
         {
-            if (current_spirv_blob_map_item.second->program_id == in_id)
+            if (current_program_data_item.second->program_id == in_id)
             {
-                relevant_spirv_blob_ids.push_back(current_spirv_blob_map_item.first);
+                relevant_spirv_blob_ids.push_back(current_program_data_item.first);
             }
         }
 
-        for (const auto& current_program_reference_map_key : relevant_program_reference_map_keys)
+        for (const auto& current_program_reference : relevant_program_references)
         {
-            m_program_reference_to_program_data_map.erase(current_program_reference_map_key);
+            m_program_reference_to_program_data_map.erase(current_program_reference);
         }
 
-        /* Release the actual vk uniform buffers and descriptor set. */
+        /* Other threads may still be using the program data, so defer the release of its uniform buffers, descriptor set
+         * group & shader modules until they are done.
+         */
         for (const auto& current_spirv_blob_id : relevant_spirv_blob_ids)
         {
-        	auto program_data_iterator = m_spirv_blob_id_to_program_data_map.find(current_spirv_blob_id);
-        	vkgl_assert(program_data_iterator != m_spirv_blob_id_to_program_data_map.end() );
-        	auto program_data_ptr = program_data_iterator->second.get();
-        	
-        	program_data_ptr->uniform_resources.clear		();
-        	program_data_ptr->descriptor_set_group_ptr.reset();
+            auto program_data_iterator = m_program_data_ptrs.find(current_spirv_blob_id);
+
+            vkgl_assert(program_data_iterator != m_program_data_ptrs.end() );
+
+            m_spirv_blob_id_to_program_data_map.erase(current_spirv_blob_id);
+
+            VKGL::Epoch::retire(program_data_iterator->second.release(),
+                                release_program_data);
+
+            m_program_data_ptrs.erase(program_data_iterator);
         }
+    }
 
-        for (const auto& current_spirv_blob_id : relevant_spirv_blob_ids)
+    VKGL::Epoch::reclaim();
+}
+
+bool OpenGL::VKSPIRVManager::update_texture_references_for_uniform_resources(const SPIRVBlobID&                     in_spirv_blob_id,
+                                                                             const OpenGL::GLContextStateReference* in_state_reference_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    auto                state_manager_ptr          = m_frontend_ptr->get_state_manager_ptr();
+    auto                frontend_context_state_ptr = state_manager_ptr->get_state(in_state_reference_ptr->get_payload().time_marker);
+    VKGL::EpochReadLock lock;
+    ProgramData*        program_data_ptr           = nullptr;
+    bool                result                     = false;
+
+    vkgl_assert(frontend_context_state_ptr != nullptr);
+
+    if (!m_spirv_blob_id_to_program_data_map.find(in_spirv_blob_id,
+                                                 &program_data_ptr) )
+    {
+        vkgl_assert_fail();
+
+        goto end;
+    }
+
+    program_data_ptr->link_task_fence_ptr->wait();
+
+    {
+        std::lock_guard<std::mutex> uniform_resources_lock(program_data_ptr->uniform_resources_mutex);
+
+        for (auto& current_uniform_resource : program_data_ptr->uniform_resources)
         {
-            m_spirv_blob_id_to_program_data_map.erase(current_spirv_blob_id);
+            if (current_uniform_resource.binding == UINT_MAX ||
+               !current_uniform_resource.is_sampler)
+            {
+                continue;
+            }
+
+            for (auto& current_sampler : current_uniform_resource.samplers)
+            {
+                auto texture_unit_state_ptr = frontend_context_state_ptr->texture_unit_to_state_ptr_map.at(current_sampler.texture_unit).get();
+                vkgl_assert(texture_unit_state_ptr != nullptr);
+
+                auto texture_id = texture_unit_state_ptr->binding_2d;
+                vkgl_assert(texture_id != 0);
+
+                current_sampler.gl_texture_reference_ptr.reset();
+
+                current_sampler.gl_texture_reference_ptr = m_frontend_ptr->get_texture_manager_ptr()->acquire_current_latest_snapshot_reference(texture_id);
+                vkgl_assert(current_sampler.gl_texture_reference_ptr != nullptr);
+            }
         }
     }
-    m_mutex.unlock_unique();
-}
\ No newline at end of file
+
+    result = true;
+end:
+    return result;
+}
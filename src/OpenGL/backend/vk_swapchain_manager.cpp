@@ -2,26 +2,34 @@
  *
  * This code is licensed under MIT license (see LICENSE.txt for details)
  */
+#include "Anvil/include/misc/buffer_create_info.h"
 #include "Anvil/include/misc/formats.h"
 #include "Anvil/include/misc/image_create_info.h"
 #include "Anvil/include/misc/image_view_create_info.h"
 #include "Anvil/include/misc/memory_allocator.h"
 #include "Anvil/include/misc/rendering_surface_create_info.h"
-#include "Anvil/include/misc/semaphore_create_info.h"
 #include "Anvil/include/misc/swapchain_create_info.h"
 #include "Anvil/include/misc/window_factory.h"
+#include "Anvil/include/wrappers/buffer.h"
+#include "Anvil/include/wrappers/command_buffer.h"
+#include "Anvil/include/wrappers/command_pool.h"
 #include "Anvil/include/wrappers/device.h"
 #include "Anvil/include/wrappers/image.h"
 #include "Anvil/include/wrappers/image_view.h"
+#include "Anvil/include/wrappers/queue.h"
 #include "Anvil/include/wrappers/rendering_surface.h"
 #include "Anvil/include/wrappers/semaphore.h"
 #include "Anvil/include/wrappers/swapchain.h"
 #include "OpenGL/backend/vk_backend.h"
 #include "OpenGL/backend/vk_swapchain_manager.h"
+#include "OpenGL/backend/vk_sync_object_pool.h"
 #include "OpenGL/frontend/gl_formats.h"
 #include "OpenGL/frontend/snapshot_manager.h"
 #include "Common/logger.h"
 #include "Common/macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 OpenGL::VKSwapchainManager::VKSwapchainManager(OpenGL::IBackend*                    in_backend_ptr,
                                                const uint32_t&                      in_n_swapchain_images,
@@ -29,7 +37,10 @@ OpenGL::VKSwapchainManager::VKSwapchainManager(OpenGL::IBackend*
     :m_backend_ptr              (in_backend_ptr),
      m_n_swapchain_images       (in_n_swapchain_images),
      m_pixel_format_reqs        (in_pixel_format_reqs),
-     m_should_recreate_swapchain(false)
+     m_should_recreate_swapchain(false),
+     m_headless_height          (0),
+     m_headless_width           (0),
+     m_n_headless_frames_dumped (0)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -259,7 +270,6 @@ OpenGL::VKSwapchainManager::InternalSwapchainDataUniquePtr OpenGL::VKSwapchainMa
     std::vector<Anvil::ImageUniquePtr>     ds_images;
     std::vector<Anvil::ImageViewUniquePtr> ds_image_views;
     auto                                   format_manager_ptr          = m_backend_ptr->get_format_manager_ptr();
-    std::vector<Anvil::SemaphoreUniquePtr> frame_acquire_sems;
     InternalSwapchainDataUniquePtr         internal_swapchain_data_ptr;
     const bool                             is_recreate_request         = (in_opt_former_swapchain_data_ptr != nullptr);
     std::vector<Anvil::Queue*>             presentable_queue_ptrs;
@@ -290,12 +300,25 @@ OpenGL::VKSwapchainManager::InternalSwapchainDataUniquePtr OpenGL::VKSwapchainMa
         }
     }
 
-    /* 1. Create a window wrapper for the window handle specified by the app. */
+    /* 1. Create a window wrapper for the window handle specified by the app. In headless mode, use a dummy window instead. */
     if (!is_recreate_request)
     {
-        window_ptr = Anvil::WindowFactory::create_window(Anvil::WINDOW_PLATFORM_ANDROID,
-        													reinterpret_cast<WindowHandle>(in_swapchain_props_ptr->window_handle),
-        													nullptr);
+        if (is_headless() )
+        {
+            window_ptr = Anvil::WindowFactory::create_window(Anvil::WINDOW_PLATFORM_DUMMY,
+                                                             "VKGL",
+                                                             m_headless_width,
+                                                             m_headless_height,
+                                                             false,                           /* in_closable               */
+                                                             Anvil::PresentCallbackFunction(),
+                                                             false);                          /* in_visible                */
+        }
+        else
+        {
+            window_ptr = Anvil::WindowFactory::create_window(Anvil::WINDOW_PLATFORM_ANDROID,
+            													reinterpret_cast<WindowHandle>(in_swapchain_props_ptr->window_handle),
+            													nullptr);
+        }
 
         if (window_ptr == nullptr)
         {
@@ -341,11 +364,29 @@ OpenGL::VKSwapchainManager::InternalSwapchainDataUniquePtr OpenGL::VKSwapchainMa
     /* 3. Create the swapchain */
     {
         Anvil::SwapchainCreateInfoUniquePtr create_info_ptr;
-        const Anvil::ImageUsageFlags        image_usage_flags = get_swapchain_image_usage_flags     (rendering_surface_ptr.get() );
-        const Anvil::PresentModeKHR         present_mode      = get_present_mode_for_swapchain_props(in_swapchain_props_ptr,
-                                                                                                     rendering_surface_ptr.get() );
-        const Anvil::Format                 swapchain_format  = get_swapchain_format                (in_swapchain_props_ptr,
-                                                                                                     rendering_surface_ptr.get());
+        Anvil::ImageUsageFlags              image_usage_flags = Anvil::ImageUsageFlagBits::NONE;
+        Anvil::PresentModeKHR               present_mode      = Anvil::PresentModeKHR::UNKNOWN;
+        Anvil::Format                       swapchain_format  = Anvil::Format::UNKNOWN;
+
+        if (is_headless() )
+        {
+            /* Dummy surfaces do not report any capabilities. Off-screen swapchain images can take any usage & format, and
+             * the present mode is ignored. R8G8B8A8_UNORM keeps the readback path trivial.
+             */
+            image_usage_flags = Anvil::ImageUsageFlagBits::COLOR_ATTACHMENT_BIT |
+                                Anvil::ImageUsageFlagBits::TRANSFER_SRC_BIT     |
+                                Anvil::ImageUsageFlagBits::TRANSFER_DST_BIT;
+            present_mode      = Anvil::PresentModeKHR::FIFO_KHR;
+            swapchain_format  = Anvil::Format::R8G8B8A8_UNORM;
+        }
+        else
+        {
+            image_usage_flags = get_swapchain_image_usage_flags     (rendering_surface_ptr.get() );
+            present_mode      = get_present_mode_for_swapchain_props(in_swapchain_props_ptr,
+                                                                     rendering_surface_ptr.get() );
+            swapchain_format  = get_swapchain_format                (in_swapchain_props_ptr,
+                                                                     rendering_surface_ptr.get());
+        }
 
         create_info_ptr = Anvil::SwapchainCreateInfo::create(device_ptr,
                                                              rendering_surface_ptr.get(),
@@ -413,29 +454,7 @@ OpenGL::VKSwapchainManager::InternalSwapchainDataUniquePtr OpenGL::VKSwapchainMa
         }
     }
 
-    /* 5. Instantiate semaphores we're going to use for frame acquisition purposes.
-     *
-     * NOTE: Yes, semaphores in Vulkan are NOT recyclable. However, Anvil provides a nifty reset method
-     *       which handles the recreation process under the hood. And we get RAII for free.
-     */
-    for (uint32_t n_semaphore = 0;
-                  n_semaphore < m_n_swapchain_images;
-                ++n_semaphore)
-    {
-        auto create_info_ptr = Anvil::SemaphoreCreateInfo::create(device_ptr);
-        auto semaphore_ptr   = Anvil::Semaphore::create          (std::move(create_info_ptr) );
-
-        if (semaphore_ptr == nullptr)
-        {
-            vkgl_assert(semaphore_ptr != nullptr);
-
-            goto end;
-        }
-
-        frame_acquire_sems.push_back(std::move(semaphore_ptr) );
-    }
-
-    /* 6. Cache all queues which can be used for presentation purposes */
+    /* 5. Cache all queues which can be used for presentation purposes */
     if (!is_recreate_request)
     {
         auto                         device_sgpu_ptr                     = dynamic_cast<Anvil::SGPUDevice*>(device_ptr);
@@ -474,13 +493,12 @@ OpenGL::VKSwapchainManager::InternalSwapchainDataUniquePtr OpenGL::VKSwapchainMa
         presentable_queue_ptrs = in_opt_former_swapchain_data_ptr->presentable_queue_ptrs;
     }
 
-    /* 7. Pack all the stuff together. */
+    /* 6. Pack all the stuff together. */
     internal_swapchain_data_ptr.reset(
         new InternalSwapchainData(std::move(rendering_surface_ptr),
                                   std::move(swapchain_ptr),
                                   std::move(window_ptr),
                                   presentable_queue_ptrs,
-                                  frame_acquire_sems,
                                   ds_images,
                                   ds_image_views)
     );
@@ -504,6 +522,187 @@ end:
     return internal_swapchain_data_ptr;
 }
 
+bool OpenGL::VKSwapchainManager::dump_headless_frame(Anvil::Swapchain*  in_swapchain_ptr,
+                                                     const uint32_t&    in_n_swapchain_image,
+                                                     const std::string& in_file_name) const
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    Anvil::PrimaryCommandBufferUniquePtr cmd_buffer_ptr;
+    auto                                 device_ptr          = m_backend_ptr->get_device_ptr();
+    FILE*                                file_ptr            = nullptr;
+    auto                                 image_ptr           = in_swapchain_ptr->get_image(in_n_swapchain_image);
+    std::vector<uint8_t>                 image_data;
+    const uint32_t                       image_height        = in_swapchain_ptr->get_height();
+    const uint32_t                       image_width         = in_swapchain_ptr->get_width ();
+    Anvil::BufferUniquePtr               readback_buffer_ptr;
+    bool                                 result              = false;
+    auto                                 universal_queue_ptr = device_ptr->get_universal_queue(0);
+    const uint32_t                       queue_fam_index     = universal_queue_ptr->get_queue_family_index();
+
+    vkgl_assert(image_ptr                                      != nullptr);
+    vkgl_assert(image_ptr->get_create_info_ptr()->get_format() == Anvil::Format::R8G8B8A8_UNORM);
+
+    image_data.resize(4 /* RGBA8 */ * image_width * image_height);
+
+    {
+        auto create_info_ptr = Anvil::BufferCreateInfo::create_alloc(device_ptr,
+                                                                     image_data.size(),
+                                                                     Anvil::QueueFamilyFlagBits::GRAPHICS_BIT,
+                                                                     Anvil::SharingMode::EXCLUSIVE,
+                                                                     Anvil::BufferCreateFlagBits::NONE,
+                                                                     Anvil::BufferUsageFlagBits::TRANSFER_DST_BIT,
+                                                                     Anvil::MemoryFeatureFlagBits::MAPPABLE_BIT);
+
+        create_info_ptr->set_mt_safety(Anvil::MTSafety::DISABLED);
+
+        readback_buffer_ptr = Anvil::Buffer::create(std::move(create_info_ptr) );
+
+        if (readback_buffer_ptr == nullptr)
+        {
+            vkgl_assert(readback_buffer_ptr != nullptr);
+
+            goto end;
+        }
+    }
+
+    /* The image has just been handed over for presentation, so it sits in PRESENT_SRC_KHR. Copy it out and restore
+     * the layout, so that the frame graph's view of the image stays valid.
+     */
+    cmd_buffer_ptr = device_ptr->get_command_pool_for_queue_family_index(queue_fam_index)->alloc_primary_level_command_buffer();
+
+    if (cmd_buffer_ptr == nullptr)
+    {
+        vkgl_assert(cmd_buffer_ptr != nullptr);
+
+        goto end;
+    }
+
+    cmd_buffer_ptr->start_recording(true,   /* in_one_time_submit          */
+                                    false); /* in_simultaneous_use_allowed */
+    {
+        Anvil::BufferImageCopy copy_region;
+        const auto             subresource_range = image_ptr->get_subresource_range();
+
+        Anvil::ImageBarrier present_src_to_transfer_src_barrier(Anvil::AccessFlagBits::MEMORY_READ_BIT,   /* in_source_access_mask      */
+                                                                Anvil::AccessFlagBits::TRANSFER_READ_BIT, /* in_destination_access_mask */
+                                                                Anvil::ImageLayout::PRESENT_SRC_KHR,
+                                                                Anvil::ImageLayout::TRANSFER_SRC_OPTIMAL,
+                                                                queue_fam_index,
+                                                                queue_fam_index,
+                                                                image_ptr,
+                                                                subresource_range);
+        Anvil::ImageBarrier transfer_src_to_present_src_barrier(Anvil::AccessFlagBits::TRANSFER_READ_BIT, /* in_source_access_mask      */
+                                                                Anvil::AccessFlagBits::MEMORY_READ_BIT,   /* in_destination_access_mask */
+                                                                Anvil::ImageLayout::TRANSFER_SRC_OPTIMAL,
+                                                                Anvil::ImageLayout::PRESENT_SRC_KHR,
+                                                                queue_fam_index,
+                                                                queue_fam_index,
+                                                                image_ptr,
+                                                                subresource_range);
+
+        cmd_buffer_ptr->record_pipeline_barrier(Anvil::PipelineStageFlagBits::ALL_COMMANDS_BIT,
+                                                Anvil::PipelineStageFlagBits::TRANSFER_BIT,
+                                                Anvil::DependencyFlagBits::NONE,
+                                                0,        /* in_memory_barrier_count        */
+                                                nullptr,  /* in_memory_barriers_ptr         */
+                                                0,        /* in_buffer_memory_barrier_count */
+                                                nullptr,  /* in_buffer_memory_barriers_ptr  */
+                                                1,        /* in_image_memory_barrier_count  */
+                                               &present_src_to_transfer_src_barrier);
+
+        copy_region.buffer_image_height                = 0; /* tightly packed */
+        copy_region.buffer_offset                      = 0;
+        copy_region.buffer_row_length                  = 0; /* tightly packed */
+        copy_region.image_extent.depth                 = 1;
+        copy_region.image_extent.height                = image_height;
+        copy_region.image_extent.width                 = image_width;
+        copy_region.image_offset.x                     = 0;
+        copy_region.image_offset.y                     = 0;
+        copy_region.image_offset.z                     = 0;
+        copy_region.image_subresource.aspect_mask      = Anvil::ImageAspectFlagBits::COLOR_BIT;
+        copy_region.image_subresource.base_array_layer = 0;
+        copy_region.image_subresource.layer_count      = 1;
+        copy_region.image_subresource.mip_level        = 0;
+
+        cmd_buffer_ptr->record_copy_image_to_buffer(image_ptr,
+                                                    Anvil::ImageLayout::TRANSFER_SRC_OPTIMAL,
+                                                    readback_buffer_ptr.get(),
+                                                    1, /* in_region_count */
+                                                   &copy_region);
+
+        cmd_buffer_ptr->record_pipeline_barrier(Anvil::PipelineStageFlagBits::TRANSFER_BIT,
+                                                Anvil::PipelineStageFlagBits::BOTTOM_OF_PIPE_BIT,
+                                                Anvil::DependencyFlagBits::NONE,
+                                                0,        /* in_memory_barrier_count        */
+                                                nullptr,  /* in_memory_barriers_ptr         */
+                                                0,        /* in_buffer_memory_barrier_count */
+                                                nullptr,  /* in_buffer_memory_barriers_ptr  */
+                                                1,        /* in_image_memory_barrier_count  */
+                                               &transfer_src_to_present_src_barrier);
+    }
+    cmd_buffer_ptr->stop_recording();
+
+    /* Off-screen presentation submits a wait on the frame's semaphores to the same queue, so the copy is ordered after
+     * rendering has finished.
+     */
+    {
+        Anvil::CommandBufferBase* cmd_buffer_raw_ptr = cmd_buffer_ptr.get();
+
+        universal_queue_ptr->submit(
+            Anvil::SubmitInfo::create_execute(&cmd_buffer_raw_ptr,
+                                              1,     /* in_n_cmd_buffers */
+                                              true)  /* in_should_block  */
+        );
+    }
+
+    if (!readback_buffer_ptr->read(0, /* in_start_offset */
+                                   image_data.size(),
+                                   image_data.data() ))
+    {
+        vkgl_assert_fail();
+
+        goto end;
+    }
+
+    /* Store as a binary PPM. Alpha is dropped, in place. */
+    for (uint32_t n_pixel = 0;
+                  n_pixel < image_width * image_height;
+                ++n_pixel)
+    {
+        memmove(image_data.data() + n_pixel * 3,
+                image_data.data() + n_pixel * 4,
+                3);
+    }
+
+    file_ptr = fopen(in_file_name.c_str(),
+                     "wb");
+
+    if (file_ptr == nullptr)
+    {
+        VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                "Could not open headless frame dump file.");
+
+        goto end;
+    }
+
+    fprintf(file_ptr,
+            "P6\n%u %u\n255\n",
+            image_width,
+            image_height);
+
+    fwrite(image_data.data(),
+           3, /* size  */
+           image_width * image_height,
+           file_ptr);
+
+    fclose(file_ptr);
+
+    result = true;
+end:
+    return result;
+}
+
 Anvil::Image* OpenGL::VKSwapchainManager::get_ds_image(const OpenGL::TimeMarker& in_time_marker,
                                                        const uint32_t&           in_n_swapchain_image)
 {
@@ -726,7 +925,37 @@ bool OpenGL::VKSwapchainManager::init()
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    bool result = false;
+    const char* headless_dump_env_ptr = getenv("VKGL_HEADLESS_DUMP");
+    const char* headless_env_ptr      = getenv("VKGL_HEADLESS");
+    bool        result                = false;
+
+    /* Check if headless mode was requested. */
+    if (headless_env_ptr != nullptr)
+    {
+        unsigned int height = 0;
+        unsigned int width  = 0;
+
+        if (sscanf(headless_env_ptr,
+                   "%ux%u",
+                  &width,
+                  &height) != 2 ||
+            width        == 0 ||
+            height       == 0)
+        {
+            VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                    "VKGL_HEADLESS must be set to <width>x<height>. Headless mode will not be used.");
+        }
+        else
+        {
+            m_headless_height = height;
+            m_headless_width  = width;
+
+            if (headless_dump_env_ptr != nullptr)
+            {
+                m_headless_dump_file_prefix = headless_dump_env_ptr;
+            }
+        }
+    }
 
     /* Initialize the swapchain snapshot manager. */
     const auto time_now = std::chrono::high_resolution_clock::now();
@@ -786,44 +1015,45 @@ void OpenGL::VKSwapchainManager::on_all_swapchain_snapshots_out_of_scope()
     }
 }
 
-void OpenGL::VKSwapchainManager::on_frame_acquisition_semaphore_out_of_scope(InternalSwapchainData* in_swapchain_data_ptr,
-                                                                             Anvil::Semaphore*      in_sem_ptr)
+void OpenGL::VKSwapchainManager::on_swapchain_image_presented(Anvil::Swapchain* in_swapchain_ptr,
+                                                              const uint32_t&   in_n_swapchain_image)
 {
     FUN_ENTRY(DEBUG_DEPTH);
-    
-    vkgl_assert(in_sem_ptr != nullptr);
 
-    if (!in_sem_ptr->reset() )
+    std::string file_name;
+
+    if (!is_headless()                            ||
+         m_headless_dump_file_prefix.size() == 0)
     {
-        vkgl_assert_fail();
+        goto end;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        file_name = m_headless_dump_file_prefix + "_" + std::to_string(m_n_headless_frames_dumped++) + ".ppm";
     }
 
-    Anvil::SemaphoreUniquePtr sem_ptr(in_sem_ptr,
-                                      [](Anvil::Semaphore* sem_ptr){delete sem_ptr;});
+    if (!dump_headless_frame(in_swapchain_ptr,
+                             in_n_swapchain_image,
+                             file_name) )
+    {
+        VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                "Could not store a headless frame.");
+    }
 
-    in_swapchain_data_ptr->frame_acquisition_semaphore_ptrs.push_back(std::move(sem_ptr) );
+end:
+    ;
 }
 
-Anvil::SemaphoreUniquePtr OpenGL::VKSwapchainManager::pop_frame_acquisition_semaphore(const OpenGL::TimeMarker& in_time_marker)
+Anvil::SemaphoreUniquePtr OpenGL::VKSwapchainManager::pop_frame_acquisition_semaphore()
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    std::lock_guard<std::mutex> lock(m_mutex);
-    auto                        internal_data_iterator = m_time_marker_to_internal_swapchain_data_map.find(in_time_marker);
-
-    vkgl_assert(internal_data_iterator                                                  != m_time_marker_to_internal_swapchain_data_map.end() );
-    vkgl_assert(internal_data_iterator->second->frame_acquisition_semaphore_ptrs.size() >  0);
-
-    auto                      internal_data_ptr = internal_data_iterator->second.get();
-    Anvil::SemaphoreUniquePtr result_sem_ptr    = std::move(internal_data_ptr->frame_acquisition_semaphore_ptrs.back() );
-
-	auto delete_callback_for_result_sem_ptr = std::bind(&OpenGL::VKSwapchainManager::on_frame_acquisition_semaphore_out_of_scope,
-                                                       this,
-                                                       internal_data_ptr,
-                                                       result_sem_ptr.get() );
-
-    return Anvil::SemaphoreUniquePtr(result_sem_ptr.release(),
-                                     delete_callback_for_result_sem_ptr);
+    /* NOTE: Acquisition semaphores are not tied to a specific swapchain, so they are served from the backend's sync object pool.
+     *       The returned sem goes back to the pool when it goes out of scope.
+     */
+    return m_backend_ptr->get_sync_object_pool_ptr()->acquire_semaphore();
 }
 
 void OpenGL::VKSwapchainManager::recreate_swapchain(const bool& in_defer_till_acquisition)
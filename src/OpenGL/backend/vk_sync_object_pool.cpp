@@ -0,0 +1,264 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "Common/macros.h"
+#include "OpenGL/backend/vk_sync_object_pool.h"
+#include "Anvil/include/misc/event_create_info.h"
+#include "Anvil/include/misc/fence_create_info.h"
+#include "Anvil/include/misc/semaphore_create_info.h"
+#include "Anvil/include/wrappers/event.h"
+#include "Anvil/include/wrappers/fence.h"
+#include "Anvil/include/wrappers/semaphore.h"
+#include <algorithm>
+#include <functional>
+
+OpenGL::VKSyncObjectPool::VKSyncObjectPool(IBackend* in_backend_ptr)
+    :m_backend_ptr        (in_backend_ptr),
+     m_n_events_in_use    (0),
+     m_n_fences_in_use    (0),
+     m_n_semaphores_in_use(0)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    vkgl_assert(in_backend_ptr != nullptr);
+}
+
+OpenGL::VKSyncObjectPool::~VKSyncObjectPool()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    /* All objects handed out by the pool are expected to have been returned by now. Otherwise their deleters would
+     * access a dangling pool ptr.
+     */
+    vkgl_assert(m_n_events_in_use     == 0);
+    vkgl_assert(m_n_fences_in_use     == 0);
+    vkgl_assert(m_n_semaphores_in_use == 0);
+
+    m_free_event_ptrs.clear    ();
+    m_free_fence_ptrs.clear    ();
+    m_free_semaphore_ptrs.clear();
+}
+
+Anvil::EventUniquePtr OpenGL::VKSyncObjectPool::acquire_event()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    Anvil::EventUniquePtr result_ptr;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_free_event_ptrs.size() > 0)
+        {
+            result_ptr = std::move(m_free_event_ptrs.back() );
+
+            m_free_event_ptrs.pop_back();
+
+            m_stats.n_events_recycled++;
+        }
+        else
+        {
+            m_stats.n_events_created++;
+        }
+
+        m_stats.n_events_in_use_max = std::max(m_stats.n_events_in_use_max,
+                                               ++m_n_events_in_use);
+    }
+
+    if (result_ptr == nullptr)
+    {
+        auto create_info_ptr = Anvil::EventCreateInfo::create(m_backend_ptr->get_device_ptr() );
+
+        result_ptr = Anvil::Event::create(std::move(create_info_ptr) );
+        vkgl_assert(result_ptr != nullptr);
+    }
+
+    return Anvil::EventUniquePtr(result_ptr.release(),
+                                 std::bind(&OpenGL::VKSyncObjectPool::release_event,
+                                           this,
+                                           std::placeholders::_1) );
+}
+
+Anvil::FenceUniquePtr OpenGL::VKSyncObjectPool::acquire_fence()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    Anvil::FenceUniquePtr result_ptr;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_free_fence_ptrs.size() > 0)
+        {
+            result_ptr = std::move(m_free_fence_ptrs.back() );
+
+            m_free_fence_ptrs.pop_back();
+
+            m_stats.n_fences_recycled++;
+        }
+        else
+        {
+            m_stats.n_fences_created++;
+        }
+
+        m_stats.n_fences_in_use_max = std::max(m_stats.n_fences_in_use_max,
+                                               ++m_n_fences_in_use);
+    }
+
+    if (result_ptr == nullptr)
+    {
+        auto create_info_ptr = Anvil::FenceCreateInfo::create(m_backend_ptr->get_device_ptr(),
+                                                              false); /* in_create_signalled */
+
+        result_ptr = Anvil::Fence::create(std::move(create_info_ptr) );
+        vkgl_assert(result_ptr != nullptr);
+    }
+
+    return Anvil::FenceUniquePtr(result_ptr.release(),
+                                 std::bind(&OpenGL::VKSyncObjectPool::release_fence,
+                                           this,
+                                           std::placeholders::_1) );
+}
+
+Anvil::SemaphoreUniquePtr OpenGL::VKSyncObjectPool::acquire_semaphore()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    Anvil::SemaphoreUniquePtr result_ptr;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_free_semaphore_ptrs.size() > 0)
+        {
+            result_ptr = std::move(m_free_semaphore_ptrs.back() );
+
+            m_free_semaphore_ptrs.pop_back();
+
+            m_stats.n_semaphores_recycled++;
+        }
+        else
+        {
+            m_stats.n_semaphores_created++;
+        }
+
+        m_stats.n_semaphores_in_use_max = std::max(m_stats.n_semaphores_in_use_max,
+                                                   ++m_n_semaphores_in_use);
+    }
+
+    if (result_ptr == nullptr)
+    {
+        auto create_info_ptr = Anvil::SemaphoreCreateInfo::create(m_backend_ptr->get_device_ptr() );
+
+        result_ptr = Anvil::Semaphore::create(std::move(create_info_ptr) );
+        vkgl_assert(result_ptr != nullptr);
+    }
+
+    return Anvil::SemaphoreUniquePtr(result_ptr.release(),
+                                     std::bind(&OpenGL::VKSyncObjectPool::release_semaphore,
+                                               this,
+                                               std::placeholders::_1) );
+}
+
+OpenGL::VKSyncObjectPoolUniquePtr OpenGL::VKSyncObjectPool::create(IBackend* in_backend_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    OpenGL::VKSyncObjectPoolUniquePtr result_ptr;
+
+    result_ptr.reset(new OpenGL::VKSyncObjectPool(in_backend_ptr) );
+    vkgl_assert(result_ptr != nullptr);
+
+    return result_ptr;
+}
+
+OpenGL::VKSyncObjectPoolStats OpenGL::VKSyncObjectPool::pop_frame_stats()
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    std::lock_guard<std::mutex>   lock  (m_mutex);
+    OpenGL::VKSyncObjectPoolStats result(m_stats);
+
+    m_stats.n_events_created      = 0;
+    m_stats.n_events_recycled     = 0;
+    m_stats.n_fences_created      = 0;
+    m_stats.n_fences_recycled     = 0;
+    m_stats.n_semaphores_created  = 0;
+    m_stats.n_semaphores_recycled = 0;
+
+    return result;
+}
+
+void OpenGL::VKSyncObjectPool::release_event(Anvil::Event* in_event_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    vkgl_assert(in_event_ptr != nullptr);
+
+    if (!in_event_ptr->reset() )
+    {
+        vkgl_assert_fail();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        vkgl_assert(m_n_events_in_use > 0);
+
+        m_free_event_ptrs.push_back(
+            Anvil::EventUniquePtr(in_event_ptr,
+                                  [](Anvil::Event* in_event_ptr){delete in_event_ptr;})
+        );
+
+        m_n_events_in_use--;
+    }
+}
+
+void OpenGL::VKSyncObjectPool::release_fence(Anvil::Fence* in_fence_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    vkgl_assert(in_fence_ptr != nullptr);
+
+    if (!in_fence_ptr->reset() )
+    {
+        vkgl_assert_fail();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        vkgl_assert(m_n_fences_in_use > 0);
+
+        m_free_fence_ptrs.push_back(
+            Anvil::FenceUniquePtr(in_fence_ptr,
+                                  [](Anvil::Fence* in_fence_ptr){delete in_fence_ptr;})
+        );
+
+        m_n_fences_in_use--;
+    }
+}
+
+void OpenGL::VKSyncObjectPool::release_semaphore(Anvil::Semaphore* in_semaphore_ptr)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    vkgl_assert(in_semaphore_ptr != nullptr);
+
+    /* NOTE: Binary semaphores cannot be reset. Anvil::Semaphore::reset() re-creates the underlying object, which is exactly
+     *       what the pool is meant to avoid. See the class description for why it's safe to skip this.
+     */
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        vkgl_assert(m_n_semaphores_in_use > 0);
+
+        m_free_semaphore_ptrs.push_back(
+            Anvil::SemaphoreUniquePtr(in_semaphore_ptr,
+                                      [](Anvil::Semaphore* in_semaphore_ptr){delete in_semaphore_ptr;})
+        );
+
+        m_n_semaphores_in_use--;
+    }
+}
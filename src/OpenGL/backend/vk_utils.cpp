@@ -373,6 +373,12 @@ Anvil::BufferUsageFlags OpenGL::VKUtils::get_buffer_usage_flags_for_gl_buffer(co
         }
     }
 
+    /* Buffer contents are uploaded & read back (incl. for glMapBuffer*() purposes) with copy ops, regardless of
+     * which targets the buffer has been bound to.
+     */
+    result |= Anvil::BufferUsageFlagBits::TRANSFER_SRC_BIT;
+    result |= Anvil::BufferUsageFlagBits::TRANSFER_DST_BIT;
+
     return result;
 }
 
@@ -3,9 +3,11 @@
  * This code is licensed under MIT license (see LICENSE.txt for details)
  */
 #include "Common/macros.h"
+#include "Common/trace_recorder.h"
 #include "Common/types.h"
 #include "OpenGL/types.h"
 #include "OpenGL/context.h"
+#include "OpenGL/converters.h"
 #include "OpenGL/frontend/gl_buffer_manager.h"
 #include "OpenGL/frontend/gl_program_manager.h"
 #include "OpenGL/frontend/gl_reference.h"
@@ -18,7 +20,9 @@
 #include "OpenGL/backend/vk_renderpass_manager.h"
 #include "OpenGL/backend/vk_framebuffer_manager.h"
 #include "OpenGL/backend/vk_image_manager.h"
+#include "OpenGL/backend/thread_pool.h"
 #include "OpenGL/utils_enum.h"
+#include "OpenGL/entrypoints/gl_capture.h"
 /*
 #include "OpenGL/entrypoints/GL1.0/gl_blend_func.h"
 #include "OpenGL/entrypoints/GL1.0/gl_clear.h"
@@ -453,6 +457,7 @@ OpenGL::Context::Context(const VKGL::IWSIContext*     in_wsi_context_ptr,
     :m_backend_caps_ptr        (in_backend_caps_ptr),
      m_backend_gl_callbacks_ptr(in_backend_gl_callbacks_ptr),
      m_backend_ptr				(in_backend_ptr),
+     m_max_shader_compiler_threads(UINT32_MAX), /* Implementation-specific maximum, as per KHR_parallel_shader_compile */
      m_wsi_context_ptr         (in_wsi_context_ptr)
 {
     FUN_ENTRY(DEBUG_DEPTH);
@@ -2566,6 +2571,16 @@ void OpenGL::Context::get_parameter(const OpenGL::ContextProperty&    in_pname,
         vkgl_not_implemented();
     }
     else
+    if (in_pname == OpenGL::ContextProperty::Max_Shader_Compiler_Threads)
+    {
+        /* Ditto. */
+        OpenGL::Converters::convert(OpenGL::GetSetArgumentType::Unsigned_Int,
+                                   &m_max_shader_compiler_threads,
+                                    1, /* in_n_vals */
+                                    in_arg_type,
+                                    out_arg_value_ptr);
+    }
+    else
 #if 0
     if (OpenGL::Utils::is_buffer_binding_pname(in_pname) ) // todo: buffer bindings
     {
@@ -3056,6 +3071,9 @@ bool OpenGL::Context::init()
     
     bool result = false;
 
+    /* Contexts are created from the app's rendering thread. */
+    VKGL::TraceRecorder::set_thread_name("App thread");
+
     /* Init dispatch table */
     result = init_dispatch_table();
 
@@ -3605,7 +3623,8 @@ bool OpenGL::Context::init_supported_extensions()
         "GL_ARB_vertex_array_object",
         "GL_ARB_vertex_buffer_object",
         "GL_ARB_vertex_program",
-        "GL_ARB_vertex_shader"
+        "GL_ARB_vertex_shader",
+        "GL_KHR_parallel_shader_compile"
     };
 
     result = true;
@@ -3728,15 +3747,15 @@ void* OpenGL::Context::map_buffer(const OpenGL::BufferTarget& in_target,
                                                                                        &buffer_reference_time_marker);
 
     return m_backend_gl_callbacks_ptr->map_buffer(buffer_reference_ptr->get_payload().id,
-                                                  in_access,
+                                                  OpenGL::Utils::get_buffer_map_bits_for_buffer_access(in_access),
                                                   0, /* in_start_offset */
                                                   buffer_size);
 }
 
-void* OpenGL::Context::map_buffer_range(const OpenGL::BufferTarget& in_target,
-                                        const GLintptr&             in_offset,
-                                        const GLsizeiptr&           in_length,
-                                        const OpenGL::BufferAccess& in_access)
+void* OpenGL::Context::map_buffer_range(const OpenGL::BufferTarget&  in_target,
+                                        const GLintptr&              in_offset,
+                                        const GLsizeiptr&            in_length,
+                                        const OpenGL::BufferMapBits& in_map_bits)
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
@@ -3747,7 +3766,7 @@ void* OpenGL::Context::map_buffer_range(const OpenGL::BufferTarget& in_target,
     vkgl_assert(buffer_id != 0);
 
     return m_backend_gl_callbacks_ptr->map_buffer(buffer_id,
-                                                  in_access,
+                                                  in_map_bits,
                                                   in_offset,
                                                   in_length);
 }
@@ -3808,7 +3827,15 @@ void OpenGL::Context::present()
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    m_backend_gl_callbacks_ptr->present();
+    {
+        VKGL_TRACE_SCOPE("Present");
+
+        m_backend_gl_callbacks_ptr->present();
+    }
+
+    VKGL::APIProfiler::on_frame_presented  ();
+    VKGL::TraceRecorder::on_frame_presented();
+    OpenGL::GLCapture::on_frame_presented  ();
 }
 
 void OpenGL::Context::read_pixels(const int32_t&             in_x,
@@ -4076,6 +4103,23 @@ void OpenGL::Context::set_logic_op(const OpenGL::LogicOpMode& in_mode)
     m_gl_state_manager_ptr->set_logic_op(in_mode);
 }
 
+void OpenGL::Context::set_max_shader_compiler_threads(const GLuint& in_count)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+    
+    auto thread_pool_ptr = m_backend_ptr->get_thread_pool_ptr();
+
+    m_max_shader_compiler_threads = in_count;
+
+    /* Compile & link tasks are the only ones the thread pool runs. 0 asks for no parallelism, which we map to a single
+     * worker thread, so that completion queries remain non-blocking. The null backend has no thread pool.
+     */
+    if (thread_pool_ptr != nullptr)
+    {
+        thread_pool_ptr->set_max_n_running_tasks(in_count);
+    }
+}
+
 void OpenGL::Context::set_matrix_uniform(const GLint&    in_location,
                                          const uint32_t& in_n_columns,
                                          const uint32_t& in_n_rows,
@@ -4893,28 +4937,39 @@ void OpenGL::Context::use_program(const GLuint& in_program)
     
     if (in_program != 0)
     {
+        bool                        is_link_complete   = false;
         const OpenGL::PostLinkData* post_link_data_ptr = nullptr;
         OpenGL::SPIRVBlobID 		spirv_id 			= UINT_MAX;
         
-        {
-            m_gl_program_manager_ptr->get_program_post_link_data_ptr(program_reference_ptr->get_payload().id,
-            																&program_reference_ptr->get_payload().time_marker,
-            																&post_link_data_ptr);
-            vkgl_assert(post_link_data_ptr != nullptr);
-        }
-        
         {
             result = spirv_manager_ptr->get_spirv_blob_id_for_program_reference(program_reference_ptr->get_payload().id,
             																program_reference_ptr->get_payload().time_marker,
             																&spirv_id);
         	vkgl_assert(result != false);
     	}
-    	
-    	{
-        	result = spirv_manager_ptr->build_uniform_resources(spirv_id,
-        													post_link_data_ptr);
-        	vkgl_assert(result != false);
-    	}
+
+        /* Do not wait for a link which is still in progress. Uniform resources of such programs are built when the
+         * first draw call which uses them is prepared, either by the backend or the scheduler.
+         */
+        result = spirv_manager_ptr->get_program_link_completion_status(spirv_id,
+                                                                      &is_link_complete);
+        vkgl_assert(result != false);
+
+        if (is_link_complete)
+        {
+            {
+                m_gl_program_manager_ptr->get_program_post_link_data_ptr(program_reference_ptr->get_payload().id,
+                																&program_reference_ptr->get_payload().time_marker,
+                																&post_link_data_ptr);
+                vkgl_assert(post_link_data_ptr != nullptr);
+            }
+
+        	{
+            	result = spirv_manager_ptr->build_uniform_resources(spirv_id,
+            													post_link_data_ptr);
+            	vkgl_assert(result != false);
+        	}
+        }
 	}
 
     m_gl_program_manager_ptr->mark_id_as_alive      (in_program);
@@ -6,430 +6,188 @@
 #include "OpenGL/converters.h"
 #include "OpenGL/utils_enum.h"
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
 
-#ifdef max
-    #undef max
+#ifdef min
+    #undef min
 #endif
 
-static void convert_from_f32(const void*                       in_vals_ptr,
-                             const uint32_t&                   in_n_vals,
-                             const OpenGL::GetSetArgumentType& in_dst_type,
-                             void*                             out_result_ptr)
+/* Per-value conversion rules. Anything not specialized below is a plain static_cast. */
+template<typename SrcType, typename DstType>
+static inline DstType convert_value(const SrcType& in_val)
 {
-    const float* in_vals_f32_ptr = reinterpret_cast<const float*>(in_vals_ptr);
-
-    for (uint32_t n_val = 0;
-                  n_val < in_n_vals;
-                ++n_val)
-    {
-        switch (in_dst_type)
-        {
-            case OpenGL::GetSetArgumentType::Boolean:
-            {
-                bool* result_ptr = reinterpret_cast<bool*>(out_result_ptr) + n_val;
-
-                *result_ptr = !(fabs(in_vals_f32_ptr[n_val]) < 1e-5f);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Double:
-            {
-                double* result_ptr = reinterpret_cast<double*>(out_result_ptr) + n_val;
-
-                *result_ptr = in_vals_f32_ptr[n_val];
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Float:
-            {
-                float* result_ptr = reinterpret_cast<float*>(out_result_ptr) + n_val;
-
-                *result_ptr = in_vals_f32_ptr[n_val];
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Int:
-            {
-                int32_t* result_ptr = reinterpret_cast<int32_t*>(out_result_ptr) + n_val;
-
-                *result_ptr = static_cast<int32_t>(in_vals_f32_ptr[n_val]);
-                break;
-            }
+    return static_cast<DstType>(in_val);
+}
 
-            case OpenGL::GetSetArgumentType::Unsigned_Int:
-            {
-                uint32_t* result_ptr = reinterpret_cast<uint32_t*>(out_result_ptr) + n_val;
+template<>
+inline bool convert_value<double, bool>(const double& in_val)
+{
+    return !(fabs(in_val) < 1e-5f);
+}
 
-                *result_ptr = static_cast<uint32_t>(in_vals_f32_ptr[n_val]);
-                break;
-            }
+template<>
+inline bool convert_value<float, bool>(const float& in_val)
+{
+    return !(fabsf(in_val) < 1e-5f);
+}
 
-            default:
-            {
-                vkgl_assert_fail();
-            }
-        }
-    }
+template<>
+inline int32_t convert_value<uint64_t, int32_t>(const uint64_t& in_val)
+{
+    return static_cast<int32_t>(std::min(in_val,
+                                         static_cast<uint64_t>(INT32_MAX) ));
 }
 
-static void convert_from_f64(const void*                       in_vals_ptr,
-                             const uint32_t&                   in_n_vals,
-                             const OpenGL::GetSetArgumentType& in_dst_type,
-                             void*                             out_result_ptr)
+template<>
+inline uint32_t convert_value<uint64_t, uint32_t>(const uint64_t& in_val)
 {
-    const double* in_vals_f64_ptr = reinterpret_cast<const double*>(in_vals_ptr);
+    return static_cast<uint32_t>(std::min(in_val,
+                                          static_cast<uint64_t>(UINT32_MAX) ));
+}
 
+/* Converts N_VALS values. The trip count is known at compile time, so the loop is fully unrolled and, for the
+ * arithmetic conversions, vectorised.
+ */
+template<typename SrcType, typename DstType, uint32_t N_VALS>
+static inline void convert_fixed_n_values(const SrcType* in_vals_ptr,
+                                          DstType*       out_result_ptr)
+{
     for (uint32_t n_val = 0;
-                  n_val < in_n_vals;
+                  n_val < N_VALS;
                 ++n_val)
     {
-        switch (in_dst_type)
-        {
-            case OpenGL::GetSetArgumentType::Boolean:
-            {
-                bool* result_ptr = reinterpret_cast<bool*>(out_result_ptr) + n_val;
-
-                *result_ptr = !(fabs(in_vals_f64_ptr[n_val]) < 1e-5f);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Double:
-            {
-                double* result_ptr = reinterpret_cast<double*>(out_result_ptr) + n_val;
-
-                *result_ptr = in_vals_f64_ptr[n_val];
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Float:
-            {
-                float* result_ptr = reinterpret_cast<float*>(out_result_ptr) + n_val;
-
-                *result_ptr = static_cast<float>(in_vals_f64_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Int:
-            {
-                int32_t* result_ptr = reinterpret_cast<int32_t*>(out_result_ptr) + n_val;
-
-                *result_ptr = static_cast<int32_t>(in_vals_f64_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Unsigned_Int:
-            {
-                uint32_t* result_ptr = reinterpret_cast<uint32_t*>(out_result_ptr) + n_val;
-
-                *result_ptr = static_cast<uint32_t>(in_vals_f64_ptr[n_val]);
-                break;
-            }
-
-            default:
-            {
-                vkgl_assert_fail();
-            }
-        }
+        out_result_ptr[n_val] = convert_value<SrcType, DstType>(in_vals_ptr[n_val]);
     }
 }
 
-static void convert_from_i32(const void*                       in_vals_ptr,
-                             const uint32_t&                   in_n_vals,
-                             const OpenGL::GetSetArgumentType& in_dst_type,
-                             void*                             out_result_ptr)
+template<typename SrcType, typename DstType>
+static void convert_values(const void*     in_vals_ptr,
+                           const uint32_t& in_n_vals,
+                           void*           out_result_ptr)
 {
-    const int32_t* in_vals_i32_ptr = reinterpret_cast<const int32_t*>(in_vals_ptr);
+    const SrcType* src_vals_ptr   = reinterpret_cast<const SrcType*>(in_vals_ptr);
+    DstType*       dst_result_ptr = reinterpret_cast<DstType*>      (out_result_ptr);
 
-    for (uint32_t n_val = 0;
-                  n_val < in_n_vals;
-                ++n_val)
+    if (std::is_same<SrcType, DstType>::value)
     {
-        switch (in_dst_type)
-        {
-            case OpenGL::GetSetArgumentType::Boolean:
-            {
-                bool* result_ptr = reinterpret_cast<bool*>(out_result_ptr) + n_val;
-
-                *result_ptr = (in_vals_i32_ptr[n_val] != 0);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Double:
-            {
-                double* result_ptr = reinterpret_cast<double*>(out_result_ptr) + n_val;
-
-                *result_ptr = static_cast<double>(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Float:
-            {
-                float* result_ptr = reinterpret_cast<float*>(out_result_ptr) + n_val;
-
-                *result_ptr = static_cast<float>(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Int:
-            {
-                int32_t* result_ptr = reinterpret_cast<int32_t*>(out_result_ptr) + n_val;
-
-                *result_ptr = in_vals_i32_ptr[n_val];
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Unsigned_Int:
-            {
-                uint32_t* result_ptr = reinterpret_cast<uint32_t*>(out_result_ptr) + n_val;
-
-                *result_ptr = in_vals_i32_ptr[n_val];
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::BlendEquationVKGL:
-            {
-                OpenGL::BlendEquation* result_ptr = reinterpret_cast<OpenGL::BlendEquation*>(out_result_ptr) + n_val;
+        memcpy(out_result_ptr,
+               in_vals_ptr,
+               sizeof(SrcType) * in_n_vals);
 
-                *result_ptr = OpenGL::Utils::get_blend_equation_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::BlendFunctionVKGL:
-            {
-                OpenGL::BlendFunction* result_ptr = reinterpret_cast<OpenGL::BlendFunction*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_blend_function_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::CullFaceVKGL:
-            {
-                OpenGL::CullMode* result_ptr = reinterpret_cast<OpenGL::CullMode*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_cull_mode_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::DepthFunctionVKGL:
-            {
-                OpenGL::DepthFunction* result_ptr = reinterpret_cast<OpenGL::DepthFunction*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_depth_function_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::HintModeVKGL:
-            {
-                OpenGL::HintMode* result_ptr = reinterpret_cast<OpenGL::HintMode*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_hint_mode_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::LogicOpModeVKGL:
-            {
-                OpenGL::LogicOpMode* result_ptr = reinterpret_cast<OpenGL::LogicOpMode*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_logic_op_mode_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::ProvokingVertexConventionVKGL:
-            {
-                OpenGL::ProvokingVertexConvention* result_ptr = reinterpret_cast<OpenGL::ProvokingVertexConvention*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_provoking_vertex_convention_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::StencilFunctionVKGL:
-            {
-                OpenGL::StencilFunction* result_ptr = reinterpret_cast<OpenGL::StencilFunction*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_stencil_function_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::StencilOperationVKGL:
-            {
-                OpenGL::StencilOperation* result_ptr = reinterpret_cast<OpenGL::StencilOperation*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_stencil_operation_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::TextureMagFilterVKGL:
-            {
-                OpenGL::TextureMagFilter* result_ptr = reinterpret_cast<OpenGL::TextureMagFilter*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_texture_mag_filter_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::TextureMinFilterVKGL:
-            {
-                OpenGL::TextureMinFilter* result_ptr = reinterpret_cast<OpenGL::TextureMinFilter*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_texture_min_filter_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::TextureSwizzleVKGL:
-            {
-                OpenGL::TextureSwizzle* result_ptr = reinterpret_cast<OpenGL::TextureSwizzle*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_texture_swizzle_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::TextureWrapModeVKGL:
-            {
-                OpenGL::TextureWrapMode* result_ptr = reinterpret_cast<OpenGL::TextureWrapMode*>(out_result_ptr) + n_val;
-
-                *result_ptr = OpenGL::Utils::get_texture_wrap_mode_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::TransformFeedbackBufferModeVKGL:
-            {
-                OpenGL::TransformFeedbackBufferMode* result_ptr = reinterpret_cast<OpenGL::TransformFeedbackBufferMode*>(out_result_ptr) + n_val;
+        return;
+    }
 
-                *result_ptr = OpenGL::Utils::get_transform_feedback_buffer_mode_for_gl_enum(in_vals_i32_ptr[n_val]);
-                break;
-            }
+    /* Vectors & 4x4 matrices account for nearly all multi-component queries, so give them their own paths. */
+    switch (in_n_vals)
+    {
+        case 1:  dst_result_ptr[0] = convert_value<SrcType, DstType>(src_vals_ptr[0]);           break;
+        case 4:  convert_fixed_n_values<SrcType, DstType, 4> (src_vals_ptr, dst_result_ptr); break;
+        case 16: convert_fixed_n_values<SrcType, DstType, 16>(src_vals_ptr, dst_result_ptr); break;
 
-            default:
+        default:
+        {
+            for (uint32_t n_val = 0;
+                          n_val < in_n_vals;
+                        ++n_val)
             {
-                vkgl_assert_fail();
+                dst_result_ptr[n_val] = convert_value<SrcType, DstType>(src_vals_ptr[n_val]);
             }
         }
     }
 }
 
-static void convert_from_u32(const void*                       in_vals_ptr,
-                             const uint32_t&                   in_n_vals,
-                             const OpenGL::GetSetArgumentType& in_dst_type,
-                             void*                             out_result_ptr)
+/* GLenum -> VKGL enum. Used by setters which take GL enums as integers. */
+template<typename EnumType, EnumType (*PFN_GET_ENUM_FOR_GL_ENUM)(const GLenum&)>
+static void convert_values_to_vkgl_enum(const void*     in_vals_ptr,
+                                        const uint32_t& in_n_vals,
+                                        void*           out_result_ptr)
 {
-    const uint32_t* in_vals_i32_ptr = reinterpret_cast<const uint32_t*>(in_vals_ptr);
+    const int32_t* src_vals_ptr   = reinterpret_cast<const int32_t*>(in_vals_ptr);
+    EnumType*      dst_result_ptr = reinterpret_cast<EnumType*>     (out_result_ptr);
 
     for (uint32_t n_val = 0;
                   n_val < in_n_vals;
                 ++n_val)
     {
-        switch (in_dst_type)
-        {
-            case OpenGL::GetSetArgumentType::Boolean:
-            {
-                bool* result_ptr = reinterpret_cast<bool*>(out_result_ptr) + n_val;
-
-                *result_ptr = (in_vals_i32_ptr[n_val] != 0);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Double:
-            {
-                double* result_ptr = reinterpret_cast<double*>(out_result_ptr) + n_val;
-
-                *result_ptr = static_cast<double>(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Float:
-            {
-                float* result_ptr = reinterpret_cast<float*>(out_result_ptr) + n_val;
-
-                *result_ptr = static_cast<float>(in_vals_i32_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Int:
-            {
-                int32_t* result_ptr = reinterpret_cast<int32_t*>(out_result_ptr) + n_val;
-
-                *result_ptr = in_vals_i32_ptr[n_val];
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Unsigned_Int:
-            {
-                uint32_t* result_ptr = reinterpret_cast<uint32_t*>(out_result_ptr) + n_val;
+        dst_result_ptr[n_val] = PFN_GET_ENUM_FOR_GL_ENUM(static_cast<GLenum>(src_vals_ptr[n_val]) );
+    }
+}
 
-                *result_ptr = in_vals_i32_ptr[n_val];
-                break;
-            }
+/* Dispatches on the destination type once per call, rather than once per value. */
+template<typename SrcType>
+static void convert_from(const void*                       in_vals_ptr,
+                         const uint32_t&                   in_n_vals,
+                         const OpenGL::GetSetArgumentType& in_dst_type,
+                         void*                             out_result_ptr)
+{
+    switch (in_dst_type)
+    {
+        case OpenGL::GetSetArgumentType::Boolean:      convert_values<SrcType, bool>    (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::Double:       convert_values<SrcType, double>  (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::Float:        convert_values<SrcType, float>   (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::Int:          convert_values<SrcType, int32_t> (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::Unsigned_Int: convert_values<SrcType, uint32_t>(in_vals_ptr, in_n_vals, out_result_ptr); break;
 
-            default:
-            {
-                vkgl_assert_fail();
-            }
+        default:
+        {
+            vkgl_assert_fail();
         }
     }
 }
 
-static void convert_from_u64(const void*                       in_vals_ptr,
-                             const uint32_t&                   in_n_vals,
-                             const OpenGL::GetSetArgumentType& in_dst_type,
-                             void*                             out_result_ptr)
+template<>
+void convert_from<int32_t>(const void*                       in_vals_ptr,
+                           const uint32_t&                   in_n_vals,
+                           const OpenGL::GetSetArgumentType& in_dst_type,
+                           void*                             out_result_ptr)
 {
-    const uint64_t* in_vals_u64_ptr = reinterpret_cast<const uint64_t*>(in_vals_ptr);
-
-    for (uint32_t n_val = 0;
-                  n_val < in_n_vals;
-                ++n_val)
+    switch (in_dst_type)
     {
-        switch (in_dst_type)
-        {
-            case OpenGL::GetSetArgumentType::Boolean:
-            {
-                bool* result_ptr = reinterpret_cast<bool*>(out_result_ptr) + n_val;
-
-                *result_ptr = (in_vals_u64_ptr[n_val] != 0);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Double:
-            {
-                double* result_ptr = reinterpret_cast<double*>(out_result_ptr) + n_val;
-
-                *result_ptr = static_cast<double>(in_vals_u64_ptr[n_val]);
-                break;
-            }
+        case OpenGL::GetSetArgumentType::Boolean:      convert_values<int32_t, bool>    (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::Double:       convert_values<int32_t, double>  (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::Float:        convert_values<int32_t, float>   (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::Int:          convert_values<int32_t, int32_t> (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::Unsigned_Int: convert_values<int32_t, uint32_t>(in_vals_ptr, in_n_vals, out_result_ptr); break;
+
+        case OpenGL::GetSetArgumentType::BlendEquationVKGL:               convert_values_to_vkgl_enum<OpenGL::BlendEquation,               OpenGL::Utils::get_blend_equation_for_gl_enum>               (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::BlendFunctionVKGL:               convert_values_to_vkgl_enum<OpenGL::BlendFunction,               OpenGL::Utils::get_blend_function_for_gl_enum>               (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::CullFaceVKGL:                    convert_values_to_vkgl_enum<OpenGL::CullMode,                    OpenGL::Utils::get_cull_mode_for_gl_enum>                    (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::DepthFunctionVKGL:               convert_values_to_vkgl_enum<OpenGL::DepthFunction,               OpenGL::Utils::get_depth_function_for_gl_enum>               (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::HintModeVKGL:                    convert_values_to_vkgl_enum<OpenGL::HintMode,                    OpenGL::Utils::get_hint_mode_for_gl_enum>                    (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::LogicOpModeVKGL:                 convert_values_to_vkgl_enum<OpenGL::LogicOpMode,                 OpenGL::Utils::get_logic_op_mode_for_gl_enum>                (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::ProvokingVertexConventionVKGL:   convert_values_to_vkgl_enum<OpenGL::ProvokingVertexConvention,   OpenGL::Utils::get_provoking_vertex_convention_for_gl_enum>  (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::StencilFunctionVKGL:             convert_values_to_vkgl_enum<OpenGL::StencilFunction,             OpenGL::Utils::get_stencil_function_for_gl_enum>             (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::StencilOperationVKGL:            convert_values_to_vkgl_enum<OpenGL::StencilOperation,            OpenGL::Utils::get_stencil_operation_for_gl_enum>            (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::TextureMagFilterVKGL:            convert_values_to_vkgl_enum<OpenGL::TextureMagFilter,            OpenGL::Utils::get_texture_mag_filter_for_gl_enum>           (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::TextureMinFilterVKGL:            convert_values_to_vkgl_enum<OpenGL::TextureMinFilter,            OpenGL::Utils::get_texture_min_filter_for_gl_enum>           (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::TextureSwizzleVKGL:              convert_values_to_vkgl_enum<OpenGL::TextureSwizzle,              OpenGL::Utils::get_texture_swizzle_for_gl_enum>              (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::TextureWrapModeVKGL:             convert_values_to_vkgl_enum<OpenGL::TextureWrapMode,             OpenGL::Utils::get_texture_wrap_mode_for_gl_enum>            (in_vals_ptr, in_n_vals, out_result_ptr); break;
+        case OpenGL::GetSetArgumentType::TransformFeedbackBufferModeVKGL: convert_values_to_vkgl_enum<OpenGL::TransformFeedbackBufferMode, OpenGL::Utils::get_transform_feedback_buffer_mode_for_gl_enum>(in_vals_ptr, in_n_vals, out_result_ptr); break;
 
-            case OpenGL::GetSetArgumentType::Float:
-            {
-                float* result_ptr = reinterpret_cast<float*>(out_result_ptr) + n_val;
-
-                *result_ptr = static_cast<float>(in_vals_u64_ptr[n_val]);
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Int:
-            {
-                int32_t* result_ptr = reinterpret_cast<int32_t*>(out_result_ptr) + n_val;
-
-                *result_ptr = static_cast<int32_t>(std::max(in_vals_u64_ptr[n_val],
-                                                   static_cast<uint64_t>(UINT32_MAX) ));
-
-                break;
-            }
-
-            case OpenGL::GetSetArgumentType::Unsigned_Int:
-            {
-                uint32_t* result_ptr = reinterpret_cast<uint32_t*>(out_result_ptr) + n_val;
+        default:
+        {
+            vkgl_assert_fail();
+        }
+    }
+}
 
-                *result_ptr = static_cast<uint32_t>(std::max(in_vals_u64_ptr[n_val],
-                                                             static_cast<uint64_t>(UINT32_MAX) ));
+/* VKGL enum -> GLenum, which is then converted to the requested type as an int. */
+template<typename EnumType, GLenum (*PFN_GET_GL_ENUM_FOR_ENUM)(const EnumType&)>
+static void convert_from_vkgl_enum(const void*                       in_vals_ptr,
+                                   const uint32_t&                   in_n_vals,
+                                   const OpenGL::GetSetArgumentType& in_dst_type,
+                                   void*                             out_result_ptr)
+{
+    const GLenum enum_gl = PFN_GET_GL_ENUM_FOR_ENUM(*reinterpret_cast<const EnumType*>(in_vals_ptr) );
 
-                break;
-            }
+    vkgl_assert(in_n_vals == 1);
 
-            default:
-            {
-                vkgl_assert_fail();
-            }
-        }
-    }
+    convert_from<int32_t>(&enum_gl,
+                          1, /* in_n_vals */
+                          in_dst_type,
+                          out_result_ptr);
 }
 
 
@@ -441,173 +199,48 @@ void OpenGL::Converters::convert(const OpenGL::GetSetArgumentType& in_src_type,
 {
     switch (in_src_type)
     {
-        case OpenGL::GetSetArgumentType::BlendEquationVKGL:
-        {
-            const GLenum blend_equation_gl = OpenGL::Utils::get_gl_enum_for_blend_equation(*reinterpret_cast<const OpenGL::BlendEquation*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                          &blend_equation_gl,
-                           1, /* in_n_vals */
-                           in_dst_type,
-                           out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::BlendFunctionVKGL:
-        {
-            const GLenum blend_func_gl = OpenGL::Utils::get_gl_enum_for_blend_function(*reinterpret_cast<const OpenGL::BlendFunction*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                          &blend_func_gl,
-                           1, /* in_n_vals */
-                           in_dst_type,
-                           out_result_ptr);
-        }
-
         case OpenGL::GetSetArgumentType::Boolean:
         {
-            const uint32_t val = ((*reinterpret_cast<const bool*>(in_vals_ptr) ) == true);
-
-            static_assert(true      == GL_TRUE, "");
-            vkgl_assert  (in_n_vals == 1);
+            static_assert(true == GL_TRUE, "");
 
-            return convert(OpenGL::GetSetArgumentType::Int,
-                          &val,
-                           1, /* in_n_vals */
-                           in_dst_type,
-                           out_result_ptr);
+            return convert_from<bool>(in_vals_ptr,
+                                      in_n_vals,
+                                      in_dst_type,
+                                      out_result_ptr);
         }
 
         case OpenGL::GetSetArgumentType::BooleanFromInt32_Bit0:
         {
-            const uint32_t val = ((*reinterpret_cast<const int32_t*>(in_vals_ptr) ) & (1 << 0) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                          &val,
-                           1, /* in_n_vals */
-                           in_dst_type,
-                           out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::CullFaceVKGL:
-        {
-            const GLenum cull_face_gl = OpenGL::Utils::get_gl_enum_for_cull_mode(*reinterpret_cast<const OpenGL::CullMode*>(in_vals_ptr) );
+            const int32_t val = ((*reinterpret_cast<const int32_t*>(in_vals_ptr) ) & (1 << 0) );
 
             vkgl_assert(in_n_vals == 1);
 
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &cull_face_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
+            return convert_from<int32_t>(&val,
+                                         1, /* in_n_vals */
+                                         in_dst_type,
+                                         out_result_ptr);
         }
 
-        case OpenGL::GetSetArgumentType::DepthFunctionVKGL:
-        {
-            const GLenum depth_func_gl = OpenGL::Utils::get_gl_enum_for_depth_function(*reinterpret_cast<const OpenGL::DepthFunction*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &depth_func_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::Double:
-        {
-            return convert_from_f64(in_vals_ptr,
-                                    in_n_vals,
-                                    in_dst_type,
-                                    out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::Float:
-        {
-            return convert_from_f32(in_vals_ptr,
-                                    in_n_vals,
-                                    in_dst_type,
-                                    out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::HintModeVKGL:
-        {
-            const GLenum hint_mode_gl = OpenGL::Utils::get_gl_enum_for_hint_mode(*reinterpret_cast<const OpenGL::HintMode*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &hint_mode_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::Int:
-        {
-            return convert_from_i32(in_vals_ptr,
-                                    in_n_vals,
-                                    in_dst_type,
-                                    out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::LogicOpModeVKGL:
-        {
-            const GLenum logic_op_mode_gl = OpenGL::Utils::get_gl_enum_for_logic_op_mode(*reinterpret_cast<const OpenGL::LogicOpMode*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &logic_op_mode_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::ProvokingVertexConventionVKGL:
-        {
-            const GLenum convention_gl = OpenGL::Utils::get_gl_enum_for_provoking_vertex_convention(*reinterpret_cast<const OpenGL::ProvokingVertexConvention*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &convention_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::StencilFunctionVKGL:
-        {
-            const GLenum stencil_func_gl = OpenGL::Utils::get_gl_enum_for_stencil_function(*reinterpret_cast<const OpenGL::StencilFunction*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &stencil_func_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::StencilOperationVKGL:
-        {
-            const GLenum stencil_op_gl = OpenGL::Utils::get_gl_enum_for_stencil_operation(*reinterpret_cast<const OpenGL::StencilOperation*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &stencil_op_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
-        }
+        case OpenGL::GetSetArgumentType::Double:         return convert_from<double>  (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::Float:          return convert_from<float>   (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::Int:            return convert_from<int32_t> (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::Unsigned_Int:   return convert_from<uint32_t>(in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::Unsigned_Int64: return convert_from<uint64_t>(in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+
+        case OpenGL::GetSetArgumentType::BlendEquationVKGL:               return convert_from_vkgl_enum<OpenGL::BlendEquation,               OpenGL::Utils::get_gl_enum_for_blend_equation>               (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::BlendFunctionVKGL:               return convert_from_vkgl_enum<OpenGL::BlendFunction,               OpenGL::Utils::get_gl_enum_for_blend_function>               (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::CullFaceVKGL:                    return convert_from_vkgl_enum<OpenGL::CullMode,                    OpenGL::Utils::get_gl_enum_for_cull_mode>                    (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::DepthFunctionVKGL:               return convert_from_vkgl_enum<OpenGL::DepthFunction,               OpenGL::Utils::get_gl_enum_for_depth_function>               (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::HintModeVKGL:                    return convert_from_vkgl_enum<OpenGL::HintMode,                    OpenGL::Utils::get_gl_enum_for_hint_mode>                    (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::LogicOpModeVKGL:                 return convert_from_vkgl_enum<OpenGL::LogicOpMode,                 OpenGL::Utils::get_gl_enum_for_logic_op_mode>                (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::ProvokingVertexConventionVKGL:   return convert_from_vkgl_enum<OpenGL::ProvokingVertexConvention,   OpenGL::Utils::get_gl_enum_for_provoking_vertex_convention>  (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::StencilFunctionVKGL:             return convert_from_vkgl_enum<OpenGL::StencilFunction,             OpenGL::Utils::get_gl_enum_for_stencil_function>             (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::StencilOperationVKGL:            return convert_from_vkgl_enum<OpenGL::StencilOperation,            OpenGL::Utils::get_gl_enum_for_stencil_operation>            (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::TextureMagFilterVKGL:            return convert_from_vkgl_enum<OpenGL::TextureMagFilter,            OpenGL::Utils::get_gl_enum_for_texture_mag_filter>           (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::TextureMinFilterVKGL:            return convert_from_vkgl_enum<OpenGL::TextureMinFilter,            OpenGL::Utils::get_gl_enum_for_texture_min_filter>           (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::TextureSwizzleVKGL:              return convert_from_vkgl_enum<OpenGL::TextureSwizzle,              OpenGL::Utils::get_gl_enum_for_texture_swizzle>              (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::TextureWrapModeVKGL:             return convert_from_vkgl_enum<OpenGL::TextureWrapMode,             OpenGL::Utils::get_gl_enum_for_texture_wrap_mode>            (in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
+        case OpenGL::GetSetArgumentType::TransformFeedbackBufferModeVKGL: return convert_from_vkgl_enum<OpenGL::TransformFeedbackBufferMode, OpenGL::Utils::get_gl_enum_for_transform_feedback_buffer_mode>(in_vals_ptr, in_n_vals, in_dst_type, out_result_ptr);
 
         case OpenGL::GetSetArgumentType::String:
         {
@@ -619,87 +252,6 @@ void OpenGL::Converters::convert(const OpenGL::GetSetArgumentType& in_src_type,
             break;
         }
 
-        case OpenGL::GetSetArgumentType::Unsigned_Int:
-        {
-            return convert_from_u32(in_vals_ptr,
-                                    in_n_vals,
-                                    in_dst_type,
-                                    out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::Unsigned_Int64:
-        {
-            return convert_from_u64(in_vals_ptr,
-                                    in_n_vals,
-                                    in_dst_type,
-                                    out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::TextureMagFilterVKGL:
-        {
-            const GLenum texture_mag_filter_gl = OpenGL::Utils::get_gl_enum_for_texture_mag_filter(*reinterpret_cast<const OpenGL::TextureMagFilter*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &texture_mag_filter_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::TextureMinFilterVKGL:
-        {
-            const GLenum texture_min_filter_gl = OpenGL::Utils::get_gl_enum_for_texture_min_filter(*reinterpret_cast<const OpenGL::TextureMinFilter*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &texture_min_filter_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::TextureSwizzleVKGL:
-        {
-            const GLenum texture_swizzle_gl = OpenGL::Utils::get_gl_enum_for_texture_swizzle(*reinterpret_cast<const OpenGL::TextureSwizzle*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &texture_swizzle_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::TextureWrapModeVKGL:
-        {
-            const GLenum texture_wrap_mode_gl = OpenGL::Utils::get_gl_enum_for_texture_wrap_mode(*reinterpret_cast<const OpenGL::TextureWrapMode*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &texture_wrap_mode_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
-        }
-
-        case OpenGL::GetSetArgumentType::TransformFeedbackBufferModeVKGL:
-        {
-            const GLenum transform_feedback_buffer_mode_gl = OpenGL::Utils::get_gl_enum_for_transform_feedback_buffer_mode(*reinterpret_cast<const OpenGL::TransformFeedbackBufferMode*>(in_vals_ptr) );
-
-            vkgl_assert(in_n_vals == 1);
-
-            return convert(OpenGL::GetSetArgumentType::Int,
-                         &transform_feedback_buffer_mode_gl,
-                          1, /* in_n_vals */
-                          in_dst_type,
-                          out_result_ptr);
-        }
-
         default:
         {
             vkgl_assert_fail();
@@ -0,0 +1,845 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "OpenGL/entrypoints/gl_capture.h"
+#include "OpenGL/entrypoints/gl_entry_points_pack.h"
+#include "Common/logger.h"
+#include "Common/macros.h"
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unordered_map>
+
+#define DEFAULT_CAPTURE_FILE_NAME "vkgl_capture.bin"
+
+static const size_t g_n_flush_threshold_bytes = 1024 * 1024; //< Per thread.
+
+static bool is_enabled_in_environment()
+{
+    const char* env_value_ptr = getenv("VKGL_CAPTURE");
+
+    return (env_value_ptr != nullptr         &&
+            strcmp(env_value_ptr, "0") != 0);
+}
+
+std::atomic<bool> OpenGL::g_gl_capture_enabled(is_enabled_in_environment() );
+
+namespace
+{
+    typedef struct Capture
+    {
+        std::mutex mutex;
+
+        /* NOTE: Guarded by the mutex. */
+        FILE*    file_ptr;
+        bool     is_file_open_failed;
+        uint32_t n_entry_points;
+
+        Capture()
+            :file_ptr           (nullptr),
+             is_file_open_failed(false),
+             n_entry_points     (0)
+        {
+            /* Stub */
+        }
+    } Capture;
+
+    typedef struct MappedRange
+    {
+        GLsizeiptr length;
+        void*      mapped_ptr;
+
+        MappedRange()
+            :length    (0),
+             mapped_ptr(nullptr)
+        {
+            /* Stub */
+        }
+    } MappedRange;
+
+    void flush_thread_writer(OpenGL::GLCaptureWriter* in_writer_ptr);
+
+    typedef struct ThreadState
+    {
+        uint32_t                                 depth;
+        std::unordered_map<GLenum, MappedRange> mapped_ranges; //< Keyed by buffer targets.
+        GLuint                                   pack_buffer;
+        GLint                                    pack_alignment;
+        GLint                                    pack_row_length;
+        GLuint                                   unpack_buffer;
+        GLint                                    unpack_alignment;
+        GLint                                    unpack_image_height;
+        GLint                                    unpack_row_length;
+        OpenGL::GLCaptureWriter                  writer;
+
+        ThreadState()
+            :depth              (0),
+             pack_buffer        (0),
+             pack_alignment     (4),
+             pack_row_length    (0),
+             unpack_buffer      (0),
+             unpack_alignment   (4),
+             unpack_image_height(0),
+             unpack_row_length  (0)
+        {
+            /* Stub */
+        }
+
+        ~ThreadState()
+        {
+            flush_thread_writer(&writer);
+        }
+    } ThreadState;
+
+    /* NOTE: Intentionally leaked. Thread states are flushed from TLS destructors, which may run after static destructors
+     *       at process exit.
+     */
+    Capture* get_capture()
+    {
+        static Capture* capture_ptr = new Capture();
+
+        return capture_ptr;
+    }
+
+    ThreadState* get_thread_state()
+    {
+        static thread_local ThreadState thread_state;
+
+        return &thread_state;
+    }
+
+    /* NOTE: Capture mutex must be held. */
+    bool open_file(Capture* in_capture_ptr)
+    {
+        const char*                 file_name_ptr = getenv("VKGL_CAPTURE_FILE");
+        OpenGL::GLCaptureFileHeader header;
+
+        if (in_capture_ptr->file_ptr            != nullptr ||
+            in_capture_ptr->is_file_open_failed)
+        {
+            goto end;
+        }
+
+        if (file_name_ptr == nullptr)
+        {
+            file_name_ptr = DEFAULT_CAPTURE_FILE_NAME;
+        }
+
+        in_capture_ptr->file_ptr = fopen(file_name_ptr,
+                                         "wb");
+
+        if (in_capture_ptr->file_ptr == nullptr)
+        {
+            vkgl_printf("Could not open GL capture output file [%s]",
+                        file_name_ptr);
+
+            in_capture_ptr->is_file_open_failed = true;
+
+            /* Stop capturing. The rest of the stream would be useless anyway. */
+            OpenGL::g_gl_capture_enabled.store(false,
+                                               std::memory_order_relaxed);
+
+            goto end;
+        }
+
+        memcpy(header.magic,
+               OpenGL::g_gl_capture_file_magic,
+               sizeof(header.magic) );
+
+        header.reserved = 0;
+        header.version  = OpenGL::g_gl_capture_file_version;
+
+        fwrite(&header,
+               sizeof(header),
+               1, /* count */
+               in_capture_ptr->file_ptr);
+
+    end:
+        return (in_capture_ptr->file_ptr != nullptr);
+    }
+
+    /* NOTE: Capture mutex must be held. */
+    void write_chunk(Capture*                          in_capture_ptr,
+                     const OpenGL::GLCaptureChunkType& in_type,
+                     const void*                       in_payload_ptr,
+                     const uint32_t&                   in_n_payload_bytes)
+    {
+        static const uint8_t        padding[8] = {0};
+        OpenGL::GLCaptureChunkHeader header;
+
+        if (!open_file(in_capture_ptr) )
+        {
+            goto end;
+        }
+
+        header.n_bytes = in_n_payload_bytes;
+        header.type    = in_type;
+
+        fwrite(&header,
+               sizeof(header),
+               1, /* count */
+               in_capture_ptr->file_ptr);
+
+        if (in_n_payload_bytes > 0)
+        {
+            fwrite(in_payload_ptr,
+                   in_n_payload_bytes,
+                   1, /* count */
+                   in_capture_ptr->file_ptr);
+        }
+
+        if ((in_n_payload_bytes % 8) != 0)
+        {
+            fwrite(padding,
+                   8 - (in_n_payload_bytes % 8),
+                   1, /* count */
+                   in_capture_ptr->file_ptr);
+        }
+
+    end:
+        ;
+    }
+
+    void flush_thread_writer(OpenGL::GLCaptureWriter* in_writer_ptr)
+    {
+        auto                        capture_ptr = get_capture();
+        const auto&                 data        = in_writer_ptr->get_data();
+        std::lock_guard<std::mutex> lock       (capture_ptr->mutex);
+
+        if (data.size() > 0)
+        {
+            write_chunk(capture_ptr,
+                        OpenGL::GLCaptureChunkType::Calls,
+                        data.data(),
+                        static_cast<uint32_t>(data.size() ));
+
+            in_writer_ptr->reset();
+        }
+    }
+
+    uint32_t get_entry_point_id(OpenGL::GLCaptureEntryPoint* in_entry_point_ptr)
+    {
+        uint32_t result = in_entry_point_ptr->id.load(std::memory_order_acquire);
+
+        if (result == UINT32_MAX)
+        {
+            auto                        capture_ptr = get_capture();
+            std::lock_guard<std::mutex> lock       (capture_ptr->mutex);
+
+            result = in_entry_point_ptr->id.load(std::memory_order_relaxed);
+
+            if (result == UINT32_MAX)
+            {
+                std::vector<uint8_t> payload(sizeof(uint32_t) + strlen(in_entry_point_ptr->name) + 1);
+
+                result = capture_ptr->n_entry_points++;
+
+                memcpy(payload.data(),
+                      &result,
+                       sizeof(uint32_t) );
+                memcpy(payload.data() + sizeof(uint32_t),
+                       in_entry_point_ptr->name,
+                       payload.size() - sizeof(uint32_t) );
+
+                /* Written straight to the file, so that it precedes any buffered call which uses the ID. */
+                write_chunk(capture_ptr,
+                            OpenGL::GLCaptureChunkType::Entry_Point,
+                            payload.data(),
+                            static_cast<uint32_t>(payload.size() ));
+
+                in_entry_point_ptr->id.store(result,
+                                             std::memory_order_release);
+            }
+        }
+
+        return result;
+    }
+
+    uint32_t get_n_format_components(const GLenum& in_format)
+    {
+        uint32_t result = 4;
+
+        switch (in_format)
+        {
+            case GL_ALPHA:
+            case GL_BLUE:
+            case GL_BLUE_INTEGER:
+            case GL_DEPTH_COMPONENT:
+            case GL_GREEN:
+            case GL_GREEN_INTEGER:
+            case GL_LUMINANCE:
+            case GL_RED:
+            case GL_RED_INTEGER:
+            case GL_STENCIL_INDEX:
+            {
+                result = 1;
+
+                break;
+            }
+
+            case GL_DEPTH_STENCIL:
+            case GL_LUMINANCE_ALPHA:
+            case GL_RG:
+            case GL_RG_INTEGER:
+            {
+                result = 2;
+
+                break;
+            }
+
+            case GL_BGR:
+            case GL_BGR_INTEGER:
+            case GL_RGB:
+            case GL_RGB_INTEGER:
+            {
+                result = 3;
+
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    /* Returns the size of a pixel for packed types, or of a single component otherwise. */
+    uint32_t get_type_size(const GLenum& in_type,
+                           bool*         out_is_packed_ptr)
+    {
+        uint32_t result = 1;
+
+        *out_is_packed_ptr = true;
+
+        switch (in_type)
+        {
+            case GL_UNSIGNED_BYTE_2_3_3_REV:
+            case GL_UNSIGNED_BYTE_3_3_2:
+            {
+                result = 1;
+
+                break;
+            }
+
+            case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+            case GL_UNSIGNED_SHORT_4_4_4_4:
+            case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+            case GL_UNSIGNED_SHORT_5_5_5_1:
+            case GL_UNSIGNED_SHORT_5_6_5:
+            case GL_UNSIGNED_SHORT_5_6_5_REV:
+            {
+                result = 2;
+
+                break;
+            }
+
+            case GL_UNSIGNED_INT_10_10_10_2:
+            case GL_UNSIGNED_INT_10F_11F_11F_REV:
+            case GL_UNSIGNED_INT_24_8:
+            case GL_UNSIGNED_INT_2_10_10_10_REV:
+            case GL_UNSIGNED_INT_5_9_9_9_REV:
+            case GL_UNSIGNED_INT_8_8_8_8:
+            case GL_UNSIGNED_INT_8_8_8_8_REV:
+            {
+                result = 4;
+
+                break;
+            }
+
+            case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+            {
+                result = 8;
+
+                break;
+            }
+
+            default:
+            {
+                *out_is_packed_ptr = false;
+
+                switch (in_type)
+                {
+                    case GL_HALF_FLOAT:
+                    case GL_SHORT:
+                    case GL_UNSIGNED_SHORT:
+                    {
+                        result = 2;
+
+                        break;
+                    }
+
+                    case GL_FLOAT:
+                    case GL_INT:
+                    case GL_UNSIGNED_INT:
+                    {
+                        result = 4;
+
+                        break;
+                    }
+
+                    default:
+                    {
+                        result = 1;
+
+                        break;
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+}
+
+
+OpenGL::GLCaptureWriter::GLCaptureWriter()
+    :m_record_start_offset(0)
+{
+    m_data.reserve(g_n_flush_threshold_bytes);
+}
+
+void OpenGL::GLCaptureWriter::align(const uint32_t& in_alignment)
+{
+    while ((m_data.size() % in_alignment) != 0)
+    {
+        m_data.push_back(0);
+    }
+}
+
+void OpenGL::GLCaptureWriter::begin_record(const uint32_t& in_id)
+{
+    const uint32_t n_bytes_placeholder = 0;
+
+    m_record_start_offset = m_data.size();
+
+    write_value(in_id);
+    write_value(n_bytes_placeholder);
+}
+
+void OpenGL::GLCaptureWriter::end_record()
+{
+    const uint32_t n_bytes = static_cast<uint32_t>(m_data.size() - m_record_start_offset - 2 * sizeof(uint32_t) );
+
+    memcpy(m_data.data() + m_record_start_offset + sizeof(uint32_t),
+          &n_bytes,
+           sizeof(n_bytes) );
+}
+
+void OpenGL::GLCaptureWriter::reset()
+{
+    m_data.clear();
+
+    m_record_start_offset = 0;
+}
+
+void OpenGL::GLCaptureWriter::write(const void*   in_data_ptr,
+                                    const size_t& in_n_bytes)
+{
+    const auto data_u8_ptr = reinterpret_cast<const uint8_t*>(in_data_ptr);
+
+    m_data.insert(m_data.end(),
+                  data_u8_ptr,
+                  data_u8_ptr + in_n_bytes);
+}
+
+void OpenGL::GLCaptureWriter::write_blob(const void*   in_data_ptr,
+                                         const size_t& in_n_bytes)
+{
+    /* Sizes computed from negative counts wrap around. Those calls fail with GL_INVALID_VALUE anyway. */
+    if (in_data_ptr == nullptr    ||
+        in_n_bytes  == 0          ||
+        in_n_bytes  >  UINT32_MAX)
+    {
+        write_pointer_value(in_data_ptr);
+    }
+    else
+    {
+        write_value(GLCapturePointerKind::Blob);
+        write_value(static_cast<uint32_t>(in_n_bytes) );
+
+        /* Lets the replayer hand out pointers into the mapped capture file. */
+        align(8);
+
+        write(in_data_ptr,
+              in_n_bytes);
+    }
+}
+
+void OpenGL::GLCaptureWriter::write_pointer_value(const void* in_ptr)
+{
+    write_value(GLCapturePointerKind::Value);
+    write_value(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(in_ptr) ));
+}
+
+void OpenGL::GLCaptureWriter::write_string(const char*  in_string_ptr,
+                                           const GLint& in_length)
+{
+    const char terminator = 0;
+
+    if (in_string_ptr == nullptr)
+    {
+        write_pointer_value(in_string_ptr);
+    }
+    else
+    {
+        const size_t n_chars = (in_length >= 0) ? static_cast<size_t>(in_length)
+                                                : strlen(in_string_ptr);
+
+        /* Always NUL-terminated, so that the string works regardless of whether the replayed call is given lengths. */
+        write_value(GLCapturePointerKind::Blob);
+        write_value(static_cast<uint32_t>(n_chars + 1) );
+        align      (8);
+        write      (in_string_ptr,
+                    n_chars);
+        write_value(terminator);
+    }
+}
+
+OpenGL::GLCaptureWriter* OpenGL::GLCapture::begin_call(GLCaptureEntryPoint* in_entry_point_ptr)
+{
+    auto             thread_state_ptr = get_thread_state();
+    uint32_t         entry_point_id   = UINT32_MAX;
+    GLCaptureWriter* result_ptr       = nullptr;
+
+    /* Only calls made by the app are captured. */
+    if (++thread_state_ptr->depth != 1)
+    {
+        goto end;
+    }
+
+    entry_point_id = get_entry_point_id(in_entry_point_ptr);
+
+    if (!is_enabled() )
+    {
+        /* Output file could not be opened. */
+        goto end;
+    }
+
+    result_ptr = &thread_state_ptr->writer;
+
+    result_ptr->begin_record(entry_point_id);
+
+end:
+    return result_ptr;
+}
+
+void OpenGL::GLCapture::end_call(GLCaptureWriter* in_writer_ptr)
+{
+    auto thread_state_ptr = get_thread_state();
+
+    vkgl_assert(thread_state_ptr->depth > 0);
+
+    if (--thread_state_ptr->depth == 0           &&
+        in_writer_ptr                 != nullptr &&
+        in_writer_ptr->get_data().size() >= g_n_flush_threshold_bytes)
+    {
+        flush_thread_writer(in_writer_ptr);
+    }
+}
+
+size_t OpenGL::GLCapture::get_image_size(const bool&    in_unpack,
+                                         const GLsizei& in_width,
+                                         const GLsizei& in_height,
+                                         const GLsizei& in_depth,
+                                         const GLenum&  in_format,
+                                         const GLenum&  in_type)
+{
+    bool          is_packed_type   = false;
+    const auto    n_components     = get_n_format_components(in_format);
+    size_t        result           = 0;
+    auto          thread_state_ptr = get_thread_state();
+    const auto    type_size        = get_type_size(in_type,
+                                                  &is_packed_type);
+    const GLint   alignment        = (in_unpack) ? thread_state_ptr->unpack_alignment  : thread_state_ptr->pack_alignment;
+    const GLint   image_height     = (in_unpack && thread_state_ptr->unpack_image_height > 0) ? thread_state_ptr->unpack_image_height : in_height;
+    const GLint   row_length       = (in_unpack) ? thread_state_ptr->unpack_row_length : thread_state_ptr->pack_row_length;
+    const GLuint  bound_buffer     = (in_unpack) ? thread_state_ptr->unpack_buffer     : thread_state_ptr->pack_buffer;
+    const size_t  pixel_size       = (is_packed_type) ? type_size : type_size * n_components;
+    size_t        row_stride       = 0;
+
+    /* NOTE: SKIP_PIXELS, SKIP_ROWS and SKIP_IMAGES are not taken into account. */
+    if (bound_buffer != 0 ||
+        in_width     <= 0 ||
+        in_height    <= 0 ||
+        in_depth     <= 0)
+    {
+        goto end;
+    }
+
+    row_stride = pixel_size * ((row_length > 0) ? row_length : in_width);
+
+    if (alignment > 1)
+    {
+        row_stride = (row_stride + alignment - 1) / alignment * alignment;
+    }
+
+    result = row_stride * image_height * (in_depth  - 1) +
+             row_stride *                (in_height - 1) +
+             pixel_size * in_width;
+
+end:
+    return result;
+}
+
+size_t OpenGL::GLCapture::get_tex_image_size(const GLenum& in_target,
+                                             const GLint&  in_level,
+                                             const GLenum& in_format,
+                                             const GLenum& in_type,
+                                             const bool&   in_compressed)
+{
+    GLint depth  = 1;
+    GLint height = 1;
+    GLint result = 0;
+    GLint width  = 1;
+
+    /* NOTE: Not captured, as these are not exported entry points. */
+    if (in_compressed)
+    {
+        OpenGL::vkglGetTexLevelParameteriv(in_target,
+                                           in_level,
+                                           GL_TEXTURE_COMPRESSED_IMAGE_SIZE,
+                                          &result);
+
+        goto end;
+    }
+
+    OpenGL::vkglGetTexLevelParameteriv(in_target,
+                                       in_level,
+                                       GL_TEXTURE_WIDTH,
+                                      &width);
+    OpenGL::vkglGetTexLevelParameteriv(in_target,
+                                       in_level,
+                                       GL_TEXTURE_HEIGHT,
+                                      &height);
+    OpenGL::vkglGetTexLevelParameteriv(in_target,
+                                       in_level,
+                                       GL_TEXTURE_DEPTH,
+                                      &depth);
+
+    result = static_cast<GLint>(get_image_size(false, /* in_unpack */
+                                               width,
+                                               height,
+                                               depth,
+                                               in_format,
+                                               in_type) );
+
+end:
+    return static_cast<size_t>(result);
+}
+
+uint32_t OpenGL::GLCapture::get_n_pname_values(const GLenum& in_pname)
+{
+    uint32_t result = 1;
+
+    switch (in_pname)
+    {
+        case GL_AMBIENT:
+        case GL_AMBIENT_AND_DIFFUSE:
+        case GL_DIFFUSE:
+        case GL_EMISSION:
+        case GL_EYE_PLANE:
+        case GL_FOG_COLOR:
+        case GL_LIGHT_MODEL_AMBIENT:
+        case GL_OBJECT_PLANE:
+        case GL_PATCH_DEFAULT_OUTER_LEVEL:
+        case GL_POSITION:
+        case GL_SPECULAR:
+        case GL_TEXTURE_BORDER_COLOR:
+        case GL_TEXTURE_ENV_COLOR:
+        case GL_TEXTURE_SWIZZLE_RGBA:
+        {
+            result = 4;
+
+            break;
+        }
+
+        case GL_PATCH_DEFAULT_INNER_LEVEL:
+        {
+            result = 2;
+
+            break;
+        }
+
+        case GL_COLOR_INDEXES:
+        case GL_POINT_DISTANCE_ATTENUATION:
+        case GL_SPOT_DIRECTION:
+        {
+            result = 3;
+
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+void OpenGL::GLCapture::on_buffer_bound(const GLenum& in_target,
+                                        const GLuint& in_buffer)
+{
+    if (is_enabled() )
+    {
+        auto thread_state_ptr = get_thread_state();
+
+        if (in_target == GL_PIXEL_PACK_BUFFER)
+        {
+            thread_state_ptr->pack_buffer = in_buffer;
+        }
+        else
+        if (in_target == GL_PIXEL_UNPACK_BUFFER)
+        {
+            thread_state_ptr->unpack_buffer = in_buffer;
+        }
+    }
+}
+
+void* OpenGL::GLCapture::on_buffer_mapped(const GLenum&     in_target,
+                                          const GLsizeiptr& in_length,
+                                          const GLbitfield& in_access,
+                                          void*             in_mapped_ptr)
+{
+    if (is_enabled()                            &&
+        in_mapped_ptr                != nullptr &&
+        (in_access & GL_MAP_WRITE_BIT) != 0)
+    {
+        auto& mapped_range = get_thread_state()->mapped_ranges[in_target];
+
+        mapped_range.length     = in_length;
+        mapped_range.mapped_ptr = in_mapped_ptr;
+    }
+
+    return in_mapped_ptr;
+}
+
+void OpenGL::GLCapture::on_buffer_unmapping(const GLenum& in_target)
+{
+    auto thread_state_ptr = get_thread_state();
+
+    /* Called before the entry point's own capture scope is opened. */
+    if (is_enabled()                 &&
+        thread_state_ptr->depth == 0)
+    {
+        auto mapped_range_iterator = thread_state_ptr->mapped_ranges.find(in_target);
+
+        if (mapped_range_iterator != thread_state_ptr->mapped_ranges.end() )
+        {
+            auto& writer = thread_state_ptr->writer;
+
+            writer.begin_record(GL_CAPTURE_RECORD_ID_MAPPED_WRITE);
+            writer.write_value (in_target);
+            writer.write_blob  (mapped_range_iterator->second.mapped_ptr,
+                                static_cast<size_t>(mapped_range_iterator->second.length) );
+            writer.end_record  ();
+
+            thread_state_ptr->mapped_ranges.erase(mapped_range_iterator);
+        }
+    }
+}
+
+void OpenGL::GLCapture::on_frame_presented()
+{
+    auto capture_ptr = get_capture();
+
+    if (!is_enabled() )
+    {
+        goto end;
+    }
+
+    flush_thread_writer(&get_thread_state()->writer);
+
+    {
+        std::lock_guard<std::mutex> lock(capture_ptr->mutex);
+
+        write_chunk(capture_ptr,
+                    GLCaptureChunkType::Frame_End,
+                    nullptr,
+                    0); /* in_n_payload_bytes */
+
+        if (capture_ptr->file_ptr != nullptr)
+        {
+            fflush(capture_ptr->file_ptr);
+        }
+    }
+
+end:
+    ;
+}
+
+void OpenGL::GLCapture::on_pixel_store(const GLenum& in_pname,
+                                       const GLint&  in_param)
+{
+    if (is_enabled() )
+    {
+        auto thread_state_ptr = get_thread_state();
+
+        switch (in_pname)
+        {
+            case GL_PACK_ALIGNMENT:      thread_state_ptr->pack_alignment      = in_param; break;
+            case GL_PACK_ROW_LENGTH:     thread_state_ptr->pack_row_length     = in_param; break;
+            case GL_UNPACK_ALIGNMENT:    thread_state_ptr->unpack_alignment    = in_param; break;
+            case GL_UNPACK_IMAGE_HEIGHT: thread_state_ptr->unpack_image_height = in_param; break;
+            case GL_UNPACK_ROW_LENGTH:   thread_state_ptr->unpack_row_length   = in_param; break;
+
+            default:
+            {
+                break;
+            }
+        }
+    }
+}
+
+GLsync OpenGL::GLCapture::on_sync_created(GLsync in_sync)
+{
+    auto thread_state_ptr = get_thread_state();
+
+    /* Called from within the entry point's capture scope. */
+    if (is_enabled()                 &&
+        thread_state_ptr->depth == 1)
+    {
+        auto& writer = thread_state_ptr->writer;
+
+        writer.begin_record(GL_CAPTURE_RECORD_ID_SYNC_CREATED);
+        writer.write_value (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(in_sync) ));
+        writer.end_record  ();
+    }
+
+    return in_sync;
+}
+
+void OpenGL::write_gl_capture_arg(GLCaptureWriter&             in_writer,
+                                  const GLCapturePointerArray& in_array)
+{
+    if (in_array.items_ptr == nullptr)
+    {
+        in_writer.write_pointer_value(in_array.items_ptr);
+    }
+    else
+    {
+        in_writer.write_value(GLCapturePointerKind::Array);
+        in_writer.write_value(in_array.n_items);
+
+        for (uint32_t n_item = 0;
+                      n_item < in_array.n_items;
+                    ++n_item)
+        {
+            if (in_array.strings)
+            {
+                in_writer.write_string(reinterpret_cast<const char*>(in_array.items_ptr[n_item]),
+                                       (in_array.opt_lengths_ptr != nullptr) ? in_array.opt_lengths_ptr[n_item] : -1);
+            }
+            else
+            {
+                in_writer.write_pointer_value(in_array.items_ptr[n_item]);
+            }
+        }
+    }
+}
@@ -1,6 +1,7 @@
 // Compatibility OpenGL Over Core OpenGL
 
 #include "OpenGL/entrypoints/gl_entry_points_pack.h"
+#include "OpenGL/entrypoints/gl_capture.h"
 
 
 
@@ -37,6 +38,7 @@ inline void SET_GL_ERROR(OpenGL::IContextObjectManagers* in_context_ptr,
 
 void glClearIndex( GLfloat c ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(c);
 
     NOT_IMPLEMENTED
 
@@ -44,6 +46,7 @@ void glClearIndex( GLfloat c ){
 
 void glAlphaFunc( GLenum func, GLclampf ref ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(func, ref);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -61,6 +64,7 @@ void glAlphaFunc( GLenum func, GLclampf ref ){
 
 void glLineStipple( GLint factor, GLushort pattern ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(factor, pattern);
 
     NOT_IMPLEMENTED
 
@@ -68,6 +72,7 @@ void glLineStipple( GLint factor, GLushort pattern ){
 
 void glPolygonStipple( const GLubyte *mask ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(mask, 32 * 32 / 8));
 
     NOT_IMPLEMENTED
 
@@ -75,6 +80,7 @@ void glPolygonStipple( const GLubyte *mask ){
 
 void glGetPolygonStipple( GLubyte *mask ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureOutput(mask, 32 * 32 / 8));
 
     NOT_IMPLEMENTED
 
@@ -82,6 +88,7 @@ void glGetPolygonStipple( GLubyte *mask ){
 
 void glEdgeFlag( GLboolean flag ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(flag);
 
     NOT_IMPLEMENTED
 
@@ -89,6 +96,7 @@ void glEdgeFlag( GLboolean flag ){
 
 void glEdgeFlagv( const GLboolean *flag ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(flag, sizeof(*flag)));
 
     NOT_IMPLEMENTED
 
@@ -96,6 +104,7 @@ void glEdgeFlagv( const GLboolean *flag ){
 
 void glClipPlane( GLenum plane, const GLdouble *equation ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(plane, OpenGL::GLCaptureBlob(equation, 4 * sizeof(*equation)));
 
     NOT_IMPLEMENTED
 
@@ -103,6 +112,7 @@ void glClipPlane( GLenum plane, const GLdouble *equation ){
 
 void glGetClipPlane( GLenum plane, GLdouble *equation ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(plane, equation);
 
     NOT_IMPLEMENTED
 
@@ -112,6 +122,7 @@ void glGetClipPlane( GLenum plane, GLdouble *equation ){
 
 void glEnableClientState( GLenum cap ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(cap);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -171,6 +182,7 @@ void glEnableClientState( GLenum cap ){
 
 void glDisableClientState( GLenum cap ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(cap);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -232,6 +244,7 @@ void glDisableClientState( GLenum cap ){
 
 void glPushAttrib( GLbitfield mask ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mask);
 
     NOT_IMPLEMENTED
 
@@ -239,6 +252,7 @@ void glPushAttrib( GLbitfield mask ){
 
 void glPopAttrib( void ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     NOT_IMPLEMENTED
 
@@ -248,6 +262,7 @@ void glPopAttrib( void ){
 
 void glPushClientAttrib( GLbitfield mask ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mask);
 
     NOT_IMPLEMENTED
 
@@ -256,6 +271,7 @@ void glPushClientAttrib( GLbitfield mask ){
 
 void glPopClientAttrib( void ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     NOT_IMPLEMENTED
 
@@ -265,6 +281,7 @@ void glPopClientAttrib( void ){
 
 GLint glRenderMode( GLenum mode ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode);
 
     NOT_IMPLEMENTED
     return 0;
@@ -282,6 +299,7 @@ GLint glRenderMode( GLenum mode ){
 
 void glClearAccum( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     NOT_IMPLEMENTED
 
@@ -289,6 +307,7 @@ void glClearAccum( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha ){
 
 void glAccum( GLenum op, GLfloat value ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(op, value);
 
     NOT_IMPLEMENTED
 
@@ -302,6 +321,7 @@ void glAccum( GLenum op, GLfloat value ){
 
 void glMatrixMode( GLenum mode ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -352,6 +372,7 @@ void glMatrixMode( GLenum mode ){
 
 void glOrtho( GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble near_val, GLdouble far_val ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(left, right, bottom, top, near_val, far_val);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -370,6 +391,7 @@ void glOrtho( GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdo
 
 void glFrustum( GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble near_val, GLdouble far_val ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(left, right, bottom, top, near_val, far_val);
     //NOT_IMPLEMENTED
 
     GET_CONTEXT(in_context_p)
@@ -388,6 +410,7 @@ void glFrustum( GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GL
 
 void glPushMatrix( void ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     NOT_IMPLEMENTED
 
@@ -395,6 +418,7 @@ void glPushMatrix( void ){
 
 void glPopMatrix( void ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     NOT_IMPLEMENTED
 
@@ -402,6 +426,7 @@ void glPopMatrix( void ){
 
 void glLoadIdentity( void ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -418,6 +443,7 @@ void glLoadIdentity( void ){
 
 void glLoadMatrixd( const GLdouble *m ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(m, 16 * sizeof(*m)));
     //NOT_IMPLEMENTED
     
     GLfloat mf[16];
@@ -434,6 +460,7 @@ void glLoadMatrixd( const GLdouble *m ){
 
 void glLoadMatrixf( const GLfloat *m ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(m, 16 * sizeof(*m)));
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -453,6 +480,7 @@ void glLoadMatrixf( const GLfloat *m ){
 
 void glMultMatrixd( const GLdouble *m ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(m, 16 * sizeof(*m)));
     //NOT_IMPLEMENTED
     
     GLfloat mf[16];
@@ -469,6 +497,7 @@ void glMultMatrixd( const GLdouble *m ){
 
 void glMultMatrixf( const GLfloat *m ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(m, 16 * sizeof(*m)));
     //NOT_IMPLEMENTED
     
     glm::mat4 in_mat4 = glm::mat4(m[0], m[1], m[2], m[3],
@@ -490,6 +519,7 @@ void glMultMatrixf( const GLfloat *m ){
 
 void glRotated( GLdouble angle, GLdouble x, GLdouble y, GLdouble z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(angle, x, y, z);
     //NOT_IMPLEMENTED
     
     glRotatef((GLfloat)angle, (GLfloat)x, (GLfloat)y, (GLfloat)z);
@@ -498,6 +528,7 @@ void glRotated( GLdouble angle, GLdouble x, GLdouble y, GLdouble z ){
 
 void glRotatef( GLfloat angle, GLfloat x, GLfloat y, GLfloat z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(angle, x, y, z);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -516,6 +547,7 @@ void glRotatef( GLfloat angle, GLfloat x, GLfloat y, GLfloat z ){
 
 void glScaled( GLdouble x, GLdouble y, GLdouble z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
     //NOT_IMPLEMENTED
     
     glScalef((GLfloat)x, (GLfloat)y, (GLfloat)z);
@@ -524,6 +556,7 @@ void glScaled( GLdouble x, GLdouble y, GLdouble z ){
 
 void glScalef( GLfloat x, GLfloat y, GLfloat z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -542,6 +575,7 @@ void glScalef( GLfloat x, GLfloat y, GLfloat z ){
 
 void glTranslated( GLdouble x, GLdouble y, GLdouble z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
     //NOT_IMPLEMENTED
     
     glTranslatef((GLfloat)x, (GLfloat)y, (GLfloat)z);
@@ -550,6 +584,7 @@ void glTranslated( GLdouble x, GLdouble y, GLdouble z ){
 
 void glTranslatef( GLfloat x, GLfloat y, GLfloat z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -574,6 +609,7 @@ void glTranslatef( GLfloat x, GLfloat y, GLfloat z ){
 
 GLboolean glIsList( GLuint list ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(list);
 
     NOT_IMPLEMENTED
     return GL_FALSE;
@@ -581,6 +617,7 @@ GLboolean glIsList( GLuint list ){
 
 void glDeleteLists( GLuint list, GLsizei range ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(list, range);
 
     NOT_IMPLEMENTED
 
@@ -588,6 +625,7 @@ void glDeleteLists( GLuint list, GLsizei range ){
 
 GLuint glGenLists( GLsizei range ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(range);
 
     NOT_IMPLEMENTED
     return 0;
@@ -595,6 +633,7 @@ GLuint glGenLists( GLsizei range ){
 
 void glNewList( GLuint list, GLenum mode ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(list, mode);
 
     NOT_IMPLEMENTED
 
@@ -602,6 +641,7 @@ void glNewList( GLuint list, GLenum mode ){
 
 void glEndList( void ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     NOT_IMPLEMENTED
 
@@ -609,6 +649,7 @@ void glEndList( void ){
 
 void glCallList( GLuint list ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(list);
 
     NOT_IMPLEMENTED
 
@@ -616,6 +657,7 @@ void glCallList( GLuint list ){
 
 void glCallLists( GLsizei n, GLenum type, const GLvoid *lists ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, type, OpenGL::GLCaptureBlob(lists, n * ((type == GL_2_BYTES || type == GL_SHORT || type == GL_UNSIGNED_SHORT) ? 2 : (type == GL_3_BYTES) ? 3 : (type == GL_4_BYTES || type == GL_FLOAT || type == GL_INT || type == GL_UNSIGNED_INT) ? 4 : 1)));
 
     NOT_IMPLEMENTED
 
@@ -623,6 +665,7 @@ void glCallLists( GLsizei n, GLenum type, const GLvoid *lists ){
 
 void glListBase( GLuint base ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(base);
 
     NOT_IMPLEMENTED
 
@@ -636,6 +679,7 @@ void glListBase( GLuint base ){
 
 void glBegin( GLenum mode ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode);
 
     NOT_IMPLEMENTED
 
@@ -643,6 +687,7 @@ void glBegin( GLenum mode ){
 
 void glEnd( void ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     NOT_IMPLEMENTED
 
@@ -652,6 +697,7 @@ void glEnd( void ){
 
 void glVertex2d( GLdouble x, GLdouble y ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -659,6 +705,7 @@ void glVertex2d( GLdouble x, GLdouble y ){
 
 void glVertex2f( GLfloat x, GLfloat y ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -666,6 +713,7 @@ void glVertex2f( GLfloat x, GLfloat y ){
 
 void glVertex2i( GLint x, GLint y ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -673,6 +721,7 @@ void glVertex2i( GLint x, GLint y ){
 
 void glVertex2s( GLshort x, GLshort y ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -680,6 +729,7 @@ void glVertex2s( GLshort x, GLshort y ){
 
 void glVertex3d( GLdouble x, GLdouble y, GLdouble z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -687,6 +737,7 @@ void glVertex3d( GLdouble x, GLdouble y, GLdouble z ){
 
 void glVertex3f( GLfloat x, GLfloat y, GLfloat z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -694,6 +745,7 @@ void glVertex3f( GLfloat x, GLfloat y, GLfloat z ){
 
 void glVertex3i( GLint x, GLint y, GLint z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -701,6 +753,7 @@ void glVertex3i( GLint x, GLint y, GLint z ){
 
 void glVertex3s( GLshort x, GLshort y, GLshort z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -708,6 +761,7 @@ void glVertex3s( GLshort x, GLshort y, GLshort z ){
 
 void glVertex4d( GLdouble x, GLdouble y, GLdouble z, GLdouble w ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z, w);
 
     NOT_IMPLEMENTED
 
@@ -715,6 +769,7 @@ void glVertex4d( GLdouble x, GLdouble y, GLdouble z, GLdouble w ){
 
 void glVertex4f( GLfloat x, GLfloat y, GLfloat z, GLfloat w ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z, w);
 
     NOT_IMPLEMENTED
 
@@ -722,6 +777,7 @@ void glVertex4f( GLfloat x, GLfloat y, GLfloat z, GLfloat w ){
 
 void glVertex4i( GLint x, GLint y, GLint z, GLint w ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z, w);
 
     NOT_IMPLEMENTED
 
@@ -729,6 +785,7 @@ void glVertex4i( GLint x, GLint y, GLint z, GLint w ){
 
 void glVertex4s( GLshort x, GLshort y, GLshort z, GLshort w ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z, w);
 
     NOT_IMPLEMENTED
 
@@ -736,6 +793,7 @@ void glVertex4s( GLshort x, GLshort y, GLshort z, GLshort w ){
 
 void glVertex2dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -743,6 +801,7 @@ void glVertex2dv( const GLdouble *v ){
 
 void glVertex2fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -750,6 +809,7 @@ void glVertex2fv( const GLfloat *v ){
 
 void glVertex2iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -757,6 +817,7 @@ void glVertex2iv( const GLint *v ){
 
 void glVertex2sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -764,6 +825,7 @@ void glVertex2sv( const GLshort *v ){
 
 void glVertex3dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -771,6 +833,7 @@ void glVertex3dv( const GLdouble *v ){
 
 void glVertex3fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -778,6 +841,7 @@ void glVertex3fv( const GLfloat *v ){
 
 void glVertex3iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -785,6 +849,7 @@ void glVertex3iv( const GLint *v ){
 
 void glVertex3sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -792,6 +857,7 @@ void glVertex3sv( const GLshort *v ){
 
 void glVertex4dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -799,6 +865,7 @@ void glVertex4dv( const GLdouble *v ){
 
 void glVertex4fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -806,6 +873,7 @@ void glVertex4fv( const GLfloat *v ){
 
 void glVertex4iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -813,6 +881,7 @@ void glVertex4iv( const GLint *v ){
 
 void glVertex4sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -822,6 +891,7 @@ void glVertex4sv( const GLshort *v ){
 
 void glNormal3b( GLbyte nx, GLbyte ny, GLbyte nz ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(nx, ny, nz);
 
     NOT_IMPLEMENTED
 
@@ -829,6 +899,7 @@ void glNormal3b( GLbyte nx, GLbyte ny, GLbyte nz ){
 
 void glNormal3d( GLdouble nx, GLdouble ny, GLdouble nz ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(nx, ny, nz);
 
     NOT_IMPLEMENTED
 
@@ -836,6 +907,7 @@ void glNormal3d( GLdouble nx, GLdouble ny, GLdouble nz ){
 
 void glNormal3f( GLfloat nx, GLfloat ny, GLfloat nz ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(nx, ny, nz);
 
     NOT_IMPLEMENTED
 
@@ -843,6 +915,7 @@ void glNormal3f( GLfloat nx, GLfloat ny, GLfloat nz ){
 
 void glNormal3i( GLint nx, GLint ny, GLint nz ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(nx, ny, nz);
 
     NOT_IMPLEMENTED
 
@@ -850,6 +923,7 @@ void glNormal3i( GLint nx, GLint ny, GLint nz ){
 
 void glNormal3s( GLshort nx, GLshort ny, GLshort nz ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(nx, ny, nz);
 
     NOT_IMPLEMENTED
 
@@ -857,6 +931,7 @@ void glNormal3s( GLshort nx, GLshort ny, GLshort nz ){
 
 void glNormal3bv( const GLbyte *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -864,6 +939,7 @@ void glNormal3bv( const GLbyte *v ){
 
 void glNormal3dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -871,6 +947,7 @@ void glNormal3dv( const GLdouble *v ){
 
 void glNormal3fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -878,6 +955,7 @@ void glNormal3fv( const GLfloat *v ){
 
 void glNormal3iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -885,6 +963,7 @@ void glNormal3iv( const GLint *v ){
 
 void glNormal3sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -894,6 +973,7 @@ void glNormal3sv( const GLshort *v ){
 
 void glIndexd( GLdouble c ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(c);
 
     NOT_IMPLEMENTED
 
@@ -901,6 +981,7 @@ void glIndexd( GLdouble c ){
 
 void glIndexf( GLfloat c ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(c);
 
     NOT_IMPLEMENTED
 
@@ -908,6 +989,7 @@ void glIndexf( GLfloat c ){
 
 void glIndexi( GLint c ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(c);
 
     NOT_IMPLEMENTED
 
@@ -915,6 +997,7 @@ void glIndexi( GLint c ){
 
 void glIndexs( GLshort c ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(c);
 
     NOT_IMPLEMENTED
 
@@ -922,6 +1005,7 @@ void glIndexs( GLshort c ){
 
 void glIndexub( GLubyte c ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(c);
 
     NOT_IMPLEMENTED
 
@@ -930,6 +1014,7 @@ void glIndexub( GLubyte c ){
 
 void glIndexdv( const GLdouble *c ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(c, 1 * sizeof(*c)));
 
     NOT_IMPLEMENTED
 
@@ -937,6 +1022,7 @@ void glIndexdv( const GLdouble *c ){
 
 void glIndexfv( const GLfloat *c ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(c, 1 * sizeof(*c)));
 
     NOT_IMPLEMENTED
 
@@ -944,6 +1030,7 @@ void glIndexfv( const GLfloat *c ){
 
 void glIndexiv( const GLint *c ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(c, 1 * sizeof(*c)));
 
     NOT_IMPLEMENTED
 
@@ -951,6 +1038,7 @@ void glIndexiv( const GLint *c ){
 
 void glIndexsv( const GLshort *c ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(c, 1 * sizeof(*c)));
 
     NOT_IMPLEMENTED
 
@@ -958,6 +1046,7 @@ void glIndexsv( const GLshort *c ){
 
 void glIndexubv( const GLubyte *c ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(c, 1 * sizeof(*c)));
 
     NOT_IMPLEMENTED
 
@@ -966,6 +1055,7 @@ void glIndexubv( const GLubyte *c ){
 
 void glColor3b( GLbyte red, GLbyte green, GLbyte blue ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -973,6 +1063,7 @@ void glColor3b( GLbyte red, GLbyte green, GLbyte blue ){
 
 void glColor3d( GLdouble red, GLdouble green, GLdouble blue ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -980,6 +1071,7 @@ void glColor3d( GLdouble red, GLdouble green, GLdouble blue ){
 
 void glColor3f( GLfloat red, GLfloat green, GLfloat blue ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -987,6 +1079,7 @@ void glColor3f( GLfloat red, GLfloat green, GLfloat blue ){
 
 void glColor3i( GLint red, GLint green, GLint blue ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -994,6 +1087,7 @@ void glColor3i( GLint red, GLint green, GLint blue ){
 
 void glColor3s( GLshort red, GLshort green, GLshort blue ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -1001,6 +1095,7 @@ void glColor3s( GLshort red, GLshort green, GLshort blue ){
 
 void glColor3ub( GLubyte red, GLubyte green, GLubyte blue ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -1008,6 +1103,7 @@ void glColor3ub( GLubyte red, GLubyte green, GLubyte blue ){
 
 void glColor3ui( GLuint red, GLuint green, GLuint blue ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -1015,6 +1111,7 @@ void glColor3ui( GLuint red, GLuint green, GLuint blue ){
 
 void glColor3us( GLushort red, GLushort green, GLushort blue ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -1022,6 +1119,7 @@ void glColor3us( GLushort red, GLushort green, GLushort blue ){
 
 void glColor4b( GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     NOT_IMPLEMENTED
 
@@ -1029,6 +1127,7 @@ void glColor4b( GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha ){
 
 void glColor4d( GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     NOT_IMPLEMENTED
 
@@ -1036,6 +1135,7 @@ void glColor4d( GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha ){
 
 void glColor4f( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     NOT_IMPLEMENTED
 
@@ -1043,6 +1143,7 @@ void glColor4f( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha ){
 
 void glColor4i( GLint red, GLint green, GLint blue, GLint alpha ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     NOT_IMPLEMENTED
 
@@ -1050,6 +1151,7 @@ void glColor4i( GLint red, GLint green, GLint blue, GLint alpha ){
 
 void glColor4s( GLshort red, GLshort green, GLshort blue, GLshort alpha ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     NOT_IMPLEMENTED
 
@@ -1057,6 +1159,7 @@ void glColor4s( GLshort red, GLshort green, GLshort blue, GLshort alpha ){
 
 void glColor4ub( GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     NOT_IMPLEMENTED
 
@@ -1064,6 +1167,7 @@ void glColor4ub( GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha ){
 
 void glColor4ui( GLuint red, GLuint green, GLuint blue, GLuint alpha ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     NOT_IMPLEMENTED
 
@@ -1071,6 +1175,7 @@ void glColor4ui( GLuint red, GLuint green, GLuint blue, GLuint alpha ){
 
 void glColor4us( GLushort red, GLushort green, GLushort blue, GLushort alpha ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     NOT_IMPLEMENTED
 
@@ -1080,6 +1185,7 @@ void glColor4us( GLushort red, GLushort green, GLushort blue, GLushort alpha ){
 
 void glColor3bv( const GLbyte *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1087,6 +1193,7 @@ void glColor3bv( const GLbyte *v ){
 
 void glColor3dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1094,6 +1201,7 @@ void glColor3dv( const GLdouble *v ){
 
 void glColor3fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1101,6 +1209,7 @@ void glColor3fv( const GLfloat *v ){
 
 void glColor3iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1108,6 +1217,7 @@ void glColor3iv( const GLint *v ){
 
 void glColor3sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1115,6 +1225,7 @@ void glColor3sv( const GLshort *v ){
 
 void glColor3ubv( const GLubyte *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1122,6 +1233,7 @@ void glColor3ubv( const GLubyte *v ){
 
 void glColor3uiv( const GLuint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1129,6 +1241,7 @@ void glColor3uiv( const GLuint *v ){
 
 void glColor3usv( const GLushort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1136,6 +1249,7 @@ void glColor3usv( const GLushort *v ){
 
 void glColor4bv( const GLbyte *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1143,6 +1257,7 @@ void glColor4bv( const GLbyte *v ){
 
 void glColor4dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1150,6 +1265,7 @@ void glColor4dv( const GLdouble *v ){
 
 void glColor4fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1157,6 +1273,7 @@ void glColor4fv( const GLfloat *v ){
 
 void glColor4iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1164,6 +1281,7 @@ void glColor4iv( const GLint *v ){
 
 void glColor4sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1171,6 +1289,7 @@ void glColor4sv( const GLshort *v ){
 
 void glColor4ubv( const GLubyte *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1178,6 +1297,7 @@ void glColor4ubv( const GLubyte *v ){
 
 void glColor4uiv( const GLuint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1185,6 +1305,7 @@ void glColor4uiv( const GLuint *v ){
 
 void glColor4usv( const GLushort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1194,6 +1315,7 @@ void glColor4usv( const GLushort *v ){
 
 void glTexCoord1d( GLdouble s ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s);
 
     NOT_IMPLEMENTED
 
@@ -1201,6 +1323,7 @@ void glTexCoord1d( GLdouble s ){
 
 void glTexCoord1f( GLfloat s ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s);
 
     NOT_IMPLEMENTED
 
@@ -1208,6 +1331,7 @@ void glTexCoord1f( GLfloat s ){
 
 void glTexCoord1i( GLint s ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s);
 
     NOT_IMPLEMENTED
 
@@ -1215,6 +1339,7 @@ void glTexCoord1i( GLint s ){
 
 void glTexCoord1s( GLshort s ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s);
 
     NOT_IMPLEMENTED
 
@@ -1222,6 +1347,7 @@ void glTexCoord1s( GLshort s ){
 
 void glTexCoord2d( GLdouble s, GLdouble t ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t);
 
     NOT_IMPLEMENTED
 
@@ -1229,6 +1355,7 @@ void glTexCoord2d( GLdouble s, GLdouble t ){
 
 void glTexCoord2f( GLfloat s, GLfloat t ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t);
 
     NOT_IMPLEMENTED
 
@@ -1236,6 +1363,7 @@ void glTexCoord2f( GLfloat s, GLfloat t ){
 
 void glTexCoord2i( GLint s, GLint t ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t);
 
     NOT_IMPLEMENTED
 
@@ -1243,6 +1371,7 @@ void glTexCoord2i( GLint s, GLint t ){
 
 void glTexCoord2s( GLshort s, GLshort t ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t);
 
     NOT_IMPLEMENTED
 
@@ -1250,6 +1379,7 @@ void glTexCoord2s( GLshort s, GLshort t ){
 
 void glTexCoord3d( GLdouble s, GLdouble t, GLdouble r ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t, r);
 
     NOT_IMPLEMENTED
 
@@ -1257,6 +1387,7 @@ void glTexCoord3d( GLdouble s, GLdouble t, GLdouble r ){
 
 void glTexCoord3f( GLfloat s, GLfloat t, GLfloat r ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t, r);
 
     NOT_IMPLEMENTED
 
@@ -1264,6 +1395,7 @@ void glTexCoord3f( GLfloat s, GLfloat t, GLfloat r ){
 
 void glTexCoord3i( GLint s, GLint t, GLint r ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t, r);
 
     NOT_IMPLEMENTED
 
@@ -1271,6 +1403,7 @@ void glTexCoord3i( GLint s, GLint t, GLint r ){
 
 void glTexCoord3s( GLshort s, GLshort t, GLshort r ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t, r);
 
     NOT_IMPLEMENTED
 
@@ -1278,6 +1411,7 @@ void glTexCoord3s( GLshort s, GLshort t, GLshort r ){
 
 void glTexCoord4d( GLdouble s, GLdouble t, GLdouble r, GLdouble q ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t, r, q);
 
     NOT_IMPLEMENTED
 
@@ -1285,6 +1419,7 @@ void glTexCoord4d( GLdouble s, GLdouble t, GLdouble r, GLdouble q ){
 
 void glTexCoord4f( GLfloat s, GLfloat t, GLfloat r, GLfloat q ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t, r, q);
 
     NOT_IMPLEMENTED
 
@@ -1292,6 +1427,7 @@ void glTexCoord4f( GLfloat s, GLfloat t, GLfloat r, GLfloat q ){
 
 void glTexCoord4i( GLint s, GLint t, GLint r, GLint q ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t, r, q);
 
     NOT_IMPLEMENTED
 
@@ -1299,6 +1435,7 @@ void glTexCoord4i( GLint s, GLint t, GLint r, GLint q ){
 
 void glTexCoord4s( GLshort s, GLshort t, GLshort r, GLshort q ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s, t, r, q);
 
     NOT_IMPLEMENTED
 
@@ -1306,6 +1443,7 @@ void glTexCoord4s( GLshort s, GLshort t, GLshort r, GLshort q ){
 
 void glTexCoord1dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1313,6 +1451,7 @@ void glTexCoord1dv( const GLdouble *v ){
 
 void glTexCoord1fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1320,6 +1459,7 @@ void glTexCoord1fv( const GLfloat *v ){
 
 void glTexCoord1iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1327,6 +1467,7 @@ void glTexCoord1iv( const GLint *v ){
 
 void glTexCoord1sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1334,6 +1475,7 @@ void glTexCoord1sv( const GLshort *v ){
 
 void glTexCoord2dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1341,6 +1483,7 @@ void glTexCoord2dv( const GLdouble *v ){
 
 void glTexCoord2fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1348,6 +1491,7 @@ void glTexCoord2fv( const GLfloat *v ){
 
 void glTexCoord2iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1355,6 +1499,7 @@ void glTexCoord2iv( const GLint *v ){
 
 void glTexCoord2sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1362,6 +1507,7 @@ void glTexCoord2sv( const GLshort *v ){
 
 void glTexCoord3dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1369,6 +1515,7 @@ void glTexCoord3dv( const GLdouble *v ){
 
 void glTexCoord3fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1376,6 +1523,7 @@ void glTexCoord3fv( const GLfloat *v ){
 
 void glTexCoord3iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1383,6 +1531,7 @@ void glTexCoord3iv( const GLint *v ){
 
 void glTexCoord3sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1390,6 +1539,7 @@ void glTexCoord3sv( const GLshort *v ){
 
 void glTexCoord4dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1397,6 +1547,7 @@ void glTexCoord4dv( const GLdouble *v ){
 
 void glTexCoord4fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1404,6 +1555,7 @@ void glTexCoord4fv( const GLfloat *v ){
 
 void glTexCoord4iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1411,6 +1563,7 @@ void glTexCoord4iv( const GLint *v ){
 
 void glTexCoord4sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1420,6 +1573,7 @@ void glTexCoord4sv( const GLshort *v ){
 
 void glRasterPos2d( GLdouble x, GLdouble y ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -1427,6 +1581,7 @@ void glRasterPos2d( GLdouble x, GLdouble y ){
 
 void glRasterPos2f( GLfloat x, GLfloat y ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -1434,6 +1589,7 @@ void glRasterPos2f( GLfloat x, GLfloat y ){
 
 void glRasterPos2i( GLint x, GLint y ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -1441,6 +1597,7 @@ void glRasterPos2i( GLint x, GLint y ){
 
 void glRasterPos2s( GLshort x, GLshort y ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -1448,6 +1605,7 @@ void glRasterPos2s( GLshort x, GLshort y ){
 
 void glRasterPos3d( GLdouble x, GLdouble y, GLdouble z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -1455,6 +1613,7 @@ void glRasterPos3d( GLdouble x, GLdouble y, GLdouble z ){
 
 void glRasterPos3f( GLfloat x, GLfloat y, GLfloat z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -1462,6 +1621,7 @@ void glRasterPos3f( GLfloat x, GLfloat y, GLfloat z ){
 
 void glRasterPos3i( GLint x, GLint y, GLint z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -1469,6 +1629,7 @@ void glRasterPos3i( GLint x, GLint y, GLint z ){
 
 void glRasterPos3s( GLshort x, GLshort y, GLshort z ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -1476,6 +1637,7 @@ void glRasterPos3s( GLshort x, GLshort y, GLshort z ){
 
 void glRasterPos4d( GLdouble x, GLdouble y, GLdouble z, GLdouble w ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z, w);
 
     NOT_IMPLEMENTED
 
@@ -1483,6 +1645,7 @@ void glRasterPos4d( GLdouble x, GLdouble y, GLdouble z, GLdouble w ){
 
 void glRasterPos4f( GLfloat x, GLfloat y, GLfloat z, GLfloat w ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z, w);
 
     NOT_IMPLEMENTED
 
@@ -1490,6 +1653,7 @@ void glRasterPos4f( GLfloat x, GLfloat y, GLfloat z, GLfloat w ){
 
 void glRasterPos4i( GLint x, GLint y, GLint z, GLint w ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z, w);
 
     NOT_IMPLEMENTED
 
@@ -1497,6 +1661,7 @@ void glRasterPos4i( GLint x, GLint y, GLint z, GLint w ){
 
 void glRasterPos4s( GLshort x, GLshort y, GLshort z, GLshort w ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z, w);
 
     NOT_IMPLEMENTED
 
@@ -1504,6 +1669,7 @@ void glRasterPos4s( GLshort x, GLshort y, GLshort z, GLshort w ){
 
 void glRasterPos2dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1511,6 +1677,7 @@ void glRasterPos2dv( const GLdouble *v ){
 
 void glRasterPos2fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1518,6 +1685,7 @@ void glRasterPos2fv( const GLfloat *v ){
 
 void glRasterPos2iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1525,6 +1693,7 @@ void glRasterPos2iv( const GLint *v ){
 
 void glRasterPos2sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1532,6 +1701,7 @@ void glRasterPos2sv( const GLshort *v ){
 
 void glRasterPos3dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1539,6 +1709,7 @@ void glRasterPos3dv( const GLdouble *v ){
 
 void glRasterPos3fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1546,6 +1717,7 @@ void glRasterPos3fv( const GLfloat *v ){
 
 void glRasterPos3iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1553,6 +1725,7 @@ void glRasterPos3iv( const GLint *v ){
 
 void glRasterPos3sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1560,6 +1733,7 @@ void glRasterPos3sv( const GLshort *v ){
 
 void glRasterPos4dv( const GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1567,6 +1741,7 @@ void glRasterPos4dv( const GLdouble *v ){
 
 void glRasterPos4fv( const GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1574,6 +1749,7 @@ void glRasterPos4fv( const GLfloat *v ){
 
 void glRasterPos4iv( const GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1581,6 +1757,7 @@ void glRasterPos4iv( const GLint *v ){
 
 void glRasterPos4sv( const GLshort *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -1590,6 +1767,7 @@ void glRasterPos4sv( const GLshort *v ){
 
 void glRectd( GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x1, y1, x2, y2);
 
     NOT_IMPLEMENTED
 
@@ -1597,6 +1775,7 @@ void glRectd( GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2 ){
 
 void glRectf( GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x1, y1, x2, y2);
 
     NOT_IMPLEMENTED
 
@@ -1604,6 +1783,7 @@ void glRectf( GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2 ){
 
 void glRecti( GLint x1, GLint y1, GLint x2, GLint y2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x1, y1, x2, y2);
 
     NOT_IMPLEMENTED
 
@@ -1611,6 +1791,7 @@ void glRecti( GLint x1, GLint y1, GLint x2, GLint y2 ){
 
 void glRects( GLshort x1, GLshort y1, GLshort x2, GLshort y2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x1, y1, x2, y2);
 
     NOT_IMPLEMENTED
 
@@ -1620,6 +1801,7 @@ void glRects( GLshort x1, GLshort y1, GLshort x2, GLshort y2 ){
 
 void glRectdv( const GLdouble *v1, const GLdouble *v2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v1, 2 * sizeof(*v1)), OpenGL::GLCaptureBlob(v2, 2 * sizeof(*v2)));
 
     NOT_IMPLEMENTED
 
@@ -1627,6 +1809,7 @@ void glRectdv( const GLdouble *v1, const GLdouble *v2 ){
 
 void glRectfv( const GLfloat *v1, const GLfloat *v2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v1, 2 * sizeof(*v1)), OpenGL::GLCaptureBlob(v2, 2 * sizeof(*v2)));
 
     NOT_IMPLEMENTED
 
@@ -1634,6 +1817,7 @@ void glRectfv( const GLfloat *v1, const GLfloat *v2 ){
 
 void glRectiv( const GLint *v1, const GLint *v2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v1, 2 * sizeof(*v1)), OpenGL::GLCaptureBlob(v2, 2 * sizeof(*v2)));
 
     NOT_IMPLEMENTED
 
@@ -1641,6 +1825,7 @@ void glRectiv( const GLint *v1, const GLint *v2 ){
 
 void glRectsv( const GLshort *v1, const GLshort *v2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v1, 2 * sizeof(*v1)), OpenGL::GLCaptureBlob(v2, 2 * sizeof(*v2)));
 
     NOT_IMPLEMENTED
 
@@ -1654,6 +1839,7 @@ void glRectsv( const GLshort *v1, const GLshort *v2 ){
 
 void glVertexPointer( GLint size, GLenum type, GLsizei stride, const GLvoid *ptr ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(size, type, stride, ptr);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -1677,6 +1863,7 @@ void glVertexPointer( GLint size, GLenum type, GLsizei stride, const GLvoid *ptr
 
 void glNormalPointer( GLenum type, GLsizei stride, const GLvoid *ptr ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(type, stride, ptr);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -1700,6 +1887,7 @@ void glNormalPointer( GLenum type, GLsizei stride, const GLvoid *ptr ){
 
 void glColorPointer( GLint size, GLenum type, GLsizei stride, const GLvoid *ptr ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(size, type, stride, ptr);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -1723,6 +1911,7 @@ void glColorPointer( GLint size, GLenum type, GLsizei stride, const GLvoid *ptr
 
 void glIndexPointer( GLenum type, GLsizei stride, const GLvoid *ptr ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(type, stride, ptr);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -1746,6 +1935,7 @@ void glIndexPointer( GLenum type, GLsizei stride, const GLvoid *ptr ){
 
 void glTexCoordPointer( GLint size, GLenum type, GLsizei stride, const GLvoid *ptr ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(size, type, stride, ptr);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -1769,6 +1959,7 @@ void glTexCoordPointer( GLint size, GLenum type, GLsizei stride, const GLvoid *p
 
 void glEdgeFlagPointer( GLsizei stride, const GLvoid *ptr ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(stride, ptr);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -1792,6 +1983,7 @@ void glEdgeFlagPointer( GLsizei stride, const GLvoid *ptr ){
 
 void glArrayElement( GLint i ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(i);
 
     NOT_IMPLEMENTED
 
@@ -1799,6 +1991,7 @@ void glArrayElement( GLint i ){
 
 void glInterleavedArrays( GLenum format, GLsizei stride, const GLvoid *pointer ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(format, stride, pointer);
 
     NOT_IMPLEMENTED
 
@@ -1811,6 +2004,7 @@ void glInterleavedArrays( GLenum format, GLsizei stride, const GLvoid *pointer )
 
 void glShadeModel( GLenum mode ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode);
 
     NOT_IMPLEMENTED
 
@@ -1818,6 +2012,7 @@ void glShadeModel( GLenum mode ){
 
 void glLightf( GLenum light, GLenum pname, GLfloat param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(light, pname, param);
     //NOT_IMPLEMENTED
     
     glLightfv(light, pname, &param);
@@ -1826,6 +2021,7 @@ void glLightf( GLenum light, GLenum pname, GLfloat param ){
 
 void glLighti( GLenum light, GLenum pname, GLint param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(light, pname, param);
     //NOT_IMPLEMENTED
     
     glLightiv(light, pname, &param);
@@ -1834,6 +2030,7 @@ void glLighti( GLenum light, GLenum pname, GLint param ){
 
 void glLightfv( GLenum light, GLenum pname, const GLfloat *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(light, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -1918,6 +2115,7 @@ void glLightfv( GLenum light, GLenum pname, const GLfloat *params ){
 
 void glLightiv( GLenum light, GLenum pname, const GLint *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(light, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -2002,6 +2200,7 @@ void glLightiv( GLenum light, GLenum pname, const GLint *params ){
 
 void glGetLightfv( GLenum light, GLenum pname, GLfloat *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(light, pname, params);
 
     NOT_IMPLEMENTED
 
@@ -2009,6 +2208,7 @@ void glGetLightfv( GLenum light, GLenum pname, GLfloat *params ){
 
 void glGetLightiv( GLenum light, GLenum pname, GLint *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(light, pname, params);
 
     NOT_IMPLEMENTED
 
@@ -2016,6 +2216,7 @@ void glGetLightiv( GLenum light, GLenum pname, GLint *params ){
 
 void glLightModelf( GLenum pname, GLfloat param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, param);
     //NOT_IMPLEMENTED
     
     glLightModelfv(pname, &param);
@@ -2024,6 +2225,7 @@ void glLightModelf( GLenum pname, GLfloat param ){
 
 void glLightModeli( GLenum pname, GLint param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, param);
     //NOT_IMPLEMENTED
     
     glLightModeliv(pname, &param);
@@ -2032,6 +2234,7 @@ void glLightModeli( GLenum pname, GLint param ){
 
 void glLightModelfv( GLenum pname, const GLfloat *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -2078,6 +2281,7 @@ void glLightModelfv( GLenum pname, const GLfloat *params ){
 
 void glLightModeliv( GLenum pname, const GLint *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -2124,6 +2328,7 @@ void glLightModeliv( GLenum pname, const GLint *params ){
 
 void glMaterialf( GLenum face, GLenum pname, GLfloat param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(face, pname, param);
     //NOT_IMPLEMENTED
     
     glMaterialfv(face, pname, &param);
@@ -2132,6 +2337,7 @@ void glMaterialf( GLenum face, GLenum pname, GLfloat param ){
 
 void glMateriali( GLenum face, GLenum pname, GLint param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(face, pname, param);
     //NOT_IMPLEMENTED
     
     glMaterialiv(face, pname, &param);
@@ -2140,6 +2346,7 @@ void glMateriali( GLenum face, GLenum pname, GLint param ){
 
 void glMaterialfv( GLenum face, GLenum pname, const GLfloat *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(face, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -2250,6 +2457,7 @@ void glMaterialfv( GLenum face, GLenum pname, const GLfloat *params ){
 
 void glMaterialiv( GLenum face, GLenum pname, const GLint *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(face, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -2360,6 +2568,7 @@ void glMaterialiv( GLenum face, GLenum pname, const GLint *params ){
 
 void glGetMaterialfv( GLenum face, GLenum pname, GLfloat *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(face, pname, params);
 
     NOT_IMPLEMENTED
 
@@ -2367,6 +2576,7 @@ void glGetMaterialfv( GLenum face, GLenum pname, GLfloat *params ){
 
 void glGetMaterialiv( GLenum face, GLenum pname, GLint *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(face, pname, params);
 
     NOT_IMPLEMENTED
 
@@ -2374,6 +2584,7 @@ void glGetMaterialiv( GLenum face, GLenum pname, GLint *params ){
 
 void glColorMaterial( GLenum face, GLenum mode ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(face, mode);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -2403,6 +2614,7 @@ void glColorMaterial( GLenum face, GLenum mode ){
 
 void glPixelZoom( GLfloat xfactor, GLfloat yfactor ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(xfactor, yfactor);
 
     NOT_IMPLEMENTED
 
@@ -2410,6 +2622,7 @@ void glPixelZoom( GLfloat xfactor, GLfloat yfactor ){
 
 void glPixelTransferf( GLenum pname, GLfloat param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, param);
 
     NOT_IMPLEMENTED
 
@@ -2417,6 +2630,7 @@ void glPixelTransferf( GLenum pname, GLfloat param ){
 
 void glPixelTransferi( GLenum pname, GLint param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, param);
 
     NOT_IMPLEMENTED
 
@@ -2424,6 +2638,7 @@ void glPixelTransferi( GLenum pname, GLint param ){
 
 void glPixelMapfv( GLenum map, GLsizei mapsize, const GLfloat *values ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(map, mapsize, OpenGL::GLCaptureBlob(values, mapsize * sizeof(*values)));
 
     NOT_IMPLEMENTED
 
@@ -2431,6 +2646,7 @@ void glPixelMapfv( GLenum map, GLsizei mapsize, const GLfloat *values ){
 
 void glPixelMapuiv( GLenum map, GLsizei mapsize, const GLuint *values ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(map, mapsize, OpenGL::GLCaptureBlob(values, mapsize * sizeof(*values)));
 
     NOT_IMPLEMENTED
 
@@ -2438,6 +2654,7 @@ void glPixelMapuiv( GLenum map, GLsizei mapsize, const GLuint *values ){
 
 void glPixelMapusv( GLenum map, GLsizei mapsize, const GLushort *values ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(map, mapsize, OpenGL::GLCaptureBlob(values, mapsize * sizeof(*values)));
 
     NOT_IMPLEMENTED
 
@@ -2445,6 +2662,7 @@ void glPixelMapusv( GLenum map, GLsizei mapsize, const GLushort *values ){
 
 void glGetPixelMapfv( GLenum map, GLfloat *values ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(map, values);
 
     NOT_IMPLEMENTED
 
@@ -2452,6 +2670,7 @@ void glGetPixelMapfv( GLenum map, GLfloat *values ){
 
 void glGetPixelMapuiv( GLenum map, GLuint *values ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(map, values);
 
     NOT_IMPLEMENTED
 
@@ -2459,6 +2678,7 @@ void glGetPixelMapuiv( GLenum map, GLuint *values ){
 
 void glGetPixelMapusv( GLenum map, GLushort *values ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(map, values);
 
     NOT_IMPLEMENTED
 
@@ -2466,6 +2686,7 @@ void glGetPixelMapusv( GLenum map, GLushort *values ){
 
 void glBitmap( GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(width, height, xorig, yorig, xmove, ymove, bitmap);
 
     NOT_IMPLEMENTED
 
@@ -2473,6 +2694,7 @@ void glBitmap( GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfl
 
 void glDrawPixels( GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(width, height, format, type, OpenGL::GLCaptureBlob(pixels, OpenGL::GLCapture::get_image_size(true, width, height, 1, format, type)));
 
     NOT_IMPLEMENTED
 
@@ -2480,6 +2702,7 @@ void glDrawPixels( GLsizei width, GLsizei height, GLenum format, GLenum type, co
 
 void glCopyPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenum type ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, width, height, type);
 
     NOT_IMPLEMENTED
 
@@ -2498,6 +2721,7 @@ void glCopyPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenum type
 
 void glTexGend( GLenum coord, GLenum pname, GLdouble param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(coord, pname, param);
 
     NOT_IMPLEMENTED
 
@@ -2505,6 +2729,7 @@ void glTexGend( GLenum coord, GLenum pname, GLdouble param ){
 
 void glTexGenf( GLenum coord, GLenum pname, GLfloat param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(coord, pname, param);
 
     NOT_IMPLEMENTED
 
@@ -2512,6 +2737,7 @@ void glTexGenf( GLenum coord, GLenum pname, GLfloat param ){
 
 void glTexGeni( GLenum coord, GLenum pname, GLint param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(coord, pname, param);
 
     NOT_IMPLEMENTED
 
@@ -2519,6 +2745,7 @@ void glTexGeni( GLenum coord, GLenum pname, GLint param ){
 
 void glTexGendv( GLenum coord, GLenum pname, const GLdouble *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(coord, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
 
     NOT_IMPLEMENTED
 
@@ -2526,6 +2753,7 @@ void glTexGendv( GLenum coord, GLenum pname, const GLdouble *params ){
 
 void glTexGenfv( GLenum coord, GLenum pname, const GLfloat *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(coord, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
 
     NOT_IMPLEMENTED
 
@@ -2533,6 +2761,7 @@ void glTexGenfv( GLenum coord, GLenum pname, const GLfloat *params ){
 
 void glTexGeniv( GLenum coord, GLenum pname, const GLint *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(coord, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
 
     NOT_IMPLEMENTED
 
@@ -2540,6 +2769,7 @@ void glTexGeniv( GLenum coord, GLenum pname, const GLint *params ){
 
 void glGetTexGendv( GLenum coord, GLenum pname, GLdouble *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(coord, pname, params);
 
     NOT_IMPLEMENTED
 
@@ -2547,6 +2777,7 @@ void glGetTexGendv( GLenum coord, GLenum pname, GLdouble *params ){
 
 void glGetTexGenfv( GLenum coord, GLenum pname, GLfloat *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(coord, pname, params);
 
     NOT_IMPLEMENTED
 
@@ -2554,6 +2785,7 @@ void glGetTexGenfv( GLenum coord, GLenum pname, GLfloat *params ){
 
 void glGetTexGeniv( GLenum coord, GLenum pname, GLint *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(coord, pname, params);
 
     NOT_IMPLEMENTED
 
@@ -2563,6 +2795,7 @@ void glGetTexGeniv( GLenum coord, GLenum pname, GLint *params ){
 
 void glTexEnvf( GLenum target, GLenum pname, GLfloat param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, param);
     //NOT_IMPLEMENTED
     
     glTexEnvfv(target, pname, &param);
@@ -2571,6 +2804,7 @@ void glTexEnvf( GLenum target, GLenum pname, GLfloat param ){
 
 void glTexEnvi( GLenum target, GLenum pname, GLint param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, param);
     //NOT_IMPLEMENTED
     
     glTexEnviv(target, pname, &param);
@@ -2579,6 +2813,7 @@ void glTexEnvi( GLenum target, GLenum pname, GLint param ){
 
 void glTexEnvfv( GLenum target, GLenum pname, const GLfloat *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -2609,6 +2844,7 @@ void glTexEnvfv( GLenum target, GLenum pname, const GLfloat *params ){
 
 void glTexEnviv( GLenum target, GLenum pname, const GLint *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -2658,6 +2894,7 @@ void glTexEnviv( GLenum target, GLenum pname, const GLint *params ){
 
 void glGetTexEnvfv( GLenum target, GLenum pname, GLfloat *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     NOT_IMPLEMENTED
 
@@ -2665,6 +2902,7 @@ void glGetTexEnvfv( GLenum target, GLenum pname, GLfloat *params ){
 
 void glGetTexEnviv( GLenum target, GLenum pname, GLint *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     NOT_IMPLEMENTED
 
@@ -2677,6 +2915,7 @@ void glGetTexEnviv( GLenum target, GLenum pname, GLint *params ){
 
 void glPrioritizeTextures( GLsizei n, const GLuint *textures, const GLclampf *priorities ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureBlob(textures, n * sizeof(*textures)), OpenGL::GLCaptureBlob(priorities, n * sizeof(*priorities)));
 
     NOT_IMPLEMENTED
 
@@ -2684,6 +2923,7 @@ void glPrioritizeTextures( GLsizei n, const GLuint *textures, const GLclampf *pr
 
 GLboolean glAreTexturesResident( GLsizei n, const GLuint *textures, GLboolean *residences ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureBlob(textures, n * sizeof(*textures)), OpenGL::GLCaptureOutput(residences, n * sizeof(*residences)));
 
     NOT_IMPLEMENTED
     return GL_FALSE;
@@ -2696,6 +2936,7 @@ GLboolean glAreTexturesResident( GLsizei n, const GLuint *textures, GLboolean *r
 
 void glMap1d( GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, u1, u2, stride, order, points);
 
     NOT_IMPLEMENTED
 
@@ -2703,6 +2944,7 @@ void glMap1d( GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order
 
 void glMap1f( GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, u1, u2, stride, order, points);
 
     NOT_IMPLEMENTED
 
@@ -2710,6 +2952,7 @@ void glMap1f( GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order,
 
 void glMap2d( GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
 
     NOT_IMPLEMENTED
 
@@ -2717,6 +2960,7 @@ void glMap2d( GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uord
 
 void glMap2f( GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
 
     NOT_IMPLEMENTED
 
@@ -2724,6 +2968,7 @@ void glMap2f( GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder
 
 void glGetMapdv( GLenum target, GLenum query, GLdouble *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, query, v);
 
     NOT_IMPLEMENTED
 
@@ -2731,6 +2976,7 @@ void glGetMapdv( GLenum target, GLenum query, GLdouble *v ){
 
 void glGetMapfv( GLenum target, GLenum query, GLfloat *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, query, v);
 
     NOT_IMPLEMENTED
 
@@ -2738,6 +2984,7 @@ void glGetMapfv( GLenum target, GLenum query, GLfloat *v ){
 
 void glGetMapiv( GLenum target, GLenum query, GLint *v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, query, v);
 
     NOT_IMPLEMENTED
 
@@ -2745,6 +2992,7 @@ void glGetMapiv( GLenum target, GLenum query, GLint *v ){
 
 void glEvalCoord1d( GLdouble u ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(u);
 
     NOT_IMPLEMENTED
 
@@ -2752,6 +3000,7 @@ void glEvalCoord1d( GLdouble u ){
 
 void glEvalCoord1f( GLfloat u ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(u);
 
     NOT_IMPLEMENTED
 
@@ -2759,6 +3008,7 @@ void glEvalCoord1f( GLfloat u ){
 
 void glEvalCoord1dv( const GLdouble *u ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(u, 1 * sizeof(*u)));
 
     NOT_IMPLEMENTED
 
@@ -2766,6 +3016,7 @@ void glEvalCoord1dv( const GLdouble *u ){
 
 void glEvalCoord1fv( const GLfloat *u ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(u, 1 * sizeof(*u)));
 
     NOT_IMPLEMENTED
 
@@ -2773,6 +3024,7 @@ void glEvalCoord1fv( const GLfloat *u ){
 
 void glEvalCoord2d( GLdouble u, GLdouble v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(u, v);
 
     NOT_IMPLEMENTED
 
@@ -2780,6 +3032,7 @@ void glEvalCoord2d( GLdouble u, GLdouble v ){
 
 void glEvalCoord2f( GLfloat u, GLfloat v ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(u, v);
 
     NOT_IMPLEMENTED
 
@@ -2787,6 +3040,7 @@ void glEvalCoord2f( GLfloat u, GLfloat v ){
 
 void glEvalCoord2dv( const GLdouble *u ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(u, 2 * sizeof(*u)));
 
     NOT_IMPLEMENTED
 
@@ -2794,6 +3048,7 @@ void glEvalCoord2dv( const GLdouble *u ){
 
 void glEvalCoord2fv( const GLfloat *u ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(u, 2 * sizeof(*u)));
 
     NOT_IMPLEMENTED
 
@@ -2801,6 +3056,7 @@ void glEvalCoord2fv( const GLfloat *u ){
 
 void glMapGrid1d( GLint un, GLdouble u1, GLdouble u2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(un, u1, u2);
 
     NOT_IMPLEMENTED
 
@@ -2808,6 +3064,7 @@ void glMapGrid1d( GLint un, GLdouble u1, GLdouble u2 ){
 
 void glMapGrid1f( GLint un, GLfloat u1, GLfloat u2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(un, u1, u2);
 
     NOT_IMPLEMENTED
 
@@ -2815,6 +3072,7 @@ void glMapGrid1f( GLint un, GLfloat u1, GLfloat u2 ){
 
 void glMapGrid2d( GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(un, u1, u2, vn, v1, v2);
 
     NOT_IMPLEMENTED
 
@@ -2822,6 +3080,7 @@ void glMapGrid2d( GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLd
 
 void glMapGrid2f( GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(un, u1, u2, vn, v1, v2);
 
     NOT_IMPLEMENTED
 
@@ -2829,6 +3088,7 @@ void glMapGrid2f( GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloa
 
 void glEvalPoint1( GLint i ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(i);
 
     NOT_IMPLEMENTED
 
@@ -2836,6 +3096,7 @@ void glEvalPoint1( GLint i ){
 
 void glEvalPoint2( GLint i, GLint j ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(i, j);
 
     NOT_IMPLEMENTED
 
@@ -2843,6 +3104,7 @@ void glEvalPoint2( GLint i, GLint j ){
 
 void glEvalMesh1( GLenum mode, GLint i1, GLint i2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, i1, i2);
 
     NOT_IMPLEMENTED
 
@@ -2850,6 +3112,7 @@ void glEvalMesh1( GLenum mode, GLint i1, GLint i2 ){
 
 void glEvalMesh2( GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2 ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, i1, i2, j1, j2);
 
     NOT_IMPLEMENTED
 
@@ -2863,6 +3126,7 @@ void glEvalMesh2( GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2 ){
 
 void glFogf( GLenum pname, GLfloat param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, param);
     //NOT_IMPLEMENTED
     
     switch (pname)
@@ -2888,6 +3152,7 @@ void glFogf( GLenum pname, GLfloat param ){
 
 void glFogi( GLenum pname, GLint param ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, param);
     //NOT_IMPLEMENTED
     
     switch (pname)
@@ -2913,6 +3178,7 @@ void glFogi( GLenum pname, GLint param ){
 
 void glFogfv( GLenum pname, const GLfloat *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
     //NOT_IMPLEMENTED
 
     GET_CONTEXT(in_context_p)
@@ -2987,6 +3253,7 @@ void glFogfv( GLenum pname, const GLfloat *params ){
 
 void glFogiv( GLenum pname, const GLint *params ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
     //NOT_IMPLEMENTED
 
     GET_CONTEXT(in_context_p)
@@ -3067,6 +3334,7 @@ void glFogiv( GLenum pname, const GLint *params ){
 
 void glFeedbackBuffer( GLsizei size, GLenum type, GLfloat *buffer ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(size, type, buffer);
 
     NOT_IMPLEMENTED
 
@@ -3074,6 +3342,7 @@ void glFeedbackBuffer( GLsizei size, GLenum type, GLfloat *buffer ){
 
 void glPassThrough( GLfloat token ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(token);
 
     NOT_IMPLEMENTED
 
@@ -3081,6 +3350,7 @@ void glPassThrough( GLfloat token ){
 
 void glSelectBuffer( GLsizei size, GLuint *buffer ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(size, buffer);
 
     NOT_IMPLEMENTED
 
@@ -3088,6 +3358,7 @@ void glSelectBuffer( GLsizei size, GLuint *buffer ){
 
 void glInitNames( void ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     NOT_IMPLEMENTED
 
@@ -3095,6 +3366,7 @@ void glInitNames( void ){
 
 void glLoadName( GLuint name ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(name);
 
     NOT_IMPLEMENTED
 
@@ -3102,6 +3374,7 @@ void glLoadName( GLuint name ){
 
 void glPushName( GLuint name ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(name);
 
     NOT_IMPLEMENTED
 
@@ -3109,6 +3382,7 @@ void glPushName( GLuint name ){
 
 void glPopName( void ){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     NOT_IMPLEMENTED
 
@@ -3121,6 +3395,7 @@ void glPopName( void ){
 
 void glClientActiveTexture (GLenum texture){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -3139,6 +3414,7 @@ void glClientActiveTexture (GLenum texture){
 
 void glMultiTexCoord1d (GLenum target, GLdouble s){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s);
 
     NOT_IMPLEMENTED
 
@@ -3146,6 +3422,7 @@ void glMultiTexCoord1d (GLenum target, GLdouble s){
 
 void glMultiTexCoord1dv (GLenum target, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3153,6 +3430,7 @@ void glMultiTexCoord1dv (GLenum target, const GLdouble *v){
 
 void glMultiTexCoord1f (GLenum target, GLfloat s){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s);
 
     NOT_IMPLEMENTED
 
@@ -3160,6 +3438,7 @@ void glMultiTexCoord1f (GLenum target, GLfloat s){
 
 void glMultiTexCoord1fv (GLenum target, const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3167,6 +3446,7 @@ void glMultiTexCoord1fv (GLenum target, const GLfloat *v){
 
 void glMultiTexCoord1i (GLenum target, GLint s){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s);
 
     NOT_IMPLEMENTED
 
@@ -3174,6 +3454,7 @@ void glMultiTexCoord1i (GLenum target, GLint s){
 
 void glMultiTexCoord1iv (GLenum target, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3181,6 +3462,7 @@ void glMultiTexCoord1iv (GLenum target, const GLint *v){
 
 void glMultiTexCoord1s (GLenum target, GLshort s){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s);
 
     NOT_IMPLEMENTED
 
@@ -3188,6 +3470,7 @@ void glMultiTexCoord1s (GLenum target, GLshort s){
 
 void glMultiTexCoord1sv (GLenum target, const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3195,6 +3478,7 @@ void glMultiTexCoord1sv (GLenum target, const GLshort *v){
 
 void glMultiTexCoord2d (GLenum target, GLdouble s, GLdouble t){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t);
 
     NOT_IMPLEMENTED
 
@@ -3202,6 +3486,7 @@ void glMultiTexCoord2d (GLenum target, GLdouble s, GLdouble t){
 
 void glMultiTexCoord2dv (GLenum target, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3209,6 +3494,7 @@ void glMultiTexCoord2dv (GLenum target, const GLdouble *v){
 
 void glMultiTexCoord2f (GLenum target, GLfloat s, GLfloat t){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t);
 
     NOT_IMPLEMENTED
 
@@ -3216,6 +3502,7 @@ void glMultiTexCoord2f (GLenum target, GLfloat s, GLfloat t){
 
 void glMultiTexCoord2fv (GLenum target, const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3223,6 +3510,7 @@ void glMultiTexCoord2fv (GLenum target, const GLfloat *v){
 
 void glMultiTexCoord2i (GLenum target, GLint s, GLint t){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t);
 
     NOT_IMPLEMENTED
 
@@ -3230,6 +3518,7 @@ void glMultiTexCoord2i (GLenum target, GLint s, GLint t){
 
 void glMultiTexCoord2iv (GLenum target, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3237,6 +3526,7 @@ void glMultiTexCoord2iv (GLenum target, const GLint *v){
 
 void glMultiTexCoord2s (GLenum target, GLshort s, GLshort t){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t);
 
     NOT_IMPLEMENTED
 
@@ -3244,6 +3534,7 @@ void glMultiTexCoord2s (GLenum target, GLshort s, GLshort t){
 
 void glMultiTexCoord2sv (GLenum target, const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3251,6 +3542,7 @@ void glMultiTexCoord2sv (GLenum target, const GLshort *v){
 
 void glMultiTexCoord3d (GLenum target, GLdouble s, GLdouble t, GLdouble r){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t, r);
 
     NOT_IMPLEMENTED
 
@@ -3258,6 +3550,7 @@ void glMultiTexCoord3d (GLenum target, GLdouble s, GLdouble t, GLdouble r){
 
 void glMultiTexCoord3dv (GLenum target, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3265,6 +3558,7 @@ void glMultiTexCoord3dv (GLenum target, const GLdouble *v){
 
 void glMultiTexCoord3f (GLenum target, GLfloat s, GLfloat t, GLfloat r){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t, r);
 
     NOT_IMPLEMENTED
 
@@ -3272,6 +3566,7 @@ void glMultiTexCoord3f (GLenum target, GLfloat s, GLfloat t, GLfloat r){
 
 void glMultiTexCoord3fv (GLenum target, const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3279,6 +3574,7 @@ void glMultiTexCoord3fv (GLenum target, const GLfloat *v){
 
 void glMultiTexCoord3i (GLenum target, GLint s, GLint t, GLint r){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t, r);
 
     NOT_IMPLEMENTED
 
@@ -3286,6 +3582,7 @@ void glMultiTexCoord3i (GLenum target, GLint s, GLint t, GLint r){
 
 void glMultiTexCoord3iv (GLenum target, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3293,6 +3590,7 @@ void glMultiTexCoord3iv (GLenum target, const GLint *v){
 
 void glMultiTexCoord3s (GLenum target, GLshort s, GLshort t, GLshort r){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t, r);
 
     NOT_IMPLEMENTED
 
@@ -3300,6 +3598,7 @@ void glMultiTexCoord3s (GLenum target, GLshort s, GLshort t, GLshort r){
 
 void glMultiTexCoord3sv (GLenum target, const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3307,6 +3606,7 @@ void glMultiTexCoord3sv (GLenum target, const GLshort *v){
 
 void glMultiTexCoord4d (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t, r, q);
 
     NOT_IMPLEMENTED
 
@@ -3314,6 +3614,7 @@ void glMultiTexCoord4d (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdou
 
 void glMultiTexCoord4dv (GLenum target, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3321,6 +3622,7 @@ void glMultiTexCoord4dv (GLenum target, const GLdouble *v){
 
 void glMultiTexCoord4f (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t, r, q);
 
     NOT_IMPLEMENTED
 
@@ -3328,6 +3630,7 @@ void glMultiTexCoord4f (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat
 
 void glMultiTexCoord4fv (GLenum target, const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3335,6 +3638,7 @@ void glMultiTexCoord4fv (GLenum target, const GLfloat *v){
 
 void glMultiTexCoord4i (GLenum target, GLint s, GLint t, GLint r, GLint q){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t, r, q);
 
     NOT_IMPLEMENTED
 
@@ -3342,6 +3646,7 @@ void glMultiTexCoord4i (GLenum target, GLint s, GLint t, GLint r, GLint q){
 
 void glMultiTexCoord4iv (GLenum target, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3349,6 +3654,7 @@ void glMultiTexCoord4iv (GLenum target, const GLint *v){
 
 void glMultiTexCoord4s (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, s, t, r, q);
 
     NOT_IMPLEMENTED
 
@@ -3356,6 +3662,7 @@ void glMultiTexCoord4s (GLenum target, GLshort s, GLshort t, GLshort r, GLshort
 
 void glMultiTexCoord4sv (GLenum target, const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3363,6 +3670,7 @@ void glMultiTexCoord4sv (GLenum target, const GLshort *v){
 
 void glLoadTransposeMatrixf (const GLfloat *m){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(m, 16 * sizeof(*m)));
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -3383,6 +3691,7 @@ void glLoadTransposeMatrixf (const GLfloat *m){
 
 void glLoadTransposeMatrixd (const GLdouble *m){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(m, 16 * sizeof(*m)));
     //NOT_IMPLEMENTED
     
     GLfloat mf[16];
@@ -3399,6 +3708,7 @@ void glLoadTransposeMatrixd (const GLdouble *m){
 
 void glMultTransposeMatrixf (const GLfloat *m){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(m, 16 * sizeof(*m)));
     //NOT_IMPLEMENTED
     
     glm::mat4 in_mat4 = glm::mat4(m[0], m[1], m[2], m[3],
@@ -3421,6 +3731,7 @@ void glMultTransposeMatrixf (const GLfloat *m){
 
 void glMultTransposeMatrixd (const GLdouble *m){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(m, 16 * sizeof(*m)));
     //NOT_IMPLEMENTED
     
     GLfloat mf[16];
@@ -3441,6 +3752,7 @@ void glMultTransposeMatrixd (const GLdouble *m){
 
 void glFogCoordf (GLfloat coord){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(coord);
 
     NOT_IMPLEMENTED
 
@@ -3448,6 +3760,7 @@ void glFogCoordf (GLfloat coord){
 
 void glFogCoordfv (const GLfloat *coord){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(coord, 1 * sizeof(*coord)));
 
     NOT_IMPLEMENTED
 
@@ -3455,6 +3768,7 @@ void glFogCoordfv (const GLfloat *coord){
 
 void glFogCoordd (GLdouble coord){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(coord);
 
     NOT_IMPLEMENTED
 
@@ -3462,6 +3776,7 @@ void glFogCoordd (GLdouble coord){
 
 void glFogCoorddv (const GLdouble *coord){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(coord, 1 * sizeof(*coord)));
 
     NOT_IMPLEMENTED
 
@@ -3469,6 +3784,7 @@ void glFogCoorddv (const GLdouble *coord){
 
 void glFogCoordPointer (GLenum type, GLsizei stride, const void *pointer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(type, stride, pointer);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -3492,6 +3808,7 @@ void glFogCoordPointer (GLenum type, GLsizei stride, const void *pointer){
 
 void glSecondaryColor3b (GLbyte red, GLbyte green, GLbyte blue){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -3499,6 +3816,7 @@ void glSecondaryColor3b (GLbyte red, GLbyte green, GLbyte blue){
 
 void glSecondaryColor3bv (const GLbyte *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3506,6 +3824,7 @@ void glSecondaryColor3bv (const GLbyte *v){
 
 void glSecondaryColor3d (GLdouble red, GLdouble green, GLdouble blue){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -3513,6 +3832,7 @@ void glSecondaryColor3d (GLdouble red, GLdouble green, GLdouble blue){
 
 void glSecondaryColor3dv (const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3520,6 +3840,7 @@ void glSecondaryColor3dv (const GLdouble *v){
 
 void glSecondaryColor3f (GLfloat red, GLfloat green, GLfloat blue){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -3527,6 +3848,7 @@ void glSecondaryColor3f (GLfloat red, GLfloat green, GLfloat blue){
 
 void glSecondaryColor3fv (const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3534,6 +3856,7 @@ void glSecondaryColor3fv (const GLfloat *v){
 
 void glSecondaryColor3i (GLint red, GLint green, GLint blue){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -3541,6 +3864,7 @@ void glSecondaryColor3i (GLint red, GLint green, GLint blue){
 
 void glSecondaryColor3iv (const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3548,6 +3872,7 @@ void glSecondaryColor3iv (const GLint *v){
 
 void glSecondaryColor3s (GLshort red, GLshort green, GLshort blue){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -3555,6 +3880,7 @@ void glSecondaryColor3s (GLshort red, GLshort green, GLshort blue){
 
 void glSecondaryColor3sv (const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3562,6 +3888,7 @@ void glSecondaryColor3sv (const GLshort *v){
 
 void glSecondaryColor3ub (GLubyte red, GLubyte green, GLubyte blue){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -3569,6 +3896,7 @@ void glSecondaryColor3ub (GLubyte red, GLubyte green, GLubyte blue){
 
 void glSecondaryColor3ubv (const GLubyte *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3576,6 +3904,7 @@ void glSecondaryColor3ubv (const GLubyte *v){
 
 void glSecondaryColor3ui (GLuint red, GLuint green, GLuint blue){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -3583,6 +3912,7 @@ void glSecondaryColor3ui (GLuint red, GLuint green, GLuint blue){
 
 void glSecondaryColor3uiv (const GLuint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3590,6 +3920,7 @@ void glSecondaryColor3uiv (const GLuint *v){
 
 void glSecondaryColor3us (GLushort red, GLushort green, GLushort blue){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue);
 
     NOT_IMPLEMENTED
 
@@ -3597,6 +3928,7 @@ void glSecondaryColor3us (GLushort red, GLushort green, GLushort blue){
 
 void glSecondaryColor3usv (const GLushort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3604,6 +3936,7 @@ void glSecondaryColor3usv (const GLushort *v){
 
 void glSecondaryColorPointer (GLint size, GLenum type, GLsizei stride, const void *pointer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(size, type, stride, pointer);
     //NOT_IMPLEMENTED
     
     GET_CONTEXT(in_context_p)
@@ -3627,6 +3960,7 @@ void glSecondaryColorPointer (GLint size, GLenum type, GLsizei stride, const voi
 
 void glWindowPos2d (GLdouble x, GLdouble y){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -3634,6 +3968,7 @@ void glWindowPos2d (GLdouble x, GLdouble y){
 
 void glWindowPos2dv (const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3641,6 +3976,7 @@ void glWindowPos2dv (const GLdouble *v){
 
 void glWindowPos2f (GLfloat x, GLfloat y){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -3648,6 +3984,7 @@ void glWindowPos2f (GLfloat x, GLfloat y){
 
 void glWindowPos2fv (const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3655,6 +3992,7 @@ void glWindowPos2fv (const GLfloat *v){
 
 void glWindowPos2i (GLint x, GLint y){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -3662,6 +4000,7 @@ void glWindowPos2i (GLint x, GLint y){
 
 void glWindowPos2iv (const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3669,6 +4008,7 @@ void glWindowPos2iv (const GLint *v){
 
 void glWindowPos2s (GLshort x, GLshort y){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y);
 
     NOT_IMPLEMENTED
 
@@ -3676,6 +4016,7 @@ void glWindowPos2s (GLshort x, GLshort y){
 
 void glWindowPos2sv (const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3683,6 +4024,7 @@ void glWindowPos2sv (const GLshort *v){
 
 void glWindowPos3d (GLdouble x, GLdouble y, GLdouble z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -3690,6 +4032,7 @@ void glWindowPos3d (GLdouble x, GLdouble y, GLdouble z){
 
 void glWindowPos3dv (const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3697,6 +4040,7 @@ void glWindowPos3dv (const GLdouble *v){
 
 void glWindowPos3f (GLfloat x, GLfloat y, GLfloat z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -3704,6 +4048,7 @@ void glWindowPos3f (GLfloat x, GLfloat y, GLfloat z){
 
 void glWindowPos3fv (const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3711,6 +4056,7 @@ void glWindowPos3fv (const GLfloat *v){
 
 void glWindowPos3i (GLint x, GLint y, GLint z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -3718,6 +4064,7 @@ void glWindowPos3i (GLint x, GLint y, GLint z){
 
 void glWindowPos3iv (const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3725,6 +4072,7 @@ void glWindowPos3iv (const GLint *v){
 
 void glWindowPos3s (GLshort x, GLshort y, GLshort z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, z);
 
     NOT_IMPLEMENTED
 
@@ -3732,6 +4080,7 @@ void glWindowPos3s (GLshort x, GLshort y, GLshort z){
 
 void glWindowPos3sv (const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     NOT_IMPLEMENTED
 
@@ -3750,60 +4099,70 @@ void glWindowPos3sv (const GLshort *v){
 
 void glCullFace (GLenum mode){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode);
 
     return OpenGL::vkglCullFace (mode);
 }
 
 void glFrontFace (GLenum mode){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode);
 
     return OpenGL::vkglFrontFace (mode);
 }
 
 void glHint (GLenum target, GLenum mode){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, mode);
 
     return OpenGL::vkglHint (target, mode);
 }
 
 void glLineWidth (GLfloat width){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(width);
 
     return OpenGL::vkglLineWidth (width);
 }
 
 void glPointSize (GLfloat size){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(size);
 
     return OpenGL::vkglPointSize (size);
 }
 
 void glPolygonMode (GLenum face, GLenum mode){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(face, mode);
 
     return OpenGL::vkglPolygonMode (face, mode);
 }
 
 void glScissor (GLint x, GLint y, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, width, height);
 
     return OpenGL::vkglScissor (x, y, width, height);
 }
 
 void glTexParameterf (GLenum target, GLenum pname, GLfloat param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, param);
 
     return OpenGL::vkglTexParameterf (target, pname, param);
 }
 
 void glTexParameterfv (GLenum target, GLenum pname, const GLfloat *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
 
     return OpenGL::vkglTexParameterfv (target, pname, params);
 }
 
 void glTexParameteri (GLenum target, GLenum pname, GLint param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, param);
 
 	switch (pname)
 	{
@@ -3825,6 +4184,7 @@ void glTexParameteri (GLenum target, GLenum pname, GLint param){
 
 void glTexParameteriv (GLenum target, GLenum pname, const GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
 
 	switch (pname)
 	{
@@ -3846,12 +4206,14 @@ void glTexParameteriv (GLenum target, GLenum pname, const GLint *params){
 
 void glTexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, internalformat, width, border, format, type, OpenGL::GLCaptureBlob(pixels, OpenGL::GLCapture::get_image_size(true, width, 1, 1, format, type)));
 
     return OpenGL::vkglTexImage1D (target, level, internalformat, width, border, format, type, pixels);
 }
 
 void glTexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, internalformat, width, height, border, format, type, OpenGL::GLCaptureBlob(pixels, OpenGL::GLCapture::get_image_size(true, width, height, 1, format, type)));
     GET_CONTEXT(in_context_p)
 
 	if (!ENABLED_GL_NO_ERROR(in_context_p) )
@@ -3966,54 +4328,63 @@ end:
 
 void glDrawBuffer (GLenum buf){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buf);
 
     return OpenGL::vkglDrawBuffer (buf);
 }
 
 void glClear (GLbitfield mask){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mask);
 
     return OpenGL::vkglClear (mask);
 }
 
 void glClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     return OpenGL::vkglClearColor (red, green, blue, alpha);
 }
 
 void glClearStencil (GLint s){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(s);
 
     return OpenGL::vkglClearStencil (s);
 }
 
 void glClearDepth (GLdouble depth){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(depth);
 
     return OpenGL::vkglClearDepth (depth);
 }
 
 void glStencilMask (GLuint mask){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mask);
 
     return OpenGL::vkglStencilMask (mask);
 }
 
 void glColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     return OpenGL::vkglColorMask (red, green, blue, alpha);
 }
 
 void glDepthMask (GLboolean flag){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(flag);
 
     return OpenGL::vkglDepthMask (flag);
 }
 
 void glDisable (GLenum cap){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(cap);
 
     GET_CONTEXT(in_context_p)
     OpenGL::IContextObjectManagers* frontend_object_managers_ptr = in_context_p;
@@ -4087,6 +4458,7 @@ void glDisable (GLenum cap){
 
 void glEnable (GLenum cap){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(cap);
 
     GET_CONTEXT(in_context_p)
     OpenGL::IContextObjectManagers* frontend_object_managers_ptr = in_context_p;
@@ -4161,96 +4533,116 @@ void glEnable (GLenum cap){
 
 void glFinish (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglFinish ();
 }
 
 void glFlush (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglFlush ();
 }
 
 void glBlendFunc (GLenum sfactor, GLenum dfactor){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sfactor, dfactor);
 
     return OpenGL::vkglBlendFunc (sfactor, dfactor);
 }
 
 void glLogicOp (GLenum opcode){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(opcode);
 
     return OpenGL::vkglLogicOp (opcode);
 }
 
 void glStencilFunc (GLenum func, GLint ref, GLuint mask){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(func, ref, mask);
 
     return OpenGL::vkglStencilFunc (func, ref, mask);
 }
 
 void glStencilOp (GLenum fail, GLenum zfail, GLenum zpass){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(fail, zfail, zpass);
 
     return OpenGL::vkglStencilOp (fail, zfail, zpass);
 }
 
 void glDepthFunc (GLenum func){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(func);
 
     return OpenGL::vkglDepthFunc (func);
 }
 
 void glPixelStoref (GLenum pname, GLfloat param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, param);
+
+    OpenGL::GLCapture::on_pixel_store(pname, static_cast<GLint>(param) );
 
     return OpenGL::vkglPixelStoref (pname, param);
 }
 
 void glPixelStorei (GLenum pname, GLint param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, param);
+
+    OpenGL::GLCapture::on_pixel_store(pname, param);
 
     return OpenGL::vkglPixelStorei (pname, param);
 }
 
 void glReadBuffer (GLenum src){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(src);
 
     return OpenGL::vkglReadBuffer (src);
 }
 
 void glReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, width, height, format, type, OpenGL::GLCaptureOutput(pixels, OpenGL::GLCapture::get_image_size(false, width, height, 1, format, type)));
 
     return OpenGL::vkglReadPixels (x, y, width, height, format, type, pixels);
 }
 
 void glGetBooleanv (GLenum pname, GLboolean *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, data);
 
     return OpenGL::vkglGetBooleanv (pname, data);
 }
 
 void glGetDoublev (GLenum pname, GLdouble *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, data);
 
     return OpenGL::vkglGetDoublev (pname, data);
 }
 
 GLenum glGetError (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglGetError ();
 }
 
 void glGetFloatv (GLenum pname, GLfloat *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, data);
 
     return OpenGL::vkglGetFloatv (pname, data);
 }
 
 void glGetIntegerv (GLenum pname, GLint *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, data);
 
     switch (pname)
     {
@@ -4267,42 +4659,49 @@ void glGetIntegerv (GLenum pname, GLint *data){
 
 const GLubyte *glGetString (GLenum name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(name);
 
     return OpenGL::vkglGetString (name);
 }
 
 void glGetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, format, type, OpenGL::GLCaptureOutput(pixels, OpenGL::GLCapture::get_tex_image_size(target, level, format, type, false)));
 
     return OpenGL::vkglGetTexImage (target, level, format, type, pixels);
 }
 
 void glGetTexParameterfv (GLenum target, GLenum pname, GLfloat *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     return OpenGL::vkglGetTexParameterfv (target, pname, params);
 }
 
 void glGetTexParameteriv (GLenum target, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     return OpenGL::vkglGetTexParameteriv (target, pname, params);
 }
 
 void glGetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, pname, params);
 
     return OpenGL::vkglGetTexLevelParameterfv (target, level, pname, params);
 }
 
 void glGetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, pname, params);
 
     return OpenGL::vkglGetTexLevelParameteriv (target, level, pname, params);
 }
 
 GLboolean glIsEnabled (GLenum cap){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(cap);
 
     GET_CONTEXT(in_context_p)
     OpenGL::IContextObjectManagers* frontend_object_managers_ptr = in_context_p;
@@ -4380,12 +4779,14 @@ GLboolean glIsEnabled (GLenum cap){
 
 void glDepthRange (GLdouble n, GLdouble f){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, f);
 
     return OpenGL::vkglDepthRange (n, f);
 }
 
 void glViewport (GLint x, GLint y, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, width, height);
 
     return OpenGL::vkglViewport (x, y, width, height);
 }
@@ -4396,6 +4797,7 @@ void glViewport (GLint x, GLint y, GLsizei width, GLsizei height){
 
 void glDrawArrays (GLenum mode, GLint first, GLsizei count){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, first, count);
 
     GET_CONTEXT(in_context_p)
     OpenGL::IContextObjectManagers* frontend_object_managers_ptr = in_context_p;
@@ -4440,6 +4842,7 @@ void glDrawArrays (GLenum mode, GLint first, GLsizei count){
 
 void glDrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, count, type, indices);
 
     GET_CONTEXT(in_context_p)
     OpenGL::IContextObjectManagers* frontend_object_managers_ptr = in_context_p;
@@ -4484,72 +4887,84 @@ void glDrawElements (GLenum mode, GLsizei count, GLenum type, const void *indice
 
 void glGetPointerv (GLenum pname, void **params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, params);
 
     return OpenGL::vkglGetPointerv (pname, params);
 }
 
 void glPolygonOffset (GLfloat factor, GLfloat units){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(factor, units);
 
     return OpenGL::vkglPolygonOffset (factor, units);
 }
 
 void glCopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, internalformat, x, y, width, border);
 
     return OpenGL::vkglCopyTexImage1D (target, level, internalformat, x, y, width, border);
 }
 
 void glCopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, internalformat, x, y, width, height, border);
 
     return OpenGL::vkglCopyTexImage2D (target, level, internalformat, x, y, width, height, border);
 }
 
 void glCopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, xoffset, x, y, width);
 
     return OpenGL::vkglCopyTexSubImage1D (target, level, xoffset, x, y, width);
 }
 
 void glCopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, xoffset, yoffset, x, y, width, height);
 
     return OpenGL::vkglCopyTexSubImage2D (target, level, xoffset, yoffset, x, y, width, height);
 }
 
 void glTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, xoffset, width, format, type, OpenGL::GLCaptureBlob(pixels, OpenGL::GLCapture::get_image_size(true, width, 1, 1, format, type)));
 
     return OpenGL::vkglTexSubImage1D (target, level, xoffset, width, format, type, pixels);
 }
 
 void glTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, xoffset, yoffset, width, height, format, type, OpenGL::GLCaptureBlob(pixels, OpenGL::GLCapture::get_image_size(true, width, height, 1, format, type)));
 
     return OpenGL::vkglTexSubImage2D (target, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
 void glBindTexture (GLenum target, GLuint texture){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, texture);
 
     return OpenGL::vkglBindTexture (target, texture);
 }
 
 void glDeleteTextures (GLsizei n, const GLuint *textures){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureBlob(textures, n * sizeof(*textures)));
 
     return OpenGL::vkglDeleteTextures (n, textures);
 }
 
 void glGenTextures (GLsizei n, GLuint *textures){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(textures, n * sizeof(*textures)));
 
     return OpenGL::vkglGenTextures (n, textures);
 }
 
 GLboolean glIsTexture (GLuint texture){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture);
 
     return OpenGL::vkglIsTexture (texture);
 }
@@ -4560,6 +4975,7 @@ GLboolean glIsTexture (GLuint texture){
 
 void glDrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, start, end, count, type, indices);
 
     GET_CONTEXT(in_context_p)
     OpenGL::IContextObjectManagers* frontend_object_managers_ptr = in_context_p;
@@ -4604,18 +5020,21 @@ void glDrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count,
 
 void glTexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, internalformat, width, height, depth, border, format, type, OpenGL::GLCaptureBlob(pixels, OpenGL::GLCapture::get_image_size(true, width, height, depth, format, type)));
 
     return OpenGL::vkglTexImage3D (target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
 void glTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, OpenGL::GLCaptureBlob(pixels, OpenGL::GLCapture::get_image_size(true, width, height, depth, format, type)));
 
     return OpenGL::vkglTexSubImage3D (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
 void glCopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, xoffset, yoffset, zoffset, x, y, width, height);
 
     return OpenGL::vkglCopyTexSubImage3D (target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
@@ -4626,6 +5045,7 @@ void glCopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffs
 
 void glActiveTexture (GLenum texture){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture);
 
     GET_CONTEXT(in_context_p)
     OpenGL::IContextObjectManagers* frontend_object_managers_ptr = in_context_p;
@@ -4642,48 +5062,56 @@ void glActiveTexture (GLenum texture){
 
 void glSampleCoverage (GLfloat value, GLboolean invert){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(value, invert);
 
     return OpenGL::vkglSampleCoverage (value, invert);
 }
 
 void glCompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, internalformat, width, height, depth, border, imageSize, OpenGL::GLCaptureBlob(data, static_cast<size_t>(imageSize)));
 
     return OpenGL::vkglCompressedTexImage3D (target, level, internalformat, width, height, depth, border, imageSize, data);
 }
 
 void glCompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, internalformat, width, height, border, imageSize, OpenGL::GLCaptureBlob(data, static_cast<size_t>(imageSize)));
 
     return OpenGL::vkglCompressedTexImage2D (target, level, internalformat, width, height, border, imageSize, data);
 }
 
 void glCompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, internalformat, width, border, imageSize, OpenGL::GLCaptureBlob(data, static_cast<size_t>(imageSize)));
 
     return OpenGL::vkglCompressedTexImage1D (target, level, internalformat, width, border, imageSize, data);
 }
 
 void glCompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, OpenGL::GLCaptureBlob(data, static_cast<size_t>(imageSize)));
 
     return OpenGL::vkglCompressedTexSubImage3D (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
 void glCompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, xoffset, yoffset, width, height, format, imageSize, OpenGL::GLCaptureBlob(data, static_cast<size_t>(imageSize)));
 
     return OpenGL::vkglCompressedTexSubImage2D (target, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
 void glCompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, xoffset, width, format, imageSize, OpenGL::GLCaptureBlob(data, static_cast<size_t>(imageSize)));
 
     return OpenGL::vkglCompressedTexSubImage1D (target, level, xoffset, width, format, imageSize, data);
 }
 
 void glGetCompressedTexImage (GLenum target, GLint level, void *img){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, OpenGL::GLCaptureOutput(img, OpenGL::GLCapture::get_tex_image_size(target, level, GL_NONE, GL_NONE, true)));
 
     return OpenGL::vkglGetCompressedTexImage (target, level, img);
 }
@@ -4694,54 +5122,63 @@ void glGetCompressedTexImage (GLenum target, GLint level, void *img){
 
 void glBlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 
     return OpenGL::vkglBlendFuncSeparate (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 }
 
 void glMultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, OpenGL::GLCaptureBlob(first, drawcount * sizeof(*first)), OpenGL::GLCaptureBlob(count, drawcount * sizeof(*count)), drawcount);
 
     return OpenGL::vkglMultiDrawArrays (mode, first, count, drawcount);
 }
 
 void glMultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, OpenGL::GLCaptureBlob(count, drawcount * sizeof(*count)), type, OpenGL::GLCapturePointerArray(drawcount, indices, false), drawcount);
 
     return OpenGL::vkglMultiDrawElements (mode, count, type, indices, drawcount);
 }
 
 void glPointParameterf (GLenum pname, GLfloat param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, param);
 
     return OpenGL::vkglPointParameterf (pname, param);
 }
 
 void glPointParameterfv (GLenum pname, const GLfloat *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
 
     return OpenGL::vkglPointParameterfv (pname, params);
 }
 
 void glPointParameteri (GLenum pname, GLint param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, param);
 
     return OpenGL::vkglPointParameteri (pname, param);
 }
 
 void glPointParameteriv (GLenum pname, const GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
 
     return OpenGL::vkglPointParameteriv (pname, params);
 }
 
 void glBlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(red, green, blue, alpha);
 
     return OpenGL::vkglBlendColor (red, green, blue, alpha);
 }
 
 void glBlendEquation (GLenum mode){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode);
 
     return OpenGL::vkglBlendEquation (mode);
 }
@@ -4752,54 +5189,63 @@ void glBlendEquation (GLenum mode){
 
 void glGenQueries (GLsizei n, GLuint *ids){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(ids, n * sizeof(*ids)));
 
     return OpenGL::vkglGenQueries (n, ids);
 }
 
 void glDeleteQueries (GLsizei n, const GLuint *ids){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureBlob(ids, n * sizeof(*ids)));
 
     return OpenGL::vkglDeleteQueries (n, ids);
 }
 
 GLboolean glIsQuery (GLuint id){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id);
 
     return OpenGL::vkglIsQuery (id);
 }
 
 void glBeginQuery (GLenum target, GLuint id){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, id);
 
     return OpenGL::vkglBeginQuery (target, id);
 }
 
 void glEndQuery (GLenum target){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target);
 
     return OpenGL::vkglEndQuery (target);
 }
 
 void glGetQueryiv (GLenum target, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     return OpenGL::vkglGetQueryiv (target, pname, params);
 }
 
 void glGetQueryObjectiv (GLuint id, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id, pname, params);
 
     return OpenGL::vkglGetQueryObjectiv (id, pname, params);
 }
 
 void glGetQueryObjectuiv (GLuint id, GLenum pname, GLuint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id, pname, params);
 
     return OpenGL::vkglGetQueryObjectuiv (id, pname, params);
 }
 
 void glBindBuffer (GLenum target, GLuint buffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, buffer);
     GET_CONTEXT(in_context_p)
     OpenGL::IContextObjectManagers* frontend_object_managers_ptr = in_context_p;
     
@@ -4818,65 +5264,89 @@ void glBindBuffer (GLenum target, GLuint buffer){
         }
     }
     
+    OpenGL::GLCapture::on_buffer_bound(target, buffer);
+
     return OpenGL::vkglBindBuffer (target, buffer);
 }
 
 void glDeleteBuffers (GLsizei n, const GLuint *buffers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureBlob(buffers, n * sizeof(*buffers)));
 
     return OpenGL::vkglDeleteBuffers (n, buffers);
 }
 
 void glGenBuffers (GLsizei n, GLuint *buffers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(buffers, n * sizeof(*buffers)));
 
     return OpenGL::vkglGenBuffers (n, buffers);
 }
 
 GLboolean glIsBuffer (GLuint buffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer);
 
     return OpenGL::vkglIsBuffer (buffer);
 }
 
 void glBufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, size, OpenGL::GLCaptureBlob(data, static_cast<size_t>(size)), usage);
 
     return OpenGL::vkglBufferData (target, size, data, usage);
 }
 
 void glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, offset, size, OpenGL::GLCaptureBlob(data, static_cast<size_t>(size)));
 
     return OpenGL::vkglBufferSubData (target, offset, size, data);
 }
 
 void glGetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, offset, size, OpenGL::GLCaptureOutput(data, static_cast<size_t>(size)));
 
     return OpenGL::vkglGetBufferSubData (target, offset, size, data);
 }
 
 void *glMapBuffer (GLenum target, GLenum access){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, access);
+
+    GLint64 size = 0;
 
-    return OpenGL::vkglMapBuffer (target, access);
+    if (OpenGL::GLCapture::is_enabled() )
+    {
+        OpenGL::vkglGetBufferParameteri64v (target, GL_BUFFER_SIZE, &size);
+    }
+
+    return OpenGL::GLCapture::on_buffer_mapped(target,
+                                               static_cast<GLsizeiptr>(size),
+                                               (access != GL_READ_ONLY) ? GL_MAP_WRITE_BIT : 0,
+                                               OpenGL::vkglMapBuffer (target, access) );
 }
 
 GLboolean glUnmapBuffer (GLenum target){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    OpenGL::GLCapture::on_buffer_unmapping(target);
+
+    VKGL_GL_CAPTURE(target);
 
     return OpenGL::vkglUnmapBuffer (target);
 }
 
 void glGetBufferParameteriv (GLenum target, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     return OpenGL::vkglGetBufferParameteriv (target, pname, params);
 }
 
 void glGetBufferPointerv (GLenum target, GLenum pname, void **params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     return OpenGL::vkglGetBufferPointerv (target, pname, params);
 }
@@ -4887,66 +5357,77 @@ void glGetBufferPointerv (GLenum target, GLenum pname, void **params){
 
 void glBlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(modeRGB, modeAlpha);
 
     return OpenGL::vkglBlendEquationSeparate (modeRGB, modeAlpha);
 }
 
 void glDrawBuffers (GLsizei n, const GLenum *bufs){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureBlob(bufs, n * sizeof(*bufs)));
 
     return OpenGL::vkglDrawBuffers (n, bufs);
 }
 
 void glStencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(face, sfail, dpfail, dppass);
 
     return OpenGL::vkglStencilOpSeparate (face, sfail, dpfail, dppass);
 }
 
 void glStencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(face, func, ref, mask);
 
     return OpenGL::vkglStencilFuncSeparate (face, func, ref, mask);
 }
 
 void glStencilMaskSeparate (GLenum face, GLuint mask){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(face, mask);
 
     return OpenGL::vkglStencilMaskSeparate (face, mask);
 }
 
 void glAttachShader (GLuint program, GLuint shader){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, shader);
 
     return OpenGL::vkglAttachShader (program, shader);
 }
 
 void glBindAttribLocation (GLuint program, GLuint index, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, index, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglBindAttribLocation (program, index, name);
 }
 
 void glCompileShader (GLuint shader){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(shader);
 
     return OpenGL::vkglCompileShader (shader);
 }
 
 GLuint glCreateProgram (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglCreateProgram ();
 }
 
 GLuint glCreateShader (GLenum type){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(type);
 
     return OpenGL::vkglCreateShader (type);
 }
 
 void glDeleteProgram (GLuint program){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program);
 
 	GET_CONTEXT(in_context_p)
     OpenGL::IContextObjectManagers* frontend_object_managers_ptr = in_context_p;
@@ -4962,138 +5443,161 @@ void glDeleteProgram (GLuint program){
 
 void glDeleteShader (GLuint shader){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(shader);
 
     return OpenGL::vkglDeleteShader (shader);
 }
 
 void glDetachShader (GLuint program, GLuint shader){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, shader);
 
     return OpenGL::vkglDetachShader (program, shader);
 }
 
 void glDisableVertexAttribArray (GLuint index){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index);
 
     return OpenGL::vkglDisableVertexAttribArray (index);
 }
 
 void glEnableVertexAttribArray (GLuint index){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index);
 
     return OpenGL::vkglEnableVertexAttribArray (index);
 }
 
 void glGetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, index, bufSize, length, OpenGL::GLCaptureOutput(size, bufSize * sizeof(*size)), OpenGL::GLCaptureOutput(type, bufSize * sizeof(*type)), OpenGL::GLCaptureOutput(name, bufSize));
 
     return OpenGL::vkglGetActiveAttrib (program, index, bufSize, length, size, type, name);
 }
 
 void glGetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, index, bufSize, length, OpenGL::GLCaptureOutput(size, bufSize * sizeof(*size)), OpenGL::GLCaptureOutput(type, bufSize * sizeof(*type)), OpenGL::GLCaptureOutput(name, bufSize));
 
     return OpenGL::vkglGetActiveUniform (program, index, bufSize, length, size, type, name);
 }
 
 void glGetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, maxCount, count, OpenGL::GLCaptureOutput(shaders, maxCount * sizeof(*shaders)));
 
     return OpenGL::vkglGetAttachedShaders (program, maxCount, count, shaders);
 }
 
 GLint glGetAttribLocation (GLuint program, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglGetAttribLocation (program, name);
 }
 
 void glGetProgramiv (GLuint program, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, pname, params);
 
     return OpenGL::vkglGetProgramiv (program, pname, params);
 }
 
 void glGetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, bufSize, length, OpenGL::GLCaptureOutput(infoLog, bufSize));
 
     return OpenGL::vkglGetProgramInfoLog (program, bufSize, length, infoLog);
 }
 
 void glGetShaderiv (GLuint shader, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(shader, pname, params);
 
     return OpenGL::vkglGetShaderiv (shader, pname, params);
 }
 
 void glGetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(shader, bufSize, length, OpenGL::GLCaptureOutput(infoLog, bufSize));
 
     return OpenGL::vkglGetShaderInfoLog (shader, bufSize, length, infoLog);
 }
 
 void glGetShaderSource (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(shader, bufSize, length, OpenGL::GLCaptureOutput(source, bufSize));
 
     return OpenGL::vkglGetShaderSource (shader, bufSize, length, source);
 }
 
 GLint glGetUniformLocation (GLuint program, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglGetUniformLocation (program, name);
 }
 
 void glGetUniformfv (GLuint program, GLint location, GLfloat *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, params);
 
     return OpenGL::vkglGetUniformfv (program, location, params);
 }
 
 void glGetUniformiv (GLuint program, GLint location, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, params);
 
     return OpenGL::vkglGetUniformiv (program, location, params);
 }
 
 void glGetVertexAttribdv (GLuint index, GLenum pname, GLdouble *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, pname, params);
 
     return OpenGL::vkglGetVertexAttribdv (index, pname, params);
 }
 
 void glGetVertexAttribfv (GLuint index, GLenum pname, GLfloat *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, pname, params);
 
     return OpenGL::vkglGetVertexAttribfv (index, pname, params);
 }
 
 void glGetVertexAttribiv (GLuint index, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, pname, params);
 
     return OpenGL::vkglGetVertexAttribiv (index, pname, params);
 }
 
 void glGetVertexAttribPointerv (GLuint index, GLenum pname, void **pointer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, pname, pointer);
 
     return OpenGL::vkglGetVertexAttribPointerv (index, pname, pointer);
 }
 
 GLboolean glIsProgram (GLuint program){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program);
 
     return OpenGL::vkglIsProgram (program);
 }
 
 GLboolean glIsShader (GLuint shader){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(shader);
 
     return OpenGL::vkglIsShader (shader);
 }
 
 void glLinkProgram (GLuint program){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program);
 
 	GET_CONTEXT(in_context_p)
     OpenGL::IContextObjectManagers* frontend_object_managers_ptr = in_context_p;
@@ -5109,12 +5613,14 @@ void glLinkProgram (GLuint program){
 
 void glShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(shader, count, OpenGL::GLCapturePointerArray(count, reinterpret_cast<const void* const*>(string), true, length), OpenGL::GLCaptureBlob(length, count * sizeof(*length)));
 
     return OpenGL::vkglShaderSource (shader, count, string, length);
 }
 
 void glUseProgram (GLuint program){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program);
     
 	GET_CONTEXT(in_context_p)
     OpenGL::IContextObjectManagers* frontend_object_managers_ptr = in_context_p;
@@ -5131,342 +5637,399 @@ void glUseProgram (GLuint program){
 
 void glUniform1f (GLint location, GLfloat v0){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0);
 
     return OpenGL::vkglUniform1f (location, v0);
 }
 
 void glUniform2f (GLint location, GLfloat v0, GLfloat v1){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0, v1);
 
     return OpenGL::vkglUniform2f (location, v0, v1);
 }
 
 void glUniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0, v1, v2);
 
     return OpenGL::vkglUniform3f (location, v0, v1, v2);
 }
 
 void glUniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0, v1, v2, v3);
 
     return OpenGL::vkglUniform4f (location, v0, v1, v2, v3);
 }
 
 void glUniform1i (GLint location, GLint v0){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0);
 
     return OpenGL::vkglUniform1i (location, v0);
 }
 
 void glUniform2i (GLint location, GLint v0, GLint v1){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0, v1);
 
     return OpenGL::vkglUniform2i (location, v0, v1);
 }
 
 void glUniform3i (GLint location, GLint v0, GLint v1, GLint v2){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0, v1, v2);
 
     return OpenGL::vkglUniform3i (location, v0, v1, v2);
 }
 
 void glUniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0, v1, v2, v3);
 
     return OpenGL::vkglUniform4i (location, v0, v1, v2, v3);
 }
 
 void glUniform1fv (GLint location, GLsizei count, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 1 * sizeof(*value)));
 
     return OpenGL::vkglUniform1fv (location, count, value);
 }
 
 void glUniform2fv (GLint location, GLsizei count, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 2 * sizeof(*value)));
 
     return OpenGL::vkglUniform2fv (location, count, value);
 }
 
 void glUniform3fv (GLint location, GLsizei count, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 3 * sizeof(*value)));
 
     return OpenGL::vkglUniform3fv (location, count, value);
 }
 
 void glUniform4fv (GLint location, GLsizei count, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 4 * sizeof(*value)));
 
     return OpenGL::vkglUniform4fv (location, count, value);
 }
 
 void glUniform1iv (GLint location, GLsizei count, const GLint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 1 * sizeof(*value)));
 
     return OpenGL::vkglUniform1iv (location, count, value);
 }
 
 void glUniform2iv (GLint location, GLsizei count, const GLint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 2 * sizeof(*value)));
 
     return OpenGL::vkglUniform2iv (location, count, value);
 }
 
 void glUniform3iv (GLint location, GLsizei count, const GLint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 3 * sizeof(*value)));
 
     return OpenGL::vkglUniform3iv (location, count, value);
 }
 
 void glUniform4iv (GLint location, GLsizei count, const GLint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 4 * sizeof(*value)));
 
     return OpenGL::vkglUniform4iv (location, count, value);
 }
 
 void glUniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 2 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix2fv (location, count, transpose, value);
 }
 
 void glUniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 3 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix3fv (location, count, transpose, value);
 }
 
 void glUniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 4 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix4fv (location, count, transpose, value);
 }
 
 void glValidateProgram (GLuint program){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program);
 
     return OpenGL::vkglValidateProgram (program);
 }
 
 void glVertexAttrib1d (GLuint index, GLdouble x){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x);
 
     return OpenGL::vkglVertexAttrib1d (index, x);
 }
 
 void glVertexAttrib1dv (GLuint index, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib1dv (index, v);
 }
 
 void glVertexAttrib1f (GLuint index, GLfloat x){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x);
 
     return OpenGL::vkglVertexAttrib1f (index, x);
 }
 
 void glVertexAttrib1fv (GLuint index, const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib1fv (index, v);
 }
 
 void glVertexAttrib1s (GLuint index, GLshort x){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x);
 
     return OpenGL::vkglVertexAttrib1s (index, x);
 }
 
 void glVertexAttrib1sv (GLuint index, const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib1sv (index, v);
 }
 
 void glVertexAttrib2d (GLuint index, GLdouble x, GLdouble y){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y);
 
     return OpenGL::vkglVertexAttrib2d (index, x, y);
 }
 
 void glVertexAttrib2dv (GLuint index, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib2dv (index, v);
 }
 
 void glVertexAttrib2f (GLuint index, GLfloat x, GLfloat y){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y);
 
     return OpenGL::vkglVertexAttrib2f (index, x, y);
 }
 
 void glVertexAttrib2fv (GLuint index, const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib2fv (index, v);
 }
 
 void glVertexAttrib2s (GLuint index, GLshort x, GLshort y){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y);
 
     return OpenGL::vkglVertexAttrib2s (index, x, y);
 }
 
 void glVertexAttrib2sv (GLuint index, const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib2sv (index, v);
 }
 
 void glVertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z);
 
     return OpenGL::vkglVertexAttrib3d (index, x, y, z);
 }
 
 void glVertexAttrib3dv (GLuint index, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib3dv (index, v);
 }
 
 void glVertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z);
 
     return OpenGL::vkglVertexAttrib3f (index, x, y, z);
 }
 
 void glVertexAttrib3fv (GLuint index, const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib3fv (index, v);
 }
 
 void glVertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z);
 
     return OpenGL::vkglVertexAttrib3s (index, x, y, z);
 }
 
 void glVertexAttrib3sv (GLuint index, const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib3sv (index, v);
 }
 
 void glVertexAttrib4Nbv (GLuint index, const GLbyte *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4Nbv (index, v);
 }
 
 void glVertexAttrib4Niv (GLuint index, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4Niv (index, v);
 }
 
 void glVertexAttrib4Nsv (GLuint index, const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4Nsv (index, v);
 }
 
 void glVertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z, w);
 
     return OpenGL::vkglVertexAttrib4Nub (index, x, y, z, w);
 }
 
 void glVertexAttrib4Nubv (GLuint index, const GLubyte *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4Nubv (index, v);
 }
 
 void glVertexAttrib4Nuiv (GLuint index, const GLuint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4Nuiv (index, v);
 }
 
 void glVertexAttrib4Nusv (GLuint index, const GLushort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4Nusv (index, v);
 }
 
 void glVertexAttrib4bv (GLuint index, const GLbyte *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4bv (index, v);
 }
 
 void glVertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z, w);
 
     return OpenGL::vkglVertexAttrib4d (index, x, y, z, w);
 }
 
 void glVertexAttrib4dv (GLuint index, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4dv (index, v);
 }
 
 void glVertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z, w);
 
     return OpenGL::vkglVertexAttrib4f (index, x, y, z, w);
 }
 
 void glVertexAttrib4fv (GLuint index, const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4fv (index, v);
 }
 
 void glVertexAttrib4iv (GLuint index, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4iv (index, v);
 }
 
 void glVertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z, w);
 
     return OpenGL::vkglVertexAttrib4s (index, x, y, z, w);
 }
 
 void glVertexAttrib4sv (GLuint index, const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4sv (index, v);
 }
 
 void glVertexAttrib4ubv (GLuint index, const GLubyte *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4ubv (index, v);
 }
 
 void glVertexAttrib4uiv (GLuint index, const GLuint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4uiv (index, v);
 }
 
 void glVertexAttrib4usv (GLuint index, const GLushort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttrib4usv (index, v);
 }
 
 void glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, size, type, normalized, stride, pointer);
 
     return OpenGL::vkglVertexAttribPointer (index, size, type, normalized, stride, pointer);
 }
@@ -5477,36 +6040,42 @@ void glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean nor
 
 void glUniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 3 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix2x3fv (location, count, transpose, value);
 }
 
 void glUniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 2 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix3x2fv (location, count, transpose, value);
 }
 
 void glUniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 4 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix2x4fv (location, count, transpose, value);
 }
 
 void glUniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 2 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix4x2fv (location, count, transpose, value);
 }
 
 void glUniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 4 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix3x4fv (location, count, transpose, value);
 }
 
 void glUniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 3 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix4x3fv (location, count, transpose, value);
 }
@@ -5517,486 +6086,570 @@ void glUniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, c
 
 void glColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, r, g, b, a);
 
     return OpenGL::vkglColorMaski (index, r, g, b, a);
 }
 
 void glGetBooleani_v (GLenum target, GLuint index, GLboolean *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index, data);
 
     return OpenGL::vkglGetBooleani_v (target, index, data);
 }
 
 void glGetIntegeri_v (GLenum target, GLuint index, GLint *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index, data);
 
     return OpenGL::vkglGetIntegeri_v (target, index, data);
 }
 
 void glEnablei (GLenum target, GLuint index){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index);
 
     return OpenGL::vkglEnablei (target, index);
 }
 
 void glDisablei (GLenum target, GLuint index){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index);
 
     return OpenGL::vkglDisablei (target, index);
 }
 
 GLboolean glIsEnabledi (GLenum target, GLuint index){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index);
 
     return OpenGL::vkglIsEnabledi (target, index);
 }
 
 void glBeginTransformFeedback (GLenum primitiveMode){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(primitiveMode);
 
     return OpenGL::vkglBeginTransformFeedback (primitiveMode);
 }
 
 void glEndTransformFeedback (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglEndTransformFeedback ();
 }
 
 void glBindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index, buffer, offset, size);
 
     return OpenGL::vkglBindBufferRange (target, index, buffer, offset, size);
 }
 
 void glBindBufferBase (GLenum target, GLuint index, GLuint buffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index, buffer);
 
     return OpenGL::vkglBindBufferBase (target, index, buffer);
 }
 
 void glTransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, count, OpenGL::GLCapturePointerArray(count, reinterpret_cast<const void* const*>(varyings), true), bufferMode);
 
     return OpenGL::vkglTransformFeedbackVaryings (program, count, varyings, bufferMode);
 }
 
 void glGetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, index, bufSize, length, size, OpenGL::GLCaptureOutput(type, bufSize * sizeof(*type)), OpenGL::GLCaptureOutput(name, bufSize));
 
     return OpenGL::vkglGetTransformFeedbackVarying (program, index, bufSize, length, size, type, name);
 }
 
 void glClampColor (GLenum target, GLenum clamp){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, clamp);
 
     return OpenGL::vkglClampColor (target, clamp);
 }
 
 void glBeginConditionalRender (GLuint id, GLenum mode){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id, mode);
 
     return OpenGL::vkglBeginConditionalRender (id, mode);
 }
 
 void glEndConditionalRender (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglEndConditionalRender ();
 }
 
 void glVertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, size, type, stride, pointer);
 
     return OpenGL::vkglVertexAttribIPointer (index, size, type, stride, pointer);
 }
 
 void glGetVertexAttribIiv (GLuint index, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, pname, params);
 
     return OpenGL::vkglGetVertexAttribIiv (index, pname, params);
 }
 
 void glGetVertexAttribIuiv (GLuint index, GLenum pname, GLuint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, pname, params);
 
     return OpenGL::vkglGetVertexAttribIuiv (index, pname, params);
 }
 
 void glVertexAttribI1i (GLuint index, GLint x){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x);
 
     return OpenGL::vkglVertexAttribI1i (index, x);
 }
 
 void glVertexAttribI2i (GLuint index, GLint x, GLint y){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y);
 
     return OpenGL::vkglVertexAttribI2i (index, x, y);
 }
 
 void glVertexAttribI3i (GLuint index, GLint x, GLint y, GLint z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z);
 
     return OpenGL::vkglVertexAttribI3i (index, x, y, z);
 }
 
 void glVertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z, w);
 
     return OpenGL::vkglVertexAttribI4i (index, x, y, z, w);
 }
 
 void glVertexAttribI1ui (GLuint index, GLuint x){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x);
 
     return OpenGL::vkglVertexAttribI1ui (index, x);
 }
 
 void glVertexAttribI2ui (GLuint index, GLuint x, GLuint y){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y);
 
     return OpenGL::vkglVertexAttribI2ui (index, x, y);
 }
 
 void glVertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z);
 
     return OpenGL::vkglVertexAttribI3ui (index, x, y, z);
 }
 
 void glVertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z, w);
 
     return OpenGL::vkglVertexAttribI4ui (index, x, y, z, w);
 }
 
 void glVertexAttribI1iv (GLuint index, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI1iv (index, v);
 }
 
 void glVertexAttribI2iv (GLuint index, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI2iv (index, v);
 }
 
 void glVertexAttribI3iv (GLuint index, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI3iv (index, v);
 }
 
 void glVertexAttribI4iv (GLuint index, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI4iv (index, v);
 }
 
 void glVertexAttribI1uiv (GLuint index, const GLuint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI1uiv (index, v);
 }
 
 void glVertexAttribI2uiv (GLuint index, const GLuint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI2uiv (index, v);
 }
 
 void glVertexAttribI3uiv (GLuint index, const GLuint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI3uiv (index, v);
 }
 
 void glVertexAttribI4uiv (GLuint index, const GLuint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI4uiv (index, v);
 }
 
 void glVertexAttribI4bv (GLuint index, const GLbyte *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI4bv (index, v);
 }
 
 void glVertexAttribI4sv (GLuint index, const GLshort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI4sv (index, v);
 }
 
 void glVertexAttribI4ubv (GLuint index, const GLubyte *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI4ubv (index, v);
 }
 
 void glVertexAttribI4usv (GLuint index, const GLushort *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribI4usv (index, v);
 }
 
 void glGetUniformuiv (GLuint program, GLint location, GLuint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, params);
 
     return OpenGL::vkglGetUniformuiv (program, location, params);
 }
 
 void glBindFragDataLocation (GLuint program, GLuint color, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, color, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglBindFragDataLocation (program, color, name);
 }
 
 GLint glGetFragDataLocation (GLuint program, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglGetFragDataLocation (program, name);
 }
 
 void glUniform1ui (GLint location, GLuint v0){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0);
 
     return OpenGL::vkglUniform1ui (location, v0);
 }
 
 void glUniform2ui (GLint location, GLuint v0, GLuint v1){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0, v1);
 
     return OpenGL::vkglUniform2ui (location, v0, v1);
 }
 
 void glUniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0, v1, v2);
 
     return OpenGL::vkglUniform3ui (location, v0, v1, v2);
 }
 
 void glUniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, v0, v1, v2, v3);
 
     return OpenGL::vkglUniform4ui (location, v0, v1, v2, v3);
 }
 
 void glUniform1uiv (GLint location, GLsizei count, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 1 * sizeof(*value)));
 
     return OpenGL::vkglUniform1uiv (location, count, value);
 }
 
 void glUniform2uiv (GLint location, GLsizei count, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 2 * sizeof(*value)));
 
     return OpenGL::vkglUniform2uiv (location, count, value);
 }
 
 void glUniform3uiv (GLint location, GLsizei count, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 3 * sizeof(*value)));
 
     return OpenGL::vkglUniform3uiv (location, count, value);
 }
 
 void glUniform4uiv (GLint location, GLsizei count, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 4 * sizeof(*value)));
 
     return OpenGL::vkglUniform4uiv (location, count, value);
 }
 
 void glTexParameterIiv (GLenum target, GLenum pname, const GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
 
     return OpenGL::vkglTexParameterIiv (target, pname, params);
 }
 
 void glTexParameterIuiv (GLenum target, GLenum pname, const GLuint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
 
     return OpenGL::vkglTexParameterIuiv (target, pname, params);
 }
 
 void glGetTexParameterIiv (GLenum target, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     return OpenGL::vkglGetTexParameterIiv (target, pname, params);
 }
 
 void glGetTexParameterIuiv (GLenum target, GLenum pname, GLuint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     return OpenGL::vkglGetTexParameterIuiv (target, pname, params);
 }
 
 void glClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, drawbuffer, OpenGL::GLCaptureBlob(value, ((buffer == GL_COLOR) ? 4 : 1) * sizeof(*value)));
 
     return OpenGL::vkglClearBufferiv (buffer, drawbuffer, value);
 }
 
 void glClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, drawbuffer, OpenGL::GLCaptureBlob(value, ((buffer == GL_COLOR) ? 4 : 1) * sizeof(*value)));
 
     return OpenGL::vkglClearBufferuiv (buffer, drawbuffer, value);
 }
 
 void glClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, drawbuffer, OpenGL::GLCaptureBlob(value, ((buffer == GL_COLOR) ? 4 : 1) * sizeof(*value)));
 
     return OpenGL::vkglClearBufferfv (buffer, drawbuffer, value);
 }
 
 void glClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, drawbuffer, depth, stencil);
 
     return OpenGL::vkglClearBufferfi (buffer, drawbuffer, depth, stencil);
 }
 
 const GLubyte *glGetStringi (GLenum name, GLuint index){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(name, index);
 
     return OpenGL::vkglGetStringi (name, index);
 }
 
 GLboolean glIsRenderbuffer (GLuint renderbuffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(renderbuffer);
 
     return OpenGL::vkglIsRenderbuffer (renderbuffer);
 }
 
 void glBindRenderbuffer (GLenum target, GLuint renderbuffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, renderbuffer);
 
     return OpenGL::vkglBindRenderbuffer (target, renderbuffer);
 }
 
 void glDeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureBlob(renderbuffers, n * sizeof(*renderbuffers)));
 
     return OpenGL::vkglDeleteRenderbuffers (n, renderbuffers);
 }
 
 void glGenRenderbuffers (GLsizei n, GLuint *renderbuffers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(renderbuffers, n * sizeof(*renderbuffers)));
 
     return OpenGL::vkglGenRenderbuffers (n, renderbuffers);
 }
 
 void glRenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, internalformat, width, height);
 
     return OpenGL::vkglRenderbufferStorage (target, internalformat, width, height);
 }
 
 void glGetRenderbufferParameteriv (GLenum target, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     return OpenGL::vkglGetRenderbufferParameteriv (target, pname, params);
 }
 
 GLboolean glIsFramebuffer (GLuint framebuffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer);
 
     return OpenGL::vkglIsFramebuffer (framebuffer);
 }
 
 void glBindFramebuffer (GLenum target, GLuint framebuffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, framebuffer);
 
     return OpenGL::vkglBindFramebuffer (target, framebuffer);
 }
 
 void glDeleteFramebuffers (GLsizei n, const GLuint *framebuffers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureBlob(framebuffers, n * sizeof(*framebuffers)));
 
     return OpenGL::vkglDeleteFramebuffers (n, framebuffers);
 }
 
 void glGenFramebuffers (GLsizei n, GLuint *framebuffers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(framebuffers, n * sizeof(*framebuffers)));
 
     return OpenGL::vkglGenFramebuffers (n, framebuffers);
 }
 
 GLenum glCheckFramebufferStatus (GLenum target){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target);
 
     return OpenGL::vkglCheckFramebufferStatus (target);
 }
 
 void glFramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, attachment, textarget, texture, level);
 
     return OpenGL::vkglFramebufferTexture1D (target, attachment, textarget, texture, level);
 }
 
 void glFramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, attachment, textarget, texture, level);
 
     return OpenGL::vkglFramebufferTexture2D (target, attachment, textarget, texture, level);
 }
 
 void glFramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, attachment, textarget, texture, level, zoffset);
 
     return OpenGL::vkglFramebufferTexture3D (target, attachment, textarget, texture, level, zoffset);
 }
 
 void glFramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, attachment, renderbuffertarget, renderbuffer);
 
     return OpenGL::vkglFramebufferRenderbuffer (target, attachment, renderbuffertarget, renderbuffer);
 }
 
 void glGetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, attachment, pname, params);
 
     return OpenGL::vkglGetFramebufferAttachmentParameteriv (target, attachment, pname, params);
 }
 
 void glGenerateMipmap (GLenum target){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target);
 
     return OpenGL::vkglGenerateMipmap (target);
 }
 
 void glBlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 
     return OpenGL::vkglBlitFramebuffer (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
 void glRenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, samples, internalformat, width, height);
 
     return OpenGL::vkglRenderbufferStorageMultisample (target, samples, internalformat, width, height);
 }
 
 void glFramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, attachment, texture, level, layer);
 
     return OpenGL::vkglFramebufferTextureLayer (target, attachment, texture, level, layer);
 }
 
 void *glMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, offset, length, access);
 
-    return OpenGL::vkglMapBufferRange (target, offset, length, access);
+    return OpenGL::GLCapture::on_buffer_mapped(target,
+                                               length,
+                                               access,
+                                               OpenGL::vkglMapBufferRange (target, offset, length, access) );
 }
 
 void glFlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, offset, length);
 
     return OpenGL::vkglFlushMappedBufferRange (target, offset, length);
 }
 
 void glBindVertexArray (GLuint array){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(array);
 
     
 	GET_CONTEXT(in_context_p)
@@ -6014,18 +6667,21 @@ void glBindVertexArray (GLuint array){
 
 void glDeleteVertexArrays (GLsizei n, const GLuint *arrays){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureBlob(arrays, n * sizeof(*arrays)));
 
     return OpenGL::vkglDeleteVertexArrays (n, arrays);
 }
 
 void glGenVertexArrays (GLsizei n, GLuint *arrays){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(arrays, n * sizeof(*arrays)));
 
     return OpenGL::vkglGenVertexArrays (n, arrays);
 }
 
 GLboolean glIsVertexArray (GLuint array){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(array);
 
     return OpenGL::vkglIsVertexArray (array);
 }
@@ -6037,72 +6693,84 @@ GLboolean glIsVertexArray (GLuint array){
 
 void glDrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, first, count, instancecount);
 
     return OpenGL::vkglDrawArraysInstanced (mode, first, count, instancecount);
 }
 
 void glDrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, count, type, indices, instancecount);
 
     return OpenGL::vkglDrawElementsInstanced (mode, count, type, indices, instancecount);
 }
 
 void glTexBuffer (GLenum target, GLenum internalformat, GLuint buffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, internalformat, buffer);
 
     return OpenGL::vkglTexBuffer (target, internalformat, buffer);
 }
 
 void glPrimitiveRestartIndex (GLuint index){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index);
 
     return OpenGL::vkglPrimitiveRestartIndex (index);
 }
 
 void glCopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(readTarget, writeTarget, readOffset, writeOffset, size);
 
     return OpenGL::vkglCopyBufferSubData (readTarget, writeTarget, readOffset, writeOffset, size);
 }
 
 void glGetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, uniformCount, OpenGL::GLCapturePointerArray(uniformCount, reinterpret_cast<const void* const*>(uniformNames), true), OpenGL::GLCaptureOutput(uniformIndices, uniformCount * sizeof(*uniformIndices)));
 
     return OpenGL::vkglGetUniformIndices (program, uniformCount, uniformNames, uniformIndices);
 }
 
 void glGetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, uniformCount, OpenGL::GLCaptureBlob(uniformIndices, uniformCount * sizeof(*uniformIndices)), pname, OpenGL::GLCaptureOutput(params, uniformCount * sizeof(*params)));
 
     return OpenGL::vkglGetActiveUniformsiv (program, uniformCount, uniformIndices, pname, params);
 }
 
 void glGetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, uniformIndex, bufSize, length, OpenGL::GLCaptureOutput(uniformName, bufSize));
 
     return OpenGL::vkglGetActiveUniformName (program, uniformIndex, bufSize, length, uniformName);
 }
 
 GLuint glGetUniformBlockIndex (GLuint program, const GLchar *uniformBlockName){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, OpenGL::GLCaptureBlob(uniformBlockName, (uniformBlockName != nullptr) ? strlen(uniformBlockName) + 1 : 0));
 
     return OpenGL::vkglGetUniformBlockIndex (program, uniformBlockName);
 }
 
 void glGetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, uniformBlockIndex, pname, params);
 
     return OpenGL::vkglGetActiveUniformBlockiv (program, uniformBlockIndex, pname, params);
 }
 
 void glGetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, uniformBlockIndex, bufSize, length, OpenGL::GLCaptureOutput(uniformBlockName, bufSize));
 
     return OpenGL::vkglGetActiveUniformBlockName (program, uniformBlockIndex, bufSize, length, uniformBlockName);
 }
 
 void glUniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, uniformBlockIndex, uniformBlockBinding);
 
     return OpenGL::vkglUniformBlockBinding (program, uniformBlockIndex, uniformBlockBinding);
 }
@@ -6114,287 +6782,345 @@ void glUniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uni
 
 void glDrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, count, type, indices, basevertex);
 
     return OpenGL::vkglDrawElementsBaseVertex (mode, count, type, indices, basevertex);
 }
 
 void glDrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, start, end, count, type, indices, basevertex);
 
     return OpenGL::vkglDrawRangeElementsBaseVertex (mode, start, end, count, type, indices, basevertex);
 }
 
 void glDrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, count, type, indices, instancecount, basevertex);
 
     return OpenGL::vkglDrawElementsInstancedBaseVertex (mode, count, type, indices, instancecount, basevertex);
 }
 
 void glMultiDrawElementsBaseVertex (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, OpenGL::GLCaptureBlob(count, drawcount * sizeof(*count)), type, OpenGL::GLCapturePointerArray(drawcount, indices, false), drawcount, OpenGL::GLCaptureBlob(basevertex, drawcount * sizeof(*basevertex)));
 
     return OpenGL::vkglMultiDrawElementsBaseVertex (mode, count, type, indices, drawcount, basevertex);
 }
 
 void glProvokingVertex (GLenum mode){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode);
 
     return OpenGL::vkglProvokingVertex (mode);
 }
 
 GLsync glFenceSync (GLenum condition, GLbitfield flags){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(condition, flags);
 
-    return OpenGL::vkglFenceSync (condition, flags);
+    return OpenGL::GLCapture::on_sync_created(OpenGL::vkglFenceSync (condition, flags) );
 }
 
 GLboolean glIsSync (GLsync sync){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sync);
 
     return OpenGL::vkglIsSync (sync);
 }
 
 void glDeleteSync (GLsync sync){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sync);
 
     return OpenGL::vkglDeleteSync (sync);
 }
 
 GLenum glClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sync, flags, timeout);
 
     return OpenGL::vkglClientWaitSync (sync, flags, timeout);
 }
 
 void glWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sync, flags, timeout);
 
     return OpenGL::vkglWaitSync (sync, flags, timeout);
 }
 
 void glGetInteger64v (GLenum pname, GLint64 *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, data);
 
     return OpenGL::vkglGetInteger64v (pname, data);
 }
 
 void glGetSynciv (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sync, pname, bufSize, length, OpenGL::GLCaptureOutput(values, bufSize * sizeof(*values)));
 
     return OpenGL::vkglGetSynciv (sync, pname, bufSize, length, values);
 }
 
 void glGetInteger64i_v (GLenum target, GLuint index, GLint64 *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index, data);
 
     return OpenGL::vkglGetInteger64i_v (target, index, data);
 }
 
 void glGetBufferParameteri64v (GLenum target, GLenum pname, GLint64 *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     return OpenGL::vkglGetBufferParameteri64v (target, pname, params);
 }
 
 void glFramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, attachment, texture, level);
 
     return OpenGL::vkglFramebufferTexture (target, attachment, texture, level);
 }
 
 void glTexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, samples, internalformat, width, height, fixedsamplelocations);
 
     return OpenGL::vkglTexImage2DMultisample (target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
 void glTexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, samples, internalformat, width, height, depth, fixedsamplelocations);
 
     return OpenGL::vkglTexImage3DMultisample (target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
 void glGetMultisamplefv (GLenum pname, GLuint index, GLfloat *val){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, index, val);
 
     return OpenGL::vkglGetMultisamplefv (pname, index, val);
 }
 
 void glSampleMaski (GLuint maskNumber, GLbitfield mask){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(maskNumber, mask);
 
     return OpenGL::vkglSampleMaski (maskNumber, mask);
 }
 
 
+
+// GL_KHR_parallel_shader_compile
+
+void glMaxShaderCompilerThreadsKHR (GLuint count){
+    FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(count);
+
+    return OpenGL::vkglMaxShaderCompilerThreadsKHR (count);
+}
+
+
 /*
 
 // GL_VERSION_3_3
 
 void glBindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, colorNumber, index, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglBindFragDataLocationIndexed (program, colorNumber, index, name);
 }
 
 GLint glGetFragDataIndex (GLuint program, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglGetFragDataIndex (program, name);
 }
 
 void glGenSamplers (GLsizei count, GLuint *samplers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(count, OpenGL::GLCaptureOutput(samplers, count * sizeof(*samplers)));
 
     return OpenGL::vkglGenSamplers (count, samplers);
 }
 
 void glDeleteSamplers (GLsizei count, const GLuint *samplers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(count, OpenGL::GLCaptureBlob(samplers, count * sizeof(*samplers)));
 
     return OpenGL::vkglDeleteSamplers (count, samplers);
 }
 
 GLboolean glIsSampler (GLuint sampler){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sampler);
 
     return OpenGL::vkglIsSampler (sampler);
 }
 
 void glBindSampler (GLuint unit, GLuint sampler){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(unit, sampler);
 
     return OpenGL::vkglBindSampler (unit, sampler);
 }
 
 void glSamplerParameteri (GLuint sampler, GLenum pname, GLint param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sampler, pname, param);
 
     return OpenGL::vkglSamplerParameteri (sampler, pname, param);
 }
 
 void glSamplerParameteriv (GLuint sampler, GLenum pname, const GLint *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sampler, pname, OpenGL::GLCaptureBlob(param, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*param)));
 
     return OpenGL::vkglSamplerParameteriv (sampler, pname, param);
 }
 
 void glSamplerParameterf (GLuint sampler, GLenum pname, GLfloat param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sampler, pname, param);
 
     return OpenGL::vkglSamplerParameterf (sampler, pname, param);
 }
 
 void glSamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sampler, pname, OpenGL::GLCaptureBlob(param, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*param)));
 
     return OpenGL::vkglSamplerParameterfv (sampler, pname, param);
 }
 
 void glSamplerParameterIiv (GLuint sampler, GLenum pname, const GLint *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sampler, pname, OpenGL::GLCaptureBlob(param, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*param)));
 
     return OpenGL::vkglSamplerParameterIiv (sampler, pname, param);
 }
 
 void glSamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sampler, pname, OpenGL::GLCaptureBlob(param, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*param)));
 
     return OpenGL::vkglSamplerParameterIuiv (sampler, pname, param);
 }
 
 void glGetSamplerParameteriv (GLuint sampler, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sampler, pname, params);
 
     return OpenGL::vkglGetSamplerParameteriv (sampler, pname, params);
 }
 
 void glGetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sampler, pname, params);
 
     return OpenGL::vkglGetSamplerParameterIiv (sampler, pname, params);
 }
 
 void glGetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sampler, pname, params);
 
     return OpenGL::vkglGetSamplerParameterfv (sampler, pname, params);
 }
 
 void glGetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(sampler, pname, params);
 
     return OpenGL::vkglGetSamplerParameterIuiv (sampler, pname, params);
 }
 
 void glQueryCounter (GLuint id, GLenum target){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id, target);
 
     return OpenGL::vkglQueryCounter (id, target);
 }
 
 void glGetQueryObjecti64v (GLuint id, GLenum pname, GLint64 *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id, pname, params);
 
     return OpenGL::vkglGetQueryObjecti64v (id, pname, params);
 }
 
 void glGetQueryObjectui64v (GLuint id, GLenum pname, GLuint64 *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id, pname, params);
 
     return OpenGL::vkglGetQueryObjectui64v (id, pname, params);
 }
 
 void glVertexAttribDivisor (GLuint index, GLuint divisor){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, divisor);
 
     return OpenGL::vkglVertexAttribDivisor (index, divisor);
 }
 
 void glVertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, type, normalized, value);
 
     return OpenGL::vkglVertexAttribP1ui (index, type, normalized, value);
 }
 
 void glVertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, type, normalized, OpenGL::GLCaptureBlob(value, 1 * sizeof(*value)));
 
     return OpenGL::vkglVertexAttribP1uiv (index, type, normalized, value);
 }
 
 void glVertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, type, normalized, value);
 
     return OpenGL::vkglVertexAttribP2ui (index, type, normalized, value);
 }
 
 void glVertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, type, normalized, OpenGL::GLCaptureBlob(value, 1 * sizeof(*value)));
 
     return OpenGL::vkglVertexAttribP2uiv (index, type, normalized, value);
 }
 
 void glVertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, type, normalized, value);
 
     return OpenGL::vkglVertexAttribP3ui (index, type, normalized, value);
 }
 
 void glVertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, type, normalized, OpenGL::GLCaptureBlob(value, 1 * sizeof(*value)));
 
     return OpenGL::vkglVertexAttribP3uiv (index, type, normalized, value);
 }
 
 void glVertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, type, normalized, value);
 
     return OpenGL::vkglVertexAttribP4ui (index, type, normalized, value);
 }
 
 void glVertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, type, normalized, OpenGL::GLCaptureBlob(value, 1 * sizeof(*value)));
 
     return OpenGL::vkglVertexAttribP4uiv (index, type, normalized, value);
 }
@@ -6406,276 +7132,322 @@ void glVertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const
 
 void glMinSampleShading (GLfloat value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(value);
 
     return OpenGL::vkglMinSampleShading (value);
 }
 
 void glBlendEquationi (GLuint buf, GLenum mode){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buf, mode);
 
     return OpenGL::vkglBlendEquationi (buf, mode);
 }
 
 void glBlendEquationSeparatei (GLuint buf, GLenum modeRGB, GLenum modeAlpha){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buf, modeRGB, modeAlpha);
 
     return OpenGL::vkglBlendEquationSeparatei (buf, modeRGB, modeAlpha);
 }
 
 void glBlendFunci (GLuint buf, GLenum src, GLenum dst){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buf, src, dst);
 
     return OpenGL::vkglBlendFunci (buf, src, dst);
 }
 
 void glBlendFuncSeparatei (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
 
     return OpenGL::vkglBlendFuncSeparatei (buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
 void glDrawArraysIndirect (GLenum mode, const void *indirect){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, indirect);
 
     return OpenGL::vkglDrawArraysIndirect (mode, indirect);
 }
 
 void glDrawElementsIndirect (GLenum mode, GLenum type, const void *indirect){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, type, indirect);
 
     return OpenGL::vkglDrawElementsIndirect (mode, type, indirect);
 }
 
 void glUniform1d (GLint location, GLdouble x){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, x);
 
     return OpenGL::vkglUniform1d (location, x);
 }
 
 void glUniform2d (GLint location, GLdouble x, GLdouble y){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, x, y);
 
     return OpenGL::vkglUniform2d (location, x, y);
 }
 
 void glUniform3d (GLint location, GLdouble x, GLdouble y, GLdouble z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, x, y, z);
 
     return OpenGL::vkglUniform3d (location, x, y, z);
 }
 
 void glUniform4d (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, x, y, z, w);
 
     return OpenGL::vkglUniform4d (location, x, y, z, w);
 }
 
 void glUniform1dv (GLint location, GLsizei count, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 1 * sizeof(*value)));
 
     return OpenGL::vkglUniform1dv (location, count, value);
 }
 
 void glUniform2dv (GLint location, GLsizei count, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 2 * sizeof(*value)));
 
     return OpenGL::vkglUniform2dv (location, count, value);
 }
 
 void glUniform3dv (GLint location, GLsizei count, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 3 * sizeof(*value)));
 
     return OpenGL::vkglUniform3dv (location, count, value);
 }
 
 void glUniform4dv (GLint location, GLsizei count, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, OpenGL::GLCaptureBlob(value, count * 4 * sizeof(*value)));
 
     return OpenGL::vkglUniform4dv (location, count, value);
 }
 
 void glUniformMatrix2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 2 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix2dv (location, count, transpose, value);
 }
 
 void glUniformMatrix3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 3 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix3dv (location, count, transpose, value);
 }
 
 void glUniformMatrix4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 4 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix4dv (location, count, transpose, value);
 }
 
 void glUniformMatrix2x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 3 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix2x3dv (location, count, transpose, value);
 }
 
 void glUniformMatrix2x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 4 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix2x4dv (location, count, transpose, value);
 }
 
 void glUniformMatrix3x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 2 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix3x2dv (location, count, transpose, value);
 }
 
 void glUniformMatrix3x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 4 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix3x4dv (location, count, transpose, value);
 }
 
 void glUniformMatrix4x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 2 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix4x2dv (location, count, transpose, value);
 }
 
 void glUniformMatrix4x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 3 * sizeof(*value)));
 
     return OpenGL::vkglUniformMatrix4x3dv (location, count, transpose, value);
 }
 
 void glGetUniformdv (GLuint program, GLint location, GLdouble *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, params);
 
     return OpenGL::vkglGetUniformdv (program, location, params);
 }
 
 GLint glGetSubroutineUniformLocation (GLuint program, GLenum shadertype, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, shadertype, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglGetSubroutineUniformLocation (program, shadertype, name);
 }
 
 GLuint glGetSubroutineIndex (GLuint program, GLenum shadertype, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, shadertype, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglGetSubroutineIndex (program, shadertype, name);
 }
 
 void glGetActiveSubroutineUniformiv (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, shadertype, index, pname, values);
 
     return OpenGL::vkglGetActiveSubroutineUniformiv (program, shadertype, index, pname, values);
 }
 
 void glGetActiveSubroutineUniformName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, shadertype, index, bufsize, length, OpenGL::GLCaptureOutput(name, bufsize));
 
     return OpenGL::vkglGetActiveSubroutineUniformName (program, shadertype, index, bufsize, length, name);
 }
 
 void glGetActiveSubroutineName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, shadertype, index, bufsize, length, OpenGL::GLCaptureOutput(name, bufsize));
 
     return OpenGL::vkglGetActiveSubroutineName (program, shadertype, index, bufsize, length, name);
 }
 
 void glUniformSubroutinesuiv (GLenum shadertype, GLsizei count, const GLuint *indices){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(shadertype, count, OpenGL::GLCaptureBlob(indices, count * sizeof(*indices)));
 
     return OpenGL::vkglUniformSubroutinesuiv (shadertype, count, indices);
 }
 
 void glGetUniformSubroutineuiv (GLenum shadertype, GLint location, GLuint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(shadertype, location, params);
 
     return OpenGL::vkglGetUniformSubroutineuiv (shadertype, location, params);
 }
 
 void glGetProgramStageiv (GLuint program, GLenum shadertype, GLenum pname, GLint *values){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, shadertype, pname, values);
 
     return OpenGL::vkglGetProgramStageiv (program, shadertype, pname, values);
 }
 
 void glPatchParameteri (GLenum pname, GLint value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, value);
 
     return OpenGL::vkglPatchParameteri (pname, value);
 }
 
 void glPatchParameterfv (GLenum pname, const GLfloat *values){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pname, OpenGL::GLCaptureBlob(values, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*values)));
 
     return OpenGL::vkglPatchParameterfv (pname, values);
 }
 
 void glBindTransformFeedback (GLenum target, GLuint id){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, id);
 
     return OpenGL::vkglBindTransformFeedback (target, id);
 }
 
 void glDeleteTransformFeedbacks (GLsizei n, const GLuint *ids){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureBlob(ids, n * sizeof(*ids)));
 
     return OpenGL::vkglDeleteTransformFeedbacks (n, ids);
 }
 
 void glGenTransformFeedbacks (GLsizei n, GLuint *ids){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(ids, n * sizeof(*ids)));
 
     return OpenGL::vkglGenTransformFeedbacks (n, ids);
 }
 
 GLboolean glIsTransformFeedback (GLuint id){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id);
 
     return OpenGL::vkglIsTransformFeedback (id);
 }
 
 void glPauseTransformFeedback (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglPauseTransformFeedback (void);
 }
 
 void glResumeTransformFeedback (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglResumeTransformFeedback (void);
 }
 
 void glDrawTransformFeedback (GLenum mode, GLuint id){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, id);
 
     return OpenGL::vkglDrawTransformFeedback (mode, id);
 }
 
 void glDrawTransformFeedbackStream (GLenum mode, GLuint id, GLuint stream){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, id, stream);
 
     return OpenGL::vkglDrawTransformFeedbackStream (mode, id, stream);
 }
 
 void glBeginQueryIndexed (GLenum target, GLuint index, GLuint id){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index, id);
 
     return OpenGL::vkglBeginQueryIndexed (target, index, id);
 }
 
 void glEndQueryIndexed (GLenum target, GLuint index){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index);
 
     return OpenGL::vkglEndQueryIndexed (target, index);
 }
 
 void glGetQueryIndexediv (GLenum target, GLuint index, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index, pname, params);
 
     return OpenGL::vkglGetQueryIndexediv (target, index, pname, params);
 }
@@ -6687,528 +7459,616 @@ void glGetQueryIndexediv (GLenum target, GLuint index, GLenum pname, GLint *para
 
 void glReleaseShaderCompiler (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglReleaseShaderCompiler (void);
 }
 
 void glShaderBinary (GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(count, OpenGL::GLCaptureBlob(shaders, count * sizeof(*shaders)), binaryformat, OpenGL::GLCaptureBlob(binary, static_cast<size_t>(length)), length);
 
     return OpenGL::vkglShaderBinary (count, shaders, binaryformat, binary, length);
 }
 
 void glGetShaderPrecisionFormat (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(shadertype, precisiontype, range, precision);
 
     return OpenGL::vkglGetShaderPrecisionFormat (shadertype, precisiontype, range, precision);
 }
 
 void glDepthRangef (GLfloat n, GLfloat f){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, f);
 
     return OpenGL::vkglDepthRangef (n, f);
 }
 
 void glClearDepthf (GLfloat d){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(d);
 
     return OpenGL::vkglClearDepthf (d);
 }
 
 void glGetProgramBinary (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, bufSize, length, OpenGL::GLCaptureOutput(binaryFormat, bufSize * sizeof(*binaryFormat)), OpenGL::GLCaptureOutput(binary, bufSize));
 
     return OpenGL::vkglGetProgramBinary (program, bufSize, length, binaryFormat, binary);
 }
 
 void glProgramBinary (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, binaryFormat, OpenGL::GLCaptureBlob(binary, static_cast<size_t>(length)), length);
 
     return OpenGL::vkglProgramBinary (program, binaryFormat, binary, length);
 }
 
 void glProgramParameteri (GLuint program, GLenum pname, GLint value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, pname, value);
 
     return OpenGL::vkglProgramParameteri (program, pname, value);
 }
 
 void glUseProgramStages (GLuint pipeline, GLbitfield stages, GLuint program){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pipeline, stages, program);
 
     return OpenGL::vkglUseProgramStages (pipeline, stages, program);
 }
 
 void glActiveShaderProgram (GLuint pipeline, GLuint program){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pipeline, program);
 
     return OpenGL::vkglActiveShaderProgram (pipeline, program);
 }
 
 GLuint glCreateShaderProgramv (GLenum type, GLsizei count, const GLchar *const*strings){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(type, count, OpenGL::GLCapturePointerArray(count, reinterpret_cast<const void* const*>(strings), true));
 
     return OpenGL::vkglCreateShaderProgramv (type, count, strings);
 }
 
 void glBindProgramPipeline (GLuint pipeline){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pipeline);
 
     return OpenGL::vkglBindProgramPipeline (pipeline);
 }
 
 void glDeleteProgramPipelines (GLsizei n, const GLuint *pipelines){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureBlob(pipelines, n * sizeof(*pipelines)));
 
     return OpenGL::vkglDeleteProgramPipelines (n, pipelines);
 }
 
 void glGenProgramPipelines (GLsizei n, GLuint *pipelines){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(pipelines, n * sizeof(*pipelines)));
 
     return OpenGL::vkglGenProgramPipelines (n, pipelines);
 }
 
 GLboolean glIsProgramPipeline (GLuint pipeline){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pipeline);
 
     return OpenGL::vkglIsProgramPipeline (pipeline);
 }
 
 void glGetProgramPipelineiv (GLuint pipeline, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pipeline, pname, params);
 
     return OpenGL::vkglGetProgramPipelineiv (pipeline, pname, params);
 }
 
 void glProgramUniform1i (GLuint program, GLint location, GLint v0){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0);
 
     return OpenGL::vkglProgramUniform1i (program, location, v0);
 }
 
 void glProgramUniform1iv (GLuint program, GLint location, GLsizei count, const GLint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 1 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform1iv (program, location, count, value);
 }
 
 void glProgramUniform1f (GLuint program, GLint location, GLfloat v0){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0);
 
     return OpenGL::vkglProgramUniform1f (program, location, v0);
 }
 
 void glProgramUniform1fv (GLuint program, GLint location, GLsizei count, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 1 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform1fv (program, location, count, value);
 }
 
 void glProgramUniform1d (GLuint program, GLint location, GLdouble v0){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0);
 
     return OpenGL::vkglProgramUniform1d (program, location, v0);
 }
 
 void glProgramUniform1dv (GLuint program, GLint location, GLsizei count, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 1 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform1dv (program, location, count, value);
 }
 
 void glProgramUniform1ui (GLuint program, GLint location, GLuint v0){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0);
 
     return OpenGL::vkglProgramUniform1ui (program, location, v0);
 }
 
 void glProgramUniform1uiv (GLuint program, GLint location, GLsizei count, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 1 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform1uiv (program, location, count, value);
 }
 
 void glProgramUniform2i (GLuint program, GLint location, GLint v0, GLint v1){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1);
 
     return OpenGL::vkglProgramUniform2i (program, location, v0, v1);
 }
 
 void glProgramUniform2iv (GLuint program, GLint location, GLsizei count, const GLint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 2 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform2iv (program, location, count, value);
 }
 
 void glProgramUniform2f (GLuint program, GLint location, GLfloat v0, GLfloat v1){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1);
 
     return OpenGL::vkglProgramUniform2f (program, location, v0, v1);
 }
 
 void glProgramUniform2fv (GLuint program, GLint location, GLsizei count, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 2 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform2fv (program, location, count, value);
 }
 
 void glProgramUniform2d (GLuint program, GLint location, GLdouble v0, GLdouble v1){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1);
 
     return OpenGL::vkglProgramUniform2d (program, location, v0, v1);
 }
 
 void glProgramUniform2dv (GLuint program, GLint location, GLsizei count, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 2 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform2dv (program, location, count, value);
 }
 
 void glProgramUniform2ui (GLuint program, GLint location, GLuint v0, GLuint v1){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1);
 
     return OpenGL::vkglProgramUniform2ui (program, location, v0, v1);
 }
 
 void glProgramUniform2uiv (GLuint program, GLint location, GLsizei count, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 2 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform2uiv (program, location, count, value);
 }
 
 void glProgramUniform3i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1, v2);
 
     return OpenGL::vkglProgramUniform3i (program, location, v0, v1, v2);
 }
 
 void glProgramUniform3iv (GLuint program, GLint location, GLsizei count, const GLint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 3 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform3iv (program, location, count, value);
 }
 
 void glProgramUniform3f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1, v2);
 
     return OpenGL::vkglProgramUniform3f (program, location, v0, v1, v2);
 }
 
 void glProgramUniform3fv (GLuint program, GLint location, GLsizei count, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 3 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform3fv (program, location, count, value);
 }
 
 void glProgramUniform3d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1, v2);
 
     return OpenGL::vkglProgramUniform3d (program, location, v0, v1, v2);
 }
 
 void glProgramUniform3dv (GLuint program, GLint location, GLsizei count, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 3 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform3dv (program, location, count, value);
 }
 
 void glProgramUniform3ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1, v2);
 
     return OpenGL::vkglProgramUniform3ui (program, location, v0, v1, v2);
 }
 
 void glProgramUniform3uiv (GLuint program, GLint location, GLsizei count, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 3 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform3uiv (program, location, count, value);
 }
 
 void glProgramUniform4i (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1, v2, v3);
 
     return OpenGL::vkglProgramUniform4i (program, location, v0, v1, v2, v3);
 }
 
 void glProgramUniform4iv (GLuint program, GLint location, GLsizei count, const GLint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 4 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform4iv (program, location, count, value);
 }
 
 void glProgramUniform4f (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1, v2, v3);
 
     return OpenGL::vkglProgramUniform4f (program, location, v0, v1, v2, v3);
 }
 
 void glProgramUniform4fv (GLuint program, GLint location, GLsizei count, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 4 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform4fv (program, location, count, value);
 }
 
 void glProgramUniform4d (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1, v2, v3);
 
     return OpenGL::vkglProgramUniform4d (program, location, v0, v1, v2, v3);
 }
 
 void glProgramUniform4dv (GLuint program, GLint location, GLsizei count, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 4 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform4dv (program, location, count, value);
 }
 
 void glProgramUniform4ui (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, v0, v1, v2, v3);
 
     return OpenGL::vkglProgramUniform4ui (program, location, v0, v1, v2, v3);
 }
 
 void glProgramUniform4uiv (GLuint program, GLint location, GLsizei count, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, OpenGL::GLCaptureBlob(value, count * 4 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniform4uiv (program, location, count, value);
 }
 
 void glProgramUniformMatrix2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 2 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix2fv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 3 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix3fv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 4 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix4fv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 2 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix2dv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 3 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix3dv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 4 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix4dv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix2x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 3 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix2x3fv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix3x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 2 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix3x2fv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix2x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 4 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix2x4fv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix4x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 2 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix4x2fv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix3x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 4 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix3x4fv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix4x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 3 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix4x3fv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix2x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 3 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix2x3dv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix3x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 2 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix3x2dv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix2x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 2 * 4 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix2x4dv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix4x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 2 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix4x2dv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix3x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 3 * 4 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix3x4dv (program, location, count, transpose, value);
 }
 
 void glProgramUniformMatrix4x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, count, transpose, OpenGL::GLCaptureBlob(value, count * 4 * 3 * sizeof(*value)));
 
     return OpenGL::vkglProgramUniformMatrix4x3dv (program, location, count, transpose, value);
 }
 
 void glValidateProgramPipeline (GLuint pipeline){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pipeline);
 
     return OpenGL::vkglValidateProgramPipeline (pipeline);
 }
 
 void glGetProgramPipelineInfoLog (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(pipeline, bufSize, length, OpenGL::GLCaptureOutput(infoLog, bufSize));
 
     return OpenGL::vkglGetProgramPipelineInfoLog (pipeline, bufSize, length, infoLog);
 }
 
 void glVertexAttribL1d (GLuint index, GLdouble x){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x);
 
     return OpenGL::vkglVertexAttribL1d (index, x);
 }
 
 void glVertexAttribL2d (GLuint index, GLdouble x, GLdouble y){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y);
 
     return OpenGL::vkglVertexAttribL2d (index, x, y);
 }
 
 void glVertexAttribL3d (GLuint index, GLdouble x, GLdouble y, GLdouble z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z);
 
     return OpenGL::vkglVertexAttribL3d (index, x, y, z);
 }
 
 void glVertexAttribL4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, z, w);
 
     return OpenGL::vkglVertexAttribL4d (index, x, y, z, w);
 }
 
 void glVertexAttribL1dv (GLuint index, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 1 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribL1dv (index, v);
 }
 
 void glVertexAttribL2dv (GLuint index, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 2 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribL2dv (index, v);
 }
 
 void glVertexAttribL3dv (GLuint index, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 3 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribL3dv (index, v);
 }
 
 void glVertexAttribL4dv (GLuint index, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglVertexAttribL4dv (index, v);
 }
 
 void glVertexAttribLPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, size, type, stride, pointer);
 
     return OpenGL::vkglVertexAttribLPointer (index, size, type, stride, pointer);
 }
 
 void glGetVertexAttribLdv (GLuint index, GLenum pname, GLdouble *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, pname, params);
 
     return OpenGL::vkglGetVertexAttribLdv (index, pname, params);
 }
 
 void glViewportArrayv (GLuint first, GLsizei count, const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(first, count, OpenGL::GLCaptureBlob(v, count * 4 * sizeof(*v)));
 
     return OpenGL::vkglViewportArrayv (first, count, v);
 }
 
 void glViewportIndexedf (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, x, y, w, h);
 
     return OpenGL::vkglViewportIndexedf (index, x, y, w, h);
 }
 
 void glViewportIndexedfv (GLuint index, const GLfloat *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglViewportIndexedfv (index, v);
 }
 
 void glScissorArrayv (GLuint first, GLsizei count, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(first, count, OpenGL::GLCaptureBlob(v, count * 4 * sizeof(*v)));
 
     return OpenGL::vkglScissorArrayv (first, count, v);
 }
 
 void glScissorIndexed (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, left, bottom, width, height);
 
     return OpenGL::vkglScissorIndexed (index, left, bottom, width, height);
 }
 
 void glScissorIndexedv (GLuint index, const GLint *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, OpenGL::GLCaptureBlob(v, 4 * sizeof(*v)));
 
     return OpenGL::vkglScissorIndexedv (index, v);
 }
 
 void glDepthRangeArrayv (GLuint first, GLsizei count, const GLdouble *v){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(first, count, OpenGL::GLCaptureBlob(v, count * 2 * sizeof(*v)));
 
     return OpenGL::vkglDepthRangeArrayv (first, count, v);
 }
 
 void glDepthRangeIndexed (GLuint index, GLdouble n, GLdouble f){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(index, n, f);
 
     return OpenGL::vkglDepthRangeIndexed (index, n, f);
 }
 
 void glGetFloati_v (GLenum target, GLuint index, GLfloat *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index, data);
 
     return OpenGL::vkglGetFloati_v (target, index, data);
 }
 
 void glGetDoublei_v (GLenum target, GLuint index, GLdouble *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, index, data);
 
     return OpenGL::vkglGetDoublei_v (target, index, data);
 }
@@ -7220,72 +8080,84 @@ void glGetDoublei_v (GLenum target, GLuint index, GLdouble *data){
 
 void glDrawArraysInstancedBaseInstance (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, first, count, instancecount, baseinstance);
 
     return OpenGL::vkglDrawArraysInstancedBaseInstance (mode, first, count, instancecount, baseinstance);
 }
 
 void glDrawElementsInstancedBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, count, type, indices, instancecount, baseinstance);
 
     return OpenGL::vkglDrawElementsInstancedBaseInstance (mode, count, type, indices, instancecount, baseinstance);
 }
 
 void glDrawElementsInstancedBaseVertexBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, count, type, indices, instancecount, basevertex, baseinstance);
 
     return OpenGL::vkglDrawElementsInstancedBaseVertexBaseInstance (mode, count, type, indices, instancecount, basevertex, baseinstance);
 }
 
 void glGetInternalformativ (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, internalformat, pname, bufSize, OpenGL::GLCaptureOutput(params, bufSize * sizeof(*params)));
 
     return OpenGL::vkglGetInternalformativ (target, internalformat, pname, bufSize, params);
 }
 
 void glGetActiveAtomicCounterBufferiv (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, bufferIndex, pname, params);
 
     return OpenGL::vkglGetActiveAtomicCounterBufferiv (program, bufferIndex, pname, params);
 }
 
 void glBindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(unit, texture, level, layered, layer, access, format);
 
     return OpenGL::vkglBindImageTexture (unit, texture, level, layered, layer, access, format);
 }
 
 void glMemoryBarrier (GLbitfield barriers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(barriers);
 
     return OpenGL::vkglMemoryBarrier (barriers);
 }
 
 void glTexStorage1D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, levels, internalformat, width);
 
     return OpenGL::vkglTexStorage1D (target, levels, internalformat, width);
 }
 
 void glTexStorage2D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, levels, internalformat, width, height);
 
     return OpenGL::vkglTexStorage2D (target, levels, internalformat, width, height);
 }
 
 void glTexStorage3D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, levels, internalformat, width, height, depth);
 
     return OpenGL::vkglTexStorage3D (target, levels, internalformat, width, height, depth);
 }
 
 void glDrawTransformFeedbackInstanced (GLenum mode, GLuint id, GLsizei instancecount){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, id, instancecount);
 
     return OpenGL::vkglDrawTransformFeedbackInstanced (mode, id, instancecount);
 }
 
 void glDrawTransformFeedbackStreamInstanced (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, id, stream, instancecount);
 
     return OpenGL::vkglDrawTransformFeedbackStreamInstanced (mode, id, stream, instancecount);
 }
@@ -7297,258 +8169,301 @@ void glDrawTransformFeedbackStreamInstanced (GLenum mode, GLuint id, GLuint stre
 
 void glClearBufferData (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, internalformat, format, type, OpenGL::GLCaptureBlob(data, OpenGL::GLCapture::get_image_size(true, 1, 1, 1, format, type)));
 
     return OpenGL::vkglClearBufferData (target, internalformat, format, type, data);
 }
 
 void glClearBufferSubData (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, internalformat, offset, size, format, type, OpenGL::GLCaptureBlob(data, OpenGL::GLCapture::get_image_size(true, 1, 1, 1, format, type)));
 
     return OpenGL::vkglClearBufferSubData (target, internalformat, offset, size, format, type, data);
 }
 
 void glDispatchCompute (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(num_groups_x, num_groups_y, num_groups_z);
 
     return OpenGL::vkglDispatchCompute (num_groups_x, num_groups_y, num_groups_z);
 }
 
 void glDispatchComputeIndirect (GLintptr indirect){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(indirect);
 
     return OpenGL::vkglDispatchComputeIndirect (indirect);
 }
 
 void glCopyImageSubData (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
 
     return OpenGL::vkglCopyImageSubData (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
 }
 
 void glFramebufferParameteri (GLenum target, GLenum pname, GLint param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, param);
 
     return OpenGL::vkglFramebufferParameteri (target, pname, param);
 }
 
 void glGetFramebufferParameteriv (GLenum target, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, pname, params);
 
     return OpenGL::vkglGetFramebufferParameteriv (target, pname, params);
 }
 
 void glGetInternalformati64v (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, internalformat, pname, bufSize, OpenGL::GLCaptureOutput(params, bufSize * sizeof(*params)));
 
     return OpenGL::vkglGetInternalformati64v (target, internalformat, pname, bufSize, params);
 }
 
 void glInvalidateTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, yoffset, zoffset, width, height, depth);
 
     return OpenGL::vkglInvalidateTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth);
 }
 
 void glInvalidateTexImage (GLuint texture, GLint level){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level);
 
     return OpenGL::vkglInvalidateTexImage (texture, level);
 }
 
 void glInvalidateBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr length){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, offset, length);
 
     return OpenGL::vkglInvalidateBufferSubData (buffer, offset, length);
 }
 
 void glInvalidateBufferData (GLuint buffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer);
 
     return OpenGL::vkglInvalidateBufferData (buffer);
 }
 
 void glInvalidateFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, numAttachments, OpenGL::GLCaptureBlob(attachments, numAttachments * sizeof(*attachments)));
 
     return OpenGL::vkglInvalidateFramebuffer (target, numAttachments, attachments);
 }
 
 void glInvalidateSubFramebuffer (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, numAttachments, OpenGL::GLCaptureBlob(attachments, numAttachments * sizeof(*attachments)), x, y, width, height);
 
     return OpenGL::vkglInvalidateSubFramebuffer (target, numAttachments, attachments, x, y, width, height);
 }
 
 void glMultiDrawArraysIndirect (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, indirect, drawcount, stride);
 
     return OpenGL::vkglMultiDrawArraysIndirect (mode, indirect, drawcount, stride);
 }
 
 void glMultiDrawElementsIndirect (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, type, indirect, drawcount, stride);
 
     return OpenGL::vkglMultiDrawElementsIndirect (mode, type, indirect, drawcount, stride);
 }
 
 void glGetProgramInterfaceiv (GLuint program, GLenum programInterface, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, programInterface, pname, params);
 
     return OpenGL::vkglGetProgramInterfaceiv (program, programInterface, pname, params);
 }
 
 GLuint glGetProgramResourceIndex (GLuint program, GLenum programInterface, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, programInterface, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglGetProgramResourceIndex (program, programInterface, name);
 }
 
 void glGetProgramResourceName (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, programInterface, index, bufSize, length, OpenGL::GLCaptureOutput(name, bufSize));
 
     return OpenGL::vkglGetProgramResourceName (program, programInterface, index, bufSize, length, name);
 }
 
 void glGetProgramResourceiv (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, programInterface, index, propCount, OpenGL::GLCaptureBlob(props, propCount * sizeof(*props)), bufSize, length, OpenGL::GLCaptureOutput(params, bufSize * sizeof(*params)));
 
     return OpenGL::vkglGetProgramResourceiv (program, programInterface, index, propCount, props, bufSize, length, params);
 }
 
 GLint glGetProgramResourceLocation (GLuint program, GLenum programInterface, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, programInterface, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglGetProgramResourceLocation (program, programInterface, name);
 }
 
 GLint glGetProgramResourceLocationIndex (GLuint program, GLenum programInterface, const GLchar *name){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, programInterface, OpenGL::GLCaptureBlob(name, (name != nullptr) ? strlen(name) + 1 : 0));
 
     return OpenGL::vkglGetProgramResourceLocationIndex (program, programInterface, name);
 }
 
 void glShaderStorageBlockBinding (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, storageBlockIndex, storageBlockBinding);
 
     return OpenGL::vkglShaderStorageBlockBinding (program, storageBlockIndex, storageBlockBinding);
 }
 
 void glTexBufferRange (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, internalformat, buffer, offset, size);
 
     return OpenGL::vkglTexBufferRange (target, internalformat, buffer, offset, size);
 }
 
 void glTexStorage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, samples, internalformat, width, height, fixedsamplelocations);
 
     return OpenGL::vkglTexStorage2DMultisample (target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
 void glTexStorage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, samples, internalformat, width, height, depth, fixedsamplelocations);
 
     return OpenGL::vkglTexStorage3DMultisample (target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
 void glTextureView (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
 
     return OpenGL::vkglTextureView (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
 }
 
 void glBindVertexBuffer (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(bindingindex, buffer, offset, stride);
 
     return OpenGL::vkglBindVertexBuffer (bindingindex, buffer, offset, stride);
 }
 
 void glVertexAttribFormat (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(attribindex, size, type, normalized, relativeoffset);
 
     return OpenGL::vkglVertexAttribFormat (attribindex, size, type, normalized, relativeoffset);
 }
 
 void glVertexAttribIFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(attribindex, size, type, relativeoffset);
 
     return OpenGL::vkglVertexAttribIFormat (attribindex, size, type, relativeoffset);
 }
 
 void glVertexAttribLFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(attribindex, size, type, relativeoffset);
 
     return OpenGL::vkglVertexAttribLFormat (attribindex, size, type, relativeoffset);
 }
 
 void glVertexAttribBinding (GLuint attribindex, GLuint bindingindex){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(attribindex, bindingindex);
 
     return OpenGL::vkglVertexAttribBinding (attribindex, bindingindex);
 }
 
 void glVertexBindingDivisor (GLuint bindingindex, GLuint divisor){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(bindingindex, divisor);
 
     return OpenGL::vkglVertexBindingDivisor (bindingindex, divisor);
 }
 
 void glDebugMessageControl (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(source, type, severity, count, OpenGL::GLCaptureBlob(ids, count * sizeof(*ids)), enabled);
 
     return OpenGL::vkglDebugMessageControl (source, type, severity, count, ids, enabled);
 }
 
 void glDebugMessageInsert (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(source, type, id, severity, length, OpenGL::GLCaptureBlob(buf, (buf != nullptr) ? ((length >= 0) ? static_cast<size_t>(length) : strlen(buf) + 1) : 0));
 
     return OpenGL::vkglDebugMessageInsert (source, type, id, severity, length, buf);
 }
 
 void glDebugMessageCallback (GLDEBUGPROC callback, const void *userParam){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(callback, userParam);
 
     return OpenGL::vkglDebugMessageCallback (callback, userParam);
 }
 
 GLuint glGetDebugMessageLog (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(count, bufSize, OpenGL::GLCaptureOutput(sources, count * sizeof(*sources)), OpenGL::GLCaptureOutput(types, count * sizeof(*types)), OpenGL::GLCaptureOutput(ids, count * sizeof(*ids)), OpenGL::GLCaptureOutput(severities, count * sizeof(*severities)), OpenGL::GLCaptureOutput(lengths, count * sizeof(*lengths)), OpenGL::GLCaptureOutput(messageLog, bufSize));
 
     return OpenGL::vkglGetDebugMessageLog (count, bufSize, sources, types, ids, severities, lengths, messageLog);
 }
 
 void glPushDebugGroup (GLenum source, GLuint id, GLsizei length, const GLchar *message){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(source, id, length, OpenGL::GLCaptureBlob(message, (message != nullptr) ? ((length >= 0) ? static_cast<size_t>(length) : strlen(message) + 1) : 0));
 
     return OpenGL::vkglPushDebugGroup (source, id, length, message);
 }
 
 void glPopDebugGroup (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglPopDebugGroup (void);
 }
 
 void glObjectLabel (GLenum identifier, GLuint name, GLsizei length, const GLchar *label){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(identifier, name, length, OpenGL::GLCaptureBlob(label, (label != nullptr) ? ((length >= 0) ? static_cast<size_t>(length) : strlen(label) + 1) : 0));
 
     return OpenGL::vkglObjectLabel (identifier, name, length, label);
 }
 
 void glGetObjectLabel (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(identifier, name, bufSize, length, OpenGL::GLCaptureOutput(label, bufSize));
 
     return OpenGL::vkglGetObjectLabel (identifier, name, bufSize, length, label);
 }
 
 void glObjectPtrLabel (const void *ptr, GLsizei length, const GLchar *label){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(ptr, length, OpenGL::GLCaptureBlob(label, (label != nullptr) ? ((length >= 0) ? static_cast<size_t>(length) : strlen(label) + 1) : 0));
 
     return OpenGL::vkglObjectPtrLabel (ptr, length, label);
 }
 
 void glGetObjectPtrLabel (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(ptr, bufSize, length, OpenGL::GLCaptureOutput(label, bufSize));
 
     return OpenGL::vkglGetObjectPtrLabel (ptr, bufSize, length, label);
 }
@@ -7560,54 +8475,63 @@ void glGetObjectPtrLabel (const void *ptr, GLsizei bufSize, GLsizei *length, GLc
 
 void glBufferStorage (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, size, OpenGL::GLCaptureBlob(data, static_cast<size_t>(size)), flags);
 
     return OpenGL::vkglBufferStorage (target, size, data, flags);
 }
 
 void glClearTexImage (GLuint texture, GLint level, GLenum format, GLenum type, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, format, type, OpenGL::GLCaptureBlob(data, OpenGL::GLCapture::get_image_size(true, 1, 1, 1, format, type)));
 
     return OpenGL::vkglClearTexImage (texture, level, format, type, data);
 }
 
 void glClearTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, OpenGL::GLCaptureBlob(data, OpenGL::GLCapture::get_image_size(true, 1, 1, 1, format, type)));
 
     return OpenGL::vkglClearTexSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
 }
 
 void glBindBuffersBase (GLenum target, GLuint first, GLsizei count, const GLuint *buffers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, first, count, OpenGL::GLCaptureBlob(buffers, count * sizeof(*buffers)));
 
     return OpenGL::vkglBindBuffersBase (target, first, count, buffers);
 }
 
 void glBindBuffersRange (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, first, count, OpenGL::GLCaptureBlob(buffers, count * sizeof(*buffers)), OpenGL::GLCaptureBlob(offsets, count * sizeof(*offsets)), OpenGL::GLCaptureBlob(sizes, count * sizeof(*sizes)));
 
     return OpenGL::vkglBindBuffersRange (target, first, count, buffers, offsets, sizes);
 }
 
 void glBindTextures (GLuint first, GLsizei count, const GLuint *textures){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(first, count, OpenGL::GLCaptureBlob(textures, count * sizeof(*textures)));
 
     return OpenGL::vkglBindTextures (first, count, textures);
 }
 
 void glBindSamplers (GLuint first, GLsizei count, const GLuint *samplers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(first, count, OpenGL::GLCaptureBlob(samplers, count * sizeof(*samplers)));
 
     return OpenGL::vkglBindSamplers (first, count, samplers);
 }
 
 void glBindImageTextures (GLuint first, GLsizei count, const GLuint *textures){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(first, count, OpenGL::GLCaptureBlob(textures, count * sizeof(*textures)));
 
     return OpenGL::vkglBindImageTextures (first, count, textures);
 }
 
 void glBindVertexBuffers (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(first, count, OpenGL::GLCaptureBlob(buffers, count * sizeof(*buffers)), OpenGL::GLCaptureBlob(offsets, count * sizeof(*offsets)), OpenGL::GLCaptureBlob(strides, count * sizeof(*strides)));
 
     return OpenGL::vkglBindVertexBuffers (first, count, buffers, offsets, strides);
 }
@@ -7619,660 +8543,770 @@ void glBindVertexBuffers (GLuint first, GLsizei count, const GLuint *buffers, co
 
 void glClipControl (GLenum origin, GLenum depth){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(origin, depth);
 
     return OpenGL::vkglClipControl (origin, depth);
 }
 
 void glCreateTransformFeedbacks (GLsizei n, GLuint *ids){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(ids, n * sizeof(*ids)));
 
     return OpenGL::vkglCreateTransformFeedbacks (n, ids);
 }
 
 void glTransformFeedbackBufferBase (GLuint xfb, GLuint index, GLuint buffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(xfb, index, buffer);
 
     return OpenGL::vkglTransformFeedbackBufferBase (xfb, index, buffer);
 }
 
 void glTransformFeedbackBufferRange (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(xfb, index, buffer, offset, size);
 
     return OpenGL::vkglTransformFeedbackBufferRange (xfb, index, buffer, offset, size);
 }
 
 void glGetTransformFeedbackiv (GLuint xfb, GLenum pname, GLint *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(xfb, pname, param);
 
     return OpenGL::vkglGetTransformFeedbackiv (xfb, pname, param);
 }
 
 void glGetTransformFeedbacki_v (GLuint xfb, GLenum pname, GLuint index, GLint *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(xfb, pname, index, param);
 
     return OpenGL::vkglGetTransformFeedbacki_v (xfb, pname, index, param);
 }
 
 void glGetTransformFeedbacki64_v (GLuint xfb, GLenum pname, GLuint index, GLint64 *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(xfb, pname, index, param);
 
     return OpenGL::vkglGetTransformFeedbacki64_v (xfb, pname, index, param);
 }
 
 void glCreateBuffers (GLsizei n, GLuint *buffers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(buffers, n * sizeof(*buffers)));
 
     return OpenGL::vkglCreateBuffers (n, buffers);
 }
 
 void glNamedBufferStorage (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, size, OpenGL::GLCaptureBlob(data, static_cast<size_t>(size)), flags);
 
     return OpenGL::vkglNamedBufferStorage (buffer, size, data, flags);
 }
 
 void glNamedBufferData (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, size, OpenGL::GLCaptureBlob(data, static_cast<size_t>(size)), usage);
 
     return OpenGL::vkglNamedBufferData (buffer, size, data, usage);
 }
 
 void glNamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, offset, size, OpenGL::GLCaptureBlob(data, static_cast<size_t>(size)));
 
     return OpenGL::vkglNamedBufferSubData (buffer, offset, size, data);
 }
 
 void glCopyNamedBufferSubData (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(readBuffer, writeBuffer, readOffset, writeOffset, size);
 
     return OpenGL::vkglCopyNamedBufferSubData (readBuffer, writeBuffer, readOffset, writeOffset, size);
 }
 
 void glClearNamedBufferData (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, internalformat, format, type, OpenGL::GLCaptureBlob(data, OpenGL::GLCapture::get_image_size(true, 1, 1, 1, format, type)));
 
     return OpenGL::vkglClearNamedBufferData (buffer, internalformat, format, type, data);
 }
 
 void glClearNamedBufferSubData (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, internalformat, offset, size, format, type, OpenGL::GLCaptureBlob(data, OpenGL::GLCapture::get_image_size(true, 1, 1, 1, format, type)));
 
     return OpenGL::vkglClearNamedBufferSubData (buffer, internalformat, offset, size, format, type, data);
 }
 
 void *glMapNamedBuffer (GLuint buffer, GLenum access){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, access);
 
     return OpenGL::vkglMapNamedBuffer (buffer, access);
 }
 
 void *glMapNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, offset, length, access);
 
     return OpenGL::vkglMapNamedBufferRange (buffer, offset, length, access);
 }
 
 GLboolean glUnmapNamedBuffer (GLuint buffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer);
 
     return OpenGL::vkglUnmapNamedBuffer (buffer);
 }
 
 void glFlushMappedNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, offset, length);
 
     return OpenGL::vkglFlushMappedNamedBufferRange (buffer, offset, length);
 }
 
 void glGetNamedBufferParameteriv (GLuint buffer, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, pname, params);
 
     return OpenGL::vkglGetNamedBufferParameteriv (buffer, pname, params);
 }
 
 void glGetNamedBufferParameteri64v (GLuint buffer, GLenum pname, GLint64 *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, pname, params);
 
     return OpenGL::vkglGetNamedBufferParameteri64v (buffer, pname, params);
 }
 
 void glGetNamedBufferPointerv (GLuint buffer, GLenum pname, void **params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, pname, params);
 
     return OpenGL::vkglGetNamedBufferPointerv (buffer, pname, params);
 }
 
 void glGetNamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(buffer, offset, size, OpenGL::GLCaptureOutput(data, static_cast<size_t>(size)));
 
     return OpenGL::vkglGetNamedBufferSubData (buffer, offset, size, data);
 }
 
 void glCreateFramebuffers (GLsizei n, GLuint *framebuffers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(framebuffers, n * sizeof(*framebuffers)));
 
     return OpenGL::vkglCreateFramebuffers (n, framebuffers);
 }
 
 void glNamedFramebufferRenderbuffer (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, attachment, renderbuffertarget, renderbuffer);
 
     return OpenGL::vkglNamedFramebufferRenderbuffer (framebuffer, attachment, renderbuffertarget, renderbuffer);
 }
 
 void glNamedFramebufferParameteri (GLuint framebuffer, GLenum pname, GLint param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, pname, param);
 
     return OpenGL::vkglNamedFramebufferParameteri (framebuffer, pname, param);
 }
 
 void glNamedFramebufferTexture (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, attachment, texture, level);
 
     return OpenGL::vkglNamedFramebufferTexture (framebuffer, attachment, texture, level);
 }
 
 void glNamedFramebufferTextureLayer (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, attachment, texture, level, layer);
 
     return OpenGL::vkglNamedFramebufferTextureLayer (framebuffer, attachment, texture, level, layer);
 }
 
 void glNamedFramebufferDrawBuffer (GLuint framebuffer, GLenum buf){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, buf);
 
     return OpenGL::vkglNamedFramebufferDrawBuffer (framebuffer, buf);
 }
 
 void glNamedFramebufferDrawBuffers (GLuint framebuffer, GLsizei n, const GLenum *bufs){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, n, OpenGL::GLCaptureBlob(bufs, n * sizeof(*bufs)));
 
     return OpenGL::vkglNamedFramebufferDrawBuffers (framebuffer, n, bufs);
 }
 
 void glNamedFramebufferReadBuffer (GLuint framebuffer, GLenum src){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, src);
 
     return OpenGL::vkglNamedFramebufferReadBuffer (framebuffer, src);
 }
 
 void glInvalidateNamedFramebufferData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, numAttachments, OpenGL::GLCaptureBlob(attachments, numAttachments * sizeof(*attachments)));
 
     return OpenGL::vkglInvalidateNamedFramebufferData (framebuffer, numAttachments, attachments);
 }
 
 void glInvalidateNamedFramebufferSubData (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, numAttachments, OpenGL::GLCaptureBlob(attachments, numAttachments * sizeof(*attachments)), x, y, width, height);
 
     return OpenGL::vkglInvalidateNamedFramebufferSubData (framebuffer, numAttachments, attachments, x, y, width, height);
 }
 
 void glClearNamedFramebufferiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, buffer, drawbuffer, OpenGL::GLCaptureBlob(value, ((buffer == GL_COLOR) ? 4 : 1) * sizeof(*value)));
 
     return OpenGL::vkglClearNamedFramebufferiv (framebuffer, buffer, drawbuffer, value);
 }
 
 void glClearNamedFramebufferuiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, buffer, drawbuffer, OpenGL::GLCaptureBlob(value, ((buffer == GL_COLOR) ? 4 : 1) * sizeof(*value)));
 
     return OpenGL::vkglClearNamedFramebufferuiv (framebuffer, buffer, drawbuffer, value);
 }
 
 void glClearNamedFramebufferfv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, buffer, drawbuffer, OpenGL::GLCaptureBlob(value, ((buffer == GL_COLOR) ? 4 : 1) * sizeof(*value)));
 
     return OpenGL::vkglClearNamedFramebufferfv (framebuffer, buffer, drawbuffer, value);
 }
 
 void glClearNamedFramebufferfi (GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, buffer, drawbuffer, depth, stencil);
 
     return OpenGL::vkglClearNamedFramebufferfi (framebuffer, buffer, drawbuffer, depth, stencil);
 }
 
 void glBlitNamedFramebuffer (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 
     return OpenGL::vkglBlitNamedFramebuffer (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
 GLenum glCheckNamedFramebufferStatus (GLuint framebuffer, GLenum target){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, target);
 
     return OpenGL::vkglCheckNamedFramebufferStatus (framebuffer, target);
 }
 
 void glGetNamedFramebufferParameteriv (GLuint framebuffer, GLenum pname, GLint *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, pname, param);
 
     return OpenGL::vkglGetNamedFramebufferParameteriv (framebuffer, pname, param);
 }
 
 void glGetNamedFramebufferAttachmentParameteriv (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(framebuffer, attachment, pname, params);
 
     return OpenGL::vkglGetNamedFramebufferAttachmentParameteriv (framebuffer, attachment, pname, params);
 }
 
 void glCreateRenderbuffers (GLsizei n, GLuint *renderbuffers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(renderbuffers, n * sizeof(*renderbuffers)));
 
     return OpenGL::vkglCreateRenderbuffers (n, renderbuffers);
 }
 
 void glNamedRenderbufferStorage (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(renderbuffer, internalformat, width, height);
 
     return OpenGL::vkglNamedRenderbufferStorage (renderbuffer, internalformat, width, height);
 }
 
 void glNamedRenderbufferStorageMultisample (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(renderbuffer, samples, internalformat, width, height);
 
     return OpenGL::vkglNamedRenderbufferStorageMultisample (renderbuffer, samples, internalformat, width, height);
 }
 
 void glGetNamedRenderbufferParameteriv (GLuint renderbuffer, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(renderbuffer, pname, params);
 
     return OpenGL::vkglGetNamedRenderbufferParameteriv (renderbuffer, pname, params);
 }
 
 void glCreateTextures (GLenum target, GLsizei n, GLuint *textures){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, n, OpenGL::GLCaptureOutput(textures, n * sizeof(*textures)));
 
     return OpenGL::vkglCreateTextures (target, n, textures);
 }
 
 void glTextureBuffer (GLuint texture, GLenum internalformat, GLuint buffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, internalformat, buffer);
 
     return OpenGL::vkglTextureBuffer (texture, internalformat, buffer);
 }
 
 void glTextureBufferRange (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, internalformat, buffer, offset, size);
 
     return OpenGL::vkglTextureBufferRange (texture, internalformat, buffer, offset, size);
 }
 
 void glTextureStorage1D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, levels, internalformat, width);
 
     return OpenGL::vkglTextureStorage1D (texture, levels, internalformat, width);
 }
 
 void glTextureStorage2D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, levels, internalformat, width, height);
 
     return OpenGL::vkglTextureStorage2D (texture, levels, internalformat, width, height);
 }
 
 void glTextureStorage3D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, levels, internalformat, width, height, depth);
 
     return OpenGL::vkglTextureStorage3D (texture, levels, internalformat, width, height, depth);
 }
 
 void glTextureStorage2DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, samples, internalformat, width, height, fixedsamplelocations);
 
     return OpenGL::vkglTextureStorage2DMultisample (texture, samples, internalformat, width, height, fixedsamplelocations);
 }
 
 void glTextureStorage3DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
 
     return OpenGL::vkglTextureStorage3DMultisample (texture, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
 void glTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, width, format, type, OpenGL::GLCaptureBlob(pixels, OpenGL::GLCapture::get_image_size(true, width, 1, 1, format, type)));
 
     return OpenGL::vkglTextureSubImage1D (texture, level, xoffset, width, format, type, pixels);
 }
 
 void glTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, yoffset, width, height, format, type, OpenGL::GLCaptureBlob(pixels, OpenGL::GLCapture::get_image_size(true, width, height, 1, format, type)));
 
     return OpenGL::vkglTextureSubImage2D (texture, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
 void glTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, OpenGL::GLCaptureBlob(pixels, OpenGL::GLCapture::get_image_size(true, width, height, depth, format, type)));
 
     return OpenGL::vkglTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
 void glCompressedTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, width, format, imageSize, OpenGL::GLCaptureBlob(data, static_cast<size_t>(imageSize)));
 
     return OpenGL::vkglCompressedTextureSubImage1D (texture, level, xoffset, width, format, imageSize, data);
 }
 
 void glCompressedTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, yoffset, width, height, format, imageSize, OpenGL::GLCaptureBlob(data, static_cast<size_t>(imageSize)));
 
     return OpenGL::vkglCompressedTextureSubImage2D (texture, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
 void glCompressedTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, OpenGL::GLCaptureBlob(data, static_cast<size_t>(imageSize)));
 
     return OpenGL::vkglCompressedTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
 void glCopyTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, x, y, width);
 
     return OpenGL::vkglCopyTextureSubImage1D (texture, level, xoffset, x, y, width);
 }
 
 void glCopyTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, yoffset, x, y, width, height);
 
     return OpenGL::vkglCopyTextureSubImage2D (texture, level, xoffset, yoffset, x, y, width, height);
 }
 
 void glCopyTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
 
     return OpenGL::vkglCopyTextureSubImage3D (texture, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
 void glTextureParameterf (GLuint texture, GLenum pname, GLfloat param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, pname, param);
 
     return OpenGL::vkglTextureParameterf (texture, pname, param);
 }
 
 void glTextureParameterfv (GLuint texture, GLenum pname, const GLfloat *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, pname, OpenGL::GLCaptureBlob(param, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*param)));
 
     return OpenGL::vkglTextureParameterfv (texture, pname, param);
 }
 
 void glTextureParameteri (GLuint texture, GLenum pname, GLint param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, pname, param);
 
     return OpenGL::vkglTextureParameteri (texture, pname, param);
 }
 
 void glTextureParameterIiv (GLuint texture, GLenum pname, const GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
 
     return OpenGL::vkglTextureParameterIiv (texture, pname, params);
 }
 
 void glTextureParameterIuiv (GLuint texture, GLenum pname, const GLuint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, pname, OpenGL::GLCaptureBlob(params, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*params)));
 
     return OpenGL::vkglTextureParameterIuiv (texture, pname, params);
 }
 
 void glTextureParameteriv (GLuint texture, GLenum pname, const GLint *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, pname, OpenGL::GLCaptureBlob(param, OpenGL::GLCapture::get_n_pname_values(pname) * sizeof(*param)));
 
     return OpenGL::vkglTextureParameteriv (texture, pname, param);
 }
 
 void glGenerateTextureMipmap (GLuint texture){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture);
 
     return OpenGL::vkglGenerateTextureMipmap (texture);
 }
 
 void glBindTextureUnit (GLuint unit, GLuint texture){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(unit, texture);
 
     return OpenGL::vkglBindTextureUnit (unit, texture);
 }
 
 void glGetTextureImage (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, format, type, bufSize, OpenGL::GLCaptureOutput(pixels, bufSize));
 
     return OpenGL::vkglGetTextureImage (texture, level, format, type, bufSize, pixels);
 }
 
 void glGetCompressedTextureImage (GLuint texture, GLint level, GLsizei bufSize, void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, bufSize, OpenGL::GLCaptureOutput(pixels, bufSize));
 
     return OpenGL::vkglGetCompressedTextureImage (texture, level, bufSize, pixels);
 }
 
 void glGetTextureLevelParameterfv (GLuint texture, GLint level, GLenum pname, GLfloat *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, pname, params);
 
     return OpenGL::vkglGetTextureLevelParameterfv (texture, level, pname, params);
 }
 
 void glGetTextureLevelParameteriv (GLuint texture, GLint level, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, pname, params);
 
     return OpenGL::vkglGetTextureLevelParameteriv (texture, level, pname, params);
 }
 
 void glGetTextureParameterfv (GLuint texture, GLenum pname, GLfloat *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, pname, params);
 
     return OpenGL::vkglGetTextureParameterfv (texture, pname, params);
 }
 
 void glGetTextureParameterIiv (GLuint texture, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, pname, params);
 
     return OpenGL::vkglGetTextureParameterIiv (texture, pname, params);
 }
 
 void glGetTextureParameterIuiv (GLuint texture, GLenum pname, GLuint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, pname, params);
 
     return OpenGL::vkglGetTextureParameterIuiv (texture, pname, params);
 }
 
 void glGetTextureParameteriv (GLuint texture, GLenum pname, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, pname, params);
 
     return OpenGL::vkglGetTextureParameteriv (texture, pname, params);
 }
 
 void glCreateVertexArrays (GLsizei n, GLuint *arrays){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(arrays, n * sizeof(*arrays)));
 
     return OpenGL::vkglCreateVertexArrays (n, arrays);
 }
 
 void glDisableVertexArrayAttrib (GLuint vaobj, GLuint index){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, index);
 
     return OpenGL::vkglDisableVertexArrayAttrib (vaobj, index);
 }
 
 void glEnableVertexArrayAttrib (GLuint vaobj, GLuint index){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, index);
 
     return OpenGL::vkglEnableVertexArrayAttrib (vaobj, index);
 }
 
 void glVertexArrayElementBuffer (GLuint vaobj, GLuint buffer){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, buffer);
 
     return OpenGL::vkglVertexArrayElementBuffer (vaobj, buffer);
 }
 
 void glVertexArrayVertexBuffer (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, bindingindex, buffer, offset, stride);
 
     return OpenGL::vkglVertexArrayVertexBuffer (vaobj, bindingindex, buffer, offset, stride);
 }
 
 void glVertexArrayVertexBuffers (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, first, count, OpenGL::GLCaptureBlob(buffers, count * sizeof(*buffers)), OpenGL::GLCaptureBlob(offsets, count * sizeof(*offsets)), OpenGL::GLCaptureBlob(strides, count * sizeof(*strides)));
 
     return OpenGL::vkglVertexArrayVertexBuffers (vaobj, first, count, buffers, offsets, strides);
 }
 
 void glVertexArrayAttribBinding (GLuint vaobj, GLuint attribindex, GLuint bindingindex){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, attribindex, bindingindex);
 
     return OpenGL::vkglVertexArrayAttribBinding (vaobj, attribindex, bindingindex);
 }
 
 void glVertexArrayAttribFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, attribindex, size, type, normalized, relativeoffset);
 
     return OpenGL::vkglVertexArrayAttribFormat (vaobj, attribindex, size, type, normalized, relativeoffset);
 }
 
 void glVertexArrayAttribIFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, attribindex, size, type, relativeoffset);
 
     return OpenGL::vkglVertexArrayAttribIFormat (vaobj, attribindex, size, type, relativeoffset);
 }
 
 void glVertexArrayAttribLFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, attribindex, size, type, relativeoffset);
 
     return OpenGL::vkglVertexArrayAttribLFormat (vaobj, attribindex, size, type, relativeoffset);
 }
 
 void glVertexArrayBindingDivisor (GLuint vaobj, GLuint bindingindex, GLuint divisor){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, bindingindex, divisor);
 
     return OpenGL::vkglVertexArrayBindingDivisor (vaobj, bindingindex, divisor);
 }
 
 void glGetVertexArrayiv (GLuint vaobj, GLenum pname, GLint *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, pname, param);
 
     return OpenGL::vkglGetVertexArrayiv (vaobj, pname, param);
 }
 
 void glGetVertexArrayIndexediv (GLuint vaobj, GLuint index, GLenum pname, GLint *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, index, pname, param);
 
     return OpenGL::vkglGetVertexArrayIndexediv (vaobj, index, pname, param);
 }
 
 void glGetVertexArrayIndexed64iv (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(vaobj, index, pname, param);
 
     return OpenGL::vkglGetVertexArrayIndexed64iv (vaobj, index, pname, param);
 }
 
 void glCreateSamplers (GLsizei n, GLuint *samplers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(samplers, n * sizeof(*samplers)));
 
     return OpenGL::vkglCreateSamplers (n, samplers);
 }
 
 void glCreateProgramPipelines (GLsizei n, GLuint *pipelines){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(n, OpenGL::GLCaptureOutput(pipelines, n * sizeof(*pipelines)));
 
     return OpenGL::vkglCreateProgramPipelines (n, pipelines);
 }
 
 void glCreateQueries (GLenum target, GLsizei n, GLuint *ids){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, n, OpenGL::GLCaptureOutput(ids, n * sizeof(*ids)));
 
     return OpenGL::vkglCreateQueries (target, n, ids);
 }
 
 void glGetQueryBufferObjecti64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id, buffer, pname, offset);
 
     return OpenGL::vkglGetQueryBufferObjecti64v (id, buffer, pname, offset);
 }
 
 void glGetQueryBufferObjectiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id, buffer, pname, offset);
 
     return OpenGL::vkglGetQueryBufferObjectiv (id, buffer, pname, offset);
 }
 
 void glGetQueryBufferObjectui64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id, buffer, pname, offset);
 
     return OpenGL::vkglGetQueryBufferObjectui64v (id, buffer, pname, offset);
 }
 
 void glGetQueryBufferObjectuiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(id, buffer, pname, offset);
 
     return OpenGL::vkglGetQueryBufferObjectuiv (id, buffer, pname, offset);
 }
 
 void glMemoryBarrierByRegion (GLbitfield barriers){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(barriers);
 
     return OpenGL::vkglMemoryBarrierByRegion (barriers);
 }
 
 void glGetTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, OpenGL::GLCaptureOutput(pixels, bufSize));
 
     return OpenGL::vkglGetTextureSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
 }
 
 void glGetCompressedTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, OpenGL::GLCaptureOutput(pixels, bufSize));
 
     return OpenGL::vkglGetCompressedTextureSubImage (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
 }
 
 GLenum glGetGraphicsResetStatus (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglGetGraphicsResetStatus (void);
 }
 
 void glGetnCompressedTexImage (GLenum target, GLint lod, GLsizei bufSize, void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, lod, bufSize, OpenGL::GLCaptureOutput(pixels, bufSize));
 
     return OpenGL::vkglGetnCompressedTexImage (target, lod, bufSize, pixels);
 }
 
 void glGetnTexImage (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(target, level, format, type, bufSize, OpenGL::GLCaptureOutput(pixels, bufSize));
 
     return OpenGL::vkglGetnTexImage (target, level, format, type, bufSize, pixels);
 }
 
 void glGetnUniformdv (GLuint program, GLint location, GLsizei bufSize, GLdouble *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, bufSize, OpenGL::GLCaptureOutput(params, bufSize * sizeof(*params)));
 
     return OpenGL::vkglGetnUniformdv (program, location, bufSize, params);
 }
 
 void glGetnUniformfv (GLuint program, GLint location, GLsizei bufSize, GLfloat *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, bufSize, OpenGL::GLCaptureOutput(params, bufSize * sizeof(*params)));
 
     return OpenGL::vkglGetnUniformfv (program, location, bufSize, params);
 }
 
 void glGetnUniformiv (GLuint program, GLint location, GLsizei bufSize, GLint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, bufSize, OpenGL::GLCaptureOutput(params, bufSize * sizeof(*params)));
 
     return OpenGL::vkglGetnUniformiv (program, location, bufSize, params);
 }
 
 void glGetnUniformuiv (GLuint program, GLint location, GLsizei bufSize, GLuint *params){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(program, location, bufSize, OpenGL::GLCaptureOutput(params, bufSize * sizeof(*params)));
 
     return OpenGL::vkglGetnUniformuiv (program, location, bufSize, params);
 }
 
 void glReadnPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(x, y, width, height, format, type, bufSize, OpenGL::GLCaptureOutput(data, bufSize));
 
     return OpenGL::vkglReadnPixels (x, y, width, height, format, type, bufSize, data);
 }
 
 void glTextureBarrier (void){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE();
 
     return OpenGL::vkglTextureBarrier (void);
 }
@@ -8284,24 +9318,28 @@ void glTextureBarrier (void){
 
 void glSpecializeShader (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(shader, OpenGL::GLCaptureBlob(pEntryPoint, (pEntryPoint != nullptr) ? strlen(pEntryPoint) + 1 : 0), numSpecializationConstants, OpenGL::GLCaptureBlob(pConstantIndex, numSpecializationConstants * sizeof(*pConstantIndex)), OpenGL::GLCaptureBlob(pConstantValue, numSpecializationConstants * sizeof(*pConstantValue)));
 
     return OpenGL::vkglSpecializeShader (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
 }
 
 void glMultiDrawArraysIndirectCount (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, indirect, drawcount, maxdrawcount, stride);
 
     return OpenGL::vkglMultiDrawArraysIndirectCount (mode, indirect, drawcount, maxdrawcount, stride);
 }
 
 void glMultiDrawElementsIndirectCount (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(mode, type, indirect, drawcount, maxdrawcount, stride);
 
     return OpenGL::vkglMultiDrawElementsIndirectCount (mode, type, indirect, drawcount, maxdrawcount, stride);
 }
 
 void glPolygonOffsetClamp (GLfloat factor, GLfloat units, GLfloat clamp){
     FUN_ENTRY_GLAPI_CALL(DEBUG_DEPTH);
+    VKGL_GL_CAPTURE(factor, units, clamp);
 
     return OpenGL::vkglPolygonOffsetClamp (factor, units, clamp);
 }
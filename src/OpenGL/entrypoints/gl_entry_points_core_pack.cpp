@@ -3717,7 +3717,7 @@ void *OpenGL::vkglMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr len
     FUN_ENTRY(DEBUG_DEPTH);
     GET_CONTEXT(in_context_p)
 
-    const auto access_vkgl = OpenGL::Utils::get_buffer_access_for_gl_enum(   access);
+    const auto access_vkgl = OpenGL::Utils::get_buffer_map_bits_for_gl_enum(   access);
     const auto target_vkgl = OpenGL::Utils::get_buffer_target_for_gl_enum(   target);
 
     return in_context_p->map_buffer_range(target_vkgl,
@@ -4176,6 +4176,17 @@ void OpenGL::vkglSampleMaski (GLuint maskNumber, GLbitfield mask){
 
 
 
+// GL_KHR_parallel_shader_compile
+void OpenGL::vkglMaxShaderCompilerThreadsKHR (GLuint count){
+    FUN_ENTRY(DEBUG_DEPTH);
+    GET_CONTEXT(in_context_p)
+
+    in_context_p->set_max_shader_compiler_threads(   count);
+
+}
+
+
+
 /*
 // GL_VERSION_3_3
 void OpenGL::vkglBindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name){
@@ -0,0 +1,1454 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "OpenGL/entrypoints/gl_replayer.h"
+#include "OpenGL/backend/vk_backend.h"
+#include "OpenGL/context.h"
+#include "Common/logger.h"
+#include "Common/macros.h"
+#include "Common/tls.h"
+#include <algorithm>
+#include <chrono>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <tuple>
+#include <type_traits>
+#include <unistd.h>
+
+namespace
+{
+    /* Stands in for the window system during replay. The default framebuffer is provided by headless mode. */
+    class ReplayWSIContext : public VKGL::IWSIContext
+    {
+    public:
+        ReplayWSIContext()
+            :m_height           (0),
+             m_is_debug         (false),
+             m_is_fwd_compatible(false),
+             m_major_version    (4),
+             m_minor_version    (5),
+             m_n_layer_plane    (0),
+             m_pixel_format_reqs(8,  /* in_n_alpha_bits   */
+                                 8,  /* in_n_blue_bits    */
+                                 24, /* in_n_depth_bits   */
+                                 8,  /* in_n_green_bits   */
+                                 8,  /* in_n_red_bits     */
+                                 8), /* in_n_stencil_bits */
+             m_swap_interval    (0),
+             m_width            (0)
+        {
+            const char* headless_env_ptr = getenv("VKGL_HEADLESS");
+
+            if (headless_env_ptr                             == nullptr ||
+                sscanf(headless_env_ptr, "%ux%u", &m_width, &m_height) != 2)
+            {
+                m_height = 0;
+                m_width  = 0;
+            }
+        }
+
+        const uint32_t&                      get_major_version            () const final { return m_major_version;     }
+        const uint32_t&                      get_minor_version            () const final { return m_minor_version;     }
+        const uint32_t&                      get_n_layer_plane            () const final { return m_n_layer_plane;     }
+        const VKGL::PixelFormatRequirements& get_pixel_format_requirements() const final { return m_pixel_format_reqs; }
+        const int&                           get_swap_interval            () const final { return m_swap_interval;     }
+        const bool&                          is_debug_context             () const final { return m_is_debug;          }
+        const bool&                          is_forward_compatible_context() const final { return m_is_fwd_compatible; }
+
+        void get_rendering_surface_size(uint32_t* out_width_ptr,
+                                        uint32_t* out_height_ptr) const final
+        {
+            *out_height_ptr = m_height;
+            *out_width_ptr  = m_width;
+        }
+
+        bool is_headless() const
+        {
+            return (m_width != 0 && m_height != 0);
+        }
+
+    private:
+        uint32_t                      m_height;
+        bool                          m_is_debug;
+        bool                          m_is_fwd_compatible;
+        uint32_t                      m_major_version;
+        uint32_t                      m_minor_version;
+        uint32_t                      m_n_layer_plane;
+        VKGL::PixelFormatRequirements m_pixel_format_reqs;
+        int                           m_swap_interval;
+        uint32_t                      m_width;
+    };
+
+    double get_thread_cpu_time_ms()
+    {
+        timespec time;
+
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID,
+                     &time);
+
+        return static_cast<double>(time.tv_sec) * 1000.0 + static_cast<double>(time.tv_nsec) / 1000000.0;
+    }
+
+    const uint8_t* align_8(const uint8_t* in_ptr)
+    {
+        return reinterpret_cast<const uint8_t*>((reinterpret_cast<uintptr_t>(in_ptr) + 7) & ~static_cast<uintptr_t>(7) );
+    }
+
+    uint32_t get_padded_chunk_size(const uint32_t& in_n_bytes)
+    {
+        return (in_n_bytes + 7) & ~7u;
+    }
+}
+
+
+OpenGL::GLReplayer::GLReplayer()
+    :m_data_ptr              (nullptr),
+     m_file_size             (0),
+     m_mapping_ptr           (nullptr),
+     m_n_frames              (0),
+     m_replayed              (false),
+     m_n_scratch_buffers_used(0),
+     m_last_returned_ptr     (nullptr),
+     m_last_returned_sync    (nullptr)
+{
+    /* Stub */
+}
+
+OpenGL::GLReplayer::~GLReplayer()
+{
+    if (m_mapping_ptr != nullptr)
+    {
+        munmap(m_mapping_ptr,
+               m_file_size);
+    }
+}
+
+void* OpenGL::GLReplayer::alloc_scratch(const uint32_t& in_n_bytes)
+{
+    if (m_n_scratch_buffers_used == m_scratch_buffers.size() )
+    {
+        m_scratch_buffers.emplace_back();
+    }
+
+    auto& buffer = m_scratch_buffers.at(m_n_scratch_buffers_used++);
+
+    /* Never hand out a null pointer, even for empty outputs. */
+    if (buffer.size() < std::max(in_n_bytes, 1u) )
+    {
+        buffer.resize(std::max(in_n_bytes, 1u) );
+    }
+
+    return buffer.data();
+}
+
+OpenGL::GLReplayerUniquePtr OpenGL::GLReplayer::create(const char* in_file_name)
+{
+    GLReplayerUniquePtr result_ptr(new GLReplayer() );
+
+    if (!result_ptr->init(in_file_name) )
+    {
+        result_ptr.reset();
+    }
+
+    return result_ptr;
+}
+
+void* OpenGL::GLReplayer::decode_pointer()
+{
+    const auto kind       = read_value<GLCapturePointerKind>();
+    void*      result_ptr = nullptr;
+
+    switch (kind)
+    {
+        case GLCapturePointerKind::Value:
+        {
+            result_ptr = reinterpret_cast<void*>(static_cast<uintptr_t>(read_value<uint64_t>() ));
+
+            break;
+        }
+
+        case GLCapturePointerKind::Blob:
+        {
+            const auto n_bytes = read_value<uint32_t>();
+
+            m_data_ptr = align_8(m_data_ptr);
+            result_ptr = const_cast<uint8_t*>(m_data_ptr);
+
+            m_data_ptr += n_bytes;
+
+            break;
+        }
+
+        case GLCapturePointerKind::Output:
+        {
+            result_ptr = alloc_scratch(read_value<uint32_t>() );
+
+            break;
+        }
+
+        case GLCapturePointerKind::Array:
+        {
+            const auto   n_items   = read_value<uint32_t>();
+            const void** items_ptr = static_cast<const void**>(alloc_scratch(static_cast<uint32_t>(n_items * sizeof(void*) )));
+
+            for (uint32_t n_item = 0;
+                          n_item < n_items;
+                        ++n_item)
+            {
+                items_ptr[n_item] = decode_pointer();
+            }
+
+            result_ptr = items_ptr;
+
+            break;
+        }
+
+        default:
+        {
+            vkgl_assert_fail();
+        }
+    }
+
+    return result_ptr;
+}
+
+template<typename T>
+T OpenGL::GLReplayer::decode_arg()
+{
+    if constexpr (std::is_same<T, GLsync>::value)
+    {
+        read_value<GLCapturePointerKind>();
+
+        const auto handle        = read_value<uint64_t>();
+        const auto sync_iterator = m_sync_objects.find(handle);
+
+        return (sync_iterator != m_sync_objects.end() ) ? sync_iterator->second
+                                                        : nullptr;
+    }
+    else
+    if constexpr (std::is_pointer<T>::value)
+    {
+        void* ptr = decode_pointer();
+
+        if constexpr (std::is_function<typename std::remove_pointer<T>::type>::value)
+        {
+            /* App callbacks do not exist at replay time. */
+            (void) ptr;
+
+            return nullptr;
+        }
+        else
+        {
+            return static_cast<T>(ptr);
+        }
+    }
+    else
+    {
+        return read_value<T>();
+    }
+}
+
+const OpenGL::GLReplayer::EntryPoint* OpenGL::GLReplayer::get_entry_point(const char* in_name)
+{
+    #define VKGL_REPLAY_ENTRY_POINT(name)            {#name, &OpenGL::GLReplayer::replay_call<&name>, false}
+    #define VKGL_REPLAY_BUFFER_MAP_ENTRY_POINT(name) {#name, &OpenGL::GLReplayer::replay_call<&name>, true}
+
+    /* Sorted by name. */
+    static const EntryPoint entry_points[] =
+    {
+        VKGL_REPLAY_ENTRY_POINT(glAccum),
+        VKGL_REPLAY_ENTRY_POINT(glActiveTexture),
+        VKGL_REPLAY_ENTRY_POINT(glAlphaFunc),
+        VKGL_REPLAY_ENTRY_POINT(glAreTexturesResident),
+        VKGL_REPLAY_ENTRY_POINT(glArrayElement),
+        VKGL_REPLAY_ENTRY_POINT(glAttachShader),
+        VKGL_REPLAY_ENTRY_POINT(glBegin),
+        VKGL_REPLAY_ENTRY_POINT(glBeginConditionalRender),
+        VKGL_REPLAY_ENTRY_POINT(glBeginQuery),
+        VKGL_REPLAY_ENTRY_POINT(glBeginTransformFeedback),
+        VKGL_REPLAY_ENTRY_POINT(glBindAttribLocation),
+        VKGL_REPLAY_ENTRY_POINT(glBindBuffer),
+        VKGL_REPLAY_ENTRY_POINT(glBindBufferBase),
+        VKGL_REPLAY_ENTRY_POINT(glBindBufferRange),
+        VKGL_REPLAY_ENTRY_POINT(glBindFragDataLocation),
+        VKGL_REPLAY_ENTRY_POINT(glBindFramebuffer),
+        VKGL_REPLAY_ENTRY_POINT(glBindRenderbuffer),
+        VKGL_REPLAY_ENTRY_POINT(glBindTexture),
+        VKGL_REPLAY_ENTRY_POINT(glBindVertexArray),
+        VKGL_REPLAY_ENTRY_POINT(glBitmap),
+        VKGL_REPLAY_ENTRY_POINT(glBlendColor),
+        VKGL_REPLAY_ENTRY_POINT(glBlendEquation),
+        VKGL_REPLAY_ENTRY_POINT(glBlendEquationSeparate),
+        VKGL_REPLAY_ENTRY_POINT(glBlendFunc),
+        VKGL_REPLAY_ENTRY_POINT(glBlendFuncSeparate),
+        VKGL_REPLAY_ENTRY_POINT(glBlitFramebuffer),
+        VKGL_REPLAY_ENTRY_POINT(glBufferData),
+        VKGL_REPLAY_ENTRY_POINT(glBufferSubData),
+        VKGL_REPLAY_ENTRY_POINT(glCallList),
+        VKGL_REPLAY_ENTRY_POINT(glCallLists),
+        VKGL_REPLAY_ENTRY_POINT(glCheckFramebufferStatus),
+        VKGL_REPLAY_ENTRY_POINT(glClampColor),
+        VKGL_REPLAY_ENTRY_POINT(glClear),
+        VKGL_REPLAY_ENTRY_POINT(glClearAccum),
+        VKGL_REPLAY_ENTRY_POINT(glClearBufferfi),
+        VKGL_REPLAY_ENTRY_POINT(glClearBufferfv),
+        VKGL_REPLAY_ENTRY_POINT(glClearBufferiv),
+        VKGL_REPLAY_ENTRY_POINT(glClearBufferuiv),
+        VKGL_REPLAY_ENTRY_POINT(glClearColor),
+        VKGL_REPLAY_ENTRY_POINT(glClearDepth),
+        VKGL_REPLAY_ENTRY_POINT(glClearIndex),
+        VKGL_REPLAY_ENTRY_POINT(glClearStencil),
+        VKGL_REPLAY_ENTRY_POINT(glClientActiveTexture),
+        VKGL_REPLAY_ENTRY_POINT(glClientWaitSync),
+        VKGL_REPLAY_ENTRY_POINT(glClipPlane),
+        VKGL_REPLAY_ENTRY_POINT(glColor3b),
+        VKGL_REPLAY_ENTRY_POINT(glColor3bv),
+        VKGL_REPLAY_ENTRY_POINT(glColor3d),
+        VKGL_REPLAY_ENTRY_POINT(glColor3dv),
+        VKGL_REPLAY_ENTRY_POINT(glColor3f),
+        VKGL_REPLAY_ENTRY_POINT(glColor3fv),
+        VKGL_REPLAY_ENTRY_POINT(glColor3i),
+        VKGL_REPLAY_ENTRY_POINT(glColor3iv),
+        VKGL_REPLAY_ENTRY_POINT(glColor3s),
+        VKGL_REPLAY_ENTRY_POINT(glColor3sv),
+        VKGL_REPLAY_ENTRY_POINT(glColor3ub),
+        VKGL_REPLAY_ENTRY_POINT(glColor3ubv),
+        VKGL_REPLAY_ENTRY_POINT(glColor3ui),
+        VKGL_REPLAY_ENTRY_POINT(glColor3uiv),
+        VKGL_REPLAY_ENTRY_POINT(glColor3us),
+        VKGL_REPLAY_ENTRY_POINT(glColor3usv),
+        VKGL_REPLAY_ENTRY_POINT(glColor4b),
+        VKGL_REPLAY_ENTRY_POINT(glColor4bv),
+        VKGL_REPLAY_ENTRY_POINT(glColor4d),
+        VKGL_REPLAY_ENTRY_POINT(glColor4dv),
+        VKGL_REPLAY_ENTRY_POINT(glColor4f),
+        VKGL_REPLAY_ENTRY_POINT(glColor4fv),
+        VKGL_REPLAY_ENTRY_POINT(glColor4i),
+        VKGL_REPLAY_ENTRY_POINT(glColor4iv),
+        VKGL_REPLAY_ENTRY_POINT(glColor4s),
+        VKGL_REPLAY_ENTRY_POINT(glColor4sv),
+        VKGL_REPLAY_ENTRY_POINT(glColor4ub),
+        VKGL_REPLAY_ENTRY_POINT(glColor4ubv),
+        VKGL_REPLAY_ENTRY_POINT(glColor4ui),
+        VKGL_REPLAY_ENTRY_POINT(glColor4uiv),
+        VKGL_REPLAY_ENTRY_POINT(glColor4us),
+        VKGL_REPLAY_ENTRY_POINT(glColor4usv),
+        VKGL_REPLAY_ENTRY_POINT(glColorMask),
+        VKGL_REPLAY_ENTRY_POINT(glColorMaski),
+        VKGL_REPLAY_ENTRY_POINT(glColorMaterial),
+        VKGL_REPLAY_ENTRY_POINT(glColorPointer),
+        VKGL_REPLAY_ENTRY_POINT(glCompileShader),
+        VKGL_REPLAY_ENTRY_POINT(glCompressedTexImage1D),
+        VKGL_REPLAY_ENTRY_POINT(glCompressedTexImage2D),
+        VKGL_REPLAY_ENTRY_POINT(glCompressedTexImage3D),
+        VKGL_REPLAY_ENTRY_POINT(glCompressedTexSubImage1D),
+        VKGL_REPLAY_ENTRY_POINT(glCompressedTexSubImage2D),
+        VKGL_REPLAY_ENTRY_POINT(glCompressedTexSubImage3D),
+        VKGL_REPLAY_ENTRY_POINT(glCopyBufferSubData),
+        VKGL_REPLAY_ENTRY_POINT(glCopyPixels),
+        VKGL_REPLAY_ENTRY_POINT(glCopyTexImage1D),
+        VKGL_REPLAY_ENTRY_POINT(glCopyTexImage2D),
+        VKGL_REPLAY_ENTRY_POINT(glCopyTexSubImage1D),
+        VKGL_REPLAY_ENTRY_POINT(glCopyTexSubImage2D),
+        VKGL_REPLAY_ENTRY_POINT(glCopyTexSubImage3D),
+        VKGL_REPLAY_ENTRY_POINT(glCreateProgram),
+        VKGL_REPLAY_ENTRY_POINT(glCreateShader),
+        VKGL_REPLAY_ENTRY_POINT(glCullFace),
+        VKGL_REPLAY_ENTRY_POINT(glDeleteBuffers),
+        VKGL_REPLAY_ENTRY_POINT(glDeleteFramebuffers),
+        VKGL_REPLAY_ENTRY_POINT(glDeleteLists),
+        VKGL_REPLAY_ENTRY_POINT(glDeleteProgram),
+        VKGL_REPLAY_ENTRY_POINT(glDeleteQueries),
+        VKGL_REPLAY_ENTRY_POINT(glDeleteRenderbuffers),
+        VKGL_REPLAY_ENTRY_POINT(glDeleteShader),
+        VKGL_REPLAY_ENTRY_POINT(glDeleteSync),
+        VKGL_REPLAY_ENTRY_POINT(glDeleteTextures),
+        VKGL_REPLAY_ENTRY_POINT(glDeleteVertexArrays),
+        VKGL_REPLAY_ENTRY_POINT(glDepthFunc),
+        VKGL_REPLAY_ENTRY_POINT(glDepthMask),
+        VKGL_REPLAY_ENTRY_POINT(glDepthRange),
+        VKGL_REPLAY_ENTRY_POINT(glDetachShader),
+        VKGL_REPLAY_ENTRY_POINT(glDisable),
+        VKGL_REPLAY_ENTRY_POINT(glDisableClientState),
+        VKGL_REPLAY_ENTRY_POINT(glDisableVertexAttribArray),
+        VKGL_REPLAY_ENTRY_POINT(glDisablei),
+        VKGL_REPLAY_ENTRY_POINT(glDrawArrays),
+        VKGL_REPLAY_ENTRY_POINT(glDrawArraysInstanced),
+        VKGL_REPLAY_ENTRY_POINT(glDrawBuffer),
+        VKGL_REPLAY_ENTRY_POINT(glDrawBuffers),
+        VKGL_REPLAY_ENTRY_POINT(glDrawElements),
+        VKGL_REPLAY_ENTRY_POINT(glDrawElementsBaseVertex),
+        VKGL_REPLAY_ENTRY_POINT(glDrawElementsInstanced),
+        VKGL_REPLAY_ENTRY_POINT(glDrawElementsInstancedBaseVertex),
+        VKGL_REPLAY_ENTRY_POINT(glDrawPixels),
+        VKGL_REPLAY_ENTRY_POINT(glDrawRangeElements),
+        VKGL_REPLAY_ENTRY_POINT(glDrawRangeElementsBaseVertex),
+        VKGL_REPLAY_ENTRY_POINT(glEdgeFlag),
+        VKGL_REPLAY_ENTRY_POINT(glEdgeFlagPointer),
+        VKGL_REPLAY_ENTRY_POINT(glEdgeFlagv),
+        VKGL_REPLAY_ENTRY_POINT(glEnable),
+        VKGL_REPLAY_ENTRY_POINT(glEnableClientState),
+        VKGL_REPLAY_ENTRY_POINT(glEnableVertexAttribArray),
+        VKGL_REPLAY_ENTRY_POINT(glEnablei),
+        VKGL_REPLAY_ENTRY_POINT(glEnd),
+        VKGL_REPLAY_ENTRY_POINT(glEndConditionalRender),
+        VKGL_REPLAY_ENTRY_POINT(glEndList),
+        VKGL_REPLAY_ENTRY_POINT(glEndQuery),
+        VKGL_REPLAY_ENTRY_POINT(glEndTransformFeedback),
+        VKGL_REPLAY_ENTRY_POINT(glEvalCoord1d),
+        VKGL_REPLAY_ENTRY_POINT(glEvalCoord1dv),
+        VKGL_REPLAY_ENTRY_POINT(glEvalCoord1f),
+        VKGL_REPLAY_ENTRY_POINT(glEvalCoord1fv),
+        VKGL_REPLAY_ENTRY_POINT(glEvalCoord2d),
+        VKGL_REPLAY_ENTRY_POINT(glEvalCoord2dv),
+        VKGL_REPLAY_ENTRY_POINT(glEvalCoord2f),
+        VKGL_REPLAY_ENTRY_POINT(glEvalCoord2fv),
+        VKGL_REPLAY_ENTRY_POINT(glEvalMesh1),
+        VKGL_REPLAY_ENTRY_POINT(glEvalMesh2),
+        VKGL_REPLAY_ENTRY_POINT(glEvalPoint1),
+        VKGL_REPLAY_ENTRY_POINT(glEvalPoint2),
+        VKGL_REPLAY_ENTRY_POINT(glFeedbackBuffer),
+        VKGL_REPLAY_ENTRY_POINT(glFenceSync),
+        VKGL_REPLAY_ENTRY_POINT(glFinish),
+        VKGL_REPLAY_ENTRY_POINT(glFlush),
+        VKGL_REPLAY_ENTRY_POINT(glFlushMappedBufferRange),
+        VKGL_REPLAY_ENTRY_POINT(glFogCoordPointer),
+        VKGL_REPLAY_ENTRY_POINT(glFogCoordd),
+        VKGL_REPLAY_ENTRY_POINT(glFogCoorddv),
+        VKGL_REPLAY_ENTRY_POINT(glFogCoordf),
+        VKGL_REPLAY_ENTRY_POINT(glFogCoordfv),
+        VKGL_REPLAY_ENTRY_POINT(glFogf),
+        VKGL_REPLAY_ENTRY_POINT(glFogfv),
+        VKGL_REPLAY_ENTRY_POINT(glFogi),
+        VKGL_REPLAY_ENTRY_POINT(glFogiv),
+        VKGL_REPLAY_ENTRY_POINT(glFramebufferRenderbuffer),
+        VKGL_REPLAY_ENTRY_POINT(glFramebufferTexture),
+        VKGL_REPLAY_ENTRY_POINT(glFramebufferTexture1D),
+        VKGL_REPLAY_ENTRY_POINT(glFramebufferTexture2D),
+        VKGL_REPLAY_ENTRY_POINT(glFramebufferTexture3D),
+        VKGL_REPLAY_ENTRY_POINT(glFramebufferTextureLayer),
+        VKGL_REPLAY_ENTRY_POINT(glFrontFace),
+        VKGL_REPLAY_ENTRY_POINT(glFrustum),
+        VKGL_REPLAY_ENTRY_POINT(glGenBuffers),
+        VKGL_REPLAY_ENTRY_POINT(glGenFramebuffers),
+        VKGL_REPLAY_ENTRY_POINT(glGenLists),
+        VKGL_REPLAY_ENTRY_POINT(glGenQueries),
+        VKGL_REPLAY_ENTRY_POINT(glGenRenderbuffers),
+        VKGL_REPLAY_ENTRY_POINT(glGenTextures),
+        VKGL_REPLAY_ENTRY_POINT(glGenVertexArrays),
+        VKGL_REPLAY_ENTRY_POINT(glGenerateMipmap),
+        VKGL_REPLAY_ENTRY_POINT(glGetActiveAttrib),
+        VKGL_REPLAY_ENTRY_POINT(glGetActiveUniform),
+        VKGL_REPLAY_ENTRY_POINT(glGetActiveUniformBlockName),
+        VKGL_REPLAY_ENTRY_POINT(glGetActiveUniformBlockiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetActiveUniformName),
+        VKGL_REPLAY_ENTRY_POINT(glGetActiveUniformsiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetAttachedShaders),
+        VKGL_REPLAY_ENTRY_POINT(glGetAttribLocation),
+        VKGL_REPLAY_ENTRY_POINT(glGetBooleani_v),
+        VKGL_REPLAY_ENTRY_POINT(glGetBooleanv),
+        VKGL_REPLAY_ENTRY_POINT(glGetBufferParameteri64v),
+        VKGL_REPLAY_ENTRY_POINT(glGetBufferParameteriv),
+        VKGL_REPLAY_ENTRY_POINT(glGetBufferPointerv),
+        VKGL_REPLAY_ENTRY_POINT(glGetBufferSubData),
+        VKGL_REPLAY_ENTRY_POINT(glGetClipPlane),
+        VKGL_REPLAY_ENTRY_POINT(glGetCompressedTexImage),
+        VKGL_REPLAY_ENTRY_POINT(glGetDoublev),
+        VKGL_REPLAY_ENTRY_POINT(glGetError),
+        VKGL_REPLAY_ENTRY_POINT(glGetFloatv),
+        VKGL_REPLAY_ENTRY_POINT(glGetFragDataLocation),
+        VKGL_REPLAY_ENTRY_POINT(glGetFramebufferAttachmentParameteriv),
+        VKGL_REPLAY_ENTRY_POINT(glGetInteger64i_v),
+        VKGL_REPLAY_ENTRY_POINT(glGetInteger64v),
+        VKGL_REPLAY_ENTRY_POINT(glGetIntegeri_v),
+        VKGL_REPLAY_ENTRY_POINT(glGetIntegerv),
+        VKGL_REPLAY_ENTRY_POINT(glGetLightfv),
+        VKGL_REPLAY_ENTRY_POINT(glGetLightiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetMapdv),
+        VKGL_REPLAY_ENTRY_POINT(glGetMapfv),
+        VKGL_REPLAY_ENTRY_POINT(glGetMapiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetMaterialfv),
+        VKGL_REPLAY_ENTRY_POINT(glGetMaterialiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetMultisamplefv),
+        VKGL_REPLAY_ENTRY_POINT(glGetPixelMapfv),
+        VKGL_REPLAY_ENTRY_POINT(glGetPixelMapuiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetPixelMapusv),
+        VKGL_REPLAY_ENTRY_POINT(glGetPointerv),
+        VKGL_REPLAY_ENTRY_POINT(glGetPolygonStipple),
+        VKGL_REPLAY_ENTRY_POINT(glGetProgramInfoLog),
+        VKGL_REPLAY_ENTRY_POINT(glGetProgramiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetQueryObjectiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetQueryObjectuiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetQueryiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetRenderbufferParameteriv),
+        VKGL_REPLAY_ENTRY_POINT(glGetShaderInfoLog),
+        VKGL_REPLAY_ENTRY_POINT(glGetShaderSource),
+        VKGL_REPLAY_ENTRY_POINT(glGetShaderiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetString),
+        VKGL_REPLAY_ENTRY_POINT(glGetStringi),
+        VKGL_REPLAY_ENTRY_POINT(glGetSynciv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexEnvfv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexEnviv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexGendv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexGenfv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexGeniv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexImage),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexLevelParameterfv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexLevelParameteriv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexParameterIiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexParameterIuiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexParameterfv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTexParameteriv),
+        VKGL_REPLAY_ENTRY_POINT(glGetTransformFeedbackVarying),
+        VKGL_REPLAY_ENTRY_POINT(glGetUniformBlockIndex),
+        VKGL_REPLAY_ENTRY_POINT(glGetUniformIndices),
+        VKGL_REPLAY_ENTRY_POINT(glGetUniformLocation),
+        VKGL_REPLAY_ENTRY_POINT(glGetUniformfv),
+        VKGL_REPLAY_ENTRY_POINT(glGetUniformiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetUniformuiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetVertexAttribIiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetVertexAttribIuiv),
+        VKGL_REPLAY_ENTRY_POINT(glGetVertexAttribPointerv),
+        VKGL_REPLAY_ENTRY_POINT(glGetVertexAttribdv),
+        VKGL_REPLAY_ENTRY_POINT(glGetVertexAttribfv),
+        VKGL_REPLAY_ENTRY_POINT(glGetVertexAttribiv),
+        VKGL_REPLAY_ENTRY_POINT(glHint),
+        VKGL_REPLAY_ENTRY_POINT(glIndexPointer),
+        VKGL_REPLAY_ENTRY_POINT(glIndexd),
+        VKGL_REPLAY_ENTRY_POINT(glIndexdv),
+        VKGL_REPLAY_ENTRY_POINT(glIndexf),
+        VKGL_REPLAY_ENTRY_POINT(glIndexfv),
+        VKGL_REPLAY_ENTRY_POINT(glIndexi),
+        VKGL_REPLAY_ENTRY_POINT(glIndexiv),
+        VKGL_REPLAY_ENTRY_POINT(glIndexs),
+        VKGL_REPLAY_ENTRY_POINT(glIndexsv),
+        VKGL_REPLAY_ENTRY_POINT(glIndexub),
+        VKGL_REPLAY_ENTRY_POINT(glIndexubv),
+        VKGL_REPLAY_ENTRY_POINT(glInitNames),
+        VKGL_REPLAY_ENTRY_POINT(glInterleavedArrays),
+        VKGL_REPLAY_ENTRY_POINT(glIsBuffer),
+        VKGL_REPLAY_ENTRY_POINT(glIsEnabled),
+        VKGL_REPLAY_ENTRY_POINT(glIsEnabledi),
+        VKGL_REPLAY_ENTRY_POINT(glIsFramebuffer),
+        VKGL_REPLAY_ENTRY_POINT(glIsList),
+        VKGL_REPLAY_ENTRY_POINT(glIsProgram),
+        VKGL_REPLAY_ENTRY_POINT(glIsQuery),
+        VKGL_REPLAY_ENTRY_POINT(glIsRenderbuffer),
+        VKGL_REPLAY_ENTRY_POINT(glIsShader),
+        VKGL_REPLAY_ENTRY_POINT(glIsSync),
+        VKGL_REPLAY_ENTRY_POINT(glIsTexture),
+        VKGL_REPLAY_ENTRY_POINT(glIsVertexArray),
+        VKGL_REPLAY_ENTRY_POINT(glLightModelf),
+        VKGL_REPLAY_ENTRY_POINT(glLightModelfv),
+        VKGL_REPLAY_ENTRY_POINT(glLightModeli),
+        VKGL_REPLAY_ENTRY_POINT(glLightModeliv),
+        VKGL_REPLAY_ENTRY_POINT(glLightf),
+        VKGL_REPLAY_ENTRY_POINT(glLightfv),
+        VKGL_REPLAY_ENTRY_POINT(glLighti),
+        VKGL_REPLAY_ENTRY_POINT(glLightiv),
+        VKGL_REPLAY_ENTRY_POINT(glLineStipple),
+        VKGL_REPLAY_ENTRY_POINT(glLineWidth),
+        VKGL_REPLAY_ENTRY_POINT(glLinkProgram),
+        VKGL_REPLAY_ENTRY_POINT(glListBase),
+        VKGL_REPLAY_ENTRY_POINT(glLoadIdentity),
+        VKGL_REPLAY_ENTRY_POINT(glLoadMatrixd),
+        VKGL_REPLAY_ENTRY_POINT(glLoadMatrixf),
+        VKGL_REPLAY_ENTRY_POINT(glLoadName),
+        VKGL_REPLAY_ENTRY_POINT(glLoadTransposeMatrixd),
+        VKGL_REPLAY_ENTRY_POINT(glLoadTransposeMatrixf),
+        VKGL_REPLAY_ENTRY_POINT(glLogicOp),
+        VKGL_REPLAY_ENTRY_POINT(glMap1d),
+        VKGL_REPLAY_ENTRY_POINT(glMap1f),
+        VKGL_REPLAY_ENTRY_POINT(glMap2d),
+        VKGL_REPLAY_ENTRY_POINT(glMap2f),
+        VKGL_REPLAY_BUFFER_MAP_ENTRY_POINT(glMapBuffer),
+        VKGL_REPLAY_BUFFER_MAP_ENTRY_POINT(glMapBufferRange),
+        VKGL_REPLAY_ENTRY_POINT(glMapGrid1d),
+        VKGL_REPLAY_ENTRY_POINT(glMapGrid1f),
+        VKGL_REPLAY_ENTRY_POINT(glMapGrid2d),
+        VKGL_REPLAY_ENTRY_POINT(glMapGrid2f),
+        VKGL_REPLAY_ENTRY_POINT(glMaterialf),
+        VKGL_REPLAY_ENTRY_POINT(glMaterialfv),
+        VKGL_REPLAY_ENTRY_POINT(glMateriali),
+        VKGL_REPLAY_ENTRY_POINT(glMaterialiv),
+        VKGL_REPLAY_ENTRY_POINT(glMatrixMode),
+        VKGL_REPLAY_ENTRY_POINT(glMaxShaderCompilerThreadsKHR),
+        VKGL_REPLAY_ENTRY_POINT(glMultMatrixd),
+        VKGL_REPLAY_ENTRY_POINT(glMultMatrixf),
+        VKGL_REPLAY_ENTRY_POINT(glMultTransposeMatrixd),
+        VKGL_REPLAY_ENTRY_POINT(glMultTransposeMatrixf),
+        VKGL_REPLAY_ENTRY_POINT(glMultiDrawArrays),
+        VKGL_REPLAY_ENTRY_POINT(glMultiDrawElements),
+        VKGL_REPLAY_ENTRY_POINT(glMultiDrawElementsBaseVertex),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord1d),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord1dv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord1f),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord1fv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord1i),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord1iv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord1s),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord1sv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord2d),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord2dv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord2f),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord2fv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord2i),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord2iv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord2s),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord2sv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord3d),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord3dv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord3f),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord3fv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord3i),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord3iv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord3s),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord3sv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord4d),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord4dv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord4f),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord4fv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord4i),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord4iv),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord4s),
+        VKGL_REPLAY_ENTRY_POINT(glMultiTexCoord4sv),
+        VKGL_REPLAY_ENTRY_POINT(glNewList),
+        VKGL_REPLAY_ENTRY_POINT(glNormal3b),
+        VKGL_REPLAY_ENTRY_POINT(glNormal3bv),
+        VKGL_REPLAY_ENTRY_POINT(glNormal3d),
+        VKGL_REPLAY_ENTRY_POINT(glNormal3dv),
+        VKGL_REPLAY_ENTRY_POINT(glNormal3f),
+        VKGL_REPLAY_ENTRY_POINT(glNormal3fv),
+        VKGL_REPLAY_ENTRY_POINT(glNormal3i),
+        VKGL_REPLAY_ENTRY_POINT(glNormal3iv),
+        VKGL_REPLAY_ENTRY_POINT(glNormal3s),
+        VKGL_REPLAY_ENTRY_POINT(glNormal3sv),
+        VKGL_REPLAY_ENTRY_POINT(glNormalPointer),
+        VKGL_REPLAY_ENTRY_POINT(glOrtho),
+        VKGL_REPLAY_ENTRY_POINT(glPassThrough),
+        VKGL_REPLAY_ENTRY_POINT(glPixelMapfv),
+        VKGL_REPLAY_ENTRY_POINT(glPixelMapuiv),
+        VKGL_REPLAY_ENTRY_POINT(glPixelMapusv),
+        VKGL_REPLAY_ENTRY_POINT(glPixelStoref),
+        VKGL_REPLAY_ENTRY_POINT(glPixelStorei),
+        VKGL_REPLAY_ENTRY_POINT(glPixelTransferf),
+        VKGL_REPLAY_ENTRY_POINT(glPixelTransferi),
+        VKGL_REPLAY_ENTRY_POINT(glPixelZoom),
+        VKGL_REPLAY_ENTRY_POINT(glPointParameterf),
+        VKGL_REPLAY_ENTRY_POINT(glPointParameterfv),
+        VKGL_REPLAY_ENTRY_POINT(glPointParameteri),
+        VKGL_REPLAY_ENTRY_POINT(glPointParameteriv),
+        VKGL_REPLAY_ENTRY_POINT(glPointSize),
+        VKGL_REPLAY_ENTRY_POINT(glPolygonMode),
+        VKGL_REPLAY_ENTRY_POINT(glPolygonOffset),
+        VKGL_REPLAY_ENTRY_POINT(glPolygonStipple),
+        VKGL_REPLAY_ENTRY_POINT(glPopAttrib),
+        VKGL_REPLAY_ENTRY_POINT(glPopClientAttrib),
+        VKGL_REPLAY_ENTRY_POINT(glPopMatrix),
+        VKGL_REPLAY_ENTRY_POINT(glPopName),
+        VKGL_REPLAY_ENTRY_POINT(glPrimitiveRestartIndex),
+        VKGL_REPLAY_ENTRY_POINT(glPrioritizeTextures),
+        VKGL_REPLAY_ENTRY_POINT(glProvokingVertex),
+        VKGL_REPLAY_ENTRY_POINT(glPushAttrib),
+        VKGL_REPLAY_ENTRY_POINT(glPushClientAttrib),
+        VKGL_REPLAY_ENTRY_POINT(glPushMatrix),
+        VKGL_REPLAY_ENTRY_POINT(glPushName),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos2d),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos2dv),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos2f),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos2fv),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos2i),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos2iv),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos2s),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos2sv),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos3d),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos3dv),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos3f),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos3fv),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos3i),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos3iv),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos3s),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos3sv),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos4d),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos4dv),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos4f),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos4fv),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos4i),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos4iv),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos4s),
+        VKGL_REPLAY_ENTRY_POINT(glRasterPos4sv),
+        VKGL_REPLAY_ENTRY_POINT(glReadBuffer),
+        VKGL_REPLAY_ENTRY_POINT(glReadPixels),
+        VKGL_REPLAY_ENTRY_POINT(glRectd),
+        VKGL_REPLAY_ENTRY_POINT(glRectdv),
+        VKGL_REPLAY_ENTRY_POINT(glRectf),
+        VKGL_REPLAY_ENTRY_POINT(glRectfv),
+        VKGL_REPLAY_ENTRY_POINT(glRecti),
+        VKGL_REPLAY_ENTRY_POINT(glRectiv),
+        VKGL_REPLAY_ENTRY_POINT(glRects),
+        VKGL_REPLAY_ENTRY_POINT(glRectsv),
+        VKGL_REPLAY_ENTRY_POINT(glRenderMode),
+        VKGL_REPLAY_ENTRY_POINT(glRenderbufferStorage),
+        VKGL_REPLAY_ENTRY_POINT(glRenderbufferStorageMultisample),
+        VKGL_REPLAY_ENTRY_POINT(glRotated),
+        VKGL_REPLAY_ENTRY_POINT(glRotatef),
+        VKGL_REPLAY_ENTRY_POINT(glSampleCoverage),
+        VKGL_REPLAY_ENTRY_POINT(glSampleMaski),
+        VKGL_REPLAY_ENTRY_POINT(glScaled),
+        VKGL_REPLAY_ENTRY_POINT(glScalef),
+        VKGL_REPLAY_ENTRY_POINT(glScissor),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3b),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3bv),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3d),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3dv),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3f),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3fv),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3i),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3iv),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3s),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3sv),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3ub),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3ubv),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3ui),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3uiv),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3us),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColor3usv),
+        VKGL_REPLAY_ENTRY_POINT(glSecondaryColorPointer),
+        VKGL_REPLAY_ENTRY_POINT(glSelectBuffer),
+        VKGL_REPLAY_ENTRY_POINT(glShadeModel),
+        VKGL_REPLAY_ENTRY_POINT(glShaderSource),
+        VKGL_REPLAY_ENTRY_POINT(glStencilFunc),
+        VKGL_REPLAY_ENTRY_POINT(glStencilFuncSeparate),
+        VKGL_REPLAY_ENTRY_POINT(glStencilMask),
+        VKGL_REPLAY_ENTRY_POINT(glStencilMaskSeparate),
+        VKGL_REPLAY_ENTRY_POINT(glStencilOp),
+        VKGL_REPLAY_ENTRY_POINT(glStencilOpSeparate),
+        VKGL_REPLAY_ENTRY_POINT(glTexBuffer),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord1d),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord1dv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord1f),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord1fv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord1i),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord1iv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord1s),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord1sv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord2d),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord2dv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord2f),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord2fv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord2i),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord2iv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord2s),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord2sv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord3d),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord3dv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord3f),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord3fv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord3i),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord3iv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord3s),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord3sv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord4d),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord4dv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord4f),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord4fv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord4i),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord4iv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord4s),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoord4sv),
+        VKGL_REPLAY_ENTRY_POINT(glTexCoordPointer),
+        VKGL_REPLAY_ENTRY_POINT(glTexEnvf),
+        VKGL_REPLAY_ENTRY_POINT(glTexEnvfv),
+        VKGL_REPLAY_ENTRY_POINT(glTexEnvi),
+        VKGL_REPLAY_ENTRY_POINT(glTexEnviv),
+        VKGL_REPLAY_ENTRY_POINT(glTexGend),
+        VKGL_REPLAY_ENTRY_POINT(glTexGendv),
+        VKGL_REPLAY_ENTRY_POINT(glTexGenf),
+        VKGL_REPLAY_ENTRY_POINT(glTexGenfv),
+        VKGL_REPLAY_ENTRY_POINT(glTexGeni),
+        VKGL_REPLAY_ENTRY_POINT(glTexGeniv),
+        VKGL_REPLAY_ENTRY_POINT(glTexImage1D),
+        VKGL_REPLAY_ENTRY_POINT(glTexImage2D),
+        VKGL_REPLAY_ENTRY_POINT(glTexImage2DMultisample),
+        VKGL_REPLAY_ENTRY_POINT(glTexImage3D),
+        VKGL_REPLAY_ENTRY_POINT(glTexImage3DMultisample),
+        VKGL_REPLAY_ENTRY_POINT(glTexParameterIiv),
+        VKGL_REPLAY_ENTRY_POINT(glTexParameterIuiv),
+        VKGL_REPLAY_ENTRY_POINT(glTexParameterf),
+        VKGL_REPLAY_ENTRY_POINT(glTexParameterfv),
+        VKGL_REPLAY_ENTRY_POINT(glTexParameteri),
+        VKGL_REPLAY_ENTRY_POINT(glTexParameteriv),
+        VKGL_REPLAY_ENTRY_POINT(glTexSubImage1D),
+        VKGL_REPLAY_ENTRY_POINT(glTexSubImage2D),
+        VKGL_REPLAY_ENTRY_POINT(glTexSubImage3D),
+        VKGL_REPLAY_ENTRY_POINT(glTransformFeedbackVaryings),
+        VKGL_REPLAY_ENTRY_POINT(glTranslated),
+        VKGL_REPLAY_ENTRY_POINT(glTranslatef),
+        VKGL_REPLAY_ENTRY_POINT(glUniform1f),
+        VKGL_REPLAY_ENTRY_POINT(glUniform1fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniform1i),
+        VKGL_REPLAY_ENTRY_POINT(glUniform1iv),
+        VKGL_REPLAY_ENTRY_POINT(glUniform1ui),
+        VKGL_REPLAY_ENTRY_POINT(glUniform1uiv),
+        VKGL_REPLAY_ENTRY_POINT(glUniform2f),
+        VKGL_REPLAY_ENTRY_POINT(glUniform2fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniform2i),
+        VKGL_REPLAY_ENTRY_POINT(glUniform2iv),
+        VKGL_REPLAY_ENTRY_POINT(glUniform2ui),
+        VKGL_REPLAY_ENTRY_POINT(glUniform2uiv),
+        VKGL_REPLAY_ENTRY_POINT(glUniform3f),
+        VKGL_REPLAY_ENTRY_POINT(glUniform3fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniform3i),
+        VKGL_REPLAY_ENTRY_POINT(glUniform3iv),
+        VKGL_REPLAY_ENTRY_POINT(glUniform3ui),
+        VKGL_REPLAY_ENTRY_POINT(glUniform3uiv),
+        VKGL_REPLAY_ENTRY_POINT(glUniform4f),
+        VKGL_REPLAY_ENTRY_POINT(glUniform4fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniform4i),
+        VKGL_REPLAY_ENTRY_POINT(glUniform4iv),
+        VKGL_REPLAY_ENTRY_POINT(glUniform4ui),
+        VKGL_REPLAY_ENTRY_POINT(glUniform4uiv),
+        VKGL_REPLAY_ENTRY_POINT(glUniformBlockBinding),
+        VKGL_REPLAY_ENTRY_POINT(glUniformMatrix2fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniformMatrix2x3fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniformMatrix2x4fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniformMatrix3fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniformMatrix3x2fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniformMatrix3x4fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniformMatrix4fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniformMatrix4x2fv),
+        VKGL_REPLAY_ENTRY_POINT(glUniformMatrix4x3fv),
+        VKGL_REPLAY_ENTRY_POINT(glUnmapBuffer),
+        VKGL_REPLAY_ENTRY_POINT(glUseProgram),
+        VKGL_REPLAY_ENTRY_POINT(glValidateProgram),
+        VKGL_REPLAY_ENTRY_POINT(glVertex2d),
+        VKGL_REPLAY_ENTRY_POINT(glVertex2dv),
+        VKGL_REPLAY_ENTRY_POINT(glVertex2f),
+        VKGL_REPLAY_ENTRY_POINT(glVertex2fv),
+        VKGL_REPLAY_ENTRY_POINT(glVertex2i),
+        VKGL_REPLAY_ENTRY_POINT(glVertex2iv),
+        VKGL_REPLAY_ENTRY_POINT(glVertex2s),
+        VKGL_REPLAY_ENTRY_POINT(glVertex2sv),
+        VKGL_REPLAY_ENTRY_POINT(glVertex3d),
+        VKGL_REPLAY_ENTRY_POINT(glVertex3dv),
+        VKGL_REPLAY_ENTRY_POINT(glVertex3f),
+        VKGL_REPLAY_ENTRY_POINT(glVertex3fv),
+        VKGL_REPLAY_ENTRY_POINT(glVertex3i),
+        VKGL_REPLAY_ENTRY_POINT(glVertex3iv),
+        VKGL_REPLAY_ENTRY_POINT(glVertex3s),
+        VKGL_REPLAY_ENTRY_POINT(glVertex3sv),
+        VKGL_REPLAY_ENTRY_POINT(glVertex4d),
+        VKGL_REPLAY_ENTRY_POINT(glVertex4dv),
+        VKGL_REPLAY_ENTRY_POINT(glVertex4f),
+        VKGL_REPLAY_ENTRY_POINT(glVertex4fv),
+        VKGL_REPLAY_ENTRY_POINT(glVertex4i),
+        VKGL_REPLAY_ENTRY_POINT(glVertex4iv),
+        VKGL_REPLAY_ENTRY_POINT(glVertex4s),
+        VKGL_REPLAY_ENTRY_POINT(glVertex4sv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib1d),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib1dv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib1f),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib1fv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib1s),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib1sv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib2d),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib2dv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib2f),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib2fv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib2s),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib2sv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib3d),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib3dv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib3f),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib3fv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib3s),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib3sv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4Nbv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4Niv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4Nsv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4Nub),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4Nubv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4Nuiv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4Nusv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4bv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4d),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4dv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4f),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4fv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4iv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4s),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4sv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4ubv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4uiv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttrib4usv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI1i),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI1iv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI1ui),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI1uiv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI2i),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI2iv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI2ui),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI2uiv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI3i),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI3iv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI3ui),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI3uiv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI4bv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI4i),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI4iv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI4sv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI4ubv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI4ui),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI4uiv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribI4usv),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribIPointer),
+        VKGL_REPLAY_ENTRY_POINT(glVertexAttribPointer),
+        VKGL_REPLAY_ENTRY_POINT(glVertexPointer),
+        VKGL_REPLAY_ENTRY_POINT(glViewport),
+        VKGL_REPLAY_ENTRY_POINT(glWaitSync),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos2d),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos2dv),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos2f),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos2fv),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos2i),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos2iv),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos2s),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos2sv),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos3d),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos3dv),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos3f),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos3fv),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos3i),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos3iv),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos3s),
+        VKGL_REPLAY_ENTRY_POINT(glWindowPos3sv)
+    };
+
+    #undef VKGL_REPLAY_BUFFER_MAP_ENTRY_POINT
+    #undef VKGL_REPLAY_ENTRY_POINT
+
+    const auto entry_points_end = entry_points + sizeof(entry_points) / sizeof(entry_points[0]);
+    const auto iterator         = std::lower_bound(entry_points,
+                                                   entry_points_end,
+                                                   in_name,
+                                                   [](const EntryPoint& in_entry_point,
+                                                      const char*       in_name_to_find)
+                                                   {
+                                                       return strcmp(in_entry_point.name,
+                                                                     in_name_to_find) < 0;
+                                                   });
+
+    return (iterator != entry_points_end && strcmp(iterator->name, in_name) == 0) ? iterator
+                                                                                  : nullptr;
+}
+
+bool OpenGL::GLReplayer::init(const char* in_file_name)
+{
+    GLCaptureFileHeader header;
+    int                 fd     = -1;
+    bool                result = false;
+    struct stat         stat_data;
+
+    fd = open(in_file_name,
+              O_RDONLY);
+
+    if (fd == -1)
+    {
+        VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                "Could not open GL capture file [%s]",
+                                in_file_name);
+
+        goto end;
+    }
+
+    if (fstat(fd,
+             &stat_data)    != 0                   ||
+        stat_data.st_size <  static_cast<off_t>(sizeof(header) ))
+    {
+        VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                "GL capture file [%s] is empty or unreadable",
+                                in_file_name);
+
+        goto end;
+    }
+
+    m_file_size   = static_cast<size_t>(stat_data.st_size);
+    m_mapping_ptr = mmap(nullptr,
+                         m_file_size,
+                         PROT_READ,
+                         MAP_PRIVATE,
+                         fd,
+                         0); /* offset */
+
+    if (m_mapping_ptr == MAP_FAILED)
+    {
+        m_mapping_ptr = nullptr;
+
+        VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                "Could not map GL capture file [%s]",
+                                in_file_name);
+
+        goto end;
+    }
+
+    memcpy(&header,
+           m_mapping_ptr,
+           sizeof(header) );
+
+    if (memcmp(header.magic,
+               g_gl_capture_file_magic,
+               sizeof(header.magic) ) != 0           ||
+        header.version                != g_gl_capture_file_version)
+    {
+        VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                "[%s] is not a GL capture file, or was written by an incompatible version of VKGL",
+                                in_file_name);
+
+        goto end;
+    }
+
+    result = validate_stream();
+
+end:
+    if (fd != -1)
+    {
+        close(fd);
+    }
+
+    return result;
+}
+
+bool OpenGL::GLReplayer::replay(OpenGL::Context* in_context_ptr,
+                                GLReplayStats*   out_stats_ptr)
+{
+    const uint8_t* chunk_ptr          = static_cast<const uint8_t*>(m_mapping_ptr) + sizeof(GLCaptureFileHeader);
+    const uint8_t* file_end_ptr       = static_cast<const uint8_t*>(m_mapping_ptr) + m_file_size;
+    auto           frame_start_time   = std::chrono::steady_clock::now();
+    bool           result             = false;
+    const auto     start_cpu_time_ms  = get_thread_cpu_time_ms();
+    const auto     start_time         = frame_start_time;
+    GLReplayStats  stats;
+
+    if (m_replayed)
+    {
+        vkgl_assert(!m_replayed);
+
+        goto end;
+    }
+
+    m_replayed = true;
+
+    while (chunk_ptr < file_end_ptr)
+    {
+        GLCaptureChunkHeader chunk_header;
+        const uint8_t*       payload_ptr = chunk_ptr + sizeof(chunk_header);
+
+        memcpy(&chunk_header,
+               chunk_ptr,
+               sizeof(chunk_header) );
+
+        switch (chunk_header.type)
+        {
+            case GLCaptureChunkType::Calls:
+            {
+                const uint8_t* payload_end_ptr = payload_ptr + chunk_header.n_bytes;
+                const uint8_t* record_ptr      = payload_ptr;
+
+                while (record_ptr < payload_end_ptr)
+                {
+                    uint32_t id      = 0;
+                    uint32_t n_bytes = 0;
+
+                    memcpy(&id,
+                           record_ptr,
+                           sizeof(id) );
+                    memcpy(&n_bytes,
+                           record_ptr + sizeof(id),
+                           sizeof(n_bytes) );
+
+                    m_data_ptr = record_ptr + sizeof(id) + sizeof(n_bytes);
+
+                    if (id < GL_CAPTURE_RECORD_ID_FIRST_SPECIAL)
+                    {
+                        const auto entry_point_ptr = m_entry_point_ptrs[id];
+
+                        m_n_scratch_buffers_used = 0;
+
+                        entry_point_ptr->replay_func_ptr(this);
+
+                        if (entry_point_ptr->is_buffer_map)
+                        {
+                            GLenum target;
+
+                            memcpy(&target,
+                                   record_ptr + sizeof(id) + sizeof(n_bytes),
+                                   sizeof(target) );
+
+                            m_mapped_ptrs[target] = m_last_returned_ptr;
+                        }
+
+                        ++stats.n_calls;
+                    }
+                    else
+                    if (id == GL_CAPTURE_RECORD_ID_MAPPED_WRITE)
+                    {
+                        replay_mapped_write();
+                    }
+                    else
+                    {
+                        vkgl_assert(id == GL_CAPTURE_RECORD_ID_SYNC_CREATED);
+
+                        replay_sync_created();
+                    }
+
+                    record_ptr += sizeof(id) + sizeof(n_bytes) + n_bytes;
+                }
+
+                break;
+            }
+
+            case GLCaptureChunkType::Frame_End:
+            {
+                in_context_ptr->present();
+
+                {
+                    const auto   time_now      = std::chrono::steady_clock::now();
+                    const double frame_time_ms = std::chrono::duration<double, std::milli>(time_now - frame_start_time).count();
+
+                    stats.max_frame_time_ms = (stats.n_frames == 0) ? frame_time_ms : std::max(stats.max_frame_time_ms, frame_time_ms);
+                    stats.min_frame_time_ms = (stats.n_frames == 0) ? frame_time_ms : std::min(stats.min_frame_time_ms, frame_time_ms);
+
+                    frame_start_time = time_now;
+                }
+
+                ++stats.n_frames;
+
+                break;
+            }
+
+            default:
+            {
+                /* Entry_Point chunks have been processed at validation time. */
+                break;
+            }
+        }
+
+        chunk_ptr = payload_ptr + get_padded_chunk_size(chunk_header.n_bytes);
+    }
+
+    in_context_ptr->finish();
+
+    stats.cpu_time_ms  = get_thread_cpu_time_ms() - start_cpu_time_ms;
+    stats.wall_time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+
+    if (out_stats_ptr != nullptr)
+    {
+        *out_stats_ptr = stats;
+    }
+
+    result = true;
+end:
+    return result;
+}
+
+template<auto FunctionPtr, typename ReturnType, typename... ArgTypes>
+void OpenGL::GLReplayer::decode_and_call(GLReplayer* in_replayer_ptr,
+                                         ReturnType (*)(ArgTypes...) )
+{
+    /* Braced init guarantees left-to-right evaluation, which is the order arguments are stored in. */
+    std::tuple<ArgTypes...> args{in_replayer_ptr->decode_arg<ArgTypes>()...};
+
+    if constexpr (std::is_void<ReturnType>::value)
+    {
+        std::apply(FunctionPtr,
+                   args);
+    }
+    else
+    {
+        in_replayer_ptr->on_call_returned(std::apply(FunctionPtr,
+                                                     args) );
+    }
+}
+
+template<auto FunctionPtr>
+void OpenGL::GLReplayer::replay_call(GLReplayer* in_replayer_ptr)
+{
+    decode_and_call<FunctionPtr>(in_replayer_ptr,
+                                 FunctionPtr);
+}
+
+void OpenGL::GLReplayer::replay_mapped_write()
+{
+    const auto target = read_value<GLenum>();
+
+    /* Empty ranges are stored by value. */
+    if (read_value<GLCapturePointerKind>() == GLCapturePointerKind::Blob)
+    {
+        const auto n_bytes               = read_value<uint32_t>();
+        const auto mapped_range_iterator = m_mapped_ptrs.find(target);
+
+        m_data_ptr = align_8(m_data_ptr);
+
+        if (mapped_range_iterator         != m_mapped_ptrs.end() &&
+            mapped_range_iterator->second != nullptr)
+        {
+            memcpy(mapped_range_iterator->second,
+                   m_data_ptr,
+                   n_bytes);
+
+            m_mapped_ptrs.erase(mapped_range_iterator);
+        }
+    }
+}
+
+void OpenGL::GLReplayer::replay_sync_created()
+{
+    m_sync_objects[read_value<uint64_t>()] = m_last_returned_sync;
+}
+
+bool OpenGL::GLReplayer::validate_stream()
+{
+    const uint8_t* chunk_ptr    = static_cast<const uint8_t*>(m_mapping_ptr) + sizeof(GLCaptureFileHeader);
+    const uint8_t* file_end_ptr = static_cast<const uint8_t*>(m_mapping_ptr) + m_file_size;
+    bool           result       = false;
+
+    while (chunk_ptr < file_end_ptr)
+    {
+        GLCaptureChunkHeader chunk_header;
+        const uint8_t*       payload_ptr = chunk_ptr + sizeof(chunk_header);
+
+        if (static_cast<size_t>(file_end_ptr - chunk_ptr) < sizeof(chunk_header) )
+        {
+            VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                    "GL capture file is truncated");
+
+            goto end;
+        }
+
+        memcpy(&chunk_header,
+               chunk_ptr,
+               sizeof(chunk_header) );
+
+        if (static_cast<size_t>(file_end_ptr - payload_ptr) < chunk_header.n_bytes)
+        {
+            VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                    "GL capture file is truncated");
+
+            goto end;
+        }
+
+        switch (chunk_header.type)
+        {
+            case GLCaptureChunkType::Calls:
+            {
+                const uint8_t* payload_end_ptr = payload_ptr + chunk_header.n_bytes;
+                const uint8_t* record_ptr      = payload_ptr;
+
+                while (record_ptr < payload_end_ptr)
+                {
+                    uint32_t id      = 0;
+                    uint32_t n_bytes = 0;
+
+                    if (static_cast<size_t>(payload_end_ptr - record_ptr) < sizeof(id) + sizeof(n_bytes) )
+                    {
+                        VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                                "Malformed call record in GL capture file");
+
+                        goto end;
+                    }
+
+                    memcpy(&id,
+                           record_ptr,
+                           sizeof(id) );
+                    memcpy(&n_bytes,
+                           record_ptr + sizeof(id),
+                           sizeof(n_bytes) );
+
+                    record_ptr += sizeof(id) + sizeof(n_bytes);
+
+                    if (static_cast<size_t>(payload_end_ptr - record_ptr) < n_bytes)
+                    {
+                        VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                                "Malformed call record in GL capture file");
+
+                        goto end;
+                    }
+
+                    if (id < GL_CAPTURE_RECORD_ID_FIRST_SPECIAL)
+                    {
+                        if (id                        >= m_entry_point_ptrs.size() ||
+                            m_entry_point_ptrs.at(id) == nullptr)
+                        {
+                            VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                                    "GL capture file uses entry point ID [%u] before declaring it",
+                                                    id);
+
+                            goto end;
+                        }
+                    }
+                    else
+                    if (id != GL_CAPTURE_RECORD_ID_MAPPED_WRITE &&
+                        id != GL_CAPTURE_RECORD_ID_SYNC_CREATED)
+                    {
+                        VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                                "Unrecognized record ID [%u] in GL capture file",
+                                                id);
+
+                        goto end;
+                    }
+
+                    record_ptr += n_bytes;
+                }
+
+                break;
+            }
+
+            case GLCaptureChunkType::Entry_Point:
+            {
+                const EntryPoint* entry_point_ptr = nullptr;
+                uint32_t          id              = UINT32_MAX;
+                const char*       name_ptr        = reinterpret_cast<const char*>(payload_ptr + sizeof(id) );
+
+                if (chunk_header.n_bytes > sizeof(id) )
+                {
+                    memcpy(&id,
+                           payload_ptr,
+                           sizeof(id) );
+                }
+
+                if (id                                                       >= GL_CAPTURE_RECORD_ID_FIRST_SPECIAL ||
+                    memchr(name_ptr, 0, chunk_header.n_bytes - sizeof(id) ) == nullptr)
+                {
+                    VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                            "Malformed entry point declaration in GL capture file");
+
+                    goto end;
+                }
+
+                entry_point_ptr = get_entry_point(name_ptr);
+
+                if (entry_point_ptr == nullptr)
+                {
+                    VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                            "GL capture file uses entry point [%s], which cannot be replayed",
+                                            name_ptr);
+
+                    goto end;
+                }
+
+                if (m_entry_point_ptrs.size() <= id)
+                {
+                    m_entry_point_ptrs.resize(id + 1,
+                                              nullptr);
+                }
+
+                m_entry_point_ptrs.at(id) = entry_point_ptr;
+
+                break;
+            }
+
+            case GLCaptureChunkType::Frame_End:
+            {
+                ++m_n_frames;
+
+                break;
+            }
+
+            default:
+            {
+                VKGL::g_logger_ptr->log(VKGL::LogLevel::Warning,
+                                        "Skipping unrecognized chunk of type [%u] in GL capture file",
+                                        static_cast<uint32_t>(chunk_header.type) );
+
+                break;
+            }
+        }
+
+        /* The last chunk's padding may be missing if the capture was cut short. */
+        if (static_cast<size_t>(file_end_ptr - payload_ptr) < get_padded_chunk_size(chunk_header.n_bytes) )
+        {
+            break;
+        }
+
+        chunk_ptr = payload_ptr + get_padded_chunk_size(chunk_header.n_bytes);
+    }
+
+    result = true;
+end:
+    return result;
+}
+
+
+int vkgl_replay_capture(const char*            in_file_name,
+                        OpenGL::GLReplayStats* out_stats_ptr)
+{
+    OpenGL::VKBackendUniquePtr  backend_ptr;
+    OpenGL::ContextUniquePtr    context_ptr;
+    OpenGL::GLReplayerUniquePtr replayer_ptr;
+    int                         result = 1;
+    ReplayWSIContext            wsi_context;
+
+    /* Replayed calls must not be captured, or the capture file could be overwritten while it is being read. */
+    OpenGL::g_gl_capture_enabled.store(false,
+                                       std::memory_order_relaxed);
+
+    if (!wsi_context.is_headless() )
+    {
+        VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                "GL capture replay requires VKGL_HEADLESS=<width>x<height> to be set.");
+
+        goto end;
+    }
+
+    replayer_ptr = OpenGL::GLReplayer::create(in_file_name);
+
+    if (replayer_ptr == nullptr)
+    {
+        goto end;
+    }
+
+    backend_ptr = OpenGL::VKBackend::create(&wsi_context);
+
+    if (backend_ptr == nullptr)
+    {
+        vkgl_assert(backend_ptr != nullptr);
+
+        goto end;
+    }
+
+    context_ptr = OpenGL::Context::create(&wsi_context,
+                                          dynamic_cast<const OpenGL::IBackend*>            (backend_ptr.get() ),
+                                          dynamic_cast<OpenGL::IBackendGLCallbacks*>       (backend_ptr.get() ),
+                                          dynamic_cast<const OpenGL::IBackendCapabilities*>(backend_ptr.get() ));
+
+    if (context_ptr == nullptr)
+    {
+        vkgl_assert(context_ptr != nullptr);
+
+        goto end;
+    }
+
+    backend_ptr->set_frontend_callback(dynamic_cast<const OpenGL::IContextObjectManagers*>(context_ptr.get() ));
+
+    setGlThreadSpecific(context_ptr.get() );
+    {
+        if (replayer_ptr->replay(context_ptr.get(),
+                                 out_stats_ptr) )
+        {
+            result = 0;
+        }
+    }
+    setGlThreadSpecific(nullptr);
+
+end:
+    /* Context must go away before the backend it was created for. */
+    context_ptr.reset();
+    backend_ptr.reset();
+
+    return result;
+}
@@ -0,0 +1,556 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "Anvil/include/misc/buffer_create_info.h"
+#include "Anvil/include/misc/image_create_info.h"
+#include "Anvil/include/wrappers/buffer.h"
+#include "Anvil/include/wrappers/command_buffer.h"
+#include "Anvil/include/wrappers/image.h"
+#include "OpenGL/frame_graph_benchmark.h"
+#include "OpenGL/backend/vk_backend.h"
+#include "OpenGL/backend/vk_frame_graph.h"
+#include "OpenGL/backend/vk_frame_graph_node.h"
+#include "OpenGL/backend/vk_reference.h"
+#include "OpenGL/entrypoints/gl_capture.h"
+#include "OpenGL/context.h"
+#include "Common/logger.h"
+#include "Common/macros.h"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace
+{
+    const uint32_t g_image_size        = 256;
+    const uint32_t g_upload_size       = 256;
+    const uint32_t g_n_image_mips      = 9; //< log2(g_image_size) + 1
+
+    /* Stands in for the window system. The default framebuffer is provided by headless mode, and is never used. */
+    class HeadlessWSIContext : public VKGL::IWSIContext
+    {
+    public:
+        HeadlessWSIContext()
+            :m_height           (0),
+             m_is_debug         (false),
+             m_is_fwd_compatible(false),
+             m_major_version    (4),
+             m_minor_version    (5),
+             m_n_layer_plane    (0),
+             m_pixel_format_reqs(8,  /* in_n_alpha_bits   */
+                                 8,  /* in_n_blue_bits    */
+                                 24, /* in_n_depth_bits   */
+                                 8,  /* in_n_green_bits   */
+                                 8,  /* in_n_red_bits     */
+                                 8), /* in_n_stencil_bits */
+             m_swap_interval    (0),
+             m_width            (0)
+        {
+            const char* headless_env_ptr = getenv("VKGL_HEADLESS");
+
+            if (headless_env_ptr                             == nullptr ||
+                sscanf(headless_env_ptr, "%ux%u", &m_width, &m_height) != 2)
+            {
+                m_height = 0;
+                m_width  = 0;
+            }
+        }
+
+        const uint32_t&                      get_major_version            () const final { return m_major_version;     }
+        const uint32_t&                      get_minor_version            () const final { return m_minor_version;     }
+        const uint32_t&                      get_n_layer_plane            () const final { return m_n_layer_plane;     }
+        const VKGL::PixelFormatRequirements& get_pixel_format_requirements() const final { return m_pixel_format_reqs; }
+        const int&                           get_swap_interval            () const final { return m_swap_interval;     }
+        const bool&                          is_debug_context             () const final { return m_is_debug;          }
+        const bool&                          is_forward_compatible_context() const final { return m_is_fwd_compatible; }
+
+        void get_rendering_surface_size(uint32_t* out_width_ptr,
+                                        uint32_t* out_height_ptr) const final
+        {
+            *out_height_ptr = m_height;
+            *out_width_ptr  = m_width;
+        }
+
+        bool is_headless() const
+        {
+            return (m_width != 0 && m_height != 0);
+        }
+
+    private:
+        uint32_t                      m_height;
+        bool                          m_is_debug;
+        bool                          m_is_fwd_compatible;
+        uint32_t                      m_major_version;
+        uint32_t                      m_minor_version;
+        uint32_t                      m_n_layer_plane;
+        VKGL::PixelFormatRequirements m_pixel_format_reqs;
+        int                           m_swap_interval;
+        uint32_t                      m_width;
+    };
+
+    /* References to resources owned by the benchmark. Nothing tracks them, so they only carry the payload around. */
+    OpenGL::VKBufferReferenceUniquePtr create_buffer_reference(OpenGL::VKBufferPayload in_payload)
+    {
+        return OpenGL::VKBufferReferenceUniquePtr(new OpenGL::VKBufferReference(in_payload,
+                                                                                [](OpenGL::VKBufferReference*) { /* Stub */ },
+                                                                                nullptr, /* in_on_reference_destroyed_func */
+                                                                                create_buffer_reference),
+                                                  std::default_delete<OpenGL::VKBufferReference>() );
+    }
+
+    OpenGL::VKImageReferenceUniquePtr create_image_reference(OpenGL::VKImagePayload in_payload)
+    {
+        return OpenGL::VKImageReferenceUniquePtr(new OpenGL::VKImageReference(in_payload,
+                                                                              [](OpenGL::VKImageReference*) { /* Stub */ },
+                                                                              nullptr, /* in_on_reference_destroyed_func */
+                                                                              create_image_reference),
+                                                 std::default_delete<OpenGL::VKImageReference>() );
+    }
+
+    /* Transfer-writes a buffer range or an image subresource range, or reads one from a shader stage. Readers record no
+     * commands - only their IO declarations matter to the frame graph, which syncs them the same way it syncs draws.
+     */
+    class SyntheticNode : public OpenGL::IVKFrameGraphNode
+    {
+    public:
+        static OpenGL::VKFrameGraphNodeUniquePtr create_buffer_reader(const OpenGL::VKBufferPayload& in_buffer_payload,
+                                                                      const VkDeviceSize&            in_start_offset,
+                                                                      const VkDeviceSize&            in_size)
+        {
+            SyntheticNode* node_ptr = new SyntheticNode(false); /* in_is_writer */
+
+            node_ptr->m_buffer_reference_ptr = create_buffer_reference(in_buffer_payload);
+
+            node_ptr->m_info.inputs.push_back(
+                OpenGL::NodeIO(node_ptr->m_buffer_reference_ptr.get(),
+                               in_start_offset,
+                               in_size,
+                               Anvil::PipelineStageFlagBits::VERTEX_INPUT_BIT,
+                               Anvil::AccessFlagBits::VERTEX_ATTRIBUTE_READ_BIT)
+            );
+
+            return OpenGL::VKFrameGraphNodeUniquePtr(node_ptr,
+                                                     std::default_delete<OpenGL::IVKFrameGraphNode>() );
+        }
+
+        static OpenGL::VKFrameGraphNodeUniquePtr create_buffer_writer(const OpenGL::VKBufferPayload& in_buffer_payload,
+                                                                      const VkDeviceSize&            in_start_offset,
+                                                                      const VkDeviceSize&            in_size)
+        {
+            SyntheticNode* node_ptr = new SyntheticNode(true); /* in_is_writer */
+            const auto     node_io  = OpenGL::NodeIO(nullptr, /* in_vk_buffer_reference_ptr - set below */
+                                                     in_start_offset,
+                                                     in_size,
+                                                     Anvil::PipelineStageFlagBits::TRANSFER_BIT,
+                                                     Anvil::AccessFlagBits::TRANSFER_WRITE_BIT);
+
+            node_ptr->m_buffer_reference_ptr = create_buffer_reference(in_buffer_payload);
+
+            node_ptr->m_info.inputs.push_back (node_io);
+            node_ptr->m_info.outputs.push_back(node_io);
+
+            node_ptr->m_info.inputs.at (0).buffer_reference_ptr = node_ptr->m_buffer_reference_ptr.get();
+            node_ptr->m_info.outputs.at(0).buffer_reference_ptr = node_ptr->m_buffer_reference_ptr.get();
+
+            return OpenGL::VKFrameGraphNodeUniquePtr(node_ptr,
+                                                     std::default_delete<OpenGL::IVKFrameGraphNode>() );
+        }
+
+        static OpenGL::VKFrameGraphNodeUniquePtr create_image_reader(const OpenGL::VKImagePayload&       in_image_payload,
+                                                                     const Anvil::ImageSubresourceRange& in_subresource_range)
+        {
+            SyntheticNode* node_ptr = new SyntheticNode(false); /* in_is_writer */
+
+            node_ptr->m_image_reference_ptr = create_image_reference(in_image_payload);
+
+            node_ptr->m_info.inputs.push_back(
+                OpenGL::NodeIO(node_ptr->m_image_reference_ptr.get(),
+                               in_subresource_range,
+                               Anvil::ImageAspectFlagBits::COLOR_BIT,
+                               Anvil::ImageLayout::SHADER_READ_ONLY_OPTIMAL,
+                               Anvil::PipelineStageFlagBits::FRAGMENT_SHADER_BIT,
+                               Anvil::AccessFlagBits::SHADER_READ_BIT,
+                               UINT32_MAX) /* in_fs_output_location */
+            );
+
+            return OpenGL::VKFrameGraphNodeUniquePtr(node_ptr,
+                                                     std::default_delete<OpenGL::IVKFrameGraphNode>() );
+        }
+
+        static OpenGL::VKFrameGraphNodeUniquePtr create_image_writer(const OpenGL::VKImagePayload&       in_image_payload,
+                                                                     const Anvil::ImageSubresourceRange& in_subresource_range)
+        {
+            SyntheticNode* node_ptr = new SyntheticNode(true); /* in_is_writer */
+
+            node_ptr->m_image_reference_ptr = create_image_reference(in_image_payload);
+
+            {
+                const auto node_io = OpenGL::NodeIO(node_ptr->m_image_reference_ptr.get(),
+                                                    in_subresource_range,
+                                                    Anvil::ImageAspectFlagBits::COLOR_BIT,
+                                                    Anvil::ImageLayout::TRANSFER_DST_OPTIMAL,
+                                                    Anvil::PipelineStageFlagBits::TRANSFER_BIT,
+                                                    Anvil::AccessFlagBits::TRANSFER_WRITE_BIT,
+                                                    UINT32_MAX); /* in_fs_output_location */
+
+                node_ptr->m_info.inputs.push_back (node_io);
+                node_ptr->m_info.outputs.push_back(node_io);
+            }
+
+            return OpenGL::VKFrameGraphNodeUniquePtr(node_ptr,
+                                                     std::default_delete<OpenGL::IVKFrameGraphNode>() );
+        }
+
+    private:
+        /* IVKFrameGraphNode */
+        void do_cpu_prepass(OpenGL::IVKFrameGraphNodeCallback*) final
+        {
+            /* Should never be called */
+            vkgl_assert_fail();
+        }
+
+        void execute_cpu_side(OpenGL::IVKFrameGraphNodeCallback*) final
+        {
+            /* Should never be called */
+            vkgl_assert_fail();
+        }
+
+        void get_gl_context_state(const OpenGL::ContextState**                    out_context_state_ptr_ptr,
+                                  const OpenGL::GLContextStateBindingReferences** out_context_state_binding_references_ptr_ptr) const final
+        {
+            /* Should never be called */
+            vkgl_assert_fail();
+        }
+
+        const OpenGL::VKFrameGraphNodeInfo* get_info_ptr() const final
+        {
+            return &m_info;
+        }
+
+        OpenGL::RenderpassSupportScope get_renderpass_support_scope() const final
+        {
+            return OpenGL::RenderpassSupportScope::Not_Supported;
+        }
+
+        void get_supported_queue_families(uint32_t*                          out_n_queue_fams_ptr,
+                                          const Anvil::QueueFamilyFlagBits** out_queue_fams_ptr_ptr) const final
+        {
+            static const Anvil::QueueFamilyFlagBits compatible_queue_fams[] =
+            {
+                Anvil::QueueFamilyFlagBits::GRAPHICS_BIT,
+            };
+
+            *out_n_queue_fams_ptr   = sizeof(compatible_queue_fams) / sizeof(compatible_queue_fams[0]);
+            *out_queue_fams_ptr_ptr = compatible_queue_fams;
+        }
+
+        OpenGL::FrameGraphNodeType get_type() const final
+        {
+            return OpenGL::FrameGraphNodeType::Synthetic;
+        }
+
+        void record_commands(Anvil::CommandBufferBase*          in_cmd_buffer_ptr,
+                             const bool&                        in_inside_renderpass,
+                             OpenGL::IVKFrameGraphNodeCallback* in_graph_callback_ptr) const final
+        {
+            if (!m_is_writer)
+            {
+                goto end;
+            }
+
+            if (m_buffer_reference_ptr != nullptr)
+            {
+                const auto& buffer_props = m_info.outputs.at(0).buffer_props;
+
+                in_cmd_buffer_ptr->record_fill_buffer(m_buffer_reference_ptr->get_payload().buffer_ptr,
+                                                      m_buffer_reference_ptr->get_payload().buffer_offset + buffer_props.start_offset,
+                                                      buffer_props.size,
+                                                      0xDEADBEEF); /* in_data */
+            }
+            else
+            {
+                const VkClearColorValue clear_color = {};
+
+                in_cmd_buffer_ptr->record_clear_color_image(m_image_reference_ptr->get_payload().image_ptr,
+                                                            Anvil::ImageLayout::TRANSFER_DST_OPTIMAL,
+                                                           &clear_color,
+                                                            1, /* in_range_count */
+                                                           &m_info.outputs.at(0).image_props.subresource_range);
+            }
+
+        end:
+            ;
+        }
+
+        bool requires_cpu_side_execution() const final
+        {
+            return false;
+        }
+
+        bool requires_cpu_prepass() const final
+        {
+            return false;
+        }
+
+        bool requires_gpu_side_execution() const final
+        {
+            return true;
+        }
+
+        bool requires_manual_wait_sem_sync() const final
+        {
+            return false;
+        }
+
+        bool supports_primary_command_buffers() const final
+        {
+            return true;
+        }
+
+        bool supports_secondary_command_buffers() const final
+        {
+            return true;
+        }
+
+        /* Private functions */
+        explicit SyntheticNode(const bool& in_is_writer)
+            :m_is_writer(in_is_writer)
+        {
+            /* Stub */
+        }
+
+        /* Private variables */
+        OpenGL::VKBufferReferenceUniquePtr m_buffer_reference_ptr;
+        OpenGL::VKImageReferenceUniquePtr  m_image_reference_ptr;
+        OpenGL::VKFrameGraphNodeInfo       m_info;
+        const bool                         m_is_writer;
+    };
+
+    void accumulate_stats(const OpenGL::VKFrameGraphStats& in_stats,
+                          OpenGL::FrameGraphBenchmarkResult* inout_result_ptr)
+    {
+        inout_result_ptr->n_barriers_dropped               += in_stats.n_barriers_dropped;
+        inout_result_ptr->n_barriers_hoisted               += in_stats.n_barriers_hoisted;
+        inout_result_ptr->n_barriers_merged                += in_stats.n_barriers_merged;
+        inout_result_ptr->n_buffer_barriers                += in_stats.n_buffer_barriers;
+        inout_result_ptr->n_image_barriers                 += in_stats.n_image_barriers;
+        inout_result_ptr->n_pipeline_barrier_cmds          += in_stats.n_pipeline_barrier_cmds;
+        inout_result_ptr->n_set_event_cmds                 += in_stats.n_set_event_cmds;
+        inout_result_ptr->n_submissions                    += in_stats.n_submissions;
+        inout_result_ptr->n_submissions_without_reordering += in_stats.n_submissions_without_reordering;
+        inout_result_ptr->n_wait_events_cmds               += in_stats.n_wait_events_cmds;
+    }
+}
+
+int vkgl_run_frame_graph_benchmark(uint32_t                           in_n_frames,
+                                   uint32_t                           in_n_uploads_per_frame,
+                                   OpenGL::FrameGraphBenchmarkResult* out_result_ptr)
+{
+    const OpenGL::IBackend*    backend_interface_ptr = nullptr;
+    OpenGL::VKBackendUniquePtr backend_ptr;
+    Anvil::BufferUniquePtr     buffer_ptr;
+    OpenGL::ContextUniquePtr   context_ptr;
+    OpenGL::VKFrameGraph*      frame_graph_ptr = nullptr;
+    Anvil::ImageUniquePtr      image_ptr;
+    int                        result          = 1;
+    HeadlessWSIContext         wsi_context;
+
+    /* Nothing goes through the GL entry points, but make sure a capture does not get started for the context. */
+    OpenGL::g_gl_capture_enabled.store(false,
+                                       std::memory_order_relaxed);
+
+    if (!wsi_context.is_headless() )
+    {
+        VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                "Frame graph benchmark requires VKGL_HEADLESS=<width>x<height> to be set.");
+
+        goto end;
+    }
+
+    backend_ptr = OpenGL::VKBackend::create(&wsi_context);
+
+    if (backend_ptr == nullptr)
+    {
+        vkgl_assert(backend_ptr != nullptr);
+
+        goto end;
+    }
+
+    context_ptr = OpenGL::Context::create(&wsi_context,
+                                          dynamic_cast<const OpenGL::IBackend*>            (backend_ptr.get() ),
+                                          dynamic_cast<OpenGL::IBackendGLCallbacks*>       (backend_ptr.get() ),
+                                          dynamic_cast<const OpenGL::IBackendCapabilities*>(backend_ptr.get() ));
+
+    if (context_ptr == nullptr)
+    {
+        vkgl_assert(context_ptr != nullptr);
+
+        goto end;
+    }
+
+    backend_ptr->set_frontend_callback(dynamic_cast<const OpenGL::IContextObjectManagers*>(context_ptr.get() ));
+
+    backend_interface_ptr = dynamic_cast<const OpenGL::IBackend*>(backend_ptr.get() );
+    frame_graph_ptr       = backend_interface_ptr->get_frame_graph_ptr();
+    vkgl_assert(frame_graph_ptr != nullptr);
+
+    /* 1. Create the streamed-to resources. */
+    {
+        auto create_info_ptr = Anvil::BufferCreateInfo::create_alloc(backend_interface_ptr->get_device_ptr(),
+                                                                     static_cast<VkDeviceSize>(in_n_uploads_per_frame) * g_upload_size,
+                                                                     Anvil::QueueFamilyFlagBits::COMPUTE_BIT | Anvil::QueueFamilyFlagBits::DMA_BIT | Anvil::QueueFamilyFlagBits::GRAPHICS_BIT,
+                                                                     Anvil::SharingMode::EXCLUSIVE,
+                                                                     Anvil::BufferCreateFlagBits::NONE,
+                                                                     Anvil::BufferUsageFlagBits::TRANSFER_DST_BIT | Anvil::BufferUsageFlagBits::VERTEX_BUFFER_BIT,
+                                                                     Anvil::MemoryFeatureFlagBits::NONE);
+        vkgl_assert(create_info_ptr != nullptr);
+
+        buffer_ptr = Anvil::Buffer::create(std::move(create_info_ptr) );
+
+        if (buffer_ptr == nullptr)
+        {
+            vkgl_assert(buffer_ptr != nullptr);
+
+            goto end;
+        }
+    }
+
+    {
+        auto create_info_ptr = Anvil::ImageCreateInfo::create_alloc(backend_interface_ptr->get_device_ptr(),
+                                                                    Anvil::ImageType::_2D,
+                                                                    Anvil::Format::R8G8B8A8_UNORM,
+                                                                    Anvil::ImageTiling::OPTIMAL,
+                                                                    Anvil::ImageUsageFlagBits::SAMPLED_BIT | Anvil::ImageUsageFlagBits::TRANSFER_DST_BIT,
+                                                                    g_image_size,
+                                                                    g_image_size,
+                                                                    1, /* in_base_mipmap_depth */
+                                                                    1, /* in_n_layers          */
+                                                                    Anvil::SampleCountFlagBits::_1_BIT,
+                                                                    Anvil::QueueFamilyFlagBits::COMPUTE_BIT | Anvil::QueueFamilyFlagBits::DMA_BIT | Anvil::QueueFamilyFlagBits::GRAPHICS_BIT,
+                                                                    Anvil::SharingMode::EXCLUSIVE,
+                                                                    true, /* in_use_full_mipmap_chain */
+                                                                    Anvil::MemoryFeatureFlagBits::NONE,
+                                                                    Anvil::ImageCreateFlagBits::NONE,
+                                                                    Anvil::ImageLayout::UNDEFINED);
+        vkgl_assert(create_info_ptr != nullptr);
+
+        image_ptr = Anvil::Image::create(std::move(create_info_ptr) );
+
+        if (image_ptr == nullptr)
+        {
+            vkgl_assert(image_ptr != nullptr);
+
+            goto end;
+        }
+    }
+
+    /* 2. Stream. The first frame is a warm-up run, which creates command pools & sync objects. */
+    {
+        const OpenGL::TimeMarker      creation_time = std::chrono::high_resolution_clock::now();
+        const OpenGL::VKBufferPayload buffer_payload  (1, /* in_id */
+                                                       creation_time,
+                                                       buffer_ptr.get(),
+                                                       0, /* in_buffer_offset */
+                                                       static_cast<VkDeviceSize>(in_n_uploads_per_frame) * g_upload_size,
+                                                       creation_time);
+        const OpenGL::VKImagePayload  image_payload   (1, /* in_id */
+                                                       creation_time,
+                                                       image_ptr.get(),
+                                                       nullptr, /* in_image_view_ptr */
+                                                       nullptr, /* in_sampler_ptr    */
+                                                       creation_time);
+
+        for (uint32_t n_frame = 0;
+                      n_frame < in_n_frames + 1;
+                    ++n_frame)
+        {
+            const auto start_time = std::chrono::steady_clock::now();
+
+            for (uint32_t n_upload = 0;
+                          n_upload < in_n_uploads_per_frame;
+                        ++n_upload)
+            {
+                const VkDeviceSize start_offset = static_cast<VkDeviceSize>(n_upload) * g_upload_size;
+
+                frame_graph_ptr->add_node(SyntheticNode::create_buffer_writer(buffer_payload,
+                                                                              start_offset,
+                                                                              g_upload_size) );
+                frame_graph_ptr->add_node(SyntheticNode::create_buffer_reader(buffer_payload,
+                                                                              start_offset,
+                                                                              g_upload_size) );
+            }
+
+            for (uint32_t n_mip = 0;
+                          n_mip < g_n_image_mips;
+                        ++n_mip)
+            {
+                Anvil::ImageSubresourceRange subresource_range;
+
+                subresource_range.aspect_mask      = Anvil::ImageAspectFlagBits::COLOR_BIT;
+                subresource_range.base_array_layer = 0;
+                subresource_range.base_mip_level   = n_mip;
+                subresource_range.layer_count      = 1;
+                subresource_range.level_count      = 1;
+
+                frame_graph_ptr->add_node(SyntheticNode::create_image_writer(image_payload,
+                                                                             subresource_range) );
+            }
+
+            {
+                Anvil::ImageSubresourceRange subresource_range;
+
+                subresource_range.aspect_mask      = Anvil::ImageAspectFlagBits::COLOR_BIT;
+                subresource_range.base_array_layer = 0;
+                subresource_range.base_mip_level   = 0;
+                subresource_range.layer_count      = 1;
+                subresource_range.level_count      = g_n_image_mips;
+
+                frame_graph_ptr->add_node(SyntheticNode::create_image_reader(image_payload,
+                                                                             subresource_range) );
+            }
+
+            frame_graph_ptr->execute(true,     /* in_block_until_finished */
+                                     nullptr); /* in_opt_fence_ptr        */
+
+            {
+                const auto end_time = std::chrono::steady_clock::now();
+                const auto stats    = frame_graph_ptr->pop_frame_stats();
+
+                if (n_frame == 0)
+                {
+                    continue;
+                }
+
+                accumulate_stats(stats,
+                                 out_result_ptr);
+
+                out_result_ptr->n_frames     ++;
+                out_result_ptr->wall_time_ms += std::chrono::duration<double, std::milli>(end_time - start_time).count();
+            }
+        }
+    }
+
+    result = 0;
+end:
+    if (frame_graph_ptr != nullptr)
+    {
+        if (buffer_ptr != nullptr)
+        {
+            frame_graph_ptr->on_buffer_deleted(buffer_ptr.get() );
+        }
+
+        if (image_ptr != nullptr)
+        {
+            frame_graph_ptr->on_image_deleted(image_ptr.get() );
+        }
+    }
+
+    buffer_ptr.reset();
+    image_ptr.reset ();
+
+    /* Context must go away before the backend it was created for. */
+    context_ptr.reset();
+    backend_ptr.reset();
+
+    return result;
+}
@@ -61,12 +61,12 @@ void OpenGL::GLConstants::get_parameter(const OpenGL::ContextProperty&    in_pna
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    const auto pname_iterator = m_prop_map.find(in_pname);
+    const auto pname_props_ptr = m_prop_map.find(in_pname);
 
-    vkgl_assert(pname_iterator != m_prop_map.end() );
-    if (pname_iterator != m_prop_map.end() )
+    vkgl_assert(pname_props_ptr != nullptr);
+    if (pname_props_ptr != nullptr)
     {
-        const auto& pname_props = pname_iterator->second;
+        const auto& pname_props = *pname_props_ptr;
 
         OpenGL::Converters::convert(pname_props.type,
                                     pname_props.data_ptr,
@@ -83,12 +83,12 @@ void OpenGL::GLConstants::get_parameter_indexed(const OpenGL::ContextProperty&
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    const auto pname_iterator = m_indexed_prop_map.find(in_pname);
+    const auto pname_props_ptr = m_indexed_prop_map.find(in_pname);
 
-    vkgl_assert(pname_iterator != m_indexed_prop_map.end() );
-    if (pname_iterator != m_indexed_prop_map.end() )
+    vkgl_assert(pname_props_ptr != nullptr);
+    if (pname_props_ptr != nullptr)
     {
-        const auto& pname_props = pname_iterator->second;
+        const auto& pname_props = *pname_props_ptr;
 
         vkgl_assert(pname_props.data_ptrs.size() > in_index);
 
@@ -167,18 +167,18 @@ void OpenGL::GLLimits::get_parameter(const OpenGL::ContextProperty&    in_pname,
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    const auto prop_iterator = m_prop_map.find(in_pname);
+    const auto prop_data_ptr = m_prop_map.find(in_pname);
 
-    if (prop_iterator == m_prop_map.end() )
+    if (prop_data_ptr == nullptr)
     {
-        vkgl_assert(prop_iterator != m_prop_map.end() );
+        vkgl_assert(prop_data_ptr != nullptr);
 
         goto end;
     }
 
-    OpenGL::Converters::convert(prop_iterator->second.type,
-                                prop_iterator->second.data_ptr,
-                                prop_iterator->second.n_components,
+    OpenGL::Converters::convert(prop_data_ptr->type,
+                                prop_data_ptr->data_ptr,
+                                prop_data_ptr->n_components,
                                 in_arg_type,
                                 out_arg_value_ptr);
 end:
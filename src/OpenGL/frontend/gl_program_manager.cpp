@@ -959,8 +959,14 @@ bool OpenGL::GLProgramManager::get_program_property(const GLuint&
         goto end;
     }
 
-    /* NOTE: post-link data ptr will be null if linking has not been initiated! */
-    post_link_data_ptr = program_ptr->get_post_link_data(m_backend_ptr);
+    /* NOTE: post-link data ptr will be null if linking has not been initiated!
+     *
+     * Completion status is polled while the program is being linked, so it must not wait for post-link data.
+     */
+    if (in_pname != OpenGL::ProgramProperty::Completion_Status)
+    {
+        post_link_data_ptr = program_ptr->get_post_link_data(m_backend_ptr);
+    }
 
     switch (in_pname)
     {
@@ -1048,6 +1054,24 @@ bool OpenGL::GLProgramManager::get_program_property(const GLuint&
             break;
         }
 
+        case OpenGL::ProgramProperty::Completion_Status:
+        {
+            bool is_complete = true; /* No link is pending if glLinkProgram() has not been invoked */
+
+            if (program_ptr->spirv_blob_id != UINT32_MAX)
+            {
+                m_backend_ptr->get_spirv_manager_ptr()->get_program_link_completion_status(program_ptr->spirv_blob_id,
+                                                                                          &is_complete);
+            }
+
+            helper_data.uint32 = static_cast<uint32_t>(is_complete);
+
+            src_data_ptr  = &helper_data.uint32;
+            src_data_type = OpenGL::GetSetArgumentType::Unsigned_Int;
+
+            break;
+        }
+
         case OpenGL::ProgramProperty::Info_Log_Length:
         {
             helper_data.uint32 = (post_link_data_ptr != nullptr) ? static_cast<uint32_t>(post_link_data_ptr->link_log.length() + 1 /* terminator */)
@@ -234,6 +234,22 @@ bool OpenGL::GLShaderManager::get_shader_property(const GLuint&
             break;
         }
 
+        case OpenGL::ShaderProperty::Completion_Status:
+        {
+            bool is_complete = true; /* No compilation is pending if glCompileShader() has not been invoked */
+
+            if (shader_ptr->spirv_blob_id != UINT32_MAX)
+            {
+                m_backend_ptr->get_spirv_manager_ptr()->get_shader_compilation_completion_status(shader_ptr->spirv_blob_id,
+                                                                                                &is_complete);
+            }
+
+            src_data_type    = OpenGL::GetSetArgumentType::Boolean;
+            src_data.boolean = is_complete;
+
+            break;
+        }
+
         case OpenGL::ShaderProperty::Shader_Source_Length: src_data_type = OpenGL::GetSetArgumentType::Unsigned_Int;   src_data.unsigned_int = static_cast<uint32_t>(shader_ptr->glsl.length() + 1);  break;
         case OpenGL::ShaderProperty::Shader_Type:          src_data_type = OpenGL::GetSetArgumentType::ShaderTypeVKGL; src_data.shader_type  = shader_ptr->type;                                      break;
 
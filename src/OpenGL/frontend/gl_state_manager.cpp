@@ -706,8 +706,7 @@ void OpenGL::GLStateManager::get_parameter(const OpenGL::ContextProperty&    in_
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    auto       state_ptr             = reinterpret_cast<const OpenGL::ContextState*>(m_snapshot_manager_ptr->get_readonly_snapshot(OpenGL::LATEST_SNAPSHOT_AVAILABLE,
-                                                                                                                                   false /* in_proxy_references_permitted */) );
+    auto       state_ptr             = reinterpret_cast<const OpenGL::ContextState*>(m_snapshot_manager_ptr->get_readonly_tot_snapshot() );
     const auto texture_binding_pname = OpenGL::Utils::get_texture_binding_property_for_context_property(in_pname);
 
     if (texture_binding_pname != OpenGL::TextureBindingProperty::Unknown)
@@ -728,12 +727,12 @@ void OpenGL::GLStateManager::get_parameter(const OpenGL::ContextProperty&    in_
         }
         else
         {
-            const auto prop_map_iterator = m_context_prop_map.find(in_pname);
+            const auto prop_props_ptr = m_context_prop_map.find(in_pname);
 
-            vkgl_assert(prop_map_iterator != m_context_prop_map.end() );
-            if (prop_map_iterator != m_context_prop_map.end() )
+            vkgl_assert(prop_props_ptr != nullptr);
+            if (prop_props_ptr != nullptr)
             {
-                const auto& prop_props = prop_map_iterator->second;
+                const auto& prop_props = *prop_props_ptr;
 
                 OpenGL::Converters::convert(prop_props.getter_value_type,
                                             reinterpret_cast<const char*>(state_ptr) + prop_props.value_offset,
@@ -751,14 +750,13 @@ void OpenGL::GLStateManager::get_pixel_store_parameter(const OpenGL::PixelStoreP
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    const auto prop_map_iterator = m_pixel_store_prop_map.find(in_pname);
-    auto       state_ptr         = reinterpret_cast<const OpenGL::ContextState*>(m_snapshot_manager_ptr->get_readonly_snapshot(OpenGL::LATEST_SNAPSHOT_AVAILABLE,
-                                                                                                                               false /* in_proxy_references_permitted */) );
+    const auto prop_props_ptr = m_pixel_store_prop_map.find(in_pname);
+    auto       state_ptr      = reinterpret_cast<const OpenGL::ContextState*>(m_snapshot_manager_ptr->get_readonly_tot_snapshot() );
 
-    vkgl_assert(prop_map_iterator != m_pixel_store_prop_map.end() );
-    if (prop_map_iterator != m_pixel_store_prop_map.end() )
+    vkgl_assert(prop_props_ptr != nullptr);
+    if (prop_props_ptr != nullptr)
     {
-        const auto& prop_props = prop_map_iterator->second;
+        const auto& prop_props = *prop_props_ptr;
 
         OpenGL::Converters::convert(prop_props.getter_value_type,
                                     reinterpret_cast<const char*>(state_ptr) + prop_props.value_offset,
@@ -791,8 +789,7 @@ GLuint OpenGL::GLStateManager::get_texture_binding(const uint32_t&
     FUN_ENTRY(DEBUG_DEPTH);
     
     GLuint result                 = 0;
-    auto   state_ptr              = reinterpret_cast<const OpenGL::ContextState*>(m_snapshot_manager_ptr->get_readonly_snapshot(OpenGL::LATEST_SNAPSHOT_AVAILABLE,
-                                                                                                                                false /* in_proxy_references_permitted */) );
+    auto   state_ptr              = reinterpret_cast<const OpenGL::ContextState*>(m_snapshot_manager_ptr->get_readonly_tot_snapshot() );
     auto   texture_unit_state_ptr = state_ptr->texture_unit_to_state_ptr_map.at(in_n_texture_unit).get();
 
     vkgl_assert(texture_unit_state_ptr != nullptr);
@@ -834,8 +831,7 @@ void OpenGL::GLStateManager::get_texture_binding_parameter(const OpenGL::Texture
     FUN_ENTRY(DEBUG_DEPTH);
     
     GLuint      result                = 0;
-    auto        state_ptr             = reinterpret_cast<const OpenGL::ContextState*>(m_snapshot_manager_ptr->get_readonly_snapshot(OpenGL::LATEST_SNAPSHOT_AVAILABLE,
-                                                                                                                                    false /* in_proxy_references_permitted */) );
+    auto        state_ptr             = reinterpret_cast<const OpenGL::ContextState*>(m_snapshot_manager_ptr->get_readonly_tot_snapshot() );
     const auto& texture_unit_data_ptr = state_ptr->texture_unit_to_state_ptr_map.at(state_ptr->active_texture_unit).get();;
 
     switch (in_pname)
@@ -1448,19 +1444,19 @@ void OpenGL::GLStateManager::set_pixel_store_property(const OpenGL::PixelStorePr
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    const auto prop_map_iterator = m_pixel_store_prop_map.find(in_property);
-    auto       state_ptr         = reinterpret_cast<OpenGL::ContextState*>(m_snapshot_manager_ptr->get_rw_tot_snapshot() );
+    const auto prop_props_ptr = m_pixel_store_prop_map.find(in_property);
+    auto       state_ptr      = reinterpret_cast<OpenGL::ContextState*>(m_snapshot_manager_ptr->get_rw_tot_snapshot() );
 
-    vkgl_assert(prop_map_iterator != m_pixel_store_prop_map.end() );
-    if (prop_map_iterator != m_pixel_store_prop_map.end() )
+    vkgl_assert(prop_props_ptr != nullptr);
+    if (prop_props_ptr != nullptr)
     {
-        const auto& prop_props = prop_map_iterator->second;
+        const auto& prop_props = *prop_props_ptr;
 
         OpenGL::Converters::convert(in_arg_type,
                                     in_arg_value_ptr,
                                     prop_props.n_value_components,
                                     prop_props.getter_value_type,
-                                    reinterpret_cast<char*>(state_ptr) + prop_map_iterator->second.value_offset);
+                                    reinterpret_cast<char*>(state_ptr) + prop_props.value_offset);
     }
 
     /* TODO: if (modified) */
@@ -1475,19 +1471,19 @@ void OpenGL::GLStateManager::set_point_property(const OpenGL::PointProperty&
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    const auto prop_map_iterator = m_point_prop_map.find(in_property);
-    auto       state_ptr         = reinterpret_cast<OpenGL::ContextState*>(m_snapshot_manager_ptr->get_rw_tot_snapshot() );
+    const auto prop_props_ptr = m_point_prop_map.find(in_property);
+    auto       state_ptr      = reinterpret_cast<OpenGL::ContextState*>(m_snapshot_manager_ptr->get_rw_tot_snapshot() );
 
-    vkgl_assert(prop_map_iterator != m_point_prop_map.end() );
-    if (prop_map_iterator != m_point_prop_map.end() )
+    vkgl_assert(prop_props_ptr != nullptr);
+    if (prop_props_ptr != nullptr)
     {
-        const auto& prop_props = prop_map_iterator->second;
+        const auto& prop_props = *prop_props_ptr;
 
         OpenGL::Converters::convert(in_arg_type,
                                     in_arg_value_ptr,
                                     prop_props.n_value_components,
                                     prop_props.getter_value_type,
-                                    reinterpret_cast<char*>(state_ptr) + prop_map_iterator->second.value_offset);
+                                    reinterpret_cast<char*>(state_ptr) + prop_props.value_offset);
     }
 
     /* TODO: if (modified) */
@@ -1879,8 +1875,7 @@ bool OpenGL::GLStateManager::is_enabled(const OpenGL::Capability& in_capability)
     FUN_ENTRY(DEBUG_DEPTH);
     
     bool result    = false;
-    auto state_ptr = reinterpret_cast<const OpenGL::ContextState*>(m_snapshot_manager_ptr->get_readonly_snapshot(OpenGL::LATEST_SNAPSHOT_AVAILABLE,
-                                                                                                                 false /* in_proxy_references_permitted */) );
+    auto state_ptr = reinterpret_cast<const OpenGL::ContextState*>(m_snapshot_manager_ptr->get_readonly_tot_snapshot() );
 
     switch (in_capability)
     {
@@ -0,0 +1,549 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "OpenGL/frontend_benchmark.h"
+#include "OpenGL/backend/null_backend.h"
+#include "OpenGL/entrypoints/gl_capture.h"
+#include "OpenGL/entrypoints/gl_entry_points_pack.h"
+#include "OpenGL/context.h"
+#include "Common/logger.h"
+#include "Common/macros.h"
+#include "Common/tls.h"
+#include <algorithm>
+#include <chrono>
+#include <string.h>
+
+namespace
+{
+    enum class BenchmarkEntryPoint
+    {
+        glActiveTexture,
+        glBindBuffer,
+        glBindTexture,
+        glBindVertexArray,
+        glBlendFunc,
+        glBufferData,
+        glBufferSubData,
+        glClear,
+        glClearColor,
+        glColorMask,
+        glCullFace,
+        glDepthFunc,
+        glDepthMask,
+        glDisable,
+        glDrawArrays,
+        glDrawElements,
+        glDrawRangeElements,
+        glEnable,
+        glMapBufferRange,
+        glScissor,
+        glTexSubImage2D,
+        glUnmapBuffer,
+        glViewport,
+
+        Count
+    };
+
+    const char* const g_entry_point_names[] =
+    {
+        "glActiveTexture",
+        "glBindBuffer",
+        "glBindTexture",
+        "glBindVertexArray",
+        "glBlendFunc",
+        "glBufferData",
+        "glBufferSubData",
+        "glClear",
+        "glClearColor",
+        "glColorMask",
+        "glCullFace",
+        "glDepthFunc",
+        "glDepthMask",
+        "glDisable",
+        "glDrawArrays",
+        "glDrawElements",
+        "glDrawRangeElements",
+        "glEnable",
+        "glMapBufferRange",
+        "glScissor",
+        "glTexSubImage2D",
+        "glUnmapBuffer",
+        "glViewport",
+    };
+
+    static_assert(sizeof(g_entry_point_names) / sizeof(g_entry_point_names[0]) == static_cast<size_t>(BenchmarkEntryPoint::Count),
+                  "Entry point name table is out of sync with BenchmarkEntryPoint.");
+
+    const uint32_t g_n_buffers       = 4;
+    const uint32_t g_n_textures      = 4;
+    const uint32_t g_n_vaos          = 2;
+    const uint32_t g_surface_height  = 720;
+    const uint32_t g_surface_width   = 1280;
+    const uint32_t g_texture_size    = 256;
+    const uint32_t g_upload_size     = 4096;
+    const uint32_t g_upload_tex_size = 64;
+    const uint32_t g_vbo_size        = 65536;
+
+    /* Provides a fixed-size surface. Nothing is ever presented, since the backend does not render. */
+    class NullWSIContext : public VKGL::IWSIContext
+    {
+    public:
+        NullWSIContext()
+            :m_height           (g_surface_height),
+             m_is_debug         (false),
+             m_is_fwd_compatible(false),
+             m_major_version    (4),
+             m_minor_version    (5),
+             m_n_layer_plane    (0),
+             m_pixel_format_reqs(8,  /* in_n_alpha_bits   */
+                                 8,  /* in_n_blue_bits    */
+                                 24, /* in_n_depth_bits   */
+                                 8,  /* in_n_green_bits   */
+                                 8,  /* in_n_red_bits     */
+                                 8), /* in_n_stencil_bits */
+             m_swap_interval    (0),
+             m_width            (g_surface_width)
+        {
+            /* Stub */
+        }
+
+        const uint32_t&                      get_major_version            () const final { return m_major_version;     }
+        const uint32_t&                      get_minor_version            () const final { return m_minor_version;     }
+        const uint32_t&                      get_n_layer_plane            () const final { return m_n_layer_plane;     }
+        const VKGL::PixelFormatRequirements& get_pixel_format_requirements() const final { return m_pixel_format_reqs; }
+        const int&                           get_swap_interval            () const final { return m_swap_interval;     }
+        const bool&                          is_debug_context             () const final { return m_is_debug;          }
+        const bool&                          is_forward_compatible_context() const final { return m_is_fwd_compatible; }
+
+        void get_rendering_surface_size(uint32_t* out_width_ptr,
+                                        uint32_t* out_height_ptr) const final
+        {
+            *out_height_ptr = m_height;
+            *out_width_ptr  = m_width;
+        }
+
+    private:
+        uint32_t                      m_height;
+        bool                          m_is_debug;
+        bool                          m_is_fwd_compatible;
+        uint32_t                      m_major_version;
+        uint32_t                      m_minor_version;
+        uint32_t                      m_n_layer_plane;
+        VKGL::PixelFormatRequirements m_pixel_format_reqs;
+        int                           m_swap_interval;
+        uint32_t                      m_width;
+    };
+
+    /* Call policies. Mixes are written once against these, so that the untimed & timed runs issue exactly the same calls. */
+    class UntimedCalls
+    {
+    public:
+        UntimedCalls()
+            :m_n_calls(0)
+        {
+            /* Stub */
+        }
+
+        template<typename FunctionType>
+        void call(const BenchmarkEntryPoint&,
+                  FunctionType               in_function)
+        {
+            in_function();
+
+            m_n_calls++;
+        }
+
+        const uint64_t& get_n_calls() const
+        {
+            return m_n_calls;
+        }
+
+    private:
+        uint64_t m_n_calls;
+    };
+
+    class TimedCalls
+    {
+    public:
+        TimedCalls()
+        {
+            memset(m_n_calls,
+                   0,
+                   sizeof(m_n_calls) );
+            memset(m_n_ticks,
+                   0,
+                   sizeof(m_n_ticks) );
+        }
+
+        template<typename FunctionType>
+        void call(const BenchmarkEntryPoint& in_entry_point,
+                  FunctionType               in_function)
+        {
+            const auto start_time = std::chrono::steady_clock::now();
+            {
+                in_function();
+            }
+            const auto end_time = std::chrono::steady_clock::now();
+
+            m_n_calls[static_cast<uint32_t>(in_entry_point)]++;
+            m_n_ticks[static_cast<uint32_t>(in_entry_point)] += std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count();
+        }
+
+        void get_results(const double&                                          in_clock_overhead_ns,
+                         std::vector<OpenGL::FrontendBenchmarkEntryPointResult>* out_results_ptr) const
+        {
+            for (uint32_t n_entry_point = 0;
+                          n_entry_point < static_cast<uint32_t>(BenchmarkEntryPoint::Count);
+                        ++n_entry_point)
+            {
+                OpenGL::FrontendBenchmarkEntryPointResult result;
+
+                if (m_n_calls[n_entry_point] == 0)
+                {
+                    continue;
+                }
+
+                result.name        = g_entry_point_names[n_entry_point];
+                result.n_calls     = m_n_calls[n_entry_point];
+                result.ns_per_call = std::max(static_cast<double>(m_n_ticks[n_entry_point]) / static_cast<double>(m_n_calls[n_entry_point]) - in_clock_overhead_ns,
+                                              0.0);
+
+                out_results_ptr->push_back(result);
+            }
+        }
+
+    private:
+        uint64_t m_n_calls[static_cast<uint32_t>(BenchmarkEntryPoint::Count)];
+        uint64_t m_n_ticks[static_cast<uint32_t>(BenchmarkEntryPoint::Count)];
+    };
+
+    typedef struct BenchmarkObjects
+    {
+        GLuint buffer_ids [g_n_buffers];
+        GLuint index_buffer_id;
+        GLuint texture_ids[g_n_textures];
+        GLuint vao_ids    [g_n_vaos];
+
+        std::vector<uint8_t> upload_data;
+    } BenchmarkObjects;
+
+    double calibrate_clock_overhead_ns()
+    {
+        const uint32_t n_samples = 100000;
+        uint64_t       n_ticks   = 0;
+
+        for (uint32_t n_sample = 0;
+                      n_sample < n_samples;
+                    ++n_sample)
+        {
+            const auto start_time = std::chrono::steady_clock::now();
+            const auto end_time   = std::chrono::steady_clock::now();
+
+            n_ticks += std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count();
+        }
+
+        return static_cast<double>(n_ticks) / static_cast<double>(n_samples);
+    }
+
+    void create_objects(BenchmarkObjects* out_objects_ptr)
+    {
+        const uint16_t indices[] = {0, 1, 2, 2, 1, 3};
+
+        out_objects_ptr->upload_data.resize(g_upload_tex_size * g_upload_tex_size * 4 /* RGBA8 */,
+                                            0x7F);
+
+        OpenGL::vkglGenBuffers     (g_n_buffers,
+                                    out_objects_ptr->buffer_ids);
+        OpenGL::vkglGenBuffers     (1,
+                                   &out_objects_ptr->index_buffer_id);
+        OpenGL::vkglGenTextures    (g_n_textures,
+                                    out_objects_ptr->texture_ids);
+        OpenGL::vkglGenVertexArrays(g_n_vaos,
+                                    out_objects_ptr->vao_ids);
+
+        for (uint32_t n_buffer = 0;
+                      n_buffer < g_n_buffers;
+                    ++n_buffer)
+        {
+            OpenGL::vkglBindBuffer(GL_ARRAY_BUFFER,
+                                   out_objects_ptr->buffer_ids[n_buffer]);
+            OpenGL::vkglBufferData(GL_ARRAY_BUFFER,
+                                   g_vbo_size,
+                                   nullptr, /* data */
+                                   GL_STREAM_DRAW);
+        }
+
+        OpenGL::vkglBindBuffer(GL_ELEMENT_ARRAY_BUFFER,
+                               out_objects_ptr->index_buffer_id);
+        OpenGL::vkglBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                               sizeof(indices),
+                               indices,
+                               GL_STATIC_DRAW);
+
+        for (uint32_t n_texture = 0;
+                      n_texture < g_n_textures;
+                    ++n_texture)
+        {
+            OpenGL::vkglBindTexture(GL_TEXTURE_2D,
+                                    out_objects_ptr->texture_ids[n_texture]);
+            OpenGL::vkglTexImage2D (GL_TEXTURE_2D,
+                                    0, /* level */
+                                    GL_RGBA8,
+                                    g_texture_size,
+                                    g_texture_size,
+                                    0, /* border */
+                                    GL_RGBA,
+                                    GL_UNSIGNED_BYTE,
+                                    nullptr);
+        }
+    }
+
+    void destroy_objects(BenchmarkObjects* in_objects_ptr)
+    {
+        OpenGL::vkglDeleteVertexArrays(g_n_vaos,
+                                       in_objects_ptr->vao_ids);
+        OpenGL::vkglDeleteTextures    (g_n_textures,
+                                       in_objects_ptr->texture_ids);
+        OpenGL::vkglDeleteBuffers     (1,
+                                      &in_objects_ptr->index_buffer_id);
+        OpenGL::vkglDeleteBuffers     (g_n_buffers,
+                                       in_objects_ptr->buffer_ids);
+    }
+
+    template<typename CallPolicy>
+    void run_draw_mix(const BenchmarkObjects& in_objects,
+                      const uint32_t&         in_n_iterations,
+                      CallPolicy*             in_calls_ptr)
+    {
+        for (uint32_t n_iteration = 0;
+                      n_iteration < in_n_iterations;
+                    ++n_iteration)
+        {
+            const GLuint vao_id = in_objects.vao_ids[n_iteration % g_n_vaos];
+
+            in_calls_ptr->call(BenchmarkEntryPoint::glClear,             [&]() { OpenGL::vkglClear            (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);                          });
+            in_calls_ptr->call(BenchmarkEntryPoint::glBindVertexArray,   [&]() { OpenGL::vkglBindVertexArray  (vao_id);                                                              });
+            in_calls_ptr->call(BenchmarkEntryPoint::glBindBuffer,        [&]() { OpenGL::vkglBindBuffer       (GL_ELEMENT_ARRAY_BUFFER, in_objects.index_buffer_id);                });
+
+            for (uint32_t n_draw = 0;
+                          n_draw < 8;
+                        ++n_draw)
+            {
+                in_calls_ptr->call(BenchmarkEntryPoint::glDrawArrays,        [&]() { OpenGL::vkglDrawArrays       (GL_TRIANGLES, 0, 36);                                             });
+                in_calls_ptr->call(BenchmarkEntryPoint::glDrawElements,      [&]() { OpenGL::vkglDrawElements     (GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);                     });
+                in_calls_ptr->call(BenchmarkEntryPoint::glDrawRangeElements, [&]() { OpenGL::vkglDrawRangeElements(GL_TRIANGLES, 0, 3, 6, GL_UNSIGNED_SHORT, nullptr);               });
+            }
+        }
+    }
+
+    template<typename CallPolicy>
+    void run_state_mix(const BenchmarkObjects& in_objects,
+                       const uint32_t&         in_n_iterations,
+                       CallPolicy*             in_calls_ptr)
+    {
+        for (uint32_t n_iteration = 0;
+                      n_iteration < in_n_iterations;
+                    ++n_iteration)
+        {
+            const GLuint  buffer_id    = in_objects.buffer_ids [n_iteration % g_n_buffers];
+            const GLsizei scissor_size = static_cast<GLsizei>(16 + n_iteration % 64);
+            const GLuint  texture_id   = in_objects.texture_ids[n_iteration % g_n_textures];
+            const GLenum  texture_unit = GL_TEXTURE0 + (n_iteration % g_n_textures);
+
+            in_calls_ptr->call(BenchmarkEntryPoint::glEnable,        [&]() { OpenGL::vkglEnable       (GL_BLEND);                                          });
+            in_calls_ptr->call(BenchmarkEntryPoint::glBlendFunc,     [&]() { OpenGL::vkglBlendFunc    (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);              });
+            in_calls_ptr->call(BenchmarkEntryPoint::glEnable,        [&]() { OpenGL::vkglEnable       (GL_DEPTH_TEST);                                     });
+            in_calls_ptr->call(BenchmarkEntryPoint::glDepthFunc,     [&]() { OpenGL::vkglDepthFunc    (GL_LEQUAL);                                         });
+            in_calls_ptr->call(BenchmarkEntryPoint::glDepthMask,     [&]() { OpenGL::vkglDepthMask    (GL_FALSE);                                          });
+            in_calls_ptr->call(BenchmarkEntryPoint::glCullFace,      [&]() { OpenGL::vkglCullFace     (GL_BACK);                                           });
+            in_calls_ptr->call(BenchmarkEntryPoint::glViewport,      [&]() { OpenGL::vkglViewport     (0, 0, g_surface_width, g_surface_height);           });
+            in_calls_ptr->call(BenchmarkEntryPoint::glScissor,       [&]() { OpenGL::vkglScissor      (0, 0, scissor_size, scissor_size);                  });
+            in_calls_ptr->call(BenchmarkEntryPoint::glClearColor,    [&]() { OpenGL::vkglClearColor   (0.0f, 0.0f, 0.0f, 1.0f);                            });
+            in_calls_ptr->call(BenchmarkEntryPoint::glColorMask,     [&]() { OpenGL::vkglColorMask    (GL_TRUE, GL_TRUE, GL_TRUE, GL_FALSE);               });
+            in_calls_ptr->call(BenchmarkEntryPoint::glActiveTexture, [&]() { OpenGL::vkglActiveTexture(texture_unit);                                      });
+            in_calls_ptr->call(BenchmarkEntryPoint::glBindTexture,   [&]() { OpenGL::vkglBindTexture  (GL_TEXTURE_2D, texture_id);                         });
+            in_calls_ptr->call(BenchmarkEntryPoint::glBindBuffer,    [&]() { OpenGL::vkglBindBuffer   (GL_ARRAY_BUFFER, buffer_id);                        });
+            in_calls_ptr->call(BenchmarkEntryPoint::glDepthMask,     [&]() { OpenGL::vkglDepthMask    (GL_TRUE);                                           });
+            in_calls_ptr->call(BenchmarkEntryPoint::glDisable,       [&]() { OpenGL::vkglDisable      (GL_DEPTH_TEST);                                     });
+            in_calls_ptr->call(BenchmarkEntryPoint::glDisable,       [&]() { OpenGL::vkglDisable      (GL_BLEND);                                          });
+        }
+    }
+
+    template<typename CallPolicy>
+    void run_upload_mix(const BenchmarkObjects& in_objects,
+                        const uint32_t&         in_n_iterations,
+                        CallPolicy*             in_calls_ptr)
+    {
+        const void* data_ptr = in_objects.upload_data.data();
+
+        for (uint32_t n_iteration = 0;
+                      n_iteration < in_n_iterations;
+                    ++n_iteration)
+        {
+            const GLuint   buffer_id     = in_objects.buffer_ids [n_iteration % g_n_buffers];
+            void*          mapped_ptr    = nullptr;
+            const GLintptr upload_offset = static_cast<GLintptr>( (n_iteration * g_upload_size) % g_vbo_size);
+            const GLuint   texture_id    = in_objects.texture_ids[n_iteration % g_n_textures];
+            const GLint    texture_x     = static_cast<GLint>( (n_iteration * g_upload_tex_size) % g_texture_size);
+
+            in_calls_ptr->call(BenchmarkEntryPoint::glBindBuffer,     [&]() { OpenGL::vkglBindBuffer (GL_ARRAY_BUFFER, buffer_id);                                                   });
+            in_calls_ptr->call(BenchmarkEntryPoint::glBufferSubData,  [&]() { OpenGL::vkglBufferSubData(GL_ARRAY_BUFFER, upload_offset, g_upload_size, data_ptr);                    });
+            in_calls_ptr->call(BenchmarkEntryPoint::glMapBufferRange, [&]() { mapped_ptr = OpenGL::vkglMapBufferRange(GL_ARRAY_BUFFER, upload_offset, g_upload_size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT); });
+
+            if (mapped_ptr != nullptr)
+            {
+                memcpy(mapped_ptr,
+                       data_ptr,
+                       g_upload_size);
+            }
+
+            in_calls_ptr->call(BenchmarkEntryPoint::glUnmapBuffer,    [&]() { OpenGL::vkglUnmapBuffer(GL_ARRAY_BUFFER);                                                              });
+
+            if ((n_iteration % 16) == 15)
+            {
+                /* Orphan the buffer every now and then, as streaming apps do. */
+                in_calls_ptr->call(BenchmarkEntryPoint::glBufferData, [&]() { OpenGL::vkglBufferData(GL_ARRAY_BUFFER, g_vbo_size, nullptr, GL_STREAM_DRAW);                          });
+            }
+
+            in_calls_ptr->call(BenchmarkEntryPoint::glBindTexture,    [&]() { OpenGL::vkglBindTexture(GL_TEXTURE_2D, texture_id);                                                    });
+            in_calls_ptr->call(BenchmarkEntryPoint::glTexSubImage2D,  [&]() { OpenGL::vkglTexSubImage2D(GL_TEXTURE_2D, 0, texture_x, 0, g_upload_tex_size, g_upload_tex_size, GL_RGBA, GL_UNSIGNED_BYTE, data_ptr); });
+        }
+    }
+
+    template<typename CallPolicy>
+    bool run_mix(const char*             in_mix_name,
+                 const BenchmarkObjects& in_objects,
+                 const uint32_t&         in_n_iterations,
+                 CallPolicy*             in_calls_ptr)
+    {
+        bool result = true;
+
+        if (strcmp(in_mix_name, "draw") == 0)
+        {
+            run_draw_mix(in_objects,
+                         in_n_iterations,
+                         in_calls_ptr);
+        }
+        else
+        if (strcmp(in_mix_name, "state") == 0)
+        {
+            run_state_mix(in_objects,
+                          in_n_iterations,
+                          in_calls_ptr);
+        }
+        else
+        if (strcmp(in_mix_name, "upload") == 0)
+        {
+            run_upload_mix(in_objects,
+                           in_n_iterations,
+                           in_calls_ptr);
+        }
+        else
+        {
+            result = false;
+        }
+
+        return result;
+    }
+};
+
+int vkgl_run_frontend_benchmark(const char*                      in_mix_name,
+                                uint32_t                         in_n_iterations,
+                                OpenGL::FrontendBenchmarkResult* out_result_ptr)
+{
+    OpenGL::NullBackendUniquePtr backend_ptr;
+    double                       clock_overhead_ns = 0.0;
+    OpenGL::ContextUniquePtr     context_ptr;
+    BenchmarkObjects             objects;
+    int                          result            = 1;
+    TimedCalls                   timed_calls;
+    UntimedCalls                 untimed_calls;
+    UntimedCalls                 warmup_calls;
+    NullWSIContext               wsi_context;
+
+    /* Benchmark calls must not end up in a capture. */
+    OpenGL::g_gl_capture_enabled.store(false,
+                                       std::memory_order_relaxed);
+
+    backend_ptr = OpenGL::NullBackend::create(false); /* in_record_calls */
+
+    if (backend_ptr == nullptr)
+    {
+        vkgl_assert(backend_ptr != nullptr);
+
+        goto end;
+    }
+
+    context_ptr = OpenGL::Context::create(&wsi_context,
+                                          dynamic_cast<const OpenGL::IBackend*>            (backend_ptr.get() ),
+                                          dynamic_cast<OpenGL::IBackendGLCallbacks*>       (backend_ptr.get() ),
+                                          dynamic_cast<const OpenGL::IBackendCapabilities*>(backend_ptr.get() ));
+
+    if (context_ptr == nullptr)
+    {
+        vkgl_assert(context_ptr != nullptr);
+
+        goto end;
+    }
+
+    setGlThreadSpecific(context_ptr.get() );
+    {
+        create_objects(&objects);
+
+        /* Warm caches & let any lazily-created frontend state get created before measuring. */
+        if (!run_mix(in_mix_name,
+                     objects,
+                     std::max(in_n_iterations / 10, 1u),
+                    &warmup_calls) )
+        {
+            VKGL::g_logger_ptr->log(VKGL::LogLevel::Error,
+                                    "Unrecognized frontend benchmark mix [%s].",
+                                    in_mix_name);
+        }
+        else
+        {
+            backend_ptr->reset_counters();
+
+            {
+                const auto start_time = std::chrono::steady_clock::now();
+
+                run_mix(in_mix_name,
+                        objects,
+                        in_n_iterations,
+                       &untimed_calls);
+
+                const auto end_time = std::chrono::steady_clock::now();
+
+                out_result_ptr->n_backend_callbacks = backend_ptr->get_total_n_calls();
+                out_result_ptr->n_calls             = untimed_calls.get_n_calls();
+                out_result_ptr->ns_per_call         = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count() ) /
+                                                      static_cast<double>(std::max(untimed_calls.get_n_calls(), static_cast<uint64_t>(1) ));
+            }
+
+            clock_overhead_ns = calibrate_clock_overhead_ns();
+
+            run_mix(in_mix_name,
+                    objects,
+                    in_n_iterations,
+                   &timed_calls);
+
+            out_result_ptr->entry_points.clear();
+
+            timed_calls.get_results(clock_overhead_ns,
+                                   &out_result_ptr->entry_points);
+
+            result = 0;
+        }
+
+        destroy_objects(&objects);
+    }
+    setGlThreadSpecific(nullptr);
+
+end:
+    /* Context must go away before the backend it was created for. */
+    context_ptr.reset();
+    backend_ptr.reset();
+
+    return result;
+}
@@ -4,6 +4,8 @@
  */
 #include "Common/macros.h"
 #include "OpenGL/namespace.h"
+#include <algorithm>
+#include <iterator>
 
 OpenGL::Namespace::Namespace(const GLuint& in_start_id)
     :m_n_allocated_ids(0),
@@ -21,6 +23,46 @@ OpenGL::Namespace::~Namespace()
     /* Stub */
 }
 
+/* Adds [@param in_range_start, @param in_range_end) to the free ranges, merging it with its neighbours. The range must
+ * not overlap any of the existing ones.
+ */
+void OpenGL::Namespace::add_free_range(GLuint in_range_start,
+                                       GLuint in_range_end)
+{
+    FUN_ENTRY(DEBUG_DEPTH);
+
+    auto next_range_iterator = m_free_ranges.lower_bound(in_range_start);
+
+    vkgl_assert(next_range_iterator == m_free_ranges.end() ||
+                next_range_iterator->first >= in_range_end);
+
+    if (next_range_iterator        != m_free_ranges.end() &&
+        next_range_iterator->first == in_range_end)
+    {
+        in_range_end = next_range_iterator->second;
+
+        next_range_iterator = m_free_ranges.erase(next_range_iterator);
+    }
+
+    if (next_range_iterator != m_free_ranges.begin() )
+    {
+        auto prev_range_iterator = std::prev(next_range_iterator);
+
+        vkgl_assert(prev_range_iterator->second <= in_range_start);
+
+        if (prev_range_iterator->second == in_range_start)
+        {
+            prev_range_iterator->second = in_range_end;
+
+            goto end;
+        }
+    }
+
+    m_free_ranges[in_range_start] = in_range_end;
+end:
+    ;
+}
+
 void OpenGL::Namespace::allocate(const uint32_t& in_n_ids,
                                  GLuint*         out_ids_ptr)
 {
@@ -28,19 +70,30 @@ void OpenGL::Namespace::allocate(const uint32_t& in_n_ids,
     
     uint32_t n_allocated_ids = 0;
 
-    /* Try to assign IDs from a pool of IDs which have already been distributed & returned. */
-    while (n_allocated_ids != in_n_ids)
+    /* Try to assign IDs from the ranges which have already been distributed & returned. Lowest IDs go first,
+     * so that the ID space stays dense.
+     */
+    while (n_allocated_ids      != in_n_ids &&
+           m_free_ranges.size() != 0)
     {
-        if (m_available_ids.size() == 0)
+        auto         range_iterator = m_free_ranges.begin();
+        const GLuint range_start    = range_iterator->first;
+        const GLuint range_end      = range_iterator->second;
+        const GLuint n_ids_to_take  = std::min(range_end - range_start,
+                                               in_n_ids  - n_allocated_ids);
+
+        for (GLuint n_id = 0;
+                    n_id < n_ids_to_take;
+                  ++n_id)
         {
-            break;
+            out_ids_ptr[n_allocated_ids++] = range_start + n_id;
         }
-        else
-        {
-            out_ids_ptr[n_allocated_ids] = m_available_ids.back();
 
-            m_available_ids.pop_back();
-            n_allocated_ids++;
+        m_free_ranges.erase(range_iterator);
+
+        if (range_start + n_ids_to_take != range_end)
+        {
+            m_free_ranges[range_start + n_ids_to_take] = range_end;
         }
     }
 
@@ -59,14 +112,72 @@ void OpenGL::Namespace::release(const uint32_t& in_n_ids,
 {
     FUN_ENTRY(DEBUG_DEPTH);
     
-    for (uint32_t n_id = 0;
-                  n_id < in_n_ids;
-                ++n_id)
+    uint32_t n_id = 0;
+
+    while (n_id < in_n_ids)
+    {
+        /* Apps usually release IDs in the order they were handed out, so coalesce consecutive IDs into a single range
+         * before touching the map.
+         */
+        GLuint range_start = in_ids_ptr[n_id++];
+        GLuint range_end   = range_start + 1;
+
+        while (n_id             <  in_n_ids &&
+               in_ids_ptr[n_id] == range_end)
+        {
+            range_end++;
+            n_id     ++;
+        }
+
+        /* Silently ignore IDs which have never been handed out, as GL requires. Only the part of the run which falls
+         * outside the allocated range is dropped.
+         */
+        range_start = std::max(range_start, m_start_id);
+        range_end   = std::min(range_end,   m_start_id + m_n_allocated_ids);
+
+        /* IDs which are already free (deleted twice, or listed twice) must not be added again, or allocate() would hand
+         * them out more than once. Only add the parts of the run which are not covered by an existing range.
+         */
+        while (range_start < range_end)
+        {
+            auto         next_range_iterator = m_free_ranges.upper_bound(range_start);
+            GLuint       piece_end           = range_end;
+
+            if (next_range_iterator != m_free_ranges.begin() )
+            {
+                const auto prev_range_iterator = std::prev(next_range_iterator);
+
+                if (prev_range_iterator->second > range_start)
+                {
+                    range_start = prev_range_iterator->second;
+
+                    continue;
+                }
+            }
+
+            if (next_range_iterator        != m_free_ranges.end() &&
+                next_range_iterator->first <  piece_end)
+            {
+                piece_end = next_range_iterator->first;
+            }
+
+            add_free_range(range_start,
+                           piece_end);
+
+            range_start = piece_end;
+        }
+    }
+
+    /* Give the topmost range back to the never-allocated pool. */
+    if (m_free_ranges.size() != 0)
     {
-        vkgl_assert(std::find(m_available_ids.begin(),
-                              m_available_ids.end(),
-                              in_ids_ptr[n_id]) == m_available_ids.end() );
+        auto last_range_iterator = std::prev(m_free_ranges.end() );
 
-        m_available_ids.push_back(in_ids_ptr[n_id]);
+        if (last_range_iterator->second == m_start_id + m_n_allocated_ids)
+        {
+            m_n_allocated_ids = last_range_iterator->first - m_start_id;
+
+            m_free_ranges.erase(last_range_iterator);
+        }
     }
 }
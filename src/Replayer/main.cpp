@@ -0,0 +1,66 @@
+/* VKGL (c) 2018 Dominik Witczak
+ *
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ */
+#include "OpenGL/entrypoints/gl_replayer.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Standalone GL capture replayer.
+ *
+ * Usage: vkgl_replay <capture file>
+ *
+ * Replays a stream recorded with VKGL_CAPTURE=1 as fast as possible, using headless mode (1280x720, unless VKGL_HEADLESS
+ * is already set), and reports frame rate & CPU time per frame.
+ */
+int main(int argc, char** argv)
+{
+    int                   result = EXIT_FAILURE;
+    OpenGL::GLReplayStats stats;
+
+    if (argc != 2)
+    {
+        fprintf(stderr,
+                "Usage: %s <capture file>\n",
+                argv[0]);
+
+        goto end;
+    }
+
+    setenv("VKGL_HEADLESS",
+           "1280x720",
+           0); /* overwrite */
+
+    if (vkgl_replay_capture(argv[1],
+                           &stats) != 0)
+    {
+        fprintf(stderr,
+                "Could not replay [%s]\n",
+                argv[1]);
+
+        goto end;
+    }
+
+    printf("Replayed %u frames (%llu calls) in %.2f ms\n",
+           stats.n_frames,
+           static_cast<unsigned long long>(stats.n_calls),
+           stats.wall_time_ms);
+
+    if (stats.n_frames > 0)
+    {
+        printf("  Frames/s:            %.2f\n"
+               "  CPU time per frame:  %.3f ms\n"
+               "  Frame time (avg):    %.3f ms\n"
+               "  Frame time (min):    %.3f ms\n"
+               "  Frame time (max):    %.3f ms\n",
+               static_cast<double>(stats.n_frames) * 1000.0 / stats.wall_time_ms,
+               stats.cpu_time_ms  / static_cast<double>(stats.n_frames),
+               stats.wall_time_ms / static_cast<double>(stats.n_frames),
+               stats.min_frame_time_ms,
+               stats.max_frame_time_ms);
+    }
+
+    result = EXIT_SUCCESS;
+end:
+    return result;
+}